@@ -94,6 +94,13 @@ struct HeapStatistics final {
     std::vector<PageStatistics> page_stats;
     /** Statistics for the freelist of the space. */
     FreeListStatistics free_list_stats;
+    /**
+     * Amount of free memory on the pages of the space that is still resident,
+     * i.e., memory that could be returned by compacting the space.
+     */
+    size_t fragmented_size_bytes = 0;
+    /** Whether the space may be compacted. */
+    bool is_compactable = false;
   };
 
   /** Overall committed amount of memory for the heap. */
@@ -151,6 +151,19 @@ class V8_EXPORT Heap {
      * GC scheduler follows.
      */
     ResourceConstraints resource_constraints;
+
+    /**
+     * Allows the compactor to also move objects allocated on the default
+     * spaces, in addition to objects on compactable custom spaces. Pages that
+     * hold objects referenced from persistent handles or that have
+     * pre-finalizers registered are never moved.
+     *
+     * Objects on the default spaces must then only be referenced through
+     * traced `Member`, `WeakMember`, and `UncompressedMember` fields and
+     * persistent handles. E.g. raw pointers or `UntracedMember` references are
+     * not updated when the object is moved.
+     */
+    bool compact_default_spaces = false;
   };
 
   /**
@@ -23,6 +23,14 @@ struct HasFinalizeGarbageCollectedObject<
     std::void_t<decltype(std::declval<T>().FinalizeGarbageCollectedObject())>>
     : std::true_type {};
 
+template <typename T, typename = void>
+struct HasThreadSafeFinalizerTypeMarker : std::false_type {};
+
+template <typename T>
+struct HasThreadSafeFinalizerTypeMarker<
+    T, std::void_t<typename T::IsThreadSafeFinalizerTypeMarker>>
+    : std::true_type {};
+
 // The FinalizerTraitImpl specifies how to finalize objects.
 template <typename T, bool isFinalized>
 struct FinalizerTraitImpl;
@@ -79,6 +87,14 @@ struct FinalizerTrait {
  public:
   static constexpr bool HasFinalizer() { return kNonTrivialFinalizer; }
 
+  // Whether the finalizer may be invoked on threads other than the one that
+  // created the object. See CPPGC_THREAD_SAFE_FINALIZER.
+  static constexpr bool HasThreadSafeFinalizer() {
+    return kNonTrivialFinalizer &&
+           HasThreadSafeFinalizerTypeMarker<
+               typename std::remove_cv<T>::type>::value;
+  }
+
   // The callback used to finalize an object of type T.
   static constexpr FinalizationCallback kCallback =
       kNonTrivialFinalizer ? Finalize : nullptr;
@@ -36,9 +36,9 @@ struct V8_EXPORT EnsureGCInfoIndexTrait final {
 
   static GCInfoIndex V8_PRESERVE_MOST
   EnsureGCInfoIndex(std::atomic<GCInfoIndex>&, TraceCallback,
-                    FinalizationCallback, NameCallback);
+                    FinalizationCallback, bool, NameCallback);
   static GCInfoIndex V8_PRESERVE_MOST EnsureGCInfoIndex(
-      std::atomic<GCInfoIndex>&, TraceCallback, FinalizationCallback);
+      std::atomic<GCInfoIndex>&, TraceCallback, FinalizationCallback, bool);
   static GCInfoIndex V8_PRESERVE_MOST
   EnsureGCInfoIndex(std::atomic<GCInfoIndex>&, TraceCallback, NameCallback);
   static GCInfoIndex V8_PRESERVE_MOST
@@ -55,25 +55,27 @@ struct V8_EXPORT EnsureGCInfoIndexTrait final {
     }                                                            \
   };
 
-// ------------------------------------------------------- //
-// DISPATCH(has_finalizer, has_non_hidden_name, function)  //
-// ------------------------------------------------------- //
-DISPATCH(true, true,                                       //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace,           //
-                           FinalizerTrait<T>::kCallback,   //
-                           NameTrait<T>::GetName))         //
-DISPATCH(true, false,                                      //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace,           //
-                           FinalizerTrait<T>::kCallback))  //
-DISPATCH(false, true,                                      //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace,           //
-                           NameTrait<T>::GetName))         //
-DISPATCH(false, false,                                     //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace))          //
+// ---------------------------------------------------------------------- //
+// DISPATCH(has_finalizer, has_non_hidden_name, function)                 //
+// ---------------------------------------------------------------------- //
+DISPATCH(true, true,                                                      //
+         EnsureGCInfoIndex(registered_index,                              //
+                           TraceTrait<T>::Trace,                          //
+                           FinalizerTrait<T>::kCallback,                  //
+                           FinalizerTrait<T>::HasThreadSafeFinalizer(),   //
+                           NameTrait<T>::GetName))                        //
+DISPATCH(true, false,                                                     //
+         EnsureGCInfoIndex(registered_index,                              //
+                           TraceTrait<T>::Trace,                          //
+                           FinalizerTrait<T>::kCallback,                  //
+                           FinalizerTrait<T>::HasThreadSafeFinalizer()))  //
+DISPATCH(false, true,                                                     //
+         EnsureGCInfoIndex(registered_index,                              //
+                           TraceTrait<T>::Trace,                          //
+                           NameTrait<T>::GetName))                        //
+DISPATCH(false, false,                                                    //
+         EnsureGCInfoIndex(registered_index,                              //
+                           TraceTrait<T>::Trace))                         //
 
 #undef DISPATCH
 
@@ -115,6 +117,11 @@ struct GCInfoFolding final {
   static constexpr bool kHasCustomFinalizerDispatchAtBase =
       internal::HasFinalizeGarbageCollectedObject<
           ParentMostGarbageCollectedType>::value;
+  // Folding must not make a finalizer that is not thread-safe run on a
+  // concurrent thread.
+  static constexpr bool kHasSameFinalizerThreadSafety =
+      FinalizerTrait<T>::HasThreadSafeFinalizer() ==
+      FinalizerTrait<ParentMostGarbageCollectedType>::HasThreadSafeFinalizer();
 #ifdef CPPGC_SUPPORTS_OBJECT_NAMES
   static constexpr bool kWantsDetailedObjectNames = true;
 #else   // !CPPGC_SUPPORTS_OBJECT_NAMES
@@ -130,6 +137,7 @@ struct GCInfoFolding final {
     if constexpr ((kHasVirtualDestructorAtBase ||
                    kBothTypesAreTriviallyDestructible ||
                    kHasCustomFinalizerDispatchAtBase) &&
+                  kHasSameFinalizerThreadSafety &&
                   !kWantsDetailedObjectNames) {
       GCInfoTrait<T>::CheckCallbacksAreDefined();
       GCInfoTrait<ParentMostGarbageCollectedType>::CheckCallbacksAreDefined();
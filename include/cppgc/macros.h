@@ -30,6 +30,19 @@ namespace cppgc {
 #define CPPGC_STACK_ALLOCATED_IGNORE(bug_or_reason)
 #endif  // !defined(__clang__)
 
+// Use CPPGC_THREAD_SAFE_FINALIZER if the finalizer of a garbage-collected
+// class, i.e., its destructor or FinalizeGarbageCollectedObject(), may run on
+// any thread. Such finalizers may be invoked by concurrent sweeper tasks
+// instead of being deferred to the thread the object was created on. The
+// finalizer must not access other garbage-collected objects or thread-local
+// state. The annotation is inherited by subclasses.
+#define CPPGC_THREAD_SAFE_FINALIZER()           \
+ public:                                        \
+  using IsThreadSafeFinalizerTypeMarker = void; \
+                                                \
+ private:                                       \
+  static_assert(true, "Force semicolon.")
+
 }  // namespace cppgc
 
 #endif  // INCLUDE_CPPGC_MACROS_H_
@@ -74,6 +74,7 @@ class V8_EXPORT Visitor {
   void Trace(const Member<T>& member) {
     const T* value = member.GetRawAtomic();
     CPPGC_DCHECK(value != kSentinelPointer);
+    HandleMemberSlotIfNeeded(member, value);
     TraceImpl(value);
   }
 
@@ -98,6 +99,7 @@ class V8_EXPORT Visitor {
     }
 
     CPPGC_DCHECK(value != kSentinelPointer);
+    HandleMemberSlotIfNeeded(weak_member, value);
     VisitWeak(value, TraceTrait<T>::GetTraceDescriptor(value),
               &HandleWeak<WeakMember<T>>, &weak_member);
   }
@@ -112,6 +114,7 @@ class V8_EXPORT Visitor {
   void Trace(const subtle::UncompressedMember<T>& member) {
     const T* value = member.GetRawAtomic();
     CPPGC_DCHECK(value != kSentinelPointer);
+    HandleMemberSlotIfNeeded(member, value);
     TraceImpl(value);
   }
 #endif  // defined(CPPGC_POINTER_COMPRESSION)
@@ -215,11 +218,13 @@ class V8_EXPORT Visitor {
                       const Member<ValueType>* member_value) {
     const KeyType* key = weak_member_key.GetRawAtomic();
     if (!key) return;
+    HandleMemberSlotIfNeeded(weak_member_key, key);
 
     // `value` must always be non-null.
     CPPGC_DCHECK(member_value);
     const ValueType* value = member_value->GetRawAtomic();
     if (!value) return;
+    HandleMemberSlotIfNeeded(*member_value, value);
 
     // KeyType and ValueType may refer to GarbageCollectedMixin.
     TraceDescriptor value_desc =
@@ -250,6 +255,7 @@ class V8_EXPORT Visitor {
                   "garbage-collected types must use WeakMember and Member");
     const KeyType* key = weak_member_key.GetRawAtomic();
     if (!key) return;
+    HandleMemberSlotIfNeeded(weak_member_key, key);
 
     // `value` must always be non-null.
     CPPGC_DCHECK(value);
@@ -276,6 +282,7 @@ class V8_EXPORT Visitor {
   void TraceStrongly(const WeakMember<T>& weak_member) {
     const T* value = weak_member.GetRawAtomic();
     CPPGC_DCHECK(value != kSentinelPointer);
+    HandleMemberSlotIfNeeded(weak_member, value);
     TraceImpl(value);
   }
 
@@ -360,6 +367,11 @@ class V8_EXPORT Visitor {
                                   TraceDescriptor weak_desc,
                                   WeakCallback callback, const void* data) {}
   virtual void HandleMovableReference(const void**) {}
+  // Invoked with the slot of each non-null `Member`, `WeakMember`, or
+  // `UncompressedMember` that is traced, if `handles_member_slots_` is set.
+  // Used by the compactor to find references to objects that are moved.
+  virtual void HandleMemberSlot(const void* slot,
+                                internal::WriteBarrierSlotType slot_type) {}
 
   virtual void VisitMultipleUncompressedMember(
       const void* start, size_t len,
@@ -394,6 +406,10 @@ class V8_EXPORT Visitor {
   }
 #endif  // defined(CPPGC_POINTER_COMPRESSION)
 
+  // Set by visitors that override `HandleMemberSlot()`. Avoids the virtual
+  // call for all other visitors.
+  bool handles_member_slots_ = false;
+
  private:
   template <typename T, void (T::*method)(const LivenessBroker&)>
   static void WeakCallbackMethodDelegate(const LivenessBroker& info,
@@ -411,6 +427,13 @@ class V8_EXPORT Visitor {
     }
   }
 
+  template <typename MemberType>
+  V8_INLINE void HandleMemberSlotIfNeeded(const MemberType& member,
+                                          const void* value) {
+    if (V8_LIKELY(!handles_member_slots_) || !value) return;
+    HandleMemberSlot(&member, MemberType::RawStorage::kWriteBarrierSlotType);
+  }
+
   template <typename T>
   void TraceImpl(const T* t) {
     static_assert(sizeof(T), "Pointee type must be fully defined.");
@@ -9,6 +9,7 @@
 #include <fstream>
 #include <memory>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "libplatform/libplatform-export.h"
@@ -162,6 +163,10 @@ class V8_PLATFORM_EXPORT TraceBuffer {
   virtual ~TraceBuffer() = default;
 
   virtual TraceObject* AddTraceEvent(uint64_t* handle) = 0;
+  // Called once the trace object returned by AddTraceEvent() has been
+  // initialized. Buffers that are written to from several threads rely on this
+  // to know when the event can be flushed.
+  virtual void CommitTraceEvent(uint64_t handle) {}
   virtual TraceObject* GetEventByHandle(uint64_t handle) = 0;
   virtual bool Flush() = 0;
 
@@ -212,13 +217,21 @@ class V8_PLATFORM_EXPORT TraceConfig {
 
   void AddIncludedCategory(const char* included_category);
 
+  // Records only one in |interval| complete and instant events of the category
+  // groups that contain |category|. Not supported with V8_USE_PERFETTO.
+  void SetCategorySamplingInterval(const char* category, uint32_t interval);
+
   bool IsCategoryGroupEnabled(const char* category_group) const;
 
+  // Returns 1 if all events of the category group are recorded.
+  uint32_t GetCategoryGroupSamplingInterval(const char* category_group) const;
+
  private:
   TraceRecordMode record_mode_;
   bool enable_systrace_ : 1;
   bool enable_argument_filter_ : 1;
   StringList included_categories_;
+  std::vector<std::pair<std::string, uint32_t>> category_sampling_intervals_;
 
   // Disallow copy and assign
   TraceConfig(const TraceConfig&) = delete;
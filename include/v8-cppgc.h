@@ -53,6 +53,13 @@ struct V8_EXPORT CppHeapCreateParams {
    */
   cppgc::Heap::SweepingType sweeping_support =
       cppgc::Heap::SweepingType::kIncrementalAndConcurrent;
+  /**
+   * Allows memory-reducing garbage collections to also compact the default
+   * spaces. See `cppgc::Heap::HeapOptions::compact_default_spaces` for the
+   * requirements on references to objects on these spaces. Objects that are
+   * referenced from JavaScript wrappers are never moved.
+   */
+  bool compact_default_spaces = false;
 };
 
 /**
@@ -262,6 +262,7 @@ class CTypeInfo {
                  // actual type. It's currently used by the arm64 simulator
                  // and can be added to the other simulators as well when fast
                  // calls having both GP and FP params need to be supported.
+    kSeqTwoByteString,  // Added last so that existing values stay stable.
   };
 
   // kCallbackOptionsType is not part of the Type enum
@@ -336,6 +337,17 @@ struct FastOneByteString {
   uint32_t length;
 };
 
+/**
+ * A view on the characters of a sequential two-byte string. Like
+ * FastOneByteString, the characters are not copied and the view is only valid
+ * for the duration of the fast call. Thin strings are unwrapped; cons, sliced
+ * and external strings fall back to the slow callback.
+ */
+struct FastTwoByteString {
+  const uint16_t* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   enum class Int64Representation : uint8_t {
@@ -408,6 +420,7 @@ union V8_TRIVIAL_ABI AnyCType {
   Local<Object> object_value;
   Local<Array> sequence_value;
   const FastOneByteString* string_value;
+  const FastTwoByteString* two_byte_string_value;
   FastApiCallbackOptions* options_value;
 };
 
@@ -626,6 +639,15 @@ struct TypeInfoHelper<const FastOneByteString&> {
   }
 };
 
+template <>
+struct TypeInfoHelper<const FastTwoByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqTwoByteString;
+  }
+};
+
 #define STATIC_ASSERT_IMPLIES(COND, ASSERTION, MSG) \
   static_assert(((COND) == 0) || (ASSERTION), MSG)
 
@@ -60,6 +60,25 @@ class V8_EXPORT Function : public Object {
                                                Local<Value> recv, int argc,
                                                Local<Value> argv[]);
 
+  /**
+   * Calls the function |count| times with the receiver |recv|. The i-th call
+   * gets the |argc| arguments starting at |argv[i * argc]|, so |argv| holds
+   * |count * argc| values; with |argc| == 0 it may be null.
+   *
+   * This is equivalent to calling Call() in a loop, except that the context
+   * is entered and the API bookkeeping is done once for the whole batch. In
+   * particular, with MicrotasksPolicy::kAuto microtasks run once after the
+   * last call instead of after every call. Return values are discarded.
+   *
+   * The batch stops at the first call that throws, and Nothing is returned.
+   * If |calls_completed| is not null, it receives the number of calls that
+   * returned normally.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<void> CallBatch(Local<Context> context,
+                                              Local<Value> recv, int count,
+                                              int argc, Local<Value> argv[],
+                                              int* calls_completed = nullptr);
+
   void SetName(Local<String> name);
   Local<Value> GetName() const;
 
@@ -122,6 +141,15 @@ class V8_EXPORT Function : public Object {
    */
   V8_WARN_UNUSED_RESULT bool Experimental_IsNopFunction() const;
 
+  /**
+   * Prevents the garbage collector from flushing the bytecode of this
+   * function, or allows it again. This is meant for functions that are rarely
+   * executed but latency-critical, which would otherwise have to be
+   * recompiled after being flushed. Has no effect on bound functions and on
+   * functions that are not user JavaScript.
+   */
+  void SetBytecodeFlushingDisabled(bool disabled);
+
   ScriptOrigin GetScriptOrigin() const;
   V8_INLINE static Function* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
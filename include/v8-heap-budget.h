@@ -0,0 +1,66 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef INCLUDE_V8_HEAP_BUDGET_H_
+#define INCLUDE_V8_HEAP_BUDGET_H_
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "v8config.h"  // NOLINT(build/include_directory)
+
+namespace v8 {
+
+/**
+ * A memory budget for the old generations of a group of isolates, typically
+ * all isolates of a process.
+ *
+ * Isolates join a budget through `Isolate::CreateParams::heap_budget`. Each
+ * registered isolate then sizes its old generation through the memory
+ * balancer, which estimates the isolate's live memory, allocation rate and
+ * garbage collection speed. The budget splits the memory that is left after
+ * accounting for the live memory of all isolates across them, giving more
+ * headroom to isolates that allocate quickly and collect slowly.
+ *
+ * The budget is a soft target: isolates never get less headroom than they need
+ * to make progress and never exceed their own heap limits.
+ *
+ * All methods are thread-safe.
+ */
+class V8_EXPORT HeapBudget {
+ public:
+  /**
+   * Creates a budget of `total_bytes` that may be shared by any number of
+   * isolates.
+   */
+  static std::shared_ptr<HeapBudget> New(size_t total_bytes);
+
+  virtual ~HeapBudget() = default;
+
+  /**
+   * Changes the total budget, e.g., in response to a container resize. Takes
+   * effect the next time each isolate recomputes its limits.
+   */
+  virtual void SetTotalBytes(size_t total_bytes) = 0;
+  virtual size_t TotalBytes() const = 0;
+
+  /**
+   * Returns the number of isolates that are currently registered.
+   */
+  virtual size_t NumberOfIsolates() const = 0;
+
+  /**
+   * Returns the sum of the old generation limits last handed out to the
+   * registered isolates.
+   */
+  virtual size_t AllocatedBytes() const = 0;
+
+ protected:
+  HeapBudget() = default;
+};
+
+}  // namespace v8
+
+#endif  // INCLUDE_V8_HEAP_BUDGET_H_
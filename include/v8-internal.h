@@ -178,6 +178,11 @@ struct SmiTagging<8> {
 #ifdef V8_COMPRESS_POINTERS
 // See v8:7703 or src/common/ptr-compr-inl.h for details about pointer
 // compression.
+// Compressed tagged values are unshifted 32-bit offsets from the cage base, so
+// the cage, and with it the heap of all isolates sharing it, is limited to
+// 4GB. Builds without a shared cage (v8_enable_pointer_compression_shared_cage
+// = false) give every IsolateGroup its own cage, so embedders that need more
+// than 4GB in total can spread their isolates over several groups.
 constexpr size_t kPtrComprCageReservationSize = size_t{1} << 32;
 constexpr size_t kPtrComprCageBaseAlignment = size_t{1} << 32;
 
@@ -1341,7 +1346,7 @@ class BackingStoreBase {};
 
 // The maximum value in enum GarbageCollectionReason, defined in heap.h.
 // This is needed for histograms sampling garbage collection reasons.
-constexpr int kGarbageCollectionReasonMaxValue = 28;
+constexpr int kGarbageCollectionReasonMaxValue = 30;
 
 // Base class for the address block allocator compatible with standard
 // containers, which registers its allocated range as strong roots.
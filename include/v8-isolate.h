@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cppgc/common.h"
 #include "v8-array-buffer.h"       // NOLINT(build/include_directory)
@@ -20,6 +21,7 @@
 #include "v8-embedder-heap.h"      // NOLINT(build/include_directory)
 #include "v8-exception.h"          // NOLINT(build/include_directory)
 #include "v8-function-callback.h"  // NOLINT(build/include_directory)
+#include "v8-heap-budget.h"        // NOLINT(build/include_directory)
 #include "v8-internal.h"           // NOLINT(build/include_directory)
 #include "v8-local-handle.h"       // NOLINT(build/include_directory)
 #include "v8-microtask.h"          // NOLINT(build/include_directory)
@@ -358,6 +360,12 @@ class V8_EXPORT Isolate {
      * CppHeap passed this way.
      */
     CppHeap* cpp_heap = nullptr;
+
+    /**
+     * A process-wide budget shared with other isolates from which this
+     * isolate's old generation limit is allotted. See v8-heap-budget.h.
+     */
+    std::shared_ptr<HeapBudget> heap_budget;
   };
 
   /**
@@ -974,6 +982,16 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get the size of bytecode, optimized code and feedback for every script
+   * in the heap. This walks the whole heap and is therefore expensive.
+   *
+   * \param statistics The vector to fill with one entry per script that has
+   *   any code or metadata attributed to it.
+   * \returns true on success.
+   */
+  bool GetScriptCodeStatistics(std::vector<ScriptCodeStatistics>* statistics);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -1532,6 +1550,23 @@ class V8_EXPORT Isolate {
    */
   void LowMemoryNotification();
 
+  /**
+   * Optional notification that the embedder is idle until the given deadline,
+   * e.g., because its event loop knows that no work is due before then. V8
+   * uses the idle time to perform garbage collection work that would otherwise
+   * run in tasks or on allocation: incremental marking steps, finalizing
+   * marking, sweeping, and scheduled memory reduction. Work is only started if
+   * it is estimated to fit into the idle time.
+   *
+   * \param deadline_in_seconds The deadline in seconds, in the same time base
+   *     as Platform::MonotonicallyIncreasingTime().
+   *
+   * Returns true if there is no more garbage collection work left that could be
+   * performed in idle time, i.e., it is not useful to send further idle
+   * notifications until the embedder has executed JavaScript again.
+   */
+  bool IdleNotificationDeadline(double deadline_in_seconds);
+
   /**
    * Optional notification that a context has been disposed. V8 uses these
    * notifications to guide the GC heuristic and cancel FinalizationRegistry
@@ -1553,6 +1588,19 @@ class V8_EXPORT Isolate {
    */
   void ContextDisposedNotification(ContextDependants dependants);
 
+  /**
+   * Returns the isolate to a state close to the one right after
+   * deserialization from the snapshot, so that it can be reused for an
+   * unrelated workload instead of creating a new isolate.
+   *
+   * Pending microtasks of the default microtask queue and the compilation
+   * cache are dropped, and a full garbage collection reclaims all objects no
+   * longer reachable from the embedder. Code space and read-only pages stay
+   * mapped. The embedder must have exited all contexts and is responsible for
+   * resetting its own handles to objects created by the previous workload.
+   */
+  void ResetForReuse();
+
   /**
    * Optional notification that the isolate switched to the foreground.
    * V8 uses these notifications to guide heuristics.
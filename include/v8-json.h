@@ -5,7 +5,11 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
+#include "v8-memory-span.h"   // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -19,6 +23,21 @@ class String;
  */
 class V8_EXPORT JSON {
  public:
+  /**
+   * An embedder-owned sink for the output of StringifyTo.
+   */
+  class V8_EXPORT OutputSink {
+   public:
+    virtual ~OutputSink() = default;
+
+    /**
+     * Called with consecutive chunks of the UTF-8 encoded result. The chunk
+     * is only valid for the duration of the call, which must not call back
+     * into V8.
+     */
+    virtual void WriteUtf8Chunk(const char* data, size_t length) = 0;
+  };
+
   /**
    * Tries to parse the string |json_string| and returns it as value if
    * successful.
@@ -30,6 +49,22 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Like Parse, but if |json_string| contains an object, the result only
+   * contains the properties of this object named in |property_names|. The
+   * values of the other properties are validated but not created, which saves
+   * most of the parsing cost for large payloads of which only a few
+   * properties are used.
+   *
+   * \param the context in which to parse and create the value.
+   * \param json_string The string to parse.
+   * \param property_names The names of the properties to create.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> ParseProperties(
+      Local<Context> context, Local<String> json_string,
+      MemorySpan<const Local<String>> property_names);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -40,6 +75,21 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify, but passes the result to |sink| as UTF-8 chunks instead
+   * of creating a string, which avoids materializing large results on the
+   * heap. Chunks may already have been written when an exception is thrown.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param sink The sink receiving the UTF-8 encoded result.
+   * \return True if a result was written, false if |json_object| has no JSON
+   *   representation (like undefined or a function), or nothing if an
+   *   exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyTo(
+      Local<Context> context, Local<Value> json_object, OutputSink* sink,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
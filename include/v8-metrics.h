@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "v8-internal.h"      // NOLINT(build/include_directory)
@@ -111,6 +112,76 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+struct GarbageCollectionPhaseDuration {
+  // Name of the GCTracer scope, e.g. "V8.GC_MC_MARK". The string has static
+  // storage duration.
+  const char* name = nullptr;
+  int64_t wall_clock_duration_in_us = -1;
+};
+
+struct GarbageCollectionSpaceSizes {
+  // Name of the heap space, e.g. "old_space". The string has static storage
+  // duration.
+  const char* name = nullptr;
+  int64_t bytes_before = -1;
+  int64_t bytes_after = -1;
+  int64_t bytes_freed = -1;
+};
+
+// Detailed description of a single young or full GC cycle. Unlike the events
+// above, this event is reported on a worker thread after the cycle finished so
+// that collecting it does not add to the main thread pause.
+struct GarbageCollectionCycleDetails {
+  int reason = -1;
+  bool is_young_generation = false;
+  // Wall clock duration of the observable (atomic) pause.
+  int64_t pause_wall_clock_duration_in_us = -1;
+  // Time it took all threads to reach the safepoint for the atomic pause.
+  int64_t time_to_safepoint_in_us = -1;
+  // Accumulated wall clock time spent in GC scopes on background threads.
+  int64_t background_wall_clock_duration_in_us = -1;
+  // Approximate number of threads that contributed to the cycle.
+  int64_t concurrency_estimate = -1;
+  int64_t bytes_promoted = -1;
+  // Every GCTracer scope that was entered during the cycle.
+  std::vector<GarbageCollectionPhaseDuration> phases;
+  // Object sizes of every heap space around the atomic pause.
+  std::vector<GarbageCollectionSpaceSizes> spaces;
+};
+
+struct Deoptimizations {
+  std::string function_name;
+  int script_id = -1;
+  // Source position of the start of the deoptimized function.
+  int function_position = -1;
+  // Bytecode offset in the outermost frame at which execution resumed.
+  int bytecode_offset = -1;
+  // Static strings describing the deoptimization, e.g. "deopt-eager" and
+  // "wrong map".
+  const char* kind = nullptr;
+  const char* reason = nullptr;
+  uint64_t count = 0;
+};
+
+struct MegamorphicTransitions {
+  std::string function_name;
+  int script_id = -1;
+  int function_position = -1;
+  int feedback_slot = -1;
+  // Static string naming the IC kind, e.g. "LoadProperty".
+  const char* ic_kind = nullptr;
+  uint64_t count = 0;
+};
+
+// Deoptimizations and megamorphic inline cache transitions aggregated by
+// location since the previous report. Reported at most once per
+// --jit-transitions-report-interval milliseconds, and once more when the
+// isolate is disposed.
+struct JitTransitions {
+  std::vector<Deoptimizations> deoptimizations;
+  std::vector<MegamorphicTransitions> megamorphic_transitions;
+};
+
 struct WasmModuleDecoded {
   WasmModuleDecoded() = default;
   WasmModuleDecoded(bool async, bool streamed, bool success,
@@ -233,6 +304,8 @@ class V8_EXPORT Recorder {
 #define ADD_THREAD_SAFE_EVENT(E) \
   virtual void AddThreadSafeEvent(const E&) {}
   ADD_THREAD_SAFE_EVENT(WasmModulesPerIsolate)
+  ADD_THREAD_SAFE_EVENT(GarbageCollectionCycleDetails)
+  ADD_THREAD_SAFE_EVENT(JitTransitions)
 #undef ADD_THREAD_SAFE_EVENT
 
   virtual void NotifyIsolateDisposal() {}
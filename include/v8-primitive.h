@@ -573,6 +573,18 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string from the UTF-8 data defined in the given resource.
+   * If the data is pure ASCII, it is also valid one-byte data, and the result
+   * is an external string that uses the resource directly, with the same
+   * lifetime rules as NewExternalOneByte. Otherwise the data is decoded into a
+   * new string on V8's heap (invalid sequences are replaced by U+FFFD, as in
+   * NewFromUtf8) and the resource is disposed before this function returns.
+   * In both cases the caller should no longer use the resource afterwards.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalUtf8(
+      Isolate* isolate, ExternalOneByteStringResource* resource);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
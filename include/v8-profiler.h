@@ -286,6 +286,25 @@ class V8_EXPORT CpuProfile {
                  SerializationFormat format = kJSON) const;
 };
 
+/**
+ * The part of a running CpuProfile that was recorded since the previous chunk
+ * was taken, see CpuProfiler::TakeProfileChunk.
+ */
+struct CpuProfileChunk {
+  /**
+   * Nodes added to the profile tree since the previous chunk, each one after
+   * its parent. The first chunk of a profile contains the whole tree.
+   */
+  std::vector<const CpuProfileNode*> nodes;
+  /** The top frame node of each sample taken since the previous chunk. */
+  std::vector<const CpuProfileNode*> samples;
+  /**
+   * The timestamp of each sample in microseconds, using the same starting
+   * point as CpuProfile::GetSampleTimestamp.
+   */
+  std::vector<int64_t> timestamps;
+};
+
 enum CpuProfilingMode {
   // In the resulting CpuProfile tree, intermediate nodes in a stack trace
   // (from the root to a leaf) will have line numbers that point to the start
@@ -399,6 +418,16 @@ class V8_EXPORT CpuProfilingOptions {
   Global<Context> filter_context_;
 };
 
+/**
+ * The number of CPU profiler ticks that hit a V8 runtime call counter, see
+ * CpuProfiler::TakeRuntimeCallStatsSamples.
+ */
+struct RuntimeCallCounterSamples {
+  /** Name of the counter, a static string owned by V8. */
+  const char* name;
+  uint64_t samples;
+};
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -527,6 +556,28 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Moves the nodes and samples that the running profile with the given id
+   * recorded since the previous call into |chunk|, which allows exporting a
+   * long running profile incrementally. The samples handed out are dropped
+   * from the profile, so they no longer count towards its sample limit and are
+   * not part of the profile returned by Stop. The nodes stay valid until the
+   * profile is deleted, but while it is running only their call frame, id and
+   * parent may be read. Returns false if no such profile is running.
+   */
+  bool TakeProfileChunk(ProfilerId id, CpuProfileChunk* chunk);
+
+  /**
+   * Returns how many CPU profiler ticks hit each V8 runtime call counter since
+   * the previous call, and resets the counts. Ticks are only attributed while
+   * a CPU profile is recorded with runtime call stats sampling enabled
+   * (--runtime-call-stats-sampling), which is much cheaper than timing every
+   * runtime call. Only counters that were hit are returned, and none if V8 was
+   * built without runtime call stats.
+   */
+  static std::vector<RuntimeCallCounterSamples> TakeRuntimeCallStatsSamples(
+      Isolate* isolate);
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
@@ -634,7 +685,8 @@ class V8_EXPORT HeapGraphNode {
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -684,6 +736,27 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format is a more compact sequence of records in which all
+   * integers are unsigned LEB128 varints. It starts with the four bytes "V8HS"
+   * and the format version (currently 1). Each record starts with a tag:
+   *
+   *   1 string:   length, UTF-8 bytes
+   *   2 edge:     type, name_or_index, from_node, to_node
+   *   3 node:     type, name, id, self_size, trace_node_id, detachedness
+   *   4 location: node, script_id, line, column
+   *   0 end of snapshot
+   *
+   * Strings are numbered by their order in the stream, starting at 0, and
+   * precede their first use. Nodes are numbered by their order in the stream,
+   * starting at 0 for the root. All edges precede all nodes and are not
+   * grouped by node. Node and edge types are the values of
+   * HeapGraphNode::Type and HeapGraphEdge::Type. name_or_index is an index
+   * for element and hidden edges and a string otherwise. Unlike the JSON
+   * format, this format does not contain allocation traces and samples.
+   *
+   * Because edges precede nodes, the binary format can also be produced while
+   * the heap is traversed, see HeapProfiler::TakeHeapSnapshotToStream.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -807,6 +880,19 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * Bytecode offset of the allocation within the function of the node, or
+     * kNoBytecodeOffset if the allocating frame was optimized. Together with
+     * the node, it identifies the allocation site.
+     */
+    int bytecode_offset = kNoBytecodeOffset;
+
+    /**
+     * Whether the sampled object was alive in the old generation when the
+     * profile was taken, i.e. it was promoted by the GC or allocated there.
+     */
+    bool in_old_generation = false;
   };
 
   /**
@@ -821,6 +907,7 @@ class V8_EXPORT AllocationProfile {
 
   static const int kNoLineNumberInfo = Message::kNoLineNumberInfo;
   static const int kNoColumnNumberInfo = Message::kNoColumnInfo;
+  static const int kNoBytecodeOffset = -1;
 };
 
 /**
@@ -1121,6 +1208,20 @@ class V8_EXPORT HeapProfiler {
       ObjectNameResolver* global_object_name_resolver = nullptr,
       bool hide_internals = true, bool capture_numeric_value = false);
 
+  /**
+   * Takes a heap snapshot and writes it to `stream` in the
+   * `HeapSnapshot::kBinary` format while the heap is traversed. Edges are
+   * written out as they are discovered instead of being accumulated, so the
+   * extra memory needed is bounded by the nodes of the graph and the chunk
+   * size of `stream`. The snapshot is not retained by the profiler.
+   *
+   * \returns true if the snapshot was written completely, false if it was
+   *   aborted through `options.control` or `stream`.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream,
+      const HeapSnapshotOptions& options = HeapSnapshotOptions());
+
   /**
    * Obtains list of Detached JS Wrapper Objects. This functon calls garbage
    * collection, then iterates over traced handles in the isolate
@@ -154,6 +154,14 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the number of bytes of the code range and of large object pages
+   * that the OS was advised to back with transparent huge pages. This is an
+   * upper bound on the actual huge page coverage, which is up to the OS. Only
+   * non-zero with --huge-pages on supported platforms.
+   */
+  size_t huge_page_size() { return huge_page_size_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -175,6 +183,7 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t huge_page_size_;
 
   friend class V8;
   friend class Isolate;
@@ -233,6 +242,39 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Sizes of code and its metadata attributed to a single script. Objects that
+ * do not belong to a script, like builtins, are not attributed.
+ */
+class V8_EXPORT ScriptCodeStatistics {
+ public:
+  ScriptCodeStatistics();
+  int script_id() { return script_id_; }
+  /** Bytecode including constant pools and handler tables. */
+  size_t bytecode_size() { return bytecode_size_; }
+  size_t source_position_table_size() { return source_position_table_size_; }
+  size_t baseline_code_size() { return baseline_code_size_; }
+  size_t maglev_code_size() { return maglev_code_size_; }
+  size_t turbofan_code_size() { return turbofan_code_size_; }
+  /** Deoptimization data of Maglev and Turbofan code. */
+  size_t deoptimization_data_size() { return deoptimization_data_size_; }
+  size_t feedback_metadata_size() { return feedback_metadata_size_; }
+  size_t feedback_vector_size() { return feedback_vector_size_; }
+
+ private:
+  int script_id_;
+  size_t bytecode_size_;
+  size_t source_position_table_size_;
+  size_t baseline_code_size_;
+  size_t maglev_code_size_;
+  size_t turbofan_code_size_;
+  size_t deoptimization_data_size_;
+  size_t feedback_metadata_size_;
+  size_t feedback_vector_size_;
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
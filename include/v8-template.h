@@ -927,6 +927,26 @@ class V8_EXPORT ObjectTemplate : public Template {
    */
   V8_WARN_UNUSED_RESULT MaybeLocal<Object> NewInstance(Local<Context> context);
 
+  /**
+   * Creates |count| new instances of this template and stores them in
+   * |result|. This is equivalent to calling NewInstance() |count| times, but
+   * the instances of a template that has already been instantiated are copied
+   * from one another without any further per-object setup.
+   *
+   * If |internal_field_values| is not null, it holds InternalFieldCount()
+   * aligned pointers per instance, in order, which are stored as if by
+   * SetAlignedPointerInInternalField().
+   *
+   * The instances are created in the caller's HandleScope. Returns Nothing if
+   * instantiation throws, in which case the contents of |result| are
+   * unspecified.
+   *
+   * \param context The context in which the instances are created.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<void> NewInstances(
+      Local<Context> context, int count, Local<Object> result[],
+      void* const internal_field_values[] = nullptr);
+
   /**
    * Sets a named property handler on the object template.
    *
@@ -44,6 +44,11 @@ V8_EXPORT Address* GlobalizeTracedReference(
 V8_EXPORT void MoveTracedReference(Address** from, Address** to);
 V8_EXPORT void CopyTracedReference(const Address* const* from, Address** to);
 V8_EXPORT void DisposeTracedReference(Address* global_handle);
+V8_EXPORT void GlobalizeTracedReferences(
+    Isolate* isolate, const Address* values, Address** slots, size_t count,
+    TracedReferenceStoreMode store_mode,
+    TracedReferenceHandling reference_handling);
+V8_EXPORT void DisposeTracedReferences(Address** slots, size_t count);
 
 }  // namespace internal
 
@@ -286,6 +291,23 @@ class TracedReference : public BasicTracedReference<T> {
   template <class S>
   V8_INLINE void Reset(Isolate* isolate, const Local<S>& other, IsDroppable);
 
+  /**
+   * Resets the `count` references starting at `refs`. Equivalent to calling
+   * Reset() on each of them but releases the storage cells in one go.
+   */
+  V8_INLINE static void ResetBatch(TracedReference* refs, size_t count);
+
+  /**
+   * Always resets the `count` references starting at `refs` and creates new
+   * references from the corresponding non-empty `values`. Equivalent to
+   * calling Reset(isolate, values[i]) on each of them but allocates the storage
+   * cells in one go, which keeps them next to each other in memory and avoids
+   * most of the per-reference overhead.
+   */
+  template <class S>
+  V8_INLINE static void ResetBatch(Isolate* isolate, TracedReference* refs,
+                                   const Local<S>* values, size_t count);
+
   template <class S>
   V8_INLINE TracedReference<S>& As() const {
     return reinterpret_cast<TracedReference<S>&>(
@@ -377,6 +399,39 @@ void TracedReference<T>::Reset(Isolate* isolate, const Local<S>& other,
       internal::TracedReferenceHandling::kDroppable));
 }
 
+template <class T>
+void TracedReference<T>::ResetBatch(TracedReference* refs, size_t count) {
+  static_assert(sizeof(TracedReference) == sizeof(internal::Address*));
+  if (count == 0) return;
+  internal::DisposeTracedReferences(&refs->slot(), count);
+}
+
+template <class T>
+template <class S>
+void TracedReference<T>::ResetBatch(Isolate* isolate, TracedReference* refs,
+                                    const Local<S>* values, size_t count) {
+  static_assert(std::is_base_of<T, S>::value, "type check");
+  ResetBatch(refs, count);
+  // Values are converted in chunks to avoid allocating a temporary array.
+  constexpr size_t kChunkSize = 64;
+  internal::Address addresses[kChunkSize];
+  for (size_t start = 0; start < count; start += kChunkSize) {
+    const size_t chunk_size =
+        count - start < kChunkSize ? count - start : kChunkSize;
+    for (size_t i = 0; i < chunk_size; ++i) {
+      const Local<S>& value = values[start + i];
+      addresses[i] = V8_UNLIKELY(value.IsEmpty())
+                         ? internal::kNullAddress
+                         : internal::ValueHelper::ValueAsAddress(*value);
+    }
+    internal::GlobalizeTracedReferences(
+        reinterpret_cast<internal::Isolate*>(isolate), addresses,
+        &refs[start].slot(), chunk_size,
+        internal::TracedReferenceStoreMode::kAssigningStore,
+        internal::TracedReferenceHandling::kDefault);
+  }
+}
+
 template <class T>
 template <class S>
 TracedReference<T>& TracedReference<T>::operator=(
@@ -25,8 +25,11 @@ class WeakCallbackInfo {
 
   WeakCallbackInfo(Isolate* isolate, T* parameter,
                    void* embedder_fields[kEmbedderFieldsInWeakCallback],
-                   Callback* callback)
-      : isolate_(isolate), parameter_(parameter), callback_(callback) {
+                   Callback* callback, bool* is_thread_safe = nullptr)
+      : isolate_(isolate),
+        parameter_(parameter),
+        callback_(callback),
+        is_thread_safe_(is_thread_safe) {
     for (int i = 0; i < kEmbedderFieldsInWeakCallback; ++i) {
       embedder_fields_[i] = embedder_fields[i];
     }
@@ -44,10 +47,21 @@ class WeakCallbackInfo {
   // Calling SetSecondPassCallback on the second pass will immediately crash.
   void SetSecondPassCallback(Callback callback) const { *callback_ = callback; }
 
+  // Like SetSecondPassCallback() but declares the second pass callback to be
+  // thread-safe. Such callbacks must not call into V8 (including through the
+  // passed isolate) and may be invoked on a worker thread, concurrently with
+  // the main thread and with each other. V8 invokes them in batches off the
+  // main thread when possible.
+  void SetThreadSafeSecondPassCallback(Callback callback) const {
+    *callback_ = callback;
+    if (is_thread_safe_) *is_thread_safe_ = true;
+  }
+
  private:
   Isolate* isolate_;
   T* parameter_;
   Callback* callback_;
+  bool* is_thread_safe_;
   void* embedder_fields_[kEmbedderFieldsInWeakCallback];
 };
 
@@ -31,6 +31,7 @@
 #include "v8-extension.h"          // NOLINT(build/include_directory)
 #include "v8-external.h"           // NOLINT(build/include_directory)
 #include "v8-function.h"           // NOLINT(build/include_directory)
+#include "v8-heap-budget.h"        // NOLINT(build/include_directory)
 #include "v8-initialization.h"     // NOLINT(build/include_directory)
 #include "v8-internal.h"           // NOLINT(build/include_directory)
 #include "v8-isolate.h"            // NOLINT(build/include_directory)
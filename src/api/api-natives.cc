@@ -515,6 +515,42 @@ MaybeHandle<JSObject> ApiNatives::InstantiateObject(
   return ::v8::internal::InstantiateObject(isolate, data, new_target, false);
 }
 
+bool ApiNatives::InstantiateObjects(
+    Isolate* isolate, DirectHandle<ObjectTemplateInfo> data,
+    base::Vector<DirectHandle<JSObject>> results) {
+  if (results.empty()) return true;
+  InvokeScope invoke_scope(isolate);
+  {
+    // Only the first instance should outlive the handles that are needed to
+    // instantiate it.
+    HandleScope scope(isolate);
+    Handle<JSObject> first;
+    if (!::v8::internal::InstantiateObject(isolate, data, {}, false)
+             .ToHandle(&first)) {
+      return false;
+    }
+    results[0] = scope.CloseAndEscape(first);
+  }
+  if (data->should_cache()) {
+    // The first instance is an unmodified copy of the cached instantiation,
+    // so the others can be copied from it without probing the cache again.
+    Factory* factory = isolate->factory();
+    for (size_t i = 1; i < results.size(); ++i) {
+      results[i] = factory->CopyJSObject(results[0]);
+    }
+    return true;
+  }
+  for (size_t i = 1; i < results.size(); ++i) {
+    Handle<JSObject> object;
+    if (!::v8::internal::InstantiateObject(isolate, data, {}, false)
+             .ToHandle(&object)) {
+      return false;
+    }
+    results[i] = object;
+  }
+  return true;
+}
+
 MaybeHandle<JSObject> ApiNatives::InstantiateRemoteObject(
     DirectHandle<ObjectTemplateInfo> data) {
   Isolate* isolate = data->GetIsolate();
@@ -6,6 +6,7 @@
 #define V8_API_API_NATIVES_H_
 
 #include "include/v8-template.h"
+#include "src/base/vector.h"
 #include "src/handles/handles.h"
 #include "src/handles/maybe-handles.h"
 #include "src/objects/objects.h"
@@ -42,6 +43,13 @@ class ApiNatives {
       Isolate* isolate, DirectHandle<ObjectTemplateInfo> data,
       DirectHandle<JSReceiver> new_target = {});
 
+  // Fills {results} with new instances of {data}. Instances of a cacheable
+  // template are copied from the first one instead of being instantiated one
+  // by one. Returns false if an exception was thrown.
+  V8_WARN_UNUSED_RESULT static bool InstantiateObjects(
+      Isolate* isolate, DirectHandle<ObjectTemplateInfo> data,
+      base::Vector<DirectHandle<JSObject>> results);
+
   V8_WARN_UNUSED_RESULT static MaybeHandle<JSObject> InstantiateRemoteObject(
       DirectHandle<ObjectTemplateInfo> data);
 
@@ -67,6 +67,7 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/code-stats.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-write-barrier.h"
@@ -140,6 +141,7 @@
 #include "src/utils/detachable-vector.h"
 #include "src/utils/identity-map.h"
 #include "src/utils/version.h"
+#include "third_party/simdutf/simdutf.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
@@ -764,6 +766,18 @@ void DisposeTracedReference(internal::Address* location) {
   TracedHandles::Destroy(location);
 }
 
+void GlobalizeTracedReferences(i::Isolate* i_isolate, const i::Address* values,
+                               internal::Address** slots, size_t count,
+                               TracedReferenceStoreMode store_mode,
+                               TracedReferenceHandling reference_handling) {
+  i_isolate->traced_handles()->CreateBatch(values, slots, count, store_mode,
+                                           reference_handling);
+}
+
+void DisposeTracedReferences(internal::Address** slots, size_t count) {
+  TracedHandles::DestroyBatch(slots, count);
+}
+
 #if V8_STATIC_ROOTS_BOOL
 
 // Check static root constants exposed in v8-internal.h.
@@ -3390,6 +3404,30 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+MaybeLocal<Value> JSON::ParseProperties(
+    Local<Context> context, Local<String> json_string,
+    MemorySpan<const Local<String>> property_names) {
+  PREPARE_FOR_EXECUTION(context, JSON, ParseProperties);
+  auto string = Utils::OpenHandle(*json_string);
+  i::Handle<i::String> source = i::String::Flatten(i_isolate, string);
+  i::DirectHandleVector<i::String> names(i_isolate);
+  names.reserve(property_names.size());
+  for (Local<String> name : property_names) {
+    names.push_back(Utils::OpenDirectHandle(*name));
+  }
+  base::Vector<const i::DirectHandle<i::String>> names_vector(names.data(),
+                                                             names.size());
+  auto maybe = source->IsOneByteRepresentation()
+                   ? i::JsonParser<uint8_t>::ParseProperties(
+                         i_isolate, source, names_vector)
+                   : i::JsonParser<uint16_t>::ParseProperties(
+                         i_isolate, source, names_vector);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3416,6 +3454,34 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyTo(Local<Context> context, Local<Value> json_object,
+                              OutputSink* sink, Local<String> gap) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, StringifyTo, i::HandleScope);
+  i::Handle<i::JSAny> object;
+  if (!Utils::ApiCheck(
+          i::TryCast<i::JSAny>(Utils::OpenHandle(*json_object), &object),
+          "JSON::StringifyTo",
+          "Invalid object, must be a JSON-serializable object.")) {
+    return Nothing<bool>();
+  }
+  if (!Utils::ApiCheck(sink != nullptr, "JSON::StringifyTo",
+                       "Invalid sink.")) {
+    return Nothing<bool>();
+  }
+  // Without a gap, the fast path of the stringifier can be used.
+  i::Handle<i::Object> gap_object;
+  if (gap.IsEmpty()) {
+    gap_object = i_isolate->factory()->undefined_value();
+  } else {
+    gap_object = Utils::OpenHandle(*gap);
+  }
+  Maybe<bool> result = i::JsonStringifyTo(i_isolate, object, gap_object, sink);
+  has_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -5612,6 +5678,40 @@ MaybeLocal<v8::Value> Function::Call(Local<Context> context,
   return Call(context->GetIsolate(), context, recv, argc, argv);
 }
 
+Maybe<void> Function::CallBatch(Local<Context> context,
+                                v8::Local<v8::Value> recv, int count, int argc,
+                                v8::Local<v8::Value> argv[],
+                                int* calls_completed) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  TRACE_EVENT_CALL_STATS_SCOPED(i_isolate, "v8", "V8.Execute");
+  ENTER_V8(i_isolate, context, Function, CallBatch, i::HandleScope);
+  i::TimerEventScope<i::TimerEventExecute> timer_scope(i_isolate);
+  i::NestedTimedHistogramScope execute_timer(i_isolate->counters()->execute(),
+                                             i_isolate);
+  auto self = Utils::OpenDirectHandle(this);
+  Utils::ApiCheck(!self.is_null(), "v8::Function::CallBatch",
+                  "Function to be called is a null pointer");
+  Utils::ApiCheck(count >= 0 && argc >= 0, "v8::Function::CallBatch",
+                  "Negative call or argument count");
+  auto recv_obj = Utils::OpenDirectHandle(*recv);
+  int completed = 0;
+  for (; completed < count; ++completed) {
+    // Only the handles created by a single call need to be released here; the
+    // API scopes above stay open for the whole batch.
+    i::HandleScope call_scope(i_isolate);
+    Local<Value>* call_argv =
+        argc == 0 ? nullptr : argv + static_cast<size_t>(completed) * argc;
+    auto args = PrepareArguments(argc, call_argv);
+    if (i::Execution::Call(i_isolate, self, recv_obj, args).is_null()) {
+      has_exception = true;
+      break;
+    }
+  }
+  if (calls_completed != nullptr) *calls_completed = completed;
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+  return JustVoid();
+}
+
 void Function::SetName(v8::Local<v8::String> name) {
   auto self = Utils::OpenDirectHandle(this);
   if (!IsJSFunction(*self)) return;
@@ -5764,6 +5864,15 @@ bool Function::Experimental_IsNopFunction() const {
   return true;
 }
 
+void Function::SetBytecodeFlushingDisabled(bool disabled) {
+  auto self = Utils::OpenDirectHandle(this);
+  if (!IsJSFunction(*self)) return;
+  i::Tagged<i::SharedFunctionInfo> sfi =
+      i::Cast<i::JSFunction>(*self)->shared();
+  if (!sfi->IsUserJavaScript()) return;
+  sfi->set_bytecode_flushing_disabled(disabled);
+}
+
 MaybeLocal<String> v8::Function::FunctionProtoToString(Local<Context> context) {
   PREPARE_FOR_EXECUTION(context, Function, FunctionProtoToString);
   auto self = Utils::OpenDirectHandle(this);
@@ -6691,7 +6800,8 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      huge_page_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -6712,6 +6822,17 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+ScriptCodeStatistics::ScriptCodeStatistics()
+    : script_id_(v8::UnboundScript::kNoScriptId),
+      bytecode_size_(0),
+      source_position_table_size_(0),
+      baseline_code_size_(0),
+      maglev_code_size_(0),
+      turbofan_code_size_(0),
+      deoptimization_data_size_(0),
+      feedback_metadata_size_(0),
+      feedback_vector_size_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -7540,6 +7661,46 @@ MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
   RETURN_ESCAPED(result);
 }
 
+Maybe<void> ObjectTemplate::NewInstances(Local<Context> context, int count,
+                                         Local<Object> result[],
+                                         void* const internal_field_values[]) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  i_isolate->clear_internal_exception();
+  // The instances are returned in the caller's HandleScope, so unlike
+  // PREPARE_FOR_EXECUTION this doesn't open a scope of its own.
+  DCHECK(!i_isolate->is_execution_terminating());
+  CallDepthScope<false> call_depth_scope(i_isolate, context);
+  API_RCS_SCOPE(i_isolate, ObjectTemplate, NewInstances);
+  i::VMState<v8::OTHER> state(i_isolate);
+  Utils::ApiCheck(count >= 0, "v8::ObjectTemplate::NewInstances",
+                  "Negative instance count");
+  auto self = Utils::OpenDirectHandle(this);
+  static_assert(sizeof(v8::Local<v8::Object>) ==
+                sizeof(i::DirectHandle<i::JSObject>));
+  base::Vector<i::DirectHandle<i::JSObject>> objects(
+      reinterpret_cast<i::DirectHandle<i::JSObject>*>(result),
+      static_cast<size_t>(count));
+  if (!i::ApiNatives::InstantiateObjects(i_isolate, self, objects)) {
+    return Nothing<void>();
+  }
+  if (internal_field_values != nullptr && count > 0) {
+    i::DisallowGarbageCollection no_gc;
+    const char* location = "v8::ObjectTemplate::NewInstances()";
+    int field_count = objects[0]->GetEmbedderFieldCount();
+    void* const* values = internal_field_values;
+    for (const auto& object : objects) {
+      i::Tagged<i::JSObject> raw_object = *object;
+      for (int index = 0; index < field_count; ++index) {
+        Utils::ApiCheck(i::EmbedderDataSlot(raw_object, index)
+                            .store_aligned_pointer(i_isolate, raw_object,
+                                                   *values++),
+                        location, "Unaligned pointer");
+      }
+    }
+  }
+  return JustVoid();
+}
+
 void v8::ObjectTemplate::CheckCast(Data* that) {
   auto obj = Utils::OpenDirectHandle(that);
   Utils::ApiCheck(i::IsObjectTemplateInfo(*obj), "v8::ObjectTemplate::Cast",
@@ -7825,6 +7986,43 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalUtf8(
+    Isolate* v8_isolate, v8::String::ExternalOneByteStringResource* resource) {
+  CHECK_NOT_NULL(resource);
+  if (resource->length() > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewExternalUtf8);
+  if (resource->length() == 0) {
+    // The resource isn't going to be used, free it immediately.
+    resource->Unaccount(v8_isolate);
+    resource->Dispose();
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  CHECK_NOT_NULL(resource->data());
+  // ASCII is a subset of both UTF-8 and Latin-1, so the buffer can back a
+  // one-byte external string as is.
+  if (simdutf::validate_ascii(resource->data(), resource->length())) {
+    i::DirectHandle<i::String> string =
+        i_isolate->factory()
+            ->NewExternalStringFromOneByte(resource)
+            .ToHandleChecked();
+    return Utils::ToLocal(string);
+  }
+  // The decoded string is never longer than the UTF-8 input, so this can't
+  // exceed String::kMaxLength.
+  i::DirectHandle<i::String> string =
+      i_isolate->factory()
+          ->NewStringFromUtf8(
+              base::VectorOf(resource->data(), resource->length()))
+          .ToHandleChecked();
+  resource->Unaccount(v8_isolate);
+  resource->Dispose();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(i::Isolate::Current());
   return MakeExternal(isolate, resource);
@@ -10150,6 +10348,9 @@ void Isolate::Initialize(Isolate* v8_isolate,
   i_isolate->set_allow_atomics_wait(params.allow_atomics_wait);
 
   i_isolate->heap()->ConfigureHeap(params.constraints, params.cpp_heap);
+  if (params.heap_budget) {
+    i_isolate->heap()->SetHeapBudget(params.heap_budget);
+  }
   if (params.constraints.stack_limit() != nullptr) {
     uintptr_t limit =
         reinterpret_cast<uintptr_t>(params.constraints.stack_limit());
@@ -10420,6 +10621,7 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = i::heap::ShouldZapGarbage();
+  heap_statistics->huge_page_size_ = heap->HugePageMemory();
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
@@ -10517,6 +10719,32 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetScriptCodeStatistics(
+    std::vector<ScriptCodeStatistics>* statistics) {
+  if (!statistics) return false;
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  std::vector<i::ScriptCodeSizes> sizes =
+      i::CodeStatistics::CollectScriptCodeStatistics(i_isolate);
+
+  statistics->clear();
+  statistics->reserve(sizes.size());
+  for (const i::ScriptCodeSizes& script : sizes) {
+    ScriptCodeStatistics entry;
+    entry.script_id_ = script.script_id;
+    entry.bytecode_size_ = script.bytecode_size;
+    entry.source_position_table_size_ = script.source_position_table_size;
+    entry.baseline_code_size_ = script.baseline_code_size;
+    entry.maglev_code_size_ = script.maglev_code_size;
+    entry.turbofan_code_size_ = script.turbofan_code_size;
+    entry.deoptimization_data_size_ = script.deoptimization_data_size;
+    entry.feedback_metadata_size_ = script.feedback_metadata_size;
+    entry.feedback_vector_size_ = script.feedback_vector_size;
+    statistics->push_back(entry);
+  }
+  return true;
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -10697,6 +10925,17 @@ void Isolate::LowMemoryNotification() {
   }
 }
 
+bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Heap* heap = i_isolate->heap();
+  // The deadline uses embedder timestamps.
+  const base::TimeDelta idle_time = base::TimeDelta::FromMillisecondsD(
+      deadline_in_seconds * 1000 - heap->MonotonicallyIncreasingTimeInMs());
+  TRACE_EVENT1("v8", "V8.GCIdleNotification", "idle_time_in_ms",
+               idle_time.InMillisecondsF());
+  return heap->IdleNotification(idle_time);
+}
+
 int Isolate::ContextDisposedNotification(bool dependant_context) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   if (V8_UNLIKELY(i::v8_flags.trace_context_disposal)) {
@@ -10727,6 +10966,14 @@ void Isolate::ContextDisposedNotification(ContextDependants dependants) {
   END_ALLOW_USE_DEPRECATED()
 }
 
+void Isolate::ResetForReuse() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  Utils::ApiCheck(
+      i_isolate->handle_scope_implementer()->EnteredContextCount() == 0,
+      "v8::Isolate::ResetForReuse", "Must not be called inside a context");
+  i_isolate->ResetForReuse();
+}
+
 void Isolate::IsolateInForegroundNotification() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   return i_isolate->SetPriority(Priority::kUserBlocking);
@@ -11607,6 +11854,46 @@ CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
           *Utils::OpenDirectHandle(*title)));
 }
 
+// static
+std::vector<RuntimeCallCounterSamples> CpuProfiler::TakeRuntimeCallStatsSamples(
+    Isolate* v8_isolate) {
+  std::vector<RuntimeCallCounterSamples> result;
+#ifdef V8_RUNTIME_CALL_STATS
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::RuntimeCallStats* stats = i_isolate->counters()->runtime_call_stats();
+  for (int id = 0; id < i::RuntimeCallStats::kNumberOfCounters; ++id) {
+    i::RuntimeCallCounter* counter = stats->GetCounter(id);
+    int64_t samples = counter->TakeSampleCount();
+    if (samples > 0) {
+      result.push_back({counter->name(), static_cast<uint64_t>(samples)});
+    }
+  }
+#endif  // V8_RUNTIME_CALL_STATS
+  return result;
+}
+
+bool CpuProfiler::TakeProfileChunk(ProfilerId id, CpuProfileChunk* chunk) {
+  std::vector<const i::ProfileNode*> nodes;
+  std::vector<i::CpuProfile::SampleInfo> samples;
+  if (!reinterpret_cast<i::CpuProfiler*>(this)->TakeProfileChunk(id, &nodes,
+                                                                  &samples)) {
+    return false;
+  }
+  chunk->nodes.clear();
+  chunk->samples.clear();
+  chunk->timestamps.clear();
+  for (const i::ProfileNode* node : nodes) {
+    chunk->nodes.push_back(reinterpret_cast<const CpuProfileNode*>(node));
+  }
+  for (const i::CpuProfile::SampleInfo& sample : samples) {
+    chunk->samples.push_back(
+        reinterpret_cast<const CpuProfileNode*>(sample.node));
+    chunk->timestamps.push_back(
+        sample.timestamp.since_origin().InMicroseconds());
+  }
+  return true;
+}
+
 CpuProfile* CpuProfiler::Stop(ProfilerId id) {
   return reinterpret_cast<CpuProfile*>(
       reinterpret_cast<i::CpuProfiler*>(this)->StopProfiling(id));
@@ -11796,10 +12083,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this), stream);
+    serializer.Serialize();
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -11869,6 +12162,15 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(ActivityControl* control,
   return TakeHeapSnapshot(options);
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(
+    OutputStream* stream, const HeapSnapshotOptions& options) {
+  Utils::ApiCheck(stream->GetChunkSize() > 0,
+                  "v8::HeapProfiler::TakeHeapSnapshotToStream",
+                  "Invalid stream chunk size");
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      options, stream);
+}
+
 std::vector<v8::Local<v8::Value>> HeapProfiler::GetDetachedJSWrapperObjects() {
   return reinterpret_cast<i::HeapProfiler*>(this)
       ->GetDetachedJSWrapperObjects();
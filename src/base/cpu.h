@@ -59,6 +59,10 @@ class V8_BASE_EXPORT CPU final {
   static const int kArmCortexA9 = 0xc09;
   static const int kArmCortexA12 = 0xc0c;
   static const int kArmCortexA15 = 0xc0f;
+  static const int kArmCortexA53 = 0xd03;
+  static const int kArmCortexA55 = 0xd05;
+  static const int kArmCortexA510 = 0xd46;
+  static const int kArmCortexA520 = 0xd80;
 
   // Denver-specific part code
   static const int kNvidiaDenverV10 = 0x002;
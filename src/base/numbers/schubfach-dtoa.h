@@ -0,0 +1,37 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+#define V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace base {
+
+// SchubfachDtoa will produce at most kSchubfachDtoaMaximalLength digits. This
+// does not include the terminating '\0' character.
+const int kSchubfachDtoaMaximalLength = 17;
+
+// Provides the shortest decimal representation of v, using Raffaello
+// Giulietti's Schubfach algorithm ("The Schubfach way to render doubles").
+// Unlike FastDtoa in FAST_DTOA_SHORTEST mode this never fails, so no bignum
+// fallback is needed.
+// The result should be interpreted as buffer * 10^(point - length), and
+// satisfies
+//     v == (double) (buffer * 10^(point - length)).
+// The digits in the buffer are the shortest representation possible, and of
+// those the one closest to v (ties are broken towards an even last digit).
+// There will be *length digits inside the buffer followed by a null
+// terminator; the buffer must hold kSchubfachDtoaMaximalLength + 1 chars.
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+V8_BASE_EXPORT void SchubfachDtoa(double v, Vector<char> buffer, int* length,
+                                  int* decimal_point);
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
@@ -14,6 +14,13 @@ namespace base {
 // contain a dot or a sign. It must not start with '0', and must not be empty.
 V8_BASE_EXPORT double Strtod(Vector<const char> buffer, int exponent);
 
+// Computes significand * 10^exponent with the Eisel-Lemire algorithm. Returns
+// false if the correctly rounded result cannot be determined this way (the
+// product is too close to a halfway point, or it underflows to a denormal or
+// overflows to infinity); the caller must then fall back to Strtod.
+V8_BASE_EXPORT bool EiselLemireStrtod(uint64_t significand, int exponent,
+                                      double* result);
+
 }  // namespace base
 }  // namespace v8
 
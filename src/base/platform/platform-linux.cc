@@ -348,5 +348,16 @@ bool OS::RemapPages(const void* address, size_t size, void* new_address,
   return true;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  DCHECK(IsAligned(reinterpret_cast<uintptr_t>(address), kHugePageSize));
+  DCHECK(IsAligned(size, kHugePageSize));
+#if defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif  // defined(MADV_HUGEPAGE)
+}
+
 }  // namespace base
 }  // namespace v8
@@ -355,6 +355,29 @@ class V8_BASE_EXPORT OS {
                                                void* new_address,
                                                MemoryPermission access);
 
+  // Whether the platform supports asking the kernel to back a region with
+  // transparent huge pages.
+  V8_WARN_UNUSED_RESULT static constexpr bool IsHugePageAdviceSupported() {
+#if defined(V8_OS_LINUX)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Size of the huge pages used by AdviseHugePages().
+  static constexpr size_t kHugePageSize = size_t{2} * 1024 * 1024;
+
+  // Advises the kernel to back the region with transparent huge pages once it
+  // is touched. The region must be aligned to kHugePageSize. This is only a
+  // hint: the kernel may still use regular pages, e.g. when transparent huge
+  // pages are disabled system-wide or memory is fragmented.
+  //
+  // Must not be called if |IsHugePageAdviceSupported()| returns false.
+  // Returns true if the advice was accepted.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
@@ -367,6 +390,7 @@ class V8_BASE_EXPORT OS {
   friend class v8::base::VirtualAddressSpace;
   friend class v8::base::VirtualAddressSubspace;
   FRIEND_TEST(OS, RemapPages);
+  FRIEND_TEST(OS, AdviseHugePages);
 
   static size_t AllocatePageSize();
 
@@ -18,6 +18,13 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#include <stdio.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -61,6 +68,59 @@ int SysInfo::NumberOfProcessors() {
 #endif
 }
 
+#if V8_OS_LINUX
+namespace {
+
+// Returns the CPU quota of the current cgroup in processors, rounded up, or
+// -1 if there is no quota.
+int CgroupCpuQuota() {
+  int64_t quota = -1;
+  int64_t period = 0;
+  // cgroup v2: "<quota> <period>", where the quota may be "max".
+  if (FILE* file = fopen("/sys/fs/cgroup/cpu.max", "r")) {
+    long long q, p;  // NOLINT(runtime/int)
+    if (fscanf(file, "%lld %lld", &q, &p) == 2) {
+      quota = q;
+      period = p;
+    }
+    fclose(file);
+  } else if (FILE* quota_file =
+                 fopen("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "r")) {
+    // cgroup v1: the quota is -1 if there is none.
+    long long q, p;  // NOLINT(runtime/int)
+    if (fscanf(quota_file, "%lld", &q) == 1) {
+      if (FILE* period_file =
+              fopen("/sys/fs/cgroup/cpu/cpu.cfs_period_us", "r")) {
+        if (fscanf(period_file, "%lld", &p) == 1) {
+          quota = q;
+          period = p;
+        }
+        fclose(period_file);
+      }
+    }
+    fclose(quota_file);
+  }
+  if (quota <= 0 || period <= 0) return -1;
+  return static_cast<int>((quota + period - 1) / period);
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+// static
+int SysInfo::NumberOfAvailableProcessors() {
+  int processors = NumberOfProcessors();
+#if V8_OS_LINUX
+  cpu_set_t cpu_set;
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    processors = std::min(processors, CPU_COUNT(&cpu_set));
+  }
+  int quota = CgroupCpuQuota();
+  if (quota > 0) processors = std::min(processors, quota);
+#endif
+  return std::max(processors, 1);
+}
+
 
 // static
 int64_t SysInfo::AmountOfPhysicalMemory() {
@@ -148,5 +208,60 @@ uintptr_t SysInfo::AddressSpaceEnd() {
 #endif
 }
 
+// static
+int SysInfo::NumberOfNumaNodes() {
+#if V8_OS_LINUX
+  // The file contains a list of ranges, e.g. "0-1" or "0,2-3".
+  FILE* file = fopen("/sys/devices/system/node/online", "r");
+  if (file == nullptr) return 1;
+  int nodes = 0;
+  int first;
+  while (fscanf(file, "%d", &first) == 1) {
+    int last = first;
+    int c = fgetc(file);
+    if (c == '-') {
+      if (fscanf(file, "%d", &last) != 1) break;
+      c = fgetc(file);
+    }
+    if (last >= first) nodes += last - first + 1;
+    if (c != ',') break;
+  }
+  fclose(file);
+  return nodes > 0 ? nodes : 1;
+#else
+  return 1;
+#endif
+}
+
+// static
+int SysInfo::CurrentNumaNode() {
+#if V8_OS_LINUX && defined(SYS_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return -1;
+  return static_cast<int>(node);
+#else
+  return -1;
+#endif
+}
+
+// static
+bool SysInfo::NumaNodesOfPages(size_t count, const void* const* pages,
+                               int* nodes) {
+#if V8_OS_LINUX && defined(SYS_move_pages)
+  // With a null target node list, move_pages() doesn't move anything but
+  // reports the current node of each page in the status array.
+  if (syscall(SYS_move_pages, 0, count, pages, nullptr, nodes, 0) != 0) {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (nodes[i] < 0) nodes[i] = -1;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
 }  // namespace base
 }  // namespace v8
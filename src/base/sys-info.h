@@ -5,6 +5,7 @@
 #ifndef V8_BASE_SYS_INFO_H_
 #define V8_BASE_SYS_INFO_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "src/base/base-export.h"
@@ -18,6 +19,11 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of logical processors/core on the current machine.
   static int NumberOfProcessors();
 
+  // Returns the number of processors the current process can make use of.
+  // Unlike NumberOfProcessors(), this respects the CPU affinity mask and, on
+  // Linux, the CPU quota of the cgroup the process runs in, rounded up.
+  static int NumberOfAvailableProcessors();
+
   // Returns the number of bytes of physical memory on the current machine.
   static int64_t AmountOfPhysicalMemory();
 
@@ -30,6 +36,20 @@ class V8_BASE_EXPORT SysInfo final {
   // process, so all pointer values will be below this value.
   // If the virtual address space is not limited, this will return -1.
   static uintptr_t AddressSpaceEnd();
+
+  // Returns the number of NUMA nodes on the current machine. Returns 1 if the
+  // topology is unknown.
+  static int NumberOfNumaNodes();
+
+  // Returns the NUMA node of the processor the calling thread currently runs
+  // on, or -1 if unknown. The result is only a hint as threads may migrate.
+  static int CurrentNumaNode();
+
+  // Stores the NUMA node of each page in `pages` into `nodes`. Pages that are
+  // not backed by physical memory or whose node cannot be determined get -1.
+  // Returns false if the query is not supported on this platform.
+  static bool NumaNodesOfPages(size_t count, const void* const* pages,
+                               int* nodes);
 };
 
 }  // namespace base
@@ -5,6 +5,8 @@
 #ifndef V8_BASE_TIMEZONE_CACHE_H_
 #define V8_BASE_TIMEZONE_CACHE_H_
 
+#include <vector>
+
 namespace v8 {
 namespace base {
 
@@ -23,6 +25,23 @@ class TimezoneCache {
   // https://github.com/tc39/ecma262/pull/778
   virtual double LocalTimeOffset(double time_ms, bool is_utc) = 0;
 
+  // A point in time (UTC) from which on the local time zone adjustment is
+  // {offset_ms}.
+  struct OffsetTransition {
+    double time_ms;
+    double offset_ms;
+  };
+
+  // Appends the adjustment in effect at {start_ms}, followed by each change
+  // of it until {end_ms}, to {transitions}. Returns false if the
+  // implementation can't enumerate changes, in which case callers have to use
+  // LocalTimeOffset instead.
+  virtual bool LocalTimeOffsetTransitions(
+      double start_ms, double end_ms,
+      std::vector<OffsetTransition>* transitions) {
+    return false;
+  }
+
   /**
    * Time zone redetection indicator for Clear function.
    *
@@ -24,7 +24,10 @@ namespace baseline {
 
 static bool CanCompileWithConcurrentBaseline(Tagged<SharedFunctionInfo> shared,
                                              Isolate* isolate) {
-  return !shared->HasBaselineCode() && CanCompileWithBaseline(isolate, shared);
+  // Break checks refer to the debug bytecode, which can change at any time on
+  // the main thread.
+  return !shared->HasBaselineCode() && !shared->HasBreakInfo(isolate) &&
+         CanCompileWithBaseline(isolate, shared);
 }
 
 class BaselineCompilerTask {
@@ -214,6 +217,9 @@ class ConcurrentBaselineCompiler {
     job_handle_->NotifyConcurrencyIncrease();
   }
 
+  // Returns the number of batches that no thread started compiling yet.
+  size_t PendingBatches() const { return incoming_queue_.size(); }
+
   void InstallBatch() {
     while (!outgoing_queue_.IsEmpty()) {
       std::unique_ptr<BaselineBatchCompilerJob> job;
@@ -255,8 +261,10 @@ bool BaselineBatchCompiler::concurrent() const {
 
 void BaselineBatchCompiler::EnqueueFunction(DirectHandle<JSFunction> function) {
   DirectHandle<SharedFunctionInfo> shared(function->shared(), isolate_);
-  // Immediately compile the function if batch compilation is disabled.
-  if (!is_enabled()) {
+  // Immediately compile the function if batch compilation is disabled, or if
+  // it needs break checks, which are only compiled on the main thread.
+  if (!is_enabled() ||
+      (v8_flags.sparkplug_break_checks && shared->HasBreakInfo(isolate_))) {
     IsCompiledScope is_compiled_scope(
         function->shared()->is_compiled_scope(isolate_));
     Compiler::CompileBaseline(isolate_, function, Compiler::CLEAR_EXCEPTION,
@@ -331,6 +339,22 @@ void BaselineBatchCompiler::CompileBatchConcurrent(
   ClearBatch();
 }
 
+int BaselineBatchCompiler::BatchThreshold() const {
+  int threshold = v8_flags.baseline_batch_compilation_threshold;
+  if (!v8_flags.baseline_batch_compilation_adaptive_threshold ||
+      !concurrent_compiler_) {
+    return threshold;
+  }
+  // Idle threads get small batches, so that code is available early during
+  // startup. While batches are waiting, larger batches amortize the main
+  // thread work of collecting and installing a batch.
+  size_t pending_batches = concurrent_compiler_->PendingBatches();
+  if (pending_batches == 0) return std::max(threshold / 2, 1);
+  int scale = static_cast<int>(std::min<size_t>(
+      pending_batches + 1, static_cast<size_t>(kMaxBatchThresholdScale)));
+  return threshold * scale;
+}
+
 bool BaselineBatchCompiler::ShouldCompileBatch(
     Tagged<SharedFunctionInfo> shared) {
   // Early return if the function is compiled with baseline already or it is not
@@ -347,17 +371,16 @@ bool BaselineBatchCompiler::ShouldCompileBatch(
         shared->GetBytecodeArray(isolate_));
   }
   estimated_instruction_size_ += estimated_size;
+  const int threshold = BatchThreshold();
   if (v8_flags.trace_baseline_batch_compilation) {
     CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
     PrintF(trace_scope.file(), "[Baseline batch compilation] Enqueued SFI %s",
            shared->DebugNameCStr().get());
     PrintF(trace_scope.file(),
            " with estimated size %d (current budget: %d/%d)\n", estimated_size,
-           estimated_instruction_size_,
-           v8_flags.baseline_batch_compilation_threshold.value());
+           estimated_instruction_size_, threshold);
   }
-  if (estimated_instruction_size_ >=
-      v8_flags.baseline_batch_compilation_threshold) {
+  if (estimated_instruction_size_ >= threshold) {
     if (v8_flags.trace_baseline_batch_compilation) {
       CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
       PrintF(trace_scope.file(),
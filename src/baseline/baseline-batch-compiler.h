@@ -20,6 +20,8 @@ class ConcurrentBaselineCompiler;
 class BaselineBatchCompiler {
  public:
   static const int kInitialQueueSize = 32;
+  // The maximum factor by which the adaptive threshold grows the batches.
+  static const int kMaxBatchThresholdScale = 4;
 
   explicit BaselineBatchCompiler(Isolate* isolate);
   ~BaselineBatchCompiler();
@@ -46,6 +48,9 @@ class BaselineBatchCompiler {
   // compiled.
   bool ShouldCompileBatch(Tagged<SharedFunctionInfo> shared);
 
+  // Returns the estimated instruction size of a batch to trigger compilation.
+  int BatchThreshold() const;
+
   // Compiles the current batch.
   void CompileBatch(DirectHandle<JSFunction> function);
 
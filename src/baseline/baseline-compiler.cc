@@ -19,6 +19,7 @@
 #include "src/codegen/interface-descriptors-inl.h"
 #include "src/codegen/machine-type.h"
 #include "src/codegen/macro-assembler-inl.h"
+#include "src/codegen/source-position-table.h"
 #include "src/common/globals.h"
 #include "src/execution/frame-constants.h"
 #include "src/heap/local-factory-inl.h"
@@ -275,25 +276,56 @@ std::unique_ptr<AssemblerBuffer> AllocateBuffer(
   }
   return NewAssemblerBuffer(RoundUp(estimated_size, 4 * KB));
 }
+
+// Returns the offsets at which the debugger can set a break point, matching
+// BreakIterator::GetDebugBreakType.
+BitVector* BreakLocationOffsets(DirectHandle<BytecodeArray> bytecode,
+                                DirectHandle<BytecodeArray> debug_bytecode,
+                                Zone* zone) {
+  DisallowGarbageCollection no_gc;
+  BitVector* offsets = zone->New<BitVector>(bytecode->length(), zone);
+  for (SourcePositionTableIterator it(debug_bytecode->SourcePositionTable());
+       !it.done(); it.Advance()) {
+    int offset = it.code_offset();
+    interpreter::Bytecode current =
+        interpreter::Bytecodes::FromByte(bytecode->get(offset));
+    if (interpreter::Bytecodes::IsPrefixScalingBytecode(current)) {
+      current = interpreter::Bytecodes::FromByte(bytecode->get(offset + 1));
+    }
+    if (it.is_statement() || current == interpreter::Bytecode::kDebugger ||
+        current == interpreter::Bytecode::kReturn ||
+        current == interpreter::Bytecode::kSuspendGenerator ||
+        interpreter::Bytecodes::IsCallOrConstruct(current)) {
+      offsets->Add(offset);
+    }
+  }
+  return offsets;
+}
 }  // namespace
 
 BaselineCompiler::BaselineCompiler(
     LocalIsolate* local_isolate,
     Handle<SharedFunctionInfo> shared_function_info,
-    Handle<BytecodeArray> bytecode)
+    Handle<BytecodeArray> bytecode, Handle<BytecodeArray> debug_bytecode)
     : local_isolate_(local_isolate),
       stats_(local_isolate->runtime_call_stats()),
       shared_function_info_(shared_function_info),
-      bytecode_(bytecode),
+      bytecode_(debug_bytecode.is_null() ? bytecode : debug_bytecode),
       zone_(local_isolate->allocator(), ZONE_NAME),
       masm_(
           local_isolate->GetMainThreadIsolateUnsafe(), &zone_,
           BaselineAssemblerOptions(local_isolate->GetMainThreadIsolateUnsafe()),
           CodeObjectRequired::kNo, AllocateBuffer(bytecode)),
       basm_(&masm_),
-      iterator_(bytecode_),
+      iterator_(bytecode),
       labels_(zone_.AllocateArray<Label>(bytecode_->length())),
       label_tags_(2 * bytecode_->length(), &zone_) {
+  if (!debug_bytecode.is_null()) {
+    // Code is generated from the original bytecode, since the debug bytecode
+    // has break points patched in. Only the break checks read the latter.
+    break_check_offsets_ =
+        BreakLocationOffsets(bytecode, debug_bytecode, &zone_);
+  }
   // Empirically determined expected size of the offset table at the 95th %ile,
   // based on the size of the bytecode, to be:
   //
@@ -495,6 +527,10 @@ void BaselineCompiler::VisitSingleBytecode() {
 
   VerifyFrame();
 
+  if (break_check_offsets_ && break_check_offsets_->Contains(offset)) {
+    EmitBreakCheck();
+  }
+
 #ifdef V8_TRACE_UNOPTIMIZED
   TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
 #endif
@@ -531,6 +567,28 @@ void BaselineCompiler::VisitSingleBytecode() {
 #endif
 }
 
+void BaselineCompiler::EmitBreakCheck() {
+  ASM_CODE_COMMENT(&masm_);
+  // Break points are set by patching the debug bytecode, so a break is due
+  // whenever the debug bytecode differs from the original one.
+  int offset = iterator().current_offset();
+  Label no_break;
+  {
+    BaselineAssembler::ScratchRegisterScope scratch_scope(&basm_);
+    Register debug_bytecode = scratch_scope.AcquireScratch();
+    __ Move(debug_bytecode, bytecode_);
+    __ LoadWord8Field(debug_bytecode, debug_bytecode,
+                      BytecodeArray::kHeaderSize + offset);
+    __ JumpIfByte(kEqual, debug_bytecode,
+                  iterator().bytecode_array()->get(offset), &no_break,
+                  Label::kNear);
+  }
+  // The debugger may change the accumulator, e.g. the return value at a break
+  // on return, so the runtime function returns the new value.
+  CallRuntime(Runtime::kDebugBreakOnBaseline, kInterpreterAccumulatorRegister);
+  __ Bind(&no_break);
+}
+
 void BaselineCompiler::VerifyFrame() {
   if (v8_flags.slow_debug_code) {
     ASM_CODE_COMMENT(&masm_);
@@ -49,9 +49,13 @@ class BytecodeOffsetTableBuilder {
 
 class BaselineCompiler {
  public:
-  explicit BaselineCompiler(LocalIsolate* local_isolate,
-                            Handle<SharedFunctionInfo> shared_function_info,
-                            Handle<BytecodeArray> bytecode);
+  // If {debug_bytecode} is given, the code checks it for debug breaks at every
+  // break location, and baseline frames refer to it instead of {bytecode}.
+  explicit BaselineCompiler(
+      LocalIsolate* local_isolate,
+      Handle<SharedFunctionInfo> shared_function_info,
+      Handle<BytecodeArray> bytecode,
+      Handle<BytecodeArray> debug_bytecode = Handle<BytecodeArray>());
 
   void GenerateCode();
   MaybeHandle<Code> Build();
@@ -68,6 +72,8 @@ class BaselineCompiler {
   void VerifyFrame();
   void VerifyFrameSize();
 
+  void EmitBreakCheck();
+
   // Register operands.
   interpreter::Register RegisterOperand(int operand_index);
   void LoadRegister(Register output, int operand_index);
@@ -196,6 +202,9 @@ class BaselineCompiler {
   Label* labels_;
   BitVector label_tags_;
 
+  // Offsets of the break locations, if compiling with break checks.
+  BitVector* break_check_offsets_ = nullptr;
+
 #ifdef DEBUG
   friend class SaveAccumulatorScope;
 
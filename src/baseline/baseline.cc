@@ -19,6 +19,22 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Functions with break points can be compiled with checks for breaks in the
+// debug bytecode, as long as that is only patched for break points (and not
+// e.g. for side effect checks) and there is no break at entry. Discarding the
+// code while paused at a break check relies on patching the return address.
+bool CanCompileWithBreakChecks(Tagged<DebugInfo> debug_info) {
+  return v8_flags.sparkplug_break_checks && !v8_flags.cet_compatible &&
+         debug_info->HasBreakInfo() &&
+         debug_info->HasInstrumentedBytecodeArray() &&
+         !debug_info->CanBreakAtEntry() &&
+         debug_info->DebugExecutionMode() == DebugInfo::kBreakpoints;
+}
+
+}  // namespace
+
 bool CanCompileWithBaseline(Isolate* isolate,
                             Tagged<SharedFunctionInfo> shared) {
   DisallowGarbageCollection no_gc;
@@ -39,12 +55,14 @@ bool CanCompileWithBaseline(Isolate* isolate,
   if (isolate->debug()->needs_check_on_function_call()) return false;
 
   if (auto debug_info = shared->TryGetDebugInfo(isolate)) {
-    // Functions with breakpoints have to stay interpreted.
-    if (debug_info.value()->HasBreakInfo()) return false;
-
-    // Functions with instrumented bytecode can't be baseline compiled since the
-    // baseline code's bytecode array pointer is immutable.
-    if (debug_info.value()->HasInstrumentedBytecodeArray()) return false;
+    if (!CanCompileWithBreakChecks(debug_info.value())) {
+      // Functions with breakpoints have to stay interpreted.
+      if (debug_info.value()->HasBreakInfo()) return false;
+
+      // Functions with instrumented bytecode can't be baseline compiled since
+      // the baseline code's bytecode array pointer is immutable.
+      if (debug_info.value()->HasInstrumentedBytecodeArray()) return false;
+    }
   }
 
   // Do not baseline compile if function doesn't pass sparkplug_filter.
@@ -57,8 +75,17 @@ MaybeHandle<Code> GenerateBaselineCode(Isolate* isolate,
                                        Handle<SharedFunctionInfo> shared) {
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileBaseline);
   Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate), isolate);
+  Handle<BytecodeArray> debug_bytecode;
+  if (auto debug_info = shared->TryGetDebugInfo(isolate)) {
+    if (debug_info.value()->HasInstrumentedBytecodeArray()) {
+      DCHECK(CanCompileWithBreakChecks(debug_info.value()));
+      debug_bytecode =
+          handle(debug_info.value()->DebugBytecodeArray(isolate), isolate);
+    }
+  }
   LocalIsolate* local_isolate = isolate->main_thread_local_isolate();
-  baseline::BaselineCompiler compiler(local_isolate, shared, bytecode);
+  baseline::BaselineCompiler compiler(local_isolate, shared, bytecode,
+                                      debug_bytecode);
   compiler.GenerateCode();
   MaybeHandle<Code> code = compiler.Build();
   if (v8_flags.print_code && !code.is_null()) {
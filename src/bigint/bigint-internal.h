@@ -5,6 +5,7 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <atomic>
 #include <memory>
 
 #include "src/bigint/bigint.h"
@@ -21,12 +22,25 @@ constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
 // kBarrettThreshold is defined in bigint.h.
 
+// Minimum combined input length for splitting a multiplication across the
+// Platform's worker threads.
+constexpr int kParallelMultiplyThreshold = 5000;
+
 constexpr int kToStringFastThreshold = 43;
+// With radix powers cached from earlier conversions, the fast algorithm pays
+// off for smaller inputs. Inputs up to kToStringCacheMaxDigits use the cache.
+constexpr int kToStringCachedFastThreshold = 20;
+constexpr int kToStringCacheMaxDigits = 2048;
 constexpr int kFromStringLargeThreshold = 300;
 
+class ToStringCache;
+
 class ProcessorImpl : public Processor {
  public:
   explicit ProcessorImpl(Platform* platform);
+  // Creates a processor for one unit of work of a parallel operation started
+  // by {parent}. Shares {parent}'s platform without taking ownership.
+  explicit ProcessorImpl(ProcessorImpl* parent);
   ~ProcessorImpl();
 
   Status get_and_clear_status();
@@ -49,6 +63,7 @@ class ProcessorImpl : public Processor {
 
 #if V8_ADVANCED_BIGINT_ALGORITHMS
   void MultiplyToomCook(RWDigits Z, Digits X, Digits Y);
+  void MultiplyToomCookParallel(RWDigits Z, Digits X, Digits Y, int tasks);
   void Toom3Main(RWDigits Z, Digits X, Digits Y);
 
   void MultiplyFFT(RWDigits Z, Digits X, Digits Y);
@@ -69,12 +84,55 @@ class ProcessorImpl : public Processor {
   void ToStringImpl(char* out, uint32_t* out_length, Digits X, int radix,
                     bool sign, bool use_fast_algorithm);
 
+  // Returns the cache of radix powers for conversions to strings, or nullptr
+  // if this processor doesn't have one.
+  ToStringCache* tostring_cache();
+  void ClearToStringCache();
+
   void FromString(RWDigits Z, FromStringAccumulator* accumulator);
   void FromStringClassic(RWDigits Z, FromStringAccumulator* accumulator);
   void FromStringLarge(RWDigits Z, FromStringAccumulator* accumulator);
   void FromStringBasePowerOfTwo(RWDigits Z, FromStringAccumulator* accumulator);
 
-  bool should_terminate() { return status_ == Status::kInterrupted; }
+  bool should_terminate() {
+    if (status_ == Status::kInterrupted) return true;
+    return parent_ != nullptr &&
+           parent_->parallel_interrupted_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the number of units of work that an operation on {length} digits
+  // should be split into, or 0 if it should run sequentially. Nested parallel
+  // operations are not supported.
+  int ParallelTasksFor(int length) {
+    if (parent_ != nullptr || length < kParallelMultiplyThreshold) return 0;
+    int threads = platform_->NumberOfWorkerThreads();
+    return threads > 0 ? threads + 1 : 0;
+  }
+
+  // Calls {fn(processor, i)} for each {i} in [0, count) via the Platform,
+  // passing a separate child processor for each call. An interrupt seen by
+  // any of them stops the others and is reported on this processor.
+  template <typename Fn>
+  void RunInParallel(int count, const Fn& fn) {
+    class Task : public Platform::ParallelTask {
+     public:
+      Task(ProcessorImpl* parent, const Fn& fn) : parent_(parent), fn_(fn) {}
+      void Run(int index) override {
+        ProcessorImpl child(parent_);
+        if (child.should_terminate()) return;
+        fn_(&child, index);
+      }
+
+     private:
+      ProcessorImpl* parent_;
+      const Fn& fn_;
+    };
+    Task task(this, fn);
+    platform_->RunParallel(&task, count);
+    if (parallel_interrupted_.exchange(false, std::memory_order_relaxed)) {
+      status_ = Status::kInterrupted;
+    }
+  }
 
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
@@ -89,6 +147,10 @@ class ProcessorImpl : public Processor {
       work_estimate_ = 0;
       if (platform_->InterruptRequested()) {
         status_ = Status::kInterrupted;
+        if (parent_ != nullptr) {
+          parent_->parallel_interrupted_.store(true,
+                                               std::memory_order_relaxed);
+        }
       }
     }
   }
@@ -97,6 +159,12 @@ class ProcessorImpl : public Processor {
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
+  ProcessorImpl* parent_{nullptr};
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  ToStringCache* tostring_cache_{nullptr};
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  // Set by child processors when they observe an interrupt request.
+  std::atomic<bool> parallel_interrupted_{false};
 };
 
 // These constants are primarily needed for Barrett division in div-barrett.cc,
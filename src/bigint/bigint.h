@@ -199,8 +199,27 @@ class Platform {
 
   // If you want the ability to interrupt long-running operations, implement
   // a Platform subclass that overrides this method. It will be queried
-  // every now and then by long-running operations.
+  // every now and then by long-running operations. When the Platform
+  // provides worker threads (see below), it may be queried from those
+  // threads too.
   virtual bool InterruptRequested() { return false; }
+
+  // One unit of work of a parallel operation, see {RunParallel}.
+  class ParallelTask {
+   public:
+    virtual ~ParallelTask() = default;
+    virtual void Run(int index) = 0;
+  };
+
+  // If you want very large multiplications (and the divisions built on them)
+  // to be split across threads, override these methods. {RunParallel} must
+  // call {task->Run(i)} exactly once for each {i} in [0, count), possibly
+  // concurrently and on any thread, and must not return before all of those
+  // calls have returned.
+  virtual int NumberOfWorkerThreads() { return 0; }
+  virtual void RunParallel(ParallelTask* task, int count) {
+    for (int i = 0; i < count; i++) task->Run(i);
+  }
 };
 
 // These are the operations that this library supports.
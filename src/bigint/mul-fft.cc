@@ -460,10 +460,11 @@ class FFTContainer {
 
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
+  void BackwardFFT_Combine(int start, int len, int omega, digit_t* temp);
 
   void PointwiseMultiply(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -586,6 +587,17 @@ void FFTContainer::FFT_Recurse(int start, int half, int omega, digit_t* temp) {
 // We use the "DIT" aka "decimation in time" transform here, because it
 // turns bit-reversed input into normally sorted output.
 void FFTContainer::BackwardFFT(int start, int len, int omega) {
+  int half = len / 2;
+  if (half > 2 && processor_->ParallelTasksFor(n_ * length_) > 1) {
+    // The two halves are independent; only the final combining step needs
+    // both of them.
+    processor_->RunInParallel(2, [&](ProcessorImpl*, int index) {
+      ScratchDigits temp(length_ * 2);
+      BackwardFFT_Threadsafe(start + index * half, half, 2 * omega,
+                             temp.digits());
+    });
+    return BackwardFFT_Combine(start, len, omega, temp_);
+  }
   BackwardFFT_Threadsafe(start, len, omega, temp_);
 }
 
@@ -599,6 +611,13 @@ void FFTContainer::BackwardFFT_Threadsafe(int start, int len, int omega,
     BackwardFFT_Threadsafe(start, half, 2 * omega, temp);
     BackwardFFT_Threadsafe(start + half, half, 2 * omega, temp);
   }
+  BackwardFFT_Combine(start, len, omega, temp);
+}
+
+// Last step of the above, combining the two transformed halves.
+void FFTContainer::BackwardFFT_Combine(int start, int len, int omega,
+                                       digit_t* temp) {
+  int half = len / 2;
   SumDiff(part_[start], part_[start + half], part_[start], part_[start + half],
           length_);
   for (int k = 1; k < half; k++) {
@@ -721,8 +740,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -733,11 +752,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -750,7 +769,21 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  int tasks = processor_->ParallelTasksFor(n_ * length_);
+  if (tasks > 1) {
+    // Split into ranges of even length, so that the first level of the
+    // backwards FFT stays within each range.
+    int per_task = RoundUp(DIV_CEIL(n_, tasks), 2);
+    tasks = DIV_CEIL(n_, per_task);
+    processor_->RunInParallel(tasks, [&](ProcessorImpl* processor, int index) {
+      int start = index * per_task;
+      int end = std::min(start + per_task, n_);
+      ScratchDigits temp(length_ * 2);
+      DoPointwiseMultiplication(other, start, end, temp.digits(), processor);
+    });
+    return;
+  }
+  DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
 }
 
 }  // namespace
@@ -770,13 +803,25 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   int omega = params.r;  // really: 2^r
 
   FFTContainer a(params.n, params.K, this);
-  a.Start(X, params.s, 0, omega);
   if (X == Y) {
     // Squaring.
+    a.Start(X, params.s, 0, omega);
     a.PointwiseMultiply(a);
   } else {
     FFTContainer b(params.n, params.K, this);
-    b.Start(Y, params.s, 0, omega);
+    if (ParallelTasksFor(X.len() + Y.len()) > 1) {
+      // The forward transforms of both inputs are independent.
+      RunInParallel(2, [&](ProcessorImpl*, int index) {
+        if (index == 0) {
+          a.Start(X, params.s, 0, omega);
+        } else {
+          b.Start(Y, params.s, 0, omega);
+        }
+      });
+    } else {
+      a.Start(X, params.s, 0, omega);
+      b.Start(Y, params.s, 0, omega);
+    }
     a.PointwiseMultiply(b);
   }
   if (should_terminate()) return;
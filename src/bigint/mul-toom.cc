@@ -203,6 +203,10 @@ void ProcessorImpl::Toom3Main(RWDigits Z, Digits X, Digits Y) {
 void ProcessorImpl::MultiplyToomCook(RWDigits Z, Digits X, Digits Y) {
   DCHECK(X.len() >= Y.len());
   int k = Y.len();
+  if (X.len() > k) {
+    int tasks = ParallelTasksFor(X.len() + Y.len());
+    if (tasks > 1) return MultiplyToomCookParallel(Z, X, Y, tasks);
+  }
   // TODO(jkummerow): Would it be a measurable improvement to share the
   // scratch memory for several invocations?
   Digits X0(X, 0, k);
@@ -219,5 +223,31 @@ void ProcessorImpl::MultiplyToomCook(RWDigits Z, Digits X, Digits Y) {
   }
 }
 
+// Computes the same chunk products as {MultiplyToomCook} above, up to {tasks}
+// of them at a time on the Platform's worker threads, and adds them into {Z}
+// in order.
+void ProcessorImpl::MultiplyToomCookParallel(RWDigits Z, Digits X, Digits Y,
+                                             int tasks) {
+  int k = Y.len();
+  int chunks = DIV_CEIL(X.len(), k);
+  int batch = std::min(tasks, chunks);
+  ScratchDigits products(batch * 2 * k);
+  Z.Clear();
+  for (int first = 0; first < chunks; first += batch) {
+    int count = std::min(batch, chunks - first);
+    RunInParallel(count, [&](ProcessorImpl* processor, int index) {
+      int chunk = first + index;
+      Digits Xi(X, chunk * k, k);
+      RWDigits T(products, index * 2 * k, 2 * k);
+      processor->Toom3Main(T, Xi, Y);
+    });
+    if (should_terminate()) return;
+    for (int index = 0; index < count; index++) {
+      Digits T(products, index * 2 * k, 2 * k);
+      AddAndReturnOverflow(Z + (first + index) * k, T);  // Can't overflow.
+    }
+  }
+}
+
 }  // namespace bigint
 }  // namespace v8
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <cstring>
+#include <iterator>
 #include <limits>
 
 #include "src/bigint/bigint-internal.h"
@@ -322,6 +323,11 @@ class RecursionLevel {
   static RecursionLevel* CreateLevels(digit_t base_divisor, int base_char_count,
                                       int target_bit_length,
                                       ProcessorImpl* processor);
+  static RecursionLevel* GetCachedLevels(RecursionLevel** cache,
+                                         digit_t base_divisor,
+                                         int base_char_count,
+                                         int target_bit_length,
+                                         ProcessorImpl* processor);
   ~RecursionLevel() { delete next_; }
 
   void ComputeInverse(ProcessorImpl* proc, int dividend_length = 0);
@@ -341,11 +347,19 @@ class RecursionLevel {
   }
 
   void LeftShiftDivisor() {
+    bit_length_ = BitLength(divisor_);
     leading_zero_shift_ = CountLeadingZeros(divisor_.msd());
     LeftShift(divisor_, divisor_, leading_zero_shift_);
   }
 
+  // Mirrors the termination condition in {CreateLevels}.
+  bool IsEnoughFor(int target_bit_length) const {
+    return bit_length_ * 2 - 1 > target_bit_length;
+  }
+
   int leading_zero_shift_{0};
+  // Bit length of the divisor before left-shifting.
+  int bit_length_{0};
   // The number of characters generated by *each half* of this level.
   int char_count_;
   bool is_toplevel_{true};
@@ -391,6 +405,53 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
   return level;
 }
 
+// Like {CreateLevels}, but keeps the levels in {*cache} across calls, with
+// complete inverses, so that later conversions only need to compute levels
+// that no earlier conversion has needed. Returns the level that
+// {CreateLevels} would have returned as the top level; the cache owns it.
+// static
+RecursionLevel* RecursionLevel::GetCachedLevels(RecursionLevel** cache,
+                                                digit_t base_divisor,
+                                                int base_char_count,
+                                                int target_bit_length,
+                                                ProcessorImpl* processor) {
+  RecursionLevel* top = *cache;
+  if (top == nullptr) {
+    top = new RecursionLevel(base_divisor, base_char_count);
+    top->LeftShiftDivisor();
+    top->ComputeInverse(processor);
+    top->is_toplevel_ = false;
+    *cache = top;
+  }
+  while (!top->IsEnoughFor(target_bit_length)) {
+    RecursionLevel* level = new RecursionLevel(top);
+    // Cached divisors are left-shifted already, so their square is shifted
+    // by twice that amount.
+    processor->Multiply(level->divisor_, top->divisor_, top->divisor_);
+    if (!processor->should_terminate()) {
+      RightShift(level->divisor_, level->divisor_, top->leading_zero_shift_);
+      RightShift(level->divisor_, level->divisor_, top->leading_zero_shift_);
+      level->divisor_.Normalize();
+      level->LeftShiftDivisor();
+      level->ComputeInverse(processor);
+    }
+    if (processor->should_terminate()) {
+      // Leave the cached levels as they were.
+      level->next_ = nullptr;
+      delete level;
+      return nullptr;
+    }
+    level->is_toplevel_ = false;
+    *cache = top = level;
+  }
+  RecursionLevel* level = top;
+  while (level->next_ != nullptr &&
+         level->next_->IsEnoughFor(target_bit_length)) {
+    level = level->next_;
+  }
+  return level;
+}
+
 // The top level might get by with a smaller inverse than we could maximally
 // compute, so the caller should provide the dividend length.
 void RecursionLevel::ComputeInverse(ProcessorImpl* processor,
@@ -422,12 +483,44 @@ Digits RecursionLevel::GetInverse(int dividend_length) {
   return inverse_ + (inverse_.len() - inverse_len);
 }
 
+}  // namespace
+
+// Recursion levels of {ToStringFormatter::Fast}, per radix, retained across
+// calls on the same processor.
+class ToStringCache {
+ public:
+  ToStringCache() = default;
+  ToStringCache(const ToStringCache&) = delete;
+  ToStringCache& operator=(const ToStringCache&) = delete;
+  ~ToStringCache() {
+    for (RecursionLevel* level : levels_) delete level;
+  }
+
+  RecursionLevel** levels(int radix) { return &levels_[radix]; }
+
+ private:
+  RecursionLevel* levels_[std::size(kMaxBitsPerChar)] = {};
+};
+
+namespace {
+
 void ToStringFormatter::Fast() {
   // As a sandbox proofing measure, we round up here. Using {BitLength(digits_)}
   // would be technically optimal, but vulnerable to a malicious worker that
   // uses an in-sandbox corruption primitive to concurrently toggle the MSD bits
   // between the invocations of {CreateLevels} and {ProcessLevel}.
   int target_bit_length = digits_.len() * kDigitBits;
+  ToStringCache* cache = digits_.len() <= kToStringCacheMaxDigits
+                             ? processor_->tostring_cache()
+                             : nullptr;
+  if (cache != nullptr) {
+    RecursionLevel* recursion_levels = RecursionLevel::GetCachedLevels(
+        cache->levels(radix_), chunk_divisor_, chunk_chars_, target_bit_length,
+        processor_);
+    if (processor_->should_terminate()) return;
+    out_ = ProcessLevel(recursion_levels, digits_, out_, true);
+    return;
+  }
   std::unique_ptr<RecursionLevel> recursion_levels(RecursionLevel::CreateLevels(
       chunk_divisor_, chunk_chars_, target_bit_length, processor_));
   if (processor_->should_terminate()) return;
@@ -555,9 +648,29 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
 
 }  // namespace
 
+ToStringCache* ProcessorImpl::tostring_cache() {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  // Child processors may run concurrently with each other.
+  if (parent_ != nullptr) return nullptr;
+  if (tostring_cache_ == nullptr) tostring_cache_ = new ToStringCache();
+  return tostring_cache_;
+#else
+  return nullptr;
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+}
+
+void ProcessorImpl::ClearToStringCache() {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  delete tostring_cache_;
+  tostring_cache_ = nullptr;
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+}
+
 void ProcessorImpl::ToString(char* out, uint32_t* out_length, Digits X,
                              int radix, bool sign) {
-  const bool use_fast_algorithm = X.len() >= kToStringFastThreshold;
+  const bool use_fast_algorithm =
+      X.len() >= kToStringFastThreshold ||
+      (X.len() >= kToStringCachedFastThreshold && tostring_cache() != nullptr);
   ToStringImpl(out, out_length, X, radix, sign, use_fast_algorithm);
 }
 
@@ -46,6 +46,20 @@ class ArrayBuiltinsAssembler : public CodeStubAssembler {
                       std::make_pair(MachineType::AnyTagged(), dest)));
   }
 
+  // Returns the index of the last element of {elements} at or before
+  // {from_index} that is identical to {search_element}, or -1.
+  TNode<IntPtrT> CallCArrayLastIndexOfSmiOrObject(
+      TNode<FixedArray> elements, TNode<UintPtrT> from_index,
+      TNode<Object> search_element) {
+    TNode<ExternalReference> func = ExternalConstant(
+        ExternalReference::array_lastindexof_smi_or_object());
+    return UncheckedCast<IntPtrT>(CallCFunction(
+        func, MachineType::UintPtr(),
+        std::make_pair(MachineType::TaggedPointer(), elements),
+        std::make_pair(MachineType::UintPtr(), from_index),
+        std::make_pair(MachineType::AnyTagged(), search_element)));
+  }
+
  protected:
   TNode<Context> context() { return context_; }
   TNode<Object> receiver() { return receiver_; }
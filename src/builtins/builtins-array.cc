@@ -212,6 +212,43 @@ V8_WARN_UNUSED_RESULT Tagged<Object> GenericArrayFill(
   return *receiver;
 }
 
+// Moves {array} from a holey back to the packed elements kind once it no
+// longer contains holes below its length. This is only done when the packed
+// map already exists, either as the native context's initial array map or as
+// the map the holey one transitioned from. The allocation site keeps its
+// holey feedback, since other arrays allocated there may still have holes.
+void TryTransitionToPackedElements(Isolate* isolate,
+                                   DirectHandle<JSArray> array) {
+  DirectHandle<Map> map(array->map(), isolate);
+  ElementsKind kind = map->elements_kind();
+  if (!IsFastElementsKind(kind) || !IsHoleyElementsKind(kind)) return;
+  ElementsKind packed_kind = GetPackedElementsKind(kind);
+
+  DirectHandle<Map> packed_map;
+  DirectHandle<NativeContext> native_context = isolate->native_context();
+  if (native_context->GetInitialJSArrayMap(kind) == *map) {
+    Tagged<Object> maybe_packed_map =
+        native_context->get(Context::ArrayMapIndex(packed_kind));
+    if (!IsMap(maybe_packed_map)) return;
+    packed_map = direct_handle(Cast<Map>(maybe_packed_map), isolate);
+  } else {
+    Tagged<Object> back_pointer = map->GetBackPointer();
+    if (!IsMap(back_pointer) ||
+        Cast<Map>(back_pointer)->elements_kind() != packed_kind) {
+      return;
+    }
+    packed_map = direct_handle(Cast<Map>(back_pointer), isolate);
+  }
+  DCHECK_EQ(map->NumberOfOwnDescriptors(),
+            packed_map->NumberOfOwnDescriptors());
+  DCHECK_EQ(map->prototype(), packed_map->prototype());
+
+  // Code that relies on the holey map being stable may store holes into the
+  // array without a map check, so it has to be invalidated.
+  map->NotifyLeafMapLayoutChange(isolate);
+  array->set_map(isolate, *packed_map, kReleaseStore);
+}
+
 V8_WARN_UNUSED_RESULT Maybe<bool> TryFastArrayFill(
     Isolate* isolate, BuiltinArguments* args, DirectHandle<JSReceiver> receiver,
     DirectHandle<Object> value, double start_index, double end_index) {
@@ -260,6 +297,11 @@ V8_WARN_UNUSED_RESULT Maybe<bool> TryFastArrayFill(
     CHECK(accessor->SetLength(array, end).FromJust());
   }
 
+  // Filling the whole array removes all of its holes.
+  if (start == 0 && Object::NumberValue(array->length()) <= end) {
+    TryTransitionToPackedElements(isolate, array);
+  }
+
   return Just(true);
 }
 }  // namespace
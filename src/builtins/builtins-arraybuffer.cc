@@ -12,6 +12,7 @@
 #include "src/numbers/conversions.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
@@ -365,7 +366,7 @@ static Tagged<Object> SliceHelper(BuiltinArguments args, Isolate* isolate,
                            reinterpret_cast<base::Atomic8*>(from_data),
                            new_len_size);
     } else {
-      CopyBytes(to_data, from_data, new_len_size);
+      MemCopyNonTemporal(to_data, from_data, new_len_size);
     }
   }
 
@@ -681,9 +682,9 @@ Tagged<Object> ArrayBufferTransfer(Isolate* isolate,
   //     implement this method as a zero-copy move or a realloc.
   size_t from_byte_length = array_buffer->GetByteLength();
   if (new_byte_length <= from_byte_length) {
-    CopyBytes(to_data, from_data, new_byte_length);
+    MemCopyNonTemporal(to_data, from_data, new_byte_length);
   } else {
-    CopyBytes(to_data, from_data, from_byte_length);
+    MemCopyNonTemporal(to_data, from_data, from_byte_length);
     memset(to_data + from_byte_length, 0, new_byte_length - from_byte_length);
   }
 
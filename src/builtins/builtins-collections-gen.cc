@@ -1195,7 +1195,8 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, hash, other_key, if_same,
+                            if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1261,13 +1262,24 @@ TNode<Uint32T> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<Uint32T> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
 
   GotoIf(TaggedEqual(key_string, candidate_key), if_same);
+
+  // Keys sharing a bucket mostly have different hashes, and the candidate's
+  // hash was computed when it was added to the table. Comparing the hashes
+  // avoids calling the StringEqual builtin for most bucket collisions.
+  Label compare_strings(this);
+  const TNode<Uint32T> candidate_hash =
+      LoadNameHash(CAST(candidate_key), &compare_strings);
+  GotoIf(Word32NotEqual(key_hash, candidate_hash), if_not_same);
+  Goto(&compare_strings);
+
+  BIND(&compare_strings);
   BranchIfStringEqual(key_string, CAST(candidate_key), if_same, if_not_same);
 }
 
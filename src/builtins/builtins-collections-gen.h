@@ -328,7 +328,9 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              Label* entry_found,
                                              Label* not_found);
   TNode<Uint32T> ComputeStringHash(TNode<String> string_key);
-  void SameValueZeroString(TNode<String> key_string,
+  // {key_hash} is the hash of {key_string}, as computed by
+  // ComputeStringHash.
+  void SameValueZeroString(TNode<String> key_string, TNode<Uint32T> key_hash,
                            TNode<Object> candidate_key, Label* if_same,
                            Label* if_not_same);
 
@@ -1101,6 +1101,10 @@ namespace internal {
   CPP(Uint8ArrayFromBase64, kDontAdaptArgumentsSentinel)                       \
   /* proposal-arraybuffer-base64 #sec-uint8array.prototype.tobase64 */         \
   CPP(Uint8ArrayToBase64, kDontAdaptArgumentsSentinel)                         \
+  /* proposal-arraybuffer-base64 #sec-uint8array.fromhex */                    \
+  CPP(Uint8ArrayFromHex, kDontAdaptArgumentsSentinel)                          \
+  /* proposal-arraybuffer-base64 #sec-uint8array.prototype.tohex */            \
+  CPP(Uint8ArrayToHex, kDontAdaptArgumentsSentinel)                            \
                                                                                \
   /* Wasm */                                                                   \
   IF_WASM_DRUMBRAKE(ASM, WasmInterpreterEntry, WasmDummy)                      \
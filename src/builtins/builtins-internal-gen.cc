@@ -159,13 +159,21 @@ class WriteBarrierCodeStubAssembler : public CodeStubAssembler {
 
   void InsertIntoRememberedSet(TNode<IntPtrT> object, TNode<IntPtrT> slot,
                                SaveFPRegsMode fp_mode) {
-    Label slow_path(this), next(this);
+    Label slow_path(this), next(this), slot_set_path(this);
     TNode<IntPtrT> chunk = MemoryChunkFromAddress(object);
     TNode<IntPtrT> page = PageMetadataFromMemoryChunk(chunk);
+    TNode<IntPtrT> slot_offset = IntPtrSub(slot, chunk);
+
+    // Pages that record old-to-new slots by card marking only need to mark the
+    // card of the slot.
+    TNode<IntPtrT> card_table = LoadCardTable(page);
+    GotoIf(WordEqual(card_table, IntPtrConstant(0)), &slot_set_path);
+    MarkCard(card_table, slot_offset);
+    Goto(&next);
 
+    BIND(&slot_set_path);
     // Load address of SlotSet
     TNode<IntPtrT> slot_set = LoadSlotSet(page, &slow_path);
-    TNode<IntPtrT> slot_offset = IntPtrSub(slot, chunk);
     TNode<IntPtrT> num_buckets_address =
         IntPtrSub(slot_set, IntPtrConstant(SlotSet::kNumBucketsSize));
     TNode<IntPtrT> num_buckets = UncheckedCast<IntPtrT>(
@@ -193,6 +201,23 @@ class WriteBarrierCodeStubAssembler : public CodeStubAssembler {
     BIND(&next);
   }
 
+  TNode<IntPtrT> LoadCardTable(TNode<IntPtrT> page) {
+    return UncheckedCast<IntPtrT>(
+        Load(MachineType::Pointer(), page,
+             IntPtrConstant(MutablePageMetadata::CardTableOffset())));
+  }
+
+  void MarkCard(TNode<IntPtrT> card_table, TNode<WordT> slot_offset) {
+    TNode<IntPtrT> num_cards_address =
+        IntPtrSub(card_table, IntPtrConstant(CardTable::kNumCardsSize));
+    TNode<IntPtrT> num_cards = UncheckedCast<IntPtrT>(
+        Load(MachineType::Pointer(), num_cards_address, IntPtrConstant(0)));
+    TNode<WordT> card_index = WordShr(slot_offset, CardTable::kCardSizeLog2);
+    CSA_CHECK(this, UintPtrLessThan(card_index, num_cards));
+    StoreNoWriteBarrier(MachineRepresentation::kWord8, card_table, card_index,
+                        Int32Constant(CardTable::kDirty));
+  }
+
   TNode<IntPtrT> LoadSlotSet(TNode<IntPtrT> page, Label* slow_path) {
     TNode<IntPtrT> slot_set = UncheckedCast<IntPtrT>(
         Load(MachineType::Pointer(), page,
@@ -829,6 +854,7 @@ class DeletePropertyBaseAssembler : public AccessorAssembler {
                                          SKIP_WRITE_BARRIER);
     StoreDetailsByKeyIndex<NameDictionary>(properties, key_index,
                                            SmiConstant(0));
+    ClearNameDictionaryEnumCache(properties);
 
     // Update bookkeeping information (see NameDictionary::ElementRemoved).
     TNode<Smi> nof = GetNumberOfElements<NameDictionary>(properties);
@@ -35,10 +35,20 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
   TNode<IntPtrT> CalculateRingBufferOffset(TNode<IntPtrT> capacity,
                                            TNode<IntPtrT> start,
                                            TNode<IntPtrT> index);
+  // Returns the first microtask of a non-empty |microtask_queue|.
+  TNode<Microtask> PeekMicrotask(TNode<RawPtrT> microtask_queue);
+  // Removes the first microtask from a non-empty |microtask_queue|.
+  void PopMicrotask(TNode<RawPtrT> microtask_queue);
 
   void PrepareForContext(TNode<Context> microtask_context, Label* bailout);
   void RunSingleMicrotask(TNode<Context> current_context,
                           TNode<Microtask> microtask);
+  // Runs |microtask| and the promise reaction jobs directly following it in
+  // the queue which belong to the same native context, without leaving that
+  // context in between. Only valid while no promise hooks are active.
+  void RunPromiseReactionJobBatch(TNode<Context> current_context,
+                                  TNode<RawPtrT> microtask_queue,
+                                  TNode<PromiseReactionJobTask> microtask);
   void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
 
   TNode<Context> GetCurrentContext();
@@ -49,7 +59,7 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
   void RewindEnteredContext(TNode<IntPtrT> saved_entered_context_count);
 
   void RunAllPromiseHooks(PromiseHookType type, TNode<Context> context,
-                          TNode<HeapObject> promise_or_capability);
+                          TNode<Object> promise_or_capability);
   void RunPromiseHook(Runtime::FunctionId id, TNode<Context> context,
                       TNode<HeapObject> promise_or_capability,
                       TNode<Uint32T> promiseHookFlags);
@@ -109,6 +119,32 @@ TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::CalculateRingBufferOffset(
       WordAnd(IntPtrAdd(start, index), IntPtrSub(capacity, IntPtrConstant(1))));
 }
 
+TNode<Microtask> MicrotaskQueueBuiltinsAssembler::PeekMicrotask(
+    TNode<RawPtrT> microtask_queue) {
+  TNode<RawPtrT> ring_buffer = GetMicrotaskRingBuffer(microtask_queue);
+  TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
+  TNode<IntPtrT> start = GetMicrotaskQueueStart(microtask_queue);
+
+  TNode<IntPtrT> offset =
+      CalculateRingBufferOffset(capacity, start, IntPtrConstant(0));
+  TNode<RawPtrT> microtask_pointer = Load<RawPtrT>(ring_buffer, offset);
+  return CAST(BitcastWordToTagged(microtask_pointer));
+}
+
+void MicrotaskQueueBuiltinsAssembler::PopMicrotask(
+    TNode<RawPtrT> microtask_queue) {
+  TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
+  TNode<IntPtrT> size = GetMicrotaskQueueSize(microtask_queue);
+  TNode<IntPtrT> start = GetMicrotaskQueueStart(microtask_queue);
+  CSA_DCHECK(this, IntPtrGreaterThan(size, IntPtrConstant(0)));
+
+  TNode<IntPtrT> new_size = IntPtrSub(size, IntPtrConstant(1));
+  TNode<IntPtrT> new_start = WordAnd(IntPtrAdd(start, IntPtrConstant(1)),
+                                     IntPtrSub(capacity, IntPtrConstant(1)));
+  SetMicrotaskQueueSize(microtask_queue, new_size);
+  SetMicrotaskQueueStart(microtask_queue, new_start);
+}
+
 void MicrotaskQueueBuiltinsAssembler::PrepareForContext(
     TNode<Context> native_context, Label* bailout) {
   CSA_DCHECK(this, IsNativeContext(native_context));
@@ -276,8 +312,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
     const TNode<Object> job_handler =
         LoadObjectField(microtask, PromiseReactionJobTask::kHandlerOffset);
-    const TNode<HeapObject> promise_or_capability = CAST(LoadObjectField(
-        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset));
+    const TNode<Object> promise_or_capability = LoadObjectField(
+        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset);
 
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     SetupContinuationPreservedEmbedderData(microtask);
@@ -318,8 +354,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
     const TNode<Object> job_handler =
         LoadObjectField(microtask, PromiseReactionJobTask::kHandlerOffset);
-    const TNode<HeapObject> promise_or_capability = CAST(LoadObjectField(
-        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset));
+    const TNode<Object> promise_or_capability = LoadObjectField(
+        microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset);
 
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     SetupContinuationPreservedEmbedderData(microtask);
@@ -364,6 +400,120 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
   BIND(&done);
 }
 
+void MicrotaskQueueBuiltinsAssembler::RunPromiseReactionJobBatch(
+    TNode<Context> current_context, TNode<RawPtrT> microtask_queue,
+    TNode<PromiseReactionJobTask> microtask) {
+  CSA_DCHECK(this, Word32BinaryNot(IsExecutionTerminating()));
+
+  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
+  TNode<NativeContext> native_context =
+      LoadNativeContext(LoadObjectField<Context>(
+          microtask, PromiseReactionJobTask::kContextOffset));
+
+  TVARIABLE(PromiseReactionJobTask, var_microtask, microtask);
+  TVARIABLE(Object, var_exception);
+  Label loop(this, &var_microtask), if_exception(this, Label::kDeferred),
+      next(this), leave_context(this), skip(this, Label::kDeferred), done(this);
+
+  // Enter the context once for the whole batch.
+  PrepareForContext(native_context, &skip);
+  Goto(&loop);
+
+  BIND(&loop);
+  {
+    TNode<PromiseReactionJobTask> job = var_microtask.value();
+    StoreRoot(RootIndex::kCurrentMicrotask, job);
+    SetCurrentContext(native_context);
+
+    TNode<Context> microtask_context =
+        LoadObjectField<Context>(job, PromiseReactionJobTask::kContextOffset);
+    const TNode<Object> argument =
+        LoadObjectField(job, PromiseReactionJobTask::kArgumentOffset);
+    const TNode<Object> job_handler =
+        LoadObjectField(job, PromiseReactionJobTask::kHandlerOffset);
+    const TNode<Object> promise_or_capability = LoadObjectField(
+        job, PromiseReactionJobTask::kPromiseOrCapabilityOffset);
+
+#ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+    SetupContinuationPreservedEmbedderData(job);
+#endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+
+    Label is_fulfill(this), is_reject(this);
+    Branch(Word32Equal(LoadInstanceType(job),
+                       Int32Constant(PROMISE_FULFILL_REACTION_JOB_TASK_TYPE)),
+           &is_fulfill, &is_reject);
+
+    BIND(&is_fulfill);
+    {
+      ScopedExceptionHandler handler(this, &if_exception, &var_exception);
+      CallBuiltin(Builtin::kPromiseFulfillReactionJob, microtask_context,
+                  argument, job_handler, promise_or_capability);
+    }
+    Goto(&next);
+
+    BIND(&is_reject);
+    {
+      ScopedExceptionHandler handler(this, &if_exception, &var_exception);
+      CallBuiltin(Builtin::kPromiseRejectReactionJob, microtask_context,
+                  argument, job_handler, promise_or_capability);
+    }
+    Goto(&next);
+  }
+
+  BIND(&next);
+  {
+#ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+    ClearContinuationPreservedEmbedderData();
+#endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+    IncrementFinishedMicrotaskCount(microtask_queue);
+
+    // Continue with the next microtask if it can join the batch. The job we
+    // just ran may have installed promise hooks, so check them again.
+    GotoIf(WordEqual(GetMicrotaskQueueSize(microtask_queue), IntPtrConstant(0)),
+           &leave_context);
+    TNode<Microtask> next_microtask = PeekMicrotask(microtask_queue);
+    GotoIfNot(IsPromiseReactionJobTask(next_microtask), &leave_context);
+    GotoIf(NeedsAnyPromiseHooks(), &leave_context);
+    TNode<PromiseReactionJobTask> next_job = CAST(next_microtask);
+    TNode<Context> next_context = LoadObjectField<Context>(
+        next_job, PromiseReactionJobTask::kContextOffset);
+    GotoIfNot(TaggedEqual(LoadNativeContext(next_context), native_context),
+              &leave_context);
+    PopMicrotask(microtask_queue);
+    var_microtask = next_job;
+    Goto(&loop);
+  }
+
+  BIND(&if_exception);
+  {
+    // Report unhandled exceptions from microtasks, and end the batch so that
+    // the entered contexts are rewound.
+    CallRuntime(Runtime::kReportMessageFromMicrotask, GetCurrentContext(),
+                var_exception.value());
+#ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+    ClearContinuationPreservedEmbedderData();
+#endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+    IncrementFinishedMicrotaskCount(microtask_queue);
+    Goto(&leave_context);
+  }
+
+  BIND(&leave_context);
+  {
+    RewindEnteredContext(saved_entered_context_count);
+    SetCurrentContext(current_context);
+    Goto(&done);
+  }
+
+  BIND(&skip);
+  {
+    // The context was shut down; drop the microtask like RunSingleMicrotask.
+    IncrementFinishedMicrotaskCount(microtask_queue);
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
 void MicrotaskQueueBuiltinsAssembler::IncrementFinishedMicrotaskCount(
     TNode<RawPtrT> microtask_queue) {
   TNode<IntPtrT> count = Load<IntPtrT>(
@@ -470,7 +620,7 @@ void MicrotaskQueueBuiltinsAssembler::RewindEnteredContext(
 
 void MicrotaskQueueBuiltinsAssembler::RunAllPromiseHooks(
     PromiseHookType type, TNode<Context> context,
-    TNode<HeapObject> promise_or_capability) {
+    TNode<Object> maybe_promise_or_capability) {
   TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
 #ifdef V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
   Label hook(this, Label::kDeferred), done_hook(this);
@@ -478,6 +628,12 @@ void MicrotaskQueueBuiltinsAssembler::RunAllPromiseHooks(
   BIND(&hook);
   {
 #endif
+    // The reactions of the shared Promise.all/allSettled element closures
+    // hold the index of the element instead of a promise.
+    TNode<HeapObject> promise_or_capability = Select<HeapObject>(
+        TaggedIsSmi(maybe_promise_or_capability),
+        [=, this] { return UndefinedConstant(); },
+        [=, this] { return CAST(maybe_promise_or_capability); });
     switch (type) {
       case PromiseHookType::kBefore:
 #ifdef V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
@@ -595,24 +751,23 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   // Exit if the queue is empty.
   GotoIf(WordEqual(size, IntPtrConstant(0)), &done);
 
-  TNode<RawPtrT> ring_buffer = GetMicrotaskRingBuffer(microtask_queue);
-  TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
-  TNode<IntPtrT> start = GetMicrotaskQueueStart(microtask_queue);
-
-  TNode<IntPtrT> offset =
-      CalculateRingBufferOffset(capacity, start, IntPtrConstant(0));
-  TNode<RawPtrT> microtask_pointer = Load<RawPtrT>(ring_buffer, offset);
-  TNode<Microtask> microtask = CAST(BitcastWordToTagged(microtask_pointer));
-
-  TNode<IntPtrT> new_size = IntPtrSub(size, IntPtrConstant(1));
-  TNode<IntPtrT> new_start = WordAnd(IntPtrAdd(start, IntPtrConstant(1)),
-                                     IntPtrSub(capacity, IntPtrConstant(1)));
+  TNode<Microtask> microtask = PeekMicrotask(microtask_queue);
 
   // Remove |microtask| from |ring_buffer| before running it, since its
   // invocation may add another microtask into |ring_buffer|.
-  SetMicrotaskQueueSize(microtask_queue, new_size);
-  SetMicrotaskQueueStart(microtask_queue, new_start);
+  PopMicrotask(microtask_queue);
+
+  // Promise reaction jobs make up most of the queue for async code. Without
+  // promise hooks, run consecutive ones from the same native context as a
+  // batch to avoid entering and leaving the context for every job.
+  Label run_single(this);
+  GotoIfNot(IsPromiseReactionJobTask(microtask), &run_single);
+  GotoIf(NeedsAnyPromiseHooks(), &run_single);
+  RunPromiseReactionJobBatch(current_context, microtask_queue,
+                             CAST(microtask));
+  Goto(&loop);
 
+  BIND(&run_single);
   RunSingleMicrotask(current_context, microtask);
   IncrementFinishedMicrotaskCount(microtask_queue);
   Goto(&loop);
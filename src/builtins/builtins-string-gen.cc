@@ -481,6 +481,73 @@ TNode<String> StringBuiltinsAssembler::AllocateConsString(TNode<Uint32T> length,
   return CAST(result);
 }
 
+TNode<String> StringBuiltinsAssembler::TryAllocateCoalescedConsString(
+    TNode<Uint32T> length, TNode<String> left, TNode<String> right,
+    TNode<Uint32T> right_length, Label* if_not_coalesced) {
+  Comment("Coalescing ConsString leaf");
+  GotoIfNot(
+      Uint32LessThan(right_length, Uint32Constant(ConsString::kMinLength)),
+      if_not_coalesced);
+  TNode<Int32T> left_instance_type = LoadInstanceType(left);
+  GotoIfNot(Word32Equal(Word32And(left_instance_type,
+                                  Int32Constant(kStringRepresentationMask)),
+                        Int32Constant(kConsStringTag)),
+            if_not_coalesced);
+
+  TNode<String> second =
+      LoadObjectField<String>(left, offsetof(ConsString, second_));
+  TNode<Uint32T> second_length = LoadStringLengthAsWord32(second);
+  TNode<Uint32T> leaf_length = Uint32Add(second_length, right_length);
+  GotoIf(Uint32GreaterThan(leaf_length,
+                           Uint32Constant(ConsString::kMaxCoalescedLeafLength)),
+         if_not_coalesced);
+
+  // Both short parts must be sequential and have the same encoding.
+  TNode<Int32T> second_instance_type = LoadInstanceType(second);
+  TNode<Int32T> right_instance_type = LoadInstanceType(right);
+  static_assert(kSeqStringTag == 0);
+  GotoIf(IsSetWord32(Word32Or(second_instance_type, right_instance_type),
+                     kStringRepresentationMask),
+         if_not_coalesced);
+  GotoIf(IsSetWord32(Word32Xor(second_instance_type, right_instance_type),
+                     kStringEncodingMask),
+         if_not_coalesced);
+
+  TNode<IntPtrT> word_second_length = Signed(ChangeUint32ToWord(second_length));
+  TNode<IntPtrT> word_right_length = Signed(ChangeUint32ToWord(right_length));
+  TVARIABLE(String, leaf);
+  Label two_byte(this), allocate_cons(this);
+  static_assert(kOneByteStringTag != 0);
+  GotoIfNot(IsSetWord32(right_instance_type, kStringEncodingMask), &two_byte);
+  {
+    leaf = AllocateNonEmptySeqOneByteString(leaf_length);
+    CopyStringCharacters(second, leaf.value(), IntPtrConstant(0),
+                         IntPtrConstant(0), word_second_length,
+                         String::ONE_BYTE_ENCODING, String::ONE_BYTE_ENCODING);
+    CopyStringCharacters(right, leaf.value(), IntPtrConstant(0),
+                         word_second_length, word_right_length,
+                         String::ONE_BYTE_ENCODING, String::ONE_BYTE_ENCODING);
+    Goto(&allocate_cons);
+  }
+
+  BIND(&two_byte);
+  {
+    leaf = AllocateNonEmptySeqTwoByteString(leaf_length);
+    CopyStringCharacters(second, leaf.value(), IntPtrConstant(0),
+                         IntPtrConstant(0), word_second_length,
+                         String::TWO_BYTE_ENCODING, String::TWO_BYTE_ENCODING);
+    CopyStringCharacters(right, leaf.value(), IntPtrConstant(0),
+                         word_second_length, word_right_length,
+                         String::TWO_BYTE_ENCODING, String::TWO_BYTE_ENCODING);
+    Goto(&allocate_cons);
+  }
+
+  BIND(&allocate_cons);
+  TNode<String> first =
+      LoadObjectField<String>(left, offsetof(ConsString, first_));
+  return AllocateConsString(length, first, leaf.value());
+}
+
 TNode<String> StringBuiltinsAssembler::StringAdd(
     TNode<ContextOrEmptyContext> context, TNode<String> left,
     TNode<String> right) {
@@ -518,6 +585,13 @@ TNode<String> StringBuiltinsAssembler::StringAdd(
     GotoIf(Uint32LessThan(new_length, Uint32Constant(ConsString::kMinLength)),
            &non_cons);
 
+    Label not_coalesced(this);
+    result = TryAllocateCoalescedConsString(new_length, var_left.value(),
+                                            var_right.value(), right_length,
+                                            &not_coalesced);
+    Goto(&done);
+
+    BIND(&not_coalesced);
     result =
         AllocateConsString(new_length, var_left.value(), var_right.value());
     Goto(&done);
@@ -138,6 +138,16 @@ class StringBuiltinsAssembler : public CodeStubAssembler {
   TNode<String> AllocateConsString(TNode<Uint32T> length, TNode<String> left,
                                    TNode<String> right);
 
+  // If {right} is short and {left} is a ConsString whose second part is a
+  // short sequential string of the same encoding, allocates a ConsString of
+  // {left}'s first part and a flat copy of both short parts. Otherwise jumps
+  // to {if_not_coalesced}. See ConsString::kMaxCoalescedLeafLength.
+  TNode<String> TryAllocateCoalescedConsString(TNode<Uint32T> length,
+                                               TNode<String> left,
+                                               TNode<String> right,
+                                               TNode<Uint32T> right_length,
+                                               Label* if_not_coalesced);
+
   TNode<String> StringAdd(TNode<ContextOrEmptyContext> context,
                           TNode<String> left, TNode<String> right);
 
@@ -11,6 +11,7 @@
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/hex-encoding.h"
 #include "third_party/simdutf/simdutf.h"
 
 namespace v8 {
@@ -412,34 +413,76 @@ MessageTemplate ToMessageTemplate(simdutf::error_code error) {
   }
 }
 
-template <typename T>
+// Calls {callback} with the characters of the flat string {string}, as the
+// pointer type simdutf expects, and their count.
+template <typename Callback>
+auto WithFlatChars(DirectHandle<String> string, Callback callback) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = string->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    return callback(reinterpret_cast<const char*>(chars.begin()), chars.size());
+  }
+  base::Vector<const base::uc16> chars = content.ToUC16Vector();
+  return callback(reinterpret_cast<const char16_t*>(chars.begin()),
+                  chars.size());
+}
+
+MaybeDirectHandle<JSArrayBuffer> NewUninitializedArrayBuffer(
+    Isolate* isolate, size_t byte_length, const char* method_name) {
+  DirectHandle<JSArrayBuffer> buffer;
+  if (!isolate->factory()
+           ->NewJSArrayBufferAndBackingStore(byte_length,
+                                             InitializedFlag::kUninitialized)
+           .ToHandle(&buffer)) {
+    isolate->Throw(*isolate->factory()->NewRangeError(
+        MessageTemplate::kOutOfMemory,
+        isolate->factory()->NewStringFromAsciiChecked(method_name)));
+    return {};
+  }
+  return buffer;
+}
+
+// Decodes the base64 string {input} straight into the backing store of a new
+// array buffer. The buffer is sized for the longest possible result, which is
+// exact unless the input contains whitespace or a trailing partial chunk that
+// is not decoded; only then are the bytes copied into a smaller buffer.
 Maybe<simdutf::result> ArrayBufferFromBase64(
-    Isolate* isolate, T input_vector, size_t input_length,
-    size_t& output_length, simdutf::base64_options alphabet,
+    Isolate* isolate, DirectHandle<String> input,
+    simdutf::base64_options alphabet,
     simdutf::last_chunk_handling_options last_chunk_handling,
-    DirectHandle<JSArrayBuffer>& buffer) {
+    size_t& output_length, DirectHandle<JSArrayBuffer>& buffer) {
   const char method_name[] = "Uint8Array.fromBase64";
 
-  output_length = simdutf::maximal_binary_length_from_base64(
-      reinterpret_cast<const T>(input_vector), input_length);
-  std::unique_ptr<char[]> output = std::make_unique<char[]>(output_length);
-  simdutf::result simd_result = simdutf::base64_to_binary_safe(
-      reinterpret_cast<const T>(input_vector), input_length, output.get(),
-      output_length, alphabet, last_chunk_handling);
+  size_t maximal_length =
+      WithFlatChars(input, [](const auto* chars, size_t length) {
+        return simdutf::maximal_binary_length_from_base64(chars, length);
+      });
+  if (!NewUninitializedArrayBuffer(isolate, maximal_length, method_name)
+           .ToHandle(&buffer)) {
+    return Nothing<simdutf::result>();
+  }
 
-  {
-    AllowGarbageCollection gc;
-    MaybeDirectHandle<JSArrayBuffer> result_buffer =
-        isolate->factory()->NewJSArrayBufferAndBackingStore(
-            output_length, InitializedFlag::kUninitialized);
-    if (!result_buffer.ToHandle(&buffer)) {
-      isolate->Throw(*isolate->factory()->NewRangeError(
-          MessageTemplate::kOutOfMemory,
-          isolate->factory()->NewStringFromAsciiChecked(method_name)));
+  output_length = maximal_length;
+  simdutf::result simd_result =
+      WithFlatChars(input, [&](const auto* chars, size_t length) {
+        return simdutf::base64_to_binary_safe(
+            chars, length, reinterpret_cast<char*>(buffer->backing_store()),
+            output_length, alphabet, last_chunk_handling);
+      });
+
+  if (simd_result.error == simdutf::error_code::SUCCESS &&
+      output_length < maximal_length) {
+    DirectHandle<JSArrayBuffer> exact_buffer;
+    if (!NewUninitializedArrayBuffer(isolate, output_length, method_name)
+             .ToHandle(&exact_buffer)) {
       return Nothing<simdutf::result>();
     }
-
-    memcpy(buffer->backing_store(), output.get(), output_length);
+    if (output_length > 0) {
+      memcpy(exact_buffer->backing_store(), buffer->backing_store(),
+             output_length);
+    }
+    buffer = exact_buffer;
   }
   return Just<simdutf::result>(simd_result);
 }
@@ -524,34 +567,13 @@ BUILTIN(Uint8ArrayFromBase64) {
   }
 
   // 9. Let result be ? FromBase64(string, alphabet, lastChunkHandling).
-  size_t input_length;
   size_t output_length;
   simdutf::result simd_result;
   DirectHandle<JSArrayBuffer> buffer;
-  {
-    DisallowGarbageCollection no_gc;
-    String::FlatContent input_content = input_string->GetFlatContent(no_gc);
-    if (input_content.IsOneByte()) {
-      const unsigned char* input_vector =
-          input_content.ToOneByteVector().data();
-      input_length = input_content.ToOneByteVector().size();
-      MAYBE_ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-          isolate, simd_result,
-          ArrayBufferFromBase64(isolate,
-                                reinterpret_cast<const char*>(input_vector),
-                                input_length, output_length, alphabet,
-                                last_chunk_handling, buffer));
-    } else {
-      const base::uc16* input_vector = input_content.ToUC16Vector().data();
-      input_length = input_content.ToUC16Vector().size();
-      MAYBE_ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-          isolate, simd_result,
-          ArrayBufferFromBase64(isolate,
-                                reinterpret_cast<const char16_t*>(input_vector),
-                                input_length, output_length, alphabet,
-                                last_chunk_handling, buffer));
-    }
-  }
+  MAYBE_ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, simd_result,
+      ArrayBufferFromBase64(isolate, input_string, alphabet,
+                            last_chunk_handling, output_length, buffer));
 
   // 10. If result.[[Error]] is not none, then
   //    a. Throw result.[[Error]].
@@ -674,7 +696,7 @@ BUILTIN(Uint8ArrayToBase64) {
     // TODO(rezvan): Make sure to add a path for SharedArrayBuffers when
     // simdutf library got updated. Also, add a test for it.
     size_t simd_result_size = simdutf::binary_to_base64(
-        std::bit_cast<const char*>(uint8array->GetBuffer()->backing_store()),
+        reinterpret_cast<const char*>(uint8array->DataPtr()),
         uint8array->byte_length(),
         reinterpret_cast<char*>(output->GetChars(no_gc)), alphabet);
     DCHECK_EQ(simd_result_size, output_length);
@@ -687,5 +709,112 @@ BUILTIN(Uint8ArrayToBase64) {
   return *output;
 }
 
+// https://tc39.es/proposal-arraybuffer-base64/spec/#sec-uint8array.fromhex
+BUILTIN(Uint8ArrayFromHex) {
+  HandleScope scope(isolate);
+  const char method_name[] = "Uint8Array.fromHex";
+
+  // 1. If string is not a String, throw a TypeError exception.
+  DirectHandle<Object> input = args.atOrUndefined(isolate, 1);
+  if (!IsString(*input)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kArgumentIsNonString,
+                              isolate->factory()->input_string()));
+  }
+  DirectHandle<String> input_string =
+      String::Flatten(isolate, Cast<String>(input));
+
+  // 2. Let result be FromHex(string).
+  size_t input_length = input_string->length();
+  if (input_length % 2 != 0) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewSyntaxError(MessageTemplate::kInvalidHexString));
+  }
+  size_t output_length = input_length / 2;
+  DirectHandle<JSArrayBuffer> buffer;
+  if (!NewUninitializedArrayBuffer(isolate, output_length, method_name)
+           .ToHandle(&buffer)) {
+    return ReadOnlyRoots(isolate).exception();
+  }
+  // The digits are decoded straight into the new buffer.
+  bool success;
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = input_string->GetFlatContent(no_gc);
+    uint8_t* output = reinterpret_cast<uint8_t*>(buffer->backing_store());
+    if (content.IsOneByte()) {
+      success = HexDecode(content.ToOneByteVector().begin(), input_length,
+                          output);
+    } else {
+      success =
+          HexDecode(content.ToUC16Vector().begin(), input_length, output);
+    }
+  }
+
+  // 3. If result.[[Error]] is not none, then
+  //    a. Throw result.[[Error]].
+  if (!success) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewSyntaxError(MessageTemplate::kInvalidHexString));
+  }
+
+  // 4. Let resultLength be the length of result.[[Bytes]].
+  // 5. Let ta be ? AllocateTypedArray("Uint8Array", %Uint8Array%,
+  // "%Uint8Array.prototype%", resultLength).
+  // 6. Set the value at each index of
+  // ta.[[ViewedArrayBuffer]].[[ArrayBufferData]] to the value at the
+  // corresponding index of result.[[Bytes]].
+  // 7. Return ta.
+  return *isolate->factory()->NewJSTypedArray(kExternalUint8Array, buffer, 0,
+                                              output_length);
+}
+
+// https://tc39.es/proposal-arraybuffer-base64/spec/#sec-uint8array.prototype.tohex
+BUILTIN(Uint8ArrayToHex) {
+  HandleScope scope(isolate);
+  const char method_name[] = "Uint8Array.prototype.toHex";
+
+  // 1. Let O be the this value.
+  // 2. Perform ? ValidateUint8Array(O).
+  CHECK_RECEIVER(JSTypedArray, uint8array, method_name);
+  if (uint8array->GetElementsKind() != ElementsKind::UINT8_ELEMENTS) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kIncompatibleMethodReceiver,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+
+  // 3. Let toEncode be ? GetUint8ArrayBytes(O).
+  if (uint8array->IsDetachedOrOutOfBounds()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kDetachedOperation,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+  size_t byte_length = uint8array->GetByteLength();
+  if (byte_length == 0) return ReadOnlyRoots(isolate).empty_string();
+  if (byte_length > static_cast<size_t>(String::kMaxLength) / 2) {
+    THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
+  }
+
+  // 4. Let out be the empty String.
+  // 5. For each byte byte of toEncode, do
+  //    a. Let hex be Number::toString(𝔽(byte), 16).
+  //    b. Set hex to StringPad(hex, 2, "0", start).
+  //    c. Set out to the string-concatenation of out and hex.
+  // 6. Return out.
+  Handle<SeqOneByteString> output;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, output,
+      isolate->factory()->NewRawOneByteString(
+          static_cast<int>(2 * byte_length)));
+  {
+    DisallowGarbageCollection no_gc;
+    HexEncode(reinterpret_cast<const uint8_t*>(uint8array->DataPtr()),
+              byte_length, output->GetChars(no_gc));
+  }
+  return *output;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -9,6 +9,7 @@
 #include <unordered_map>
 
 #include "src/base/lazy-instance.h"
+#include "src/diagnostics/basic-block-profiler.h"
 #include "src/flags/flags.h"
 #include "src/utils/utils.h"
 
@@ -168,5 +169,37 @@ const ProfileDataFromFile* ProfileDataFromFile::TryRead(const char* name) {
   return it == data.end() ? nullptr : &it->second;
 }
 
+std::unique_ptr<ProfileDataFromFile> ProfileDataFromFile::FromBlockCounts(
+    const BasicBlockProfilerData& data) {
+  // The default thresholds of get_hints.py: a destination needs to be
+  // executed at least {kMinCount} times, and {kRatio} times as often as the
+  // other destination of the branch.
+  constexpr uint64_t kMinCount = 1000;
+  constexpr uint64_t kRatio = 40;
+
+  std::unordered_map<int32_t, uint64_t> counts_by_id;
+  for (size_t i = 0; i < data.n_blocks(); ++i) {
+    counts_by_id[data.block_id(i)] = data.counts()[i];
+  }
+  auto profile = std::make_unique<ProfileDataFromFile>();
+  profile->hash_ = data.hash();
+  for (auto [true_block_id, false_block_id] : data.branches()) {
+    uint64_t true_count = counts_by_id[true_block_id];
+    uint64_t false_count = counts_by_id[false_block_id];
+    bool hint;
+    if (true_count >= kMinCount && true_count >= kRatio * false_count) {
+      hint = true;
+    } else if (false_count >= kMinCount &&
+               false_count >= kRatio * true_count) {
+      hint = false;
+    } else {
+      continue;
+    }
+    profile->block_hints_by_id.insert(
+        std::make_pair(std::make_pair(true_block_id, false_block_id), hint));
+  }
+  return profile;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "src/common/globals.h"
@@ -15,6 +16,8 @@
 namespace v8 {
 namespace internal {
 
+class BasicBlockProfilerData;
+
 class ProfileDataFromFile {
  public:
   // A hash of the function's Graph before scheduling. Allows us to avoid using
@@ -43,6 +46,12 @@ class ProfileDataFromFile {
   // values are the number of times each block was executed while profiling.
   static const ProfileDataFromFile* TryRead(const char* name);
 
+  // Derives branch hints from the block counters collected in this process by
+  // a previous compilation of a function (see --turbo-profiling-js), in the
+  // same way as tools/builtins-pgo/get_hints.py does for builtins.
+  static std::unique_ptr<ProfileDataFromFile> FromBlockCounts(
+      const BasicBlockProfilerData& data);
+
  protected:
   int hash_ = 0;
 
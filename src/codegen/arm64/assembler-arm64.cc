@@ -133,6 +133,13 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
   if (cpu.has_fp16()) {
     runtime |= 1u << FP16;
   }
+  if (cpu.implementer() == base::CPU::kArm &&
+      (cpu.part() == base::CPU::kArmCortexA53 ||
+       cpu.part() == base::CPU::kArmCortexA55 ||
+       cpu.part() == base::CPU::kArmCortexA510 ||
+       cpu.part() == base::CPU::kArmCortexA520)) {
+    runtime |= 1u << IN_ORDER_CORE;
+  }
 
   // Use the best of the features found by CPU detection and those inferred from
   // the build system.
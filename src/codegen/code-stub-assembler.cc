@@ -4537,6 +4537,8 @@ TNode<NameDictionary> CodeStubAssembler::AllocateNameDictionaryWithCapacity(
     StoreFixedArrayElement(result, NameDictionary::kFlagsIndex,
                            SmiConstant(NameDictionary::kFlagsDefault),
                            SKIP_WRITE_BARRIER);
+    StoreFixedArrayElement(result, NameDictionary::kEnumCacheIndex,
+                           UndefinedConstant(), SKIP_WRITE_BARRIER);
   }
 
   // Initialize NameDictionary elements.
@@ -10584,6 +10586,7 @@ void CodeStubAssembler::InsertEntry<NameDictionary>(
   // Finally, store the details.
   StoreDetailsByKeyIndex<NameDictionary>(dictionary, index,
                                          var_details.value());
+  ClearNameDictionaryEnumCache(dictionary);
 }
 
 template <>
@@ -10701,6 +10704,13 @@ void CodeStubAssembler::SetNameDictionaryFlags(TNode<NameDictionary> dictionary,
                          SKIP_WRITE_BARRIER);
 }
 
+void CodeStubAssembler::ClearNameDictionaryEnumCache(
+    TNode<NameDictionary> dictionary) {
+  // See NameDictionary::ClearEnumCache.
+  StoreFixedArrayElement(dictionary, NameDictionary::kEnumCacheIndex,
+                         UndefinedConstant(), SKIP_WRITE_BARRIER);
+}
+
 template <>
 TNode<Smi> CodeStubAssembler::GetNameDictionaryFlags(
     TNode<SwissNameDictionary> dictionary) {
@@ -16322,7 +16332,8 @@ TNode<Boolean> CodeStubAssembler::InstanceOf(TNode<Object> object,
                                              TNode<Context> context) {
   TVARIABLE(Boolean, var_result);
   Label if_notcallable(this, Label::kDeferred),
-      if_notreceiver(this, Label::kDeferred), if_otherhandler(this),
+      if_notreceiver(this, Label::kDeferred), if_lookup(this),
+      if_functionhasinstance(this), if_otherhandler(this),
       if_nohandler(this, Label::kDeferred), return_true(this),
       return_false(this), return_result(this, &var_result);
 
@@ -16330,6 +16341,34 @@ TNode<Boolean> CodeStubAssembler::InstanceOf(TNode<Object> object,
   GotoIf(TaggedIsSmi(callable), &if_notreceiver);
   GotoIfNot(IsJSReceiver(CAST(callable)), &if_notreceiver);
 
+  // Optimize for the likely case where neither {callable} nor any object on
+  // its prototype chain up to the initial Function.prototype has its own
+  // @@hasInstance property, which we can tell from the maps without a
+  // lookup, since @@hasInstance is an interesting symbol. The
+  // Function.prototype[@@hasInstance] method itself is non-writable and
+  // non-configurable.
+  TNode<NativeContext> native_context = LoadNativeContext(context);
+  TNode<HeapObject> function_prototype = CAST(
+      LoadContextElement(native_context, Context::FUNCTION_PROTOTYPE_INDEX));
+  {
+    TVARIABLE(HeapObject, var_holder, CAST(callable));
+    Label loop(this, &var_holder);
+    Goto(&loop);
+    BIND(&loop);
+    {
+      TNode<HeapObject> holder = var_holder.value();
+      GotoIf(TaggedEqual(holder, function_prototype), &if_functionhasinstance);
+      TNode<Map> holder_map = LoadMap(holder);
+      GotoIf(IsSpecialReceiverMap(holder_map), &if_lookup);
+      GotoIf(IsSetWord32<Map::Bits3::MayHaveInterestingPropertiesBit>(
+                 LoadMapBitField3(holder_map)),
+             &if_lookup);
+      var_holder = LoadMapPrototype(holder_map);
+      Branch(IsNull(var_holder.value()), &if_lookup, &loop);
+    }
+  }
+
+  BIND(&if_lookup);
   // Load the @@hasInstance property from {callable}.
   TNode<Object> inst_of_handler =
       GetProperty(context, callable, HasInstanceSymbolConstant());
@@ -16337,18 +16376,18 @@ TNode<Boolean> CodeStubAssembler::InstanceOf(TNode<Object> object,
   // Optimize for the likely case where {inst_of_handler} is the builtin
   // Function.prototype[@@hasInstance] method, and emit a direct call in
   // that case without any additional checking.
-  TNode<NativeContext> native_context = LoadNativeContext(context);
   TNode<JSFunction> function_has_instance = CAST(
       LoadContextElement(native_context, Context::FUNCTION_HAS_INSTANCE_INDEX));
-  GotoIfNot(TaggedEqual(inst_of_handler, function_has_instance),
-            &if_otherhandler);
+  Branch(TaggedEqual(inst_of_handler, function_has_instance),
+         &if_functionhasinstance, &if_otherhandler);
+
+  BIND(&if_functionhasinstance);
   {
-    // Call to Function.prototype[@@hasInstance] directly without using the
+    // Function.prototype[@@hasInstance] just performs OrdinaryHasInstance,
+    // so use the OrdinaryHasInstance algorithm directly without using the
     // Builtins::Call().
-    var_result = CAST(CallJSBuiltin(Builtin::kFunctionPrototypeHasInstance,
-                                    context, inst_of_handler,
-                                    UndefinedConstant(),  // new_target
-                                    callable, object));
+    var_result = CAST(
+        CallBuiltin(Builtin::kOrdinaryHasInstance, context, callable, object));
     Goto(&return_result);
   }
 
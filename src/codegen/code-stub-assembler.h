@@ -3396,6 +3396,8 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   TNode<Smi> GetNameDictionaryFlags(TNode<Dictionary> dictionary);
   template <class Dictionary>
   void SetNameDictionaryFlags(TNode<Dictionary>, TNode<Smi> flags);
+  // Invalidates the cached enumerable keys after a key was added or removed.
+  void ClearNameDictionaryEnumCache(TNode<NameDictionary> dictionary);
 
   enum LookupMode {
     kFindExisting,
@@ -4,6 +4,8 @@
 
 #include "src/codegen/compilation-cache.h"
 
+#include "src/base/lazy-instance.h"
+#include "src/codegen/script-details.h"
 #include "src/common/globals.h"
 #include "src/heap/factory.h"
 #include "src/logging/counters.h"
@@ -13,6 +15,7 @@
 #include "src/objects/objects.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -387,5 +390,65 @@ void CompilationCache::DisableScriptAndEval() {
   Clear();
 }
 
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProcessWideScriptCache,
+                                ProcessWideScriptCache::Get)
+
+// static
+std::string ProcessWideScriptCache::Key(Isolate* isolate,
+                                        DirectHandle<String> source,
+                                        const ScriptDetails& script_details) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  std::string key;
+  key.push_back(static_cast<char>(script_details.origin_options.Flags()));
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.push_back(1);
+    key.append(reinterpret_cast<const char*>(chars.begin()), chars.length());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    key.push_back(2);
+    key.append(reinterpret_cast<const char*>(chars.begin()),
+               chars.length() * sizeof(base::uc16));
+  }
+  return key;
+}
+
+std::unique_ptr<AlignedCachedData> ProcessWideScriptCache::Lookup(
+    Isolate* isolate, DirectHandle<String> source,
+    const ScriptDetails& script_details) {
+  std::string key = Key(isolate, source, script_details);
+  base::MutexGuard guard(&mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return {};
+  // Entries are never removed, so the data outlives the returned object.
+  return std::make_unique<AlignedCachedData>(it->second->data,
+                                             it->second->length);
+}
+
+void ProcessWideScriptCache::Put(Isolate* isolate, DirectHandle<String> source,
+                                 const ScriptDetails& script_details,
+                                 Handle<SharedFunctionInfo> toplevel_sfi) {
+  std::string key = Key(isolate, source, script_details);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (size_ >= v8_flags.process_wide_script_cache_size * MB ||
+        entries_.contains(key)) {
+      return;
+    }
+  }
+  // Serialize without holding the lock, since this can take a while for large
+  // scripts.
+  std::unique_ptr<ScriptCompiler::CachedData> data(
+      CodeSerializer::Serialize(isolate, toplevel_sfi));
+  if (!data) return;
+  base::MutexGuard guard(&mutex_);
+  size_t size = key.size() + data->length;
+  if (entries_.emplace(std::move(key), std::move(data)).second) {
+    size_ += size;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,13 +5,20 @@
 #ifndef V8_CODEGEN_COMPILATION_CACHE_H_
 #define V8_CODEGEN_COMPILATION_CACHE_H_
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "include/v8-script.h"
 #include "src/base/hashmap.h"
+#include "src/base/platform/mutex.h"
 #include "src/objects/compilation-cache-table.h"
 #include "src/utils/allocation.h"
 
 namespace v8 {
 namespace internal {
 
+class AlignedCachedData;
 class RootVisitor;
 struct ScriptDetails;
 
@@ -236,6 +243,41 @@ class V8_EXPORT_PRIVATE CompilationCache {
   friend class Isolate;
 };
 
+// A process-wide cache of top-level scripts in the code cache format, shared
+// by all isolates of the process (see --process-wide-script-cache). Isolates
+// that don't find a script in their own CompilationCache deserialize it from
+// there instead of parsing and compiling it again. Entries are keyed by the
+// content and origin options of the source, and never evicted: once the cache
+// is full, new scripts are no longer added.
+class V8_EXPORT_PRIVATE ProcessWideScriptCache {
+ public:
+  ProcessWideScriptCache() = default;
+  ProcessWideScriptCache(const ProcessWideScriptCache&) = delete;
+  ProcessWideScriptCache& operator=(const ProcessWideScriptCache&) = delete;
+
+  static ProcessWideScriptCache* Get();
+
+  // Returns the serialized script for {source}, or nullptr if there is none.
+  std::unique_ptr<AlignedCachedData> Lookup(
+      Isolate* isolate, DirectHandle<String> source,
+      const ScriptDetails& script_details);
+
+  // Serializes the script of {toplevel_sfi}, unless the cache already contains
+  // {source} or is full.
+  void Put(Isolate* isolate, DirectHandle<String> source,
+           const ScriptDetails& script_details,
+           Handle<SharedFunctionInfo> toplevel_sfi);
+
+ private:
+  static std::string Key(Isolate* isolate, DirectHandle<String> source,
+                         const ScriptDetails& script_details);
+
+  base::Mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<ScriptCompiler::CachedData>>
+      entries_;
+  size_t size_ = 0;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -1134,7 +1134,8 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
   DCHECK_EQ(compilation_info->code_kind(), CodeKind::TURBOFAN_JS);
   DirectHandle<JSFunction> function = compilation_info->closure();
 
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable(
+          job.get())) {
     if (v8_flags.trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       ShortPrint(*function);
@@ -1706,6 +1707,13 @@ BackgroundCompileTask::BackgroundCompileTask(
   if (options & ScriptCompiler::CompileOptions::kProduceCompileHints) {
     flags_.set_produce_compile_hints(true);
   }
+  // Streamed scripts are often large bundles, whose eagerly compiled
+  // top-level functions (PIFEs, or functions marked by compile hints) can be
+  // compiled by the dispatcher on other threads, while the streaming task
+  // compiles the rest of the script.
+  if (v8_flags.parallel_compile_tasks_for_streaming) {
+    flags_.set_post_parallel_compile_tasks_for_eager_toplevel(true);
+  }
   DCHECK(is_streaming_compilation());
   if (options & ScriptCompiler::kConsumeCompileHints) {
     DCHECK_NOT_NULL(compile_hint_callback);
@@ -2908,6 +2916,15 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileFunction);
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
+  // Ages are only incremented while functions have bytecode, and are reset
+  // when they are compiled, so uncompiled functions with a non-zero age had
+  // their bytecode flushed.
+  std::optional<AggregatedHistogramTimerScope> timer_after_flush;
+  if (shared_info->age() != 0) {
+    isolate->counters()->compile_lazy_after_flush_count()->Increment();
+    timer_after_flush.emplace(
+        isolate->counters()->compile_lazy_after_flush());
+  }
 
   Handle<Script> script(Cast<Script>(shared_info->script()), isolate);
 
@@ -3983,6 +4000,22 @@ MaybeDirectHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else if (V8_UNLIKELY(v8_flags.process_wide_script_cache)) {
+      // Then check the scripts compiled by the other isolates of the process.
+      std::unique_ptr<AlignedCachedData> cached_script =
+          ProcessWideScriptCache::Get()->Lookup(isolate, source,
+                                                script_details);
+      DirectHandle<SharedFunctionInfo> result;
+      if (cached_script &&
+          CodeSerializer::Deserialize(isolate, cached_script.get(), source,
+                                      script_details, maybe_script)
+              .ToHandle(&result)) {
+        is_compiled_scope = result->is_compiled_scope(isolate);
+        if (is_compiled_scope.is_compiled()) {
+          maybe_result = result;
+          compilation_cache->PutScript(source, language_mode, result);
+        }
+      }
     }
   }
 
@@ -4023,12 +4056,18 @@ MaybeDirectHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (V8_UNLIKELY(v8_flags.process_wide_script_cache) &&
+          natives == NOT_NATIVES_CODE) {
+        ProcessWideScriptCache::Get()->Put(isolate, source, script_details,
+                                           indirect_handle(result, isolate));
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
   }
   DirectHandle<SharedFunctionInfo> result;
-  if (compile_options & ScriptCompiler::CompileOptions::kProduceCompileHints &&
+  if ((compile_options & ScriptCompiler::CompileOptions::kProduceCompileHints ||
+       v8_flags.code_cache_compile_hints) &&
       maybe_result.ToHandle(&result)) {
     Cast<Script>(result->script())->set_produce_compile_hints(true);
   }
@@ -4268,7 +4307,8 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
 
     DirectHandle<SharedFunctionInfo> result;
     if (maybe_result.ToHandle(&result)) {
-      if (task->flags().produce_compile_hints()) {
+      if (task->flags().produce_compile_hints() ||
+          v8_flags.code_cache_compile_hints) {
         Cast<Script>(result->script())->set_produce_compile_hints(true);
       }
 
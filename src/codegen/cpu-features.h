@@ -55,6 +55,9 @@ enum CpuFeature {
   PMULL1Q,
   // Half-precision NEON ops support.
   FP16,
+  // Not an ISA extension: the core executes in order (e.g. Cortex-A55), so
+  // generated code benefits from instruction scheduling.
+  IN_ORDER_CORE,
 
 #elif V8_TARGET_ARCH_MIPS64
   FPU,
@@ -64,12 +64,24 @@ const char* const
         "Load StubCache::secondary_->key",
         "Load StubCache::secondary_->value",
         "Load StubCache::secondary_->map",
+        "Load StubCache::primary_mask_",
+        "Load StubCache::secondary_mask_",
         "Store StubCache::primary_->key",
         "Store StubCache::primary_->value",
         "Store StubCache::primary_->map",
         "Store StubCache::secondary_->key",
         "Store StubCache::secondary_->value",
         "Store StubCache::secondary_->map",
+        "Store StubCache::primary_mask_",
+        "Store StubCache::secondary_mask_",
+        "DefineOwn StubCache::primary_->key",
+        "DefineOwn StubCache::primary_->value",
+        "DefineOwn StubCache::primary_->map",
+        "DefineOwn StubCache::secondary_->key",
+        "DefineOwn StubCache::secondary_->value",
+        "DefineOwn StubCache::secondary_->map",
+        "DefineOwn StubCache::primary_mask_",
+        "DefineOwn StubCache::secondary_mask_",
         // Native code counters:
         STATS_COUNTER_NATIVE_CODE_LIST(ADD_STATS_COUNTER_NAME)
 };
@@ -315,6 +327,8 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
     Add(stub_cache->key_reference(StubCache::kSecondary).address(), index);
     Add(stub_cache->value_reference(StubCache::kSecondary).address(), index);
     Add(stub_cache->map_reference(StubCache::kSecondary).address(), index);
+    Add(stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+    Add(stub_cache->mask_reference(StubCache::kSecondary).address(), index);
   }
 
   CHECK_EQ(kSizeIsolateIndependent + kExternalReferenceCountIsolateDependent +
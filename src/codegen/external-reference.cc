@@ -22,6 +22,7 @@
 #include "src/execution/simulator.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/ic/handler-configuration-inl.h"
 #include "src/ic/stub-cache.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters.h"
@@ -1453,6 +1454,8 @@ FUNCTION_REFERENCE(string_to_array_index_function, String::ToArrayIndex)
 FUNCTION_REFERENCE(array_indexof_includes_smi_or_object,
                    ArrayIndexOfIncludesSmiOrObject)
 FUNCTION_REFERENCE(array_indexof_includes_double, ArrayIndexOfIncludesDouble)
+FUNCTION_REFERENCE(array_lastindexof_smi_or_object,
+                   ArrayLastIndexOfSmiOrObject)
 
 static Address LexicographicCompareWrapper(Isolate* isolate, Address smi_x,
                                            Address smi_y) {
@@ -1623,6 +1626,23 @@ static Address InvalidatePrototypeChainsWrapper(Address raw_map) {
 FUNCTION_REFERENCE(invalidate_prototype_chains_function,
                    InvalidatePrototypeChainsWrapper)
 
+static void StubCacheAddLoadFieldHandler(Isolate* isolate, Address raw_map,
+                                         Address raw_name, intptr_t key_index) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Map> map = Cast<Map>(Tagged<Object>(raw_map));
+  Tagged<Name> name = Cast<Name>(Tagged<Object>(raw_name));
+  // Stub cache keys must not move on scavenge.
+  if (HeapLayout::InYoungGeneration(name)) return;
+  InternalIndex descriptor(key_index / DescriptorArray::kEntrySize);
+  FieldIndex field_index = FieldIndex::ForDescriptor(map, descriptor);
+  HandleScope scope(isolate);
+  isolate->load_stub_cache()->Set(
+      name, map, *LoadHandler::LoadField(isolate, field_index));
+}
+
+FUNCTION_REFERENCE(stub_cache_add_load_field_handler_function,
+                   StubCacheAddLoadFieldHandler)
+
 double modulo_double_double(double x, double y) { return Modulo(x, y); }
 
 FUNCTION_REFERENCE_WITH_TYPE(mod_two_doubles_operation, modulo_double_double,
@@ -230,6 +230,8 @@ enum class IsolateFieldId : uint8_t;
   V(search_string_raw_two_two, "search_string_raw_two_two")                    \
   V(string_write_to_flat_one_byte, "string_write_to_flat_one_byte")            \
   V(string_write_to_flat_two_byte, "string_write_to_flat_two_byte")            \
+  V(stub_cache_add_load_field_handler_function,                                \
+    "StubCache::AddLoadFieldHandler")                                          \
   V(script_context_mutable_heap_number_flag,                                   \
     "v8_flags.script_context_mutable_heap_number")                             \
   V(script_context_mutable_heap_int32_flag,                                    \
@@ -241,6 +243,7 @@ enum class IsolateFieldId : uint8_t;
   V(array_indexof_includes_smi_or_object,                                      \
     "array_indexof_includes_smi_or_object")                                    \
   V(array_indexof_includes_double, "array_indexof_includes_double")            \
+  V(array_lastindexof_smi_or_object, "array_lastindexof_smi_or_object")        \
   V(has_unpaired_surrogate, "Utf16::HasUnpairedSurrogate")                     \
   V(replace_unpaired_surrogates, "Utf16::ReplaceUnpairedSurrogates")           \
   V(try_string_to_index_or_lookup_existing,                                    \
@@ -1450,6 +1450,8 @@ enum class GarbageCollectionReason : int {
   kFinalizeConcurrentMinorMS = 26,
   kCppHeapAllocationFailure = 27,
   kFrozen = 28,
+  kIdleNotification = 29,
+  kIsolateReset = 30,
 
   NUM_REASONS,
 };
@@ -1518,6 +1520,10 @@ constexpr const char* ToString(GarbageCollectionReason reason) {
       return "CppHeap allocation failure";
     case GarbageCollectionReason::kFrozen:
       return "frozen";
+    case GarbageCollectionReason::kIdleNotification:
+      return "idle notification";
+    case GarbageCollectionReason::kIsolateReset:
+      return "isolate reset";
     case GarbageCollectionReason::NUM_REASONS:
       UNREACHABLE();
   }
@@ -1592,6 +1598,7 @@ enum class CodeFlushMode {
   kFlushBytecode,
   kFlushBaselineCode,
   kStressFlushCode,
+  kAggressiveFlushCode,
 };
 
 enum class ExternalBackingStoreType {
@@ -1617,6 +1624,10 @@ bool inline IsStressFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.contains(CodeFlushMode::kStressFlushCode);
 }
 
+bool inline IsAggressiveFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
+  return mode.contains(CodeFlushMode::kAggressiveFlushCode);
+}
+
 bool inline IsFlushingDisabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.empty();
 }
@@ -489,6 +489,8 @@ namespace internal {
   T(IntrinsicWithSpread, "Intrinsic calls do not support spread arguments")    \
   T(InvalidBase64Character,                                                    \
     "Found a character that cannot be part of a valid base64 string.")         \
+  T(InvalidHexString,                                                          \
+    "Input string must contain hex characters in even length.")                \
   T(InvalidRestBindingPattern,                                                 \
     "`...` must be followed by an identifier in declaration contexts")         \
   T(InvalidPropertyBindingPattern, "Illegal property in declaration context")  \
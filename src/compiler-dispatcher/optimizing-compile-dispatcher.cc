@@ -12,6 +12,7 @@
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate-inl.h"
+#include "src/execution/tiering-manager.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/init/v8.h"
@@ -192,23 +193,39 @@ void OptimizingCompileDispatcher::FlushOutputQueue() {
 void OptimizingCompileDispatcherQueue::Flush(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
   while (length_ > 0) {
-    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)]);
+    std::unique_ptr<TurbofanCompilationJob> job(RemoveAt(0));
     DCHECK_NOT_NULL(job);
-    shift_ = QueueIndex(1);
-    length_--;
     Compiler::DisposeTurbofanCompilationJob(isolate, job.get());
   }
 }
 
+bool OptimizingCompileDispatcherQueue::IsAvailable(int priority) {
+  base::MutexGuard access(&mutex_);
+  return length_ < capacity_ || ColdestPositionBelow(priority) >= 0;
+}
+
+bool OptimizingCompileDispatcherQueue::Enqueue(
+    std::unique_ptr<TurbofanCompilationJob>& job, int priority,
+    std::unique_ptr<TurbofanCompilationJob>* dropped) {
+  base::MutexGuard access(&mutex_);
+  if (length_ == capacity_) {
+    if (dropped == nullptr) return false;
+    int coldest = ColdestPositionBelow(priority);
+    if (coldest < 0) return false;
+    dropped->reset(RemoveAt(coldest));
+  }
+  queue_[QueueIndex(length_)] = {job.release(), priority, 0};
+  length_++;
+  return true;
+}
+
 TurbofanCompilationJob* OptimizingCompileDispatcherQueue::Dequeue(
     OptimizingCompileTaskState& task_state) {
   base::MutexGuard access(&mutex_);
   DCHECK_NULL(task_state.isolate);
   if (length_ == 0) return nullptr;
-  TurbofanCompilationJob* job = queue_[QueueIndex(0)];
+  TurbofanCompilationJob* job = DequeueAt(NextPosition());
   DCHECK_NOT_NULL(job);
-  shift_ = QueueIndex(1);
-  length_--;
   task_state.isolate = job->isolate();
   return job;
 }
@@ -217,9 +234,58 @@ TurbofanCompilationJob*
 OptimizingCompileDispatcherQueue::DequeueIfIsolateMatches(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
   if (length_ == 0) return nullptr;
-  TurbofanCompilationJob* job = queue_[QueueIndex(0)];
+  int position = NextPosition();
+  TurbofanCompilationJob* job = queue_[QueueIndex(position)].job;
   DCHECK_NOT_NULL(job);
   if (job->isolate() != isolate) return nullptr;
+  return DequeueAt(position);
+}
+
+int OptimizingCompileDispatcherQueue::NextPosition() {
+  mutex_.AssertHeld();
+  DCHECK_LT(0, length_);
+  int next = 0;
+  for (int i = 0; i < length_; ++i) {
+    const Entry& entry = queue_[QueueIndex(i)];
+    // The oldest job that was deferred too often goes first.
+    if (entry.deferrals >= kMaxDeferrals) return i;
+    if (entry.priority > queue_[QueueIndex(next)].priority) next = i;
+  }
+  return next;
+}
+
+int OptimizingCompileDispatcherQueue::ColdestPositionBelow(int priority) {
+  mutex_.AssertHeld();
+  int coldest = -1;
+  for (int i = 0; i < length_; ++i) {
+    int current = queue_[QueueIndex(i)].priority;
+    // Among jobs of the same priority, the newest one is dropped first.
+    if (current < priority &&
+        (coldest < 0 || current <= queue_[QueueIndex(coldest)].priority)) {
+      coldest = i;
+    }
+  }
+  return coldest;
+}
+
+TurbofanCompilationJob* OptimizingCompileDispatcherQueue::DequeueAt(
+    int position) {
+  for (int i = 0; i < position; ++i) {
+    queue_[QueueIndex(i)].deferrals++;
+  }
+  return RemoveAt(position);
+}
+
+TurbofanCompilationJob* OptimizingCompileDispatcherQueue::RemoveAt(
+    int position) {
+  mutex_.AssertHeld();
+  DCHECK_LE(0, position);
+  DCHECK_LT(position, length_);
+  TurbofanCompilationJob* job = queue_[QueueIndex(position)].job;
+  // Shift the older jobs up to keep the queue contiguous.
+  for (int i = position; i > 0; --i) {
+    queue_[QueueIndex(i)] = queue_[QueueIndex(i - 1)];
+  }
   shift_ = QueueIndex(1);
   length_--;
   return job;
@@ -366,7 +432,16 @@ bool OptimizingCompileDispatcher::HasJobs() {
 
 bool OptimizingCompileDispatcher::TryQueueForOptimization(
     std::unique_ptr<TurbofanCompilationJob>& job) {
-  if (input_queue_.Enqueue(job)) {
+  std::unique_ptr<TurbofanCompilationJob> dropped;
+  if (input_queue_.Enqueue(job, PriorityOf(job.get()), &dropped)) {
+    if (dropped) {
+      if (v8_flags.trace_concurrent_recompilation) {
+        PrintF("  ** Dropping compilation of ");
+        ShortPrint(*dropped->compilation_info()->closure());
+        PrintF(" in favor of a hotter function.\n");
+      }
+      Compiler::DisposeTurbofanCompilationJob(isolate_, dropped.get());
+    }
     if (job_handle_->UpdatePriorityEnabled()) {
       job_handle_->UpdatePriority(isolate_->EfficiencyModeEnabledForTiering()
                                       ? kEfficiencyTaskPriority
@@ -379,13 +454,24 @@ bool OptimizingCompileDispatcher::TryQueueForOptimization(
   }
 }
 
+int OptimizingCompileDispatcher::PriorityOf(TurbofanCompilationJob* job) {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  if (!v8_flags.concurrent_recompilation_prioritize_hot_jobs) return 0;
+  OptimizedCompilationInfo* info = job->compilation_info();
+  // Builtins jobs have no closure and keep their FIFO order.
+  if (info->closure().is_null()) return 0;
+  return TieringManager::ConcurrentCompilationPriority(*info->closure(),
+                                                       info->is_osr());
+}
+
 void OptimizingCompileDispatcherQueue::Prioritize(
     Tagged<SharedFunctionInfo> function) {
   base::MutexGuard access(&mutex_);
   if (length_ > 1) {
     for (int i = length_ - 1; i > 1; --i) {
-      if (*queue_[QueueIndex(i)]->compilation_info()->shared_info() ==
+      if (*queue_[QueueIndex(i)].job->compilation_info()->shared_info() ==
           function) {
+        queue_[QueueIndex(i)].priority = kMaxInt;
         std::swap(queue_[QueueIndex(i)], queue_[QueueIndex(0)]);
         return;
       }
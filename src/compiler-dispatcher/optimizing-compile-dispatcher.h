@@ -31,14 +31,23 @@ struct alignas(PROCESSOR_CACHE_LINE_SIZE) OptimizingCompileTaskState {
   Isolate* isolate;
 };
 
-// Circular queue of incoming recompilation tasks (including OSR).
+// Circular queue of incoming recompilation tasks (including OSR). Jobs are
+// dequeued by decreasing priority, and in FIFO order among jobs of the same
+// priority. Jobs that were passed over kMaxDeferrals times are dequeued first,
+// so that cold jobs are deferred but not starved.
 class V8_EXPORT OptimizingCompileDispatcherQueue {
  public:
+  static constexpr int kMaxDeferrals = 4;
+
   inline bool IsAvailable() {
     base::MutexGuard access(&mutex_);
     return length_ < capacity_;
   }
 
+  // Returns true if a job with {priority} can be enqueued, possibly by
+  // dropping a colder job.
+  bool IsAvailable(int priority);
+
   inline int Length() {
     base::MutexGuard access_queue(&mutex_);
     return length_;
@@ -46,7 +55,7 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
 
   explicit OptimizingCompileDispatcherQueue(int capacity)
       : capacity_(capacity), length_(0), shift_(0) {
-    queue_ = NewArray<TurbofanCompilationJob*>(capacity_);
+    queue_ = NewArray<Entry>(capacity_);
   }
 
   ~OptimizingCompileDispatcherQueue() { DeleteArray(queue_); }
@@ -54,22 +63,25 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
   TurbofanCompilationJob* Dequeue(OptimizingCompileTaskState& task_state);
   TurbofanCompilationJob* DequeueIfIsolateMatches(Isolate* isolate);
 
-  bool Enqueue(std::unique_ptr<TurbofanCompilationJob>& job) {
-    base::MutexGuard access(&mutex_);
-    if (length_ < capacity_) {
-      queue_[QueueIndex(length_)] = job.release();
-      length_++;
-      return true;
-    } else {
-      return false;
-    }
-  }
+  // Takes ownership of {job} if it could be enqueued. If the queue is full and
+  // {dropped} is not null, the coldest job is dropped in favor of {job} if
+  // {job} has a higher priority; ownership of the dropped job is passed to the
+  // caller in {dropped}.
+  bool Enqueue(std::unique_ptr<TurbofanCompilationJob>& job, int priority = 0,
+               std::unique_ptr<TurbofanCompilationJob>* dropped = nullptr);
 
   void Flush(Isolate* isolate);
 
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
  private:
+  struct Entry {
+    TurbofanCompilationJob* job;
+    int priority;
+    // The number of times that a job enqueued later was dequeued first.
+    int deferrals;
+  };
+
   inline int QueueIndex(int i) {
     int result = (i + shift_) % capacity_;
     DCHECK_LE(0, result);
@@ -77,7 +89,15 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
     return result;
   }
 
-  TurbofanCompilationJob** queue_;
+  // Returns the position of the job to dequeue next.
+  int NextPosition();
+  // Returns the position of the job to drop first, or -1 if all jobs have a
+  // priority of at least {priority}.
+  int ColdestPositionBelow(int priority);
+  TurbofanCompilationJob* DequeueAt(int position);
+  TurbofanCompilationJob* RemoveAt(int position);
+
+  Entry* queue_;
   int capacity_;
   int length_;
   int shift_;
@@ -105,6 +125,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   int InstallGeneratedBuiltins(int installed_count);
 
   inline bool IsQueueAvailable() { return input_queue_.IsAvailable(); }
+  // Returns true if {job} can be queued, possibly by dropping a colder job.
+  bool IsQueueAvailable(TurbofanCompilationJob* job) {
+    return input_queue_.IsAvailable(PriorityOf(job));
+  }
 
   static bool Enabled() { return v8_flags.concurrent_recompilation; }
 
@@ -142,6 +166,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   TurbofanCompilationJob* NextInput(OptimizingCompileTaskState& task_state);
   TurbofanCompilationJob* NextInputIfIsolateMatches(Isolate* isolate);
   void ClearTaskState(OptimizingCompileTaskState& task_state);
+  // Returns the priority of {job} in the input queue. This method must be
+  // called on the main thread.
+  int PriorityOf(TurbofanCompilationJob* job);
   bool IsTaskRunningForIsolate(Isolate* isolate);
 
   Isolate* isolate_;
@@ -2,14 +2,66 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/codegen/cpu-features.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Latencies of the instruction classes whose cost differs significantly
+// between microarchitectures.
+struct Arm64Latencies {
+  int shifted_operand;
+  int load;
+  int mul32;
+  int mul64;
+  int fp_add;
+  int fp_div32;
+  int fp_div64;
+  int fp_convert;
+};
+
+// Determined in an empirical way on out-of-order cores.
+constexpr Arm64Latencies kOutOfOrderLatencies = {
+    .shifted_operand = 3,
+    .load = 11,
+    .mul32 = 3,
+    .mul64 = 5,
+    .fp_add = 5,
+    .fp_div32 = 12,
+    .fp_div64 = 19,
+    .fp_convert = 5,
+};
+
+// Taken from the Cortex-A55 software optimization guide. The other in-order
+// cores (Cortex-A53, A510 and A520) have similar latencies for these classes.
+constexpr Arm64Latencies kInOrderLatencies = {
+    .shifted_operand = 2,
+    .load = 3,
+    .mul32 = 3,
+    .mul64 = 4,
+    .fp_add = 4,
+    .fp_div32 = 10,
+    .fp_div64 = 17,
+    .fp_convert = 4,
+};
+
+const Arm64Latencies& Latencies() {
+  return CpuFeatures::IsSupported(IN_ORDER_CORE) ? kInOrderLatencies
+                                                 : kOutOfOrderLatencies;
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+bool InstructionScheduler::CpuBenefitsFromScheduling() {
+  return CpuFeatures::IsSupported(IN_ORDER_CORE);
+}
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   switch (instr->arch_opcode()) {
@@ -412,7 +464,9 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   // Basic latency modeling for arm64 instructions. They have been determined
-  // in an empirical way.
+  // in an empirical way, except for the classes that are looked up in the
+  // table for the current microarchitecture.
+  const Arm64Latencies& latencies = Latencies();
   switch (instr->arch_opcode()) {
     case kArm64Add:
     case kArm64Add32:
@@ -439,7 +493,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Tst:
     case kArm64Tst32:
       if (instr->addressing_mode() != kMode_None) {
-        return 3;
+        return latencies.shifted_operand;
       } else {
         return 1;
       }
@@ -479,7 +533,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Ldrsb:
     case kArm64Ldrsh:
     case kArm64Ldrsw:
-      return 11;
+      return latencies.load;
 
     case kArm64Str:
     case kArm64StrD:
@@ -493,13 +547,13 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Mneg32:
     case kArm64Msub32:
     case kArm64Mul32:
-      return 3;
+      return latencies.mul32;
 
     case kArm64Madd:
     case kArm64Mneg:
     case kArm64Msub:
     case kArm64Mul:
-      return 5;
+      return latencies.mul64;
 
     case kArm64Idiv32:
     case kArm64Udiv32:
@@ -513,7 +567,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float32Sub:
     case kArm64Float64Add:
     case kArm64Float64Sub:
-      return 5;
+      return latencies.fp_add;
 
     case kArm64Float32Abs:
     case kArm64Float32Cmp:
@@ -525,11 +579,11 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
 
     case kArm64Float32Div:
     case kArm64Float32Sqrt:
-      return 12;
+      return latencies.fp_div32;
 
     case kArm64Float64Div:
     case kArm64Float64Sqrt:
-      return 19;
+      return latencies.fp_div64;
 
     case kArm64Float32RoundDown:
     case kArm64Float32RoundTiesEven:
@@ -558,7 +612,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Uint32ToFloat64:
     case kArm64Uint64ToFloat32:
     case kArm64Uint64ToFloat64:
-      return 5;
+      return latencies.fp_convert;
 
     default:
       return 2;
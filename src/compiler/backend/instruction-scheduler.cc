@@ -90,6 +90,13 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
   }
 }
 
+// static
+bool InstructionScheduler::EnabledByDefault() {
+  if (v8_flags.turbo_instruction_scheduling) return true;
+  return v8_flags.turbo_instruction_scheduling_on_in_order_cores &&
+         SchedulerSupported() && CpuBenefitsFromScheduling();
+}
+
 void InstructionScheduler::StartBlock(RpoNumber rpo) {
   DCHECK(graph_.empty());
   DCHECK_NULL(last_side_effect_instr_);
@@ -44,6 +44,10 @@ class InstructionScheduler final : public ZoneObject {
   V8_EXPORT_PRIVATE void AddTerminator(Instruction* instr);
 
   static bool SchedulerSupported();
+  // Whether instructions are scheduled unless requested otherwise, i.e. if
+  // --turbo-instruction-scheduling is passed or the current CPU benefits.
+  V8_EXPORT_PRIVATE static bool EnabledByDefault();
+
 
  private:
   // A scheduling graph node.
@@ -209,6 +213,10 @@ class InstructionScheduler final : public ZoneObject {
 
   static int GetInstructionLatency(const Instruction* instr);
 
+  // Whether the current CPU, e.g. one that executes in order, profits from
+  // scheduling enough to enable it by default.
+  static bool CpuBenefitsFromScheduling();
+
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   base::RandomNumberGenerator* random_number_generator() {
@@ -88,9 +88,9 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
       size_t* max_pushed_argument_count,
       SourcePositionMode source_position_mode = kCallSourcePositions,
       Features features = SupportedFeatures(),
-      EnableScheduling enable_scheduling = v8_flags.turbo_instruction_scheduling
-                                               ? kEnableScheduling
-                                               : kDisableScheduling,
+      EnableScheduling enable_scheduling =
+          InstructionScheduler::EnabledByDefault() ? kEnableScheduling
+                                                   : kDisableScheduling,
       EnableRootsRelativeAddressing enable_roots_relative_addressing =
           kDisableRootsRelativeAddressing,
       EnableTraceTurboJson trace_turbo = kDisableTraceTurboJson);
@@ -103,9 +103,9 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
       size_t* max_pushed_argument_count,
       SourcePositionMode source_position_mode = kCallSourcePositions,
       Features features = SupportedFeatures(),
-      EnableScheduling enable_scheduling = v8_flags.turbo_instruction_scheduling
-                                               ? kEnableScheduling
-                                               : kDisableScheduling,
+      EnableScheduling enable_scheduling =
+          InstructionScheduler::EnabledByDefault() ? kEnableScheduling
+                                                   : kDisableScheduling,
       EnableRootsRelativeAddressing enable_roots_relative_addressing =
           kDisableRootsRelativeAddressing,
       EnableTraceTurboJson trace_turbo = kDisableTraceTurboJson);
@@ -483,7 +483,7 @@ class InstructionSelectorT final : public Adapter {
           InstructionSelector::kCallSourcePositions,
       Features features = SupportedFeatures(),
       InstructionSelector::EnableScheduling enable_scheduling =
-          v8_flags.turbo_instruction_scheduling
+          InstructionScheduler::EnabledByDefault()
               ? InstructionSelector::kEnableScheduling
               : InstructionSelector::kDisableScheduling,
       InstructionSelector::EnableRootsRelativeAddressing
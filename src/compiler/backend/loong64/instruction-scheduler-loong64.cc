@@ -12,6 +12,8 @@ namespace compiler {
 // TODO(LOONG_dev): LOONG64 Support instruction scheduler.
 bool InstructionScheduler::SchedulerSupported() { return false; }
 
+bool InstructionScheduler::CpuBenefitsFromScheduling() { return false; }
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   UNREACHABLE();
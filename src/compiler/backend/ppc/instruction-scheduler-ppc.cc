@@ -10,6 +10,8 @@ namespace compiler {
 
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+bool InstructionScheduler::CpuBenefitsFromScheduling() { return false; }
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   switch (instr->arch_opcode()) {
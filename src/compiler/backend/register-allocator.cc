@@ -2921,8 +2921,16 @@ LinearScanAllocator::LinearScanAllocator(RegisterAllocationData* data,
       inactive_live_ranges_(num_registers(), InactiveLiveRangeQueue(local_zone),
                             local_zone),
       next_active_ranges_change_(LifetimePosition::Invalid()),
-      next_inactive_ranges_change_(LifetimePosition::Invalid()) {
+      next_inactive_ranges_change_(LifetimePosition::Invalid()),
+      control_flow_aware_(
+          v8_flags.turbo_control_flow_aware_allocation_limit == 0 ||
+          code()->LastInstructionIndex() <
+              v8_flags.turbo_control_flow_aware_allocation_limit) {
   active_live_ranges().reserve(8);
+  if (!control_flow_aware_) {
+    TRACE("Not control-flow aware: %d instructions\n",
+          code()->LastInstructionIndex() + 1);
+  }
 }
 
 void LinearScanAllocator::MaybeSpillPreviousRanges(LiveRange* begin_range,
@@ -3654,8 +3662,10 @@ void LinearScanAllocator::AllocateRegisters() {
 
       // When crossing a deferred/non-deferred boundary, we have to load or
       // remove the deferred fixed ranges from inactive.
-      if ((spill_mode == SpillMode::kSpillDeferred) !=
-          current_block->IsDeferred()) {
+      const bool crosses_deferred_boundary =
+          (spill_mode == SpillMode::kSpillDeferred) !=
+          current_block->IsDeferred();
+      if (crosses_deferred_boundary) {
         // Update spill mode.
         spill_mode = current_block->IsDeferred()
                          ? SpillMode::kSpillDeferred
@@ -3675,7 +3685,10 @@ void LinearScanAllocator::AllocateRegisters() {
       DCHECK_IMPLIES(!current_block->IsDeferred(),
                      HasNonDeferredPredecessor(current_block));
 
-      if (!fallthrough) {
+      // Without control-flow awareness, the state is still reconciled on
+      // deferred/non-deferred boundaries, which rely on it to undo the spills
+      // of deferred code.
+      if (!fallthrough && (control_flow_aware_ || crosses_deferred_boundary)) {
 #ifdef DEBUG
         // Allow allocation at current position.
         allocation_finger_ = next_block_boundary;
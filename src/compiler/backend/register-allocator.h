@@ -1687,6 +1687,14 @@ class LinearScanAllocator final : public RegisterAllocator {
   LifetimePosition next_active_ranges_change_;
   LifetimePosition next_inactive_ranges_change_;
 
+  // Whether the register state is reconciled with the state of the
+  // predecessors at block boundaries that are not fallthroughs. This is
+  // disabled for huge functions (see
+  // --turbo-control-flow-aware-allocation-limit), in which case moves are only
+  // inserted on those edges by the LiveRangeConnector, as in a classic linear
+  // scan.
+  const bool control_flow_aware_;
+
 #ifdef DEBUG
   LifetimePosition allocation_finger_;
 #endif
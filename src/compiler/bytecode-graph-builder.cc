@@ -3777,10 +3777,24 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 #undef DEBUG_BREAK
 
 void BytecodeGraphBuilder::VisitIncBlockCounter() {
-  Node* closure = GetFunctionClosure();
   Node* coverage_array_slot =
       jsgraph()->ConstantNoHole(bytecode_iterator().GetIndexOperand(0));
 
+  // If the coverage info already exists, embed it so that the counter is
+  // incremented without looking it up through the closure at runtime.
+  OptionalHeapObjectRef coverage_info = shared_info().coverage_info(broker());
+  if (coverage_info.has_value()) {
+    // Lowered by js-intrinsic-lowering to call
+    // Builtin::kIncCoverageInfoBlockCounter.
+    const Operator* op =
+        javascript()->CallRuntime(Runtime::kInlineIncCoverageInfoBlockCounter);
+    NewNode(op, jsgraph()->ConstantNoHole(coverage_info.value(), broker()),
+            coverage_array_slot);
+    return;
+  }
+
+  Node* closure = GetFunctionClosure();
+
   // Lowered by js-intrinsic-lowering to call Builtin::kIncBlockCounter.
   const Operator* op =
       javascript()->CallRuntime(Runtime::kInlineIncBlockCounter);
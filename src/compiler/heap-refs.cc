@@ -1754,6 +1754,23 @@ bool SharedFunctionInfoRef::HasBreakInfo(JSHeapBroker* broker) const {
   }
 }
 
+OptionalHeapObjectRef SharedFunctionInfoRef::coverage_info(
+    JSHeapBroker* broker) const {
+  Tagged<HeapObject> coverage_info;
+  if (broker->IsMainThread()) {
+    if (!object()->HasCoverageInfo(broker->isolate())) return {};
+    coverage_info = object()->GetCoverageInfo(broker->isolate());
+  } else {
+    LocalIsolate* local_isolate = broker->local_isolate();
+    SharedMutexGuardIfOffThread<LocalIsolate, base::kShared> mutex_guard(
+        local_isolate->shared_function_info_access(), local_isolate);
+    Isolate* isolate = local_isolate->GetMainThreadIsolateUnsafe();
+    if (!object()->HasCoverageInfo(isolate)) return {};
+    coverage_info = object()->GetCoverageInfo(isolate);
+  }
+  return TryMakeRef(broker, coverage_info);
+}
+
 SharedFunctionInfo::Inlineability SharedFunctionInfoRef::GetInlineability(
     JSHeapBroker* broker) const {
   return broker->IsMainThread()
@@ -1431,9 +1431,12 @@ Reduction JSCreateLowering::ReduceJSCreateObject(Node* node) {
             jsgraph()->SmiConstant(NameDictionary::kFlagsDefault));
     // Initialize the Properties fields.
     Node* undefined = jsgraph()->UndefinedConstant();
-    static_assert(NameDictionary::kElementsStartIndex ==
+    // The enum cache starts out invalid.
+    static_assert(NameDictionary::kEnumCacheIndex ==
                   NameDictionary::kFlagsIndex + 1);
-    for (int index = NameDictionary::kElementsStartIndex; index < length;
+    static_assert(NameDictionary::kElementsStartIndex ==
+                  NameDictionary::kEnumCacheIndex + 1);
+    for (int index = NameDictionary::kEnumCacheIndex; index < length;
          index++) {
       a.Store(AccessBuilder::ForFixedArraySlot(index, kNoWriteBarrier),
               undefined);
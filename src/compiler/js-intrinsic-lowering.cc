@@ -74,6 +74,8 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       return ReduceGeneratorGetResumeMode(node);
     case Runtime::kInlineIncBlockCounter:
       return ReduceIncBlockCounter(node);
+    case Runtime::kInlineIncCoverageInfoBlockCounter:
+      return ReduceIncCoverageInfoBlockCounter(node);
     case Runtime::kInlineGetImportMetaObject:
       return ReduceGetImportMetaObject(node);
     default:
@@ -355,6 +357,17 @@ Reduction JSIntrinsicLowering::ReduceIncBlockCounter(Node* node) {
                 kDoesNotNeedFrameState);
 }
 
+Reduction JSIntrinsicLowering::ReduceIncCoverageInfoBlockCounter(Node* node) {
+  DCHECK(
+      !Linkage::NeedsFrameStateInput(Runtime::kIncCoverageInfoBlockCounter));
+  DCHECK(!Linkage::NeedsFrameStateInput(
+      Runtime::kInlineIncCoverageInfoBlockCounter));
+  return Change(
+      node,
+      Builtins::CallableFor(isolate(), Builtin::kIncCoverageInfoBlockCounter),
+      0, kDoesNotNeedFrameState);
+}
+
 Reduction JSIntrinsicLowering::ReduceGetImportMetaObject(Node* node) {
   NodeProperties::ChangeOp(node, javascript()->GetImportMeta());
   return Changed(node);
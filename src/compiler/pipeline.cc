@@ -110,6 +110,7 @@
 #include "src/compiler/value-numbering-reducer.h"
 #include "src/compiler/verifier.h"
 #include "src/compiler/zone-stats.h"
+#include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/diagnostics/disassembler.h"
 #include "src/flags/flags.h"
@@ -492,15 +493,18 @@ TurbofanPipelineStatistics* CreatePipelineStatistics(
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+int HashGraphForPGO(const turboshaft::Graph* graph);
+
 // This runs instruction selection, register allocation and code generation.
 [[nodiscard]] bool GenerateCodeFromTurboshaftGraph(
     Linkage* linkage, turboshaft::Pipeline& turboshaft_pipeline,
     PipelineImpl* turbofan_pipeline = nullptr,
-    std::shared_ptr<OsrHelper> osr_helper = {}) {
+    std::shared_ptr<OsrHelper> osr_helper = {},
+    const ProfileDataFromFile* profile = nullptr) {
   turboshaft::PipelineData* turboshaft_data = turboshaft_pipeline.data();
   turboshaft_data->InitializeCodegenComponent(osr_helper);
   // Run Turboshaft instruction selection.
-  turboshaft_pipeline.PrepareForInstructionSelection();
+  turboshaft_pipeline.PrepareForInstructionSelection(profile);
   if (!turboshaft_pipeline.SelectInstructions(linkage)) return false;
   // We can release the graph now.
   turboshaft_data->ClearGraphComponent();
@@ -803,8 +807,28 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
     return FAILED;
   }
 
-  const bool success = GenerateCodeFromTurboshaftGraph(
-      linkage_, turboshaft_pipeline, &pipeline_, data_.osr_helper_ptr());
+  // With --turbo-profiling-js, the blocks of the function are profiled, and
+  // the profile of a previous compilation of the same graph (if any) provides
+  // the branch hints.
+  std::unique_ptr<ProfileDataFromFile> profile;
+  int graph_hash = 0;
+  if (V8_UNLIKELY(v8_flags.turbo_profiling_js)) {
+    UnparkedScopeIfNeeded unparked_scope(data_.broker());
+    AllowHandleDereference allow_handle_dereference;
+    graph_hash = HashGraphForPGO(&turboshaft_data_.graph());
+    if (const BasicBlockProfilerData* previous_data =
+            BasicBlockProfiler::Get()->FindData(
+                data_.info()->GetDebugName().get(), graph_hash)) {
+      profile = ProfileDataFromFile::FromBlockCounts(*previous_data);
+    }
+  }
+
+  const bool success =
+      GenerateCodeFromTurboshaftGraph(linkage_, turboshaft_pipeline, &pipeline_,
+                                      data_.osr_helper_ptr(), profile.get());
+  if (V8_UNLIKELY(v8_flags.turbo_profiling_js) && success) {
+    data_.info()->profiler_data()->SetHash(graph_hash);
+  }
   return success ? SUCCEEDED : FAILED;
 }
 
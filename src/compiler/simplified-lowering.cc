@@ -1999,6 +1999,7 @@ class RepresentationSelector {
           case CTypeInfo::Type::kPointer:
           case CTypeInfo::Type::kV8Value:
           case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kApiObject:
             return UseInfo::AnyTagged();
         }
@@ -2094,6 +2095,7 @@ class RepresentationSelector {
         SetOutput<T>(node, MachineRepresentation::kFloat64);
         return;
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
         SetOutput<T>(node, MachineRepresentation::kTagged);
         return;
       case CTypeInfo::Type::kUint32:
@@ -0,0 +1,22 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/allocation-escape-analysis-phase.h"
+
+#include "src/compiler/turboshaft/allocation-escape-analysis-reducer.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/machine-optimization-reducer.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "src/numbers/conversions-inl.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void AllocationEscapeAnalysisPhase::Run(PipelineData* data, Zone* temp_zone) {
+  turboshaft::CopyingPhase<turboshaft::AllocationEscapeAnalysisReducer,
+                           turboshaft::MachineOptimizationReducer,
+                           turboshaft::ValueNumberingReducer>::Run(data,
+                                                                   temp_zone);
+}
+
+}  // namespace v8::internal::compiler::turboshaft
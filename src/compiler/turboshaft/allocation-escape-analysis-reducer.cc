@@ -0,0 +1,192 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/allocation-escape-analysis-reducer.h"
+
+#include <algorithm>
+
+#include "src/base/container-utils.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/opmasks.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void AllocationEscapeAnalyzer::Run() {
+  CollectAllocations();
+  if (allocations_.empty()) return;
+
+  for (const Operation& op : graph_.AllOperations()) {
+    if (ShouldSkipOperation(op)) continue;
+    ProcessUse(op);
+  }
+
+  for (OpIndex alloc : allocations_) {
+    if (const VirtualObject* object = TryGetVirtualObject(alloc)) {
+      CheckInitialization(alloc, object->field_count);
+    }
+  }
+
+  for (OpIndex alloc : allocations_) {
+    if (TryGetVirtualObject(alloc) && ShouldSkipOptimizationStep()) {
+      MarkAsEscaping(alloc);
+    }
+  }
+
+  // Now that we know which allocations will be replaced by their fields, we
+  // can compute which FrameStates will need to be reconstructed in the
+  // reducer.
+  ComputeFrameStatesToReconstruct();
+}
+
+bool AllocationEscapeAnalyzer::IsTrackedFieldAccess(
+    bool tagged_base, bool is_atomic, OptionalOpIndex index,
+    MemoryRepresentation rep, int32_t offset, uint32_t field_count) {
+  return tagged_base && !is_atomic && !index.valid() &&
+         rep.IsCompressibleTagged() && offset >= 0 &&
+         offset % kTaggedSize == 0 &&
+         static_cast<uint32_t>(offset / kTaggedSize) < field_count;
+}
+
+// Collects the allocations of constant size, which are the candidates for
+// scalar replacement.
+void AllocationEscapeAnalyzer::CollectAllocations() {
+  OperationMatcher matcher(graph_);
+  for (OpIndex index : graph_.AllOperationIndices()) {
+    const Operation& op = graph_.Get(index);
+    if (ShouldSkipOperation(op)) continue;
+    if (const FrameStateOp* frame_state = op.TryCast<FrameStateOp>()) {
+      // Over-approximates the ids of the objects that are already
+      // dematerialized, since {int_operands} also contains other operands.
+      for (uint32_t operand : frame_state->data->int_operands) {
+        next_object_id_ = std::max(next_object_id_, operand + 1);
+      }
+    } else if (const AllocateOp* alloc = op.TryCast<AllocateOp>()) {
+      intptr_t size;
+      if (!matcher.MatchIntegralWordPtrConstant(alloc->size(), &size) ||
+          size <= 0 || size % kTaggedSize != 0 ||
+          size > intptr_t{kMaxFieldCount} * kTaggedSize) {
+        continue;
+      }
+      allocations_.push_back(index);
+      virtual_objects_[index].field_count =
+          static_cast<uint32_t>(size / kTaggedSize);
+    }
+  }
+  for (OpIndex alloc : allocations_) {
+    virtual_objects_[alloc].id = next_object_id_++;
+  }
+}
+
+// Marks the allocations used by {op} as escaping, unless {op} is a tracked
+// access to one of their fields or a FrameState.
+void AllocationEscapeAnalyzer::ProcessUse(const Operation& op) {
+  switch (op.opcode) {
+    case Opcode::kStore: {
+      const StoreOp& store = op.Cast<StoreOp>();
+      // A StoreOp only makes an allocation escape if it writes the allocation,
+      // not if it writes to the allocation.
+      MarkAsEscaping(store.value());
+      if (store.index().valid()) MarkAsEscaping(store.index().value());
+      if (const VirtualObject* object = TryGetVirtualObject(store.base())) {
+        if (!IsTrackedFieldAccess(store.kind.tagged_base, store.kind.is_atomic,
+                                  store.index(), store.stored_rep,
+                                  store.offset, object->field_count)) {
+          MarkAsEscaping(store.base());
+        }
+      }
+      return;
+    }
+    case Opcode::kLoad: {
+      const LoadOp& load = op.Cast<LoadOp>();
+      if (load.index().valid()) MarkAsEscaping(load.index().value());
+      if (const VirtualObject* object = TryGetVirtualObject(load.base())) {
+        if (!IsTrackedFieldAccess(load.kind.tagged_base, load.kind.is_atomic,
+                                  load.index(), load.loaded_rep, load.offset,
+                                  object->field_count)) {
+          MarkAsEscaping(load.base());
+        }
+      }
+      return;
+    }
+    case Opcode::kFrameState:
+      ProcessFrameState(op.Cast<FrameStateOp>());
+      return;
+    default:
+      // By default, all uses are considered as escaping their inputs.
+      for (OpIndex input : op.inputs()) {
+        MarkAsEscaping(input);
+      }
+      return;
+  }
+}
+
+void AllocationEscapeAnalyzer::ProcessFrameState(
+    const FrameStateOp& frame_state) {
+  // Like for string concatenations, the Function and the Receiver are never
+  // dematerialized. See https://crbug.com/40059369.
+  auto it = frame_state.data->iterator(frame_state.state_values());
+  for (int i = 0; i < 2 && it.has_more(); ++i) {
+    if (it.current_instr() != FrameStateData::Instr::kInput) return;
+    MachineType type;
+    OpIndex input;
+    it.ConsumeInput(&type, &input);
+    MarkAsEscaping(input);
+  }
+
+  // Other FrameState uses are not considered as escaping.
+}
+
+// Checks that all fields of {alloc} are initialized by the stores that follow
+// it in its block, before any other use. This guarantees that the Variables
+// of the fields are always set when they are read.
+void AllocationEscapeAnalyzer::CheckInitialization(OpIndex alloc,
+                                                   uint32_t field_count) {
+  static_assert(kMaxFieldCount < 64);
+  const uint64_t all_fields = (uint64_t{1} << field_count) - 1;
+  uint64_t initialized_fields = 0;
+  const Block& block = graph_.Get(graph_.BlockIndexOf(alloc));
+  for (OpIndex index = graph_.NextIndex(alloc); index != block.end();
+       index = graph_.NextIndex(index)) {
+    const Operation& op = graph_.Get(index);
+    if (ShouldSkipOperation(op) || !base::contains(op.inputs(), alloc)) {
+      continue;
+    }
+    const StoreOp* store = op.TryCast<StoreOp>();
+    if (!store) break;
+    DCHECK_EQ(store->base(), alloc);
+    int field = store->offset / kTaggedSize;
+    // The deoptimizer requires the map of dematerialized objects to be known.
+    if (field == HeapObject::kMapOffset / kTaggedSize &&
+        !graph_.Get(store->value()).Is<Opmask::kHeapConstant>()) {
+      break;
+    }
+    initialized_fields |= uint64_t{1} << field;
+    if (initialized_fields == all_fields) return;
+  }
+  MarkAsEscaping(alloc);
+}
+
+void AllocationEscapeAnalyzer::ComputeFrameStatesToReconstruct() {
+  for (OpIndex index : graph_.AllOperationIndices()) {
+    const FrameStateOp* frame_state =
+        graph_.Get(index).TryCast<FrameStateOp>();
+    if (!frame_state || ShouldSkipOperation(*frame_state)) continue;
+    // Parent FrameStates are always visited before their children.
+    bool reconstruct =
+        frame_state->inlined &&
+        frame_states_to_reconstruct_[frame_state->parent_frame_state()];
+    for (OpIndex input : frame_state->state_values()) {
+      if (TryGetVirtualObject(input)) {
+        reconstruct = true;
+        break;
+      }
+    }
+    frame_states_to_reconstruct_[index] = reconstruct;
+  }
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,298 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_ALLOCATION_ESCAPE_ANALYSIS_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_ALLOCATION_ESCAPE_ANALYSIS_REDUCER_H_
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+// AllocationEscapeAnalysisReducer replaces allocations that don't escape by
+// their fields ("scalar replacement"): stores to such an allocation update a
+// Variable per field, and loads from it read the current value of the
+// Variable. Since the VariableReducer inserts phis for Variables at merges and
+// loop headers, field values are forwarded across control flow.
+//
+// An allocation is considered as non-escaping (or "virtual") if:
+//   - its size is constant and small enough to be tracked,
+//   - all of its fields are tagged and initialized in the block of the
+//     allocation before any other use (the map with a constant),
+//   - and it's only used as the base of tagged loads and stores at constant
+//     offsets, or as an input of FrameStates.
+// FrameStates that contain virtual allocations (or whose parents do) are
+// rebuilt with dematerialized objects, using the field values at the position
+// of the FrameState, so that the deoptimizer materializes them lazily. Note
+// that our graph builders emit FrameStates right before their users, which
+// means that these are also the field values at the deoptimization point.
+//
+// Allocations that are merged by phis or stored into other objects are
+// considered as escaping: this could be relaxed by tracking pointers to
+// virtual objects in Variables too, but keeps the reconstruction of
+// FrameStates simple (dematerialized objects only have non-virtual fields).
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class AllocationEscapeAnalyzer {
+ public:
+  // Limits the number of Variables (and of FrameState inputs) introduced per
+  // allocation.
+  static constexpr uint32_t kMaxFieldCount = 32;
+
+  struct VirtualObject {
+    uint32_t id;
+    uint32_t field_count;
+  };
+
+  AllocationEscapeAnalyzer(const Graph& graph, Zone* phase_zone)
+      : graph_(graph),
+        zone_(phase_zone),
+        virtual_objects_(phase_zone, &graph),
+        frame_states_to_reconstruct_(graph.op_id_count(), false, phase_zone,
+                                     &graph) {}
+
+  void Run();
+
+  const VirtualObject* TryGetVirtualObject(OpIndex index) const {
+    const VirtualObject* object;
+    if (virtual_objects_.contains(index, &object)) return object;
+    return nullptr;
+  }
+
+  bool ShouldReconstructFrameState(V<FrameState> index) const {
+    return frame_states_to_reconstruct_[index];
+  }
+
+  // Returns true if an access with these parameters to an allocation with
+  // {field_count} fields reads or writes exactly one tracked field.
+  static bool IsTrackedFieldAccess(bool tagged_base, bool is_atomic,
+                                   OptionalOpIndex index,
+                                   MemoryRepresentation rep, int32_t offset,
+                                   uint32_t field_count);
+
+ private:
+  void CollectAllocations();
+  void ProcessUse(const Operation& op);
+  void ProcessFrameState(const FrameStateOp& frame_state);
+  void CheckInitialization(OpIndex alloc, uint32_t field_count);
+  void ComputeFrameStatesToReconstruct();
+
+  void MarkAsEscaping(OpIndex index) { virtual_objects_.remove(index); }
+
+  const Graph& graph_;
+  Zone* zone_;
+
+  // Candidate allocations, from which escaping ones are removed during the
+  // analysis.
+  SparseOpIndexSideTable<VirtualObject> virtual_objects_;
+  ZoneVector<OpIndex> allocations_{zone_};
+
+  // FrameStates that contain virtual objects, or whose parent FrameStates do.
+  FixedOpIndexSidetable<bool> frame_states_to_reconstruct_;
+
+  // The ids of the virtual objects must not conflict with the ids of the
+  // objects that the FrameStates already describe.
+  uint32_t next_object_id_ = 0;
+};
+
+template <class Next>
+class AllocationEscapeAnalysisReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(AllocationEscapeAnalysis)
+
+  void Analyze() {
+    analyzer_.Run();
+    Next::Analyze();
+  }
+
+  V<HeapObject> REDUCE_INPUT_GRAPH(Allocate)(V<HeapObject> ig_index,
+                                             const AllocateOp& op) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceInputGraphAllocate(ig_index, op);
+    }
+    const VirtualObject* object = analyzer_.TryGetVirtualObject(ig_index);
+    if (!object) goto no_change;
+
+    // The fields are initialized by the stores that follow the allocation. The
+    // Variables are reused if the allocation is visited several times.
+    if (!fields_.contains(ig_index)) {
+      base::Vector<Variable> fields =
+          __ phase_zone()->template NewVector<Variable>(object->field_count);
+      for (Variable& field : fields) {
+        field = __ NewVariable(RegisterRepresentation::Tagged());
+      }
+      fields_[ig_index] = fields;
+    }
+    return V<HeapObject>::Invalid();
+  }
+
+  V<None> REDUCE_INPUT_GRAPH(Store)(V<None> ig_index, const StoreOp& op) {
+    if (analyzer_.TryGetVirtualObject(op.base())) {
+      __ SetVariable(GetField(op.base(), op.offset),
+                     __ MapToNewGraph(op.value()));
+      return V<None>::Invalid();
+    }
+    return Next::ReduceInputGraphStore(ig_index, op);
+  }
+
+  V<Any> REDUCE_INPUT_GRAPH(Load)(V<Any> ig_index, const LoadOp& op) {
+    if (analyzer_.TryGetVirtualObject(op.base())) {
+      return V<Any>::Cast(__ GetVariable(GetField(op.base(), op.offset)));
+    }
+    return Next::ReduceInputGraphLoad(ig_index, op);
+  }
+
+  V<FrameState> REDUCE_INPUT_GRAPH(FrameState)(
+      V<FrameState> ig_index, const FrameStateOp& frame_state) {
+    if (!analyzer_.ShouldReconstructFrameState(ig_index)) {
+      return Next::ReduceInputGraphFrameState(ig_index, frame_state);
+    }
+    ZoneAbslFlatHashSet<uint32_t> emitted_ids(__ phase_zone());
+    return BuildFrameState(frame_state, emitted_ids);
+  }
+
+ private:
+  using VirtualObject = AllocationEscapeAnalyzer::VirtualObject;
+
+  Variable GetField(OpIndex alloc, int32_t offset) {
+    DCHECK_EQ(offset % kTaggedSize, 0);
+    return fields_[alloc][offset / kTaggedSize];
+  }
+
+  // Rebuilds {frame_state} (and its parents if needed) with the current values
+  // of the fields of the virtual objects. {emitted_ids} contains the ids of the
+  // virtual objects that are already fully described by the parent
+  // FrameStates: the deoptimizer visits the outermost FrameState first.
+  V<FrameState> BuildFrameState(const FrameStateOp& frame_state,
+                                ZoneAbslFlatHashSet<uint32_t>& emitted_ids) {
+    FrameStateData::Builder builder;
+    if (frame_state.inlined) {
+      V<FrameState> parent = frame_state.parent_frame_state();
+      if (analyzer_.ShouldReconstructFrameState(parent)) {
+        builder.AddParentFrameState(BuildFrameState(
+            __ input_graph().Get(parent).template Cast<FrameStateOp>(),
+            emitted_ids));
+      } else {
+        builder.AddParentFrameState(__ MapToNewGraph(parent));
+      }
+    }
+
+    auto it = frame_state.data->iterator(frame_state.state_values());
+    while (it.has_more()) {
+      BuildFrameStateInput(&builder, &it, emitted_ids);
+    }
+
+    return __ FrameState(
+        builder.Inputs(), builder.inlined(),
+        builder.AllocateFrameStateData(frame_state.data->frame_state_info,
+                                       __ graph_zone()));
+  }
+
+  void BuildFrameStateInput(FrameStateData::Builder* builder,
+                            FrameStateData::Iterator* it,
+                            ZoneAbslFlatHashSet<uint32_t>& emitted_ids) {
+    switch (it->current_instr()) {
+      using Instr = FrameStateData::Instr;
+      case Instr::kInput: {
+        MachineType type;
+        OpIndex input;
+        it->ConsumeInput(&type, &input);
+        if (const VirtualObject* object =
+                analyzer_.TryGetVirtualObject(input)) {
+          DCHECK(type.IsTagged());
+          BuildVirtualObject(builder, input, *object, emitted_ids);
+        } else {
+          builder->AddInput(type, __ MapToNewGraph(input));
+        }
+        break;
+      }
+      case Instr::kDematerializedObject: {
+        uint32_t id;
+        uint32_t field_count;
+        it->ConsumeDematerializedObject(&id, &field_count);
+        builder->AddDematerializedObject(id, field_count);
+        for (uint32_t i = 0; i < field_count; ++i) {
+          BuildFrameStateInput(builder, it, emitted_ids);
+        }
+        break;
+      }
+      case Instr::kDematerializedObjectReference: {
+        uint32_t id;
+        it->ConsumeDematerializedObjectReference(&id);
+        builder->AddDematerializedObjectReference(id);
+        break;
+      }
+      case Instr::kDematerializedStringConcat: {
+        uint32_t id;
+        it->ConsumeDematerializedStringConcat(&id);
+        builder->AddDematerializedStringConcat(id);
+        // Left and right sides of the concatenation.
+        BuildFrameStateInput(builder, it, emitted_ids);
+        BuildFrameStateInput(builder, it, emitted_ids);
+        break;
+      }
+      case Instr::kDematerializedStringConcatReference: {
+        uint32_t id;
+        it->ConsumeDematerializedStringConcatReference(&id);
+        builder->AddDematerializedStringConcatReference(id);
+        break;
+      }
+      case Instr::kArgumentsElements: {
+        CreateArgumentsType type;
+        it->ConsumeArgumentsElements(&type);
+        builder->AddArgumentsElements(type);
+        break;
+      }
+      case Instr::kArgumentsLength:
+        it->ConsumeArgumentsLength();
+        builder->AddArgumentsLength();
+        break;
+      case Instr::kRestLength:
+        it->ConsumeRestLength();
+        builder->AddRestLength();
+        break;
+      case Instr::kUnusedRegister:
+        it->ConsumeUnusedRegister();
+        builder->AddUnusedRegister();
+        break;
+    }
+  }
+
+  void BuildVirtualObject(FrameStateData::Builder* builder, OpIndex alloc,
+                          const VirtualObject& object,
+                          ZoneAbslFlatHashSet<uint32_t>& emitted_ids) {
+    // Unlike for string concatenations, references to already described
+    // objects are required for correctness: the deoptimizer must materialize
+    // a single object.
+    if (!emitted_ids.insert(object.id).second) {
+      builder->AddDematerializedObjectReference(object.id);
+      return;
+    }
+    builder->AddDematerializedObject(object.id, object.field_count);
+    for (Variable field : fields_[alloc]) {
+      // Virtual objects are never stored in other objects, so the fields are
+      // never virtual themselves.
+      OpIndex value = __ GetVariable(field);
+      DCHECK(value.valid());
+      builder->AddInput(MachineType::AnyTagged(), value);
+    }
+  }
+
+  AllocationEscapeAnalyzer analyzer_{Asm().input_graph(), Asm().phase_zone()};
+
+  // The Variables holding the fields of the virtual objects.
+  SparseOpIndexSideTable<base::Vector<Variable>> fields_{Asm().phase_zone(),
+                                                         &Asm().input_graph()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_ALLOCATION_ESCAPE_ANALYSIS_REDUCER_H_
@@ -0,0 +1,366 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include <optional>
+#include <tuple>
+
+#include "src/base/logging.h"
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/layered-hash-map.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/representations.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+#ifdef DEBUG
+#define TRACE(x)                                              \
+  do {                                                        \
+    if (v8_flags.turboshaft_trace_bounds_check_elimination) { \
+      StdoutStream() << x << std::endl;                       \
+    }                                                         \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+// BoundsCheckElimination removes bounds checks (ie, `DeoptimizeIfNot(index <u
+// length)`) that are implied by comparisons dominating them. Like
+// BranchElimination, it walks the dominator tree and records, for each block,
+// the facts `index <u length` that hold in it. These facts come from:
+//
+//   - previous bounds checks: once `DeoptimizeIfNot(index <u length)` has been
+//     passed, `index <u length` holds in the rest of the dominator subtree.
+//   - branches: in the successor of `Branch(index <u length)` in which the
+//     condition is true, or in the successor of `Branch(index <s length)` if
+//     {index} is known to be non-negative.
+//
+// To know that an index is non-negative, loop phis are analyzed in the input
+// graph: a phi of a loop header that starts at a non-negative constant, is
+// incremented by 1 on the backedge, and for which the loop header branches on
+// `phi <s bound` (with the increment only reachable when this is true) can
+// never become negative. This takes care of the typical
+// `for (let i = 0; i < a.length; i++) a[i]` loop, whose bounds check is implied
+// by the loop condition.
+//
+// Since facts relate SSA values, they also hold inside of loops when they are
+// established before the loop; BoundsCheckElimination thus also removes
+// bounds checks that LoopInvariantCodeMotion has hoisted out of loops from
+// copies of the same check remaining in the loop body.
+template <class Next>
+class BoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(BoundsCheckElimination)
+
+  void Bind(Block* new_block) {
+    Next::Bind(new_block);
+
+    // Update {known_facts_} based on where {new_block} is in the dominator
+    // tree.
+    ResetToBlock(new_block);
+    ReplayMissingPredecessors(new_block);
+    StartLayer(new_block);
+    RecordBranchTargetFact(new_block);
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Phi)(OpIndex ig_index, const PhiOp& phi) {
+    OpIndex og_index = Next::ReduceInputGraphPhi(ig_index, phi);
+    if (og_index.valid() && IsNonNegativeInductionVariable(ig_index, phi)) {
+      TRACE("BCE: " << ig_index << " is a non-negative induction variable");
+      non_negative_phis_.insert(og_index);
+    }
+    return og_index;
+  }
+
+  V<None> REDUCE(DeoptimizeIf)(V<Word32> condition, V<FrameState> frame_state,
+                               bool negated,
+                               const DeoptimizeParameters* parameters) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceDeoptimizeIf(condition, frame_state, negated,
+                                      parameters);
+    }
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    // When execution continues after the DeoptimizeIf, {condition} is equal to
+    // {negated}.
+    std::optional<Fact> fact =
+        FactImpliedBy(condition, negated, /*allow_signed*/ false);
+    if (!fact.has_value()) goto no_change;
+    if (known_facts_.Contains(*fact)) {
+      TRACE("BCE: removing redundant check of " << condition);
+      return V<None>::Invalid();
+    }
+    known_facts_.InsertNewKey(*fact, true);
+    goto no_change;
+  }
+
+ private:
+  // A triple (index, length, rep) representing `index <u length` for values of
+  // representation {rep}.
+  using Fact = std::tuple<OpIndex, OpIndex, RegisterRepresentation::Enum>;
+
+  // Returns the fact that holds when {condition} evaluates to {value}, if
+  // {condition} is a comparison that implies `index <u length`. Signed
+  // comparisons are only taken into account if {allow_signed} is true, since
+  // `index <u length` doesn't imply that `index <s length`: they can be used
+  // to record facts, but a signed check can't be removed based on an
+  // unsigned fact.
+  std::optional<Fact> FactImpliedBy(V<Word32> condition, bool value,
+                                    bool allow_signed) {
+    const ComparisonOp* comparison =
+        __ output_graph().Get(condition).template TryCast<ComparisonOp>();
+    if (!comparison) return std::nullopt;
+    RegisterRepresentation rep = comparison->rep;
+    if (rep != RegisterRepresentation::Word32() &&
+        rep != RegisterRepresentation::Word64()) {
+      return std::nullopt;
+    }
+    OpIndex left = comparison->left();
+    OpIndex right = comparison->right();
+    switch (comparison->kind) {
+      case ComparisonOp::Kind::kUnsignedLessThan:
+        // left <u right
+        if (value) return Fact{left, right, rep.value()};
+        return std::nullopt;
+      case ComparisonOp::Kind::kUnsignedLessThanOrEqual:
+        // !(left <=u right) => right <u left
+        if (!value) return Fact{right, left, rep.value()};
+        return std::nullopt;
+      case ComparisonOp::Kind::kSignedLessThan:
+        // left <s right && left >= 0 => left <u right
+        if (allow_signed && value && IsNonNegative(left, rep)) {
+          return Fact{left, right, rep.value()};
+        }
+        return std::nullopt;
+      case ComparisonOp::Kind::kSignedLessThanOrEqual:
+        // !(left <=s right) && right >= 0 => right <u left
+        if (allow_signed && !value && IsNonNegative(right, rep)) {
+          return Fact{right, left, rep.value()};
+        }
+        return std::nullopt;
+      case ComparisonOp::Kind::kEqual:
+        return std::nullopt;
+    }
+  }
+
+  // Returns true if {index} (in the output graph) is known to be a
+  // non-negative value of representation {rep}.
+  bool IsNonNegative(OpIndex index, RegisterRepresentation rep,
+                     int depth = 0) {
+    static constexpr int kMaxDepth = 4;
+    if (depth > kMaxDepth) return false;
+    const Operation& op = __ output_graph().Get(index);
+    if (const ConstantOp* cst = op.TryCast<ConstantOp>()) {
+      if (cst->kind == ConstantOp::Kind::kWord32) {
+        return rep == RegisterRepresentation::Word32() &&
+               cst->signed_integral() >= 0;
+      }
+      if (cst->kind == ConstantOp::Kind::kWord64) {
+        return rep == RegisterRepresentation::Word64() &&
+               cst->signed_integral() >= 0;
+      }
+      return false;
+    }
+    if (op.Is<PhiOp>() || op.Is<PendingLoopPhiOp>()) {
+      return rep == RegisterRepresentation::Word32() &&
+             non_negative_phis_.contains(index);
+    }
+    if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+      if (change->to != rep ||
+          change->from != RegisterRepresentation::Word32()) {
+        return false;
+      }
+      if (change->kind == ChangeOp::Kind::kZeroExtend) return true;
+      if (change->kind == ChangeOp::Kind::kSignExtend) {
+        return IsNonNegative(change->input(), change->from, depth + 1);
+      }
+      return false;
+    }
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      if (binop->rep != rep) return false;
+      if (binop->kind == WordBinopOp::Kind::kBitwiseAnd) {
+        return IsNonNegative(binop->left(), rep, depth + 1) ||
+               IsNonNegative(binop->right(), rep, depth + 1);
+      }
+      return false;
+    }
+    return false;
+  }
+
+  // Returns true if {phi} (in the input graph) is a loop phi that starts at a
+  // non-negative constant, is incremented by 1 on each iteration, and such
+  // that the increment only happens when `phi <s bound` holds, which
+  // guarantees that the increment doesn't overflow.
+  bool IsNonNegativeInductionVariable(OpIndex ig_index, const PhiOp& phi) {
+    const Graph& graph = __ input_graph();
+    const Block& header = graph.Get(graph.BlockIndexOf(ig_index));
+    if (!header.IsLoop() || phi.input_count != 2 ||
+        phi.rep != RegisterRepresentation::Word32()) {
+      return false;
+    }
+
+    // The 1st input of loop phis is the forward edge.
+    const ConstantOp* init =
+        graph.Get(phi.input(0)).template TryCast<ConstantOp>();
+    if (!init || init->kind != ConstantOp::Kind::kWord32 ||
+        init->signed_integral() < 0) {
+      return false;
+    }
+
+    OpIndex increment = phi.input(PhiOp::kLoopPhiBackEdgeIndex);
+    if (!IsIncrementByOne(increment, ig_index)) return false;
+
+    // The loop header should branch on `phi <s bound`, and the increment
+    // should only be reachable from the successor in which this holds.
+    const BranchOp* branch =
+        header.LastOperation(graph).template TryCast<BranchOp>();
+    if (!branch) return false;
+    const ComparisonOp* comparison =
+        graph.Get(branch->condition()).template TryCast<ComparisonOp>();
+    if (!comparison || comparison->rep != RegisterRepresentation::Word32()) {
+      return false;
+    }
+    const Block* in_bounds_successor;
+    if (comparison->kind == ComparisonOp::Kind::kSignedLessThan &&
+        comparison->left() == ig_index) {
+      in_bounds_successor = branch->if_true;
+    } else if (comparison->kind ==
+                   ComparisonOp::Kind::kSignedLessThanOrEqual &&
+               comparison->right() == ig_index) {
+      in_bounds_successor = branch->if_false;
+    } else {
+      return false;
+    }
+    // {in_bounds_successor} has a single predecessor (the loop header), so if
+    // it dominates the increment, then the increment is only computed after
+    // the loop header has checked that `phi <s bound`.
+    DCHECK_EQ(in_bounds_successor->PredecessorCount(), 1);
+    const Block& increment_block = graph.Get(graph.BlockIndexOf(increment));
+    return increment_block.IsDominatedBy(in_bounds_successor);
+  }
+
+  // Returns true if {index} (in the input graph) is `phi + 1`, either as a
+  // regular or an overflow-checked addition.
+  bool IsIncrementByOne(OpIndex index, OpIndex phi) {
+    const Graph& graph = __ input_graph();
+    const Operation& op = graph.Get(index);
+    OpIndex left, right;
+    if (const WordBinopOp* add = op.TryCast<WordBinopOp>()) {
+      if (add->kind != WordBinopOp::Kind::kAdd ||
+          add->rep != WordRepresentation::Word32()) {
+        return false;
+      }
+      left = add->left();
+      right = add->right();
+    } else if (const ProjectionOp* projection = op.TryCast<ProjectionOp>()) {
+      if (projection->index != OverflowCheckedBinopOp::kValueIndex) {
+        return false;
+      }
+      const OverflowCheckedBinopOp* add =
+          graph.Get(projection->input())
+              .template TryCast<OverflowCheckedBinopOp>();
+      if (!add || add->kind != OverflowCheckedBinopOp::Kind::kSignedAdd ||
+          add->rep != WordRepresentation::Word32()) {
+        return false;
+      }
+      left = add->left();
+      right = add->right();
+    } else {
+      return false;
+    }
+    if (right == phi) std::swap(left, right);
+    if (left != phi) return false;
+    const ConstantOp* step = graph.Get(right).template TryCast<ConstantOp>();
+    return step && step->kind == ConstantOp::Kind::kWord32 &&
+           step->word32() == 1;
+  }
+
+  // If {block} is a branch target, records the fact that is implied by the
+  // branch condition.
+  void RecordBranchTargetFact(Block* block) {
+    if (!block->IsBranchTarget()) return;
+    DCHECK_EQ(block->PredecessorCount(), 1);
+    const BranchOp* branch =
+        block->LastPredecessor()
+            ->LastOperation(__ output_graph())
+            .template TryCast<BranchOp>();
+    if (!branch) return;
+    DCHECK(branch->if_true->index() == block->index() ||
+           branch->if_false->index() == block->index());
+    bool condition_value = branch->if_true->index().valid()
+                               ? branch->if_true->index() == block->index()
+                               : branch->if_false->index() != block->index();
+    std::optional<Fact> fact = FactImpliedBy(
+        branch->condition(), condition_value, /*allow_signed*/ true);
+    if (fact.has_value() && !known_facts_.Contains(*fact)) {
+      known_facts_.InsertNewKey(*fact, true);
+    }
+  }
+
+  // Resets {known_facts_} and {dominator_path_} up to the 1st dominator of
+  // {block} that they contain.
+  void ResetToBlock(Block* block) {
+    Block* target = block->GetDominator();
+    while (!dominator_path_.empty() && target != nullptr &&
+           dominator_path_.back() != target) {
+      if (dominator_path_.back()->Depth() > target->Depth()) {
+        ClearCurrentEntries();
+      } else if (dominator_path_.back()->Depth() < target->Depth()) {
+        target = target->GetDominator();
+      } else {
+        ClearCurrentEntries();
+        target = target->GetDominator();
+      }
+    }
+  }
+
+  void ClearCurrentEntries() {
+    known_facts_.DropLastLayer();
+    dominator_path_.pop_back();
+  }
+
+  void StartLayer(Block* block) {
+    known_facts_.StartLayer();
+    dominator_path_.push_back(block);
+  }
+
+  // Adds the dominators of {new_block} that are not in {dominator_path_} (see
+  // BranchEliminationReducer::ReplayMissingPredecessors for when this
+  // happens). Only the facts implied by branches can be replayed; those of
+  // bounds checks in these blocks are lost, which is conservative.
+  void ReplayMissingPredecessors(Block* new_block) {
+    base::SmallVector<Block*, 32> missing_blocks;
+    for (Block* dom = new_block->GetDominator();
+         dom != nullptr &&
+         (dominator_path_.empty() || dom != dominator_path_.back());
+         dom = dom->GetDominator()) {
+      missing_blocks.push_back(dom);
+    }
+    for (auto it = missing_blocks.rbegin(); it != missing_blocks.rend(); ++it) {
+      StartLayer(*it);
+      RecordBranchTargetFact(*it);
+    }
+  }
+
+  ZoneVector<Block*> dominator_path_{__ phase_zone()};
+  LayeredHashMap<Fact, bool> known_facts_{
+      __ phase_zone(), __ input_graph().op_id_count() / 8};
+  ZoneAbslFlatHashSet<OpIndex> non_negative_phis_{__ phase_zone()};
+};
+
+#undef TRACE
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
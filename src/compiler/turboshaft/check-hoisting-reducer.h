@@ -0,0 +1,283 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_CHECK_HOISTING_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_CHECK_HOISTING_REDUCER_H_
+
+#include <algorithm>
+
+#include "src/base/logging.h"
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/compiler/turboshaft/uniform-reducer-adapter.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+#ifdef DEBUG
+#define TRACE(x)                                  \
+  do {                                            \
+    if (v8_flags.turboshaft_trace_check_hoisting) \
+      StdoutStream() << x << std::endl;           \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+// CheckHoisting removes checks (ie, DeoptimizeIfs) that are fully redundant on
+// the two arms of a diamond: when both successors of a Branch start with
+// checks of structurally equal conditions, the check is emitted once right
+// before the Branch (together with the computation of its condition), and
+// removed from both successors. This is complementary to ValueNumbering and
+// BranchElimination, which only remove checks that are dominated by an
+// identical one.
+//
+// A check can only be hoisted to the end of the block of the Branch if there
+// is a frame state to deoptimize with there: we reuse the frame state of the
+// last DeoptimizeIf of this block, provided that no operation writes to memory
+// between this DeoptimizeIf and the hoisted check. Deoptimizing with this frame
+// state simply re-executes the side-effect free operations in between in the
+// interpreter. For the same reason, only checks that come before any write in
+// the successors are considered.
+//
+// The conditions of the checks are compared structurally: their operations
+// should either be the same (and thus defined before the Branch), or be
+// identical operations of the successors with structurally equal inputs. Only
+// a prefix of the checks of the true successor is hoisted, so that its
+// operations that depend on checks (like loads) stay after them.
+template <class Next>
+class CheckHoistingReducer
+    : public UniformReducerAdapter<CheckHoistingReducer, Next> {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(CheckHoisting)
+
+  using Adapter = UniformReducerAdapter<CheckHoistingReducer, Next>;
+
+  V<None> REDUCE_INPUT_GRAPH(Branch)(V<None> ig_idx, const BranchOp& branch) {
+    if (!ShouldSkipOptimizationStep()) {
+      HoistCommonChecks(branch);
+      // One of the hoisted checks always deopts.
+      if (__ current_block() == nullptr) return {};
+      // Hoisting operations changed the current origins.
+      __ SetCurrentOrigin(ig_idx);
+      __ current_block()->SetOrigin(__ current_input_block());
+    }
+    return Next::ReduceInputGraphBranch(ig_idx, branch);
+  }
+
+  template <typename Op, typename Continuation>
+  OpIndex ReduceInputGraphOperation(OpIndex ig_index, const Op& op) {
+    switch (state_[ig_index]) {
+      case HoistingState::kHoisted:
+        // The operation has already been emitted before the Branch, and its
+        // mapping has been recorded then.
+        return OpIndex::Invalid();
+      case HoistingState::kRemoved:
+        // The check is redundant with a hoisted check.
+        return OpIndex::Invalid();
+      case HoistingState::kNotHoisted:
+        return Continuation{this}.ReduceInputGraph(ig_index, op);
+    }
+  }
+
+ private:
+  enum class HoistingState : uint8_t { kNotHoisted, kHoisted, kRemoved };
+
+  // Limits the number of checks hoisted per Branch, and the depth of the
+  // conditions that are compared.
+  static constexpr size_t kMaxHoistedChecks = 8;
+  static constexpr int kMaxConditionDepth = 8;
+
+  void HoistCommonChecks(const BranchOp& branch) {
+    const Graph& graph = __ input_graph();
+    const Block* if_true = branch.if_true;
+    const Block* if_false = branch.if_false;
+    if_true_ = if_true;
+    if_false_ = if_false;
+    if (if_true == if_false || !if_true->IsBranchTarget() ||
+        !if_false->IsBranchTarget()) {
+      return;
+    }
+    OptionalV<FrameState> frame_state =
+        FrameStateAtEndOf(*__ current_input_block());
+    if (!frame_state.has_value()) return;
+
+    base::SmallVector<const DeoptimizeIfOp*, kMaxHoistedChecks> checks;
+    for (OpIndex index : graph.OperationIndices(*if_true)) {
+      const Operation& op = graph.Get(index);
+      if (op.Effects().can_write()) break;
+      const DeoptimizeIfOp* check = op.TryCast<DeoptimizeIfOp>();
+      if (!check) {
+        // Other operations that can deopt or leave the function can't be
+        // reordered with the checks.
+        if (op.Effects().is_required_when_unused()) break;
+        continue;
+      }
+      OptionalOpIndex redundant = FindEqualCheck(*check, *if_false);
+      if (!redundant.has_value()) break;
+      TRACE("CheckHoisting: hoisting " << index << " and removing "
+                                       << redundant.value());
+      checks.push_back(check);
+      state_[index] = HoistingState::kRemoved;
+      state_[redundant.value()] = HoistingState::kRemoved;
+      if (checks.size() == kMaxHoistedChecks) break;
+    }
+
+    for (const DeoptimizeIfOp* check : checks) {
+      EmitCondition(check->condition(), if_true);
+      V<Word32> condition = __ MapToNewGraph(check->condition());
+      __ SetCurrentOrigin(graph.Index(*check));
+      if (check->negated) {
+        __ DeoptimizeIfNot(condition, __ MapToNewGraph(frame_state.value()),
+                           check->parameters);
+      } else {
+        __ DeoptimizeIf(condition, __ MapToNewGraph(frame_state.value()),
+                        check->parameters);
+      }
+      // The successors are unreachable, so the remaining checks will never be
+      // visited.
+      if (__ current_block() == nullptr) return;
+    }
+  }
+
+  // Returns the frame state of the last DeoptimizeIf of {block} if no
+  // operation after it writes to memory.
+  OptionalV<FrameState> FrameStateAtEndOf(const Block& block) {
+    const Graph& graph = __ input_graph();
+    OpIndex index = block.end();
+    do {
+      index = graph.PreviousIndex(index);
+      const Operation& op = graph.Get(index);
+      if (const DeoptimizeIfOp* check = op.TryCast<DeoptimizeIfOp>()) {
+        return check->frame_state();
+      }
+      if (op.Effects().can_write()) break;
+    } while (index != block.begin());
+    return OptionalV<FrameState>::Nullopt();
+  }
+
+  // Returns a check of {block} that comes before any write and which is
+  // equivalent to {check}.
+  OptionalOpIndex FindEqualCheck(const DeoptimizeIfOp& check,
+                                 const Block& block) {
+    const Graph& graph = __ input_graph();
+    for (OpIndex index : graph.OperationIndices(block)) {
+      const Operation& op = graph.Get(index);
+      if (op.Effects().can_write()) break;
+      const DeoptimizeIfOp* other = op.TryCast<DeoptimizeIfOp>();
+      if (other && state_[index] == HoistingState::kNotHoisted &&
+          other->negated == check.negated &&
+          AreEqualConditions(check.condition(), other->condition(), 0)) {
+        return index;
+      }
+    }
+    return OptionalOpIndex::Nullopt();
+  }
+
+  // Returns whether {left} (in the true successor) and {right} (in the false
+  // successor) always compute the same value when they are executed before
+  // any write.
+  bool AreEqualConditions(OpIndex left, OpIndex right, int depth) {
+    if (left == right) {
+      // Operations that are not in the successors dominate the Branch.
+      return true;
+    }
+    if (depth > kMaxConditionDepth) return false;
+    const Graph& graph = __ input_graph();
+    // Loads that are not in the successors could be before a write.
+    if (graph.BlockIndexOf(left) != if_true_->index() ||
+        graph.BlockIndexOf(right) != if_false_->index()) {
+      return false;
+    }
+    const Operation& left_op = graph.Get(left);
+    const Operation& right_op = graph.Get(right);
+    if (left_op.opcode != right_op.opcode ||
+        left_op.input_count != right_op.input_count) {
+      return false;
+    }
+    switch (left_op.opcode) {
+      case Opcode::kConstant:
+        return left_op.Cast<ConstantOp>() == right_op.Cast<ConstantOp>();
+#define CASE(Name)                                               \
+  case Opcode::k##Name:                                          \
+    if (left_op.Cast<Name##Op>().options() !=                    \
+        right_op.Cast<Name##Op>().options()) {                   \
+      return false;                                              \
+    }                                                            \
+    break;
+        CASE(Comparison)
+        CASE(WordBinop)
+        CASE(Shift)
+        CASE(Change)
+        CASE(TaggedBitcast)
+        CASE(Load)
+#undef CASE
+      default:
+        return false;
+    }
+    if (!left_op.Effects().IsSubsetOf(
+            OpEffects().CanReadMemory().CanDependOnChecks())) {
+      return false;
+    }
+    for (int i = 0; i < left_op.input_count; ++i) {
+      if (!AreEqualConditions(left_op.input(i), right_op.input(i),
+                              depth + 1)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Emits the operations of {block} that compute {condition}, in their
+  // original order.
+  void EmitCondition(OpIndex condition, const Block* block) {
+    base::SmallVector<OpIndex, 16> operations;
+    CollectConditionOperations(condition, block, operations);
+    std::sort(operations.begin(), operations.end());
+    for (OpIndex index : operations) {
+      TRACE("> hoisting " << index << ": " << __ input_graph().Get(index));
+      __ InlineOp(index, block);
+      state_[index] = HoistingState::kHoisted;
+    }
+  }
+
+  template <size_t N>
+  void CollectConditionOperations(OpIndex index, const Block* block,
+                                  base::SmallVector<OpIndex, N>& operations) {
+    const Graph& graph = __ input_graph();
+    if (graph.BlockIndexOf(index) != block->index()) return;
+    if (state_[index] == HoistingState::kHoisted) return;
+    if (std::find(operations.begin(), operations.end(), index) !=
+        operations.end()) {
+      return;
+    }
+    operations.push_back(index);
+    for (OpIndex input : graph.Get(index).inputs()) {
+      CollectConditionOperations(input, block, operations);
+    }
+  }
+
+  // The successors of the Branch being visited.
+  const Block* if_true_ = nullptr;
+  const Block* if_false_ = nullptr;
+
+  FixedOpIndexSidetable<HoistingState> state_{
+      __ input_graph().op_id_count(), HoistingState::kNotHoisted,
+      __ phase_zone(), &__ input_graph()};
+};
+
+#undef TRACE
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_CHECK_HOISTING_REDUCER_H_
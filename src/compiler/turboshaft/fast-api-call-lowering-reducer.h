@@ -210,38 +210,14 @@ class FastApiCallLoweringReducer : public Next {
               return result;
             }
             case CTypeInfo::Type::kSeqOneByteString: {
-              // Check that the value is a HeapObject.
-              GOTO_IF(__ ObjectIsSmi(argument), handle_error);
-              V<HeapObject> argument_obj = V<HeapObject>::Cast(argument);
-
-              V<Map> map = __ LoadMapField(argument_obj);
-              V<Word32> instance_type = __ LoadInstanceTypeField(map);
-
-              V<Word32> encoding = __ Word32BitwiseAnd(
-                  instance_type, kStringRepresentationAndEncodingMask);
-              GOTO_IF_NOT(__ Word32Equal(encoding, kSeqOneByteStringTag),
-                          handle_error);
-
-              V<WordPtr> length_in_bytes = __ template LoadField<WordPtr>(
-                  argument_obj, AccessBuilder::ForStringLength());
-              V<WordPtr> data_ptr = __ GetElementStartPointer(
-                  argument_obj, AccessBuilder::ForSeqOneByteStringCharacter());
-
-              constexpr int kAlign = alignof(FastOneByteString);
-              constexpr int kSize = sizeof(FastOneByteString);
-              static_assert(kSize == sizeof(uintptr_t) + sizeof(size_t),
-                            "The size of "
-                            "FastOneByteString isn't equal to the sum of its "
-                            "expected members.");
-              OpIndex stack_slot = __ StackSlot(kSize, kAlign);
-              __ StoreOffHeap(stack_slot, data_ptr,
-                              MemoryRepresentation::UintPtr());
-              __ StoreOffHeap(stack_slot, length_in_bytes,
-                              MemoryRepresentation::Uint32(), sizeof(size_t));
-              static_assert(sizeof(uintptr_t) == sizeof(size_t),
-                            "The string length can't "
-                            "fit the PointerRepresentation used to store it.");
-              return stack_slot;
+              return AdaptSeqStringArgument<FastOneByteString>(
+                  argument, kSeqOneByteStringTag, AccessBuilder::ForSeqOneByteStringCharacter(),
+                  handle_error);
+            }
+            case CTypeInfo::Type::kSeqTwoByteString: {
+              return AdaptSeqStringArgument<FastTwoByteString>(
+                  argument, kSeqTwoByteStringTag, AccessBuilder::ForSeqTwoByteStringCharacter(),
+                  handle_error);
             }
             default: {
               return argument;
@@ -269,6 +245,59 @@ class FastApiCallLoweringReducer : public Next {
     END_ALLOW_USE_DEPRECATED()
   }
 
+  // Passes a sequential string with the given encoding as a {data, length}
+  // view on its characters, which are not copied. A thin string is replaced by
+  // the string it points to, so that internalized-and-forwarded strings don't
+  // fall back to the slow path. All other strings (and non-strings) do.
+  template <typename FastString>
+  OpIndex AdaptSeqStringArgument(OpIndex argument, uint32_t seq_tag,
+                                 const ElementAccess& char_access,
+                                 Label<>& handle_error) {
+    static_assert(sizeof(FastString) == sizeof(uintptr_t) + sizeof(size_t),
+                  "The size of the string view isn't equal to the sum of its "
+                  "expected members.");
+    // Check that the value is a HeapObject.
+    GOTO_IF(__ ObjectIsSmi(argument), handle_error);
+    V<HeapObject> argument_obj = V<HeapObject>::Cast(argument);
+
+    // Masking in the non-string bits makes the comparisons below fail for
+    // anything that isn't a string.
+    constexpr uint32_t kMask =
+        kIsNotStringMask | kStringRepresentationAndEncodingMask;
+    Label<HeapObject, Word32> direct(this);
+    V<Word32> instance_type =
+        __ LoadInstanceTypeField(__ LoadMapField(argument_obj));
+    GOTO_IF_NOT(
+        UNLIKELY(__ Word32Equal(
+            __ Word32BitwiseAnd(instance_type,
+                                kIsNotStringMask | kStringRepresentationMask),
+            kThinStringTag)),
+        direct, argument_obj, instance_type);
+    V<HeapObject> actual = __ template LoadField<HeapObject>(
+        argument_obj, AccessBuilder::ForThinStringActual());
+    GOTO(direct, actual, __ LoadInstanceTypeField(__ LoadMapField(actual)));
+
+    BIND(direct, string, string_instance_type);
+    GOTO_IF_NOT(
+        __ Word32Equal(__ Word32BitwiseAnd(string_instance_type, kMask),
+                       seq_tag),
+        handle_error);
+
+    V<WordPtr> length = __ template LoadField<WordPtr>(
+        string, AccessBuilder::ForStringLength());
+    V<WordPtr> data_ptr = __ GetElementStartPointer(string, char_access);
+
+    OpIndex stack_slot =
+        __ StackSlot(sizeof(FastString), alignof(FastString));
+    __ StoreOffHeap(stack_slot, data_ptr, MemoryRepresentation::UintPtr());
+    __ StoreOffHeap(stack_slot, length, MemoryRepresentation::Uint32(),
+                    sizeof(size_t));
+    static_assert(sizeof(uintptr_t) == sizeof(size_t),
+                  "The string length can't "
+                  "fit the PointerRepresentation used to store it.");
+    return stack_slot;
+  }
+
   OpIndex ClampFastCallArgument(V<Float64> argument,
                                 CTypeInfo::Type scalar_type) {
     double min, max;
@@ -345,6 +374,7 @@ class FastApiCallLoweringReducer : public Next {
         return __ HeapConstant(factory_->undefined_value());
       case CTypeInfo::Type::kAny:
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kApiObject:
       case CTypeInfo::Type::kUint8:
@@ -387,6 +417,7 @@ class FastApiCallLoweringReducer : public Next {
         return BuildAllocateJSExternalObject(result);
       case CTypeInfo::Type::kAny:
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kApiObject:
       case CTypeInfo::Type::kUint8:
@@ -2163,6 +2163,7 @@ OpIndex GraphBuilder::Process(
             return;
           case CTypeInfo::Type::kAny:
           case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kV8Value:
           case CTypeInfo::Type::kApiObject:
           case CTypeInfo::Type::kUint8:
@@ -347,7 +347,7 @@ std::optional<BailoutReason> InstructionSelectionPhase::Run(
           ? InstructionSelector::kAllSourcePositions
           : InstructionSelector::kCallSourcePositions,
       InstructionSelector::SupportedFeatures(),
-      v8_flags.turbo_instruction_scheduling
+      InstructionScheduler::EnabledByDefault()
           ? InstructionSelector::kEnableScheduling
           : InstructionSelector::kDisableScheduling,
       data->assembler_options().enable_root_relative_access
@@ -0,0 +1,280 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
+
+#include "src/base/logging.h"
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/compiler/turboshaft/uniform-reducer-adapter.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+#ifdef DEBUG
+#define TRACE(x)                                                          \
+  do {                                                                    \
+    if (v8_flags.turboshaft_trace_licm) StdoutStream() << x << std::endl; \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+// LoopInvariantCodeMotion hoists operations whose inputs are all defined
+// outside of an innermost loop to the end of the block that jumps to the loop
+// header (= the "pre-header"). Operations are hoisted when the forward Goto to
+// the loop header is visited and are skipped when visiting their original
+// position later on.
+//
+// Operations that are not in the loop header may not be executed on every
+// iteration, so only operations that can be executed speculatively
+// (`hoistable_before_a_branch`) are hoisted from there. Operations in the
+// loop header are executed every time the loop is entered, so they can also be
+// hoisted if they depend on checks or deopt, as long as they don't have to stay
+// after an operation of the loop header that remains in the loop. For a
+// hoisted DeoptimizeIf, the frame state of the loop header is reused, with the
+// loop phis replaced by their value on loop entry; this is the state that the
+// first iteration would have deoptimized with.
+//
+// Operations reading mutable memory are only hoisted out of loops that don't
+// write to memory.
+template <class Next>
+class LoopInvariantCodeMotionReducer
+    : public UniformReducerAdapter<LoopInvariantCodeMotionReducer, Next> {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(LoopInvariantCodeMotion)
+
+  using Adapter = UniformReducerAdapter<LoopInvariantCodeMotionReducer, Next>;
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    const Block* dst = gto.destination;
+    if (dst->IsLoop() && !gto.is_backedge && !ShouldSkipOptimizationStep()) {
+      HoistLoopInvariantOperations(dst);
+      // One of the hoisted operations always deopts.
+      if (__ current_block() == nullptr) return {};
+      // Hoisting operations changed the current origins.
+      __ SetCurrentOrigin(ig_idx);
+      __ current_block()->SetOrigin(__ current_input_block());
+    }
+    return Next::ReduceInputGraphGoto(ig_idx, gto);
+  }
+
+  template <typename Op, typename Continuation>
+  OpIndex ReduceInputGraphOperation(OpIndex ig_index, const Op& op) {
+    if (state_[ig_index] == HoistingState::kHoisted) {
+      // The operation has already been emitted before the loop, and its
+      // mapping has been recorded then.
+      return OpIndex::Invalid();
+    }
+    return Continuation{this}.ReduceInputGraph(ig_index, op);
+  }
+
+ private:
+  enum class HoistingState : uint8_t { kNotHoisted, kCandidate, kHoisted };
+  using LoopBody = ZoneSet<const Block*, LoopFinder::BlockCmp>;
+
+  void HoistLoopInvariantOperations(const Block* header) {
+    if (loop_finder_.GetLoopInfo(header).has_inner_loops) return;
+    LoopBody body = loop_finder_.GetLoopBody(header);
+    base::SmallVector<OpIndex, 16> candidates;
+    CollectCandidates(header, body, candidates);
+    if (candidates.empty()) return;
+
+    TRACE("LICM: hoisting " << candidates.size()
+                            << " operations out of loop " << header->index());
+    for (size_t i = 0; i < candidates.size(); i++) {
+      OpIndex index = candidates[i];
+      const Operation& op = __ input_graph().Get(index);
+      TRACE("> hoisting " << index << ": " << op);
+      if (const DeoptimizeIfOp* deopt = op.TryCast<DeoptimizeIfOp>()) {
+        V<FrameState> frame_state =
+            MapFrameStateOnLoopEntry(deopt->frame_state(), header, body);
+        V<Word32> condition = __ MapToNewGraph(deopt->condition());
+        __ SetCurrentOrigin(index);
+        if (deopt->negated) {
+          __ DeoptimizeIfNot(condition, frame_state, deopt->parameters);
+        } else {
+          __ DeoptimizeIf(condition, frame_state, deopt->parameters);
+        }
+      } else {
+        __ InlineOp(index, &__ input_graph().Get(
+                               __ input_graph().BlockIndexOf(index)));
+      }
+      state_[index] = HoistingState::kHoisted;
+      if (__ current_block() == nullptr) {
+        // The loop is unreachable, so the remaining candidates will never be
+        // visited.
+        for (size_t j = i + 1; j < candidates.size(); j++) {
+          state_[candidates[j]] = HoistingState::kNotHoisted;
+        }
+        return;
+      }
+    }
+  }
+
+  template <size_t N>
+  void CollectCandidates(const Block* header, const LoopBody& body,
+                         base::SmallVector<OpIndex, N>& candidates) {
+    const Graph& graph = __ input_graph();
+    bool loop_writes_memory = false;
+    for (const Block* block : body) {
+      for (const Operation& op : graph.operations(*block)) {
+        if (op.Effects().can_write()) {
+          loop_writes_memory = true;
+          break;
+        }
+      }
+      if (loop_writes_memory) break;
+    }
+
+    // The loop header comes first in {body} since blocks are sorted by index.
+    DCHECK_EQ(*body.begin(), header);
+    // Effects of the operations of the loop header that stay in the loop.
+    OpEffects remaining_header_effects;
+    for (const Block* block : body) {
+      const bool in_header = block == header;
+      for (OpIndex index : graph.OperationIndices(*block)) {
+        const Operation& op = graph.Get(index);
+        if (IsHoistable(op, header, body, in_header, loop_writes_memory,
+                        remaining_header_effects)) {
+          state_[index] = HoistingState::kCandidate;
+          candidates.push_back(index);
+        } else if (in_header) {
+          remaining_header_effects = remaining_header_effects | op.Effects();
+        }
+      }
+    }
+  }
+
+  bool IsHoistable(const Operation& op, const Block* header,
+                   const LoopBody& body, bool in_header,
+                   bool loop_writes_memory,
+                   OpEffects remaining_header_effects) const {
+    // Frame states are hoisted together with the checks that use them.
+    if (op.Is<PhiOp>() || op.Is<FrameStateOp>() || op.IsBlockTerminator()) {
+      return false;
+    }
+    if (op.saturated_use_count.IsZero() && !op.IsRequiredWhenUnused()) {
+      return false;
+    }
+
+    OpEffects effects = EffectsForHoisting(op);
+    if (in_header) {
+      if (!effects.IsSubsetOf(OpEffects().CanDeopt())) return false;
+      if (CannotSwapOperations(remaining_header_effects, effects)) {
+        return false;
+      }
+    } else if (!effects.hoistable_before_a_branch()) {
+      return false;
+    }
+
+    if (const DeoptimizeIfOp* deopt = op.TryCast<DeoptimizeIfOp>()) {
+      // The memory read by a deopt is the state it materializes, which is the
+      // same before the loop and at the start of the first iteration.
+      DCHECK(in_header);
+      return IsInvariant(deopt->condition(), body) &&
+             IsInvariantOnLoopEntry(deopt->frame_state(), header, body);
+    }
+    if (op.outputs_rep().empty()) return false;
+    if (effects.can_read_mutable_memory() && loop_writes_memory) return false;
+    for (OpIndex input : op.inputs()) {
+      if (!IsInvariant(input, body)) return false;
+    }
+    return true;
+  }
+
+  static OpEffects EffectsForHoisting(const Operation& op) {
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      // WordBinopOp only depends on checks because of divisions by zero.
+      switch (binop->kind) {
+        case WordBinopOp::Kind::kSignedDiv:
+        case WordBinopOp::Kind::kUnsignedDiv:
+        case WordBinopOp::Kind::kSignedMod:
+        case WordBinopOp::Kind::kUnsignedMod:
+          break;
+        default:
+          return OpEffects();
+      }
+    }
+    return op.Effects();
+  }
+
+  bool IsInLoop(OpIndex index, const LoopBody& body) const {
+    const Graph& graph = __ input_graph();
+    return body.count(&graph.Get(graph.BlockIndexOf(index))) != 0;
+  }
+
+  bool IsInvariant(OpIndex index, const LoopBody& body) const {
+    return state_[index] == HoistingState::kCandidate || !IsInLoop(index, body);
+  }
+
+  bool IsLoopPhiOf(OpIndex index, const Block* header) const {
+    const Graph& graph = __ input_graph();
+    return graph.Get(index).Is<PhiOp>() &&
+           graph.BlockIndexOf(index) == header->index();
+  }
+
+  // Returns whether the frame state {index} holds loop-invariant values, except
+  // for phis of the loop header, which are replaced by their value on loop
+  // entry in MapFrameStateOnLoopEntry.
+  bool IsInvariantOnLoopEntry(OpIndex index, const Block* header,
+                              const LoopBody& body) const {
+    if (!IsInLoop(index, body)) return true;
+    const FrameStateOp& frame_state =
+        __ input_graph().Get(index).template Cast<FrameStateOp>();
+    for (OpIndex input : frame_state.inputs()) {
+      if (__ input_graph().Get(input).template Is<FrameStateOp>()) {
+        if (!IsInvariantOnLoopEntry(input, header, body)) return false;
+      } else if (!IsInvariant(input, body) && !IsLoopPhiOf(input, header)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  V<FrameState> MapFrameStateOnLoopEntry(V<FrameState> index,
+                                         const Block* header,
+                                         const LoopBody& body) {
+    if (!IsInLoop(index, body)) return __ MapToNewGraph(index);
+    const FrameStateOp& frame_state =
+        __ input_graph().Get(index).template Cast<FrameStateOp>();
+    base::SmallVector<OpIndex, 32> inputs;
+    for (OpIndex input : frame_state.inputs()) {
+      const Operation& input_op = __ input_graph().Get(input);
+      if (input_op.Is<FrameStateOp>()) {
+        inputs.push_back(
+            MapFrameStateOnLoopEntry(V<FrameState>::Cast(input), header, body));
+      } else if (IsLoopPhiOf(input, header)) {
+        // The first input of loop phis is the forward edge.
+        inputs.push_back(__ MapToNewGraph(input_op.input(0)));
+      } else {
+        inputs.push_back(__ MapToNewGraph(input));
+      }
+    }
+    __ SetCurrentOrigin(index);
+    return __ FrameState(base::VectorOf(inputs), frame_state.inlined,
+                         frame_state.data);
+  }
+
+  FixedOpIndexSidetable<HoistingState> state_{
+      __ input_graph().op_id_count(), HoistingState::kNotHoisted,
+      __ phase_zone(), &__ input_graph()};
+  LoopFinder loop_finder_{__ phase_zone(), &__ modifiable_input_graph()};
+};
+
+#undef TRACE
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
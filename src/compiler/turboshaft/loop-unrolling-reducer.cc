@@ -4,6 +4,7 @@
 
 #include "src/compiler/turboshaft/loop-unrolling-reducer.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "src/base/bits.h"
@@ -41,6 +42,23 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
   }
 }
 
+// static
+size_t LoopUnrollingAnalyzer::FitUnrollCountToTripCount(
+    IterationCount iter_count, size_t unroll_count) {
+  if (iter_count.IsUnknown()) return unroll_count;
+  size_t trip_count = iter_count.IsExact() ? iter_count.exact_count()
+                                           : iter_count.approx_count();
+  // Copies of the body beyond the trip count would never be executed.
+  if (trip_count < unroll_count) return std::max<size_t>(trip_count, 1);
+  // Prefer an unroll count that divides the trip count, so that the loop exits
+  // from its header rather than from the middle of the unrolled copies. We
+  // don't give up more than half of the copies for this.
+  for (size_t count = unroll_count; count > unroll_count / 2; --count) {
+    if (trip_count % count == 0) return count;
+  }
+  return unroll_count;
+}
+
 IterationCount LoopUnrollingAnalyzer::GetLoopIterationCount(
     const LoopFinder::LoopInfo& info) const {
   const Block* start = info.start;
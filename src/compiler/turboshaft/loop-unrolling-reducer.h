@@ -62,6 +62,10 @@ class IterationCount {
     DCHECK_EQ(kind_, Kind::kExact);
     return count_;
   }
+  size_t approx_count() const {
+    DCHECK_EQ(kind_, Kind::kApprox);
+    return count_;
+  }
 
   bool IsExact() const { return kind_ == Kind::kExact; }
   bool IsApprox() const { return kind_ == Kind::kApprox; }
@@ -223,13 +227,18 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
     if (input_graph_->op_id_count() > kMaxFunctionSizeForPartialUnrolling) {
       return 1;
     }
+    size_t unroll_count = LoopUnrollingAnalyzer::kMaxPartialUnrollingCount;
     if (is_wasm_) {
       LoopFinder::LoopInfo info = loop_finder_.GetLoopInfo(loop_header);
-      return std::min(
-          LoopUnrollingAnalyzer::kMaxPartialUnrollingCount,
+      unroll_count = std::min(
+          unroll_count,
           LoopUnrollingAnalyzer::kWasmMaxUnrolledLoopSize / info.op_count);
     }
-    return LoopUnrollingAnalyzer::kMaxPartialUnrollingCount;
+    if (v8_flags.turboshaft_trip_count_aware_unrolling) {
+      unroll_count = FitUnrollCountToTripCount(GetIterationCount(loop_header),
+                                               unroll_count);
+    }
+    return unroll_count;
   }
 
   bool ShouldRemoveLoop(const Block* loop_header) const {
@@ -274,6 +283,8 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
  private:
   void DetectUnrollableLoops();
   IterationCount GetLoopIterationCount(const LoopFinder::LoopInfo& info) const;
+  static size_t FitUnrollCountToTripCount(IterationCount iter_count,
+                                          size_t unroll_count);
 
   Graph* input_graph_;
   OperationMatcher matcher_;
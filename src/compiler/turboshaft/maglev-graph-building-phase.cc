@@ -3118,12 +3118,22 @@ class GraphBuildingNodeProcessor {
   maglev::ProcessResult Process(maglev::LoadDoubleTypedArrayElement* node,
                                 const maglev::ProcessingState& state) {
     DCHECK_EQ(node->elements_kind(),
-              any_of(FLOAT32_ELEMENTS, FLOAT64_ELEMENTS));
-    V<Float> value = V<Float>::Cast(BuildTypedArrayLoad(
+              any_of(FLOAT16_ELEMENTS, FLOAT32_ELEMENTS, FLOAT64_ELEMENTS));
+    V<Untagged> loaded = BuildTypedArrayLoad(
         Map<JSTypedArray>(node->object_input()),
-        Map<Word32>(node->index_input()), node->elements_kind()));
-    if (node->elements_kind() == FLOAT32_ELEMENTS) {
-      value = __ ChangeFloat32ToFloat64(V<Float32>::Cast(value));
+        Map<Word32>(node->index_input()), node->elements_kind());
+    V<Float64> value;
+    switch (node->elements_kind()) {
+      case FLOAT16_ELEMENTS:
+        value = V<Float64>::Cast(__ Float16Change(
+            V<Word32>::Cast(loaded), Float16ChangeOp::Kind::kToFloat64));
+        break;
+      case FLOAT32_ELEMENTS:
+        value = __ ChangeFloat32ToFloat64(V<Float32>::Cast(loaded));
+        break;
+      default:
+        value = V<Float64>::Cast(loaded);
+        break;
     }
     SetMap(node, value);
     return maglev::ProcessResult::kContinue;
@@ -3140,9 +3150,12 @@ class GraphBuildingNodeProcessor {
   maglev::ProcessResult Process(maglev::StoreDoubleTypedArrayElement* node,
                                 const maglev::ProcessingState& state) {
     DCHECK_EQ(node->elements_kind(),
-              any_of(FLOAT32_ELEMENTS, FLOAT64_ELEMENTS));
-    V<Float> value = Map<Float>(node->value_input());
-    if (node->elements_kind() == FLOAT32_ELEMENTS) {
+              any_of(FLOAT16_ELEMENTS, FLOAT32_ELEMENTS, FLOAT64_ELEMENTS));
+    V<Untagged> value = Map<Float>(node->value_input());
+    if (node->elements_kind() == FLOAT16_ELEMENTS) {
+      value = __ Float16Change(Map<Float64>(node->value_input()),
+                               Float16ChangeOp::Kind::kToFloat16);
+    } else if (node->elements_kind() == FLOAT32_ELEMENTS) {
       value = __ TruncateFloat64ToFloat32(Map(node->value_input()));
     }
     BuildTypedArrayStore(Map<JSTypedArray>(node->object_input()),
@@ -5981,7 +5994,8 @@ void RunMaglevOptimizations(PipelineData* data,
 
   // Escape analysis.
   {
-    maglev::GraphMultiProcessor<maglev::AnyUseMarkingProcessor> processor;
+    maglev::GraphMultiProcessor<maglev::AnyUseMarkingProcessor> processor(
+        maglev::AnyUseMarkingProcessor{compilation_info});
     processor.ProcessGraph(maglev_graph);
   }
 
@@ -12,12 +12,16 @@
 #include "src/compiler/basic-block-instrumentor.h"
 #include "src/compiler/pipeline-statistics.h"
 #include "src/compiler/turbofan-graph-visualizer.h"
+#include "src/compiler/turboshaft/allocation-escape-analysis-phase.h"
 #include "src/compiler/turboshaft/block-instrumentation-phase.h"
+#include "src/compiler/turboshaft/bounds-check-elimination-phase.h"
 #include "src/compiler/turboshaft/build-graph-phase.h"
+#include "src/compiler/turboshaft/check-hoisting-phase.h"
 #include "src/compiler/turboshaft/code-elimination-and-simplification-phase.h"
 #include "src/compiler/turboshaft/debug-feature-lowering-phase.h"
 #include "src/compiler/turboshaft/decompression-optimization-phase.h"
 #include "src/compiler/turboshaft/instruction-selection-phase.h"
+#include "src/compiler/turboshaft/loop-invariant-code-motion-phase.h"
 #include "src/compiler/turboshaft/loop-peeling-phase.h"
 #include "src/compiler/turboshaft/loop-unrolling-phase.h"
 #include "src/compiler/turboshaft/machine-lowering-phase.h"
@@ -32,6 +36,7 @@
 #include "src/compiler/turboshaft/typed-optimizations-phase.h"
 
 #if V8_ENABLE_WEBASSEMBLY
+#include "src/compiler/turboshaft/typed-array-vectorization-phase.h"
 #include "src/compiler/turboshaft/wasm-in-js-inlining-phase.h"
 #endif  // V8_ENABLE_WEBASSEMBLY
 
@@ -182,6 +187,11 @@ class Pipeline {
     if (v8_flags.turboshaft_wasm_in_js_inlining) {
       Run<turboshaft::WasmInJSInliningPhase>();
     }
+
+    // Typed array accesses are recognized before they are lowered.
+    if (v8_flags.turboshaft_typed_array_vectorization) {
+      Run<turboshaft::TypedArrayVectorizationPhase>();
+    }
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
     Run<turboshaft::MachineLoweringPhase>();
@@ -204,6 +214,22 @@ class Pipeline {
       Run<turboshaft::LoopUnrollingPhase>();
     }
 
+    if (v8_flags.turboshaft_allocation_escape_analysis) {
+      Run<turboshaft::AllocationEscapeAnalysisPhase>();
+    }
+
+    if (v8_flags.turboshaft_check_hoisting) {
+      Run<turboshaft::CheckHoistingPhase>();
+    }
+
+    if (v8_flags.turboshaft_licm) {
+      Run<turboshaft::LoopInvariantCodeMotionPhase>();
+    }
+
+    if (v8_flags.turboshaft_bounds_check_elimination) {
+      Run<turboshaft::BoundsCheckEliminationPhase>();
+    }
+
     if (v8_flags.turbo_store_elimination) {
       Run<turboshaft::StoreStoreEliminationPhase>();
     }
@@ -253,27 +279,7 @@ class Pipeline {
       }
 
       if (v8_flags.turbo_profiling) {
-        UnparkedScopeIfNeeded unparked_scope(data()->broker());
-
-        // Basic block profiling disables concurrent compilation, so handle
-        // deref is fine.
-        AllowHandleDereference allow_handle_dereference;
-        const size_t block_count = data()->graph().block_count();
-        BasicBlockProfilerData* profiler_data =
-            BasicBlockProfiler::Get()->NewData(block_count);
-
-        // Set the function name.
-        profiler_data->SetFunctionName(info()->GetDebugName());
-        // Capture the schedule string before instrumentation.
-        if (v8_flags.turbo_profiling_verbose) {
-          std::ostringstream os;
-          os << data()->graph();
-          profiler_data->SetSchedule(os);
-        }
-
-        info()->set_profiler_data(profiler_data);
-
-        Run<BlockInstrumentationPhase>();
+        InstrumentBlocks();
       } else {
         // We run an empty copying phase to make sure that we have the same
         // control flow as when taking the profile.
@@ -281,6 +287,15 @@ class Pipeline {
                                               kTempZoneName);
         CopyingPhase<>::Run(data(), temp_zone);
       }
+    } else if (V8_UNLIKELY(v8_flags.turbo_profiling_js &&
+                           data()->pipeline_kind() ==
+                               TurboshaftPipelineKind::kJS)) {
+      // {profile} comes from a previous compilation of the same function with
+      // the same graph, whose block ids match the current ones.
+      if (profile) {
+        Run<ProfileApplicationPhase>(profile);
+      }
+      InstrumentBlocks();
     }
 
     // DecompressionOptimization has to run as the last phase because it
@@ -291,6 +306,30 @@ class Pipeline {
     Run<SpecialRPOSchedulingPhase>();
   }
 
+  void InstrumentBlocks() {
+    UnparkedScopeIfNeeded unparked_scope(data()->broker());
+
+    // Basic block profiling disables concurrent compilation, so handle
+    // deref is fine.
+    AllowHandleDereference allow_handle_dereference;
+    const size_t block_count = data()->graph().block_count();
+    BasicBlockProfilerData* profiler_data =
+        BasicBlockProfiler::Get()->NewData(block_count);
+
+    // Set the function name.
+    profiler_data->SetFunctionName(info()->GetDebugName());
+    // Capture the schedule string before instrumentation.
+    if (v8_flags.turbo_profiling_verbose) {
+      std::ostringstream os;
+      os << data()->graph();
+      profiler_data->SetSchedule(os);
+    }
+
+    info()->set_profiler_data(profiler_data);
+
+    Run<BlockInstrumentationPhase>();
+  }
+
   [[nodiscard]] bool SelectInstructions(Linkage* linkage) {
     auto call_descriptor = linkage->GetIncomingDescriptor();
 
@@ -55,6 +55,14 @@ namespace v8::internal::compiler::turboshaft {
 //   4. When we see another operation that can observe memory, we mark all
 //      stores as observable.
 //
+// An initializing store that is kept only because it is gc-observable does not
+// need to store its initial value if the field is overwritten later in the
+// same block without being read in between. In that case, the initializing
+// store is made to store the value of the overwriting store right away (if
+// that value is already available), and the overwriting store is eliminated.
+// This avoids writing every field of freshly allocated objects twice when,
+// e.g., an inlined constructor allocates before it initializes its fields.
+//
 // Notice that the table also tracks the `size` of the store, such that if
 // fields are partially written, we don't incorrectly treat them as redundant to
 // the full store (this can happen in strings for example).
@@ -280,12 +288,16 @@ class MaybeRedundantStoresTable
 class RedundantStoreAnalysis {
  public:
   RedundantStoreAnalysis(const Graph& graph, Zone* phase_zone)
-      : graph_(graph), table_(graph, phase_zone) {}
+      : graph_(graph),
+        table_(graph, phase_zone),
+        overwriting_stores_(phase_zone) {}
 
   void Run(ZoneSet<OpIndex>& eliminable_stores,
-           ZoneMap<OpIndex, uint64_t>& mergeable_store_pairs) {
+           ZoneMap<OpIndex, uint64_t>& mergeable_store_pairs,
+           ZoneMap<OpIndex, OpIndex>& forwarded_stores) {
     eliminable_stores_ = &eliminable_stores;
     mergeable_store_pairs_ = &mergeable_store_pairs;
+    forwarded_stores_ = &forwarded_stores;
     for (uint32_t processed = graph_.block_count(); processed > 0;
          --processed) {
       BlockIndex block_index = static_cast<BlockIndex>(processed - 1);
@@ -308,10 +320,12 @@ class RedundantStoreAnalysis {
     }
     eliminable_stores_ = nullptr;
     mergeable_store_pairs_ = nullptr;
+    forwarded_stores_ = nullptr;
   }
 
   void ProcessBlock(const Block& block) {
     table_.BeginBlock(&block);
+    overwriting_stores_.clear();
 
     auto op_range = graph_.OperationIndices(block);
     for (auto it = op_range.end(); it != op_range.begin();) {
@@ -330,6 +344,7 @@ class RedundantStoreAnalysis {
           // For now we consider only stores of fields of objects on the heap.
           if (is_on_heap_store && is_field_store) {
             bool is_eliminable_store = false;
+            bool is_forwarded_store = false;
             switch (table_.GetObservability(store.base(), store.offset, size)) {
               case StoreObservability::kUnobservable:
                 eliminable_stores_->insert(index);
@@ -342,6 +357,7 @@ class RedundantStoreAnalysis {
                   // stores to the same `base+offset` as unobservable.
                   table_.MarkStoreAsUnobservable(store.base(), store.offset,
                                                  size);
+                  is_forwarded_store = TryForwardOverwritingStore(index, store);
                 } else {
                   eliminable_stores_->insert(index);
                   last_field_initialization_store_ = OpIndex::Invalid();
@@ -355,10 +371,18 @@ class RedundantStoreAnalysis {
                                                size);
                 break;
             }
+            if (!is_eliminable_store) {
+              overwriting_stores_[{store.base(), store.offset}] = index;
+            }
+            if (is_forwarded_store) {
+              // The stored value is no longer a constant known here.
+              last_field_initialization_store_ = OpIndex::Invalid();
+            }
 
             // Try to merge 2 consecutive 32-bit stores into a single 64-bit
             // one.
             if (COMPRESS_POINTERS_BOOL && !is_eliminable_store &&
+                !is_forwarded_store &&
                 store.maybe_initializing_or_transitioning &&
                 store.kind == StoreOp::Kind::TaggedBase() &&
                 store.write_barrier == WriteBarrierKind::kNoWriteBarrier &&
@@ -420,6 +444,16 @@ class RedundantStoreAnalysis {
           if (is_on_heap_load && is_field_load) {
             table_.MarkPotentiallyAliasingStoresAsObservable(load.base(),
                                                              load.offset);
+            for (auto it = overwriting_stores_.begin();
+                 it != overwriting_stores_.end();) {
+              if (it->first.second == load.offset) {
+                overwriting_stores_.erase(it++);
+              } else {
+                ++it;
+              }
+            }
+          } else {
+            overwriting_stores_.clear();
           }
           break;
         }
@@ -427,6 +461,7 @@ class RedundantStoreAnalysis {
           OpEffects effects = op.Effects();
           if (effects.can_read_mutable_memory()) {
             table_.MarkAllStoresAsObservable();
+            overwriting_stores_.clear();
           } else if (effects.requires_consistent_heap()) {
             table_.MarkAllStoresAsGCObservable();
           }
@@ -436,12 +471,48 @@ class RedundantStoreAnalysis {
   }
 
  private:
+  // Makes the initializing store `index` store the value of the store that
+  // overwrites the same field later in the current block, and eliminates the
+  // latter. Returns true if the stores were combined.
+  bool TryForwardOverwritingStore(OpIndex index, const StoreOp& store) {
+    auto it = overwriting_stores_.find({store.base(), store.offset});
+    if (it == overwriting_stores_.end()) return false;
+    const OpIndex overwriting_index = it->second;
+    if (mergeable_store_pairs_->contains(overwriting_index)) return false;
+    // The overwriting store might itself have taken its value from a later
+    // store.
+    auto forwarded = forwarded_stores_->find(overwriting_index);
+    const OpIndex source_index = forwarded != forwarded_stores_->end()
+                                     ? forwarded->second
+                                     : overwriting_index;
+    const StoreOp& source = graph_.Get(source_index).Cast<StoreOp>();
+    // The value has to be available at the initializing store. As the value
+    // dominates the overwriting store in the same block, this holds if it is
+    // defined before the initializing store.
+    if (source.value() >= index) return false;
+    if (source.kind != store.kind || source.stored_rep != store.stored_rep ||
+        source.indirect_pointer_tag() != store.indirect_pointer_tag()) {
+      return false;
+    }
+    if (forwarded != forwarded_stores_->end()) {
+      forwarded_stores_->erase(forwarded);
+    }
+    eliminable_stores_->insert(overwriting_index);
+    forwarded_stores_->insert({index, source_index});
+    return true;
+  }
+
   const Graph& graph_;
   MaybeRedundantStoresTable table_;
   ZoneSet<OpIndex>* eliminable_stores_ = nullptr;
 
   ZoneMap<OpIndex, uint64_t>* mergeable_store_pairs_ = nullptr;
+  // Maps initializing stores to the stores whose values they store instead.
+  ZoneMap<OpIndex, OpIndex>* forwarded_stores_ = nullptr;
   OpIndex last_field_initialization_store_ = OpIndex::Invalid();
+  // For each `base+offset` written in the current block, the closest store
+  // that follows the current operation, if the field is not read in between.
+  ZoneAbslFlatHashMap<std::pair<OpIndex, int32_t>, OpIndex> overwriting_stores_;
 };
 
 template <class Next>
@@ -450,13 +521,23 @@ class StoreStoreEliminationReducer : public Next {
   TURBOSHAFT_REDUCER_BOILERPLATE(StoreStoreElimination)
 
   void Analyze() {
-    analysis_.Run(eliminable_stores_, mergeable_store_pairs_);
+    analysis_.Run(eliminable_stores_, mergeable_store_pairs_,
+                  forwarded_stores_);
     Next::Analyze();
   }
 
   OpIndex REDUCE_INPUT_GRAPH(Store)(OpIndex ig_index, const StoreOp& store) {
     if (eliminable_stores_.count(ig_index) > 0) {
       return OpIndex::Invalid();
+    } else if (auto it = forwarded_stores_.find(ig_index);
+               it != forwarded_stores_.end()) {
+      const StoreOp& source =
+          Asm().input_graph().Get(it->second).template Cast<StoreOp>();
+      __ Store(__ MapToNewGraph(store.base()), __ MapToNewGraph(source.value()),
+               store.kind, store.stored_rep, source.write_barrier, store.offset,
+               store.maybe_initializing_or_transitioning,
+               store.indirect_pointer_tag());
+      return OpIndex::Invalid();
     } else if (mergeable_store_pairs_.count(ig_index) > 0) {
       DCHECK(COMPRESS_POINTERS_BOOL);
       OpIndex value = __ Word64Constant(mergeable_store_pairs_[ig_index]);
@@ -472,6 +553,7 @@ class StoreStoreEliminationReducer : public Next {
   RedundantStoreAnalysis analysis_{Asm().input_graph(), Asm().phase_zone()};
   ZoneSet<OpIndex> eliminable_stores_{Asm().phase_zone()};
   ZoneMap<OpIndex, uint64_t> mergeable_store_pairs_{Asm().phase_zone()};
+  ZoneMap<OpIndex, OpIndex> forwarded_stores_{Asm().phase_zone()};
 };
 
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
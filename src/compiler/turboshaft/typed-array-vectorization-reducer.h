@@ -0,0 +1,728 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_TURBOSHAFT_TYPED_ARRAY_VECTORIZATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_TYPED_ARRAY_VECTORIZATION_REDUCER_H_
+
+#include <optional>
+
+#include "src/base/logging.h"
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/representations.h"
+#include "src/numbers/conversions.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+#ifdef DEBUG
+#define TRACE(x)                                                 \
+  do {                                                           \
+    if (v8_flags.turboshaft_trace_typed_array_vectorization) {   \
+      StdoutStream() << x << std::endl;                          \
+    }                                                            \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+// TypedArrayVectorization vectorizes simple element-wise loops over typed
+// arrays, like
+//
+//     for (let i = 0; i < n; i++) c[i] = a[i] + b[i];
+//
+// It runs before MachineLowering, on LoadTypedElement and StoreTypedElement,
+// and only considers innermost loops made of a header and a single body block,
+// whose only phi is an induction variable `i` starting anywhere, incremented
+// by 1 and compared to a loop-invariant bound with `i <s bound`. The body can
+// only contain typed array accesses at index `i` (on arrays with the same
+// element type), arithmetic operations that are element-wise on these values,
+// and bounds checks of `i` against loop-invariant lengths.
+//
+// When the forward edge to such a loop is visited, a vector loop is emitted
+// before it, which processes 128 bits of each array per iteration as long as
+// all lanes pass the loop condition and the bounds checks. The original loop
+// then starts where the vector loop stopped and takes care of the remaining
+// iterations (and of the deopts of out-of-bounds accesses). The vector loop is
+// skipped if a typed array that is written to overlaps another array in a way
+// that would make reordering accesses within 128 bits observable.
+//
+// Only element-wise operations whose vector version computes the same result
+// are vectorized: for integer arrays, the result of 32-bit additions,
+// subtractions, multiplications and bitwise operations only depends on the
+// lower bits of their inputs, so they can be computed on narrower lanes. For
+// Float32Array, JavaScript arithmetic is done on float64 values, but
+// `f32(f64(a) op f64(b))` is equal to `a op_f32 b` for additions,
+// subtractions, multiplications and divisions, so these are vectorized if their
+// result is directly truncated to float32.
+template <class Next>
+class TypedArrayVectorizationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(TypedArrayVectorization)
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    const Block* header = gto.destination;
+    if (header->IsLoop() && !gto.is_backedge && !ShouldSkipOptimizationStep()) {
+      if (std::optional<VectorizableLoop> loop = AnalyzeLoop(header)) {
+        TRACE("Vectorizing loop " << header->index());
+        V<Word32> start = EmitVectorLoop(*loop);
+        vectorized_loops_entry_.insert({loop->phi, start});
+        // Emitting the vector loop changed the current origin.
+        __ SetCurrentOrigin(ig_idx);
+      }
+    }
+    return Next::ReduceInputGraphGoto(ig_idx, gto);
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Phi)(OpIndex ig_index, const PhiOp& phi) {
+    if (auto it = vectorized_loops_entry_.find(ig_index);
+        it != vectorized_loops_entry_.end()) {
+      // The scalar loop starts at the first iteration that the vector loop
+      // didn't process.
+      DCHECK(__ current_block()->IsLoop());
+      return __ PendingLoopPhi(it->second, phi.rep);
+    }
+    return Next::ReduceInputGraphPhi(ig_index, phi);
+  }
+
+ private:
+  // The values computed in the loop body.
+  enum class Lane : uint8_t {
+    // The induction variable, or its extension to WordPtr.
+    kIndex32,
+    kIndexPtr,
+    // Vectors of integers, float32 and float64 values.
+    kInt,
+    kFloat32,
+    kFloat64,
+    // Vector of float32 values extended to float64.
+    kFloat32AsFloat64,
+    // Vector of the result of an operation on kFloat32AsFloat64, which is only
+    // equal to the corresponding float32 operation when truncated to float32.
+    kFloat32Unrounded,
+    // Operations that are not emitted in the vector loop (bounds checks,
+    // increment of the induction variable, and frame states).
+    kSkipped,
+  };
+
+  enum class ElementKind : uint8_t { kInt, kFloat32, kFloat64 };
+
+  struct BoundsCheck {
+    OpIndex length;
+    RegisterRepresentation rep;
+  };
+
+  struct VectorizableLoop {
+    const Block* header;
+    const Block* body;
+    OpIndex phi;
+    OpIndex bound;
+    ElementKind element_kind = ElementKind::kInt;
+    int element_size_log2 = 0;
+    const JSStackCheckOp* stack_check = nullptr;
+    base::SmallVector<BoundsCheck, 4> bounds_checks;
+  };
+
+  static constexpr int kMaxVectorizedOperations = 64;
+
+  std::optional<VectorizableLoop> AnalyzeLoop(const Block* header) {
+    const Graph& graph = __ input_graph();
+    const LoopFinder::LoopInfo& info = loop_finder_.GetLoopInfo(header);
+    if (info.has_inner_loops || info.block_count != 2) return std::nullopt;
+
+    // The header ends with `Branch(phi <s bound, body, exit)`.
+    const BranchOp* branch =
+        header->LastOperation(graph).template TryCast<BranchOp>();
+    if (!branch) return std::nullopt;
+    const Block* body = branch->if_true;
+    if (body->PredecessorCount() != 1 || body == branch->if_false) {
+      return std::nullopt;
+    }
+    const GotoOp* backedge =
+        body->LastOperation(graph).template TryCast<GotoOp>();
+    if (!backedge || backedge->destination != header) return std::nullopt;
+    const ComparisonOp* condition =
+        graph.Get(branch->condition()).template TryCast<ComparisonOp>();
+    if (!condition || condition->kind != ComparisonOp::Kind::kSignedLessThan ||
+        condition->rep != RegisterRepresentation::Word32()) {
+      return std::nullopt;
+    }
+
+    VectorizableLoop loop{header, body, condition->left(), condition->right()};
+    const PhiOp* phi = graph.Get(loop.phi).template TryCast<PhiOp>();
+    if (!phi || phi->input_count != 2 ||
+        graph.BlockIndexOf(loop.phi) != header->index() ||
+        IsInLoop(loop.bound, loop)) {
+      return std::nullopt;
+    }
+    if (!IsIncrementByOne(phi->input(PhiOp::kLoopPhiBackEdgeIndex), loop)) {
+      return std::nullopt;
+    }
+
+    lanes_.clear();
+    lanes_[loop.phi] = Lane::kIndex32;
+    for (OpIndex index : graph.OperationIndices(*header)) {
+      const Operation& op = graph.Get(index);
+      if (index == loop.phi || index == branch->condition() ||
+          op.Is<BranchOp>() || op.Is<ConstantOp>()) {
+        continue;
+      }
+      if (op.Is<PhiOp>()) return std::nullopt;
+      if (const FrameStateOp* frame_state = op.TryCast<FrameStateOp>()) {
+        if (!IsMappableFrameState(*frame_state, loop)) return std::nullopt;
+        continue;
+      }
+      if (const JSStackCheckOp* stack_check = op.TryCast<JSStackCheckOp>()) {
+        if (stack_check->kind != JSStackCheckOp::Kind::kLoop ||
+            loop.stack_check != nullptr ||
+            !stack_check->frame_state().has_value() ||
+            IsInLoop(stack_check->native_context(), loop)) {
+          return std::nullopt;
+        }
+        loop.stack_check = stack_check;
+        continue;
+      }
+      return std::nullopt;
+    }
+
+    std::optional<ExternalArrayType> array_type;
+    int operation_count = 0;
+    for (OpIndex index : graph.OperationIndices(*body)) {
+      const Operation& op = graph.Get(index);
+      if (op.Is<GotoOp>() || op.Is<ConstantOp>()) continue;
+      if (++operation_count > kMaxVectorizedOperations) return std::nullopt;
+      std::optional<Lane> lane = ComputeLane(index, op, loop, array_type);
+      if (!lane.has_value()) {
+        TRACE("> Can't vectorize " << index << ": " << op);
+        return std::nullopt;
+      }
+      lanes_[index] = *lane;
+    }
+    // Loops without typed array accesses have nothing to vectorize.
+    if (!array_type.has_value()) return std::nullopt;
+
+    return loop;
+  }
+
+  // Computes the lane of the operation {index} of the loop body. Returns
+  // nullopt if the operation can't be vectorized. Vectors can be used by
+  // frame states, which are not emitted in the vector loop, and by operations
+  // whose inputs are checked to have the expected lane here: in particular,
+  // kFloat32Unrounded vectors can only be used by truncations to float32.
+  std::optional<Lane> ComputeLane(
+      OpIndex index, const Operation& op, VectorizableLoop& loop,
+      std::optional<ExternalArrayType>& array_type) {
+    if (IsIncrementByOne(index, loop)) return Lane::kSkipped;
+    // Frame states of the loop body are only used by bounds checks.
+    if (op.Is<FrameStateOp>()) return Lane::kSkipped;
+    if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+      std::optional<Lane> input = LaneOf(change->input());
+      if (change->kind == ChangeOp::Kind::kSignExtend &&
+          change->from == RegisterRepresentation::Word32() &&
+          change->to == RegisterRepresentation::WordPtr() &&
+          input == Lane::kIndex32) {
+        return Lane::kIndexPtr;
+      }
+      if (change->kind != ChangeOp::Kind::kFloatConversion) return {};
+      if (change->from == RegisterRepresentation::Float32() &&
+          input == Lane::kFloat32) {
+        return Lane::kFloat32AsFloat64;
+      }
+      if (change->to == RegisterRepresentation::Float32() &&
+          input == any_of(Lane::kFloat32AsFloat64, Lane::kFloat32Unrounded)) {
+        return Lane::kFloat32;
+      }
+      return {};
+    }
+    if (const ComparisonOp* comparison = op.TryCast<ComparisonOp>()) {
+      // Bounds checks: `index <u length`.
+      if (comparison->kind == ComparisonOp::Kind::kUnsignedLessThan &&
+          !IsInLoop(comparison->right(), loop) &&
+          ((comparison->rep == RegisterRepresentation::Word32() &&
+            LaneOf(comparison->left()) == Lane::kIndex32) ||
+           (comparison->rep == RegisterRepresentation::WordPtr() &&
+            LaneOf(comparison->left()) == Lane::kIndexPtr))) {
+        return Lane::kSkipped;
+      }
+      return {};
+    }
+    if (const DeoptimizeIfOp* deopt = op.TryCast<DeoptimizeIfOp>()) {
+      if (!deopt->negated || LaneOf(deopt->condition()) != Lane::kSkipped) {
+        return {};
+      }
+      const ComparisonOp& comparison = __ input_graph()
+                                           .Get(deopt->condition())
+                                           .template Cast<ComparisonOp>();
+      loop.bounds_checks.push_back({comparison.right(), comparison.rep});
+      return Lane::kSkipped;
+    }
+    if (const LoadTypedElementOp* load = op.TryCast<LoadTypedElementOp>()) {
+      if (!IsVectorizableAccess(load->buffer(), load->base(), load->external(),
+                                load->index(), load->array_type, loop,
+                                array_type)) {
+        return {};
+      }
+      return LaneOfElements(loop.element_kind);
+    }
+    if (const StoreTypedElementOp* store = op.TryCast<StoreTypedElementOp>()) {
+      if (!IsVectorizableAccess(store->buffer(), store->base(),
+                                store->external(), store->index(),
+                                store->array_type, loop, array_type)) {
+        return {};
+      }
+      if (LaneOf(store->value()) != LaneOfElements(loop.element_kind)) {
+        return {};
+      }
+      return Lane::kSkipped;
+    }
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      if (binop->rep != WordRepresentation::Word32() || !array_type ||
+          loop.element_kind != ElementKind::kInt ||
+          !GetIntegerBinopKind(binop->kind, loop.element_size_log2)) {
+        return {};
+      }
+      if (!IsVectorOrScalar(binop->left(), Lane::kInt, loop) ||
+          !IsVectorOrScalar(binop->right(), Lane::kInt, loop)) {
+        return {};
+      }
+      return Lane::kInt;
+    }
+    if (const FloatBinopOp* binop = op.TryCast<FloatBinopOp>()) {
+      if (!array_type ||
+          !GetFloatBinopKind(binop->kind, ElementKind::kFloat64)) {
+        return {};
+      }
+      if (binop->rep == FloatRepresentation::Float32() &&
+          loop.element_kind == ElementKind::kFloat32) {
+        if (!IsVectorOrScalar(binop->left(), Lane::kFloat32, loop) ||
+            !IsVectorOrScalar(binop->right(), Lane::kFloat32, loop)) {
+          return {};
+        }
+        return Lane::kFloat32;
+      }
+      if (binop->rep != FloatRepresentation::Float64()) return {};
+      if (loop.element_kind == ElementKind::kFloat64) {
+        if (!IsVectorOrScalar(binop->left(), Lane::kFloat64, loop) ||
+            !IsVectorOrScalar(binop->right(), Lane::kFloat64, loop)) {
+          return {};
+        }
+        return Lane::kFloat64;
+      }
+      if (loop.element_kind == ElementKind::kFloat32) {
+        if (!IsVectorOrScalar(binop->left(), Lane::kFloat32AsFloat64, loop) ||
+            !IsVectorOrScalar(binop->right(), Lane::kFloat32AsFloat64, loop)) {
+          return {};
+        }
+        // The result has to be truncated to float32 before being used, which
+        // is checked by the uses.
+        return Lane::kFloat32Unrounded;
+      }
+      return {};
+    }
+    return {};
+  }
+
+  bool IsVectorizableAccess(OpIndex buffer, OpIndex base, OpIndex external,
+                            OpIndex index, ExternalArrayType type,
+                            VectorizableLoop& loop,
+                            std::optional<ExternalArrayType>& array_type) {
+    if (IsInLoop(buffer, loop) || IsInLoop(base, loop) ||
+        IsInLoop(external, loop) || LaneOf(index) != Lane::kIndexPtr) {
+      return false;
+    }
+    ElementKind kind;
+    int element_size_log2;
+    switch (type) {
+      case kExternalInt8Array:
+      case kExternalUint8Array:
+        kind = ElementKind::kInt;
+        element_size_log2 = 0;
+        break;
+      case kExternalInt16Array:
+      case kExternalUint16Array:
+        kind = ElementKind::kInt;
+        element_size_log2 = 1;
+        break;
+      case kExternalInt32Array:
+      case kExternalUint32Array:
+        kind = ElementKind::kInt;
+        element_size_log2 = 2;
+        break;
+      case kExternalFloat32Array:
+        kind = ElementKind::kFloat32;
+        element_size_log2 = 2;
+        break;
+      case kExternalFloat64Array:
+        kind = ElementKind::kFloat64;
+        element_size_log2 = 3;
+        break;
+      case kExternalFloat16Array:
+      case kExternalUint8ClampedArray:
+      case kExternalBigInt64Array:
+      case kExternalBigUint64Array:
+        return false;
+    }
+    if (!array_type.has_value()) {
+      array_type = type;
+      loop.element_kind = kind;
+      loop.element_size_log2 = element_size_log2;
+      return true;
+    }
+    return kind == loop.element_kind &&
+           element_size_log2 == loop.element_size_log2;
+  }
+
+  static Lane LaneOfElements(ElementKind kind) {
+    switch (kind) {
+      case ElementKind::kInt:
+        return Lane::kInt;
+      case ElementKind::kFloat32:
+        return Lane::kFloat32;
+      case ElementKind::kFloat64:
+        return Lane::kFloat64;
+    }
+  }
+
+  // Returns true if {index} is a vector of lane {lane}, or a loop-invariant
+  // scalar that can be splatted to such a vector.
+  bool IsVectorOrScalar(OpIndex index, Lane lane,
+                        const VectorizableLoop& loop) {
+    if (std::optional<Lane> vector = LaneOf(index)) return *vector == lane;
+    const Operation& op = __ input_graph().Get(index);
+    if (IsInLoop(index, loop) && !op.Is<ConstantOp>()) return false;
+    if (lane != Lane::kFloat32AsFloat64) return true;
+    // Scalar float64 values can only be used in float32 operations if they
+    // are float32 values.
+    if (const ConstantOp* cst = op.TryCast<ConstantOp>()) {
+      if (cst->kind != ConstantOp::Kind::kFloat64) return false;
+      double value = cst->float64().get_scalar();
+      return static_cast<double>(DoubleToFloat32(value)) == value;
+    }
+    const ChangeOp* change = op.TryCast<ChangeOp>();
+    return change && change->kind == ChangeOp::Kind::kFloatConversion &&
+           change->from == RegisterRepresentation::Float32();
+  }
+
+  std::optional<Lane> LaneOf(OpIndex index) const {
+    auto it = lanes_.find(index);
+    if (it == lanes_.end()) return std::nullopt;
+    return it->second;
+  }
+
+  bool IsInLoop(OpIndex index, const VectorizableLoop& loop) const {
+    BlockIndex block = __ input_graph().BlockIndexOf(index);
+    return block == loop.header->index() || block == loop.body->index();
+  }
+
+  bool IsIncrementByOne(OpIndex index, const VectorizableLoop& loop) {
+    const WordBinopOp* add =
+        __ input_graph().Get(index).template TryCast<WordBinopOp>();
+    if (!add || add->kind != WordBinopOp::Kind::kAdd ||
+        add->rep != WordRepresentation::Word32() ||
+        add->left() != loop.phi) {
+      return false;
+    }
+    const ConstantOp* one =
+        __ input_graph().Get(add->right()).template TryCast<ConstantOp>();
+    return one && one->kind == ConstantOp::Kind::kWord32 && one->word32() == 1;
+  }
+
+  // Frame states of the loop header are re-emitted in the vector loop, so they
+  // can only depend on the induction variable and on loop-invariant values.
+  bool IsMappableFrameState(const FrameStateOp& frame_state,
+                            const VectorizableLoop& loop) {
+    for (OpIndex input : frame_state.inputs()) {
+      if (!IsInLoop(input, loop) || input == loop.phi) continue;
+      const Operation& input_op = __ input_graph().Get(input);
+      if (input_op.Is<ConstantOp>()) continue;
+      if (const FrameStateOp* parent = input_op.TryCast<FrameStateOp>()) {
+        if (IsMappableFrameState(*parent, loop)) continue;
+      }
+      return false;
+    }
+    return true;
+  }
+
+  static std::optional<Simd128BinopOp::Kind> GetIntegerBinopKind(
+      WordBinopOp::Kind kind, int element_size_log2) {
+    using Kind = Simd128BinopOp::Kind;
+    switch (kind) {
+      case WordBinopOp::Kind::kAdd:
+        return element_size_log2 == 0   ? Kind::kI8x16Add
+               : element_size_log2 == 1 ? Kind::kI16x8Add
+                                        : Kind::kI32x4Add;
+      case WordBinopOp::Kind::kSub:
+        return element_size_log2 == 0   ? Kind::kI8x16Sub
+               : element_size_log2 == 1 ? Kind::kI16x8Sub
+                                        : Kind::kI32x4Sub;
+      case WordBinopOp::Kind::kMul:
+        if (element_size_log2 == 0) return std::nullopt;
+        return element_size_log2 == 1 ? Kind::kI16x8Mul : Kind::kI32x4Mul;
+      case WordBinopOp::Kind::kBitwiseAnd:
+        return Kind::kS128And;
+      case WordBinopOp::Kind::kBitwiseOr:
+        return Kind::kS128Or;
+      case WordBinopOp::Kind::kBitwiseXor:
+        return Kind::kS128Xor;
+      default:
+        return std::nullopt;
+    }
+  }
+
+  static std::optional<Simd128BinopOp::Kind> GetFloatBinopKind(
+      FloatBinopOp::Kind kind, ElementKind element_kind) {
+    using Kind = Simd128BinopOp::Kind;
+    bool is_float32 = element_kind == ElementKind::kFloat32;
+    switch (kind) {
+      case FloatBinopOp::Kind::kAdd:
+        return is_float32 ? Kind::kF32x4Add : Kind::kF64x2Add;
+      case FloatBinopOp::Kind::kSub:
+        return is_float32 ? Kind::kF32x4Sub : Kind::kF64x2Sub;
+      case FloatBinopOp::Kind::kMul:
+        return is_float32 ? Kind::kF32x4Mul : Kind::kF64x2Mul;
+      case FloatBinopOp::Kind::kDiv:
+        return is_float32 ? Kind::kF32x4Div : Kind::kF64x2Div;
+      default:
+        return std::nullopt;
+    }
+  }
+
+  static Simd128SplatOp::Kind GetSplatKind(const VectorizableLoop& loop) {
+    switch (loop.element_kind) {
+      case ElementKind::kInt:
+        return loop.element_size_log2 == 0   ? Simd128SplatOp::Kind::kI8x16
+               : loop.element_size_log2 == 1 ? Simd128SplatOp::Kind::kI16x8
+                                             : Simd128SplatOp::Kind::kI32x4;
+      case ElementKind::kFloat32:
+        return Simd128SplatOp::Kind::kF32x4;
+      case ElementKind::kFloat64:
+        return Simd128SplatOp::Kind::kF64x2;
+    }
+  }
+
+  V<WordPtr> BuildTypedArrayDataPointer(OpIndex base, OpIndex external) {
+    // Same as MachineLoweringReducer::BuildTypedArrayDataPointer.
+    V<Object> og_base = __ MapToNewGraph(V<Object>::Cast(base));
+    V<WordPtr> og_external = __ MapToNewGraph(V<WordPtr>::Cast(external));
+    if (__ matcher().MatchZero(og_base)) return og_external;
+    V<WordPtr> untagged_base = __ BitcastTaggedToWordPtr(og_base);
+    if (COMPRESS_POINTERS_BOOL) {
+      untagged_base =
+          __ ChangeUint32ToUintPtr(__ TruncateWordPtrToWord32(untagged_base));
+    }
+    return __ WordPtrAdd(untagged_base, og_external);
+  }
+
+  // Returns a condition that is true if vectorizing the accesses of {loop}
+  // could be observable: this is the case if an array that is written to
+  // starts less than 128 bits after another one. Accesses to the same array
+  // at the same index, and accesses to arrays starting before the written one
+  // (which are read before being written to by the scalar loop as well) are
+  // fine.
+  OptionalV<Word32> BuildOverlapCheck(const VectorizableLoop& loop) {
+    const Graph& graph = __ input_graph();
+    base::SmallVector<std::pair<OpIndex, OpIndex>, 8> stores, accesses;
+    for (const Operation& op : graph.operations(*loop.body)) {
+      if (const LoadTypedElementOp* load = op.TryCast<LoadTypedElementOp>()) {
+        accesses.emplace_back(load->base(), load->external());
+      } else if (const StoreTypedElementOp* store =
+                     op.TryCast<StoreTypedElementOp>()) {
+        stores.emplace_back(store->base(), store->external());
+        accesses.emplace_back(store->base(), store->external());
+      }
+    }
+    OptionalV<Word32> overlap = OptionalV<Word32>::Nullopt();
+    for (auto [store_base, store_external] : stores) {
+      for (auto [base, external] : accesses) {
+        if (store_base == base && store_external == external) continue;
+        V<WordPtr> distance = __ WordPtrSub(
+            BuildTypedArrayDataPointer(store_base, store_external),
+            BuildTypedArrayDataPointer(base, external));
+        // 0 < distance < kSimd128Size
+        V<Word32> overlaps =
+            __ UintPtrLessThan(__ WordPtrSub(distance, 1), kSimd128Size - 1);
+        overlap = overlap.has_value()
+                      ? __ Word32BitwiseOr(overlap.value(), overlaps)
+                      : overlaps;
+      }
+    }
+    return overlap;
+  }
+
+  V<FrameState> MapFrameState(OpIndex index, V<Word32> induction_variable,
+                              const VectorizableLoop& loop) {
+    if (!IsInLoop(index, loop)) {
+      return __ MapToNewGraph(V<FrameState>::Cast(index));
+    }
+    const FrameStateOp& frame_state =
+        __ input_graph().Get(index).template Cast<FrameStateOp>();
+    base::SmallVector<OpIndex, 32> inputs;
+    for (OpIndex input : frame_state.inputs()) {
+      const Operation& input_op = __ input_graph().Get(input);
+      if (input == loop.phi) {
+        inputs.push_back(induction_variable);
+      } else if (input_op.Is<FrameStateOp>()) {
+        inputs.push_back(MapFrameState(input, induction_variable, loop));
+      } else {
+        inputs.push_back(GetScalar(input, loop));
+      }
+    }
+    return __ FrameState(base::VectorOf(inputs), frame_state.inlined,
+                         frame_state.data);
+  }
+
+  // Returns the loop-invariant scalar {index} in the new graph. Constants of
+  // the loop are re-emitted.
+  OpIndex GetScalar(OpIndex index, const VectorizableLoop& loop) {
+    if (!IsInLoop(index, loop)) return __ MapToNewGraph(index);
+    const ConstantOp& cst =
+        __ input_graph().Get(index).template Cast<ConstantOp>();
+    return __ ReduceConstant(cst.kind, cst.storage);
+  }
+
+  V<Simd128> GetVector(
+      OpIndex index, const VectorizableLoop& loop,
+      const ZoneAbslFlatHashMap<OpIndex, V<Simd128>>& vectors) {
+    if (auto it = vectors.find(index); it != vectors.end()) return it->second;
+    // Loop-invariant scalar.
+    const Operation& op = __ input_graph().Get(index);
+    OpIndex scalar;
+    if (loop.element_kind == ElementKind::kFloat32 &&
+        op.outputs_rep()[0] == RegisterRepresentation::Float64()) {
+      // Float32 value extended to float64 (see IsVectorOrScalar).
+      if (const ConstantOp* cst = op.TryCast<ConstantOp>()) {
+        scalar = __ Float32Constant(
+            DoubleToFloat32(cst->float64().get_scalar()));
+      } else {
+        scalar = __ MapToNewGraph(op.template Cast<ChangeOp>().input());
+      }
+    } else {
+      scalar = GetScalar(index, loop);
+    }
+    return __ Simd128Splat(scalar, GetSplatKind(loop));
+  }
+
+  // Emits the vector loop and returns the first iteration that it didn't
+  // process.
+  V<Word32> EmitVectorLoop(const VectorizableLoop& loop) {
+    const Graph& graph = __ input_graph();
+    const PhiOp& phi = graph.Get(loop.phi).template Cast<PhiOp>();
+    // The 1st input of loop phis is the forward edge.
+    V<Word32> start = __ MapToNewGraph(V<Word32>::Cast(phi.input(0)));
+    V<Word32> bound = __ MapToNewGraph(V<Word32>::Cast(loop.bound));
+    const int lane_count = kSimd128Size >> loop.element_size_log2;
+
+    LoopLabel<Word32> vector_loop(this);
+    Label<Word32> done(this);
+
+    if (OptionalV<Word32> overlap = BuildOverlapCheck(loop);
+        overlap.has_value()) {
+      GOTO_IF(UNLIKELY(overlap.value()), done, start);
+    }
+    GOTO(vector_loop, start);
+
+    BIND_LOOP(vector_loop, i) {
+      if (loop.stack_check) {
+        __ SetCurrentOrigin(graph.Index(*loop.stack_check));
+        __ JSLoopStackCheck(
+            __ MapToNewGraph(loop.stack_check->native_context()),
+            MapFrameState(loop.stack_check->frame_state().value(), i, loop));
+      }
+
+      // All lanes have to pass the loop condition and the bounds checks. This
+      // is computed on WordPtr to avoid overflows.
+      V<WordPtr> first_lane = __ ChangeInt32ToIntPtr(i);
+      V<WordPtr> last_lane = __ WordPtrAdd(first_lane, lane_count - 1);
+      V<Word32> in_bounds =
+          __ IntPtrLessThan(last_lane, __ ChangeInt32ToIntPtr(bound));
+      if (!loop.bounds_checks.empty()) {
+        in_bounds = __ Word32BitwiseAnd(
+            in_bounds, __ IntPtrLessThanOrEqual(0, first_lane));
+      }
+      for (const BoundsCheck& check : loop.bounds_checks) {
+        V<WordPtr> length =
+            check.rep == RegisterRepresentation::Word32()
+                ? __ ChangeUint32ToUintPtr(
+                      V<Word32>::Cast(GetScalar(check.length, loop)))
+                : V<WordPtr>::Cast(GetScalar(check.length, loop));
+        in_bounds = __ Word32BitwiseAnd(in_bounds,
+                                        __ UintPtrLessThan(last_lane, length));
+      }
+      GOTO_IF_NOT(LIKELY(in_bounds), done, i);
+
+      ZoneAbslFlatHashMap<OpIndex, V<Simd128>> vectors(__ phase_zone());
+      for (OpIndex index : graph.OperationIndices(*loop.body)) {
+        std::optional<Lane> lane = LaneOf(index);
+        if (!lane.has_value() || *lane == any_of(Lane::kIndex32,
+                                                 Lane::kIndexPtr)) {
+          continue;
+        }
+        const Operation& op = graph.Get(index);
+        __ SetCurrentOrigin(index);
+        if (const LoadTypedElementOp* load = op.TryCast<LoadTypedElementOp>()) {
+          V<WordPtr> data = BuildTypedArrayDataPointer(load->base(),
+                                                       load->external());
+          vectors[index] = V<Simd128>::Cast(__ Load(
+              data, first_lane, LoadOp::Kind::RawAligned().NotLoadEliminable(),
+              MemoryRepresentation::Simd128(), 0, loop.element_size_log2));
+          __ Retain(__ MapToNewGraph(V<Object>::Cast(load->buffer())));
+        } else if (const StoreTypedElementOp* store =
+                       op.TryCast<StoreTypedElementOp>()) {
+          V<WordPtr> data = BuildTypedArrayDataPointer(store->base(),
+                                                       store->external());
+          __ Store(data, first_lane, vectors.at(store->value()),
+                   StoreOp::Kind::RawAligned(), MemoryRepresentation::Simd128(),
+                   WriteBarrierKind::kNoWriteBarrier, 0,
+                   loop.element_size_log2);
+          __ Retain(__ MapToNewGraph(V<Object>::Cast(store->buffer())));
+        } else if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+          // Conversions between float32 and float64 are no-ops on vectors of
+          // float32 values.
+          vectors[index] = vectors.at(change->input());
+        } else if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+          vectors[index] = __ Simd128Binop(
+              GetVector(binop->left(), loop, vectors),
+              GetVector(binop->right(), loop, vectors),
+              *GetIntegerBinopKind(binop->kind, loop.element_size_log2));
+        } else if (const FloatBinopOp* binop = op.TryCast<FloatBinopOp>()) {
+          vectors[index] = __ Simd128Binop(
+              GetVector(binop->left(), loop, vectors),
+              GetVector(binop->right(), loop, vectors),
+              *GetFloatBinopKind(binop->kind, loop.element_kind));
+        } else {
+          DCHECK_EQ(*lane, Lane::kSkipped);
+        }
+      }
+      GOTO(vector_loop, __ Word32Add(i, lane_count));
+    }
+
+    BIND(done, vector_end);
+    return vector_end;
+  }
+
+  // Lanes of the operations of the loop that is being analyzed or
+  // vectorized.
+  ZoneAbslFlatHashMap<OpIndex, Lane> lanes_{__ phase_zone()};
+  ZoneAbslFlatHashMap<OpIndex, V<Word32>> vectorized_loops_entry_{
+      __ phase_zone()};
+  LoopFinder loop_finder_{__ phase_zone(), &__ modifiable_input_graph()};
+};
+
+#undef TRACE
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_TYPED_ARRAY_VECTORIZATION_REDUCER_H_
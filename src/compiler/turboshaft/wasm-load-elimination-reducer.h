@@ -48,6 +48,13 @@ static constexpr int kAssertNotNullIndex = -5;
 static constexpr wasm::ModuleTypeIndex kLoadLikeType{wasm::HeapType::kExtern};
 static constexpr int kLoadLikeSize = 4;  // Chosen by fair dice roll.
 
+// Array elements at constant indices are tracked like struct fields, but only
+// on arrays that are known not to alias. Since array.set/array.get don't carry
+// a type index, all elements share the generic array type, which is unrelated
+// to every struct type.
+static constexpr wasm::ModuleTypeIndex kArrayElementType{
+    wasm::HeapType::kArray};
+
 struct WasmMemoryAddress {
   OpIndex base;
   int32_t offset;
@@ -170,6 +177,25 @@ class WasmMemoryContentTable
     }
   }
 
+  // Invalidates the array elements tracked for {base}, as well as those of
+  // every array that may alias with it.
+  void InvalidateArrayElements(OpIndex base) {
+    for (auto& base_keys : base_keys_) {
+      OpIndex key_base = base_keys.first;
+      if (key_base != base && non_aliasing_objects_.Get(key_base)) continue;
+      for (auto it = base_keys.second.with_offsets.begin();
+           it != base_keys.second.with_offsets.end();) {
+        Key key = *it;
+        if (key.data().mem.type_index != kArrayElementType) {
+          ++it;
+          continue;
+        }
+        it = base_keys.second.with_offsets.RemoveAt(it);
+        Set(key, OpIndex::Invalid());
+      }
+    }
+  }
+
   // Invalidates all Keys that are not known as non-aliasing.
   enum class EntriesWithOffsets { kInvalidate, kKeep };
   template <EntriesWithOffsets offsets = EntriesWithOffsets::kInvalidate>
@@ -221,6 +247,22 @@ class WasmMemoryContentTable
     return all_keys_.find(mem) != all_keys_.end();
   }
 
+  // Returns the offset of element {index}, or -1 if it can't be tracked.
+  static int32_t element_offset(wasm::ValueType element_type,
+                                uint32_t index) {
+    uint32_t size = element_type.value_kind_size();
+    if (index >= static_cast<uint32_t>(WasmArray::MaxLength(size))) return -1;
+    return WasmArray::kHeaderSize + static_cast<int32_t>(index * size);
+  }
+
+  OpIndex FindArrayElement(const ArrayGetOp& get, uint32_t index) {
+    wasm::ValueType element_type = get.array_type->element_type();
+    int32_t offset = element_offset(element_type, index);
+    if (offset < 0) return OpIndex::Invalid();
+    return FindImpl(ResolveBase(get.array()), offset, kArrayElementType,
+                    element_type.value_kind_size(), true);
+  }
+
   OpIndex FindLoadLike(OpIndex op_idx, int offset_sentinel) {
     static constexpr bool mutability = false;
     return FindImpl(ResolveBase(op_idx), offset_sentinel, kLoadLikeType,
@@ -252,6 +294,14 @@ class WasmMemoryContentTable
     Insert(base, offset, get.type_index, size, mutability, get_idx);
   }
 
+  void InsertArrayElement(OpIndex base_idx, wasm::ValueType element_type,
+                          uint32_t index, OpIndex value_idx) {
+    int32_t offset = element_offset(element_type, index);
+    if (offset < 0) return;
+    Insert(ResolveBase(base_idx), offset, kArrayElementType,
+           element_type.value_kind_size(), true, value_idx);
+  }
+
   void InsertLoadLike(OpIndex base_idx, int offset_sentinel,
                       OpIndex value_idx) {
     OpIndex base = ResolveBase(base_idx);
@@ -449,6 +499,8 @@ class WasmLoadEliminationAnalyzer {
   void ProcessBlock(const Block& block, bool compute_start_snapshot);
   void ProcessStructGet(OpIndex op_idx, const StructGetOp& op);
   void ProcessStructSet(OpIndex op_idx, const StructSetOp& op);
+  void ProcessArrayGet(OpIndex op_idx, const ArrayGetOp& op);
+  void ProcessArraySet(OpIndex op_idx, const ArraySetOp& op);
   void ProcessArrayLength(OpIndex op_idx, const ArrayLengthOp& op);
   void ProcessWasmAllocateArray(OpIndex op_idx, const WasmAllocateArrayOp& op);
   void ProcessStringAsWtf16(OpIndex op_idx, const StringAsWtf16Op& op);
@@ -529,6 +581,7 @@ class WasmLoadEliminationReducer : public Next {
   }
 
   EMIT_OP(StructGet)
+  EMIT_OP(ArrayGet)
   EMIT_OP(ArrayLength)
   EMIT_OP(StringAsWtf16)
   EMIT_OP(StringPrepareForGetCodeUnit)
@@ -581,6 +634,12 @@ void WasmLoadEliminationAnalyzer::ProcessBlock(const Block& block,
       case Opcode::kStructSet:
         ProcessStructSet(op_idx, op.Cast<StructSetOp>());
         break;
+      case Opcode::kArrayGet:
+        ProcessArrayGet(op_idx, op.Cast<ArrayGetOp>());
+        break;
+      case Opcode::kArraySet:
+        ProcessArraySet(op_idx, op.Cast<ArraySetOp>());
+        break;
       case Opcode::kArrayLength:
         ProcessArrayLength(op_idx, op.Cast<ArrayLengthOp>());
         break;
@@ -602,8 +661,6 @@ void WasmLoadEliminationAnalyzer::ProcessBlock(const Block& block,
         // a "load-like" instruction too, to eliminate repeated casts.
         ProcessAssertNotNull(op_idx, op.Cast<AssertNotNullOp>());
         break;
-      case Opcode::kArraySet:
-        break;
       case Opcode::kAllocate:
         // Create new non-alias.
         ProcessAllocate(op_idx, op.Cast<AllocateOp>());
@@ -755,6 +812,50 @@ void WasmLoadEliminationAnalyzer::ProcessStructSet(OpIndex op_idx,
   }
 }
 
+void WasmLoadEliminationAnalyzer::ProcessArrayGet(OpIndex op_idx,
+                                                  const ArrayGetOp& get) {
+  replacements_[op_idx] = OpIndex::Invalid();
+  OpIndex base = memory_.ResolveBase(get.array());
+  uint32_t index;
+  if (!non_aliasing_objects_.Get(base) ||
+      !OperationMatcher(graph_).MatchIntegralWord32Constant(get.index(),
+                                                            &index)) {
+    return;
+  }
+  OpIndex existing = memory_.FindArrayElement(get, index);
+  if (existing.valid()) {
+    const Operation& replacement = graph_.Get(existing);
+    DCHECK_EQ(replacement.outputs_rep().size(), 1);
+    DCHECK_EQ(get.outputs_rep().size(), 1);
+    uint8_t size = get.array_type->element_type().value_kind_size();
+    if (RepIsCompatible(replacement.outputs_rep()[0], get.outputs_rep()[0],
+                        size)) {
+      replacements_[op_idx] = existing;
+      return;
+    }
+  }
+  memory_.InsertArrayElement(base, get.array_type->element_type(), index,
+                             op_idx);
+}
+
+void WasmLoadEliminationAnalyzer::ProcessArraySet(OpIndex op_idx,
+                                                  const ArraySetOp& set) {
+  OpIndex base = memory_.ResolveBase(set.array());
+  uint32_t index;
+  if (non_aliasing_objects_.Get(base) &&
+      OperationMatcher(graph_).MatchIntegralWord32Constant(set.index(),
+                                                           &index)) {
+    // Nothing else can point to {base}, so only this element changes.
+    memory_.InsertArrayElement(base, set.element_type, index, set.value());
+  } else {
+    memory_.InvalidateArrayElements(base);
+  }
+
+  // Like for struct.set, the stored value can now be reached through the
+  // array.
+  InvalidateIfAlias(set.value());
+}
+
 void WasmLoadEliminationAnalyzer::ProcessArrayLength(
     OpIndex op_idx, const ArrayLengthOp& length) {
   static constexpr int offset = wle::kArrayLengthFieldIndex;
@@ -900,6 +900,8 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
   OpIndex node1 = node_group[1];
   Operation& op0 = graph_.Get(node0);
   Operation& op1 = graph_.Get(node1);
+  last_visited_nodes_[0] = node0;
+  last_visited_nodes_[1] = node1;
 
   if (recursion_depth == RecursionMaxDepth) {
     TRACE("Failed due to max recursion depth!\n");
@@ -1423,18 +1425,29 @@ void WasmRevecAnalyzer::Run() {
       store_seeds_.begin(), store_seeds_.end(), phase_zone_);
   all_seeds.insert(all_seeds.end(), reduce_seeds_.begin(), reduce_seeds_.end());
 
+  size_t failed_trees = 0;
   for (auto pair : all_seeds) {
     NodeGroup roots(pair.first, pair.second);
     SLPTree slp_tree(graph_, this, phase_zone_);
     PackNode* root = slp_tree.BuildTree(roots);
     if (!root) {
-      TRACE("Build tree failed!\n");
+      ++failed_trees;
+      if (v8_flags.trace_wasm_revectorize) {
+        OpIndex failed0 = slp_tree.last_visited_node(0);
+        OpIndex failed1 = slp_tree.last_visited_node(1);
+        TRACE("Build tree failed for seed (#%u, #%u) at (#%u:%s, #%u:%s)\n",
+              pair.first.id(), pair.second.id(), failed0.id(),
+              GetSimdOpcodeName(graph_.Get(failed0)).c_str(), failed1.id(),
+              GetSimdOpcodeName(graph_.Get(failed1)).c_str());
+      }
       continue;
     }
 
     slp_tree.Print("After build tree");
     MergeSLPTree(slp_tree);
   }
+  TRACE("Built %zu of %zu trees\n", all_seeds.size() - failed_trees,
+        all_seeds.size());
 
   // Early exist when no revectorizable node found.
   if (revectorizable_node_.empty()) return;
@@ -1442,6 +1455,8 @@ void WasmRevecAnalyzer::Run() {
   // Build SIMD usemap
   use_map_ = phase_zone_->New<SimdUseMap>(graph_, phase_zone_);
   if (!DecideVectorize()) {
+    TRACE("Not revectorizing: packing %zu nodes does not pay off\n",
+          revectorizable_node_.size());
     revectorizable_node_.clear();
     revectorizable_intersect_node_.clear();
   } else {
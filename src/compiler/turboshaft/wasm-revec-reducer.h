@@ -500,6 +500,12 @@ class SLPTree : public NON_EXPORTED_BASE(ZoneObject) {
 
   void Print(const char* info);
 
+  // The node group that was visited last by BuildTree. If building the tree
+  // failed, this is the group that could not be packed (used for tracing).
+  OpIndex last_visited_node(int index) const {
+    return last_visited_nodes_[index];
+  }
+
  private:
   // This is the recursive part of BuildTree.
   PackNode* BuildTreeRec(const NodeGroup& node_group, unsigned depth);
@@ -580,6 +586,7 @@ class SLPTree : public NON_EXPORTED_BASE(ZoneObject) {
   ZoneUnorderedMap<OpIndex, PackNode*> node_to_packnode_;
   // Maps a node to multiple IntersectPackNodes.
   ZoneUnorderedMap<OpIndex, ZoneVector<PackNode*>> node_to_intersect_packnodes_;
+  OpIndex last_visited_nodes_[2];
   static constexpr size_t RecursionMaxDepth = 1000;
 };
 
@@ -32,10 +32,12 @@
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
 #include "include/v8-profiler.h"
+#include "include/v8-statistics.h"
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/base/cpu.h"
 #include "src/base/logging.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
@@ -4866,8 +4868,51 @@ bool ends_with(const char* input, const char* suffix) {
   return false;
 }
 
+// Accumulates the execution and GC time of one SourceGroup::Execute() call
+// into the group's throughput statistics.
+class SourceGroup::ThroughputScope {
+ public:
+  ThroughputScope(Isolate* isolate, ThroughputStats* stats)
+      : isolate_(isolate), stats_(stats) {
+    isolate_->AddGCPrologueCallback(&GCPrologue, this);
+    isolate_->AddGCEpilogueCallback(&GCEpilogue, this);
+    timer_.Start();
+  }
+  ~ThroughputScope() {
+    stats_->execution_time += timer_.Elapsed();
+    stats_->runs++;
+    isolate_->RemoveGCPrologueCallback(&GCPrologue, this);
+    isolate_->RemoveGCEpilogueCallback(&GCEpilogue, this);
+    HeapStatistics heap_statistics;
+    isolate_->GetHeapStatistics(&heap_statistics);
+    stats_->physical_heap_size = std::max(
+        stats_->physical_heap_size, heap_statistics.total_physical_size());
+  }
+
+ private:
+  static void GCPrologue(Isolate* isolate, GCType type,
+                         GCCallbackFlags flags, void* data) {
+    static_cast<ThroughputScope*>(data)->gc_start_ = base::TimeTicks::Now();
+  }
+  static void GCEpilogue(Isolate* isolate, GCType type,
+                         GCCallbackFlags flags, void* data) {
+    ThroughputScope* scope = static_cast<ThroughputScope*>(data);
+    scope->stats_->gc_time += base::TimeTicks::Now() - scope->gc_start_;
+    scope->stats_->gc_count++;
+  }
+
+  Isolate* isolate_;
+  ThroughputStats* stats_;
+  base::ElapsedTimer timer_;
+  base::TimeTicks gc_start_;
+};
+
 bool SourceGroup::Execute(Isolate* isolate) {
   bool success = true;
+  std::optional<ThroughputScope> throughput_scope;
+  if (Shell::options.replicate_isolates > 0) {
+    throughput_scope.emplace(isolate, &throughput_stats_);
+  }
 #ifdef V8_FUZZILLI
   if (fuzzilli_reprl) {
     HandleScope handle_scope(isolate);
@@ -5581,6 +5626,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.ignore_unhandled_promises = true;
     } else if (FlagMatches("--isolate", &argv[i], /*keep_flag=*/true)) {
       options.num_isolates++;
+    } else if (FlagWithArgMatches("--replicate-isolates", &flag_value, argc,
+                                  argv, &i)) {
+      options.replicate_isolates = atoi(flag_value);
     } else if (FlagMatches("--throws", &argv[i])) {
       options.expected_to_throw = true;
     } else if (FlagMatches("--no-fail", &argv[i])) {
@@ -5765,6 +5813,13 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     FATAL("Flag --expose-fast-api is incompatible with --stress-snapshot.");
   }
 
+  if (options.replicate_isolates > 0) {
+    if (options.num_isolates > 1) {
+      FATAL("Flag --replicate-isolates is incompatible with --isolate.");
+    }
+    options.num_isolates = options.replicate_isolates;
+  }
+
   // Set up isolated source groups.
   options.isolate_sources = new SourceGroup[options.num_isolates];
   internal::g_num_isolates_for_testing = options.num_isolates;
@@ -5790,6 +5845,11 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     }
   }
   current->End(argc);
+  // With --replicate-isolates, every isolate runs the same sources.
+  for (int i = 1; i < options.replicate_isolates; ++i) {
+    options.isolate_sources[i].Begin(argv, 1);
+    options.isolate_sources[i].End(argc);
+  }
 
   if (!logfile_per_isolate && options.num_isolates) {
     V8::SetFlagsFromString("--no-logfile-per-isolate");
@@ -5800,6 +5860,10 @@ bool Shell::SetOptions(int argc, char* argv[]) {
 
 int Shell::RunMain(v8::Isolate* isolate, bool last_run) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  // Wall time of all runs with --replicate-isolates.
+  static base::TimeDelta replicated_wall_time;
+  base::ElapsedTimer wall_timer;
+  wall_timer.Start();
 
   for (int i = 1; i < options.num_isolates; ++i) {
     options.isolate_sources[i].StartExecuteInThread();
@@ -5825,6 +5889,10 @@ int Shell::RunMain(v8::Isolate* isolate, bool last_run) {
         }
         WaitForRunningWorkers(parked);
       });
+  if (options.replicate_isolates > 0) {
+    replicated_wall_time += wall_timer.Elapsed();
+    if (last_run) PrintThroughputStats(replicated_wall_time);
+  }
 
   // Other threads have terminated, we can now run the artificial
   // serialize-deserialize pass (which destructively mutates heap state).
@@ -5871,6 +5939,36 @@ int Shell::RunMain(v8::Isolate* isolate, bool last_run) {
   return (success == Shell::options.expected_to_throw ? 1 : 0);
 }
 
+void Shell::PrintThroughputStats(base::TimeDelta wall_time) {
+  int total_runs = 0;
+  base::TimeDelta total_gc_time;
+  int total_gc_count = 0;
+  for (int i = 0; i < options.num_isolates; ++i) {
+    const SourceGroup::ThroughputStats& stats =
+        options.isolate_sources[i].throughput_stats();
+    const double seconds = stats.execution_time.InSecondsF();
+    printf(
+        "Isolate %d: %d runs in %.3f ms (%.3f runs/s), GC %.3f ms in %d "
+        "collections, physical heap %zu KB\n",
+        i, stats.runs, stats.execution_time.InMillisecondsF(),
+        seconds > 0 ? stats.runs / seconds : 0.0,
+        stats.gc_time.InMillisecondsF(), stats.gc_count,
+        stats.physical_heap_size / i::KB);
+    total_runs += stats.runs;
+    total_gc_time += stats.gc_time;
+    total_gc_count += stats.gc_count;
+  }
+  const double seconds = wall_time.InSecondsF();
+  printf(
+      "All %d isolates: %d runs in %.3f ms (%.3f runs/s), GC %.3f ms in %d "
+      "collections, peak RSS %d KB\n",
+      options.num_isolates, total_runs, wall_time.InMillisecondsF(),
+      seconds > 0 ? total_runs / seconds : 0.0,
+      total_gc_time.InMillisecondsF(), total_gc_count,
+      base::OS::GetPeakMemoryUsageKb());
+  fflush(stdout);
+}
+
 bool Shell::RunMainIsolate(v8::Isolate* isolate, bool keep_context_alive) {
   if (options.lcov_file) {
     debug::Coverage::SelectMode(isolate, debug::CoverageMode::kBlockCount);
@@ -111,7 +111,20 @@ class SourceGroup {
   void WaitForThread(const i::ParkedScope& parked);
   void JoinThread(const i::ParkedScope& parked);
 
+  // Statistics about the executions of this group, which are only collected
+  // with --replicate-isolates.
+  struct ThroughputStats {
+    int runs = 0;
+    base::TimeDelta execution_time;
+    base::TimeDelta gc_time;
+    int gc_count = 0;
+    size_t physical_heap_size = 0;
+  };
+  const ThroughputStats& throughput_stats() const { return throughput_stats_; }
+
  private:
+  class ThroughputScope;
+
   class IsolateThread : public base::Thread {
    public:
     explicit IsolateThread(SourceGroup* group);
@@ -133,6 +146,7 @@ class SourceGroup {
   const char** argv_;
   int begin_offset_;
   int end_offset_;
+  ThroughputStats throughput_stats_;
 };
 
 class SerializationData {
@@ -464,6 +478,7 @@ class ShellOptions {
       "multi-mapped-mock-allocator", false};
   DisallowReassignment<bool> enable_inspector = {"enable-inspector", false};
   int num_isolates = 1;
+  DisallowReassignment<int> replicate_isolates = {"replicate-isolates", 0};
   DisallowReassignment<v8::ScriptCompiler::CompileOptions, true>
       compile_options = {"cache", v8::ScriptCompiler::kNoCompileOptions};
   DisallowReassignment<CodeCacheOptions, true> code_cache_options = {
@@ -769,6 +784,7 @@ class Shell : public i::AllStatic {
   static bool is_valid_fuzz_script() { return valid_fuzz_script_.load(); }
 
   static void WaitForRunningWorkers(const i::ParkedScope& parked);
+  static void PrintThroughputStats(base::TimeDelta wall_time);
   static void AddRunningWorker(std::shared_ptr<Worker> worker);
   static void RemoveRunningWorker(const std::shared_ptr<Worker>& worker);
 
@@ -4,6 +4,7 @@
 
 #include "src/date/date.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "src/base/overflowing-math.h"
@@ -55,6 +56,8 @@ void DateCache::ResetDateCache(
   before_ = &cache_[0];
   after_ = &cache_[1];
   ymd_valid_ = false;
+  transitions_.clear();
+  transitions_state_ = TransitionTableState::kUninitialized;
 #ifdef V8_INTL_SUPPORT
   if (!v8_flags.icu_timezone_data) {
 #endif
@@ -270,6 +273,52 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   return static_cast<int>(offset);
 }
 
+bool DateCache::GetLocalOffsetTransitionsFromOS(
+    int64_t start_ms, int64_t end_ms,
+    std::vector<OffsetTransition>* transitions) {
+  std::vector<base::TimezoneCache::OffsetTransition> os_transitions;
+  if (!tz_cache_->LocalTimeOffsetTransitions(static_cast<double>(start_ms),
+                                             static_cast<double>(end_ms),
+                                             &os_transitions)) {
+    return false;
+  }
+  transitions->reserve(os_transitions.size());
+  for (const auto& transition : os_transitions) {
+    transitions->push_back({static_cast<int64_t>(transition.time_ms),
+                            static_cast<int>(transition.offset_ms)});
+  }
+  return true;
+}
+
+bool DateCache::LookupTransitionTable(int64_t time_ms, int* offset_ms) {
+  if (time_ms < kTransitionTableStartMs || time_ms >= kTransitionTableEndMs) {
+    return false;
+  }
+  if (V8_UNLIKELY(transitions_state_ != TransitionTableState::kReady)) {
+    if (transitions_state_ == TransitionTableState::kUnavailable) return false;
+    transitions_state_ = TransitionTableState::kUnavailable;
+    if (!GetLocalOffsetTransitionsFromOS(kTransitionTableStartMs,
+                                         kTransitionTableEndMs - 1,
+                                         &transitions_) ||
+        transitions_.empty() ||
+        transitions_[0].time_ms != kTransitionTableStartMs) {
+      transitions_.clear();
+      return false;
+    }
+    transitions_.shrink_to_fit();
+    transitions_state_ = TransitionTableState::kReady;
+  }
+  // Find the last transition at or before {time_ms}.
+  auto it = std::upper_bound(
+      transitions_.begin(), transitions_.end(), time_ms,
+      [](int64_t time, const OffsetTransition& transition) {
+        return time < transition.time_ms;
+      });
+  DCHECK(it != transitions_.begin());
+  *offset_ms = (it - 1)->offset_ms;
+  return true;
+}
+
 void DateCache::ExtendTheAfterSegment(int64_t time_ms, int offset_ms) {
   if (!InvalidSegment(after_) && after_->offset_ms == offset_ms &&
       after_->start_ms - kDefaultTimeZoneOffsetDeltaInMs <= time_ms &&
@@ -301,6 +350,13 @@ int DateCache::LocalOffsetInMs(int64_t time_ms, bool is_utc) {
     known_correct_result = GetLocalOffsetFromOS(time_ms, is_utc);
   }
 #endif  // ENABLE_SLOW_DCHECKS
+  // Most times fall into the range of the transition table (when there is
+  // one), which doesn't need the segment cache below.
+  int table_offset_ms;
+  if (LookupTransitionTable(time_ms, &table_offset_ms)) {
+    SLOW_DCHECK(table_offset_ms == known_correct_result);
+    return table_offset_ms;
+  }
   // Invalidate cache if the usage counter is close to overflow.
   // Note that cache_usage_counter is incremented less than ten times
   // in this function.
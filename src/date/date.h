@@ -6,6 +6,7 @@
 #define V8_DATE_DATE_H_
 
 #include <cmath>
+#include <vector>
 
 #include "src/base/small-vector.h"
 #include "src/base/timezone-cache.h"
@@ -178,6 +179,19 @@ class V8_EXPORT_PRIVATE DateCache {
 
   virtual int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc);
 
+  // A point in time (UTC) from which on the local offset is {offset_ms}.
+  struct OffsetTransition {
+    int64_t time_ms;
+    int offset_ms;
+  };
+
+  // Fills {transitions} with the local offset at {start_ms} and each change
+  // of it until {end_ms}, in order. Returns false if the OS (or ICU) can't
+  // enumerate them.
+  virtual bool GetLocalOffsetTransitionsFromOS(
+      int64_t start_ms, int64_t end_ms,
+      std::vector<OffsetTransition>* transitions);
+
  private:
   // The implementation relies on the fact that no time zones have more than one
   // time zone offset change (including DST offset changes) per 19 days. In
@@ -187,6 +201,13 @@ class V8_EXPORT_PRIVATE DateCache {
 
   static const int kCacheSize = 32;
 
+  // Range of UTC times [1900-01-01, 2100-01-01) covered by the transition
+  // table.
+  static const int64_t kTransitionTableStartMs = -25567 * kMsPerDay;
+  static const int64_t kTransitionTableEndMs = 47482 * kMsPerDay;
+
+  enum class TransitionTableState { kUninitialized, kReady, kUnavailable };
+
   // Stores a segment of time where time zone offset does not change.
   struct CacheItem {
     int64_t start_ms;
@@ -204,6 +225,10 @@ class V8_EXPORT_PRIVATE DateCache {
     return GetDaylightSavingsOffsetFromOS(time_sec);
   }
 
+  // Looks up the local offset of a UTC time in the transition table, which
+  // is built on first use. Returns false if there is no table.
+  bool LookupTransitionTable(int64_t time_ms, int* offset_ms);
+
   // Sets the before_ and the after_ segments from the timezone offset cache
   // such that the before_ segment starts earlier than the given time and the
   // after_ segment start later than the given time. Both segments might be
@@ -235,6 +260,11 @@ class V8_EXPORT_PRIVATE DateCache {
 
   int local_offset_ms_;
 
+  // Changes of the local offset within the transition table's range, sorted
+  // by time. The first entry starts at kTransitionTableStartMs.
+  std::vector<OffsetTransition> transitions_;
+  TransitionTableState transitions_state_;
+
   // Year/Month/Day cache.
   bool ymd_valid_;
   int ymd_days_;
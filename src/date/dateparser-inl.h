@@ -14,6 +14,14 @@ namespace internal {
 
 template <typename Char>
 bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
+  // Most strings are produced by toISOString or toUTCString; recognize those
+  // without going through the tokenizer.
+  if (TryParseISODateTime(str, out)) return true;
+  if (TryParseRFC2822DateTime(str, out)) {
+    isolate->CountUsage(v8::Isolate::kLegacyDateParser);
+    return true;
+  }
+
   InputReader<Char> in(str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
@@ -348,6 +356,176 @@ DateParser::DateToken DateParser::ParseES5DateTime(
   return DateToken::EndOfInput();
 }
 
+template <typename Char>
+int DateParser::ReadFixedLengthNumber(const Char* s, int length) {
+  int n = 0;
+  for (int i = 0; i < length; i++) {
+    if (!IsDecimalDigit(s[i])) return -1;
+    n = n * 10 + (s[i] - '0');
+  }
+  return n;
+}
+
+template <typename Char>
+bool DateParser::TryParseISODateTime(base::Vector<Char> str, double* out) {
+  // YYYY-MM-DD[THH:mm[:ss[.sss]][Z|(+|-)hh:mm]]
+  // Only the exact layout is accepted: four digit years, three digit
+  // milliseconds and no hour 24. Everything else is left to
+  // ParseES5DateTime.
+  static constexpr char kLayout[] = "dddd-dd-ddTdd:dd:dd.ddd";
+  const Char* s = str.begin();
+  int length = str.length();
+  int zone_sign = 0;
+  int layout_length = length;
+  if (length > 0 && s[length - 1] == 'Z') {
+    layout_length = length - 1;
+  } else if (length >= 6 && (s[length - 6] == '+' || s[length - 6] == '-') &&
+             s[length - 3] == ':') {
+    zone_sign = s[length - 6] == '+' ? 1 : -1;
+    layout_length = length - 6;
+  }
+  if (layout_length != 10 && layout_length != 16 && layout_length != 19 &&
+      layout_length != 23) {
+    return false;
+  }
+  // A time zone without a time is not an ES5 date-time string.
+  if (layout_length == 10 && layout_length != length) return false;
+  for (int i = 0; i < layout_length; i++) {
+    if (kLayout[i] == 'd' ? !IsDecimalDigit(s[i]) : s[i] != kLayout[i]) {
+      return false;
+    }
+  }
+
+  int month = ReadFixedLengthNumber(s + 5, 2);
+  int day = ReadFixedLengthNumber(s + 8, 2);
+  if (!DayComposer::IsMonth(month) || !DayComposer::IsDay(day)) return false;
+  int hour = 0;
+  int minute = 0;
+  int second = 0;
+  int millisecond = 0;
+  if (layout_length >= 16) {
+    hour = ReadFixedLengthNumber(s + 11, 2);
+    minute = ReadFixedLengthNumber(s + 14, 2);
+    if (layout_length >= 19) second = ReadFixedLengthNumber(s + 17, 2);
+    if (layout_length == 23) millisecond = ReadFixedLengthNumber(s + 20, 3);
+    if (!TimeComposer::IsHour(hour) || !TimeComposer::IsMinute(minute) ||
+        !TimeComposer::IsSecond(second)) {
+      return false;
+    }
+  }
+  double offset;
+  if (zone_sign != 0) {
+    int zone_hour = ReadFixedLengthNumber(s + length - 5, 2);
+    int zone_minute = ReadFixedLengthNumber(s + length - 2, 2);
+    if (!TimeComposer::IsHour(zone_hour) ||
+        !TimeComposer::IsMinute(zone_minute)) {
+      return false;
+    }
+    offset = zone_sign * (zone_hour * 3600 + zone_minute * 60);
+  } else if (layout_length != length || layout_length == 10) {
+    // "Z", or a date-only form, which is interpreted as UTC.
+    offset = 0;
+  } else {
+    offset = std::numeric_limits<double>::quiet_NaN();
+  }
+
+  out[YEAR] = ReadFixedLengthNumber(s, 4);
+  out[MONTH] = month - 1;
+  out[DAY] = day;
+  out[HOUR] = hour;
+  out[MINUTE] = minute;
+  out[SECOND] = second;
+  out[MILLISECOND] = millisecond;
+  out[UTC_OFFSET] = offset;
+  return true;
+}
+
+template <typename Char>
+bool DateParser::TryParseRFC2822DateTime(base::Vector<Char> str,
+                                         double* out) {
+  // [Www, ]D[D] Mmm YYYY[ HH:mm[:ss][ (GMT|UTC|UT|(+|-)hhmm)]]
+  // Names have to be capitalized as in toUTCString. Two digit years, which
+  // the legacy parser maps into 1950..2049, are left to the general parser.
+  static constexpr char kDayNames[] = "SunMonTueWedThuFriSat";
+  static constexpr char kMonthNames[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  auto find_name = [](const Char* s, const char* names, int count) {
+    for (int i = 0; i < count; i++) {
+      const char* name = names + 3 * i;
+      if (s[0] == name[0] && s[1] == name[1] && s[2] == name[2]) return i;
+    }
+    return -1;
+  };
+
+  const Char* s = str.begin();
+  const Char* end = str.end();
+  if (end - s >= 5 && s[3] == ',' && s[4] == ' ') {
+    if (find_name(s, kDayNames, 7) < 0) return false;
+    s += 5;
+  }
+  // Shortest remaining input is "D Mmm YYYY".
+  if (end - s < 10) return false;
+  int day = ReadFixedLengthNumber(s, 1);
+  if (day < 0) return false;
+  s++;
+  if (IsDecimalDigit(*s)) day = day * 10 + (*s++ - '0');
+  if (!DayComposer::IsDay(day)) return false;
+  if (end - s < 9 || s[0] != ' ' || s[4] != ' ') return false;
+  int month = find_name(s + 1, kMonthNames, 12);
+  if (month < 0) return false;
+  int year = ReadFixedLengthNumber(s + 5, 4);
+  if (year < 100) return false;
+  s += 9;
+
+  int hour = 0;
+  int minute = 0;
+  int second = 0;
+  double offset = std::numeric_limits<double>::quiet_NaN();
+  if (s != end) {
+    if (end - s < 6 || s[0] != ' ' || s[3] != ':') return false;
+    hour = ReadFixedLengthNumber(s + 1, 2);
+    minute = ReadFixedLengthNumber(s + 4, 2);
+    s += 6;
+    if (end - s >= 3 && s[0] == ':') {
+      second = ReadFixedLengthNumber(s + 1, 2);
+      s += 3;
+    }
+    if (!TimeComposer::IsHour(hour) || !TimeComposer::IsMinute(minute) ||
+        !TimeComposer::IsSecond(second)) {
+      return false;
+    }
+    if (s != end) {
+      if (s[0] != ' ') return false;
+      s++;
+      int zone_length = static_cast<int>(end - s);
+      if ((zone_length == 3 && ((s[0] == 'G' && s[1] == 'M' && s[2] == 'T') ||
+                                (s[0] == 'U' && s[1] == 'T' && s[2] == 'C'))) ||
+          (zone_length == 2 && s[0] == 'U' && s[1] == 'T')) {
+        offset = 0;
+      } else if (zone_length == 5 && (s[0] == '+' || s[0] == '-')) {
+        int zone_hour = ReadFixedLengthNumber(s + 1, 2);
+        int zone_minute = ReadFixedLengthNumber(s + 3, 2);
+        if (!TimeComposer::IsHour(zone_hour) ||
+            !TimeComposer::IsMinute(zone_minute)) {
+          return false;
+        }
+        offset = (s[0] == '+' ? 1 : -1) * (zone_hour * 3600 + zone_minute * 60);
+      } else {
+        return false;
+      }
+    }
+  }
+
+  out[YEAR] = year;
+  out[MONTH] = month;
+  out[DAY] = day;
+  out[HOUR] = hour;
+  out[MINUTE] = minute;
+  out[SECOND] = second;
+  out[MILLISECOND] = 0;
+  out[UTC_OFFSET] = offset;
+  return true;
+}
+
 }  // namespace internal
 }  // namespace v8
 
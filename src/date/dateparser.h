@@ -360,6 +360,21 @@ class DateParser : public AllStatic {
   static DateParser::DateToken ParseES5DateTime(
       DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
       TimeZoneComposer* tz);
+
+  // Fast paths for the fixed layouts produced by Date.prototype.toISOString
+  // and Date.prototype.toUTCString (RFC 2822). They fill out the output
+  // array exactly like the general parser would and return true, or return
+  // false if the input does not match the layout, in which case the general
+  // parser has to handle it.
+  template <typename Char>
+  static bool TryParseISODateTime(base::Vector<Char> str, double* out);
+  template <typename Char>
+  static bool TryParseRFC2822DateTime(base::Vector<Char> str, double* out);
+
+  // Returns the value of the |length| decimal digits starting at |s|, or -1
+  // if any of them is not a digit.
+  template <typename Char>
+  static inline int ReadFixedLengthNumber(const Char* s, int length);
 };
 
 }  // namespace internal
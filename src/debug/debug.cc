@@ -1749,6 +1749,12 @@ void Debug::DiscardBaselineCode(Tagged<SharedFunctionInfo> shared) {
   DiscardBaselineCodeVisitor visitor(shared);
   visitor.VisitThread(isolate_, isolate_->thread_local_top());
   isolate_->thread_manager()->IterateArchivedThreads(&visitor);
+  FlushBaselineCode(shared);
+}
+
+void Debug::FlushBaselineCode(Tagged<SharedFunctionInfo> shared) {
+  RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
+  DCHECK(shared->HasBaselineCode());
   // TODO(v8:11429): Avoid this heap walk somehow.
   HeapObjectIterator iterator(isolate_->heap());
   auto trampoline = BUILTIN_CODE(isolate_, InterpreterEntryTrampoline);
@@ -3098,6 +3104,13 @@ void Debug::StopSideEffectCheckMode() {
 void Debug::ApplySideEffectChecks(DirectHandle<DebugInfo> debug_info) {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
   DCHECK(debug_info->HasInstrumentedBytecodeArray());
+  // Baseline code only checks for breaks at break locations, see
+  // --sparkplug-break-checks, so calls in side effect check mode have to go
+  // to the interpreter. Frames that are already active only resume after side
+  // effect check mode ends, so they can stay in baseline code.
+  if (debug_info->shared()->HasBaselineCode()) {
+    FlushBaselineCode(debug_info->shared());
+  }
   Handle<BytecodeArray> debug_bytecode(debug_info->DebugBytecodeArray(isolate_),
                                        isolate_);
   DebugEvaluate::ApplySideEffectChecks(debug_bytecode);
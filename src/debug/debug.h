@@ -330,6 +330,8 @@ class V8_EXPORT_PRIVATE Debug {
   void ClearBreakOnNextFunctionCall();
 
   void DiscardBaselineCode(Tagged<SharedFunctionInfo> shared);
+  // Like DiscardBaselineCode, but leaves active baseline frames alone.
+  void FlushBaselineCode(Tagged<SharedFunctionInfo> shared);
   void DiscardAllBaselineCode();
 
   void DeoptimizeFunction(DirectHandle<SharedFunctionInfo> shared);
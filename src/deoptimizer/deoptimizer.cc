@@ -22,6 +22,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/deoptimization-data.h"
 #include "src/objects/js-function-inl.h"
@@ -1560,6 +1561,19 @@ void Deoptimizer::DoComputeOutputFrames() {
   bytecode_offset_in_outermost_frame_ =
       translated_state_.frames()[0].bytecode_offset();
 
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate()->metrics_recorder();
+  if (V8_UNLIKELY(recorder->HasEmbedderRecorder())) {
+    Tagged<SharedFunctionInfo> shared = function_->shared();
+    Tagged<Object> script = shared->script();
+    recorder->RecordDeoptimization(
+        shared->DebugNameCStr().get(),
+        IsScript(script) ? Cast<Script>(script)->id() : -1,
+        shared->StartPosition(), bytecode_offset_in_outermost_frame_.ToInt(),
+        MessageFor(deopt_kind_),
+        DeoptimizeReasonToString(GetDeoptInfo().deopt_reason));
+  }
+
   // Do the input frame to output frame(s) translation.
   size_t count = translated_state_.frames().size();
   if (is_restart_frame()) {
@@ -1710,6 +1724,15 @@ void Deoptimizer::DoComputeOutputFrames() {
     function_->SetInterruptBudget(isolate_, BudgetModification::kReset,
                                   CodeKind::INTERPRETED_FUNCTION);
     function_->feedback_vector()->set_was_once_deoptimized();
+    function_->feedback_vector()->RecordDeopt(compiled_code_->kind());
+    if (v8_flags.trace_deopt && v8_flags.deopt_loop_threshold > 0 &&
+        function_->feedback_vector()->deopts_without_ic_change() ==
+            v8_flags.deopt_loop_threshold) {
+      CodeTracer::Scope scope(isolate()->GetCodeTracer());
+      PrintF(scope.file(), "[deopt loop detected in ");
+      ShortPrint(function_, scope.file());
+      PrintF(scope.file(), ", keeping it in a lower tier]\n");
+    }
   }
 
   // Print some helpful diagnostic information.
@@ -2925,6 +2948,23 @@ void Deoptimizer::MaterializeHeapObjects() {
         feedback_vector.ptr();
   }
 
+  const int materialized_object_count =
+      translated_state_.materialized_object_count();
+  isolate()->counters()->deopt_materialized_objects()->Increment(
+      materialized_object_count);
+  if (V8_UNLIKELY(v8_flags.trace_deopt_materialization)) {
+    CodeTracer::Scope scope(isolate()->GetCodeTracer());
+    PrintF(scope.file(),
+           "[deoptimizer materialized %d objects for %zu values of ",
+           materialized_object_count, values_to_materialize_.size());
+    if (function_.is_null()) {
+      PrintF(scope.file(), "a wasm function");
+    } else {
+      ShortPrint(function_, scope.file());
+    }
+    PrintF(scope.file(), "]\n");
+  }
+
   translated_state_.VerifyMaterializedObjects();
 
   bool feedback_updated = translated_state_.DoUpdateFeedback();
@@ -2031,6 +2031,7 @@ Handle<HeapObject> TranslatedState::ResolveStringConcat(TranslatedValue* slot) {
           ->factory()
           ->NewConsString(Cast<String>(left), Cast<String>(right))
           .ToHandleChecked();
+  materialized_object_count_++;
 
   slot->set_initialized_storage(result);
   return result;
@@ -2154,6 +2155,7 @@ void TranslatedState::EnsureObjectAllocatedAt(TranslatedValue* slot) {
       int index = worklist.top();
       worklist.pop();
       EnsureCapturedObjectAllocatedAt(index, &worklist);
+      materialized_object_count_++;
     }
   }
 }
@@ -495,6 +495,10 @@ class TranslatedState {
   void VerifyMaterializedObjects();
   bool DoUpdateFeedback();
 
+  // The number of captured objects and string concatenations that have been
+  // materialized so far.
+  int materialized_object_count() const { return materialized_object_count_; }
+
  private:
   friend TranslatedValue;
 
@@ -574,6 +578,7 @@ class TranslatedState {
   Address stack_frame_pointer_ = kNullAddress;
   int formal_parameter_count_;
   int actual_argument_count_;
+  int materialized_object_count_ = 0;
 
   struct ObjectPosition {
     int frame_index_;
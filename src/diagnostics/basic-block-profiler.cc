@@ -60,6 +60,18 @@ BasicBlockProfilerData* BasicBlockProfiler::NewData(size_t n_blocks) {
   return data_ptr;
 }
 
+const BasicBlockProfilerData* BasicBlockProfiler::FindData(
+    const char* function_name, int hash) {
+  base::SpinningMutexGuard lock(&data_list_mutex_);
+  for (auto it = data_list_.rbegin(); it != data_list_.rend(); ++it) {
+    const BasicBlockProfilerData& data = **it;
+    if (data.hash_ == hash && data.function_name_ == function_name) {
+      return &data;
+    }
+  }
+  return nullptr;
+}
+
 namespace {
 DirectHandle<String> CopyStringToJSHeap(const std::string& source,
                                         Isolate* isolate) {
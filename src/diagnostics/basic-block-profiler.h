@@ -38,6 +38,11 @@ class BasicBlockProfilerData {
     return block_ids_.size();
   }
   const uint32_t* counts() const { return &counts_[0]; }
+  int32_t block_id(size_t offset) const { return block_ids_[offset]; }
+  const std::vector<std::pair<int32_t, int32_t>>& branches() const {
+    return branches_;
+  }
+  int hash() const { return hash_; }
 
   void SetCode(const std::ostringstream& os);
   void SetFunctionName(std::unique_ptr<char[]> name);
@@ -83,6 +88,9 @@ class BasicBlockProfiler {
 
   V8_EXPORT_PRIVATE static BasicBlockProfiler* Get();
   BasicBlockProfilerData* NewData(size_t n_blocks);
+  // Returns the most recent off-heap data for {function_name} whose graph had
+  // the given {hash}, or nullptr if there is none.
+  const BasicBlockProfilerData* FindData(const char* function_name, int hash);
   V8_EXPORT_PRIVATE void ResetCounts(Isolate* isolate);
   V8_EXPORT_PRIVATE bool HasData(Isolate* isolate);
   V8_EXPORT_PRIVATE void Print(Isolate* isolate, std::ostream& os);
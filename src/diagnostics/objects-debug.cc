@@ -2175,7 +2175,8 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
         // However FlagScopes in unittests can modify the flag and verification
         // on Isolate deinitialization will fail.
         CHECK_GE(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
-        CHECK_LE(ticks_until_tier_up(), v8_flags.regexp_tier_up_ticks);
+        CHECK_LE(ticks_until_tier_up(), v8_flags.regexp_tier_up_ticks +
+                                            JSRegExp::kMaxTierUpDelayTicks);
       } else {
         CHECK_EQ(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
       }
@@ -3059,6 +3059,7 @@ void Script::ScriptPrint(std::ostream& os) {
   os << "\n - compilation type: " << static_cast<int>(compilation_type());
   os << "\n - compiled lazy function positions: "
      << compiled_lazy_function_positions();
+  os << "\n - literal allocation sites: " << Brief(literal_allocation_sites());
   bool is_wasm = false;
 #if V8_ENABLE_WEBASSEMBLY
   if ((is_wasm = (type() == Type::kWasm))) {
@@ -98,6 +98,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -124,6 +134,8 @@ const char LinuxPerfJitLogger::kFilenameFormatString[] = "%s/jit-%d.dump";
 const int LinuxPerfJitLogger::kFilenameBufferPadding = 16;
 
 static const char kStringTerminator[] = {'\0'};
+// Stands for the file name of the previous entry in debug info records.
+static const char kSameNameMarker[] = {'\xFF', '\0'};
 
 // The following static variables are protected by
 // GetFileMutex().
@@ -259,10 +271,31 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
   // Unwinding info comes right after debug info.
   if (v8_flags.perf_prof_unwinding_info) LogWriteUnwindingInfo(code);
 
+  code_ids_[code->instruction_start()] = code_index_;
   WriteJitCodeLoadEntry(code_pointer, code->instruction_size(), code_name,
                         length);
 }
 
+void LinuxPerfJitLogger::CodeMoveEvent(Tagged<InstructionStream> from,
+                                       Tagged<InstructionStream> to) {
+  base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Code that was not logged, e.g. filtered by
+  // --perf-basic-prof-only-functions, has no load record to refer to.
+  auto it = code_ids_.find(from->instruction_start());
+  if (it == code_ids_.end()) return;
+  uint64_t code_id = it->second;
+  code_ids_.erase(it);
+  code_ids_[to->instruction_start()] = code_id;
+
+  // "perf inject" maps the image written for the load record at the new
+  // address, so the code and its debug info need not be written again.
+  WriteJitCodeMoveEntry(from->instruction_start(), to->instruction_start(),
+                        to->code(kAcquireLoad)->instruction_size(), code_id);
+}
+
 #if V8_ENABLE_WEBASSEMBLY
 void LinuxPerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
                                            const char* name, size_t length) {
@@ -301,6 +334,24 @@ void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
 }
 
+void LinuxPerfJitLogger::WriteJitCodeMoveEntry(Address from, Address to,
+                                               uint32_t code_size,
+                                               uint64_t code_id) {
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = static_cast<uint32_t>(sizeof(code_move));
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ = static_cast<uint32_t>(process_id_);
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = static_cast<uint64_t>(to);
+  code_move.old_code_address_ = static_cast<uint64_t>(from);
+  code_move.new_code_address_ = static_cast<uint64_t>(to);
+  code_move.code_size_ = code_size;
+  code_move.code_id_ = code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 namespace {
 
 constexpr char kUnknownScriptNameString[] = "<unknown>";
@@ -360,8 +411,8 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Tagged<Code> code,
   // names only occur for cross-script inlining.
   uint32_t entry_count = 0;
   Tagged<Object> last_script = Smi::zero();
-  size_t last_script_name_size = 0;
   std::vector<base::Vector<const char>> script_names;
+  std::vector<std::unique_ptr<char[]>> script_name_storage;
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
     SourcePositionInfo info(GetSourcePositionInfo(isolate_, code, shared,
@@ -371,13 +422,11 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Tagged<Code> code,
       std::unique_ptr<char[]> name_storage;
       auto name = GetScriptName(raw_shared->script(), &name_storage, no_gc);
       script_names.push_back(name);
-      // Add the size of the name after each entry.
-      last_script_name_size = name.size() + sizeof(kStringTerminator);
-      size += last_script_name_size;
+      script_name_storage.push_back(std::move(name_storage));
+      size += name.size() + sizeof(kStringTerminator);
       last_script = current_script;
     } else {
-      DCHECK_LT(0, last_script_name_size);
-      size += last_script_name_size;
+      size += sizeof(kSameNameMarker);
     }
     entry_count++;
   }
@@ -398,7 +447,7 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Tagged<Code> code,
   Address code_start = code->instruction_start();
 
   last_script = Smi::zero();
-  int script_names_index = 0;
+  size_t script_names_index = 0;
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
     SourcePositionInfo info(GetSourcePositionInfo(isolate_, code, shared,
@@ -412,12 +461,13 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Tagged<Code> code,
     entry.column_ = info.column + 1;
     LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
     Tagged<Object> current_script = *info.script;
-    auto name_string = script_names[script_names_index];
-    LogWriteBytes(name_string.begin(), name_string.size());
-    LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
     if (current_script != last_script) {
-      if (last_script != Smi::zero()) script_names_index++;
+      auto name_string = script_names[script_names_index++];
+      LogWriteBytes(name_string.begin(), name_string.size());
+      LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
       last_script = current_script;
+    } else {
+      LogWriteBytes(kSameNameMarker, sizeof(kSameNameMarker));
     }
   }
   char padding_bytes[8] = {0};
@@ -445,12 +495,19 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
     return;
   }
 
+  std::string last_name;
   for (SourcePositionTableIterator iterator(code->source_positions());
        !iterator.done(); iterator.Advance()) {
     uint32_t offset = iterator.source_position().ScriptOffset() + code_offset;
     if (!source_map->HasValidEntry(code_offset, offset)) continue;
+    std::string name_string = source_map->GetFilename(offset);
+    if (entry_count > 0 && name_string == last_name) {
+      size += sizeof(kSameNameMarker);
+    } else {
+      size += name_string.size() + sizeof(kStringTerminator);
+      last_name = std::move(name_string);
+    }
     entry_count++;
-    size += source_map->GetFilename(offset).size() + 1;
   }
 
   if (entry_count == 0) return;
@@ -474,6 +531,7 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
   uintptr_t code_begin =
       reinterpret_cast<uintptr_t>(code->instructions().begin());
 
+  bool is_first_entry = true;
   for (SourcePositionTableIterator iterator(code->source_positions());
        !iterator.done(); iterator.Advance()) {
     uint32_t offset = iterator.source_position().ScriptOffset() + code_offset;
@@ -488,8 +546,14 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
     entry.column_ = 1;
     LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
     std::string name_string = source_map->GetFilename(offset);
-    LogWriteBytes(name_string.c_str(), name_string.size());
-    LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
+    if (!is_first_entry && name_string == last_name) {
+      LogWriteBytes(kSameNameMarker, sizeof(kSameNameMarker));
+    } else {
+      LogWriteBytes(name_string.c_str(), name_string.size());
+      LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
+      last_name = std::move(name_string);
+    }
+    is_first_entry = false;
   }
 
   char padding_bytes[8] = {0};
@@ -33,6 +33,8 @@
 // {LinuxPerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
@@ -45,9 +47,7 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   ~LinuxPerfJitLogger() override;
 
   void CodeMoveEvent(Tagged<InstructionStream> from,
-                     Tagged<InstructionStream> to) override {
-    UNREACHABLE();  // Unsupported.
-  }
+                     Tagged<InstructionStream> to) override;
   void BytecodeMoveEvent(Tagged<BytecodeArray> from,
                          Tagged<BytecodeArray> to) override {}
   void CodeDisableOptEvent(Handle<AbstractCode> code,
@@ -78,6 +78,8 @@ class LinuxPerfJitLogger : public CodeEventLogger {
 
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
                              const char* name, size_t name_length);
+  void WriteJitCodeMoveEntry(Address from, Address to, uint32_t code_size,
+                             uint64_t code_id);
 
   void LogWriteBytes(const char* bytes, size_t size);
   void LogWriteHeader();
@@ -137,6 +139,11 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   static void* marker_address_;
   static uint64_t code_index_;
   static int process_id_;
+
+  // Maps the start of logged instruction streams of this isolate to the id of
+  // their load record, which move records refer to. Protected by the file
+  // mutex.
+  std::unordered_map<Address, uint64_t> code_ids_;
 };
 
 }  // namespace internal
@@ -7,6 +7,7 @@
 #include <limits>
 
 #include "src/api/api-inl.h"
+#include "src/base/functional.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
@@ -25,13 +26,22 @@ namespace v8::internal {
 using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
 // A {FutexWaitList} manages all contexts waiting (synchronously or
-// asynchronously) on any address.
+// asynchronously) on a set of addresses. Addresses are spread over a fixed
+// number of lists by their hash, so that waits and notifies on unrelated
+// addresses don't contend on the same mutex.
 class FutexWaitList {
  public:
   FutexWaitList() = default;
   FutexWaitList(const FutexWaitList&) = delete;
   FutexWaitList& operator=(const FutexWaitList&) = delete;
 
+  // Returns the list responsible for |wait_location|.
+  static FutexWaitList* ForLocation(void* wait_location);
+
+  // Calls |callback| for every list.
+  template <typename Callback>
+  static void ForEach(Callback callback);
+
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
@@ -84,24 +94,27 @@ class FutexWaitList {
 
   // For checking the internal consistency of the FutexWaitList.
   void Verify() const;
+  // Checks the links of |node| on the list from |head| to |tail|.
+  static void VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
+                         FutexWaitListNode* tail);
   // Returns true if |node| is on the linked list starting with |head|.
   static bool NodeIsOnList(FutexWaitListNode* node, FutexWaitListNode* head);
 
   base::Mutex* mutex() { return &mutex_; }
 
- private:
-  friend class FutexEmulation;
-
   struct HeadAndTail {
     FutexWaitListNode* head;
     FutexWaitListNode* tail;
   };
 
+ private:
+  friend class FutexEmulation;
+
   // `mutex` protects the composition of the fields below (i.e. no elements may
   // be added or removed without holding this mutex), as well as the `waiting_`
-  // and `interrupted_` fields for each individual list node that is currently
-  // part of the list. It must be the mutex used together with the `cond_`
-  // condition variable of such nodes.
+  // field for each individual list node that is currently part of the list.
+  // It must be the mutex used together with the `cond_` condition variable of
+  // such nodes.
   base::Mutex mutex_;
 
   // Location inside a shared buffer -> linked list of Nodes waiting on that
@@ -110,19 +123,58 @@ class FutexWaitList {
   // allocation and deallocation happening in wait or wake, which reduces the
   // time spend in the critical section.
   base::SmallMap<std::map<void*, HeadAndTail>, 16> location_lists_;
+};
+
+// A {FutexResolveList} holds the async waiters which were notified and are
+// waiting for their Promises to be resolved. Its mutex may be taken while
+// holding the mutex of a {FutexWaitList}, but not the other way round.
+class FutexResolveList {
+ public:
+  base::Mutex* mutex() { return &mutex_; }
+
+  // For checking the internal consistency of the FutexResolveList.
+  void Verify() const;
+
+ private:
+  friend class FutexEmulation;
+
+  base::Mutex mutex_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
-  base::SmallMap<std::map<Isolate*, HeadAndTail>> isolate_promises_to_resolve_;
+  base::SmallMap<std::map<Isolate*, FutexWaitList::HeadAndTail>>
+      isolate_promises_to_resolve_;
 };
 
 namespace {
 
-// {GetWaitList} returns the lazily initialized global wait list.
-DEFINE_LAZY_LEAKY_OBJECT_GETTER(FutexWaitList, GetWaitList)
+constexpr size_t kNumWaitLists = 64;
+
+struct FutexWaitLists {
+  FutexWaitList lists[kNumWaitLists];
+};
+
+// {GetWaitLists} returns the lazily initialized global wait lists.
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(FutexWaitLists, GetWaitLists)
+
+// {GetResolveList} returns the lazily initialized global list of async waiters
+// whose Promises are to be resolved.
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(FutexResolveList, GetResolveList)
 
 }  // namespace
 
+// static
+FutexWaitList* FutexWaitList::ForLocation(void* wait_location) {
+  size_t hash = base::hash_value(reinterpret_cast<uintptr_t>(wait_location));
+  return &GetWaitLists()->lists[hash % kNumWaitLists];
+}
+
+// static
+template <typename Callback>
+void FutexWaitList::ForEach(Callback callback) {
+  for (FutexWaitList& wait_list : GetWaitLists()->lists) callback(&wait_list);
+}
+
 bool FutexWaitListNode::CancelTimeoutTask() {
   DCHECK(IsAsync());
   if (async_state_->timeout_task_id == CancelableTaskManager::kInvalidTaskId) {
@@ -138,17 +190,20 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  FutexWaitList* wait_list = GetWaitList();
+  // Set the interrupted_ flag first. A wait that starts later tests it after
+  // publishing its wait list in wait_list_, with the list's mutex locked.
+  interrupted_.store(true, std::memory_order_seq_cst);
+
+  // If the node is waiting, lock the mutex of its wait list before notifying.
+  // We know that the mutex will have been unlocked if we are currently waiting
+  // on the condition variable; otherwise this blocks until the waiter either
+  // sees interrupted_ or starts waiting.
+  FutexWaitList* wait_list = wait_list_.load(std::memory_order_seq_cst);
+  if (wait_list == nullptr) return;
   NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   // if not waiting, this will not have any effect.
   cond_.NotifyOne();
-  interrupted_ = true;
 }
 
 class ResolveAsyncWaiterPromisesTask : public CancelableTask {
@@ -182,7 +237,7 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
   // This function can run in any thread.
 
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(node->wait_location_);
   wait_list->mutex()->AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
@@ -194,7 +249,9 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+  FutexResolveList* resolve_list = GetResolveList();
+  NoGarbageCollectionMutexGuard lock_guard(resolve_list->mutex());
+  auto& isolate_map = resolve_list->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->async_state_->isolate_for_async_waiters);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
@@ -210,6 +267,7 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
     it->second.tail->next_ = node;
     it->second.tail = node;
   }
+  resolve_list->Verify();
 }
 
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
@@ -264,15 +322,10 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 }
 
 void AtomicsWaitWakeHandle::Wake() {
-  // Adding a separate `NotifyWake()` variant that doesn't acquire the lock
-  // itself would likely just add unnecessary complexity..
-  // The split lock by itself isn’t an issue, as long as the caller properly
-  // synchronizes this with the closing `AtomicsWaitCallback`.
-  FutexWaitList* wait_list = GetWaitList();
-  {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
-    stopped_ = true;
-  }
+  // The waiter tests stopped_ after handling the interrupt raised by
+  // `NotifyWake()`. This has to be synchronized with the closing
+  // `AtomicsWaitCallback` by the caller.
+  stopped_.store(true, std::memory_order_relaxed);
   isolate_->futex_wait_list_node()->NotifyWake();
 }
 
@@ -405,9 +458,9 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
   DirectHandle<Object> result;
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
-  FutexWaitList* wait_list = GetWaitList();
   FutexWaitListNode* node = isolate->futex_wait_list_node();
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
 
   base::TimeTicks timeout_time;
   if (use_timeout) {
@@ -441,11 +494,14 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
     node->wait_location_ = wait_location;
     node->waiting_ = true;
     wait_list->AddNode(node);
+    // Pairs with NotifyWake(): either it sees the wait list and notifies us
+    // under its mutex, or we see interrupted_ below.
+    node->wait_list_.store(wait_list, std::memory_order_seq_cst);
 
     while (true) {
-      if (V8_UNLIKELY(node->interrupted_)) {
+      if (V8_UNLIKELY(node->interrupted_.load(std::memory_order_seq_cst))) {
         // Reset the interrupted flag while still holding the mutex.
-        node->interrupted_ = false;
+        node->interrupted_.store(false, std::memory_order_relaxed);
 
         // Unlock the mutex here to prevent deadlock from lock ordering between
         // mutex and mutexes locked by HandleInterrupts.
@@ -476,7 +532,7 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
         }
       }
 
-      if (V8_UNLIKELY(node->interrupted_)) {
+      if (V8_UNLIKELY(node->interrupted_.load(std::memory_order_seq_cst))) {
         // An interrupt occurred while the mutex was unlocked. Don't wait yet.
         continue;
       }
@@ -516,6 +572,7 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
 
     node->waiting_ = false;
     wait_list->RemoveNode(node);
+    node->wait_list_.store(nullptr, std::memory_order_relaxed);
   } while (false);
   DCHECK(!node->waiting_);
 
@@ -572,7 +629,7 @@ Tagged<Object> FutexEmulation::WaitAsync(
   // Get a weak pointer to the backing store, to be stored in the async state of
   // the node.
   std::weak_ptr<BackingStore> backing_store{array_buffer->GetBackingStore()};
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
   {
     // 16. Perform EnterCriticalSection(WL).
     NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
@@ -688,7 +745,7 @@ int FutexEmulation::Wake(Tagged<JSArrayBuffer> array_buffer, size_t addr,
 
 int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
   int num_waiters_woken = 0;
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
   NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   auto& location_lists = wait_list->location_lists_;
@@ -783,7 +840,7 @@ void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
   // This function must run in the main thread of node's Isolate. This function
   // may allocate memory. To avoid deadlocks, we shouldn't be holding the
-  // FutexEmulationGlobalState::mutex.
+  // mutex of any FutexWaitList.
 
   Isolate* isolate = node->async_state_->isolate_for_async_waiters;
   auto v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
@@ -856,12 +913,12 @@ void FutexEmulation::ResolveAsyncWaiterPromise(FutexWaitListNode* node) {
 void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
   // This function must run in the main thread of isolate.
 
-  FutexWaitList* wait_list = GetWaitList();
+  FutexResolveList* resolve_list = GetResolveList();
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(resolve_list->mutex());
 
-    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+    auto& isolate_map = resolve_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -893,7 +950,7 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate.
   DCHECK(node->IsAsync());
 
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(node->wait_location_);
 
   {
     NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
@@ -917,14 +974,14 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
-
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
+  // Notifying may still move nodes of "isolate" from the wait lists to the
+  // resolve list concurrently, so the resolve list has to be processed last.
+  FutexWaitList::ForEach([isolate](FutexWaitList* wait_list) {
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
     auto& location_lists = wait_list->location_lists_;
     auto it = location_lists.begin();
     while (it != location_lists.end()) {
@@ -939,10 +996,13 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
         ++it;
       }
     }
-  }
+    wait_list->Verify();
+  });
 
   {
-    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+    FutexResolveList* resolve_list = GetResolveList();
+    NoGarbageCollectionMutexGuard lock_guard(resolve_list->mutex());
+    auto& isolate_map = resolve_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
       for (FutexWaitListNode* node = it->second.head; node;) {
@@ -954,15 +1014,14 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       }
       isolate_map.erase(it);
     }
+    resolve_list->Verify();
   }
-
-  wait_list->Verify();
 }
 
 int FutexEmulation::NumWaitersForTesting(Tagged<JSArrayBuffer> array_buffer,
                                          size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
   NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   int num_waiters = 0;
@@ -986,11 +1045,11 @@ int FutexEmulation::NumWaitersForTesting(Tagged<JSArrayBuffer> array_buffer,
 int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
     Tagged<JSArrayBuffer> array_buffer, size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(array_buffer, addr);
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  FutexResolveList* resolve_list = GetResolveList();
+  NoGarbageCollectionMutexGuard lock_guard(resolve_list->mutex());
 
   int num_waiters = 0;
-  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+  auto& isolate_map = resolve_list->isolate_promises_to_resolve_;
   for (const auto& it : isolate_map) {
     for (FutexWaitListNode* node = it.second.head; node; node = node->next_) {
       DCHECK(node->IsAsync());
@@ -1006,38 +1065,47 @@ int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   return num_waiters;
 }
 
-void FutexWaitList::Verify() const {
+// static
+void FutexWaitList::VerifyNode(FutexWaitListNode* node,
+                               FutexWaitListNode* head,
+                               FutexWaitListNode* tail) {
 #ifdef DEBUG
-  auto VerifyNode = [](FutexWaitListNode* node, FutexWaitListNode* head,
-                       FutexWaitListNode* tail) {
-    if (node->next_ != nullptr) {
-      DCHECK_NE(node, tail);
-      DCHECK_EQ(node, node->next_->prev_);
-    } else {
-      DCHECK_EQ(node, tail);
-    }
-    if (node->prev_ != nullptr) {
-      DCHECK_NE(node, head);
-      DCHECK_EQ(node, node->prev_->next_);
-    } else {
-      DCHECK_EQ(node, head);
-    }
+  if (node->next_ != nullptr) {
+    DCHECK_NE(node, tail);
+    DCHECK_EQ(node, node->next_->prev_);
+  } else {
+    DCHECK_EQ(node, tail);
+  }
+  if (node->prev_ != nullptr) {
+    DCHECK_NE(node, head);
+    DCHECK_EQ(node, node->prev_->next_);
+  } else {
+    DCHECK_EQ(node, head);
+  }
 
-    DCHECK(NodeIsOnList(node, head));
-  };
+  DCHECK(NodeIsOnList(node, head));
+#endif  // DEBUG
+}
 
+void FutexWaitList::Verify() const {
+#ifdef DEBUG
   for (const auto& [addr, head_and_tail] : location_lists_) {
     auto [head, tail] = head_and_tail;
     for (FutexWaitListNode* node = head; node; node = node->next_) {
       VerifyNode(node, head, tail);
+      DCHECK_EQ(this, ForLocation(node->wait_location_));
     }
   }
+#endif  // DEBUG
+}
 
+void FutexResolveList::Verify() const {
+#ifdef DEBUG
   for (const auto& [isolate, head_and_tail] : isolate_promises_to_resolve_) {
     auto [head, tail] = head_and_tail;
     for (FutexWaitListNode* node = head; node; node = node->next_) {
       DCHECK(node->IsAsync());
-      VerifyNode(node, head, tail);
+      FutexWaitList::VerifyNode(node, head, tail);
       DCHECK_EQ(isolate, node->async_state_->isolate_for_async_waiters);
     }
   }
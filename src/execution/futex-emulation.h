@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <atomic>
+
 #include "include/v8-persistent-handle.h"
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -44,11 +46,13 @@ class AtomicsWaitWakeHandle {
   explicit AtomicsWaitWakeHandle(Isolate* isolate) : isolate_(isolate) {}
 
   void Wake();
-  inline bool has_stopped() const { return stopped_; }
+  inline bool has_stopped() const {
+    return stopped_.load(std::memory_order_relaxed);
+  }
 
  private:
   Isolate* isolate_;
-  bool stopped_ = false;
+  std::atomic<bool> stopped_{false};
 };
 
 class FutexWaitListNode {
@@ -76,6 +80,7 @@ class FutexWaitListNode {
  private:
   friend class FutexEmulation;
   friend class FutexWaitList;
+  friend class FutexResolveList;
 
   // Async wait requires substantially more information than synchronous wait.
   // Hence store that additional information in a heap-allocated struct to make
@@ -125,7 +130,8 @@ class FutexWaitListNode {
   };
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulationGlobalState::mutex.
+  // prev_ and next_ are protected by the mutex of the FutexWaitList or
+  // FutexResolveList the node is currently contained in.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -137,11 +143,15 @@ class FutexWaitListNode {
   // this node is alive.
   void* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulationGlobalState::mutex
-  // if this node is currently contained in FutexEmulationGlobalState::wait_list
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ is protected by the mutex of the FutexWaitList responsible for
+  // wait_location_ while this node is contained in it.
   bool waiting_ = false;
-  bool interrupted_ = false;
+  // interrupted_ can be set from any thread by NotifyWake(). It is reset by
+  // the waiting thread.
+  std::atomic<bool> interrupted_{false};
+  // The FutexWaitList a sync waiter is currently contained in, or nullptr.
+  // NotifyWake() locks its mutex before notifying cond_.
+  std::atomic<FutexWaitList*> wait_list_{nullptr};
 
   // State used for an async wait; nullptr on sync waits.
   const std::unique_ptr<AsyncState> async_state_;
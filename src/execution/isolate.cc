@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -69,6 +70,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/setup-isolate.h"
@@ -113,6 +115,7 @@
 #include "src/roots/roots.h"
 #include "src/roots/static-roots.h"
 #include "src/sandbox/js-dispatch-table-inl.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/embedded/embedded-file-writer-interface.h"
 #include "src/snapshot/read-only-deserializer.h"
@@ -932,7 +935,8 @@ class CallSiteBuilder {
   }
 
   void AppendPromiseCombinatorFrame(DirectHandle<JSFunction> element_function,
-                                    DirectHandle<JSFunction> combinator) {
+                                    DirectHandle<JSFunction> combinator,
+                                    DirectHandle<PromiseReaction> reaction) {
     if (!IsVisibleInStackTrace(combinator)) {
       skipped_prev_frame_ = true;
       return;
@@ -948,9 +952,13 @@ class CallSiteBuilder {
     DirectHandle<FixedArray> parameters =
         isolate_->factory()->empty_fixed_array();
 
-    // We store the offset of the promise into the element function's
-    // hash field for element callbacks.
-    int promise_index = Smi::ToInt(element_function->GetIdentityHash()) - 1;
+    // The reactions of the element closures shared by all elements store the
+    // offset of the promise on the reaction itself. Otherwise we store the
+    // offset into the element function's hash field.
+    int promise_index =
+        IsSmi(reaction->promise_or_capability())
+            ? Smi::ToInt(reaction->promise_or_capability())
+            : Smi::ToInt(element_function->GetIdentityHash()) - 1;
 
     AppendFrame(receiver, combinator, code, promise_index, flags, parameters);
   }
@@ -1164,7 +1172,7 @@ void CaptureAsyncStackTrace(Isolate* isolate, DirectHandle<JSPromise> promise,
       DirectHandle<Context> context(function->context(), isolate);
       DirectHandle<JSFunction> combinator(
           context->native_context()->promise_all(), isolate);
-      builder->AppendPromiseCombinatorFrame(function, combinator);
+      builder->AppendPromiseCombinatorFrame(function, combinator, reaction);
 
       if (IsNativeContext(*context)) {
         // NativeContext is used as a marker that the closure was already
@@ -1189,7 +1197,7 @@ void CaptureAsyncStackTrace(Isolate* isolate, DirectHandle<JSPromise> promise,
       DirectHandle<Context> context(function->context(), isolate);
       DirectHandle<JSFunction> combinator(
           context->native_context()->promise_all_settled(), isolate);
-      builder->AppendPromiseCombinatorFrame(function, combinator);
+      builder->AppendPromiseCombinatorFrame(function, combinator, reaction);
 
       if (IsNativeContext(*context)) {
         // NativeContext is used as a marker that the closure was already
@@ -1213,7 +1221,7 @@ void CaptureAsyncStackTrace(Isolate* isolate, DirectHandle<JSPromise> promise,
       DirectHandle<Context> context(function->context(), isolate);
       DirectHandle<JSFunction> combinator(
           context->native_context()->promise_any(), isolate);
-      builder->AppendPromiseCombinatorFrame(function, combinator);
+      builder->AppendPromiseCombinatorFrame(function, combinator, reaction);
 
       if (IsNativeContext(*context)) {
         // NativeContext is used as a marker that the closure was already
@@ -1241,7 +1249,7 @@ void CaptureAsyncStackTrace(Isolate* isolate, DirectHandle<JSPromise> promise,
       // We have some generic promise chain here, so try to
       // continue with the chained promise on the reaction
       // (only works for native promise chains).
-      Handle<HeapObject> promise_or_capability(
+      Handle<Object> promise_or_capability(
           reaction->promise_or_capability(), isolate);
       if (IsJSPromise(*promise_or_capability)) {
         promise = Cast<JSPromise>(promise_or_capability);
@@ -1310,7 +1318,7 @@ MaybeDirectHandle<JSPromise> TryGetCurrentTaskPromise(Isolate* isolate) {
       // yield inside an async generator) or a suspended Wasm stack,
       // but we might still be able to find an async frame if we follow
       // along the chain of promises on the {promise_reaction_job_task}.
-      DirectHandle<HeapObject> promise_or_capability(
+      DirectHandle<Object> promise_or_capability(
           promise_reaction_job_task->promise_or_capability(), isolate);
       if (IsJSPromise(*promise_or_capability)) {
         DirectHandle<JSPromise> promise =
@@ -1411,7 +1419,9 @@ Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
   return stack_trace;
 }
 
-DirectHandle<StackTraceInfo> GetDetailedStackTraceFromCallSiteInfos(
+// Symbolizes up to {limit} of the {call_site_infos} into StackFrameInfos for
+// the inspector.
+DirectHandle<FixedArray> GetStackFrameInfosFromCallSiteInfos(
     Isolate* isolate, DirectHandle<FixedArray> call_site_infos, int limit) {
   auto frames = isolate->factory()->NewFixedArray(
       std::min(limit, call_site_infos->length()));
@@ -1434,8 +1444,7 @@ DirectHandle<StackTraceInfo> GetDetailedStackTraceFromCallSiteInfos(
             IsConstructor(*call_site_info));
     frames->set(index++, *stack_frame_info);
   }
-  frames = FixedArray::RightTrimOrEmpty(isolate, frames, index);
-  return isolate->factory()->NewStackTraceInfo(frames);
+  return FixedArray::RightTrimOrEmpty(isolate, frames, index);
 }
 
 }  // namespace
@@ -1489,14 +1498,16 @@ MaybeDirectHandle<JSObject> Isolate::CaptureAndSetErrorStack(
           stack_trace_for_uncaught_exceptions_frame_limit_,
           stack_trace_for_uncaught_exceptions_options_);
     } else {
+      // Errors are often created and dropped without anyone looking at
+      // their stack, so the detailed stack trace holds on to the (untrimmed)
+      // call site infos and only symbolizes them when it's requested, see
+      // Isolate::GetDetailedStackTrace.
       auto call_site_infos =
           Cast<FixedArray>(call_site_infos_or_formatted_stack);
-      stack_trace = GetDetailedStackTraceFromCallSiteInfos(
-          this, call_site_infos,
-          stack_trace_for_uncaught_exceptions_frame_limit_);
+      stack_trace = factory()->NewStackTraceInfo(call_site_infos);
       if (stack_trace_limit < call_site_infos->length()) {
-        call_site_infos_or_formatted_stack = FixedArray::RightTrimOrEmpty(
-            this, call_site_infos, stack_trace_limit);
+        call_site_infos_or_formatted_stack =
+            factory()->CopyFixedArrayUpTo(call_site_infos, stack_trace_limit);
       }
       // Notify the debugger.
       OnStackTraceCaptured(stack_trace);
@@ -1518,7 +1529,17 @@ Handle<StackTraceInfo> Isolate::GetDetailedStackTrace(
   ErrorUtils::StackPropertyLookupResult lookup =
       ErrorUtils::GetErrorStackProperty(this, maybe_error_object);
   if (!IsErrorStackData(*lookup.error_stack)) return {};
-  return handle(Cast<ErrorStackData>(lookup.error_stack)->stack_trace(), this);
+  Handle<StackTraceInfo> stack_trace(
+      Cast<ErrorStackData>(lookup.error_stack)->stack_trace(), this);
+  // Symbolize the call site infos stashed by CaptureAndSetErrorStack.
+  if (stack_trace->length() > 0 &&
+      IsCallSiteInfo(stack_trace->frames()->get(0))) {
+    DirectHandle<FixedArray> frames = GetStackFrameInfosFromCallSiteInfos(
+        this, direct_handle(stack_trace->frames(), this),
+        stack_trace_for_uncaught_exceptions_frame_limit_);
+    stack_trace->set_frames(*frames);
+  }
+  return stack_trace;
 }
 
 Handle<FixedArray> Isolate::GetSimpleStackTrace(
@@ -3133,9 +3154,12 @@ bool WalkPromiseTreeInternal(
   DirectHandle<Object> current(promise->reactions(), isolate);
   while (!IsSmi(*current)) {
     auto reaction = Cast<PromiseReaction>(current);
-    DirectHandle<HeapObject> promise_or_capability(
+    DirectHandle<Object> promise_or_capability(
         reaction->promise_or_capability(), isolate);
-    if (!IsUndefined(*promise_or_capability, isolate)) {
+    // Reactions of await and of the shared Promise.all/allSettled element
+    // closures hold undefined or the element index instead.
+    if (!IsUndefined(*promise_or_capability, isolate) &&
+        !IsSmi(*promise_or_capability)) {
       if (!IsJSPromise(*promise_or_capability)) {
         promise_or_capability = direct_handle(
             Cast<PromiseCapability>(promise_or_capability)->promise(), isolate);
@@ -4443,6 +4467,9 @@ void Isolate::Deinit() {
     lazy_compile_dispatcher_.reset();
   }
 
+  // Stops the background decompression of context snapshots.
+  context_snapshot_cache_.reset();
+
   if (concurrent_recompilation_enabled()) {
     optimizing_compile_dispatcher_->FinishTearDown();
     delete optimizing_compile_dispatcher_;
@@ -5194,6 +5221,17 @@ bool Isolate::InitWithSnapshot(SnapshotData* startup_snapshot_data,
               shared_heap_snapshot_data, can_rehash);
 }
 
+void Isolate::set_context_snapshot_cache(
+    std::unique_ptr<ContextSnapshotCache> context_snapshot_cache) {
+  DCHECK_NULL(context_snapshot_cache_);
+  context_snapshot_cache_ = std::move(context_snapshot_cache);
+}
+
+void Isolate::set_code_cache_memo(
+    std::unique_ptr<CodeCacheMemo> code_cache_memo) {
+  code_cache_memo_ = std::move(code_cache_memo);
+}
+
 namespace {
 static std::string ToHexString(uintptr_t address) {
   std::stringstream stream_address;
@@ -5266,11 +5304,53 @@ class BigIntPlatform : public bigint::Platform {
   ~BigIntPlatform() override = default;
 
   bool InterruptRequested() override {
+    if (ThreadId::Current() != isolate_->thread_id()) {
+      // Worker thread of a parallel operation: its stack is not the one the
+      // stack guard's limits refer to, so only check for termination.
+      return isolate_->stack_guard()->HasTerminationRequest();
+    }
     StackLimitCheck interrupt_check(isolate_);
     return (interrupt_check.InterruptRequested() &&
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  int NumberOfWorkerThreads() override {
+    if (!v8_flags.parallel_bigint_operations) return 0;
+    return V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  }
+
+  void RunParallel(ParallelTask* task, int count) override {
+    class BigIntJob final : public JobTask {
+     public:
+      BigIntJob(ParallelTask* task, int count) : task_(task), count_(count) {}
+
+      void Run(JobDelegate* /* delegate */) override {
+        while (true) {
+          int index = next_index_.fetch_add(1, std::memory_order_relaxed);
+          if (index >= count_) break;
+          task_->Run(index);
+        }
+      }
+
+      size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+        int next_index = next_index_.load(std::memory_order_relaxed);
+        return std::max(0, count_ - next_index);
+      }
+
+     private:
+      ParallelTask* const task_;
+      const int count_;
+      std::atomic<int> next_index_{0};
+    };
+
+    // The current thread joins in, so all units of work are done once
+    // {Join} returns.
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<BigIntJob>(task, count))
+        ->Join();
+  }
+
  private:
   Isolate* isolate_;
 };
@@ -5953,6 +6033,12 @@ void Isolate::DumpAndResetStats() {
       stack_access_count_map = nullptr;
     }
   }
+  if (megamorphic_ic_site_stats_ != nullptr) {
+    DCHECK_GT(v8_flags.trace_megamorphic_ic_sites, 0);
+    StdoutStream os;
+    megamorphic_ic_site_stats_->Print(os, v8_flags.trace_megamorphic_ic_sites);
+    megamorphic_ic_site_stats_.reset();
+  }
   if (turbo_statistics_ != nullptr) {
     DCHECK(v8_flags.turbo_stats || v8_flags.turbo_stats_nvp);
     StdoutStream os;
@@ -6042,6 +6128,13 @@ void Isolate::AbortConcurrentOptimization(BlockingBehavior behavior) {
 #endif
 }
 
+MegamorphicICSiteStats* Isolate::GetMegamorphicICSiteStats() {
+  if (megamorphic_ic_site_stats_ == nullptr) {
+    megamorphic_ic_site_stats_ = std::make_unique<MegamorphicICSiteStats>();
+  }
+  return megamorphic_ic_site_stats_.get();
+}
+
 std::shared_ptr<CompilationStatistics> Isolate::GetTurboStatistics() {
   if (turbo_statistics_ == nullptr) {
     turbo_statistics_.reset(new CompilationStatistics());
@@ -6620,6 +6713,17 @@ MaybeDirectHandle<FixedArray> Isolate::GetImportAttributesFromArgument(
 
 void Isolate::ClearKeptObjects() { heap()->ClearKeptObjects(); }
 
+void Isolate::ResetForReuse() {
+  DCHECK(!has_exception());
+  DCHECK(context().is_null());
+  AbortConcurrentOptimization(BlockingBehavior::kBlock);
+  // Pending microtasks are strong roots and would keep their contexts alive.
+  default_microtask_queue()->ClearMicrotasks();
+  compilation_cache()->Clear();
+  ClearKeptObjects();
+  heap()->CollectAllAvailableGarbage(GarbageCollectionReason::kIsolateReset);
+}
+
 void Isolate::SetHostImportModuleDynamicallyCallback(
     HostImportModuleDynamicallyCallback callback) {
   host_import_module_dynamically_callback_ = callback;
@@ -6953,7 +7057,7 @@ void Isolate::OnTerminationDuringRunMicrotasks() {
   if (IsPromiseReactionJobTask(*current_microtask)) {
     auto promise_reaction_job_task =
         Cast<PromiseReactionJobTask>(current_microtask);
-    DirectHandle<HeapObject> promise_or_capability(
+    DirectHandle<Object> promise_or_capability(
         promise_reaction_job_task->promise_or_capability(), this);
     if (IsPromiseCapability(*promise_or_capability)) {
       promise_or_capability = direct_handle(
@@ -7215,27 +7319,66 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              DirectHandle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
+  ICUObjectCacheEntry* entries =
       icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (int i = 0; i < kICUObjectCacheSize; i++) {
+    if (!entries[i].obj) break;
+    if (StringEqualsLocales(this, entries[i].locales, locales)) {
+      // Move the entry to the front so that it is evicted last.
+      std::rotate(entries, entries + i, entries + i + 1);
+      return entries[0].obj.get();
+    }
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       DirectHandle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  ICUObjectCacheEntry* entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  // Evict the least recently used entry.
+  std::move_backward(entries, entries + kICUObjectCacheSize - 1,
+                     entries + kICUObjectCacheSize);
+  entries[0] = {GetStringFromLocales(this, locales), std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  for (ICUObjectCacheEntry& entry :
+       icu_object_cache_[static_cast<int>(cache_type)]) {
+    entry = ICUObjectCacheEntry{};
+  }
 }
 
 void Isolate::clear_cached_icu_objects() {
   for (int i = 0; i < kICUObjectCacheTypeCount; i++) {
     clear_cached_icu_object(static_cast<ICUObjectCacheType>(i));
   }
+  for (ICUTimeZoneCacheEntry& entry : icu_time_zone_cache_) {
+    entry = ICUTimeZoneCacheEntry{};
+  }
+}
+
+icu::UMemory* Isolate::get_cached_icu_time_zone(int32_t time_zone_index) {
+  ICUTimeZoneCacheEntry* entries = icu_time_zone_cache_;
+  for (int i = 0; i < kICUTimeZoneCacheSize; i++) {
+    if (!entries[i].obj) break;
+    if (entries[i].time_zone_index == time_zone_index) {
+      // Move the entry to the front so that it is evicted last.
+      std::rotate(entries, entries + i, entries + i + 1);
+      return entries[0].obj.get();
+    }
+  }
+  return nullptr;
+}
+
+void Isolate::set_icu_time_zone_in_cache(int32_t time_zone_index,
+                                         std::shared_ptr<icu::UMemory> obj) {
+  ICUTimeZoneCacheEntry* entries = icu_time_zone_cache_;
+  // Evict the least recently used entry.
+  std::move_backward(entries, entries + kICUTimeZoneCacheSize - 1,
+                     entries + kICUTimeZoneCacheSize);
+  entries[0] = {time_zone_index, std::move(obj)};
 }
 
 #endif  // V8_INTL_SUPPORT
@@ -120,6 +120,7 @@ class CodeTracer;
 class CommonFrame;
 class CompilationCache;
 class CompilationStatistics;
+class ContextSnapshotCache;
 class Counters;
 class Debug;
 class Deoptimizer;
@@ -136,6 +137,7 @@ class LazyCompileDispatcher;
 class LocalIsolate;
 class V8FileLogger;
 class MaterializedObjectStore;
+class MegamorphicICSiteStats;
 class Microtask;
 class MicrotaskQueue;
 class OptimizingCompileDispatcher;
@@ -158,6 +160,7 @@ class ThreadVisitor;  // Defined in v8threads.h
 class TieringManager;
 class TracingCpuProfilerImpl;
 class UnicodeCache;
+struct CodeCacheMemo;
 struct ManagedPtrDestructor;
 
 template <StateTag Tag>
@@ -1633,6 +1636,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
   void clear_cached_icu_objects();
 
+  // The ICU time zones used by Temporal, keyed by time zone index (see
+  // Intl::GetTimeZoneIndex).
+  icu::UMemory* get_cached_icu_time_zone(int32_t time_zone_index);
+  void set_icu_time_zone_in_cache(int32_t time_zone_index,
+                                  std::shared_ptr<icu::UMemory> obj);
+
 #endif  // V8_INTL_SUPPORT
 
   enum class KnownPrototype { kNone, kObject, kArray, kString };
@@ -1723,12 +1732,24 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   std::shared_ptr<CompilationStatistics> GetMaglevStatistics();
 #endif
   CodeTracer* GetCodeTracer();
+  MegamorphicICSiteStats* GetMegamorphicICSiteStats();
 
   void DumpAndResetStats();
   void DumpAndResetBuiltinsProfileData();
 
   void* stress_deopt_count_address() { return &stress_deopt_count_; }
 
+  // Bumped whenever a prototype chain may become valid again: a new validity
+  // cell, a new prototype user or a new prototype chain enum cache. Lets
+  // JSObject::InvalidatePrototypeChains skip subtrees that are still invalid.
+  static constexpr uint32_t kMaxPrototypeChainEpoch = (1u << 30) - 1;
+  uint32_t prototype_chain_epoch() const { return prototype_chain_epoch_; }
+  void BumpPrototypeChainEpoch() {
+    if (prototype_chain_epoch_ < kMaxPrototypeChainEpoch) {
+      ++prototype_chain_epoch_;
+    }
+  }
+
   void set_force_slow_path(bool v) { force_slow_path_ = v; }
   bool force_slow_path() const { return force_slow_path_; }
   bool* force_slow_path_address() { return &force_slow_path_; }
@@ -1972,10 +1993,22 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return lazy_compile_dispatcher_.get();
   }
 
+  ContextSnapshotCache* context_snapshot_cache() const {
+    return context_snapshot_cache_.get();
+  }
+  void set_context_snapshot_cache(
+      std::unique_ptr<ContextSnapshotCache> context_snapshot_cache);
+
+  CodeCacheMemo* code_cache_memo() const { return code_cache_memo_.get(); }
+  void set_code_cache_memo(std::unique_ptr<CodeCacheMemo> code_cache_memo);
+
   bool IsInCreationContext(Tagged<JSObject> object, uint32_t index);
 
   void ClearKeptObjects();
 
+  // Drops state created by previous workloads; see v8::Isolate::ResetForReuse.
+  void ResetForReuse();
+
   void SetHostImportModuleDynamicallyCallback(
       HostImportModuleDynamicallyCallback callback);
   void SetHostImportModuleWithPhaseDynamicallyCallback(
@@ -2364,6 +2397,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   std::list<std::unique_ptr<detail::WaiterQueueNode>>&
   async_waiter_queue_nodes();
 
+  // Number of spin iterations that recently sufficed to take a contended
+  // Atomics.Mutex on this isolate's thread.
+  int atomics_mutex_spin_estimate() const {
+    return atomics_mutex_spin_estimate_;
+  }
+  void set_atomics_mutex_spin_estimate(int spin_estimate) {
+    atomics_mutex_spin_estimate_ = spin_estimate;
+  }
+
   void ReportExceptionFunctionCallback(
       DirectHandle<JSReceiver> receiver,
       DirectHandle<FunctionTemplateInfo> function,
@@ -2603,8 +2645,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the kICUObjectCacheSize most recently accessed
+  // {locales,obj} pairs for each cache type, most recently used first.
+  static constexpr int kICUObjectCacheSize = 4;
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2614,7 +2657,17 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount]
+                                       [kICUObjectCacheSize];
+
+  // The kICUTimeZoneCacheSize most recently accessed time zones, most
+  // recently used first.
+  static constexpr int kICUTimeZoneCacheSize = 8;
+  struct ICUTimeZoneCacheEntry {
+    int32_t time_zone_index = 0;
+    std::shared_ptr<icu::UMemory> obj;
+  };
+  ICUTimeZoneCacheEntry icu_time_zone_cache_[kICUTimeZoneCacheSize];
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -2670,6 +2723,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Zone* compiler_zone_ = nullptr;
 
   std::unique_ptr<LazyCompileDispatcher> lazy_compile_dispatcher_;
+  std::unique_ptr<ContextSnapshotCache> context_snapshot_cache_;
+  std::unique_ptr<CodeCacheMemo> code_cache_memo_;
 #ifdef V8_ENABLE_SPARKPLUG
   baseline::BaselineBatchCompiler* baseline_batch_compiler_ = nullptr;
 #endif  // V8_ENABLE_SPARKPLUG
@@ -2738,6 +2793,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   v8::Isolate::UseCounterCallback use_counter_callback_ = nullptr;
 
   std::shared_ptr<CompilationStatistics> turbo_statistics_;
+  std::unique_ptr<MegamorphicICSiteStats> megamorphic_ic_site_stats_;
+  uint32_t prototype_chain_epoch_ = 1;
 #ifdef V8_ENABLE_MAGLEV
   std::shared_ptr<CompilationStatistics> maglev_statistics_;
 #endif
@@ -2848,6 +2905,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // List to manage the lifetime of the WaiterQueueNodes used to track async
   // waiters for JSSynchronizationPrimitives.
   std::list<std::unique_ptr<detail::WaiterQueueNode>> async_waiter_queue_nodes_;
+  // Starts out at the equivalent of the former fixed spin count of 64.
+  int atomics_mutex_spin_estimate_ = 24;
 
   // Used to track and safepoint all client isolates attached to this shared
   // isolate.
@@ -150,6 +150,12 @@ class SetIsRunningMicrotasks {
 
 }  // namespace
 
+void MicrotaskQueue::ClearMicrotasks() {
+  DCHECK(!IsRunningMicrotasks());
+  size_ = 0;
+  start_ = 0;
+}
+
 int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
   SetIsRunningMicrotasks scope(&is_running_microtasks_);
   v8::Isolate::SuppressMicrotaskExecutionScope suppress(
@@ -60,6 +60,9 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
       MicrotasksCompletedCallbackWithData callback, void* data) override;
   bool IsRunningMicrotasks() const override { return is_running_microtasks_; }
 
+  // Drops all queued Microtasks without running them.
+  void ClearMicrotasks();
+
   // Runs all queued Microtasks.
   // Returns -1 if the execution is terminating, otherwise, returns the number
   // of microtasks that ran in this round.
@@ -4,6 +4,7 @@
 
 #include "src/execution/tiering-manager.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "src/base/platform/platform.h"
@@ -19,9 +20,11 @@
 #include "src/flags/flags.h"
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/interpreter.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/code.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/tracing/trace-event.h"
 
 #ifdef V8_ENABLE_SPARKPLUG
@@ -229,7 +232,18 @@ int TieringManager::InterruptBudgetFor(
       function->shared()->GetBytecodeArray(isolate)->length();
 
   if (FirstTimeTierUpToSparkplug(isolate, function)) {
-    return bytecode_length * v8_flags.invocation_count_for_feedback_allocation;
+    int budget_length = bytecode_length;
+    if (!function->has_feedback_vector() &&
+        function->shared()->HasFeedbackMetadata()) {
+      // Until the budget runs out the function only has its compact
+      // ClosureFeedbackCellArray. Make functions that would get a large
+      // feedback vector run longer before paying for it.
+      static constexpr int kSlotsWithoutExtraBudget = 32;
+      int slot_count = function->shared()->feedback_metadata()->slot_count();
+      budget_length += std::max(0, slot_count - kSlotsWithoutExtraBudget) *
+                       v8_flags.feedback_allocation_budget_per_slot;
+    }
+    return budget_length * v8_flags.invocation_count_for_feedback_allocation;
   }
 
   DCHECK(function->has_feedback_vector());
@@ -246,6 +260,22 @@ int TieringManager::InterruptBudgetFor(
       function, function->shared()->cached_tiering_decision(), bytecode_length);
 }
 
+// static
+int TieringManager::ConcurrentCompilationPriority(Tagged<JSFunction> function,
+                                                  bool is_osr) {
+  if (!function->has_feedback_vector()) return 0;
+  Tagged<FeedbackVector> vector = function->feedback_vector();
+  // Functions are mostly ordered by the number of times that they were
+  // called, and functions that are stuck in long-running loops go first.
+  static constexpr int kInvocationCountCap = 1 << 16;
+  int priority = std::min(vector->invocation_count(), kInvocationCountCap);
+  priority += vector->osr_urgency() * kInvocationCountCap;
+  if (is_osr) {
+    priority += (FeedbackVector::kMaxOsrUrgency + 1) * kInvocationCountCap;
+  }
+  return priority;
+}
+
 namespace {
 
 void TrySetOsrUrgency(Isolate* isolate, Tagged<JSFunction> function,
@@ -379,6 +409,27 @@ void TieringManager::MaybeOptimizeFrame(Tagged<JSFunction> function,
   if (d.should_optimize()) Optimize(function, d);
 }
 
+namespace {
+
+// Returns true if every invocation of {bytecode} is cheap, because it is small
+// and has no loops. Optimizing such functions on their own rarely pays off:
+// they spend most of their time in their callers or callees, and TurboFan
+// inlines them into their callers.
+bool IsCheapFunction(Handle<BytecodeArray> bytecode) {
+  if (bytecode->length() > v8_flags.max_inlined_bytecode_size_small) {
+    return false;
+  }
+  for (interpreter::BytecodeArrayIterator it(bytecode); !it.done();
+       it.Advance()) {
+    if (it.current_bytecode() == interpreter::Bytecode::kJumpLoop) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 OptimizationDecision TieringManager::ShouldOptimize(
     Tagged<FeedbackVector> feedback_vector, CodeKind current_code_kind) {
   Tagged<SharedFunctionInfo> shared = feedback_vector->shared_function_info();
@@ -386,6 +437,18 @@ OptimizationDecision TieringManager::ShouldOptimize(
     return OptimizationDecision::DoNotOptimize();
   }
 
+  // Without new feedback, the function would deoptimize again in the tier
+  // that it deoptimized from. Keep it in the tier below.
+  const bool in_deopt_loop =
+      v8_flags.deopt_loop_threshold > 0 &&
+      feedback_vector->deopts_without_ic_change() >=
+          std::min(v8_flags.deopt_loop_threshold.value(),
+                   FeedbackVector::kMaxDeoptsWithoutIcChange);
+  if (in_deopt_loop && (feedback_vector->last_deopt_was_maglev() ||
+                        current_code_kind == CodeKind::MAGLEV)) {
+    return OptimizationDecision::DoNotOptimize();
+  }
+
   if (TiersUpToMaglev(current_code_kind) &&
       shared->PassesFilter(v8_flags.maglev_filter) &&
       !shared->maglev_compilation_failed()) {
@@ -397,6 +460,8 @@ OptimizationDecision TieringManager::ShouldOptimize(
     return OptimizationDecision::Maglev();
   }
 
+  if (in_deopt_loop) return OptimizationDecision::DoNotOptimize();
+
   if (V8_UNLIKELY(!v8_flags.turbofan ||
                   !shared->PassesFilter(v8_flags.turbo_filter) ||
                   (v8_flags.efficiency_mode_disable_turbofan &&
@@ -417,6 +482,17 @@ OptimizationDecision TieringManager::ShouldOptimize(
     return OptimizationDecision::DoNotOptimize();
   }
 
+  if (v8_flags.tiering_delay_cheap_functions &&
+      feedback_vector->invocation_count() <
+          v8_flags.invocation_count_for_cheap_turbofan &&
+      IsCheapFunction(handle(bytecode, isolate_))) {
+    if (v8_flags.trace_opt_verbose) {
+      PrintF("[delaying optimization of %s, cheap function]\n",
+             shared->DebugNameCStr().get());
+    }
+    return OptimizationDecision::DoNotOptimize();
+  }
+
   return OptimizationDecision::TurbofanHotAndStable();
 }
 
@@ -442,6 +518,9 @@ bool ShouldResetInterruptBudgetByICChange(
 }  // namespace
 
 void TieringManager::NotifyICChanged(Tagged<FeedbackVector> vector) {
+  // New feedback may make the next optimization stick.
+  vector->ResetDeoptsWithoutIcChange();
+
   CodeKind code_kind = vector->shared_function_info()->HasBaselineCode()
                            ? CodeKind::BASELINE
                            : CodeKind::INTERPRETED_FUNCTION;
@@ -42,6 +42,11 @@ class TieringManager {
 
   void MarkForTurboFanOptimization(Tagged<JSFunction> function);
 
+  // Returns how urgent a concurrent optimization of {function} is, for
+  // ordering the jobs of the optimizing compile dispatcher. Higher is hotter.
+  static int ConcurrentCompilationPriority(Tagged<JSFunction> function,
+                                           bool is_osr);
+
  private:
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
@@ -583,6 +583,9 @@ DEFINE_BOOL(maglev_destroy_on_background, true,
             "Destroy compilation jobs on background thread")
 DEFINE_BOOL(maglev_inline_api_calls, false,
             "Inline CallApiCallback builtin into generated code")
+DEFINE_BOOL(maglev_proxy_access, true,
+            "Specialize named property accesses on proxies, inlining the trap "
+            "of proxies with a known handler")
 DEFINE_EXPERIMENTAL_FEATURE(maglev_licm, "loop invariant code motion")
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_speculative_hoist_phi_untagging)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_api_calls)
@@ -931,6 +934,9 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
            "invocation count required for allocating feedback vectors")
+DEFINE_INT(feedback_allocation_budget_per_slot, 4,
+           "extra bytecode-equivalent interrupt budget per feedback slot "
+           "(beyond the first 32) before a feedback vector is allocated")
 
 // Tiering: Maglev.
 #if defined(ANDROID)
@@ -955,6 +961,12 @@ DEFINE_VALUE_IMPLICATION(always_osr_from_maglev, osr_from_maglev, true)
 DEFINE_INT(invocation_count_for_turbofan, 3000,
            "invocation count required for optimizing with TurboFan")
 DEFINE_INT(invocation_count_for_osr, 500, "invocation count required for OSR")
+DEFINE_BOOL(tiering_delay_cheap_functions, false,
+            "delay the TurboFan tier-up of small functions without loops, "
+            "which run cheaply and are usually inlined into their callers")
+DEFINE_INT(invocation_count_for_cheap_turbofan, 12000,
+           "invocation count required for optimizing small functions without "
+           "loops with TurboFan, with --tiering-delay-cheap-functions")
 DEFINE_INT(osr_to_tierup, 1,
            "number to decrease the invocation budget by when we follow OSR")
 DEFINE_INT(minimum_invocations_after_ic_update, 500,
@@ -1088,11 +1100,17 @@ DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
+DEFINE_BOOL(sparkplug_break_checks, false,
+            "compile functions with break points with Sparkplug, checking the "
+            "debug bytecode for a break at each break location")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
 DEFINE_INT(baseline_batch_compilation_threshold, 4 * KB,
            "the estimated instruction size of a batch to trigger compilation")
+DEFINE_BOOL(baseline_batch_compilation_adaptive_threshold, false,
+            "adapt the batch compilation threshold to the number of batches "
+            "that wait for a concurrent Sparkplug thread")
 DEFINE_BOOL(trace_baseline, false, "trace baseline compilation")
 DEFINE_BOOL(trace_baseline_batch_compilation, false,
             "trace baseline batch compilation")
@@ -1104,6 +1122,11 @@ DEFINE_WEAK_IMPLICATION(trace_baseline, trace_baseline_batch_compilation)
 DEFINE_BOOL(shared_string_table, false, "internalize strings into shared table")
 DEFINE_IMPLICATION(harmony_struct, shared_string_table)
 DEFINE_IMPLICATION(shared_string_table, shared_heap)
+DEFINE_INT(value_serializer_shared_string_min_length, 0,
+           "share strings of at least this length with the receiving isolate "
+           "when serializing values, instead of copying them (0 disables; "
+           "requires the shared string table and an embedder that supports "
+           "shared value conveyors)")
 DEFINE_BOOL_READONLY(always_use_string_forwarding_table, false,
                      "use string forwarding table instead of thin strings for "
                      "all strings (experimental)")
@@ -1141,6 +1164,9 @@ DEFINE_INT(concurrent_recompilation_delay, 0,
 DEFINE_BOOL(concurrent_recompilation_front_running, true,
             "move compile jobs to the front if recompilation is requested "
             "multiple times")
+DEFINE_BOOL(concurrent_recompilation_prioritize_hot_jobs, false,
+            "compile the hottest queued functions first, and drop cold "
+            "compile jobs when the queue is full")
 DEFINE_UINT(
     concurrent_turbofan_max_threads, 4,
     "max number of threads that concurrent Turbofan can use (0 for unbounded)")
@@ -1318,6 +1344,9 @@ DEFINE_FLOAT(
     "scale factor of bytecode size used to calculate the inlining budget")
 DEFINE_INT(max_inlined_bytecode_size_small, 27,
            "maximum size of bytecode considered for small function inlining")
+DEFINE_INT(deopt_loop_threshold, 0,
+           "number of deopts without new IC feedback after which a function "
+           "is kept in a lower tier (at most 3, 0 to disable)")
 DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "maximum bytecode size to "
            "be considered for turbofan optimization; too high values may cause "
@@ -1344,6 +1373,9 @@ DEFINE_WEAK_VALUE_IMPLICATION(maglev_osr, osr_from_maglev, true)
 DEFINE_NEG_VALUE_IMPLICATION(use_osr, maglev_osr, false)
 DEFINE_NEG_VALUE_IMPLICATION(turbofan, osr_from_maglev, false)
 DEFINE_BOOL(concurrent_osr, true, "enable concurrent OSR")
+DEFINE_BOOL(concurrent_maglev_osr_in_efficiency_mode, false,
+            "keep compiling Maglev OSR code concurrently in efficiency mode, "
+            "instead of blocking the loop until the code is ready")
 
 DEFINE_BOOL(maglev_escape_analysis, true,
             "avoid inlined allocation of objects that cannot escape")
@@ -1379,6 +1411,10 @@ DEFINE_BOOL(turbo_profiling_verbose, false,
             "enable basic block profiling in TurboFan, and include each "
             "function's schedule and disassembly in the output")
 DEFINE_IMPLICATION(turbo_profiling_verbose, turbo_profiling)
+DEFINE_BOOL(turbo_profiling_js, false,
+            "enable basic block profiling of optimized JavaScript functions, "
+            "and derive branch hints from it when they are reoptimized")
+DEFINE_NEG_IMPLICATION(turbo_profiling_js, concurrent_recompilation)
 DEFINE_STRING(
     turbo_profiling_output, nullptr,
     "emit data about basic block usage in builtins to this file "
@@ -1398,6 +1434,10 @@ DEFINE_STRING(
 
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
+DEFINE_INT(turbo_control_flow_aware_allocation_limit, 0,
+           "number of instructions above which the register allocator stops "
+           "reconciling register assignments at control-flow merges, which "
+           "speeds up the allocation of huge functions (0 means no limit)")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
@@ -1408,6 +1448,8 @@ DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_BOOL(turbo_instruction_scheduling_on_in_order_cores, true,
+            "enable instruction scheduling in TurboFan on in-order CPU cores")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
@@ -1485,6 +1527,9 @@ DEFINE_BOOL(turboshaft_enable_debug_features, false,
 
 DEFINE_BOOL(turboshaft_wasm_load_elimination, true,
             "enable Turboshaft's WasmLoadElimination")
+DEFINE_BOOL(wasm_inline_bulk_memory, true,
+            "inline memory.copy and memory.fill with a small constant size "
+            "in Turboshaft")
 
 DEFINE_EXPERIMENTAL_FEATURE(
     turboshaft_wasm_in_js_inlining,
@@ -1503,6 +1548,23 @@ DEFINE_BOOL(turboshaft_load_elimination, true,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_trip_count_aware_unrolling, false,
+            "fit Turboshaft's partial unroll count to the trip count of loops "
+            "whose number of iterations is known or bounded")
+DEFINE_BOOL(turboshaft_licm, false,
+            "enable Turboshaft's loop-invariant code motion")
+DEFINE_BOOL(turboshaft_bounds_check_elimination, false,
+            "enable Turboshaft's elimination of bounds checks implied by "
+            "dominating comparisons")
+DEFINE_BOOL(turboshaft_check_hoisting, false,
+            "enable Turboshaft's hoisting of checks that are redundant on "
+            "both successors of a branch")
+DEFINE_BOOL(turboshaft_typed_array_vectorization, false,
+            "enable Turboshaft's vectorization of element-wise loops over "
+            "typed arrays")
+DEFINE_BOOL(turboshaft_allocation_escape_analysis, false,
+            "enable Turboshaft's scalar replacement of non-escaping "
+            "allocations")
 DEFINE_BOOL(turboshaft_string_concat_escape_analysis, true,
             "enable Turboshaft's escape analysis for string concatenation")
 
@@ -1549,6 +1611,14 @@ DEFINE_BOOL(turboshaft_trace_unrolling, false,
             "trace Turboshaft's loop unrolling reducer")
 DEFINE_BOOL(turboshaft_trace_peeling, false,
             "trace Turboshaft's loop peeling reducer")
+DEFINE_BOOL(turboshaft_trace_licm, false,
+            "trace Turboshaft's loop-invariant code motion")
+DEFINE_BOOL(turboshaft_trace_bounds_check_elimination, false,
+            "trace Turboshaft's bounds check elimination")
+DEFINE_BOOL(turboshaft_trace_check_hoisting, false,
+            "trace Turboshaft's hoisting of checks out of diamonds")
+DEFINE_BOOL(turboshaft_trace_typed_array_vectorization, false,
+            "trace Turboshaft's vectorization of typed array loops")
 DEFINE_BOOL(turboshaft_trace_load_elimination, false,
             "trace Turboshaft's late load elimination")
 #else
@@ -1563,6 +1633,23 @@ DEFINE_BOOL_READONLY(turboshaft_trace_intermediate_reductions, false,
 DEFINE_BOOL(profile_guided_optimization, true, "profile guided optimization")
 DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, true,
             "profile guided optimization for empty feedback vector")
+DEFINE_BOOL(code_cache_tiering_decisions, false,
+            "keep the profile guided tiering decisions of optimized functions "
+            "in the code cache, so that they tier up early after "
+            "deserialization")
+DEFINE_IMPLICATION(code_cache_tiering_decisions, profile_guided_optimization)
+DEFINE_BOOL(code_cache_compile_hints, false,
+            "keep the positions of the lazily compiled functions in the code "
+            "cache, and compile them in parallel after deserialization")
+DEFINE_IMPLICATION(code_cache_compile_hints, lazy_compile_dispatcher)
+DEFINE_BOOL(code_cache_pretenuring_decisions, false,
+            "keep the pretenuring decisions of literal allocation sites in the "
+            "code cache, and pretenure the literals right away after "
+            "deserialization")
+DEFINE_BOOL(reuse_unchanged_code_cache, false,
+            "remember the code cache last produced for a script, and return "
+            "it again instead of serializing the script when no functions "
+            "were compiled in between")
 DEFINE_INT(invocation_count_for_early_optimization, 30,
            "invocation count threshold for early optimization")
 DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
@@ -1692,6 +1779,9 @@ DEFINE_NEG_IMPLICATION(experimental_wasm_pgo_to_file, single_threaded)
 DEFINE_BOOL(
     experimental_wasm_pgo_from_file, false,
     "experimental: read and use Wasm PGO data from a local file (for testing)")
+DEFINE_BOOL(wasm_serialize_type_feedback, true,
+            "store call target feedback in serialized Wasm modules and restore "
+            "it when deserializing, to keep inlining decisions across runs")
 
 DEFINE_BOOL(validate_asm, true,
             "validate asm.js modules and translate them to Wasm")
@@ -1815,6 +1905,9 @@ DEFINE_BOOL(asm_wasm_lazy_compilation, true,
             "--validate-asm)")
 DEFINE_BOOL(wasm_lazy_compilation, true,
             "enable lazy compilation for all wasm modules")
+DEFINE_BOOL(wasm_lazy_compile_callees, false,
+            "when compiling a wasm function lazily, also compile its direct "
+            "callees in the background")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_EXPERIMENTAL_FEATURE(
@@ -1827,6 +1920,9 @@ DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
+DEFINE_BOOL(wasm_reuse_freed_code_space, true,
+            "allocate new wasm code in space freed by code GC before "
+            "reserving more code space")
 DEFINE_INT(wasm_max_initial_code_space_reservation, 0,
            "maximum size of the initial wasm code space reservation (in MB)")
 DEFINE_BOOL(stress_wasm_memory_moving, false,
@@ -2062,6 +2158,12 @@ DEFINE_UINT(minor_gc_task_trigger, 80,
 DEFINE_BOOL(minor_gc_task_with_lower_priority, false,
             "schedules the minor GC task with kUserVisible priority.")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_BOOL(scavenger_numa_aware, false,
+            "let parallel scavenger tasks prefer old-to-new pages that reside "
+            "on their own NUMA node")
+DEFINE_BOOL(card_table_old_to_new, false,
+            "record old-to-new slots of large fixed arrays by card marking "
+            "instead of in slot sets")
 DEFINE_EXPERIMENTAL_FEATURE(
     cppgc_young_generation,
     "run young generation garbage collections in Oilpan")
@@ -2083,12 +2185,28 @@ DEFINE_INT(
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(array_buffer_pooling, false,
+            "cache zeroed memory of small array buffers in per-isolate size "
+            "class free lists")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
+DEFINE_BOOL(adaptive_background_lab_size, false,
+            "grow the linear allocation areas of background threads with "
+            "their allocation rate")
+DEFINE_BOOL(adaptive_shared_lab_size, false,
+            "grow the linear allocation areas of client isolates in the shared "
+            "space with their allocation rate")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
+DEFINE_BOOL(marking_work_stealing, false,
+            "use per-marker work-stealing deques for chunks of large arrays "
+            "during major marking")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
+DEFINE_BOOL(parallel_ephemeron_index, false,
+            "use an index of pending ephemerons keyed by unmarked keys instead "
+            "of the linear ephemeron algorithm, which supports parallel "
+            "marking")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping,
@@ -2108,6 +2226,9 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_SIZE_T(zone_segment_pool_size, 8 * MB,
+              "maximum number of bytes of freed zone segments that are kept "
+              "for reuse by later zones, per isolate")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -2163,6 +2284,13 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(memory_reducer_gc_count, 2,
            "Maximum number of memory reducer GCs scheduled")
+DEFINE_BOOL(discard_pooled_pages, false,
+            "keep pooled pages mapped on memory-reducing GCs and only discard "
+            "their contents; the memory reducer releases them once the heap "
+            "is idle")
+DEFINE_SIZE_T(max_discarded_pooled_memory_mb, 64,
+              "maximum amount of discarded pooled memory kept mapped across "
+              "memory-reducing GCs")
 DEFINE_BOOL(
     external_memory_accounted_in_global_limit, false,
     "External memory limits are computed as part of global limits in v8 Heap.")
@@ -2207,6 +2335,9 @@ DEFINE_BOOL(flush_code_based_on_time, false,
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
             "Flush code when tab goes into the background.")
 DEFINE_INT(bytecode_old_time, 30, "number of seconds before we flush code")
+DEFINE_BOOL(flush_code_on_memory_pressure, false,
+            "under memory pressure, flush the code that was not executed "
+            "since the previous full GC")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_code, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -2475,6 +2606,8 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_BOOL(trace_deopt_materialization, false,
+            "trace the number of objects materialized by each deoptimization")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_turbofan, false, "always try to optimize functions")
@@ -2490,6 +2623,11 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_BOOL(process_wide_script_cache, false,
+            "share the bytecode of top-level scripts between the isolates of "
+            "the process, in the code cache format")
+DEFINE_SIZE_T(process_wide_script_cache_size, 64,
+              "maximum size of the process-wide script cache (in MB)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -2509,10 +2647,19 @@ DEFINE_EXPERIMENTAL_FEATURE(
     parallel_compile_tasks_for_lazy,
     "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_streaming, false,
+            "spawn parallel compile tasks for eagerly compiled, top-level "
+            "functions of streamed scripts")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_streaming,
+                   lazy_compile_dispatcher)
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_BOOL(cpu_profiler_cpu_time_sampling, false,
+            "sample the profiled thread each time it has used a sampling "
+            "interval of CPU time instead of signalling it from the profiler "
+            "thread, so that idle threads are not interrupted (Linux only)")
 
 // debugger
 DEFINE_BOOL(
@@ -2582,6 +2729,20 @@ DEFINE_IMPLICATION(log_ic, log_code)
 DEFINE_GENERIC_IMPLICATION(
     log_ic, TracingFlags::ic_stats.store(
                 v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_BOOL(grow_stub_cache, true,
+            "grow the megamorphic stub cache tables when entries keep getting "
+            "evicted")
+DEFINE_INT(trace_megamorphic_ic_sites, 0,
+           "print the given number of megamorphic IC sites with the most stub "
+           "cache updates, and the number of maps seen there, on teardown")
+DEFINE_INT(jit_transitions_report_interval, 10000,
+           "minimum interval in milliseconds between reports of aggregated "
+           "deoptimizations and megamorphic IC transitions to the embedder's "
+           "metrics recorder")
+DEFINE_INT(dictionary_load_misses_before_fast_mode, 4,
+           "migrate a dictionary-mode object back to fast properties after "
+           "this many load IC misses on it without a change to its keys "
+           "(0 disables, at most 7)")
 DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 #define DEFAULT_MAX_POLYMORPHIC_MAP_COUNT 4
@@ -2599,6 +2760,10 @@ DEFINE_INT(fast_properties_soft_limit, 12,
 DEFINE_INT(max_fast_properties, 128,
            "limits the number of mutable properties that can be added to an "
            "object before transitioning to dictionary mode")
+DEFINE_INT(max_property_transitions_per_map, 0,
+           "normalize objects instead of adding a property transition to a "
+           "map that already has this many, so objects built in varying "
+           "property orders share dictionary maps (0 disables)")
 
 DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
             "generate extra code for manipulating stats counters")
@@ -2658,6 +2823,14 @@ DEFINE_BOOL(sim_abort_on_bad_auth, true,
             "ARM64 simulator.")
 #endif
 
+// memcopy.cc
+DEFINE_BOOL(non_temporal_memcopy, true,
+            "copy large array buffer contents with non-temporal stores that "
+            "bypass the cache")
+DEFINE_SIZE_T(non_temporal_memcopy_threshold, 0,
+              "minimum size in bytes of a non-temporal copy (0 means half of "
+              "the last-level cache)")
+
 // isolate.cc
 DEFINE_BOOL(async_stack_traces, true,
             "include async stack traces in Error.stack")
@@ -2724,6 +2897,9 @@ DEFINE_BOOL(
 DEFINE_BOOL(abort_on_far_code_range, false,
             "Abort if code range is allocated further away than 4GB from the"
             ".text section")
+DEFINE_BOOL(huge_pages, false,
+            "align the code range and large object pages to 2MB and advise "
+            "the OS to back them with transparent huge pages")
 
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
@@ -2733,6 +2909,13 @@ DEFINE_GENERIC_IMPLICATION(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
 DEFINE_BOOL(rcs, false, "report runtime call counts and times")
 DEFINE_IMPLICATION(rcs, runtime_call_stats)
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "attribute CPU profiler ticks to the innermost runtime call "
+            "counter instead of timing every runtime call")
+DEFINE_GENERIC_IMPLICATION(
+    runtime_call_stats_sampling,
+    TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
 
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
@@ -2746,8 +2929,24 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(trace_deserialization, false, "Trace the snapshot deserialization.")
+// snapshot-compression.cc
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "Decompress the chunks of a compressed snapshot on worker threads.")
+DEFINE_BOOL(cache_context_snapshots, false,
+            "Decompress the context snapshots of a compressed snapshot on a "
+            "worker thread after isolate initialization and keep them for "
+            "the lifetime of the isolate.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(serialize_cold_functions_last, false,
+            "Serialize functions that were not compiled when the snapshot was "
+            "taken after all other objects, for better startup locality.")
+// read-only-deserializer.cc
+DEFINE_STRING(read_only_space_image, nullptr,
+              "Map the read-only space copy-on-write from a page-aligned image "
+              "at the given path, so that its pages are shared between "
+              "processes. The image is created if it does not exist or does "
+              "not match the snapshot. Requires static roots.")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -2961,6 +3160,8 @@ DEFINE_BOOL(trace_minor_ms_parallel_marking, false,
 DEFINE_BOOL(minor_ms, false, "perform young generation mark sweep GCs")
 DEFINE_IMPLICATION(minor_ms, separate_gc_phases)
 DEFINE_IMPLICATION(minor_ms, page_promotion)
+// Card tables are only processed by the scavenger.
+DEFINE_NEG_IMPLICATION(minor_ms, card_table_old_to_new)
 
 DEFINE_BOOL(concurrent_minor_ms_marking, true,
             "perform young generation marking concurrently")
@@ -3171,6 +3372,9 @@ DEFINE_INT(prof_sampling_interval, DEFAULT_PROF_SAMPLING_INTERVAL,
 DEFINE_BOOL(prof_cpp, false, "Like --prof, but ignore generated code.")
 DEFINE_BOOL(prof_browser_mode, true,
             "Used with --prof, turns on browser-compatible mode for profiling.")
+DEFINE_BOOL(prof_compact_ticks, false,
+            "Used with --prof, logs the stack frames of ticks as offsets from "
+            "the previous frame to make the log smaller.")
 
 DEFINE_BOOL(prof, false,
             "Log statistical profiling information (implies --log-code).")
@@ -3216,7 +3420,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 
 // --perf-prof-unwinding-info is available only on selected architectures.
 #if V8_TARGET_ARCH_ARM || V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64 || \
@@ -3330,6 +3533,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_streaming)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -3365,11 +3569,17 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_streaming)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
 #endif  // V8_ENABLE_MAGLEV
 
+DEFINE_BOOL(parallel_bigint_operations, false,
+            "split multiplications (and divisions) of very large BigInts "
+            "across worker threads")
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_bigint_operations)
+
 //
 // Parallel and concurrent GC (Orinoco) related flags.
 //
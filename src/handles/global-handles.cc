@@ -610,7 +610,7 @@ GlobalHandles::GlobalHandles(Isolate* isolate)
     : isolate_(isolate),
       regular_nodes_(std::make_unique<NodeSpace<GlobalHandles::Node>>(this)) {}
 
-GlobalHandles::~GlobalHandles() = default;
+GlobalHandles::~GlobalHandles() { WaitForThreadSafeSecondPassCallbacks(); }
 
 namespace {
 
@@ -846,7 +846,13 @@ size_t GlobalHandles::InvokeFirstPassWeakCallbacks() {
                    "Handle not reset in first callback. See comments on "
                    "|v8::WeakCallbackInfo|.");
 
-    if (pair.second.callback()) second_pass_callbacks_.push_back(pair.second);
+    if (pair.second.callback()) {
+      if (pair.second.is_thread_safe()) {
+        thread_safe_second_pass_callbacks_.push_back(pair.second);
+      } else {
+        second_pass_callbacks_.push_back(pair.second);
+      }
+    }
     freed_nodes++;
   }
   last_gc_custom_callbacks_ = freed_nodes;
@@ -860,7 +866,8 @@ void GlobalHandles::PendingPhantomCallback::Invoke(Isolate* isolate,
     callback_addr = &callback_;
   }
   Data data(reinterpret_cast<v8::Isolate*>(isolate), parameter_,
-            embedder_fields_, callback_addr);
+            embedder_fields_, callback_addr,
+            type == kFirstPass ? &is_thread_safe_ : nullptr);
   Data::Callback callback = callback_;
   callback_ = nullptr;
   callback(data);
@@ -873,7 +880,10 @@ void GlobalHandles::PostGarbageCollectionProcessing(
   // API functions.
   DCHECK_EQ(Heap::NOT_IN_GC, isolate_->heap()->gc_state());
 
-  if (second_pass_callbacks_.empty()) return;
+  if (second_pass_callbacks_.empty() &&
+      thread_safe_second_pass_callbacks_.empty()) {
+    return;
+  }
 
   const bool synchronous_second_pass =
       isolate_->MemorySaverModeEnabled() || v8_flags.predictable ||
@@ -882,11 +892,18 @@ void GlobalHandles::PostGarbageCollectionProcessing(
        (kGCCallbackFlagForced | kGCCallbackFlagCollectAllAvailableGarbage |
         kGCCallbackFlagSynchronousPhantomCallbackProcessing)) != 0;
   if (synchronous_second_pass) {
+    // Thread-safe callbacks are simply invoked together with the others.
+    for (auto& callback : thread_safe_second_pass_callbacks_) {
+      second_pass_callbacks_.push_back(callback);
+    }
+    thread_safe_second_pass_callbacks_.clear();
     InvokeSecondPassPhantomCallbacks();
     return;
   }
 
-  if (!second_pass_callbacks_task_posted_) {
+  PostThreadSafeSecondPassCallbacks();
+
+  if (!second_pass_callbacks_.empty() && !second_pass_callbacks_task_posted_) {
     second_pass_callbacks_task_posted_ = true;
     V8::GetCurrentPlatform()
         ->GetForegroundTaskRunner(reinterpret_cast<v8::Isolate*>(isolate()))
@@ -898,6 +915,63 @@ void GlobalHandles::PostGarbageCollectionProcessing(
   }
 }
 
+class GlobalHandles::ThreadSafeSecondPassCallbacksTask final
+    : public v8::Task {
+ public:
+  ThreadSafeSecondPassCallbacksTask(
+      GlobalHandles* global_handles,
+      std::vector<PendingPhantomCallback> callbacks)
+      : global_handles_(global_handles), callbacks_(std::move(callbacks)) {}
+
+  void Run() final {
+    TRACE_EVENT1("v8", "V8.GCThreadSafeSecondPassCallbacks", "count",
+                 callbacks_.size());
+    for (auto& callback : callbacks_) {
+      callback.Invoke(global_handles_->isolate(),
+                      PendingPhantomCallback::kSecondPass);
+    }
+    // Report back completion. This must be the last access to
+    // `global_handles_` as it may be destroyed afterwards.
+    base::MutexGuard guard(&global_handles_->thread_safe_batches_mutex_);
+    DCHECK_LT(0, global_handles_->pending_thread_safe_batches_);
+    if (--global_handles_->pending_thread_safe_batches_ == 0) {
+      global_handles_->thread_safe_batches_done_.NotifyAll();
+    }
+  }
+
+ private:
+  GlobalHandles* const global_handles_;
+  std::vector<PendingPhantomCallback> callbacks_;
+};
+
+void GlobalHandles::PostThreadSafeSecondPassCallbacks() {
+  static constexpr size_t kBatchSize = 256;
+  if (thread_safe_second_pass_callbacks_.empty()) return;
+
+  std::vector<PendingPhantomCallback> callbacks;
+  callbacks.swap(thread_safe_second_pass_callbacks_);
+  for (size_t start = 0; start < callbacks.size(); start += kBatchSize) {
+    const size_t end = std::min(start + kBatchSize, callbacks.size());
+    std::vector<PendingPhantomCallback> batch(callbacks.begin() + start,
+                                              callbacks.begin() + end);
+    {
+      base::MutexGuard guard(&thread_safe_batches_mutex_);
+      pending_thread_safe_batches_++;
+    }
+    V8::GetCurrentPlatform()->PostTaskOnWorkerThread(
+        TaskPriority::kUserVisible,
+        std::make_unique<ThreadSafeSecondPassCallbacksTask>(this,
+                                                            std::move(batch)));
+  }
+}
+
+void GlobalHandles::WaitForThreadSafeSecondPassCallbacks() {
+  base::MutexGuard guard(&thread_safe_batches_mutex_);
+  while (pending_thread_safe_batches_ > 0) {
+    thread_safe_batches_done_.Wait(&thread_safe_batches_mutex_);
+  }
+}
+
 void GlobalHandles::IterateStrongRoots(RootVisitor* v) {
   for (Node* node : *regular_nodes_) {
     if (node->IsStrongRetainer()) {
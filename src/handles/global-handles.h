@@ -13,6 +13,8 @@
 #include "include/v8-callbacks.h"
 #include "include/v8-persistent-handle.h"
 #include "include/v8-profiler.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/handles/handles.h"
 #include "src/heap/heap.h"
 #include "src/objects/heap-object.h"
@@ -81,6 +83,9 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
 
   size_t InvokeFirstPassWeakCallbacks();
   void InvokeSecondPassPhantomCallbacks();
+  // Blocks until all thread-safe second pass callbacks that were posted to
+  // worker threads have run.
+  void WaitForThreadSafeSecondPassCallbacks();
 
   // Schedule or invoke second pass weak callbacks.
   void PostGarbageCollectionProcessing(v8::GCCallbackFlags gc_callback_flags);
@@ -140,6 +145,10 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   template <class NodeType>
   class NodeSpace;
   class PendingPhantomCallback;
+  class ThreadSafeSecondPassCallbacksTask;
+
+  // Posts the pending thread-safe second pass callbacks to worker threads.
+  void PostThreadSafeSecondPassCallbacks();
 
   void ApplyPersistentHandleVisitor(v8::PersistentHandleVisitor* visitor,
                                     Node* node);
@@ -161,6 +170,14 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
       pending_phantom_callbacks_;
   std::vector<PendingPhantomCallback> second_pass_callbacks_;
   bool second_pass_callbacks_task_posted_ = false;
+  // Second pass callbacks that were declared thread-safe. They are invoked in
+  // batches on worker threads.
+  std::vector<PendingPhantomCallback> thread_safe_second_pass_callbacks_;
+  // Number of batches of thread-safe callbacks that were posted to worker
+  // threads and have not finished yet. Guarded by the mutex.
+  size_t pending_thread_safe_batches_ = 0;
+  base::Mutex thread_safe_batches_mutex_;
+  base::ConditionVariable thread_safe_batches_done_;
   size_t last_gc_custom_callbacks_ = 0;
 };
 
@@ -182,11 +199,15 @@ class GlobalHandles::PendingPhantomCallback final {
   void Invoke(Isolate* isolate, InvocationType type);
 
   Data::Callback callback() const { return callback_; }
+  // Whether the second pass callback was declared thread-safe in the first
+  // pass.
+  bool is_thread_safe() const { return is_thread_safe_; }
 
  private:
   Data::Callback callback_;
   void* parameter_;
   void* embedder_fields_[v8::kEmbedderFieldsInWeakCallback];
+  bool is_thread_safe_ = false;
 };
 
 class EternalHandles final {
@@ -190,6 +190,60 @@ void TracedHandles::Destroy(TracedNodeBlock& node_block, TracedNode& node) {
   FreeNode(&node, kTracedHandleEagerResetZapValue);
 }
 
+void TracedHandles::CreateBatch(const Address* values, Address** slots,
+                                size_t count,
+                                TracedReferenceStoreMode store_mode,
+                                TracedReferenceHandling reference_handling) {
+  const bool needs_black_allocation =
+      is_marking_ && store_mode != TracedReferenceStoreMode::kInitializingStore;
+  const bool is_droppable =
+      reference_handling == TracedReferenceHandling::kDroppable;
+  size_t i = 0;
+  while (i < count) {
+    if (V8_UNLIKELY(usable_blocks_.empty())) {
+      RefillUsableNodeBlocks();
+    }
+    TracedNodeBlock* block = usable_blocks_.Front();
+    bool block_needs_young_list = false;
+    // Fill up the current block before moving on to the next one.
+    for (; i < count && !block->IsFull(); i++) {
+      Address** slot = &slots[i];
+      if (values[i] == kNullAddress) {
+        SetSlotThreadSafe(slot, nullptr);
+        continue;
+      }
+      Tagged<Object> object(values[i]);
+      TracedNode* node = block->AllocateNode();
+      DCHECK(node->IsMetadataCleared());
+      used_nodes_++;
+      const bool needs_young_bit_update =
+          NeedsTrackingInYoungNodes(object, node);
+      const bool has_old_host = NeedsToBeRemembered(
+          object, node, reinterpret_cast<Address*>(slot), store_mode);
+      FullObjectSlot result_slot =
+          node->Publish(object, needs_young_bit_update, needs_black_allocation,
+                        has_old_host, is_droppable);
+      block_needs_young_list |= needs_young_bit_update;
+      if (needs_black_allocation) {
+        WriteBarrier::MarkingFromTracedHandle(object);
+      }
+#ifdef VERIFY_HEAP
+      if (v8_flags.verify_heap) {
+        Object::ObjectVerify(*result_slot, isolate_);
+      }
+#endif  // VERIFY_HEAP
+      SetSlotThreadSafe(slot, result_slot.location());
+    }
+    if (block->IsFull()) {
+      usable_blocks_.Remove(block);
+    }
+    if (block_needs_young_list && !block->InYoungList()) {
+      young_blocks_.PushFront(block);
+      block->SetInYoungList(true);
+    }
+  }
+}
+
 void TracedHandles::Copy(const TracedNode& from_node, Address** to) {
   DCHECK_NE(kGlobalHandleZapValue, from_node.raw_object());
   FullObjectSlot o =
@@ -527,6 +581,18 @@ void TracedHandles::Destroy(Address* location) {
   traced_handles.Destroy(node_block, *node);
 }
 
+// static
+void TracedHandles::DestroyBatch(Address** slots, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    Address* location = slots[i];
+    if (!location) continue;
+    auto* node = TracedNode::FromLocation(location);
+    auto& node_block = TracedNodeBlock::From(*node);
+    node_block.traced_handles().Destroy(node_block, *node);
+    SetSlotThreadSafe(&slots[i], nullptr);
+  }
+}
+
 // static
 void TracedHandles::Copy(const Address* const* from, Address** to) {
   DCHECK_NOT_NULL(*from);
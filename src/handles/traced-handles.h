@@ -260,6 +260,9 @@ class V8_EXPORT_PRIVATE TracedHandles final {
   enum class MarkMode : uint8_t { kOnlyYoung, kAll };
 
   static void Destroy(Address* location);
+  // Destroys the handles referenced from the `count` consecutive slots starting
+  // at `slots` and clears the slots. Empty slots are skipped.
+  static void DestroyBatch(Address** slots, size_t count);
   static void Copy(const Address* const* from, Address** to);
   static void Move(Address** from, Address** to);
 
@@ -280,6 +283,15 @@ class V8_EXPORT_PRIVATE TracedHandles final {
                                   TracedReferenceStoreMode store_mode,
                                   TracedReferenceHandling reference_handling);
 
+  // Creates handles for the `count` values starting at `values` and stores
+  // their locations in the consecutive slots starting at `slots`. Slots for
+  // null values are cleared. Nodes are taken from the same block as long as
+  // it has free nodes so that handles created together end up next to each
+  // other.
+  void CreateBatch(const Address* values, Address** slots, size_t count,
+                   TracedReferenceStoreMode store_mode,
+                   TracedReferenceHandling reference_handling);
+
   using NodeBounds = std::vector<std::pair<const void*, const void*>>;
   const NodeBounds GetNodeBounds() const;
 
@@ -0,0 +1,66 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ADAPTIVE_LAB_SIZE_H_
+#define V8_HEAP_ADAPTIVE_LAB_SIZE_H_
+
+#include <algorithm>
+#include <cstddef>
+
+#include "src/base/logging.h"
+#include "src/base/platform/time.h"
+
+namespace v8::internal {
+
+// Minimum size of the linear allocation areas (LABs) that a background thread
+// requests from the free list. By default a LAB is whatever free list node fits
+// the current allocation, which for small objects often is a small node. A
+// thread that allocates lots of objects then comes back to the free list, and
+// its mutex, very frequently.
+//
+// The size doubles whenever the thread refills its LAB shortly after the last
+// refill, i.e., while it allocates at a high rate, and halves when the thread
+// is mostly idle. It also halves whenever the free list cannot provide a node
+// of the requested size, which caps the size by the fragmentation of the
+// space.
+class AdaptiveLabSize final {
+ public:
+  static constexpr size_t kMinSize = 4 * 1024;
+  static constexpr size_t kMaxSize = 64 * 1024;
+
+  // Refills that are closer together than this grow the size.
+  static constexpr base::TimeDelta kGrowthInterval =
+      base::TimeDelta::FromMilliseconds(1);
+  // Refills that are further apart than this shrink the size.
+  static constexpr base::TimeDelta kShrinkInterval =
+      base::TimeDelta::FromMilliseconds(100);
+
+  size_t size() const { return size_; }
+
+  // Called whenever the LAB is refilled from the free list.
+  void NotifyRefill(base::TimeTicks now) {
+    if (!last_refill_.IsNull()) {
+      const base::TimeDelta since_last_refill = now - last_refill_;
+      if (since_last_refill < kGrowthInterval) {
+        size_ = std::min(size_ * 2, kMaxSize);
+      } else if (since_last_refill > kShrinkInterval) {
+        Shrink();
+      }
+    }
+    last_refill_ = now;
+  }
+
+  // Called when the free list could not provide a node of size().
+  void NotifyFragmented() { Shrink(); }
+
+ private:
+  void Shrink() { size_ = std::max(size_ / 2, kMinSize); }
+
+  size_t size_ = kMinSize;
+  base::TimeTicks last_refill_;
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_HEAP_ADAPTIVE_LAB_SIZE_H_
@@ -14,6 +14,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/js-array-buffer.h"
 
 namespace v8 {
@@ -451,6 +452,9 @@ void ArrayBufferSweeper::SweepingState::SweepingJob::Sweep(
       break;
   }
   if (is_finished) {
+    if (auto pool = heap_->backing_store_pool()) {
+      pool->Trim();
+    }
     state_.SetDone();
   } else {
     TRACE_GC_NOTE("ArrayBufferSweeper Preempted");
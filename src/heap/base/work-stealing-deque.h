@@ -0,0 +1,114 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_BASE_WORK_STEALING_DEQUE_H_
+#define V8_HEAP_BASE_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+
+namespace heap::base {
+
+// A bounded work-stealing deque following Chase and Lev ("Dynamic Circular
+// Work-Stealing Deque", SPAA'05) with the C11 memory orderings from Le et al.
+// ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP'13).
+//
+// - The owner thread pushes and pops entries at the bottom of the deque.
+// - Any other thread may steal entries from the top of the deque.
+//
+// The deque never grows. `Push()` returns false when the deque is full in which
+// case the caller is expected to fall back to some other (shared) worklist.
+// Entries must be trivially copyable as they may be read speculatively by
+// thieves that then lose the race on `top_`.
+template <typename EntryType, size_t Capacity>
+class WorkStealingDeque final {
+  static_assert(v8::base::bits::IsPowerOfTwo(Capacity));
+  static_assert(std::is_trivially_copyable_v<EntryType>);
+
+ public:
+  static constexpr size_t kCapacity = Capacity;
+
+  WorkStealingDeque() = default;
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  // Owner only. Returns false if the deque is full.
+  bool Push(EntryType entry) {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    const int64_t top = top_.load(std::memory_order_acquire);
+    if (bottom - top >= static_cast<int64_t>(Capacity)) return false;
+    SlotFor(bottom).store(entry, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Owner only. Returns false if the deque is empty or if the last entry was
+  // lost to a concurrent thief.
+  bool Pop(EntryType* entry) {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      // Empty.
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    *entry = SlotFor(bottom).load(std::memory_order_relaxed);
+    if (top < bottom) return true;
+    // Last entry in the deque. Race against thieves for it.
+    const bool won = top_.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+
+  // Any thread. Returns false if the deque is empty or if the race for the
+  // top-most entry was lost to the owner or another thief.
+  bool Steal(EntryType* entry) {
+    int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) return false;
+    const EntryType candidate = SlotFor(top).load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    *entry = candidate;
+    return true;
+  }
+
+  // May be called concurrently for an approximation.
+  size_t Size() const {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    const int64_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+  }
+
+  // May be called concurrently for an approximation.
+  bool IsEmpty() const { return Size() == 0; }
+
+ private:
+  std::atomic<EntryType>& SlotFor(int64_t index) {
+    return buffer_[static_cast<size_t>(index) & (Capacity - 1)];
+  }
+
+  // `top_` and `bottom_` are written by different threads in the common case
+  // (thieves vs. owner). Keep them on separate cache lines.
+  alignas(64) std::atomic<int64_t> top_{0};
+  alignas(64) std::atomic<int64_t> bottom_{0};
+  std::atomic<EntryType> buffer_[Capacity];
+};
+
+}  // namespace heap::base
+
+#endif  // V8_HEAP_BASE_WORK_STEALING_DEQUE_H_
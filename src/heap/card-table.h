@@ -0,0 +1,128 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CARD_TABLE_H_
+#define V8_HEAP_CARD_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "src/base/atomic-utils.h"
+#include "src/base/logging.h"
+#include "src/base/platform/memory.h"
+#include "src/heap/base/basic-slot-set.h"
+#include "src/sandbox/check.h"
+
+namespace v8::internal {
+
+using ::heap::base::KEEP_SLOT;
+using ::heap::base::REMOVE_SLOT;
+using ::heap::base::SlotCallbackResult;
+
+// A card table for recording old-to-new slots of a memory chunk.
+//
+// The chunk is divided into cards of kCardSize bytes with one byte per card.
+// The write barrier marks the card containing the slot, which is a single
+// byte store, instead of setting the bit for the slot in a SlotSet. In turn,
+// processing the remembered set needs to visit all slots on a dirty card.
+//
+//   CardTable* card_table --+
+//                           |
+//                           v
+//         +-----------------+-------------------------+
+//         |    num cards    |       cards array       |
+//         +-----------------+-------------------------+
+//                size_t           uint8_t cards
+//
+// The CardTable pointer points to the beginning of the cards array for faster
+// access in the write barrier. The number of cards is maintained for checking
+// bounds for the heap sandbox.
+class CardTable final {
+ public:
+  static constexpr int kCardSizeLog2 = 9;
+  static constexpr size_t kCardSize = size_t{1} << kCardSizeLog2;
+  static constexpr size_t kNumCardsSize = sizeof(size_t);
+
+  static constexpr uint8_t kClean = 0;
+  static constexpr uint8_t kDirty = 1;
+
+  CardTable() = delete;
+
+  static CardTable* Allocate(size_t chunk_size) {
+    const size_t cards = CardsForSize(chunk_size);
+    void* allocation =
+        v8::base::AlignedAlloc(kNumCardsSize + cards, sizeof(size_t));
+    CHECK(allocation);
+    CardTable* card_table = reinterpret_cast<CardTable*>(
+        reinterpret_cast<uint8_t*>(allocation) + kNumCardsSize);
+    *reinterpret_cast<size_t*>(allocation) = cards;
+    memset(card_table->cards(), kClean, cards);
+    return card_table;
+  }
+
+  static void Delete(CardTable* card_table) {
+    if (card_table == nullptr) return;
+    v8::base::AlignedFree(reinterpret_cast<uint8_t*>(card_table) -
+                          kNumCardsSize);
+  }
+
+  static constexpr size_t CardsForSize(size_t size) {
+    return (size + kCardSize - 1) >> kCardSizeLog2;
+  }
+
+  static constexpr size_t CardForOffset(size_t offset) {
+    return offset >> kCardSizeLog2;
+  }
+
+  size_t num_cards() const {
+    return *reinterpret_cast<const size_t*>(
+        reinterpret_cast<const uint8_t*>(this) - kNumCardsSize);
+  }
+
+  // Marks the card containing `slot_offset` as dirty. May be called
+  // concurrently.
+  void Mark(size_t slot_offset) {
+    const size_t card = CardForOffset(slot_offset);
+    SBXCHECK_LT(card, num_cards());
+    base::AsAtomic8::Relaxed_Store(&cards()[card], kDirty);
+  }
+
+  bool IsMarked(size_t slot_offset) const {
+    const size_t card = CardForOffset(slot_offset);
+    DCHECK_LT(card, num_cards());
+    return base::AsAtomic8::Relaxed_Load(&cards()[card]) == kDirty;
+  }
+
+  // Iterates all dirty cards and calls `callback(card_start, card_end)` with
+  // the offsets of the card's bounds. Cards for which the callback returns
+  // REMOVE_SLOT are cleaned. Returns the number of cards that are still dirty
+  // afterwards. Not safe to be called concurrently with Mark().
+  template <typename Callback>
+  size_t Iterate(Callback callback) {
+    const size_t cards_count = num_cards();
+    uint8_t* const cards_array = cards();
+    size_t dirty_cards = 0;
+    for (size_t card = 0; card < cards_count; ++card) {
+      if (cards_array[card] == kClean) continue;
+      const size_t card_start = card << kCardSizeLog2;
+      if (callback(card_start, card_start + kCardSize) == REMOVE_SLOT) {
+        cards_array[card] = kClean;
+      } else {
+        ++dirty_cards;
+      }
+    }
+    return dirty_cards;
+  }
+
+ private:
+  uint8_t* cards() { return reinterpret_cast<uint8_t*>(this); }
+  const uint8_t* cards() const {
+    return reinterpret_cast<const uint8_t*>(this);
+  }
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_HEAP_CARD_TABLE_H_
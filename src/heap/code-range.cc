@@ -12,6 +12,7 @@
 #include "src/base/bits.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/once.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/constants-arch.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -118,9 +119,15 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   // not cross the 4Gb boundary and thus the default compression scheme of
   // truncating the InstructionStream pointers to 32-bits still works. It's
   // achieved by specifying base_alignment parameter.
-  const size_t base_alignment = V8_EXTERNAL_CODE_SPACE_BOOL
-                                    ? base::bits::RoundUpToPowerOfTwo(requested)
-                                    : kPageSize;
+  size_t base_alignment = V8_EXTERNAL_CODE_SPACE_BOOL
+                              ? base::bits::RoundUpToPowerOfTwo(requested)
+                              : kPageSize;
+  // Huge pages can only back 2MB aligned parts of the reservation.
+  const bool use_huge_pages =
+      v8_flags.huge_pages && base::OS::IsHugePageAdviceSupported();
+  if (use_huge_pages) {
+    base_alignment = std::max(base_alignment, base::OS::kHugePageSize);
+  }
 
   DCHECK_IMPLIES(kPlatformRequiresCodeRange,
                  requested <= kMaximalCodeRangeSize);
@@ -160,7 +167,8 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   if (kShouldTryHarder) {
     // Relax alignment requirement while trying to allocate code range inside
     // preferred region.
-    params.base_alignment = kPageSize;
+    params.base_alignment =
+        use_huge_pages ? base::OS::kHugePageSize : kPageSize;
 
     // TODO(v8:11880): consider using base::OS::GetFirstFreeMemoryRangeWithin()
     // to avoid attempts that's going to fail anyway.
@@ -171,9 +179,9 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     // towards the start in steps.
     const int kAllocationTries = 16;
     params.requested_start_hint =
-        RoundDown(preferred_region.end() - requested, kPageSize);
-    Address step =
-        RoundDown(preferred_region.size() / kAllocationTries, kPageSize);
+        RoundDown(preferred_region.end() - requested, params.base_alignment);
+    Address step = RoundDown(preferred_region.size() / kAllocationTries,
+                             params.base_alignment);
     for (int i = 0; i < kAllocationTries; i++) {
       TRACE("=== Attempt #%d, hint=%p\n", i,
             reinterpret_cast<void*>(params.requested_start_hint));
@@ -272,6 +280,22 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   }
 #endif  // !defined(V8_OS_WIN)
 
+  if (use_huge_pages) {
+    // The writable reserved area at the beginning of the range may not share
+    // a huge page with code.
+    const Address start = RoundUp(base() + reserved_area,
+                                  base::OS::kHugePageSize);
+    const Address end = RoundDown(base() + size(), base::OS::kHugePageSize);
+    if (start < end &&
+        base::OS::AdviseHugePages(reinterpret_cast<void*>(start),
+                                  end - start)) {
+      huge_page_size_ = end - start;
+    }
+    TRACE("=== Huge pages: [%p, %p) %s\n", reinterpret_cast<void*>(start),
+          reinterpret_cast<void*>(end),
+          huge_page_size_ > 0 ? "advised" : "not advised");
+  }
+
   return true;
 }
 
@@ -359,6 +383,7 @@ void CodeRange::Free() {
     GetCodeRangeAddressHint()->NotifyFreedCodeRange(
         reservation()->region().begin(), reservation()->region().size());
     VirtualMemoryCage::Free();
+    huge_page_size_ = 0;
   }
 }
 
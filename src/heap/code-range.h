@@ -105,6 +105,10 @@ class CodeRange final : public VirtualMemoryCage {
 
   V8_EXPORT_PRIVATE void Free();
 
+  // Returns the number of bytes of the reservation that the OS was advised to
+  // back with huge pages (--huge-pages).
+  size_t huge_page_size() const { return huge_page_size_; }
+
   // Remap and copy the embedded builtins into this CodeRange. This method is
   // idempotent and only performs the copy once. This property is so that this
   // method can be used uniformly regardless of whether there is a single global
@@ -131,6 +135,8 @@ class CodeRange final : public VirtualMemoryCage {
   // race during Isolate::Init.
   base::SpinningMutex remap_embedded_builtins_mutex_;
 
+  size_t huge_page_size_ = 0;
+
 #if !defined(V8_OS_WIN) && defined(DEBUG)
   bool immutable_ = false;
 #endif
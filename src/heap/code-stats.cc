@@ -4,11 +4,17 @@
 
 #include "src/heap/code-stats.h"
 
+#include <unordered_map>
+
 #include "src/codegen/reloc-info.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/paged-spaces-inl.h"  // For PagedSpaceObjectIterator.
+#include "src/objects/code-inl.h"
+#include "src/objects/deoptimization-data-inl.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -48,6 +54,72 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(Tagged<HeapObject> object,
   }
 }
 
+std::vector<ScriptCodeSizes> CodeStatistics::CollectScriptCodeStatistics(
+    Isolate* isolate) {
+  std::vector<ScriptCodeSizes> result;
+  std::unordered_map<int, size_t> script_indices;
+  auto entry_for = [&](Tagged<SharedFunctionInfo> sfi) -> ScriptCodeSizes* {
+    Tagged<Object> script = sfi->script();
+    if (!IsScript(script)) return nullptr;
+    int script_id = Cast<Script>(script)->id();
+    auto [it, inserted] = script_indices.emplace(script_id, result.size());
+    if (inserted) result.push_back({script_id});
+    return &result[it->second];
+  };
+
+  HeapObjectIterator iterator(isolate->heap());
+  for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (IsSharedFunctionInfo(obj)) {
+      Tagged<SharedFunctionInfo> sfi = Cast<SharedFunctionInfo>(obj);
+      ScriptCodeSizes* entry = entry_for(sfi);
+      if (entry == nullptr) continue;
+      if (sfi->HasBytecodeArray()) {
+        Tagged<BytecodeArray> bytecode = sfi->GetBytecodeArray(isolate);
+        // Split off the source position table the same way
+        // SizeIncludingMetadata() accounts for it.
+        int source_positions = 0;
+        Tagged<Object> table =
+            bytecode->raw_source_position_table(kAcquireLoad);
+        if (IsByteArray(table)) {
+          source_positions = Cast<ByteArray>(table)->AllocatedSize();
+        }
+        entry->bytecode_size +=
+            bytecode->SizeIncludingMetadata() - source_positions;
+        entry->source_position_table_size += source_positions;
+      }
+      if (sfi->HasBaselineCode()) {
+        entry->baseline_code_size +=
+            sfi->baseline_code(kAcquireLoad)->SizeIncludingMetadata();
+      }
+      if (sfi->HasFeedbackMetadata()) {
+        entry->feedback_metadata_size += sfi->feedback_metadata()->Size();
+      }
+    } else if (IsFeedbackVector(obj)) {
+      Tagged<FeedbackVector> vector = Cast<FeedbackVector>(obj);
+      ScriptCodeSizes* entry = entry_for(vector->shared_function_info());
+      if (entry == nullptr) continue;
+      entry->feedback_vector_size += vector->Size();
+    } else if (IsCode(obj)) {
+      Tagged<Code> code = Cast<Code>(obj);
+      if (!CodeKindIsOptimizedJSFunction(code->kind())) continue;
+      Tagged<DeoptimizationData> data =
+          Cast<DeoptimizationData>(code->deoptimization_data());
+      if (data->length() == 0) continue;
+      ScriptCodeSizes* entry = entry_for(data->GetSharedFunctionInfo());
+      if (entry == nullptr) continue;
+      size_t code_size = code->SizeIncludingMetadata() - data->Size();
+      if (code->kind() == CodeKind::MAGLEV) {
+        entry->maglev_code_size += code_size;
+      } else {
+        entry->turbofan_code_size += code_size;
+      }
+      entry->deoptimization_data_size += data->Size();
+    }
+  }
+  return result;
+}
+
 void CodeStatistics::ResetCodeAndMetadataStatistics(Isolate* isolate) {
   isolate->set_code_and_metadata_size(0);
   isolate->set_bytecode_and_metadata_size(0);
@@ -5,6 +5,9 @@
 #ifndef V8_HEAP_CODE_STATS_H_
 #define V8_HEAP_CODE_STATS_H_
 
+#include <cstddef>
+#include <vector>
+
 namespace v8 {
 namespace internal {
 
@@ -17,6 +20,19 @@ class PagedSpace;
 template <typename T>
 class Tagged;
 
+// Sizes of code and metadata that belong to functions of a single script.
+struct ScriptCodeSizes {
+  int script_id = 0;
+  size_t bytecode_size = 0;
+  size_t source_position_table_size = 0;
+  size_t baseline_code_size = 0;
+  size_t maglev_code_size = 0;
+  size_t turbofan_code_size = 0;
+  size_t deoptimization_data_size = 0;
+  size_t feedback_metadata_size = 0;
+  size_t feedback_vector_size = 0;
+};
+
 class CodeStatistics {
  public:
   // Collect statistics related to code size.
@@ -26,6 +42,11 @@ class CodeStatistics {
   static void CollectCodeStatistics(OldLargeObjectSpace* space,
                                     Isolate* isolate);
 
+  // Attribute bytecode, baseline and optimized code, deoptimization data and
+  // feedback in the whole heap to the scripts they were compiled from.
+  static std::vector<ScriptCodeSizes> CollectScriptCodeStatistics(
+      Isolate* isolate);
+
   // Reset code size related statistics
   static void ResetCodeAndMetadataStatistics(Isolate* isolate);
 
@@ -15,6 +15,7 @@
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/heap/base/cached-unordered-map.h"
+#include "src/heap/ephemeron-index.h"
 #include "src/heap/ephemeron-remembered-set.h"
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
@@ -180,6 +181,19 @@ class ConcurrentMarkingVisitor final
     return false;
   }
 
+  // Marks the values that are kept alive by `key` according to the ephemeron
+  // index.
+  void ProcessEphemeronIndex(const EphemeronIndex& ephemeron_index,
+                             Tagged<HeapObject> key) {
+    ephemeron_index.ForEachValue(key, [this, key](Tagged<HeapObject> value) {
+      const auto target_worklist =
+          MarkingHelper::ShouldMarkObject(heap_, value);
+      if (target_worklist) {
+        MarkObject(key, value, target_worklist.value());
+      }
+    });
+  }
+
   template <typename TSlot>
   void RecordSlot(Tagged<HeapObject> object, TSlot slot,
                   Tagged<HeapObject> target) {
@@ -377,6 +391,10 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
                                 task_id);
   }
   bool another_ephemeron_iteration = false;
+  // The ephemeron index is only set up while the job is not running and stays
+  // immutable while tasks are running.
+  const EphemeronIndex* const ephemeron_index =
+      heap_->mark_compact_collector()->ephemeron_index();
   MainAllocator* const new_space_allocator =
       heap_->use_new_space() ? heap_->allocator()->new_space_allocator()
                              : nullptr;
@@ -440,6 +458,9 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
             }
           }
           const auto visited_size = visitor.Visit(map, object);
+          if (ephemeron_index) {
+            visitor.ProcessEphemeronIndex(*ephemeron_index, object);
+          }
           visitor.IncrementLiveBytesCached(
               MutablePageMetadata::cast(
                   MemoryChunkMetadata::FromHeapObject(object)),
@@ -629,6 +650,9 @@ size_t ConcurrentMarking::GetMajorMaxConcurrency(size_t worker_count) {
   for (auto& worklist : marking_worklists_->context_worklists()) {
     marking_items += worklist.worklist->Size();
   }
+  if (v8_flags.marking_work_stealing) {
+    marking_items += marking_worklists_->StealableSize();
+  }
   const size_t work = std::max<size_t>(
       {marking_items, weak_objects_->discovered_ephemerons.Size(),
        weak_objects_->current_ephemerons.Size()});
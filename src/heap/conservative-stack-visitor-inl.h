@@ -7,6 +7,8 @@
 
 #include "src/heap/conservative-stack-visitor.h"
 
+#include <algorithm>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/heap-layout.h"
@@ -100,6 +102,13 @@ Address ConservativeStackVisitorBase<ConcreteVisitor>::FindBasePtr(
   // Try to find the address of a previous valid object on this page.
   Address base_ptr =
       MarkingBitmap::FindPreviousValidObject(page, maybe_inner_ptr);
+  MarkingBitmap* object_starts = nullptr;
+  if constexpr (ConcreteVisitor::kUseObjectStartBitmaps) {
+    // Objects that were iterated over before may be closer.
+    object_starts = ObjectStartBitmap(page);
+    base_ptr = std::max(base_ptr, MarkingBitmap::FindPreviousObjectStart(
+                                      object_starts, page, maybe_inner_ptr));
+  }
   // Iterate through the objects in the page forwards, until we find the object
   // containing maybe_inner_ptr.
   DCHECK_LE(base_ptr, maybe_inner_ptr);
@@ -110,6 +119,10 @@ Address ConservativeStackVisitorBase<ConcreteVisitor>::FindBasePtr(
     if (!ConcreteVisitor::FilterNormalObject(obj, map_word, bitmap)) {
       return kNullAddress;
     }
+    if constexpr (ConcreteVisitor::kUseObjectStartBitmaps) {
+      MarkingBitmap::MarkBitFromAddress(object_starts, base_ptr)
+          .Set<AccessMode::NON_ATOMIC>();
+    }
     const int size = obj->SizeFromMap(map_word.ToMap());
     DCHECK_LT(0, size);
     if (maybe_inner_ptr < base_ptr + size) {
@@ -121,6 +134,14 @@ Address ConservativeStackVisitorBase<ConcreteVisitor>::FindBasePtr(
   }
 }
 
+template <typename ConcreteVisitor>
+MarkingBitmap* ConservativeStackVisitorBase<ConcreteVisitor>::ObjectStartBitmap(
+    const PageMetadata* page) const {
+  std::unique_ptr<MarkingBitmap>& bitmap = object_start_bitmaps_[page];
+  if (!bitmap) bitmap = std::make_unique<MarkingBitmap>();
+  return bitmap.get();
+}
+
 template <typename ConcreteVisitor>
 void ConservativeStackVisitorBase<ConcreteVisitor>::VisitPointer(
     const void* pointer) {
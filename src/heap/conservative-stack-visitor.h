@@ -5,6 +5,9 @@
 #ifndef V8_HEAP_CONSERVATIVE_STACK_VISITOR_H_
 #define V8_HEAP_CONSERVATIVE_STACK_VISITOR_H_
 
+#include <memory>
+#include <unordered_map>
+
 #include "include/v8-internal.h"
 #include "src/base/address-region.h"
 #include "src/common/globals.h"
@@ -32,6 +35,10 @@ class RootVisitor;
 //    FindBasePtr finds a new object.
 // 5) OnlyScanMainV8Heap() - returns true if the visitor does not handle the
 // external code and trusted spaces.
+// 6) kUseObjectStartBitmaps - true if the visitor should record the objects
+// it finds on normal pages in object start bitmaps, so that each object on a
+// page is iterated over at most once. Visitors that use the marking bitmap for
+// this don't need them.
 template <typename ConcreteVisitor>
 class V8_EXPORT_PRIVATE ConservativeStackVisitorBase
     : public ::heap::base::StackVisitor {
@@ -55,6 +62,9 @@ class V8_EXPORT_PRIVATE ConservativeStackVisitorBase
   void VisitConservativelyIfPointer(Address address,
                                     PtrComprCageBase cage_base);
 
+  // Returns the object start bitmap of the page, allocating it on first use.
+  MarkingBitmap* ObjectStartBitmap(const PageMetadata* page) const;
+
 #ifdef V8_COMPRESS_POINTERS
   bool IsInterestingCage(PtrComprCageBase cage_base) const;
 #endif
@@ -74,6 +84,12 @@ class V8_EXPORT_PRIVATE ConservativeStackVisitorBase
 
   RootVisitor* const root_visitor_;
   MemoryAllocator* const allocator_;
+
+  // The starts of the objects iterated over while searching for inner
+  // pointers, per normal page.
+  mutable std::unordered_map<const PageMetadata*,
+                             std::unique_ptr<MarkingBitmap>>
+      object_start_bitmaps_;
 };
 
 class V8_EXPORT_PRIVATE ConservativeStackVisitor
@@ -84,6 +100,7 @@ class V8_EXPORT_PRIVATE ConservativeStackVisitor
 
  private:
   static constexpr bool kOnlyVisitMainV8Cage = false;
+  static constexpr bool kUseObjectStartBitmaps = true;
 
   static bool FilterPage(const MemoryChunk* chunk) {
     return v8_flags.sticky_mark_bits || !chunk->IsFromPage();
@@ -102,9 +102,9 @@ class MinorGCHeapGrowing
 // static
 std::unique_ptr<CppHeap> CppHeap::Create(v8::Platform* platform,
                                          const CppHeapCreateParams& params) {
-  return std::make_unique<internal::CppHeap>(platform, params.custom_spaces,
-                                             params.marking_support,
-                                             params.sweeping_support);
+  return std::make_unique<internal::CppHeap>(
+      platform, params.custom_spaces, params.marking_support,
+      params.sweeping_support, params.compact_default_spaces);
 }
 
 cppgc::AllocationHandle& CppHeap::GetAllocationHandle() {
@@ -271,6 +271,41 @@ class UnifiedHeapConservativeMarkingVisitor final
   std::unique_ptr<ConservativeTracedHandlesMarkingVisitor> marking_visitor_;
 };
 
+// Embedders cast the visitor passed to `Trace()` methods to `JSVisitor`, so the
+// compactor must use a `JSVisitor` for finding `Member` slots. References to
+// V8 objects are not relevant for compaction and are ignored.
+class UnifiedHeapCompactionSlotVisitor final : public JSVisitor {
+ public:
+  explicit UnifiedHeapCompactionSlotVisitor(
+      cppgc::internal::CompactionSlotRecorder& recorder)
+      : JSVisitor(cppgc::internal::VisitorFactory::CreateKey()),
+        recorder_(recorder) {
+    handles_member_slots_ = true;
+  }
+
+ protected:
+  void HandleMemberSlot(
+      const void* slot,
+      cppgc::internal::WriteBarrierSlotType slot_type) final {
+    recorder_.Record(slot, slot_type);
+  }
+  void VisitMultipleUncompressedMember(const void* start, size_t len,
+                                       TraceDescriptorCallback) final {
+    recorder_.RecordMultiple(
+        start, len, cppgc::internal::WriteBarrierSlotType::kUncompressed);
+  }
+#if defined(CPPGC_POINTER_COMPRESSION)
+  void VisitMultipleCompressedMember(const void* start, size_t len,
+                                     TraceDescriptorCallback) final {
+    recorder_.RecordMultiple(
+        start, len, cppgc::internal::WriteBarrierSlotType::kCompressed);
+  }
+#endif  // defined(CPPGC_POINTER_COMPRESSION)
+
+ private:
+  cppgc::internal::CompactionSlotRecorder& recorder_;
+};
+
 }  // namespace
 
 class UnifiedHeapMarker final : public cppgc::internal::MarkerBase {
@@ -460,12 +495,12 @@ CppHeap::CppHeap(
     v8::Platform* platform,
     const std::vector<std::unique_ptr<cppgc::CustomSpaceBase>>& custom_spaces,
     cppgc::Heap::MarkingType marking_support,
-    cppgc::Heap::SweepingType sweeping_support)
+    cppgc::Heap::SweepingType sweeping_support, bool compact_default_spaces)
     : cppgc::internal::HeapBase(
           std::make_shared<CppgcPlatformAdapter>(platform), custom_spaces,
           cppgc::internal::HeapBase::StackSupport::
               kSupportsConservativeStackScan,
-          marking_support, sweeping_support, *this),
+          marking_support, sweeping_support, compact_default_spaces, *this),
       minor_gc_heap_growing_(
           std::make_unique<MinorGCHeapGrowing>(*stats_collector())),
       cross_heap_remembered_set_(*this) {
@@ -1211,7 +1246,8 @@ std::unique_ptr<CppMarkingState> CppHeap::CreateCppMarkingState() {
   DCHECK(IsMarking());
   return std::make_unique<CppMarkingState>(
       std::make_unique<cppgc::internal::MarkingStateBase>(
-          AsBase(), marker()->To<UnifiedHeapMarker>().GetMarkingWorklists()));
+          AsBase(), marker()->To<UnifiedHeapMarker>().GetMarkingWorklists()),
+      compactor_.compaction_worklists() != nullptr);
 }
 
 std::unique_ptr<CppMarkingState>
@@ -1219,7 +1255,8 @@ CppHeap::CreateCppMarkingStateForMutatorThread() {
   if (!TracingInitialized()) return {};
   DCHECK(IsMarking());
   return std::make_unique<CppMarkingState>(
-      marker()->To<UnifiedHeapMarker>().GetMutatorMarkingState());
+      marker()->To<UnifiedHeapMarker>().GetMutatorMarkingState(),
+      compactor_.compaction_worklists() != nullptr);
 }
 
 CppHeap::PauseConcurrentMarkingScope::PauseConcurrentMarkingScope(
@@ -1330,5 +1367,10 @@ bool CppHeap::CurrentThreadIsHeapThread() const {
   return HeapBase::CurrentThreadIsHeapThread();
 }
 
+std::unique_ptr<cppgc::Visitor> CppHeap::CreateCompactionSlotVisitor(
+    cppgc::internal::CompactionSlotRecorder& recorder) {
+  return std::make_unique<UnifiedHeapCompactionSlotVisitor>(recorder);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -117,7 +117,8 @@ class V8_EXPORT_PRIVATE CppHeap final
 
   CppHeap(v8::Platform*,
           const std::vector<std::unique_ptr<cppgc::CustomSpaceBase>>&,
-          cppgc::Heap::MarkingType, cppgc::Heap::SweepingType);
+          cppgc::Heap::MarkingType, cppgc::Heap::SweepingType,
+          bool compact_default_spaces = false);
   ~CppHeap() final;
 
   CppHeap(const CppHeap&) = delete;
@@ -208,6 +209,9 @@ class V8_EXPORT_PRIVATE CppHeap final
 
   bool CurrentThreadIsHeapThread() const final;
 
+  std::unique_ptr<cppgc::Visitor> CreateCompactionSlotVisitor(
+      cppgc::internal::CompactionSlotRecorder&) final;
+
  private:
   void UpdateGCCapabilitiesFromFlags();
 
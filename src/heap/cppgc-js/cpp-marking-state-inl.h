@@ -6,11 +6,15 @@
 #define V8_HEAP_CPPGC_JS_CPP_MARKING_STATE_INL_H_
 
 #include "src/heap/cppgc-js/cpp-marking-state.h"
+#include "src/heap/cppgc/heap-page.h"
 
 namespace v8 {
 namespace internal {
 
 void CppMarkingState::MarkAndPush(void* instance) {
+  if (V8_UNLIKELY(is_compacting_)) {
+    cppgc::internal::BasePage::FromPayload(instance)->Pin();
+  }
   marking_state_.MarkAndPush(
       cppgc::internal::HeapObjectHeader::FromObject(instance));
 }
@@ -20,15 +20,18 @@ class EmbedderDataSlot;
 
 class CppMarkingState final {
  public:
-  explicit CppMarkingState(
-      cppgc::internal::MarkingStateBase& main_thread_marking_state)
+  CppMarkingState(cppgc::internal::MarkingStateBase& main_thread_marking_state,
+                  bool is_compacting)
       : owned_marking_state_(nullptr),
-        marking_state_(main_thread_marking_state) {}
+        marking_state_(main_thread_marking_state),
+        is_compacting_(is_compacting) {}
 
-  explicit CppMarkingState(std::unique_ptr<cppgc::internal::MarkingStateBase>
-                               concurrent_marking_state)
+  CppMarkingState(std::unique_ptr<cppgc::internal::MarkingStateBase>
+                      concurrent_marking_state,
+                  bool is_compacting)
       : owned_marking_state_(std::move(concurrent_marking_state)),
-        marking_state_(*owned_marking_state_) {}
+        marking_state_(*owned_marking_state_),
+        is_compacting_(is_compacting) {}
   CppMarkingState(const CppMarkingState&) = delete;
   CppMarkingState& operator=(const CppMarkingState&) = delete;
 
@@ -43,6 +46,9 @@ class CppMarkingState final {
  private:
   std::unique_ptr<cppgc::internal::MarkingStateBase> owned_marking_state_;
   cppgc::internal::MarkingStateBase& marking_state_;
+  // Objects that are referenced from JavaScript wrappers are pinned when the
+  // compactor is enabled for the current garbage collection.
+  const bool is_compacting_;
 };
 
 }  // namespace internal
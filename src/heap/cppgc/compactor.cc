@@ -4,19 +4,24 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "include/cppgc/internal/persistent-node.h"
 #include "include/cppgc/macros.h"
+#include "include/cppgc/member.h"
 #include "src/heap/cppgc/compaction-worklists.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap-base.h"
 #include "src/heap/cppgc/heap-page.h"
 #include "src/heap/cppgc/heap-space.h"
+#include "src/heap/cppgc/heap-visitor.h"
 #include "src/heap/cppgc/memory.h"
 #include "src/heap/cppgc/object-poisoner.h"
+#include "src/heap/cppgc/prefinalizer-handler.h"
 #include "src/heap/cppgc/raw-heap.h"
 #include "src/heap/cppgc/stats-collector.h"
 
@@ -28,6 +33,37 @@ namespace {
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
 
+// Pages on default spaces are only compacted if at most this percentage of
+// their payload is live.
+static constexpr size_t kMaxLivePercentOfCompactedDefaultPages = 50;
+
+bool IsDefaultSpace(const NormalPageSpace& space) {
+  return space.index() < RawHeap::kNumberOfRegularSpaces;
+}
+
+const void* LoadSlot(const void* slot, WriteBarrierSlotType slot_type) {
+#if defined(CPPGC_POINTER_COMPRESSION)
+  if (slot_type == WriteBarrierSlotType::kCompressed) {
+    const auto* storage = static_cast<const CompressedPointer*>(slot);
+    return storage->IsSentinel() ? nullptr : storage->Load();
+  }
+#endif  // defined(CPPGC_POINTER_COMPRESSION)
+  DCHECK_EQ(WriteBarrierSlotType::kUncompressed, slot_type);
+  const auto* storage = static_cast<const RawPointer*>(slot);
+  return storage->IsSentinel() ? nullptr : storage->Load();
+}
+
+void StoreSlot(void* slot, WriteBarrierSlotType slot_type, const void* value) {
+#if defined(CPPGC_POINTER_COMPRESSION)
+  if (slot_type == WriteBarrierSlotType::kCompressed) {
+    static_cast<CompressedPointer*>(slot)->Store(value);
+    return;
+  }
+#endif  // defined(CPPGC_POINTER_COMPRESSION)
+  DCHECK_EQ(WriteBarrierSlotType::kUncompressed, slot_type);
+  static_cast<RawPointer*>(slot)->Store(value);
+}
+
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
 // relocate() will adjust the slots to point to the new location of the
@@ -39,8 +75,10 @@ class MovableReferences final {
   using MovableReference = CompactionWorklists::MovableReference;
 
  public:
-  explicit MovableReferences(HeapBase& heap)
-      : heap_(heap), heap_has_move_listeners_(heap.HasMoveListeners()) {}
+  MovableReferences(HeapBase& heap, CompactionSlotRecorder& slot_recorder)
+      : heap_(heap),
+        slot_recorder_(slot_recorder),
+        heap_has_move_listeners_(heap.HasMoveListeners()) {}
 
   // Adds a slot for compaction. Filters slots in dead objects.
   void AddOrFilter(MovableReference*);
@@ -57,6 +95,7 @@ class MovableReferences final {
 
  private:
   HeapBase& heap_;
+  CompactionSlotRecorder& slot_recorder_;
 
   // Map from movable reference (value) to its slot. Upon moving an object its
   // slot pointing to it requires updating. Movable reference should currently
@@ -106,7 +145,8 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   // The following cases are not compacted and do not require recording:
   // - Compactable object on large pages.
   // - Compactable object on non-compactable spaces.
-  if (value_page->is_large() || !value_page->space().is_compactable()) return;
+  // - Compactable object on pinned pages.
+  if (!value_page->is_compaction_candidate()) return;
 
   // Slots must reside in and values must point to live objects at this
   // point. |value| usually points to a separate object but can also point
@@ -127,7 +167,7 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   movable_references_.emplace(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
-  if (V8_LIKELY(!slot_page->space().is_compactable())) return;
+  if (V8_LIKELY(!slot_page->is_compaction_candidate())) return;
 
   CHECK_EQ(interior_movable_references_.end(),
            interior_movable_references_.find(slot));
@@ -143,6 +183,8 @@ void MovableReferences::Relocate(Address from, Address to,
   moved_objects_.insert(from);
 #endif  // DEBUG
 
+  slot_recorder_.RecordMove(from, to);
+
   if (V8_UNLIKELY(heap_has_move_listeners_)) {
     heap_.CallMoveListeners(from - sizeof(HeapObjectHeader),
                             to - sizeof(HeapObjectHeader),
@@ -387,17 +429,20 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state,
   compaction_state.FinishCompactingPage(page);
 }
 
-void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
+void CompactSpace(NormalPageSpace* space,
+                  const NormalPageSpace::Pages& candidates,
+                  MovableReferences& movable_references,
                   StickyBits sticky_bits) {
   using Pages = NormalPageSpace::Pages;
 
-#ifdef V8_USE_ADDRESS_SANITIZER
-  UnmarkedObjectsPoisoner().Traverse(*space);
-#endif  // V8_USE_ADDRESS_SANITIZER
-
   DCHECK(space->is_compactable());
+  DCHECK(!candidates.empty());
 
-  space->free_list().Clear();
+#ifdef V8_USE_ADDRESS_SANITIZER
+  for (BasePage* page : candidates) {
+    UnmarkedObjectsPoisoner().Traverse(*page);
+  }
+#endif  // V8_USE_ADDRESS_SANITIZER
 
   // Compaction generally follows Jonker's algorithm for fast garbage
   // compaction. Compaction is performed in-place, sliding objects down over
@@ -425,11 +470,15 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
   // To ease the passing of the compaction state when iterating over an
   // arena's pages, package it up into a |CompactionState|.
 
+  // Pages that are not compacted remain on the space and are processed by the
+  // sweeper.
   Pages pages = space->RemoveAllPages();
-  if (pages.empty()) return;
+  for (BasePage* page : pages) {
+    if (!page->is_compaction_candidate()) space->AddPage(page);
+  }
 
   CompactionState compaction_state(space, movable_references);
-  for (BasePage* page : pages) {
+  for (BasePage* page : candidates) {
     page->ResetMarkedBytes();
     // Large objects do not belong to this arena.
     CompactPage(NormalPage::From(page), compaction_state, sticky_bits);
@@ -439,6 +488,40 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
   // Sweeping will verify object start bitmap of compacted space.
 }
 
+// Selects the pages of `space` that are compacted. Compactable custom spaces
+// are compacted in full. On default spaces, only pages that are mostly empty
+// are compacted as finding references to their objects requires tracing the
+// whole heap. Pinned pages are never compacted.
+NormalPageSpace::Pages SelectCompactionCandidates(NormalPageSpace& space) {
+  DCHECK(space.is_compactable());
+  const bool is_default_space = IsDefaultSpace(space);
+  NormalPageSpace::Pages candidates;
+  for (BasePage* page : space) {
+    if (page->is_pinned()) continue;
+    if (is_default_space &&
+        page->marked_bytes() * 100 >
+            NormalPage::From(page)->PayloadSize() *
+                kMaxLivePercentOfCompactedDefaultPages) {
+      continue;
+    }
+    candidates.push_back(page);
+  }
+  if (is_default_space) {
+    // Sliding the objects of a single page does not free any memory.
+    if (candidates.size() < 2) return {};
+    // Objects are slid towards the first pages. Start with the densest pages
+    // so that the sparsest pages are released.
+    std::sort(candidates.begin(), candidates.end(),
+              [](const BasePage* a, const BasePage* b) {
+                return a->marked_bytes() > b->marked_bytes();
+              });
+  }
+  for (BasePage* page : candidates) {
+    page->set_compaction_candidate(true);
+  }
+  return candidates;
+}
+
 size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
   return std::accumulate(spaces.cbegin(), spaces.cend(), 0u,
                          [](size_t acc, const NormalPageSpace* space) {
@@ -448,8 +531,120 @@ size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
                          });
 }
 
+void PinPage(const void* object) {
+  BasePage* page = BasePage::FromPayload(const_cast<void*>(object));
+  // Pins are only cleared on compactable spaces.
+  if (page->space().is_compactable()) page->Pin();
+}
+
+class RootPinningVisitor final : public RootVisitorBase {
+ protected:
+  void VisitRoot(const void*, TraceDescriptor desc,
+                 const SourceLocation&) final {
+    PinPage(desc.base_object_payload);
+  }
+  void VisitWeakRoot(const void*, TraceDescriptor desc, WeakCallback,
+                     const void*, const SourceLocation&) final {
+    PinPage(desc.base_object_payload);
+  }
+};
+
+// Traces all live objects to find `Member` slots that point to objects on
+// compacted pages.
+class LiveObjectTracer final : public HeapVisitor<LiveObjectTracer> {
+  friend class HeapVisitor<LiveObjectTracer>;
+
+ public:
+  explicit LiveObjectTracer(Visitor& visitor) : visitor_(visitor) {}
+
+ private:
+  bool VisitHeapObjectHeader(HeapObjectHeader& header) {
+    if (header.IsFree() || !header.IsMarked()) return true;
+    // Compaction only runs without heap pointers on the stack, in which case
+    // all objects are fully constructed.
+    DCHECK(!header.IsInConstruction());
+    header.Trace(&visitor_);
+    return true;
+  }
+
+  Visitor& visitor_;
+};
+
 }  // namespace
 
+void CompactionSlotRecorder::AddCandidatePage(const BasePage* page) {
+  DCHECK(!page->is_large());
+  candidate_pages_.insert(page);
+}
+
+bool CompactionSlotRecorder::IsOnCandidatePage(const void* address) const {
+  // Only normal pages are compacted, for which the page can be computed from
+  // any inner address. The page computed for other addresses is never a
+  // candidate.
+  return candidate_pages_.count(BasePage::FromPayload(address));
+}
+
+void CompactionSlotRecorder::Record(const void* slot,
+                                    WriteBarrierSlotType slot_type) {
+  const void* value = LoadSlot(slot, slot_type);
+  if (!value || !IsOnCandidatePage(value)) return;
+
+  ConstAddress holder = nullptr;
+  if (IsOnCandidatePage(slot)) {
+    const HeapObjectHeader& holder_header =
+        BasePage::FromPayload(slot)->ObjectHeaderFromInnerAddress(slot);
+    // Slots in dead objects are not updated as the objects are finalized.
+    if (!holder_header.IsMarked()) return;
+    holder = holder_header.ObjectStart();
+  }
+
+  const HeapObjectHeader& target_header =
+      BasePage::FromPayload(value)->ObjectHeaderFromInnerAddress(value);
+  // Weak references to dead objects have been cleared at this point.
+  DCHECK(target_header.IsMarked());
+  slots_.push_back({static_cast<Address>(const_cast<void*>(slot)), holder,
+                    static_cast<ConstAddress>(value),
+                    target_header.ObjectStart(), slot_type});
+}
+
+void CompactionSlotRecorder::RecordMultiple(const void* start, size_t len,
+                                            WriteBarrierSlotType slot_type) {
+#if defined(CPPGC_POINTER_COMPRESSION)
+  const size_t slot_size = slot_type == WriteBarrierSlotType::kCompressed
+                               ? kSizeofCompressedMember
+                               : kSizeOfUncompressedMember;
+#else   // !defined(CPPGC_POINTER_COMPRESSION)
+  const size_t slot_size = kSizeOfUncompressedMember;
+#endif  // !defined(CPPGC_POINTER_COMPRESSION)
+  const char* slot = static_cast<const char*>(start);
+  for (size_t i = 0; i < len; ++i, slot += slot_size) {
+    Record(slot, slot_type);
+  }
+}
+
+void CompactionSlotRecorder::RecordMove(ConstAddress from, Address to) {
+  if (slots_.empty()) return;
+  forwarding_table_.emplace(from, to);
+}
+
+Address CompactionSlotRecorder::Forward(ConstAddress payload) const {
+  auto it = forwarding_table_.find(payload);
+  return it != forwarding_table_.end() ? it->second
+                                       : const_cast<Address>(payload);
+}
+
+void CompactionSlotRecorder::UpdateSlots() {
+  for (const Slot& slot : slots_) {
+    Address slot_address =
+        slot.holder ? Forward(slot.holder) + (slot.slot - slot.holder)
+                    : slot.slot;
+    const Address value = Forward(slot.target) + (slot.value - slot.target);
+    StoreSlot(slot_address, slot.slot_type, value);
+  }
+  slots_.clear();
+  forwarding_table_.clear();
+}
+
 Compactor::Compactor(RawHeap& heap) : heap_(heap) {
   for (auto& space : heap_) {
     if (!space->is_compactable()) continue;
@@ -498,17 +693,73 @@ void Compactor::CancelIfShouldNotCompact(GCConfig::MarkingType marking_type,
   is_enabled_ = false;
 }
 
+void Compactor::PinPagesReferencedFromRoots() {
+  HeapBase& heap = *heap_.heap();
+  RootPinningVisitor root_visitor;
+  heap.GetStrongPersistentRegion().Iterate(root_visitor);
+  heap.GetWeakPersistentRegion().Iterate(root_visitor);
+  {
+    PersistentRegionLock guard;
+    heap.GetStrongCrossThreadPersistentRegion().Iterate(root_visitor);
+    heap.GetWeakCrossThreadPersistentRegion().Iterate(root_visitor);
+  }
+  // Pre-finalizers are registered with the address of their object.
+  heap.prefinalizer_handler()->IterateObjects(PinPage);
+}
+
+void Compactor::UnpinPages() {
+  for (NormalPageSpace* space : compactable_spaces_) {
+    for (BasePage* page : *space) {
+      page->Unpin();
+    }
+  }
+}
+
 Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   if (is_cancelled_ && compaction_worklists_) {
     compaction_worklists_->movable_slots_worklist()->Clear();
     compaction_worklists_.reset();
+    // Pages may have been pinned while marking.
+    UnpinPages();
   }
   if (!is_enabled_) return CompactableSpaceHandling::kSweep;
 
   StatsCollector::EnabledScope stats_scope(heap_.heap()->stats_collector(),
                                            StatsCollector::kAtomicCompact);
 
-  MovableReferences movable_references(*heap_.heap());
+#if defined(CPPGC_YOUNG_GENERATION)
+  // The remembered set is reset before compaction, so there are no
+  // old-to-new slots that would need to be updated.
+  DCHECK(heap_.heap()->remembered_set().IsEmpty());
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
+  PinPagesReferencedFromRoots();
+
+  CompactionSlotRecorder slot_recorder;
+  std::vector<std::pair<NormalPageSpace*, NormalPageSpace::Pages>> candidates;
+  bool has_default_space_candidates = false;
+  for (NormalPageSpace* space : compactable_spaces_) {
+    // Free lists are rebuilt by compaction and sweeping.
+    space->free_list().Clear();
+    NormalPageSpace::Pages pages = SelectCompactionCandidates(*space);
+    if (pages.empty()) continue;
+    for (const BasePage* page : pages) {
+      slot_recorder.AddCandidatePage(page);
+    }
+    has_default_space_candidates |= IsDefaultSpace(*space);
+    candidates.emplace_back(space, std::move(pages));
+  }
+  UnpinPages();
+
+  if (has_default_space_candidates) {
+    // References to objects on default spaces are not registered while
+    // marking. Instead, they are found by tracing all live objects.
+    std::unique_ptr<Visitor> slot_visitor =
+        heap_.heap()->CreateCompactionSlotVisitor(slot_recorder);
+    LiveObjectTracer(*slot_visitor).Traverse(heap_);
+  }
+
+  MovableReferences movable_references(*heap_.heap(), slot_recorder);
 
   CompactionWorklists::MovableReferencesWorklist::Local local(
       *compaction_worklists_->movable_slots_worklist());
@@ -520,9 +771,10 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
 
   const StickyBits sticky_bits = heap_.heap()->sticky_bits();
 
-  for (NormalPageSpace* space : compactable_spaces_) {
-    CompactSpace(space, movable_references, sticky_bits);
+  for (auto& [space, pages] : candidates) {
+    CompactSpace(space, pages, movable_references, sticky_bits);
   }
+  slot_recorder.UpdateSlots();
 
   enable_for_next_gc_for_testing_ = false;
   is_enabled_ = false;
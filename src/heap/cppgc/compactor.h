@@ -5,15 +5,95 @@
 #ifndef V8_HEAP_CPPGC_COMPACTOR_H_
 #define V8_HEAP_CPPGC_COMPACTOR_H_
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "include/cppgc/internal/member-storage.h"
 #include "src/heap/cppgc/compaction-worklists.h"
 #include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/raw-heap.h"
+#include "src/heap/cppgc/visitor.h"
 
 namespace cppgc {
 namespace internal {
 
+class BasePage;
 class NormalPageSpace;
 
+// Records slots of `Member` references that point to objects on pages that are
+// compacted. Slots are recorded before any object is moved and updated once
+// compaction has moved all objects.
+class V8_EXPORT_PRIVATE CompactionSlotRecorder final {
+ public:
+  CompactionSlotRecorder() = default;
+
+  CompactionSlotRecorder(const CompactionSlotRecorder&) = delete;
+  CompactionSlotRecorder& operator=(const CompactionSlotRecorder&) = delete;
+
+  void AddCandidatePage(const BasePage*);
+  bool HasCandidatePages() const { return !candidate_pages_.empty(); }
+
+  // Records `slot` if it points to an object on a candidate page.
+  void Record(const void* slot, WriteBarrierSlotType);
+  void RecordMultiple(const void* start, size_t len, WriteBarrierSlotType);
+
+  // Records that the object with payload `from` was moved to `to`.
+  void RecordMove(ConstAddress from, Address to);
+
+  // Updates all recorded slots to the new locations of the objects.
+  void UpdateSlots();
+
+ private:
+  struct Slot {
+    Address slot;
+    // Payload of the object containing `slot` if that object may be moved.
+    ConstAddress holder;
+    // The referenced address and the payload of the object containing it. The
+    // two differ for references to mixins.
+    ConstAddress value;
+    ConstAddress target;
+    WriteBarrierSlotType slot_type;
+  };
+
+  bool IsOnCandidatePage(const void* address) const;
+  Address Forward(ConstAddress payload) const;
+
+  std::unordered_set<const BasePage*> candidate_pages_;
+  std::vector<Slot> slots_;
+  std::unordered_map<ConstAddress, Address> forwarding_table_;
+};
+
+// Forwards all `Member` slots found while tracing objects to a
+// `CompactionSlotRecorder`.
+class V8_EXPORT_PRIVATE CompactionSlotVisitor final : public VisitorBase {
+ public:
+  explicit CompactionSlotVisitor(CompactionSlotRecorder& recorder)
+      : recorder_(recorder) {
+    handles_member_slots_ = true;
+  }
+
+ protected:
+  void HandleMemberSlot(const void* slot,
+                        WriteBarrierSlotType slot_type) final {
+    recorder_.Record(slot, slot_type);
+  }
+  void VisitMultipleUncompressedMember(const void* start, size_t len,
+                                       TraceDescriptorCallback) final {
+    recorder_.RecordMultiple(start, len, WriteBarrierSlotType::kUncompressed);
+  }
+#if defined(CPPGC_POINTER_COMPRESSION)
+  void VisitMultipleCompressedMember(const void* start, size_t len,
+                                     TraceDescriptorCallback) final {
+    recorder_.RecordMultiple(start, len, WriteBarrierSlotType::kCompressed);
+  }
+#endif  // defined(CPPGC_POINTER_COMPRESSION)
+
+ private:
+  CompactionSlotRecorder& recorder_;
+};
+
 class V8_EXPORT_PRIVATE Compactor final {
   using CompactableSpaceHandling = SweepingConfig::CompactableSpaceHandling;
 
@@ -40,6 +120,10 @@ class V8_EXPORT_PRIVATE Compactor final {
  private:
   bool ShouldCompact(GCConfig::MarkingType, StackState) const;
 
+  // Pins pages holding objects that are referenced from outside of the heap.
+  void PinPagesReferencedFromRoots();
+  void UnpinPages();
+
   RawHeap& heap_;
   // Compactor does not own the compactable spaces. The heap owns all spaces.
   std::vector<NormalPageSpace*> compactable_spaces_;
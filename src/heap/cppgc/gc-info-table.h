@@ -23,13 +23,18 @@ namespace internal {
 // inherit from GarbageCollected.
 struct GCInfo final {
   constexpr GCInfo(FinalizationCallback finalize, TraceCallback trace,
-                   NameCallback name)
-      : finalize(finalize), trace(trace), name(name) {}
+                   NameCallback name, bool has_thread_safe_finalizer = false)
+      : finalize(finalize),
+        trace(trace),
+        name(name),
+        has_thread_safe_finalizer(has_thread_safe_finalizer) {}
 
   FinalizationCallback finalize;
   TraceCallback trace;
   NameCallback name;
-  size_t padding = 0;
+  // Set for types annotated with CPPGC_THREAD_SAFE_FINALIZER(). Occupies what
+  // would otherwise be padding.
+  bool has_thread_safe_finalizer;
 };
 
 class V8_EXPORT GCInfoTable final {
@@ -24,19 +24,21 @@ HeapObjectName GetHiddenName(
 // static
 GCInfoIndex EnsureGCInfoIndexTrait::EnsureGCInfoIndex(
     std::atomic<GCInfoIndex>& registered_index, TraceCallback trace_callback,
-    FinalizationCallback finalization_callback, NameCallback name_callback) {
+    FinalizationCallback finalization_callback, bool has_thread_safe_finalizer,
+    NameCallback name_callback) {
   return GlobalGCInfoTable::GetMutable().RegisterNewGCInfo(
-      registered_index,
-      GCInfo(finalization_callback, trace_callback, name_callback));
+      registered_index, GCInfo(finalization_callback, trace_callback,
+                               name_callback, has_thread_safe_finalizer));
 }
 
 // static
 GCInfoIndex EnsureGCInfoIndexTrait::EnsureGCInfoIndex(
     std::atomic<GCInfoIndex>& registered_index, TraceCallback trace_callback,
-    FinalizationCallback finalization_callback) {
+    FinalizationCallback finalization_callback,
+    bool has_thread_safe_finalizer) {
   return GlobalGCInfoTable::GetMutable().RegisterNewGCInfo(
-      registered_index,
-      GCInfo(finalization_callback, trace_callback, GetHiddenName));
+      registered_index, GCInfo(finalization_callback, trace_callback,
+                               GetHiddenName, has_thread_safe_finalizer));
 }
 
 // static
@@ -100,8 +100,9 @@ HeapBase::HeapBase(
     std::shared_ptr<cppgc::Platform> platform,
     const std::vector<std::unique_ptr<CustomSpaceBase>>& custom_spaces,
     StackSupport stack_support, MarkingType marking_support,
-    SweepingType sweeping_support, GarbageCollector& garbage_collector)
-    : raw_heap_(this, custom_spaces),
+    SweepingType sweeping_support, bool compact_default_spaces,
+    GarbageCollector& garbage_collector)
+    : raw_heap_(this, custom_spaces, compact_default_spaces),
       platform_(std::move(platform)),
       oom_handler_(std::make_unique<FatalOutOfMemoryHandler>(this)),
 #if defined(LEAK_SANITIZER)
@@ -352,6 +353,11 @@ bool HeapBase::CurrentThreadIsHeapThread() const {
   return heap_thread_id_ == v8::base::OS::GetCurrentThreadId();
 }
 
+std::unique_ptr<Visitor> HeapBase::CreateCompactionSlotVisitor(
+    CompactionSlotRecorder& recorder) {
+  return std::make_unique<CompactionSlotVisitor>(recorder);
+}
+
 ClassNameAsHeapObjectNameScope::ClassNameAsHeapObjectNameScope(HeapBase& heap)
     : heap_(heap),
       saved_heap_object_name_value_(heap_.name_of_unnamed_object()) {
@@ -95,7 +95,8 @@ class V8_EXPORT_PRIVATE HeapBase : public cppgc::HeapHandle {
   HeapBase(std::shared_ptr<cppgc::Platform> platform,
            const std::vector<std::unique_ptr<CustomSpaceBase>>& custom_spaces,
            StackSupport stack_support, MarkingType marking_support,
-           SweepingType sweeping_support, GarbageCollector& garbage_collector);
+           SweepingType sweeping_support, bool compact_default_spaces,
+           GarbageCollector& garbage_collector);
   virtual ~HeapBase();
 
   HeapBase(const HeapBase&) = delete;
@@ -208,6 +209,11 @@ class V8_EXPORT_PRIVATE HeapBase : public cppgc::HeapHandle {
 
   virtual bool CurrentThreadIsHeapThread() const;
 
+  // Returns a visitor that records `Member` slots for the compactor when
+  // tracing objects.
+  virtual std::unique_ptr<Visitor> CreateCompactionSlotVisitor(
+      CompactionSlotRecorder&);
+
   MarkingType marking_support() const { return marking_support_; }
   SweepingType sweeping_support() const { return sweeping_support_; }
 
@@ -105,6 +105,8 @@ class HeapObjectHeader {
   bool IsFree() const;
 
   inline bool IsFinalizable() const;
+  // Whether the finalizer may run on a thread other than the creation thread.
+  inline bool HasThreadSafeFinalizer() const;
   void Finalize();
 
 #if defined(CPPGC_CAGED_HEAP)
@@ -317,6 +319,11 @@ bool HeapObjectHeader::IsFinalizable() const {
   return gc_info.finalize;
 }
 
+bool HeapObjectHeader::HasThreadSafeFinalizer() const {
+  const GCInfo& gc_info = GlobalGCInfoTable::GCInfoFromIndex(GetGCInfoIndex());
+  return gc_info.has_thread_safe_finalizer;
+}
+
 #if defined(CPPGC_CAGED_HEAP)
 void HeapObjectHeader::SetNextUnfinalized(HeapObjectHeader* next) {
 #if defined(CPPGC_POINTER_COMPRESSION)
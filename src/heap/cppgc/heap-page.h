@@ -120,6 +120,20 @@ class V8_EXPORT_PRIVATE BasePage : public BasePageHandle {
     contains_young_objects_ = value;
   }
 
+  // Pinned pages are not moved by the compactor. Pages are pinned during a
+  // compacting garbage collection when they hold objects that are referenced
+  // from outside of the heap. May be called concurrently.
+  void Pin() { is_pinned_.store(true, std::memory_order_relaxed); }
+  void Unpin() { is_pinned_.store(false, std::memory_order_relaxed); }
+  bool is_pinned() const { return is_pinned_.load(std::memory_order_relaxed); }
+
+  // Pages that are compacted in the current garbage collection. Such pages are
+  // swept by the compactor and skipped by the sweeper.
+  bool is_compaction_candidate() const { return is_compaction_candidate_; }
+  void set_compaction_candidate(bool value) {
+    is_compaction_candidate_ = value;
+  }
+
 #if defined(CPPGC_YOUNG_GENERATION)
   V8_INLINE SlotSet* slot_set() const { return slot_set_.get(); }
   V8_INLINE SlotSet& GetOrAllocateSlotSet();
@@ -142,6 +156,8 @@ class V8_EXPORT_PRIVATE BasePage : public BasePageHandle {
   BaseSpace* space_;
   PageType type_;
   bool contains_young_objects_ = false;
+  bool is_compaction_candidate_ = false;
+  std::atomic<bool> is_pinned_{false};
 #if defined(CPPGC_YOUNG_GENERATION)
   std::unique_ptr<SlotSet, SlotSetDeleter> slot_set_;
 #endif  // defined(CPPGC_YOUNG_GENERATION)
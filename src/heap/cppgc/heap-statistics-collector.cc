@@ -133,6 +133,9 @@ bool HeapStatisticsCollector::VisitNormalPageSpace(NormalPageSpace& space) {
       InitializeSpace(current_stats_, GetNormalPageSpaceName(space.index()));
 
   space.free_list().CollectStatistics(current_space_stats_->free_list_stats);
+  current_space_stats_->is_compactable = space.is_compactable();
+  // Discarded memory is subtracted again when visiting the pages.
+  current_space_stats_->fragmented_size_bytes = space.free_list().Size();
 
   return false;
 }
@@ -153,6 +156,9 @@ bool HeapStatisticsCollector::VisitNormalPage(NormalPage& page) {
   current_page_stats_->committed_size_bytes = kPageSize;
   current_page_stats_->resident_size_bytes =
       kPageSize - page.discarded_memory();
+  DCHECK_GE(current_space_stats_->fragmented_size_bytes,
+            page.discarded_memory());
+  current_space_stats_->fragmented_size_bytes -= page.discarded_memory();
   return false;
 }
 
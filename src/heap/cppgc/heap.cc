@@ -75,7 +75,8 @@ void CheckConfig(GCConfig config, HeapBase::MarkingType marking_support,
 Heap::Heap(std::shared_ptr<cppgc::Platform> platform,
            cppgc::Heap::HeapOptions options)
     : HeapBase(platform, options.custom_spaces, options.stack_support,
-               options.marking_support, options.sweeping_support, gc_invoker_),
+               options.marking_support, options.sweeping_support,
+               options.compact_default_spaces, gc_invoker_),
       gc_invoker_(this, platform_.get(), options.stack_support),
       growing_(&gc_invoker_, stats_collector_.get(),
                options.resource_constraints, options.marking_support,
@@ -43,6 +43,9 @@ class MetricRecorder {
     IncrementalPhases main_thread_incremental;
     Sizes objects;
     Sizes memory;
+    // Time spent invoking prefinalizers in the atomic pause. Prefinalizers
+    // always run on the main thread.
+    int64_t main_thread_atomic_prefinalizer_duration_us = -1;
     double collection_rate_in_percent;
     double efficiency_in_bytes_per_us;
     double main_thread_efficiency_in_bytes_per_us;
@@ -142,7 +142,12 @@ ObjectAllocator::ObjectAllocator(RawHeap& heap, PageBackend& page_backend,
       stats_collector_(stats_collector),
       prefinalizer_handler_(prefinalizer_handler),
       oom_handler_(oom_handler),
-      garbage_collector_(garbage_collector) {}
+      garbage_collector_(garbage_collector) {
+  for (size_t i = 0; i < kNumberOfSizeClasses; ++i) {
+    size_class_spaces_[i] = &NormalPageSpace::From(
+        *raw_heap_.Space(static_cast<RawHeap::RegularSpaceType>(i)));
+  }
+}
 
 void ObjectAllocator::OutOfLineAllocateGCSafePoint(NormalPageSpace& space,
                                                    size_t size,
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_CPPGC_OBJECT_ALLOCATOR_H_
 #define V8_HEAP_CPPGC_OBJECT_ALLOCATOR_H_
 
+#include <array>
 #include <optional>
 
 #include "include/cppgc/allocation.h"
@@ -41,6 +42,9 @@ class GarbageCollector;
 class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
  public:
   static constexpr size_t kSmallestSpaceSize = 32;
+  // Number of regular normal page spaces, one per object size class.
+  static constexpr size_t kNumberOfSizeClasses =
+      static_cast<size_t>(RawHeap::RegularSpaceType::kLarge);
 
   ObjectAllocator(RawHeap&, PageBackend&, StatsCollector&, PreFinalizerHandler&,
                   FatalOutOfMemoryHandler&, GarbageCollector&);
@@ -71,6 +75,12 @@ class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
   inline static RawHeap::RegularSpaceType GetInitialSpaceIndexForSize(
       size_t size);
 
+  // Returns the normal page space serving the size class `type`.
+  NormalPageSpace& SizeClassSpace(RawHeap::RegularSpaceType type) const {
+    DCHECK_NE(RawHeap::RegularSpaceType::kLarge, type);
+    return *size_class_spaces_[static_cast<size_t>(type)];
+  }
+
   inline void* AllocateObjectOnSpace(NormalPageSpace&, size_t, GCInfoIndex);
   inline void* AllocateObjectOnSpace(NormalPageSpace&, size_t, AlignVal,
                                      GCInfoIndex);
@@ -102,6 +112,10 @@ class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
   PreFinalizerHandler& prefinalizer_handler_;
   FatalOutOfMemoryHandler& oom_handler_;
   GarbageCollector& garbage_collector_;
+  // Direct pointers to the normal page spaces of the size classes. Spaces are
+  // owned by `raw_heap_` and outlive the allocator. Caching them avoids the
+  // indirection through the space vector on the allocation fast path.
+  std::array<NormalPageSpace*, kNumberOfSizeClasses> size_class_spaces_;
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
   // Specifies how many allocations should be performed until triggering a
   // garbage collection.
@@ -118,8 +132,7 @@ void* ObjectAllocator::AllocateObject(size_t size, GCInfoIndex gcinfo) {
       RoundUp<kAllocationGranularity>(size + sizeof(HeapObjectHeader));
   const RawHeap::RegularSpaceType type =
       GetInitialSpaceIndexForSize(allocation_size);
-  return AllocateObjectOnSpace(NormalPageSpace::From(*raw_heap_.Space(type)),
-                               allocation_size, gcinfo);
+  return AllocateObjectOnSpace(SizeClassSpace(type), allocation_size, gcinfo);
 }
 
 void* ObjectAllocator::AllocateObject(size_t size, AlignVal alignment,
@@ -132,8 +145,8 @@ void* ObjectAllocator::AllocateObject(size_t size, AlignVal alignment,
       RoundUp<kAllocationGranularity>(size + sizeof(HeapObjectHeader));
   const RawHeap::RegularSpaceType type =
       GetInitialSpaceIndexForSize(allocation_size);
-  return AllocateObjectOnSpace(NormalPageSpace::From(*raw_heap_.Space(type)),
-                               allocation_size, alignment, gcinfo);
+  return AllocateObjectOnSpace(SizeClassSpace(type), allocation_size,
+                               alignment, gcinfo);
 }
 
 void* ObjectAllocator::AllocateObject(size_t size, GCInfoIndex gcinfo,
@@ -11,6 +11,7 @@
 #include "src/heap/cppgc/heap-page.h"
 #include "src/heap/cppgc/heap.h"
 #include "src/heap/cppgc/liveness-broker.h"
+#include "src/heap/cppgc/raw-heap.h"
 #include "src/heap/cppgc/stats-collector.h"
 
 namespace cppgc {
@@ -19,7 +20,10 @@ namespace internal {
 PrefinalizerRegistration::PrefinalizerRegistration(void* object,
                                                    Callback callback) {
   auto* page = BasePage::FromPayload(object);
-  DCHECK(!page->space().is_compactable());
+  // Objects with pre-finalizers are not supported on compactable custom
+  // spaces. On default spaces, the compactor does not move them.
+  DCHECK_IMPLIES(page->space().is_compactable(),
+                 page->space().index() < RawHeap::kNumberOfRegularSpaces);
   page->heap().prefinalizer_handler()->RegisterPrefinalizer({object, callback});
 }
 
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "include/cppgc/prefinalizer.h"
+#include "src/base/logging.h"
 
 namespace cppgc {
 namespace internal {
@@ -34,6 +35,16 @@ class PreFinalizerHandler final {
 
   bool IsInvokingPreFinalizers() const { return is_invoking_; }
 
+  // Calls `callback(object)` for all objects that have pre-finalizers
+  // registered.
+  template <typename Callback>
+  void IterateObjects(Callback callback) const {
+    DCHECK(!is_invoking_);
+    for (const PreFinalizer& pre_finalizer : ordered_pre_finalizers_) {
+      callback(pre_finalizer.object);
+    }
+  }
+
   void NotifyAllocationInPrefinalizer(size_t);
   size_t ExtractBytesAllocatedInPrefinalizers() {
     return std::exchange(bytes_allocated_in_prefinalizers, 0);
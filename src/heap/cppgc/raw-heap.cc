@@ -14,11 +14,13 @@ constexpr size_t RawHeap::kNumberOfRegularSpaces;
 
 RawHeap::RawHeap(
     HeapBase* heap,
-    const std::vector<std::unique_ptr<CustomSpaceBase>>& custom_spaces)
+    const std::vector<std::unique_ptr<CustomSpaceBase>>& custom_spaces,
+    bool compact_default_spaces)
     : main_heap_(heap) {
   size_t i = 0;
   for (; i < static_cast<size_t>(RegularSpaceType::kLarge); ++i) {
-    spaces_.push_back(std::make_unique<NormalPageSpace>(this, i, false));
+    spaces_.push_back(
+        std::make_unique<NormalPageSpace>(this, i, compact_default_spaces));
   }
   spaces_.push_back(std::make_unique<LargePageSpace>(
       this, static_cast<size_t>(RegularSpaceType::kLarge)));
@@ -48,7 +48,8 @@ class V8_EXPORT_PRIVATE RawHeap final {
   using const_iterator = Spaces::const_iterator;
 
   RawHeap(HeapBase* heap,
-          const std::vector<std::unique_ptr<CustomSpaceBase>>& custom_spaces);
+          const std::vector<std::unique_ptr<CustomSpaceBase>>& custom_spaces,
+          bool compact_default_spaces = false);
 
   RawHeap(const RawHeap&) = delete;
   RawHeap& operator=(const RawHeap&) = delete;
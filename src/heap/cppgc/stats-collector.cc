@@ -182,11 +182,12 @@ MetricRecorder::GCCycle GetCycleEventForMetricRecorder(
     CollectionType type, StatsCollector::MarkingType marking_type,
     StatsCollector::SweepingType sweeping_type, int64_t atomic_mark_us,
     int64_t atomic_weak_us, int64_t atomic_compact_us, int64_t atomic_sweep_us,
-    int64_t incremental_mark_us, int64_t incremental_sweep_us,
-    int64_t concurrent_mark_us, int64_t concurrent_sweep_us,
-    int64_t objects_before_bytes, int64_t objects_after_bytes,
-    int64_t objects_freed_bytes, int64_t memory_before_bytes,
-    int64_t memory_after_bytes, int64_t memory_freed_bytes) {
+    int64_t atomic_prefinalizer_us, int64_t incremental_mark_us,
+    int64_t incremental_sweep_us, int64_t concurrent_mark_us,
+    int64_t concurrent_sweep_us, int64_t objects_before_bytes,
+    int64_t objects_after_bytes, int64_t objects_freed_bytes,
+    int64_t memory_before_bytes, int64_t memory_after_bytes,
+    int64_t memory_freed_bytes) {
   MetricRecorder::GCCycle event;
   event.type = (type == CollectionType::kMajor)
                    ? MetricRecorder::GCCycle::Type::kMajor
@@ -204,6 +205,7 @@ MetricRecorder::GCCycle GetCycleEventForMetricRecorder(
   event.main_thread_atomic.weak_duration_us = atomic_weak_us;
   event.main_thread_atomic.compact_duration_us = atomic_compact_us;
   event.main_thread_atomic.sweep_duration_us = atomic_sweep_us;
+  event.main_thread_atomic_prefinalizer_duration_us = atomic_prefinalizer_us;
   // MainThread:
   event.main_thread.mark_duration_us =
       event.main_thread_atomic.mark_duration_us + incremental_mark_us;
@@ -277,6 +279,7 @@ void StatsCollector::NotifySweepingCompleted(SweepingType sweeping_type) {
         previous_.scope_data[kAtomicWeak].InMicroseconds(),
         previous_.scope_data[kAtomicCompact].InMicroseconds(),
         previous_.scope_data[kAtomicSweep].InMicroseconds(),
+        previous_.scope_data[kSweepInvokePreFinalizers].InMicroseconds(),
         previous_.scope_data[kIncrementalMark].InMicroseconds(),
         previous_.scope_data[kIncrementalSweep].InMicroseconds(),
         previous_.concurrent_scope_data[kConcurrentMark],
@@ -295,7 +295,12 @@ class DeferredFinalizationBuilder final : public FreeHandler {
   }
 
   void AddFinalizer(HeapObjectHeader* header, size_t size) {
-    if (header->IsFinalizable()) {
+    if (header->HasThreadSafeFinalizer()) {
+      // Thread-safe finalizers run right away so that the mutator does not
+      // have to process the object when finalizing the page.
+      header->Finalize();
+      SetMemoryInaccessible(header, size);
+    } else if (header->IsFinalizable()) {
 #if defined(CPPGC_CAGED_HEAP)
       if (!current_unfinalized_) {
         DCHECK_NULL(result_.unfinalized_objects_head);
@@ -837,12 +842,17 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
     HeapObjectHeader* header = page.ObjectHeader();
     CHECK(!header->IsMarked());
     DCHECK_EQ(page.marked_bytes(), 0u);
+    bool needs_deferred_finalization = header->IsFinalizable();
+    if (needs_deferred_finalization && header->HasThreadSafeFinalizer()) {
+      header->Finalize();
+      needs_deferred_finalization = false;
+    }
 #if defined(CPPGC_CAGED_HEAP)
     HeapObjectHeader* const unfinalized_objects =
-        header->IsFinalizable() ? page.ObjectHeader() : nullptr;
+        needs_deferred_finalization ? page.ObjectHeader() : nullptr;
 #else   // !defined(CPPGC_CAGED_HEAP)
     std::vector<HeapObjectHeader*> unfinalized_objects;
-    if (header->IsFinalizable()) {
+    if (needs_deferred_finalization) {
       unfinalized_objects.push_back(page.ObjectHeader());
     }
 #endif  // !defined(CPPGC_CAGED_HEAP)
@@ -868,7 +878,8 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
 //
 // Normal spaces:
 // - Clears free lists.
-// - Moves all pages to local state (SpaceStates).
+// - Moves all pages to local state (SpaceStates). Pages that were compacted
+//   are kept on compactable spaces.
 // - ASAN: Poisons all unmarked object payloads.
 //
 // Large spaces:
@@ -898,18 +909,31 @@ class PrepareForSweepVisitor final
 
  protected:
   bool VisitNormalPageSpace(NormalPageSpace& space) {
+    CHECK(!space.linear_allocation_buffer().size());
+
+    BaseSpace::Pages space_pages;
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
         space.is_compactable()) {
-      return true;
+      // The compactor has already rebuilt the free list for the pages it
+      // compacted. Only the remaining pages are swept.
+      for (BasePage* page : space.RemoveAllPages()) {
+        if (page->is_compaction_candidate()) {
+          page->set_compaction_candidate(false);
+          space.AddPage(page);
+        } else {
+          space_pages.push_back(page);
+        }
+      }
+    } else {
+      space.free_list().Clear();
+      space_pages = space.RemoveAllPages();
     }
-
-    CHECK(!space.linear_allocation_buffer().size());
-    space.free_list().Clear();
 #ifdef V8_USE_ADDRESS_SANITIZER
-    UnmarkedObjectsPoisoner().Traverse(space);
+    for (BasePage* page : space_pages) {
+      UnmarkedObjectsPoisoner().Traverse(*page);
+    }
 #endif  // V8_USE_ADDRESS_SANITIZER
 
-    BaseSpace::Pages space_pages = space.RemoveAllPages();
     std::sort(space_pages.begin(), space_pages.end(),
               [](const BasePage* a, const BasePage* b) {
                 return a->marked_bytes() < b->marked_bytes();
@@ -0,0 +1,70 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_EPHEMERON_INDEX_H_
+#define V8_HEAP_EPHEMERON_INDEX_H_
+
+#include <unordered_map>
+
+#include "src/base/logging.h"
+#include "src/objects/heap-object.h"
+#include "src/objects/objects.h"
+
+namespace v8::internal {
+
+// An index of pending ephemerons keyed by their unmarked keys.
+//
+// The index is used to find the ephemeron fixpoint of a major GC in linear
+// time: Instead of revisiting all pending ephemerons until no more values get
+// marked, marking threads look up each object they visit in the index and
+// mark the values that the object keeps alive as an ephemeron key.
+//
+// The index is only modified on the main thread while no other marking thread
+// is running. In between modifications, any number of marking threads may
+// query it concurrently.
+class EphemeronIndex final {
+ public:
+  EphemeronIndex() = default;
+  EphemeronIndex(const EphemeronIndex&) = delete;
+  EphemeronIndex& operator=(const EphemeronIndex&) = delete;
+
+  // Not thread-safe.
+  void Add(Tagged<HeapObject> key, Tagged<HeapObject> value) {
+    key_to_values_.emplace(key, value);
+  }
+
+  // Not thread-safe.
+  void Clear() { key_to_values_.clear(); }
+
+  bool IsEmpty() const { return key_to_values_.empty(); }
+  size_t Size() const { return key_to_values_.size(); }
+
+  // Calls `callback(value)` for all values that are kept alive by `key`.
+  template <typename Callback>
+  void ForEachValue(Tagged<HeapObject> key, Callback callback) const {
+    auto range = key_to_values_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      callback(it->second);
+    }
+  }
+
+  // Calls `callback(key, value)` for all entries.
+  template <typename Callback>
+  void Iterate(Callback callback) const {
+    for (const auto& [key, value] : key_to_values_) {
+      callback(key, value);
+    }
+  }
+
+ private:
+  // We must use the full pointer comparison here as the index is queried with
+  // objects from different cages (e.g. code- or trusted cage).
+  std::unordered_multimap<Tagged<HeapObject>, Tagged<HeapObject>,
+                          Object::Hasher, Object::KeyEqualSafe>
+      key_to_values_;
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_HEAP_EPHEMERON_INDEX_H_
@@ -414,6 +414,8 @@ Handle<Script> FactoryBase<Impl>::NewScriptWithId(
     raw->set_source_hash(roots.undefined_value(), SKIP_WRITE_BARRIER);
     raw->set_compiled_lazy_function_positions(roots.undefined_value(),
                                               SKIP_WRITE_BARRIER);
+    raw->set_literal_allocation_sites(roots.undefined_value(),
+                                      SKIP_WRITE_BARRIER);
 #ifdef V8_SCRIPTORMODULE_LEGACY_LIFETIME
     raw->set_script_or_modules(roots.empty_array_list());
 #endif
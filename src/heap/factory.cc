@@ -1579,6 +1579,8 @@ Handle<Script> Factory::CloneScript(DirectHandle<Script> script,
     new_script->set_source_hash(*undefined_value(), SKIP_WRITE_BARRIER);
     new_script->set_compiled_lazy_function_positions(*undefined_value(),
                                                      SKIP_WRITE_BARRIER);
+    new_script->set_literal_allocation_sites(*undefined_value(),
+                                             SKIP_WRITE_BARRIER);
 #ifdef V8_SCRIPTORMODULE_LEGACY_LIFETIME
     new_script->set_script_or_modules(*list);
 #endif
@@ -4,6 +4,7 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <limits>
 #include <optional>
@@ -317,6 +318,9 @@ void GCTracer::StartInSafepoint(base::TimeTicks time) {
       (heap_->new_lo_space() ? heap_->new_lo_space()->SizeOfObjects() : 0);
   current_.young_object_size = new_space_size + new_lo_space_size;
   current_.start_atomic_pause_time = time;
+  if (heap_->isolate()->metrics_recorder()->HasEmbedderRecorder()) {
+    RecordSpaceObjectSizes(current_.start_space_object_sizes);
+  }
 }
 
 void GCTracer::StopInSafepoint(base::TimeTicks time) {
@@ -324,13 +328,17 @@ void GCTracer::StopInSafepoint(base::TimeTicks time) {
   current_.end_memory_size = heap_->memory_allocator()->Size();
   current_.end_holes_size = CountTotalHolesSize(heap_);
   current_.survived_young_object_size = heap_->SurvivedYoungObjectSize();
+  current_.promoted_object_size = heap_->promoted_objects_size();
   current_.end_atomic_pause_time = time;
+  if (heap_->isolate()->metrics_recorder()->HasEmbedderRecorder()) {
+    RecordSpaceObjectSizes(current_.end_space_object_sizes);
+  }
 
   // Do not include the GC pause for calculating the allocation rate. GC pause
   // with heap verification can decrease the allocation rate significantly.
   allocation_time_ = time;
 
-  if (v8_flags.memory_balancer) {
+  if (heap_->mb_) {
     UpdateMemoryBalancerGCSpeed();
   }
 }
@@ -408,7 +416,7 @@ void GCTracer::StopObservablePause(GarbageCollector collector,
 }
 
 void GCTracer::UpdateMemoryBalancerGCSpeed() {
-  DCHECK(v8_flags.memory_balancer);
+  DCHECK_NOT_NULL(heap_->mb_);
   size_t major_gc_bytes = current_.start_object_size;
   const base::TimeDelta atomic_pause_duration =
       current_.end_atomic_pause_time - current_.start_atomic_pause_time;
@@ -462,6 +470,7 @@ void GCTracer::StopCycle(GarbageCollector collector) {
   DCHECK(IsConsistentWithCollector(collector));
 
   FetchBackgroundCounters();
+  ReportCycleDetailsToRecorder();
 
   if (Heap::IsYoungGenerationCollector(collector)) {
     ReportYoungCycleToRecorder();
@@ -647,7 +656,7 @@ void GCTracer::SampleAllocation(base::TimeTicks current,
   embedder_generation_allocations_.Update(
       BytesAndDuration(embedder_allocated_bytes, allocation_duration));
 
-  if (v8_flags.memory_balancer) {
+  if (heap_->mb_) {
     heap_->mb_->UpdateAllocationRate(old_generation_allocated_bytes,
                                      allocation_duration);
   }
@@ -725,6 +734,22 @@ void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
 
+void GCTracer::AddBackgroundLabRefill(size_t lab_size, bool fragmented) {
+  background_lab_refills_.fetch_add(1, std::memory_order_relaxed);
+  background_lab_bytes_.fetch_add(lab_size, std::memory_order_relaxed);
+  if (fragmented) {
+    background_lab_fragmented_refills_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void GCTracer::AddSharedLabRefill(size_t lab_size, bool fragmented) {
+  shared_lab_refills_.fetch_add(1, std::memory_order_relaxed);
+  shared_lab_bytes_.fetch_add(lab_size, std::memory_order_relaxed);
+  if (fragmented) {
+    shared_lab_fragmented_refills_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
 void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
   if (bytes > 0) {
     current_.incremental_marking_bytes += bytes;
@@ -843,6 +868,7 @@ void GCTracer::PrintNVP() const {
           "scavenge=%.2f "
           "scavenge.free_remembered_set=%.2f "
           "scavenge.roots=%.2f "
+          "scavenge.pin_objects=%.2f "
           "scavenge.weak=%.2f "
           "scavenge.weak_global_handles.identify=%.2f "
           "scavenge.weak_global_handles.process=%.2f "
@@ -884,6 +910,7 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::SCAVENGER_SCAVENGE),
           current_scope(Scope::SCAVENGER_FREE_REMEMBERED_SET),
           current_scope(Scope::SCAVENGER_SCAVENGE_ROOTS),
+          current_scope(Scope::SCAVENGER_SCAVENGE_PIN_OBJECTS),
           current_scope(Scope::SCAVENGER_SCAVENGE_WEAK),
           current_scope(Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_IDENTIFY),
           current_scope(Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_PROCESS),
@@ -1097,6 +1124,12 @@ void GCTracer::PrintNVP() const {
           "new_space_survive_rate=%.1f%% "
           "new_space_allocation_throughput=%.1f "
           "pool_chunks=%zu "
+          "background_lab_refills=%zu "
+          "background_lab_bytes=%zu "
+          "background_lab_fragmented=%zu "
+          "shared_lab_refills=%zu "
+          "shared_lab_bytes=%zu "
+          "shared_lab_fragmented=%zu "
           "compaction_speed=%.f\n",
           duration.InMillisecondsF(), spent_in_mutator.InMillisecondsF(),
           ToString(current_.type, true), current_.reduce_memory,
@@ -1184,6 +1217,9 @@ void GCTracer::PrintNVP() const {
           heap_->new_space_surviving_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
           heap_->memory_allocator()->pool()->NumberOfCommittedChunks(),
+          background_lab_refills(), background_lab_bytes(),
+          background_lab_fragmented_refills(), shared_lab_refills(),
+          shared_lab_bytes(), shared_lab_fragmented_refills(),
           CompactionSpeedInBytesPerMillisecond().value_or(0.0));
       break;
     case Event::Type::START:
@@ -1878,6 +1914,59 @@ void GCTracer::ReportYoungCycleToRecorder() {
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
 
+void GCTracer::RecordSpaceObjectSizes(size_t* sizes) const {
+  std::fill_n(sizes, LAST_SPACE + 1, 0);
+  for (SpaceIterator it(heap_); it.HasNext();) {
+    Space* space = it.Next();
+    sizes[space->identity()] = space->SizeOfObjects();
+  }
+}
+
+void GCTracer::ReportCycleDetailsToRecorder() {
+  DCHECK_EQ(Event::State::NOT_RUNNING, current_.state);
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (!recorder->HasEmbedderRecorder()) return;
+
+  v8::metrics::GarbageCollectionCycleDetails event;
+  event.reason = static_cast<int>(current_.gc_reason);
+  event.is_young_generation = Event::IsYoungGenerationEvent(current_.type);
+  event.pause_wall_clock_duration_in_us =
+      (current_.end_time - current_.start_time).InMicroseconds();
+  event.time_to_safepoint_in_us =
+      current_.scopes[Scope::TIME_TO_SAFEPOINT].InMicroseconds();
+  event.concurrency_estimate =
+      static_cast<int64_t>(current_.concurrency_estimate);
+  event.bytes_promoted = static_cast<int64_t>(current_.promoted_object_size);
+
+  base::TimeDelta background_duration;
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    const base::TimeDelta duration = current_.scopes[i];
+    if (duration.IsZero()) continue;
+    const Scope::ScopeId id = static_cast<Scope::ScopeId>(i);
+    if (id >= Scope::FIRST_BACKGROUND_SCOPE &&
+        id <= Scope::LAST_BACKGROUND_SCOPE) {
+      background_duration += duration;
+    }
+    event.phases.push_back({Scope::Name(id), duration.InMicroseconds()});
+  }
+  event.background_wall_clock_duration_in_us =
+      background_duration.InMicroseconds();
+
+  for (int i = FIRST_SPACE; i <= LAST_SPACE; i++) {
+    const size_t before = current_.start_space_object_sizes[i];
+    const size_t after = current_.end_space_object_sizes[i];
+    if (before == 0 && after == 0) continue;
+    event.spaces.push_back(
+        {ToString(static_cast<AllocationSpace>(i)),
+         static_cast<int64_t>(before), static_cast<int64_t>(after),
+         static_cast<int64_t>(before) - static_cast<int64_t>(after)});
+  }
+
+  recorder->PostThreadSafeEvent(std::move(event));
+}
+
 GarbageCollector GCTracer::GetCurrentCollector() const {
   switch (current_.type) {
     case Event::Type::SCAVENGER:
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <atomic>
 #include <optional>
 
 #include "include/v8-metrics.h"
@@ -228,6 +229,14 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Size of survived young objects in destructor.
     size_t survived_young_object_size = 0;
 
+    // Bytes promoted to the old generation during the atomic pause.
+    size_t promoted_object_size = 0;
+
+    // Per-space object sizes before and after the atomic pause. Only recorded
+    // when an embedder metrics recorder is installed.
+    size_t start_space_object_sizes[LAST_SPACE + 1] = {};
+    size_t end_space_object_sizes[LAST_SPACE + 1] = {};
+
     // Bytes marked incrementally for INCREMENTAL_MARK_COMPACTOR
     size_t incremental_marking_bytes = 0;
 
@@ -342,6 +351,35 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddSurvivalRatio(double survival_ratio);
 
+  // Records that a background thread refilled its LAB with `lab_size` bytes
+  // from the free list of an old space. `fragmented` is set if the free list
+  // could not provide a node of the adaptive LAB size. May be called
+  // concurrently from any thread.
+  void AddBackgroundLabRefill(size_t lab_size, bool fragmented);
+  size_t background_lab_refills() const {
+    return background_lab_refills_.load(std::memory_order_relaxed);
+  }
+  size_t background_lab_bytes() const {
+    return background_lab_bytes_.load(std::memory_order_relaxed);
+  }
+  size_t background_lab_fragmented_refills() const {
+    return background_lab_fragmented_refills_.load(std::memory_order_relaxed);
+  }
+
+  // Same as above for LABs that any thread of this isolate refilled from the
+  // shared space. Recorded on the tracer of the allocating (client) isolate,
+  // so that shared space usage can be attributed to clients.
+  void AddSharedLabRefill(size_t lab_size, bool fragmented);
+  size_t shared_lab_refills() const {
+    return shared_lab_refills_.load(std::memory_order_relaxed);
+  }
+  size_t shared_lab_bytes() const {
+    return shared_lab_bytes_.load(std::memory_order_relaxed);
+  }
+  size_t shared_lab_fragmented_refills() const {
+    return shared_lab_fragmented_refills_.load(std::memory_order_relaxed);
+  }
+
   void SampleConcurrencyEsimate(size_t concurrency);
 
   // Log an incremental marking step.
@@ -497,6 +535,8 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ReportIncrementalMarkingStepToRecorder(double v8_duration);
   void ReportIncrementalSweepingStepToRecorder(double v8_duration);
   void ReportYoungCycleToRecorder();
+  void ReportCycleDetailsToRecorder();
+  void RecordSpaceObjectSizes(size_t* sizes) const;
 
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
@@ -594,6 +634,13 @@ class V8_EXPORT_PRIVATE GCTracer {
   v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalSweep
       incremental_sweep_batched_events_;
 
+  std::atomic<size_t> background_lab_refills_{0};
+  std::atomic<size_t> background_lab_bytes_{0};
+  std::atomic<size_t> background_lab_fragmented_refills_{0};
+  std::atomic<size_t> shared_lab_refills_{0};
+  std::atomic<size_t> shared_lab_bytes_{0};
+  std::atomic<size_t> shared_lab_fragmented_refills_{0};
+
   mutable base::SpinningMutex background_scopes_mutex_;
   base::TimeDelta background_scopes_[Scope::NUMBER_OF_SCOPES];
 
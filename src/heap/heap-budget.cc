@@ -0,0 +1,99 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap-budget.h"
+
+#include <algorithm>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+
+// static
+std::shared_ptr<HeapBudget> HeapBudget::New(size_t total_bytes) {
+  return std::make_shared<internal::HeapBudgetImpl>(total_bytes);
+}
+
+namespace internal {
+
+HeapBudgetImpl::~HeapBudgetImpl() { DCHECK(demands_.empty()); }
+
+void HeapBudgetImpl::SetTotalBytes(size_t total_bytes) {
+  base::MutexGuard guard(&mutex_);
+  total_bytes_ = total_bytes;
+}
+
+size_t HeapBudgetImpl::TotalBytes() const {
+  base::MutexGuard guard(&mutex_);
+  return total_bytes_;
+}
+
+size_t HeapBudgetImpl::NumberOfIsolates() const {
+  base::MutexGuard guard(&mutex_);
+  return demands_.size();
+}
+
+size_t HeapBudgetImpl::AllocatedBytes() const {
+  base::MutexGuard guard(&mutex_);
+  return sum_granted_bytes_;
+}
+
+void HeapBudgetImpl::Register(const void* key) {
+  base::MutexGuard guard(&mutex_);
+  const bool inserted = demands_.emplace(key, Demand{}).second;
+  DCHECK(inserted);
+  USE(inserted);
+}
+
+void HeapBudgetImpl::Unregister(const void* key) {
+  base::MutexGuard guard(&mutex_);
+  auto it = demands_.find(key);
+  DCHECK_NE(it, demands_.end());
+  RemoveFromTotals(it->second);
+  demands_.erase(it);
+}
+
+void HeapBudgetImpl::RemoveFromTotals(const Demand& demand) {
+  sum_live_bytes_ -= demand.live_bytes;
+  sum_desired_headroom_ -= demand.desired_headroom;
+  sum_granted_bytes_ -= demand.live_bytes + demand.granted_headroom;
+}
+
+void HeapBudgetImpl::AddToTotals(const Demand& demand) {
+  sum_live_bytes_ += demand.live_bytes;
+  sum_desired_headroom_ += demand.desired_headroom;
+  sum_granted_bytes_ += demand.live_bytes + demand.granted_headroom;
+}
+
+size_t HeapBudgetImpl::UpdateAndComputeHeadroom(const void* key,
+                                                size_t live_bytes,
+                                                size_t desired_headroom,
+                                                size_t min_headroom) {
+  base::MutexGuard guard(&mutex_);
+  auto it = demands_.find(key);
+  DCHECK_NE(it, demands_.end());
+  Demand& demand = it->second;
+  RemoveFromTotals(demand);
+  demand.live_bytes = live_bytes;
+  demand.desired_headroom = desired_headroom;
+  demand.granted_headroom = 0;
+  AddToTotals(demand);
+
+  const size_t available =
+      total_bytes_ > sum_live_bytes_ ? total_bytes_ - sum_live_bytes_ : 0;
+  size_t headroom = desired_headroom;
+  if (sum_desired_headroom_ > available) {
+    headroom = static_cast<size_t>(static_cast<double>(desired_headroom) *
+                                   static_cast<double>(available) /
+                                   static_cast<double>(sum_desired_headroom_));
+  }
+  headroom = std::max(headroom, min_headroom);
+
+  sum_granted_bytes_ += headroom;
+  demand.granted_headroom = headroom;
+  return headroom;
+}
+
+}  // namespace internal
+}  // namespace v8
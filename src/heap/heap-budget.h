@@ -0,0 +1,71 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_HEAP_BUDGET_H_
+#define V8_HEAP_HEAP_BUDGET_H_
+
+#include <unordered_map>
+
+#include "include/v8-heap-budget.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace internal {
+
+// Implementation of the process-wide old generation budget. Participants are
+// identified by an opaque key (the MemoryBalancer of an isolate) and report
+// their live memory together with the headroom the MemoryBalancer would pick
+// for them in isolation, i.e., sqrt(live * allocation rate / gc speed / c).
+//
+// If the sum of live memory and desired headroom of all participants fits
+// into the budget, every participant gets its desired headroom. Otherwise the
+// memory left after subtracting all live memory is split in proportion to the
+// desired headroom. For the MemBalancer cost model this proportional split is
+// the optimal one for a fixed total.
+class V8_EXPORT_PRIVATE HeapBudgetImpl final : public v8::HeapBudget {
+ public:
+  explicit HeapBudgetImpl(size_t total_bytes) : total_bytes_(total_bytes) {}
+  ~HeapBudgetImpl() override;
+
+  HeapBudgetImpl(const HeapBudgetImpl&) = delete;
+  HeapBudgetImpl& operator=(const HeapBudgetImpl&) = delete;
+
+  // v8::HeapBudget overrides.
+  void SetTotalBytes(size_t total_bytes) override;
+  size_t TotalBytes() const override;
+  size_t NumberOfIsolates() const override;
+  size_t AllocatedBytes() const override;
+
+  void Register(const void* key);
+  void Unregister(const void* key);
+
+  // Updates the demand of `key` and returns the headroom granted on top of
+  // `live_bytes`. The result is at least `min_headroom`.
+  size_t UpdateAndComputeHeadroom(const void* key, size_t live_bytes,
+                                  size_t desired_headroom, size_t min_headroom);
+
+ private:
+  struct Demand {
+    size_t live_bytes = 0;
+    size_t desired_headroom = 0;
+    size_t granted_headroom = 0;
+  };
+
+  void RemoveFromTotals(const Demand& demand);
+  void AddToTotals(const Demand& demand);
+
+  mutable base::Mutex mutex_;
+  size_t total_bytes_;
+  std::unordered_map<const void*, Demand> demands_;
+  // Running sums over `demands_`.
+  size_t sum_live_bytes_ = 0;
+  size_t sum_desired_headroom_ = 0;
+  size_t sum_granted_bytes_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_HEAP_BUDGET_H_
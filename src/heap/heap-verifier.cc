@@ -19,6 +19,7 @@
 #include "src/heap/heap-visitor-inl.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/heap/heap.h"
+#include "src/heap/large-page-metadata-inl.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/memory-chunk-layout.h"
 #include "src/heap/memory-chunk-metadata.h"
@@ -753,6 +754,13 @@ void HeapVerification::VerifyRememberedSetFor(Tagged<HeapObject> object) {
   CollectSlots<OLD_TO_NEW>(chunk, start, end, &old_to_new, &typed_old_to_new);
   CollectSlots<OLD_TO_NEW_BACKGROUND>(chunk, start, end, &old_to_new,
                                       &typed_old_to_new);
+  if (chunk->card_table()) {
+    LargePageMetadata::cast(chunk)->IterateCardMarkedSlots(
+        [&old_to_new](MaybeObjectSlot slot) {
+          old_to_new.insert(slot.address());
+          return KEEP_SLOT;
+        });
+  }
 
   OldToNewSlotVerifyingVisitor old_to_new_visitor(
       isolate(), &old_to_new, &typed_old_to_new,
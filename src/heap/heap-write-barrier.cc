@@ -368,6 +368,10 @@ void WriteBarrier::GenerationalBarrierSlow(Tagged<HeapObject> object,
                                            Tagged<HeapObject> value) {
   MemoryChunk* chunk = MemoryChunk::FromHeapObject(object);
   MutablePageMetadata* metadata = MutablePageMetadata::cast(chunk->Metadata());
+  if (CardTable* card_table = metadata->GetOrAllocateCardTable()) {
+    card_table->Mark(chunk->Offset(slot));
+    return;
+  }
   if (LocalHeap::Current() == nullptr) {
     RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(
         metadata, chunk->Offset(slot));
@@ -418,6 +422,10 @@ void ForRangeImpl(Heap* heap, MemoryChunk* source_chunk,
   MarkCompactCollector* collector = heap->mark_compact_collector();
   MutablePageMetadata* source_page_metadata =
       MutablePageMetadata::cast(source_chunk->Metadata());
+  CardTable* card_table = nullptr;
+  if (kModeMask & kDoGenerationalOrShared) {
+    card_table = source_page_metadata->GetOrAllocateCardTable();
+  }
 
   for (TSlot slot = start_slot; slot < end_slot; ++slot) {
     // If we *only* need the generational or shared WB, we can skip objects
@@ -447,8 +455,12 @@ void ForRangeImpl(Heap* heap, MemoryChunk* source_chunk,
 
     if (kModeMask & kDoGenerationalOrShared) {
       if (HeapLayout::InYoungGeneration(value_heap_object)) {
-        RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(
-            source_page_metadata, source_chunk->Offset(slot.address()));
+        if (card_table) {
+          card_table->Mark(source_chunk->Offset(slot.address()));
+        } else {
+          RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(
+              source_page_metadata, source_chunk->Offset(slot.address()));
+        }
       } else if (HeapLayout::InWritableSharedSpace(value_heap_object)) {
         RememberedSet<OLD_TO_SHARED>::Insert<AccessMode::ATOMIC>(
             source_page_metadata, source_chunk->Offset(slot.address()));
@@ -56,6 +56,7 @@
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-allocator.h"
+#include "src/heap/heap-budget.h"
 #include "src/heap/heap-controller.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-layout-tracer.h"
@@ -102,6 +103,7 @@
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/data-handler.h"
 #include "src/objects/free-space-inl.h"
 #include "src/objects/hash-table-inl.h"
@@ -125,6 +127,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor-inl.h"
@@ -394,6 +397,14 @@ size_t Heap::CommittedMemoryExecutable() {
   return static_cast<size_t>(memory_allocator()->SizeExecutable());
 }
 
+size_t Heap::HugePageMemory() {
+  if (!HasBeenSetUp()) return 0;
+
+  size_t size = memory_allocator()->HugePageSize();
+  if (code_range()) size += code_range()->huge_page_size();
+  return size;
+}
+
 void Heap::UpdateMaximumCommitted() {
   if (!HasBeenSetUp()) return;
 
@@ -1143,7 +1154,7 @@ void Heap::GarbageCollectionEpilogueInSafepoint(GarbageCollector collector) {
     }
     // Discard memory if the GC was requested to reduce memory.
     if (ShouldReduceMemory()) {
-      memory_allocator_->pool()->ReleasePooledChunks();
+      memory_allocator_->pool()->ReduceMemory();
 #if V8_ENABLE_WEBASSEMBLY
       isolate_->stack_pool().ReleaseFinishedStacks();
 #endif
@@ -2495,7 +2506,7 @@ void Heap::RecomputeLimits(GarbageCollector collector, base::TimeTicks time) {
   size_t new_global_allocation_limit = new_limits.global_allocation_limit;
 
   if (collector == GarbageCollector::MARK_COMPACTOR) {
-    if (v8_flags.memory_balancer) {
+    if (mb_) {
       // Now recompute the new allocation limit.
       mb_->RecomputeLimits(new_limits.global_allocation_limit -
                                new_limits.old_generation_allocation_limit,
@@ -4108,6 +4119,10 @@ void Heap::CollectGarbageOnMemoryPressure() {
   const double kMaxMemoryPressurePauseMs = 100;
 
   double start = MonotonicallyIncreasingTimeInMs();
+#ifdef V8_INTL_SUPPORT
+  // Cached ICU formatters are recreated on demand.
+  isolate()->clear_cached_icu_objects();
+#endif  // V8_INTL_SUPPORT
   CollectAllGarbage(GCFlag::kReduceMemoryFootprint,
                     GarbageCollectionReason::kMemoryPressure,
                     kGCCallbackFlagCollectAllAvailableGarbage);
@@ -4147,6 +4162,13 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
        level == MemoryPressureLevel::kModerate)) {
+    // Zone segments kept for reuse can be released right away from any
+    // thread. Under critical pressure, all of them are released.
+    AccountingAllocator* zone_allocator = isolate()->allocator();
+    zone_allocator->TrimSegmentPool(level == MemoryPressureLevel::kCritical
+                                        ? 0
+                                        : zone_allocator->GetCurrentPoolSize() /
+                                              2);
     if (is_isolate_locked) {
       CheckMemoryPressure();
     } else {
@@ -4158,6 +4180,77 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
   }
 }
 
+bool Heap::IdleNotification(base::TimeDelta idle_time) {
+  DCHECK_EQ(gc_state(), NOT_IN_GC);
+  VMState<GC> state(isolate());
+  const base::TimeTicks deadline = base::TimeTicks::Now() + idle_time;
+  auto remaining_idle_time = [deadline]() {
+    return deadline - base::TimeTicks::Now();
+  };
+
+  // Sweeping needs to be completed before starting marking, so finish it
+  // first.
+  if (major_sweeping_in_progress()) {
+    if (sweeper()->SweepMajorUntil(deadline) &&
+        !sweeper()->AreMajorSweeperTasksRunning()) {
+      EnsureSweepingCompleted(SweepingForcedFinalizationMode::kV8Only);
+    }
+  }
+
+  if (v8_flags.incremental_marking && incremental_marking()->IsStopped() &&
+      !major_sweeping_in_progress() &&
+      remaining_idle_time() > base::TimeDelta()) {
+    if (memory_reducer_) {
+      memory_reducer_->NotifyIdle();
+    }
+    if (incremental_marking()->IsStopped() &&
+        IncrementalMarkingLimitReached() != IncrementalMarkingLimit::kNoLimit) {
+      StartIncrementalMarking(GCFlagsForIncrementalMarking(),
+                              GarbageCollectionReason::kIdleNotification,
+                              kGCCallbackScheduleIdleGarbageCollection);
+    }
+  }
+
+  if (incremental_marking()->IsMajorMarking() &&
+      remaining_idle_time() > base::TimeDelta()) {
+    incremental_marking()->AdvanceInIdleTime(remaining_idle_time());
+    if (incremental_marking()->IsMajorMarkingComplete()) {
+      const double finalize_speed =
+          tracer()
+              ->FinalIncrementalMarkCompactSpeedInBytesPerMillisecond()
+              .value_or(GCTracer::kConservativeSpeedInBytesPerMillisecond);
+      if (base::TimeDelta::FromMillisecondsD(SizeOfObjects() /
+                                             finalize_speed) <
+          remaining_idle_time()) {
+        FinalizeIncrementalMarkingAtomically(
+            GarbageCollectionReason::kIdleNotification);
+      }
+    }
+  }
+
+  // Run a young generation GC if one would be scheduled as a task soon anyway
+  // and it is estimated to fit into the remaining idle time.
+  bool young_generation_gc_due = false;
+  if (!v8_flags.single_generation &&
+      MinorGCJob::YoungGenerationTaskTriggerReached(this)) {
+    young_generation_gc_due = true;
+    const double young_gen_gc_speed =
+        tracer()
+            ->YoungGenerationSpeedInBytesPerMillisecond(
+                YoungGenerationSpeedMode::kUpToAndIncludingAtomicPause)
+            .value_or(GCTracer::kConservativeSpeedInBytesPerMillisecond);
+    if (base::TimeDelta::FromMillisecondsD(YoungGenerationSizeOfObjects() /
+                                           young_gen_gc_speed) <
+        remaining_idle_time()) {
+      CollectGarbage(NEW_SPACE, GarbageCollectionReason::kIdleNotification);
+      young_generation_gc_due = false;
+    }
+  }
+
+  return !incremental_marking()->IsMajorMarking() &&
+         !major_sweeping_in_progress() && !young_generation_gc_due;
+}
+
 void Heap::EagerlyFreeExternalMemoryAndWasmCode() {
 #if V8_ENABLE_WEBASSEMBLY
   if (v8_flags.flush_liftoff_code) {
@@ -5049,6 +5142,11 @@ void Heap::GetFromRingBuffer(char* buffer) {
   memcpy(buffer + copied, trace_ring_buffer_, ring_buffer_end_);
 }
 
+void Heap::SetHeapBudget(std::shared_ptr<v8::HeapBudget> budget) {
+  DCHECK(!HasBeenSetUp());
+  heap_budget_ = std::move(budget);
+}
+
 void Heap::ConfigureHeapDefault() {
   v8::ResourceConstraints constraints;
   ConfigureHeap(constraints, nullptr);
@@ -5787,6 +5885,10 @@ void Heap::SetUpSpaces(LinearAllocationArea& new_allocation_info,
 
   tracer_.reset(new GCTracer(this, startup_time));
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
+  if (v8_flags.array_buffer_pooling) {
+    backing_store_pool_ = std::make_shared<BackingStorePool>(
+        this, isolate()->array_buffer_allocator());
+  }
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   if (v8_flags.memory_reducer) memory_reducer_.reset(new MemoryReducer(this));
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
@@ -5816,8 +5918,10 @@ void Heap::SetUpSpaces(LinearAllocationArea& new_allocation_info,
         stress_scavenge_observer_);
   }
 
-  if (v8_flags.memory_balancer) {
-    mb_.reset(new MemoryBalancer(this, startup_time));
+  if (v8_flags.memory_balancer || heap_budget_) {
+    mb_.reset(new MemoryBalancer(
+        this, startup_time,
+        std::static_pointer_cast<HeapBudgetImpl>(heap_budget_)));
   }
 }
 
@@ -6127,6 +6231,12 @@ void Heap::TearDown() {
 
   scavenger_collector_.reset();
   array_buffer_sweeper_.reset();
+  if (backing_store_pool_) {
+    // Backing stores may outlive the heap. Cached memory is freed here and
+    // later releases go straight to the allocator.
+    backing_store_pool_->Detach();
+    backing_store_pool_.reset();
+  }
   incremental_marking_.reset();
   concurrent_marking_.reset();
 
@@ -6378,6 +6488,10 @@ int Heap::InsertIntoRememberedSetFromCode(MutablePageMetadata* chunk,
   // This is called during runtime by a builtin, therefore it is run in the main
   // thread.
   DCHECK_NULL(LocalHeap::Current());
+  if (CardTable* card_table = chunk->GetOrAllocateCardTable()) {
+    card_table->Mark(slot_offset);
+    return 0;
+  }
   RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(chunk, slot_offset);
   return 0;
 }
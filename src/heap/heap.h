@@ -64,6 +64,8 @@ class Stack;
 
 namespace v8 {
 
+class HeapBudget;
+
 namespace debug {
 using OutOfMemoryCallback = void (*)(void* data);
 }  // namespace debug
@@ -78,6 +80,7 @@ class TestMemoryAllocatorScope;
 class ArrayBufferCollector;
 class ArrayBufferSweeper;
 class BackingStore;
+class BackingStorePool;
 class MemoryChunkMetadata;
 class Boolean;
 class CodeLargeObjectSpace;
@@ -558,6 +561,10 @@ class Heap final {
       v8::MemoryPressureLevel level, bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Performs GC work that fits into `idle_time`. Returns true if there is no
+  // more work left that could be done in idle time.
+  V8_EXPORT_PRIVATE bool IdleNotification(base::TimeDelta idle_time);
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -614,6 +621,12 @@ class Heap final {
   V8_EXPORT_PRIVATE uint64_t external_memory_soft_limit();
   uint64_t UpdateExternalMemory(int64_t delta);
 
+  // Returns the pool for array buffer backing stores if --array-buffer-pooling
+  // is enabled.
+  std::shared_ptr<BackingStorePool> backing_store_pool() const {
+    return backing_store_pool_;
+  }
+
   V8_EXPORT_PRIVATE size_t YoungArrayBufferBytes();
   V8_EXPORT_PRIVATE size_t OldArrayBufferBytes();
 
@@ -671,6 +684,10 @@ class Heap final {
                      v8::CppHeap* cpp_heap);
   void ConfigureHeapDefault();
 
+  // Makes the heap participate in a process-wide old generation budget. Must
+  // be called before SetUp().
+  void SetHeapBudget(std::shared_ptr<v8::HeapBudget> budget);
+
   // Prepares the heap, setting up for deserialization.
   void SetUp(LocalHeap* main_thread_local_heap);
 
@@ -1264,6 +1281,10 @@ class Heap final {
   // Returns the amount of executable memory currently committed for the heap.
   size_t CommittedMemoryExecutable();
 
+  // Returns the amount of memory of the code range and large pages that the OS
+  // was advised to back with huge pages (--huge-pages).
+  size_t HugePageMemory();
+
   // Returns the amount of physical memory currently committed for the heap.
   size_t CommittedPhysicalMemory();
 
@@ -2379,6 +2400,10 @@ class Heap final {
   ResizeNewSpaceMode resize_new_space_mode_ = ResizeNewSpaceMode::kNone;
 
   std::unique_ptr<MemoryBalancer> mb_;
+  std::shared_ptr<BackingStorePool> backing_store_pool_;
+  // Process-wide budget this heap participates in, if any. Implies using the
+  // memory balancer.
+  std::shared_ptr<v8::HeapBudget> heap_budget_;
 
   // A sentinel meaning that the embedder isn't currently loading resources.
   static constexpr double kLoadTimeNotLoading = -1.0;
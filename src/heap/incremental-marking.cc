@@ -844,6 +844,11 @@ void IncrementalMarking::AdvanceAndFinalizeIfNecessary() {
   }
 }
 
+void IncrementalMarking::AdvanceInIdleTime(v8::base::TimeDelta idle_time) {
+  DCHECK(IsMajorMarking());
+  Step(idle_time, SIZE_MAX, StepOrigin::kTask);
+}
+
 void IncrementalMarking::AdvanceForTesting(v8::base::TimeDelta max_duration,
                                            size_t max_bytes_to_mark) {
   Step(max_duration, max_bytes_to_mark, StepOrigin::kV8);
@@ -117,6 +117,10 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   // marking completes.
   void AdvanceOnAllocation();
 
+  // Performs incremental marking step that is only bounded by `idle_time`.
+  // Leaves finalization to the caller.
+  void AdvanceInIdleTime(v8::base::TimeDelta idle_time);
+
   bool IsAheadOfSchedule() const;
 
   bool IsCompacting() { return IsMajorMarking() && is_compacting_; }
@@ -5,8 +5,11 @@
 #ifndef V8_HEAP_LARGE_PAGE_METADATA_INL_H_
 #define V8_HEAP_LARGE_PAGE_METADATA_INL_H_
 
+#include <algorithm>
+
 #include "src/heap/large-page-metadata.h"
 #include "src/heap/mutable-page-metadata-inl.h"
+#include "src/objects/fixed-array-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -16,6 +19,27 @@ LargePageMetadata* LargePageMetadata::FromHeapObject(Tagged<HeapObject> o) {
   return cast(MutablePageMetadata::FromHeapObject(o));
 }
 
+template <typename Callback>
+void LargePageMetadata::IterateCardMarkedSlots(Callback callback) {
+  CardTable* card_table = this->card_table();
+  DCHECK_NOT_NULL(card_table);
+  Tagged<FixedArray> array = Cast<FixedArray>(GetObject());
+  const Address chunk_start = ChunkAddress();
+  const Address slots_start = array->RawFieldOfFirstElement().address();
+  const Address slots_end =
+      array->RawFieldOfElementAt(array->length()).address();
+  card_table->Iterate([chunk_start, slots_start, slots_end, &callback](
+                          size_t card_start, size_t card_end) {
+    const MaybeObjectSlot end(std::min(chunk_start + card_end, slots_end));
+    SlotCallbackResult card_result = REMOVE_SLOT;
+    for (MaybeObjectSlot slot(std::max(chunk_start + card_start, slots_start));
+         slot < end; ++slot) {
+      if (callback(slot) == KEEP_SLOT) card_result = KEEP_SLOT;
+    }
+    return card_result;
+  });
+}
+
 }  // namespace internal
 }  // namespace v8
 
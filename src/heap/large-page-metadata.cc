@@ -46,6 +46,7 @@ void LargePageMetadata::ClearOutOfLiveRangeSlots(Address free_start) {
 
   DCHECK_NULL(slot_set<OLD_TO_NEW_BACKGROUND>());
   DCHECK_NULL(typed_slot_set<OLD_TO_NEW_BACKGROUND>());
+  DCHECK_NULL(card_table());
 
   DCHECK_NULL(slot_set<OLD_TO_OLD>());
   DCHECK_NULL(typed_slot_set<OLD_TO_OLD>());
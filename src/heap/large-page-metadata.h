@@ -47,8 +47,17 @@ class LargePageMetadata : public MutablePageMetadata {
 
   void ClearOutOfLiveRangeSlots(Address free_start);
 
+  // Invokes `callback` on every slot of the page's fixed array that is covered
+  // by a dirty card (see card_table()). Cards for which the callback returns
+  // REMOVE_SLOT for all of their slots are cleaned.
+  template <typename Callback>
+  inline void IterateCardMarkedSlots(Callback callback);
+
  private:
   friend class MemoryAllocator;
+
+  // Bytes of this page that the OS was advised to back with huge pages.
+  size_t huge_page_size_ = 0;
 };
 
 }  // namespace internal
@@ -52,6 +52,16 @@ MainAllocator::MainAllocator(LocalHeap* local_heap, SpaceWithLinearArea* space,
     allocation_counter_.emplace();
     linear_area_original_data_.emplace();
   }
+  if (is_new_generation == IsNewGeneration::kNo) {
+    // All threads of all client isolates refill their LABs from the same
+    // shared space, so main threads adapt their LAB size there as well.
+    const bool background = !local_heap_->is_main_thread();
+    if ((background && v8_flags.adaptive_background_lab_size) ||
+        (space->identity() == SHARED_SPACE &&
+         v8_flags.adaptive_shared_lab_size)) {
+      adaptive_lab_size_.emplace();
+    }
+  }
 }
 
 MainAllocator::MainAllocator(Heap* heap, SpaceWithLinearArea* space, InGCTag)
@@ -839,10 +849,36 @@ bool PagedSpaceAllocatorPolicy::TryAllocationFromFreeList(
             size_in_bytes);
 
   size_t new_node_size = 0;
-  Tagged<FreeSpace> new_node =
-      space_->free_list_->Allocate(size_in_bytes, &new_node_size, origin);
+  Tagged<FreeSpace> new_node;
+  std::optional<AdaptiveLabSize>& adaptive_lab_size =
+      allocator_->adaptive_lab_size();
+  bool fragmented = false;
+  if (adaptive_lab_size) {
+    // Ask for a larger node first to make fewer trips to the free list.
+    adaptive_lab_size->NotifyRefill(base::TimeTicks::Now());
+    const size_t lab_size = adaptive_lab_size->size();
+    if (lab_size > size_in_bytes) {
+      new_node = space_->free_list_->Allocate(lab_size, &new_node_size, origin);
+      if (new_node.is_null()) {
+        adaptive_lab_size->NotifyFragmented();
+        fragmented = true;
+      }
+    }
+  }
+  if (new_node.is_null()) {
+    new_node =
+        space_->free_list_->Allocate(size_in_bytes, &new_node_size, origin);
+  }
   if (new_node.is_null()) return false;
   DCHECK_GE(new_node_size, size_in_bytes);
+  if (adaptive_lab_size) {
+    GCTracer* tracer = allocator_->isolate_heap()->tracer();
+    if (allocator_->identity() == SHARED_SPACE) {
+      tracer->AddSharedLabRefill(new_node_size, fragmented);
+    } else {
+      tracer->AddBackgroundLabRefill(new_node_size, fragmented);
+    }
+  }
 
   // The old-space-step might have finished sweeping and restarted marking.
   // Verify that it did not turn the page of the new node into an evacuation
@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "src/common/globals.h"
+#include "src/heap/adaptive-lab-size.h"
 #include "src/heap/allocation-observer.h"
 #include "src/heap/allocation-result.h"
 #include "src/heap/gc-tracer.h"
@@ -337,6 +338,11 @@ class MainAllocator {
 
   bool supports_extending_lab() const { return supports_extending_lab_; }
 
+  // Only set for background threads with --adaptive-background-lab-size.
+  std::optional<AdaptiveLabSize>& adaptive_lab_size() {
+    return adaptive_lab_size_;
+  }
+
   V8_EXPORT_PRIVATE bool is_main_thread() const;
 
   LocalHeap* local_heap() const { return local_heap_; }
@@ -359,6 +365,7 @@ class MainAllocator {
   // This memory is used if no LinearAllocationArea& is passed in as argument.
   LinearAllocationArea owned_allocation_info_;
   std::optional<LinearAreaOriginalData> linear_area_original_data_;
+  std::optional<AdaptiveLabSize> adaptive_lab_size_;
   std::unique_ptr<AllocatorPolicy> allocator_policy_;
 
   const bool supports_extending_lab_;
@@ -42,6 +42,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/index-generator.h"
+#include "src/heap/large-page-metadata-inl.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/live-object-range-inl.h"
 #include "src/heap/mark-compact-inl.h"
@@ -391,6 +392,11 @@ base::EnumSet<CodeFlushMode> GetCodeFlushMode(Isolate* isolate) {
     code_flush_mode.Add(CodeFlushMode::kStressFlushCode);
   }
 
+  if (v8_flags.flush_code_on_memory_pressure && !code_flush_mode.empty() &&
+      isolate->heap()->HighMemoryPressure()) {
+    code_flush_mode.Add(CodeFlushMode::kAggressiveFlushCode);
+  }
+
   return code_flush_mode;
 }
 
@@ -2241,6 +2247,108 @@ void MarkCompactCollector::MarkTransitiveClosureLinear() {
   local_weak_objects()->next_ephemerons_local.Publish();
 }
 
+void MarkCompactCollector::MarkTransitiveClosureWithEphemeronIndex() {
+  TRACE_GC(heap_->tracer(),
+           GCTracer::Scope::MC_MARK_WEAK_CLOSURE_EPHEMERON_LINEAR);
+  DCHECK_NULL(ephemeron_index_);
+  bool paused_parallel_marking = false;
+
+  while (true) {
+    PerformWrapperTracing();
+
+    // The index may only be modified while no other marking thread queries it.
+    // Pausing publishes all ephemerons and objects of the marking threads.
+    // Marking is resumed when draining the marking worklist below.
+    if (parallel_marking_ && heap_->concurrent_marking()->Pause()) {
+      paused_parallel_marking = true;
+    }
+    if (!ephemeron_index_) {
+      ephemeron_index_ = std::make_unique<EphemeronIndex>();
+    }
+    const bool values_marked = UpdateEphemeronIndex();
+    if (!values_marked && local_marking_worklists_->IsEmpty() &&
+        IsCppHeapMarkingFinished(heap_, local_marking_worklists_.get())) {
+      break;
+    }
+
+    {
+      TRACE_GC(heap_->tracer(),
+               GCTracer::Scope::MC_MARK_WEAK_CLOSURE_EPHEMERON_MARKING);
+      // Drain the marking worklist and mark values of ephemerons whose keys
+      // are discovered. Ephemerons of newly discovered tables are pushed into
+      // discovered_ephemerons and added to the index in the next iteration.
+      ProcessMarkingWorklist(
+          v8::base::TimeDelta::Max(), SIZE_MAX,
+          MarkingWorklistProcessingMode::kProcessEphemeronIndex);
+    }
+  }
+
+  // Keys might still be discovered later on, e.g. from the conservative stack.
+  // Return the remaining ephemerons to the regular worklist.
+  ephemeron_index_->Iterate(
+      [this](Tagged<HeapObject> key, Tagged<HeapObject> value) {
+        if (non_atomic_marking_state_->IsUnmarked(value)) {
+          local_weak_objects()->next_ephemerons_local.Push(
+              Ephemeron{key, value});
+        }
+      });
+  ephemeron_index_.reset();
+
+  if (paused_parallel_marking) {
+    // Resume marking so that the marking job is properly joined when finishing
+    // parallel marking.
+    heap_->concurrent_marking()->RescheduleJobIfNeeded(
+        GarbageCollector::MARK_COMPACTOR, TaskPriority::kUserBlocking);
+  }
+
+  CHECK(local_marking_worklists_->IsEmpty());
+  CHECK(weak_objects_.current_ephemerons.IsEmpty());
+  CHECK(weak_objects_.discovered_ephemerons.IsEmpty());
+
+  // Flush local ephemerons for main task to global pool.
+  local_weak_objects()->ephemeron_hash_tables_local.Publish();
+  local_weak_objects()->next_ephemerons_local.Publish();
+}
+
+bool MarkCompactCollector::UpdateEphemeronIndex() {
+  DCHECK(heap_->concurrent_marking()->IsStopped());
+  local_weak_objects()->next_ephemerons_local.Publish();
+  local_weak_objects()->discovered_ephemerons_local.Publish();
+  weak_objects_.current_ephemerons.Merge(weak_objects_.next_ephemerons);
+  weak_objects_.current_ephemerons.Merge(weak_objects_.discovered_ephemerons);
+
+  bool values_marked = false;
+  Ephemeron ephemeron;
+  while (local_weak_objects()->current_ephemerons_local.Pop(&ephemeron)) {
+    DCHECK(!HeapLayout::InWritableSharedSpace(ephemeron.key));
+    const auto target_worklist =
+        MarkingHelper::ShouldMarkObject(heap_, ephemeron.value);
+    if (!target_worklist) continue;
+    if (MarkingHelper::IsMarkedOrAlwaysLive(heap_, marking_state_,
+                                            ephemeron.key)) {
+      // The key was marked before the ephemeron was added to the index, so
+      // the index will not find it anymore.
+      if (MarkingHelper::TryMarkAndPush(heap_, local_marking_worklists_.get(),
+                                        marking_state_, target_worklist.value(),
+                                        ephemeron.value)) {
+        values_marked = true;
+      }
+    } else if (marking_state_->IsUnmarked(ephemeron.value)) {
+      ephemeron_index_->Add(ephemeron.key, ephemeron.value);
+    }
+  }
+  return values_marked;
+}
+
+void MarkCompactCollector::ProcessEphemeronIndex(Tagged<HeapObject> key) {
+  ephemeron_index_->ForEachValue(key, [this, key](Tagged<HeapObject> value) {
+    const auto target_worklist = MarkingHelper::ShouldMarkObject(heap_, value);
+    if (target_worklist) {
+      MarkObject(key, value, target_worklist.value());
+    }
+  });
+}
+
 void MarkCompactCollector::PerformWrapperTracing() {
   auto* cpp_heap = CppHeap::From(heap_->cpp_heap_);
   if (!cpp_heap) return;
@@ -2283,6 +2391,9 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
     if (mode == MarkCompactCollector::MarkingWorklistProcessingMode::
                     kTrackNewlyDiscoveredObjects) {
       AddNewlyDiscovered(object);
+    } else if (mode == MarkCompactCollector::MarkingWorklistProcessingMode::
+                           kProcessEphemeronIndex) {
+      ProcessEphemeronIndex(object);
     }
     Tagged<Map> map = object->map(cage_base);
     if (is_per_context_mode) {
@@ -2365,9 +2476,14 @@ void MarkCompactCollector::MarkTransitiveClosure() {
 
   if (!MarkTransitiveClosureUntilFixpoint()) {
     // Fixpoint iteration needed too many iterations and was cancelled. Use the
-    // guaranteed linear algorithm. But only in the final single-thread marking
-    // phase.
-    if (!parallel_marking_) MarkTransitiveClosureLinear();
+    // guaranteed linear algorithm. The ephemeron index supports parallel
+    // marking whereas MarkTransitiveClosureLinear() only runs in the final
+    // single-thread marking phase.
+    if (v8_flags.parallel_ephemeron_index) {
+      MarkTransitiveClosureWithEphemeronIndex();
+    } else if (!parallel_marking_) {
+      MarkTransitiveClosureLinear();
+    }
   }
 }
 
@@ -2653,11 +2769,13 @@ class ClearStringTableJobItem final : public ParallelClearingJob::ClearingItem {
       // string table.  Cannot use string_table() here because the string
       // table is marked.
       StringTable* string_table = isolate_->string_table();
-      InternalizedStringTableCleaner internalized_visitor(isolate_->heap());
       string_table->DropOldData();
-      string_table->IterateElements(&internalized_visitor);
-      string_table->NotifyElementsRemoved(
-          internalized_visitor.PointersRemoved());
+      for (int shard = 0; shard < string_table->NumberOfShards(); shard++) {
+        InternalizedStringTableCleaner internalized_visitor(isolate_->heap());
+        string_table->IterateElements(shard, &internalized_visitor);
+        string_table->NotifyElementsRemoved(
+            shard, internalized_visitor.PointersRemoved());
+      }
     }
   }
 
@@ -5241,6 +5359,7 @@ class RememberedSetUpdatingItem : public UpdatingItem {
   void UpdateUntypedPointers() {
     UpdateUntypedOldToNewPointers<OLD_TO_NEW>();
     UpdateUntypedOldToNewPointers<OLD_TO_NEW_BACKGROUND>();
+    UpdateCardMarkedOldToNewPointers();
     UpdateUntypedOldToOldPointers();
     UpdateUntypedTrustedToCodePointers();
     UpdateUntypedTrustedToTrustedPointers();
@@ -5275,6 +5394,23 @@ class RememberedSetUpdatingItem : public UpdatingItem {
     chunk_->ReleaseSlotSet(old_to_new_type);
   }
 
+  void UpdateCardMarkedOldToNewPointers() {
+    if (!chunk_->card_table()) return;
+
+    const PtrComprCageBase cage_base = heap_->isolate();
+    LargePageMetadata::cast(chunk_)->IterateCardMarkedSlots(
+        [this, cage_base](MaybeObjectSlot slot) {
+          CheckAndUpdateOldToNewSlot(slot, cage_base);
+          if (record_old_to_shared_slots_) {
+            CheckSlotForOldToSharedUntyped(cage_base, chunk_, slot);
+          }
+          return KEEP_SLOT;
+        });
+
+    // Full GCs will empty new space, so no card is dirty anymore.
+    chunk_->ReleaseCardTable();
+  }
+
   void UpdateUntypedOldToOldPointers() {
     if (!chunk_->slot_set<OLD_TO_OLD, AccessMode::NON_ATOMIC>()) {
       return;
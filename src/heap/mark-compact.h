@@ -9,6 +9,7 @@
 
 #include "include/v8-internal.h"
 #include "src/common/globals.h"
+#include "src/heap/ephemeron-index.h"
 #include "src/heap/marking-state.h"
 #include "src/heap/marking-visitor.h"
 #include "src/heap/marking-worklist.h"
@@ -66,7 +67,8 @@ class MarkCompactCollector final {
 
   enum class MarkingWorklistProcessingMode {
     kDefault,
-    kTrackNewlyDiscoveredObjects
+    kTrackNewlyDiscoveredObjects,
+    kProcessEphemeronIndex
   };
 
   enum class CallOrigin {
@@ -169,6 +171,14 @@ class MarkCompactCollector final {
   WeakObjects* weak_objects() { return &weak_objects_; }
   WeakObjects::Local* local_weak_objects() { return local_weak_objects_.get(); }
 
+  // Returns the ephemeron index if it should be queried by marking threads for
+  // each visited object, or nullptr otherwise.
+  const EphemeronIndex* ephemeron_index() const {
+    return ephemeron_index_ && !ephemeron_index_->IsEmpty()
+               ? ephemeron_index_.get()
+               : nullptr;
+  }
+
   void AddNewlyDiscovered(Tagged<HeapObject> object) {
     if (ephemeron_marking_.newly_discovered_overflowed) return;
 
@@ -263,6 +273,21 @@ class MarkCompactCollector final {
   // fixpoint iteration doesn't finish within a few iterations.
   void MarkTransitiveClosureLinear();
 
+  // Marks the transitive closure applying ephemeron semantics and invoking
+  // embedder tracing with an index of the pending ephemerons keyed by their
+  // unmarked keys. Linear in the number of ephemerons and, unlike
+  // MarkTransitiveClosureLinear(), supports parallel marking.
+  void MarkTransitiveClosureWithEphemeronIndex();
+
+  // Moves all pending ephemerons into the ephemeron index or marks their values
+  // if their keys are marked. May only be called while no other marking thread
+  // is running. Returns true if any value was marked.
+  bool UpdateEphemeronIndex();
+
+  // Marks the values that are kept alive by `key` according to the ephemeron
+  // index.
+  void ProcessEphemeronIndex(Tagged<HeapObject> key);
+
   // Drains ephemeron and marking worklists. Single iteration of the
   // fixpoint iteration.
   bool ProcessEphemerons();
@@ -422,6 +447,9 @@ class MarkCompactCollector final {
 
   WeakObjects weak_objects_;
   EphemeronMarking ephemeron_marking_;
+  // Only non-null while the ephemeron fixpoint is computed with
+  // MarkTransitiveClosureWithEphemeronIndex().
+  std::unique_ptr<EphemeronIndex> ephemeron_index_;
 
   std::unique_ptr<MainMarkingVisitor> marking_visitor_;
   std::unique_ptr<WeakObjects::Local> local_weak_objects_;
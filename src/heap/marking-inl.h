@@ -262,6 +262,33 @@ inline Address MarkingBitmap::FindPreviousValidObject(const PageMetadata* page,
                                 index_of_last_leading_one);
 }
 
+// static
+inline Address MarkingBitmap::FindPreviousObjectStart(
+    const MarkingBitmap* bitmap, const PageMetadata* page,
+    Address maybe_inner_ptr) {
+  DCHECK(page->Contains(maybe_inner_ptr));
+  const MarkBit::CellType* cells = bitmap->cells();
+  const auto start_cell_index = MarkingBitmap::IndexToCell(
+      MarkingBitmap::AddressToIndex(page->area_start()));
+  const auto index = MarkingBitmap::AddressToIndex(maybe_inner_ptr);
+  auto cell_index = MarkingBitmap::IndexToCell(index);
+  const auto index_in_cell = MarkingBitmap::IndexInCell(index);
+  auto cell = cells[cell_index];
+
+  // Clear the bits corresponding to higher addresses in the cell.
+  cell &= ((~static_cast<MarkBit::CellType>(0)) >>
+           (MarkingBitmap::kBitsPerCell - index_in_cell - 1));
+
+  while (cell == 0 && cell_index > start_cell_index) cell = cells[--cell_index];
+  if (cell == 0) return page->area_start();
+
+  const auto index_of_highest_one =
+      MarkingBitmap::kBitsPerCell - 1 - base::bits::CountLeadingZeros(cell);
+  return page->ChunkAddress() +
+         MarkingBitmap::IndexToAddressOffset(
+             cell_index * MarkingBitmap::kBitsPerCell + index_of_highest_one);
+}
+
 // static
 MarkBit MarkBit::From(Address address) {
   return MarkingBitmap::MarkBitFromAddress(address);
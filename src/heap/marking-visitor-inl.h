@@ -433,7 +433,8 @@ bool MarkingVisitorBase<ConcreteVisitor>::HasBytecodeArrayForFlushing(
   if (IsFlushingDisabled(code_flush_mode_)) return false;
 
   // TODO(rmcilroy): Enable bytecode flushing for resumable functions.
-  if (IsResumableFunction(sfi->kind()) || !sfi->allows_lazy_compilation()) {
+  if (IsResumableFunction(sfi->kind()) || !sfi->allows_lazy_compilation() ||
+      sfi->bytecode_flushing_disabled()) {
     return false;
   }
 
@@ -466,6 +467,12 @@ bool MarkingVisitorBase<ConcreteVisitor>::ShouldFlushCode(
 template <typename ConcreteVisitor>
 bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
     Tagged<SharedFunctionInfo> sfi) const {
+  // Under memory pressure, code that was not executed since the previous full
+  // GC is flushed. Ages were already incremented for the current GC.
+  if (IsAggressiveFlushingEnabled(code_flush_mode_) &&
+      !v8_flags.flush_code_based_on_tab_visibility && sfi->age() > 1) {
+    return true;
+  }
   if (v8_flags.flush_code_based_on_time) {
     return sfi->age() >= v8_flags.bytecode_old_time;
   } else if (v8_flags.flush_code_based_on_tab_visibility) {
@@ -550,7 +557,15 @@ size_t MarkingVisitorBase<ConcreteVisitor>::VisitFixedArrayWithProgressTracker(
     MarkingProgressTracker& progress_tracker) {
   static_assert(kMaxRegularHeapObjectSize % kTaggedSize == 0);
   static constexpr size_t kMaxQueuedWorklistItems = 8u;
+  // Stealable chunks are cheap to hand out, so queue enough of them for all
+  // markers to participate.
+  static constexpr size_t kMaxQueuedStealableItems = 64u;
+  static_assert(kMaxQueuedStealableItems <= MarkingStealingDeque::kCapacity);
   DCHECK(concrete_visitor()->marking_state()->IsMarked(object));
+  const bool use_work_stealing =
+      local_marking_worklists_->IsUsingWorkStealing();
+  const size_t max_queued_items =
+      use_work_stealing ? kMaxQueuedStealableItems : kMaxQueuedWorklistItems;
 
   const size_t size = FixedArray::BodyDescriptor::SizeOf(map, object);
   const size_t chunk = progress_tracker.GetNextChunkToMark();
@@ -565,10 +580,14 @@ size_t MarkingVisitorBase<ConcreteVisitor>::VisitFixedArrayWithProgressTracker(
             MarkingHelper::ShouldMarkObject(heap_, object)) {
       DCHECK_EQ(target_worklist.value(),
                 MarkingHelper::WorklistTarget::kRegular);
-      const size_t scheduled_chunks =
-          std::min(total_chunks, kMaxQueuedWorklistItems);
+      const size_t scheduled_chunks = std::min(total_chunks, max_queued_items);
       DCHECK_GT(scheduled_chunks, 0);
       for (size_t i = 1; i < scheduled_chunks; ++i) {
+        if (use_work_stealing) {
+          // Idle markers steal chunks directly from this marker's deque.
+          local_marking_worklists_->PushStealable(object);
+          continue;
+        }
         local_marking_worklists_->Push(object);
         // Publish each chunk into a new segment so that other markers would be
         // able to steal work. This is probabilistic (a single marker can be
@@ -586,11 +605,15 @@ size_t MarkingVisitorBase<ConcreteVisitor>::VisitFixedArrayWithProgressTracker(
   }
 
   // Repost the task if needed.
-  if (chunk + kMaxQueuedWorklistItems < total_chunks) {
+  if (chunk + max_queued_items < total_chunks) {
     if (const auto target_worklist =
             MarkingHelper::ShouldMarkObject(heap_, object)) {
-      local_marking_worklists_->Push(object);
-      local_marking_worklists_->ShareWork();
+      if (use_work_stealing) {
+        local_marking_worklists_->PushStealable(object);
+      } else {
+        local_marking_worklists_->Push(object);
+        local_marking_worklists_->ShareWork();
+      }
     }
   }
 
@@ -28,8 +28,15 @@ void MarkingWorklists::Local::Push(Tagged<HeapObject> object) {
   active_->Push(object);
 }
 
+void MarkingWorklists::Local::PushStealable(Tagged<HeapObject> object) {
+  if (stealing_deque_ && stealing_deque_->Push(object.address())) return;
+  active_->Push(object);
+  ShareWork();
+}
+
 bool MarkingWorklists::Local::Pop(Tagged<HeapObject>* object) {
   if (active_->Pop(object)) return true;
+  if (V8_UNLIKELY(stealing_deque_) && PopStealable(object)) return true;
   if (!is_per_context_mode_) return false;
   // The active worklist is empty. Find any other non-empty worklist and
   // switch the active worklist to it.
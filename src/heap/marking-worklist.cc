@@ -10,6 +10,7 @@
 
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/cppgc-js/cpp-marking-state.h"
+#include "src/flags/flags.h"
 #include "src/heap/marking-worklist-inl.h"
 #include "src/objects/heap-object-inl.h"
 #include "src/objects/heap-object.h"
@@ -21,7 +22,25 @@
 namespace v8 {
 namespace internal {
 
+MarkingWorklists::~MarkingWorklists() {
+  const size_t num_deques = num_stealing_deques_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < num_deques; ++i) {
+    MarkingStealingDeque* deque =
+        stealing_deques_[i].load(std::memory_order_relaxed);
+    DCHECK(deque->IsEmpty());
+    delete deque;
+  }
+}
+
 void MarkingWorklists::Clear() {
+  const size_t num_deques = num_stealing_deques_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < num_deques; ++i) {
+    MarkingStealingDeque* deque =
+        stealing_deques_[i].load(std::memory_order_relaxed);
+    Address entry;
+    while (deque->Steal(&entry)) {
+    }
+  }
   shared_.Clear();
   on_hold_.Clear();
   other_.Clear();
@@ -50,6 +69,54 @@ void MarkingWorklists::CreateContextWorklists(
 
 void MarkingWorklists::ReleaseContextWorklists() { context_worklists_.clear(); }
 
+MarkingStealingDeque* MarkingWorklists::ClaimStealingDeque() {
+  base::MutexGuard guard(&stealing_deques_mutex_);
+  if (!free_stealing_deques_.empty()) {
+    MarkingStealingDeque* deque = free_stealing_deques_.back();
+    free_stealing_deques_.pop_back();
+    return deque;
+  }
+  const size_t index = num_stealing_deques_.load(std::memory_order_relaxed);
+  if (index == kMaxStealingDeques) return nullptr;
+  MarkingStealingDeque* deque = new MarkingStealingDeque();
+  stealing_deques_[index].store(deque, std::memory_order_relaxed);
+  // Publishes the deque to thieves.
+  num_stealing_deques_.store(index + 1, std::memory_order_release);
+  return deque;
+}
+
+void MarkingWorklists::ReleaseStealingDeque(MarkingStealingDeque* deque) {
+  DCHECK(deque->IsEmpty());
+  base::MutexGuard guard(&stealing_deques_mutex_);
+  free_stealing_deques_.push_back(deque);
+}
+
+bool MarkingWorklists::StealFromAnyDeque(const MarkingStealingDeque* self,
+                                         uint32_t random_seed,
+                                         Address* entry) {
+  const size_t num_deques = num_stealing_deques_.load(std::memory_order_acquire);
+  if (num_deques == 0) return false;
+  // Start at a random victim so that thieves don't all hammer the same deque.
+  const size_t start = random_seed % num_deques;
+  for (size_t i = 0; i < num_deques; ++i) {
+    MarkingStealingDeque* victim =
+        stealing_deques_[(start + i) % num_deques].load(
+            std::memory_order_relaxed);
+    if (victim == self || victim->IsEmpty()) continue;
+    if (victim->Steal(entry)) return true;
+  }
+  return false;
+}
+
+size_t MarkingWorklists::StealableSize() const {
+  const size_t num_deques = num_stealing_deques_.load(std::memory_order_acquire);
+  size_t size = 0;
+  for (size_t i = 0; i < num_deques; ++i) {
+    size += stealing_deques_[i].load(std::memory_order_relaxed)->Size();
+  }
+  return size;
+}
+
 void MarkingWorklists::PrintWorklist(const char* worklist_name,
                                      MarkingWorklist* worklist) {
 #ifdef DEBUG
@@ -90,7 +157,13 @@ MarkingWorklists::Local::Local(
       active_context_(kSharedContext),
       is_per_context_mode_(!global->context_worklists().empty()),
       other_(*global->other()),
-      cpp_marking_state_(std::move(cpp_marking_state)) {
+      cpp_marking_state_(std::move(cpp_marking_state)),
+      global_(global) {
+  if (v8_flags.marking_work_stealing) {
+    stealing_deque_ = global_->ClaimStealingDeque();
+    steal_seed_ = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(this) >>
+                                        kSystemPointerSizeLog2);
+  }
   if (is_per_context_mode_) {
     context_worklists_.reserve(global->context_worklists().size());
     int index = 0;
@@ -102,7 +175,17 @@ MarkingWorklists::Local::Local(
   }
 }
 
+MarkingWorklists::Local::~Local() {
+  if (stealing_deque_) {
+    global_->ReleaseStealingDeque(stealing_deque_);
+  }
+}
+
 void MarkingWorklists::Local::Publish() {
+  // Entries in the stealing deque are only visible while this marker is
+  // active. Move them to the shared worklist so that global emptiness checks
+  // keep working as before.
+  FlushStealingDeque();
   shared_.Publish();
   on_hold_.Publish();
   other_.Publish();
@@ -122,6 +205,9 @@ bool MarkingWorklists::Local::IsEmpty() {
       !active_->IsGlobalEmpty() || !on_hold_.IsGlobalEmpty()) {
     return false;
   }
+  if (stealing_deque_ && !stealing_deque_->IsEmpty()) {
+    return false;
+  }
   if (!is_per_context_mode_) {
     return true;
   }
@@ -188,6 +274,30 @@ bool MarkingWorklists::Local::PopContext(Tagged<HeapObject>* object) {
   return false;
 }
 
+bool MarkingWorklists::Local::PopStealable(Tagged<HeapObject>* object) {
+  DCHECK_NOT_NULL(stealing_deque_);
+  Address entry;
+  if (!stealing_deque_->Pop(&entry)) {
+    // Xorshift32 to pick the next victim.
+    steal_seed_ ^= steal_seed_ << 13;
+    steal_seed_ ^= steal_seed_ >> 17;
+    steal_seed_ ^= steal_seed_ << 5;
+    if (!global_->StealFromAnyDeque(stealing_deque_, steal_seed_, &entry)) {
+      return false;
+    }
+  }
+  *object = HeapObject::FromAddress(entry);
+  return true;
+}
+
+void MarkingWorklists::Local::FlushStealingDeque() {
+  if (!stealing_deque_) return;
+  Address entry;
+  while (stealing_deque_->Pop(&entry)) {
+    shared_.Push(HeapObject::FromAddress(entry));
+  }
+}
+
 Address MarkingWorklists::Local::SwitchToContextSlow(Address context) {
   auto maybe_index = worklist_by_context_.Get(context);
   if (V8_UNLIKELY(maybe_index.IsNothing())) {
@@ -5,11 +5,15 @@
 #ifndef V8_HEAP_MARKING_WORKLIST_H_
 #define V8_HEAP_MARKING_WORKLIST_H_
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
+#include "src/base/platform/mutex.h"
+#include "src/heap/base/work-stealing-deque.h"
 #include "src/heap/base/worklist.h"
 #include "src/heap/cppgc-js/cpp-marking-state.h"
 #include "src/objects/heap-object.h"
@@ -26,6 +30,11 @@ const int kMainThreadTask = 0;
 
 using MarkingWorklist = ::heap::base::Worklist<Tagged<HeapObject>, 64>;
 
+// Per-task deque used with --marking-work-stealing. Entries are addresses of
+// large objects that are scanned in chunks (see MarkingProgressTracker). Large
+// objects never move, so entries don't need to be updated on scavenges.
+using MarkingStealingDeque = ::heap::base::WorkStealingDeque<Address, 256>;
+
 // We piggyback on marking to compute object sizes per native context that is
 // needed for the new memory measurement API. The algorithm works as follows:
 // 1) At the start of marking we create a marking worklist for each context.
@@ -75,10 +84,15 @@ class V8_EXPORT_PRIVATE MarkingWorklists final {
   static constexpr Address kSharedContext = 0;
   static constexpr Address kOtherContext = 8;
 
+  // Maximum number of deques that can be handed out to concurrently active
+  // markers with --marking-work-stealing. Further markers fall back to the
+  // shared worklist.
+  static constexpr size_t kMaxStealingDeques = 128;
+
   MarkingWorklists() = default;
 
   // Worklists implicitly check for emptiness on destruction.
-  ~MarkingWorklists() = default;
+  ~MarkingWorklists();
 
   // Calls the specified callback on each element of the deques and replaces
   // the element with the result of the callback. If the callback returns
@@ -107,6 +121,20 @@ class V8_EXPORT_PRIVATE MarkingWorklists final {
   void Clear();
   void Print();
 
+  // Hands out a work-stealing deque for a marker. Returns nullptr if all
+  // deques are in use. Deques are never freed before the worklists are
+  // destroyed, so thieves may access released deques safely.
+  MarkingStealingDeque* ClaimStealingDeque();
+  void ReleaseStealingDeque(MarkingStealingDeque* deque);
+
+  // Tries to steal an entry from any deque but `self`, starting at a victim
+  // selected by `random_seed`.
+  bool StealFromAnyDeque(const MarkingStealingDeque* self, uint32_t random_seed,
+                         Address* entry);
+
+  // Returns the approximate number of stealable entries across all deques.
+  size_t StealableSize() const;
+
  private:
   // Prints the stats about the global pool of the worklist.
   void PrintWorklist(const char* worklist_name, MarkingWorklist* worklist);
@@ -126,6 +154,15 @@ class V8_EXPORT_PRIVATE MarkingWorklists final {
   // Worklist used for objects that are attributed to contexts that are
   // not being measured.
   MarkingWorklist other_;
+
+  // Work-stealing deques. Slots [0, num_stealing_deques_) are initialized and
+  // may be read concurrently by thieves.
+  std::array<std::atomic<MarkingStealingDeque*>, kMaxStealingDeques>
+      stealing_deques_{};
+  std::atomic<size_t> num_stealing_deques_{0};
+  // Guards creation and reuse of the deques.
+  base::Mutex stealing_deques_mutex_;
+  std::vector<MarkingStealingDeque*> free_stealing_deques_;
 };
 
 // A thread-local view of the marking worklists. It owns all local marking
@@ -147,11 +184,18 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local final {
       std::unique_ptr<CppMarkingState> cpp_marking_state = kNoCppMarkingState);
 
   // Local worklists implicitly check for emptiness on destruction.
-  ~Local() = default;
+  ~Local();
 
   inline void Push(Tagged<HeapObject> object);
   inline bool Pop(Tagged<HeapObject>* object);
 
+  // Pushes a chunk of a large object that should be processed by any idle
+  // marker. With --marking-work-stealing the entry is pushed onto this
+  // marker's deque where it can be stolen; otherwise it is published on the
+  // active worklist.
+  inline void PushStealable(Tagged<HeapObject> object);
+  bool IsUsingWorkStealing() const { return stealing_deque_ != nullptr; }
+
   inline void PushOnHold(Tagged<HeapObject> object);
   inline bool PopOnHold(Tagged<HeapObject>* object);
 
@@ -188,6 +232,8 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local final {
 
   bool PopContext(Tagged<HeapObject>* object);
   Address SwitchToContextSlow(Address context);
+  bool PopStealable(Tagged<HeapObject>* object);
+  void FlushStealingDeque();
 
   // Points to either `shared_`, `other_` or to a per-context worklist.
   MarkingWorklist::Local* active_;
@@ -200,6 +246,10 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local final {
   AddressToIndexHashMap worklist_by_context_;
   MarkingWorklist::Local other_;
   std::unique_ptr<CppMarkingState> cpp_marking_state_;
+
+  MarkingWorklists* const global_;
+  MarkingStealingDeque* stealing_deque_ = nullptr;
+  uint32_t steal_seed_ = 0;
 };
 
 }  // namespace internal
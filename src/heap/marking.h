@@ -203,6 +203,14 @@ class V8_EXPORT_PRIVATE MarkingBitmap final {
   static inline Address FindPreviousValidObject(const PageMetadata* page,
                                                 Address maybe_inner_ptr);
 
+  // Like FindPreviousValidObject but for a `bitmap` that is used as an object
+  // start bitmap, i.e., that has the bits of object starts set. It returns the
+  // highest address in the page that is not larger than maybe_inner_ptr and
+  // has its bit set, or the page area start if no such address exists.
+  static inline Address FindPreviousObjectStart(const MarkingBitmap* bitmap,
+                                                const PageMetadata* page,
+                                                Address maybe_inner_ptr);
+
  private:
   V8_INLINE static MarkingBitmap* FromAddress(Address address);
 
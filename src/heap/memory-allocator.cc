@@ -4,10 +4,12 @@
 
 #include "src/heap/memory-allocator.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <optional>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -15,6 +17,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/heap/large-page-metadata.h"
 #include "src/heap/memory-chunk-metadata.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/read-only-spaces.h"
@@ -85,14 +88,72 @@ void MemoryAllocator::TearDown() {
 
 void MemoryAllocator::Pool::ReleasePooledChunks() {
   std::vector<MutablePageMetadata*> copied_pooled;
+  std::vector<MutablePageMetadata*> copied_discarded;
   {
     base::SpinningMutexGuard guard(&mutex_);
     std::swap(copied_pooled, pooled_chunks_);
+    std::swap(copied_discarded, discarded_chunks_);
   }
   for (auto* chunk_metadata : copied_pooled) {
     DCHECK_NOT_NULL(chunk_metadata);
     DeleteMemoryChunk(chunk_metadata);
   }
+  for (auto* chunk_metadata : copied_discarded) {
+    DCHECK_NOT_NULL(chunk_metadata);
+    DeleteMemoryChunk(chunk_metadata);
+  }
+}
+
+void MemoryAllocator::Pool::ReduceMemory() {
+  if (v8_flags.discard_pooled_pages) {
+    DiscardPooledChunks();
+  } else {
+    ReleasePooledChunks();
+  }
+}
+
+void MemoryAllocator::Pool::DiscardPooledChunks() {
+  const size_t max_discarded_chunks =
+      v8_flags.max_discarded_pooled_memory_mb * MB / PageMetadata::kPageSize;
+  std::vector<MutablePageMetadata*> to_discard;
+  std::vector<MutablePageMetadata*> to_release;
+  {
+    base::SpinningMutexGuard guard(&mutex_);
+    std::swap(to_discard, pooled_chunks_);
+    // Keep the chunks that were already discarded as they are cheapest to keep
+    // around. Release everything above the limit.
+    while (discarded_chunks_.size() > max_discarded_chunks) {
+      to_release.push_back(discarded_chunks_.back());
+      discarded_chunks_.pop_back();
+    }
+    while (!to_discard.empty() &&
+           discarded_chunks_.size() + to_discard.size() >
+               max_discarded_chunks) {
+      to_release.push_back(to_discard.back());
+      to_discard.pop_back();
+    }
+  }
+
+  // The object area is discarded. The chunk header is kept intact so that the
+  // chunk can be reinitialized without touching the discarded pages first.
+  v8::PageAllocator* page_allocator = allocator_->data_page_allocator();
+  for (auto* chunk_metadata : to_discard) {
+    DCHECK_NOT_NULL(chunk_metadata);
+    const Address start = RoundUp(chunk_metadata->area_start(),
+                                  MemoryAllocator::GetCommitPageSize());
+    const Address end = chunk_metadata->ChunkAddress() + chunk_metadata->size();
+    DCHECK_LT(start, end);
+    CHECK(page_allocator->DiscardSystemPages(reinterpret_cast<void*>(start),
+                                             end - start));
+  }
+  for (auto* chunk_metadata : to_release) {
+    DCHECK_NOT_NULL(chunk_metadata);
+    DeleteMemoryChunk(chunk_metadata);
+  }
+
+  base::SpinningMutexGuard guard(&mutex_);
+  discarded_chunks_.insert(discarded_chunks_.end(), to_discard.begin(),
+                           to_discard.end());
 }
 
 size_t MemoryAllocator::Pool::NumberOfCommittedChunks() const {
@@ -100,6 +161,11 @@ size_t MemoryAllocator::Pool::NumberOfCommittedChunks() const {
   return pooled_chunks_.size();
 }
 
+size_t MemoryAllocator::Pool::NumberOfDiscardedChunks() const {
+  base::SpinningMutexGuard guard(&mutex_);
+  return discarded_chunks_.size();
+}
+
 size_t MemoryAllocator::Pool::CommittedBufferedMemory() const {
   return NumberOfCommittedChunks() * PageMetadata::kPageSize;
 }
@@ -221,10 +287,17 @@ MemoryAllocator::AllocateUninitializedChunkAt(BaseSpace* space,
   size_t chunk_size = ComputeChunkSize(area_size, space->identity());
   DCHECK_EQ(chunk_size % GetCommitPageSize(), 0);
 
+  size_t alignment = MemoryChunk::GetAlignmentForAllocation();
+  if (page_size == PageSize::kLarge && UseHugePages(executable) &&
+      chunk_size >= base::OS::kHugePageSize) {
+    // Align large pages such that all but the tail can be backed by huge
+    // pages.
+    alignment = std::max(alignment, base::OS::kHugePageSize);
+  }
+
   Address base = AllocateAlignedMemory(
-      chunk_size, area_size, MemoryChunk::GetAlignmentForAllocation(),
-      space->identity(), executable, reinterpret_cast<void*>(hint),
-      &reservation);
+      chunk_size, area_size, alignment, space->identity(), executable,
+      reinterpret_cast<void*>(hint), &reservation);
   if (base == kNullAddress) return {};
 
   size_ += reservation.size();
@@ -268,6 +341,16 @@ void MemoryAllocator::PartialFreeMemory(MemoryChunkMetadata* chunk,
   DCHECK(reservation->IsReserved());
   chunk->set_size(chunk->size() - bytes_to_free);
   chunk->set_area_end(new_area_end);
+  if (chunk->Chunk()->IsLargePage()) {
+    LargePageMetadata* page = LargePageMetadata::cast(chunk);
+    if (page->huge_page_size_ > 0) {
+      const size_t remaining =
+          HugePageRegion(page->ChunkAddress(), page->size()).size();
+      DCHECK_LE(remaining, page->huge_page_size_);
+      huge_page_size_ -= page->huge_page_size_ - remaining;
+      page->huge_page_size_ = remaining;
+    }
+  }
   if (chunk->Chunk()->IsFlagSet(MemoryChunk::IS_EXECUTABLE)) {
     // Add guard page at the end.
     size_t page_size = GetCommitPageSize();
@@ -311,6 +394,12 @@ void MemoryAllocator::UnregisterMemoryChunk(MemoryChunkMetadata* chunk_metadata,
   DCHECK_GE(size_, static_cast<size_t>(size));
 
   size_ -= size;
+  if (chunk->IsLargePage()) {
+    LargePageMetadata* page = LargePageMetadata::cast(chunk_metadata);
+    DCHECK_GE(huge_page_size_, page->huge_page_size_);
+    huge_page_size_ -= page->huge_page_size_;
+    page->huge_page_size_ = 0;
+  }
   if (executable == EXECUTABLE) {
     DCHECK_GE(size_executable_, size);
     size_executable_ -= size;
@@ -523,10 +612,42 @@ LargePageMetadata* MemoryAllocator::AllocateLargePage(
   if (chunk->executable()) RegisterExecutableMemoryChunk(metadata);
 #endif  // DEBUG
 
+  if (UseHugePages(executable)) AdviseHugePages(metadata);
+
   RecordMemoryChunkCreated(chunk);
   return metadata;
 }
 
+// static
+bool MemoryAllocator::UseHugePages(Executability executable) {
+  // Executable large pages live in the code range which is advised as a whole
+  // on reservation.
+  return v8_flags.huge_pages && base::OS::IsHugePageAdviceSupported() &&
+         executable == NOT_EXECUTABLE;
+}
+
+// static
+base::AddressRegion MemoryAllocator::HugePageRegion(Address start,
+                                                    size_t size) {
+  const Address begin = RoundUp(start, base::OS::kHugePageSize);
+  const Address end = RoundDown(start + size, base::OS::kHugePageSize);
+  if (begin >= end) return {};
+  return base::AddressRegion(begin, end - begin);
+}
+
+void MemoryAllocator::AdviseHugePages(LargePageMetadata* page) {
+  DCHECK_EQ(0, page->huge_page_size_);
+  const base::AddressRegion region =
+      HugePageRegion(page->ChunkAddress(), page->size());
+  if (region.is_empty()) return;
+  if (!base::OS::AdviseHugePages(reinterpret_cast<void*>(region.begin()),
+                                 region.size())) {
+    return;
+  }
+  page->huge_page_size_ = region.size();
+  huge_page_size_ += region.size();
+}
+
 std::optional<MemoryAllocator::MemoryChunkAllocationResult>
 MemoryAllocator::AllocateUninitializedPageFromPool(Space* space) {
   MemoryChunkMetadata* chunk_metadata = pool()->TryGetPooled();
@@ -44,7 +44,10 @@ class ReadOnlyPageMetadata;
 // pages for large object space.
 class MemoryAllocator {
  public:
-  // Pool keeps pages allocated and accessible until explicitly flushed.
+  // Pool keeps pages allocated and accessible until explicitly flushed. With
+  // --discard-pooled-pages, memory-reducing GCs merely discard the contents of
+  // pooled pages so that the next allocation burst does not have to map them
+  // again.
   class V8_EXPORT_PRIVATE Pool {
    public:
     explicit Pool(MemoryAllocator* allocator) : allocator_(allocator) {}
@@ -66,20 +69,35 @@ class MemoryAllocator {
 
     MutablePageMetadata* TryGetPooled() {
       base::SpinningMutexGuard guard(&mutex_);
-      if (pooled_chunks_.empty()) return nullptr;
-      MutablePageMetadata* chunk = pooled_chunks_.back();
-      pooled_chunks_.pop_back();
+      // Prefer chunks whose contents are still resident.
+      std::vector<MutablePageMetadata*>& chunks =
+          pooled_chunks_.empty() ? discarded_chunks_ : pooled_chunks_;
+      if (chunks.empty()) return nullptr;
+      MutablePageMetadata* chunk = chunks.back();
+      chunks.pop_back();
       return chunk;
     }
 
+    // Releases all pooled chunks back to the OS.
     void ReleasePooledChunks();
 
+    // Called on memory-reducing GCs. Either releases all pooled chunks or, with
+    // --discard-pooled-pages, discards their contents while keeping up to
+    // --max-discarded-pooled-memory-mb of them mapped.
+    void ReduceMemory();
+
     size_t NumberOfCommittedChunks() const;
     size_t CommittedBufferedMemory() const;
+    size_t NumberOfDiscardedChunks() const;
 
    private:
+    void DiscardPooledChunks();
+
     MemoryAllocator* const allocator_;
     std::vector<MutablePageMetadata*> pooled_chunks_;
+    // Pooled chunks whose contents have been discarded. They remain mapped but
+    // are not resident until they are written to again.
+    std::vector<MutablePageMetadata*> discarded_chunks_;
     mutable base::SpinningMutex mutex_;
 
     friend class MemoryAllocator;
@@ -152,6 +170,10 @@ class MemoryAllocator {
   // Returns allocated executable spaces in bytes.
   size_t SizeExecutable() const { return size_executable_; }
 
+  // Returns the bytes of large pages that the OS was advised to back with huge
+  // pages (--huge-pages).
+  size_t HugePageSize() const { return huge_page_size_; }
+
   // Returns the maximum available bytes of heaps.
   size_t Available() const {
     const size_t size = Size();
@@ -276,6 +298,15 @@ class MemoryAllocator {
                                Executability executable, Address hint,
                                PageSize page_size);
 
+  // Whether large pages with the given executability are backed by huge pages.
+  static bool UseHugePages(Executability executable);
+
+  // Returns the largest huge page aligned region within [start, start + size).
+  static base::AddressRegion HugePageRegion(Address start, size_t size);
+
+  // Advises the OS to back the page with huge pages where possible.
+  void AdviseHugePages(LargePageMetadata* page);
+
   // Internal raw allocation method that allocates an aligned MemoryChunk and
   // sets the right memory permissions.
   Address AllocateAlignedMemory(size_t chunk_size, size_t area_size,
@@ -410,6 +441,8 @@ class MemoryAllocator {
   std::atomic<size_t> size_ = 0;
   // Allocated executable space size in bytes.
   std::atomic<size_t> size_executable_ = 0;
+  // Large page bytes advised to be backed by huge pages.
+  std::atomic<size_t> huge_page_size_ = 0;
 
   // We keep the lowest and highest addresses allocated as a quick way
   // of determining that pointers are outside the heap. The estimate is
@@ -4,14 +4,22 @@
 
 #include "src/heap/memory-balancer.h"
 
+#include "src/heap/heap-budget.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 
 namespace v8 {
 namespace internal {
 
-MemoryBalancer::MemoryBalancer(Heap* heap, base::TimeTicks startup_time)
-    : heap_(heap), last_measured_at_(startup_time) {}
+MemoryBalancer::MemoryBalancer(Heap* heap, base::TimeTicks startup_time,
+                               std::shared_ptr<HeapBudgetImpl> budget)
+    : heap_(heap), budget_(std::move(budget)), last_measured_at_(startup_time) {
+  if (budget_) budget_->Register(this);
+}
+
+MemoryBalancer::~MemoryBalancer() {
+  if (budget_) budget_->Unregister(this);
+}
 
 void MemoryBalancer::RecomputeLimits(size_t embedder_allocation_limit,
                                      base::TimeTicks time) {
@@ -26,7 +34,7 @@ void MemoryBalancer::RecomputeLimits(size_t embedder_allocation_limit,
 void MemoryBalancer::RefreshLimit() {
   CHECK(major_allocation_rate_.has_value());
   CHECK(major_gc_speed_.has_value());
-  const size_t computed_limit =
+  size_t computed_limit =
       live_memory_after_gc_ +
       sqrt(live_memory_after_gc_ * (major_allocation_rate_.value().rate()) /
            (major_gc_speed_.value().rate()) / v8_flags.memory_balancer_c_value);
@@ -38,6 +46,14 @@ void MemoryBalancer::RefreshLimit() {
   constexpr size_t kMinHeapExtraSpace = 2 * MB;
   const size_t minimum_limit = live_memory_after_gc_ + kMinHeapExtraSpace;
 
+  if (budget_) {
+    computed_limit =
+        live_memory_after_gc_ +
+        budget_->UpdateAndComputeHeadroom(
+            this, live_memory_after_gc_, computed_limit - live_memory_after_gc_,
+            kMinHeapExtraSpace);
+  }
+
   size_t new_limit = std::max<size_t>(minimum_limit, computed_limit);
   new_limit = std::min<size_t>(new_limit, heap_->max_old_generation_size());
   new_limit = std::max<size_t>(new_limit, heap_->min_old_generation_size());
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MEMORY_BALANCER_H_
 #define V8_HEAP_MEMORY_BALANCER_H_
 
+#include <memory>
 #include <optional>
 
 #include "src/base/platform/time.h"
@@ -14,15 +15,21 @@ namespace v8 {
 namespace internal {
 
 class Heap;
+class HeapBudgetImpl;
 
 // The class that implements memory balancing.
 // Listen to allocation/garbage collection events
 // and smooth them using an exponentially weighted moving average (EWMA).
 // Spawn a heartbeat task that monitors allocation rate.
 // Calculate heap limit and update it accordingly.
+//
+// If the isolate participates in a process-wide HeapBudget, the headroom on
+// top of the live memory is negotiated with the budget instead.
 class MemoryBalancer {
  public:
-  MemoryBalancer(Heap* heap, base::TimeTicks startup_time);
+  MemoryBalancer(Heap* heap, base::TimeTicks startup_time,
+                 std::shared_ptr<HeapBudgetImpl> budget = nullptr);
+  ~MemoryBalancer();
 
   void UpdateAllocationRate(size_t major_allocation_bytes,
                             base::TimeDelta major_allocation_duration);
@@ -57,6 +64,7 @@ class MemoryBalancer {
   void PostHeartbeatTask();
 
   Heap* heap_;
+  std::shared_ptr<HeapBudgetImpl> budget_;
 
   // Live memory estimate of the heap, obtained at the last major garbage
   // collection.
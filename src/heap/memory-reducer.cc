@@ -8,6 +8,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/memory-allocator.h"
 #include "src/init/v8.h"
 #include "src/utils/utils.h"
 
@@ -72,7 +73,9 @@ void MemoryReducer::NotifyTimer(const Event& event) {
   if (state_.id() != kWait) return;
   DCHECK_EQ(kTimer, event.type);
   state_ = Step(state_, event);
-  if (state_.id() == kRun) {
+  if (state_.id() == kDone) {
+    ReleasePooledPages();
+  } else if (state_.id() == kRun) {
     DCHECK(heap()->incremental_marking()->IsStopped());
     DCHECK(v8_flags.incremental_marking);
     if (v8_flags.trace_memory_reducer) {
@@ -123,6 +126,9 @@ void MemoryReducer::NotifyMarkCompact(size_t committed_memory_before) {
         "Memory reducer: finished GC #%d (%s)\n", old_state.started_gcs(),
         state_.id() == kWait ? "will do more" : "done");
   }
+  if (old_state.id() != kDone && state_.id() == kDone) {
+    ReleasePooledPages();
+  }
 }
 
 void MemoryReducer::NotifyPossibleGarbage() {
@@ -142,6 +148,42 @@ void MemoryReducer::NotifyPossibleGarbage() {
   }
 }
 
+void MemoryReducer::NotifyIdle() {
+  if (state_.id() != kWait) return;
+  if (!heap()->incremental_marking()->IsStopped() ||
+      !heap()->incremental_marking()->CanAndShouldBeStarted()) {
+    return;
+  }
+  // Pretend that the timer fired at the scheduled start time so that the GC
+  // is started without re-scheduling the timer.
+  const Event event{
+      kTimer,
+      std::max(heap()->MonotonicallyIncreasingTimeInMs(),
+               state_.next_gc_start_ms()),
+      heap()->CommittedOldGenerationMemory(),
+      false,
+      true,
+      true,
+      IsFrozen(heap()),
+  };
+  NotifyTimer(event);
+  DCHECK_NE(state_.id(), kWait);
+}
+
+void MemoryReducer::ReleasePooledPages() {
+  // Reaching the done state means that the mutator has been idle for a
+  // sustained period of time. Pages that memory-reducing GCs only discarded
+  // are now unlikely to be reused soon and are returned to the OS.
+  if (!v8_flags.discard_pooled_pages) return;
+  MemoryAllocator::Pool* pool = heap()->memory_allocator()->pool();
+  if (v8_flags.trace_memory_reducer) {
+    heap()->isolate()->PrintWithTimestamp(
+        "Memory reducer: releasing %zu pooled pages\n",
+        pool->NumberOfCommittedChunks() + pool->NumberOfDiscardedChunks());
+  }
+  pool->ReleasePooledChunks();
+}
+
 bool MemoryReducer::WatchdogGC(const State& state, const Event& event) {
   return state.last_gc_time_ms() != 0 &&
          event.time_ms > state.last_gc_time_ms() + kWatchdogDelayMs;
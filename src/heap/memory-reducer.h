@@ -161,6 +161,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   // Callbacks.
   void NotifyMarkCompact(size_t committed_memory_before);
   void NotifyPossibleGarbage();
+  // Called when the embedder is idle. Starts a GC that is waiting for its
+  // timer right away as the mutator is known to be inactive.
+  void NotifyIdle();
   // The step function that computes the next state from the current state and
   // the incoming event.
   static State Step(const State& state, const Event& event);
@@ -200,6 +203,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
 
   void NotifyTimer(const Event& event);
 
+  // Returns pooled pages to the OS once the heap is considered idle.
+  void ReleasePooledPages();
+
   static bool WatchdogGC(const State& state, const Event& event);
 
   Heap* heap_;
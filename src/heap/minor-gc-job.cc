@@ -134,6 +134,11 @@ MinorGCJob::MinorGCJob(Heap* heap) V8_NOEXCEPT
     : heap_(heap),
       minor_gc_task_observer_(new ScheduleMinorGCTaskObserver(this, heap)) {}
 
+// static
+bool MinorGCJob::YoungGenerationTaskTriggerReached(Heap* heap) {
+  return YoungGenerationSize(heap) >= YoungGenerationTaskTriggerSize(heap);
+}
+
 void MinorGCJob::TryScheduleTask() {
   if (!v8_flags.minor_gc_task || IsScheduled() || heap_->IsTearingDown()) {
     return;
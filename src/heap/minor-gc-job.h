@@ -31,6 +31,10 @@ class MinorGCJob final {
   // Cancels any previously scheduled minor GC tasks that have not yet run.
   void CancelTaskIfScheduled();
 
+  // Returns true if the young generation reached the size at which a minor GC
+  // task is scheduled.
+  static bool YoungGenerationTaskTriggerReached(Heap* heap);
+
  private:
   class Task;
 
@@ -17,6 +17,7 @@
 #include "src/heap/memory-chunk-metadata.h"
 #include "src/heap/mutable-page-metadata-inl.h"
 #include "src/heap/spaces.h"
+#include "src/objects/fixed-array-inl.h"
 #include "src/objects/heap-object.h"
 
 namespace v8::internal {
@@ -130,6 +131,7 @@ void MutablePageMetadata::ReleaseAllocatedMemoryNeededForWritableChunk() {
   ReleaseTypedSlotSet(OLD_TO_NEW);
   ReleaseTypedSlotSet(OLD_TO_OLD);
   ReleaseTypedSlotSet(OLD_TO_SHARED);
+  ReleaseCardTable();
 
   if (!Chunk()->IsLargePage()) {
     PageMetadata* page = static_cast<PageMetadata*>(this);
@@ -182,13 +184,41 @@ void MutablePageMetadata::ReleaseTypedSlotSet(RememberedSetType type) {
   }
 }
 
+CardTable* MutablePageMetadata::AllocateCardTableIfNeeded() {
+  // Card marking is only used for large fixed arrays in the old generation.
+  // Their slots are contiguous which allows for scanning a dirty card without
+  // knowing where objects start.
+  if (!IsLargePage() || owner_identity() != LO_SPACE ||
+      !IsFixedArray(HeapObject::FromAddress(area_start()))) {
+    return nullptr;
+  }
+  CardTable* new_card_table = CardTable::Allocate(size());
+  CardTable* old_card_table =
+      base::AsAtomicPointer::AcquireRelease_CompareAndSwap(
+          &card_table_, nullptr, new_card_table);
+  if (old_card_table) {
+    CardTable::Delete(new_card_table);
+    new_card_table = old_card_table;
+  }
+  DCHECK_NOT_NULL(new_card_table);
+  return new_card_table;
+}
+
+void MutablePageMetadata::ReleaseCardTable() {
+  CardTable* card_table = card_table_;
+  if (card_table) {
+    card_table_ = nullptr;
+    CardTable::Delete(card_table);
+  }
+}
+
 bool MutablePageMetadata::ContainsAnySlots() const {
   for (int rs_type = 0; rs_type < NUMBER_OF_REMEMBERED_SET_TYPES; rs_type++) {
     if (slot_set_[rs_type] || typed_slot_set_[rs_type]) {
       return true;
     }
   }
-  return false;
+  return card_table_ != nullptr;
 }
 
 int MutablePageMetadata::ComputeFreeListsLength() {
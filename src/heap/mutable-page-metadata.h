@@ -11,6 +11,7 @@
 #include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/heap/base/active-system-pages.h"
+#include "src/heap/card-table.h"
 #include "src/heap/list.h"
 #include "src/heap/marking-progress-tracker.h"
 #include "src/heap/marking.h"
@@ -155,6 +156,24 @@ class MutablePageMetadata : public MemoryChunkMetadata {
   // Not safe to be called concurrently.
   void ReleaseTypedSlotSet(RememberedSetType type);
 
+  // Returns the card table that records old-to-new slots written by the
+  // mutator, or nullptr if they are recorded in the OLD_TO_NEW slot set.
+  CardTable* card_table() {
+    return base::AsAtomicPointer::Acquire_Load(&card_table_);
+  }
+  // Like card_table() but allocates the card table on first use for pages that
+  // record old-to-new slots by card marking (see --card-table-old-to-new).
+  CardTable* GetOrAllocateCardTable() {
+    CardTable* card_table = this->card_table();
+    if (V8_LIKELY(card_table != nullptr) ||
+        V8_LIKELY(!v8_flags.card_table_old_to_new)) {
+      return card_table;
+    }
+    return AllocateCardTableIfNeeded();
+  }
+  // Not safe to be called concurrently.
+  void ReleaseCardTable();
+
   template <RememberedSetType type>
   SlotSet* ExtractSlotSet() {
     SlotSet* slot_set = slot_set_[type];
@@ -313,6 +332,8 @@ class MutablePageMetadata : public MemoryChunkMetadata {
   // set for large pages. In the latter case the number of entries in the array
   // is ceil(size() / kPageSize).
   TypedSlotSet* typed_slot_set_[NUMBER_OF_REMEMBERED_SET_TYPES] = {nullptr};
+  // Only allocated for pages that use card marking for old-to-new slots.
+  CardTable* card_table_ = nullptr;
 
   // Used by the marker to keep track of the scanning progress in large objects
   // that have a progress tracker and are scanned in increments and
@@ -371,6 +392,12 @@ class MutablePageMetadata : public MemoryChunkMetadata {
            sizeof(void*) * remembered_set_type;
   }
 
+  static constexpr intptr_t CardTableOffset() {
+    return offsetof(MutablePageMetadata, card_table_);
+  }
+
+  V8_EXPORT_PRIVATE CardTable* AllocateCardTableIfNeeded();
+
   // For ReleaseAllAllocatedMemory().
   friend class MemoryAllocator;
   // For set_typed_slot_set().
@@ -381,7 +408,7 @@ class MutablePageMetadata : public MemoryChunkMetadata {
   friend class MacroAssembler;
   friend class MarkingBitmap;
   friend class TestWithBitmap;
-  // For SlotSetOffset().
+  // For SlotSetOffset() and CardTableOffset().
   friend class WriteBarrierCodeStubAssembler;
 };
 
@@ -895,6 +895,11 @@ void ObjectStatsCollectorImpl::RecordVirtualMapDetails(Tagged<Map> map) {
   } else if (map->is_dictionary_map()) {
     RecordSimpleVirtualObjectStats(HeapObject(), map,
                                    StatsEnum::MAP_DICTIONARY_TYPE);
+  } else if (IsMap(map->GetBackPointer())) {
+    // Non-root maps reachable through transitions; these pile up when
+    // objects get the same properties added in varying orders.
+    RecordSimpleVirtualObjectStats(HeapObject(), map,
+                                   StatsEnum::MAP_TRANSITION_TREE_TYPE);
   } else if (map->is_stable()) {
     RecordSimpleVirtualObjectStats(HeapObject(), map,
                                    StatsEnum::MAP_STABLE_TYPE);
@@ -9,6 +9,8 @@
 
 #include "src/base/logging.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
+#include "src/base/platform/yield-processor.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles.h"
@@ -231,25 +233,40 @@ void IsolateSafepoint::WaitUntilRunningThreadsInSafepoint(
 void IsolateSafepoint::Barrier::Arm() {
   base::MutexGuard guard(&mutex_);
   DCHECK(!IsArmed());
-  armed_ = true;
-  stopped_ = 0;
+  armed_.store(true, std::memory_order_relaxed);
+  stopped_.store(0, std::memory_order_relaxed);
 }
 
 void IsolateSafepoint::Barrier::Disarm() {
   base::MutexGuard guard(&mutex_);
   DCHECK(IsArmed());
-  armed_ = false;
-  stopped_ = 0;
+  armed_.store(false, std::memory_order_relaxed);
+  stopped_.store(0, std::memory_order_relaxed);
   cv_resume_.NotifyAll();
 }
 
 void IsolateSafepoint::Barrier::WaitUntilRunningThreadsInSafepoint(
     const IsolateSafepoint::RunningLocalHeaps& running_local_heaps) {
-  base::MutexGuard guard(&mutex_);
   DCHECK(IsArmed());
-  size_t running_count = running_local_heaps.size();
-  while (stopped_ < running_count) {
-    cv_stopped_.Wait(&mutex_);
+  const size_t running_count = running_local_heaps.size();
+  // Running threads usually reach the safepoint within microseconds, so spin
+  // for a short while before blocking on the condition variable.
+  static constexpr base::TimeDelta kSpinTime =
+      base::TimeDelta::FromMicroseconds(50);
+  const base::TimeTicks spin_end = base::TimeTicks::Now() + kSpinTime;
+  while (stopped_.load(std::memory_order_acquire) < running_count &&
+         base::TimeTicks::Now() < spin_end) {
+    YIELD_PROCESSOR;
+  }
+  if (stopped_.load(std::memory_order_acquire) < running_count) {
+    base::MutexGuard guard(&mutex_);
+    // Pairs with NotifyStopped(): either the last thread sees this flag and
+    // wakes us up, or we see its increment before blocking.
+    initiator_waiting_.store(true, std::memory_order_seq_cst);
+    while (stopped_.load(std::memory_order_seq_cst) < running_count) {
+      cv_stopped_.Wait(&mutex_);
+    }
+    initiator_waiting_.store(false, std::memory_order_relaxed);
   }
 #if V8_OS_DARWIN
   if (v8_flags.safepoint_bump_qos_class) {
@@ -260,24 +277,25 @@ void IsolateSafepoint::Barrier::WaitUntilRunningThreadsInSafepoint(
     }
   }
 #endif
-  DCHECK_EQ(stopped_, running_count);
+  DCHECK_EQ(stopped_.load(std::memory_order_relaxed), running_count);
 }
 
-void IsolateSafepoint::Barrier::NotifyPark() {
-  base::MutexGuard guard(&mutex_);
+void IsolateSafepoint::Barrier::NotifyStopped() {
   CHECK(IsArmed());
-  stopped_++;
+  stopped_.fetch_add(1, std::memory_order_seq_cst);
+  if (!initiator_waiting_.load(std::memory_order_seq_cst)) return;
+  base::MutexGuard guard(&mutex_);
   cv_stopped_.NotifyOne();
 }
 
+void IsolateSafepoint::Barrier::NotifyPark() { NotifyStopped(); }
+
 void IsolateSafepoint::Barrier::WaitInSafepoint() {
   const auto scoped_blocking_call =
       V8::GetCurrentPlatform()->CreateBlockingScope(BlockingType::kWillBlock);
-  base::MutexGuard guard(&mutex_);
-  CHECK(IsArmed());
-  stopped_++;
-  cv_stopped_.NotifyOne();
+  NotifyStopped();
 
+  base::MutexGuard guard(&mutex_);
   while (IsArmed()) {
     cv_resume_.Wait(&mutex_);
   }
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_SAFEPOINT_H_
 #define V8_HEAP_SAFEPOINT_H_
 
+#include <atomic>
 #include <optional>
 #include <vector>
 
@@ -60,15 +61,19 @@ class IsolateSafepoint final {
     base::Mutex mutex_;
     base::ConditionVariable cv_resume_;
     base::ConditionVariable cv_stopped_;
-    bool armed_;
+    std::atomic<bool> armed_{false};
 
-    size_t stopped_ = 0;
+    // Number of running threads that reached the safepoint. Threads bump it
+    // without taking |mutex_|, which is only needed to wake up the initiator
+    // once it blocked in WaitUntilRunningThreadsInSafepoint().
+    std::atomic<size_t> stopped_{0};
+    std::atomic<bool> initiator_waiting_{false};
 
-    bool IsArmed() { return armed_; }
+    bool IsArmed() { return armed_.load(std::memory_order_relaxed); }
 
-   public:
-    Barrier() : armed_(false), stopped_(0) {}
+    void NotifyStopped();
 
+   public:
     void Arm();
     void Disarm();
     void WaitUntilRunningThreadsInSafepoint(
@@ -9,6 +9,7 @@
 #include <optional>
 #include <unordered_map>
 
+#include "src/base/sys-info.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -255,7 +256,31 @@ ScavengerCollector::JobTask::JobTask(
       promoted_list_(promoted_list),
       trace_id_(reinterpret_cast<uint64_t>(this) ^
                 collector_->heap_->tracer()->CurrentEpoch(
-                    GCTracer::Scope::SCAVENGER)) {}
+                    GCTracer::Scope::SCAVENGER)) {
+  if (collector_->num_numa_nodes_ > 1) {
+    ComputeNumaNodesOfChunks(collector_->num_numa_nodes_);
+  }
+}
+
+void ScavengerCollector::JobTask::ComputeNumaNodesOfChunks(int num_numa_nodes) {
+  const size_t count = old_to_new_chunks_.size();
+  if (count == 0) return;
+  std::vector<const void*> pages(count);
+  std::vector<int> nodes(count, -1);
+  for (size_t i = 0; i < count; ++i) {
+    pages[i] = reinterpret_cast<const void*>(
+        old_to_new_chunks_[i].second->ChunkAddress());
+  }
+  if (!base::SysInfo::NumaNodesOfPages(count, pages.data(), nodes.data())) {
+    return;
+  }
+  chunks_by_numa_node_.resize(num_numa_nodes);
+  for (size_t i = 0; i < count; ++i) {
+    // Pages with unknown placement are left to the regular page distribution.
+    if (nodes[i] < 0 || nodes[i] >= num_numa_nodes) continue;
+    chunks_by_numa_node_[nodes[i]].push_back(i);
+  }
+}
 
 void ScavengerCollector::JobTask::Run(JobDelegate* delegate) {
   DCHECK_LT(delegate->GetTaskId(), scavengers_->size());
@@ -307,27 +332,59 @@ void ScavengerCollector::JobTask::ProcessItems(JobDelegate* delegate,
   }
   if (V8_UNLIKELY(v8_flags.trace_parallel_scavenge)) {
     PrintIsolate(collector_->heap_->isolate(),
-                 "scavenge[%p]: time=%.2f copied=%zu promoted=%zu\n",
+                 "scavenge[%p]: time=%.2f copied=%zu promoted=%zu node=%d\n",
                  static_cast<void*>(this), scavenging_time,
-                 scavenger->bytes_copied(), scavenger->bytes_promoted());
+                 scavenger->bytes_copied(), scavenger->bytes_promoted(),
+                 base::SysInfo::CurrentNumaNode());
+  }
+}
+
+bool ScavengerCollector::JobTask::TryScavengePage(Scavenger* scavenger,
+                                                  size_t index,
+                                                  bool* all_pages_processed) {
+  auto& work_item = old_to_new_chunks_[index];
+  if (!work_item.first.TryAcquire()) {
+    return false;
+  }
+  scavenger->ScavengePage(work_item.second);
+  *all_pages_processed =
+      remaining_memory_chunks_.fetch_sub(1, std::memory_order_relaxed) <= 1;
+  return true;
+}
+
+bool ScavengerCollector::JobTask::ConcurrentScavengeLocalNumaNodePages(
+    Scavenger* scavenger) {
+  const int node = base::SysInfo::CurrentNumaNode();
+  if (node < 0 || static_cast<size_t>(node) >= chunks_by_numa_node_.size()) {
+    return true;
+  }
+  bool all_pages_processed = false;
+  for (size_t index : chunks_by_numa_node_[node]) {
+    // Pages may already have been claimed by tasks running on the same node
+    // or by tasks that ran out of local pages.
+    TryScavengePage(scavenger, index, &all_pages_processed);
+    if (all_pages_processed) return false;
   }
+  return true;
 }
 
 void ScavengerCollector::JobTask::ConcurrentScavengePages(
     Scavenger* scavenger) {
+  if (!chunks_by_numa_node_.empty() &&
+      !ConcurrentScavengeLocalNumaNodePages(scavenger)) {
+    return;
+  }
   while (remaining_memory_chunks_.load(std::memory_order_relaxed) > 0) {
     std::optional<size_t> index = generator_.GetNext();
     if (!index) {
       return;
     }
     for (size_t i = *index; i < old_to_new_chunks_.size(); ++i) {
-      auto& work_item = old_to_new_chunks_[i];
-      if (!work_item.first.TryAcquire()) {
+      bool all_pages_processed = false;
+      if (!TryScavengePage(scavenger, i, &all_pages_processed)) {
         break;
       }
-      scavenger->ScavengePage(work_item.second);
-      if (remaining_memory_chunks_.fetch_sub(1, std::memory_order_relaxed) <=
-          1) {
+      if (all_pages_processed) {
         return;
       }
     }
@@ -335,7 +392,11 @@ void ScavengerCollector::JobTask::ConcurrentScavengePages(
 }
 
 ScavengerCollector::ScavengerCollector(Heap* heap)
-    : isolate_(heap->isolate()), heap_(heap) {}
+    : isolate_(heap->isolate()), heap_(heap) {
+  if (v8_flags.scavenger_numa_aware) {
+    num_numa_nodes_ = base::SysInfo::NumberOfNumaNodes();
+  }
+}
 
 namespace {
 
@@ -442,6 +503,7 @@ class YoungGenerationConservativeStackVisitor
 
  private:
   static constexpr bool kOnlyVisitMainV8Cage [[maybe_unused]] = true;
+  static constexpr bool kUseObjectStartBitmaps = false;
 
   static bool FilterPage(const MemoryChunk* chunk) {
     return chunk->IsFromPage();
@@ -775,7 +837,8 @@ void ScavengerCollector::CollectGarbage() {
           heap_, [&old_to_new_chunks](MutablePageMetadata* chunk) {
             if (chunk->slot_set<OLD_TO_NEW>() ||
                 chunk->typed_slot_set<OLD_TO_NEW>() ||
-                chunk->slot_set<OLD_TO_NEW_BACKGROUND>()) {
+                chunk->slot_set<OLD_TO_NEW_BACKGROUND>() ||
+                chunk->card_table()) {
               old_to_new_chunks.emplace_back(ParallelWorkItem{}, chunk);
             }
           });
@@ -1109,6 +1172,19 @@ void Scavenger::ScavengePage(MutablePageMetadata* page) {
         &local_empty_chunks_);
   }
 
+  if (page->card_table() != nullptr) {
+    // A dirty card stays dirty as long as any of its slots still points into
+    // the young generation.
+    LargePageMetadata::cast(page)->IterateCardMarkedSlots(
+        [this, chunk, page, record_old_to_shared_slots](MaybeObjectSlot slot) {
+          SlotCallbackResult result = CheckAndScavengeObject(heap_, slot);
+          if (result == REMOVE_SLOT && record_old_to_shared_slots) {
+            CheckOldToNewSlotForSharedUntyped(chunk, page, slot);
+          }
+          return result;
+        });
+  }
+
   if (chunk->executable()) {
     std::vector<std::tuple<Tagged<HeapObject>, SlotType, Address>> slot_updates;
 
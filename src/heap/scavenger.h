@@ -252,6 +252,12 @@ class ScavengerCollector {
    private:
     void ProcessItems(JobDelegate* delegate, Scavenger* scavenger);
     void ConcurrentScavengePages(Scavenger* scavenger);
+    // Scavenges the pages that reside on the NUMA node of the current thread.
+    // Returns false if all pages have been processed.
+    bool ConcurrentScavengeLocalNumaNodePages(Scavenger* scavenger);
+    bool TryScavengePage(Scavenger* scavenger, size_t index,
+                         bool* all_pages_processed);
+    void ComputeNumaNodesOfChunks(int num_numa_nodes);
     void VisitPinnedObjects(Scavenger* scavenger);
 
     ScavengerCollector* collector_;
@@ -261,6 +267,10 @@ class ScavengerCollector {
         old_to_new_chunks_;
     std::atomic<size_t> remaining_memory_chunks_{0};
     IndexGenerator generator_;
+    // Indices into `old_to_new_chunks_` grouped by the NUMA node the page
+    // resides on. Only populated with --scavenger-numa-aware on machines with
+    // more than one node.
+    std::vector<std::vector<size_t>> chunks_by_numa_node_;
 
     const Scavenger::CopiedList& copied_list_;
     const Scavenger::PinnedList& pinned_list_;
@@ -274,6 +284,10 @@ class ScavengerCollector {
 
   int NumberOfScavengeTasks();
 
+  // Number of NUMA nodes used for --scavenger-numa-aware, or 1 if the mode is
+  // disabled.
+  int num_numa_nodes_ = 1;
+
   void ProcessWeakReferences(
       EphemeronRememberedSet::TableList* ephemeron_table_list);
   void ClearYoungEphemerons(
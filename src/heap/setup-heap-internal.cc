@@ -1151,6 +1151,7 @@ bool Heap::CreateReadOnlyObjects() {
     WELL_KNOWN_SYMBOL_LIST_GENERATOR(WELL_KNOWN_SYMBOL_INIT, /* not used */)
 
     // Mark "Interesting Symbols" appropriately.
+    has_instance_symbol->set_is_interesting_symbol(true);
     to_string_tag_symbol->set_is_interesting_symbol(true);
   }
 
@@ -623,20 +623,22 @@ void Sweeper::LocalSweeper::ParallelIteratePromotedPage(
               page->concurrent_sweeping_state());
     page->set_concurrent_sweeping_state(
         PageMetadata::ConcurrentSweepingState::kInProgress);
-    PromotedPageRecordMigratedSlotVisitor record_visitor(page);
     const bool is_large_page = page->Chunk()->IsLargePage();
-    if (is_large_page) {
-      DCHECK_EQ(LO_SPACE, page->owner_identity());
-      record_visitor.Process(LargePageMetadata::cast(page)->GetObject());
-      page->ReleaseSlotSet(SURVIVOR_TO_EXTERNAL_POINTER);
-    } else {
-      DCHECK_EQ(OLD_SPACE, page->owner_identity());
-      DCHECK(!page->Chunk()->IsEvacuationCandidate());
-      for (auto [object, _] :
-           LiveObjectRange(static_cast<PageMetadata*>(page))) {
-        record_visitor.Process(object);
+    if (sweeper_->record_slots_on_promoted_pages_) {
+      PromotedPageRecordMigratedSlotVisitor record_visitor(page);
+      if (is_large_page) {
+        DCHECK_EQ(LO_SPACE, page->owner_identity());
+        record_visitor.Process(LargePageMetadata::cast(page)->GetObject());
+      } else {
+        DCHECK_EQ(OLD_SPACE, page->owner_identity());
+        DCHECK(!page->Chunk()->IsEvacuationCandidate());
+        for (auto [object, _] :
+             LiveObjectRange(static_cast<PageMetadata*>(page))) {
+          record_visitor.Process(object);
+        }
       }
     }
+    if (is_large_page) page->ReleaseSlotSet(SURVIVOR_TO_EXTERNAL_POINTER);
     if (heap::ShouldZapGarbage() && !is_large_page) {
       ZapDeadObjectsOnPage(sweeper_->heap_, static_cast<PageMetadata*>(page));
     }
@@ -740,42 +742,19 @@ void Sweeper::StartMajorSweeperTasks() {
   major_sweeping_state_.StartConcurrentSweeping();
 }
 
-namespace {
-void ClearPromotedPages(Heap* heap, std::vector<MutablePageMetadata*> pages) {
-  DCHECK(v8_flags.minor_ms);
-  for (auto* page : pages) {
-    DCHECK(!page->SweepingDone());
-    DCHECK_EQ(PageMetadata::ConcurrentSweepingState::kPendingIteration,
-              page->concurrent_sweeping_state());
-    if (heap::ShouldZapGarbage() && !page->Chunk()->IsLargePage()) {
-      ZapDeadObjectsOnPage(heap, static_cast<PageMetadata*>(page));
-    }
-    page->ClearLiveness();
-    page->set_concurrent_sweeping_state(
-        PageMetadata::ConcurrentSweepingState::kDone);
-  }
-}
-}  // namespace
-
 void Sweeper::StartMinorSweeperTasks() {
   DCHECK(v8_flags.minor_ms);
   DCHECK_EQ(GarbageCollector::MINOR_MARK_SWEEPER,
             heap_->tracer()->GetCurrentCollector());
   DCHECK(!promoted_page_iteration_in_progress_);
-  std::vector<MutablePageMetadata*> promoted_pages_for_clearing;
   if (promoted_pages_for_iteration_count_ > 0) {
-    if (ShouldUpdateRememberedSets(heap_)) {
-      promoted_page_iteration_in_progress_.store(true,
-                                                 std::memory_order_release);
-    } else {
-      promoted_pages_for_clearing.swap(
-          sweeping_list_for_promoted_page_iteration_);
-      DCHECK(sweeping_list_for_promoted_page_iteration_.empty());
-      promoted_pages_for_iteration_count_ = 0;
-    }
+    // Without remembered sets to update, the promoted pages still need their
+    // liveness cleared. This is left to the concurrent iteration as well,
+    // instead of clearing all of them in the pause.
+    record_slots_on_promoted_pages_ = ShouldUpdateRememberedSets(heap_);
+    promoted_page_iteration_in_progress_.store(true, std::memory_order_release);
   }
   minor_sweeping_state_.StartConcurrentSweeping();
-  ClearPromotedPages(heap_, promoted_pages_for_clearing);
 }
 
 PageMetadata* Sweeper::GetSweptPageSafe(PagedSpaceBase* space) {
@@ -849,7 +828,7 @@ void Sweeper::EnsureMajorCompleted() {
         TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
     // Discard all pooled pages on memory-reducing GCs.
     if (major_sweeping_state_.should_reduce_memory()) {
-      heap_->memory_allocator()->pool()->ReleasePooledChunks();
+      heap_->memory_allocator()->pool()->ReduceMemory();
     }
     FinishMajorJobs();
     major_sweeping_state_.FinishSweeping();
@@ -1225,6 +1204,30 @@ bool Sweeper::ParallelSweepSpace(AllocationSpace identity,
                                                        max_pages);
 }
 
+bool Sweeper::SweepMajorUntil(base::TimeTicks deadline) {
+  DCHECK(heap_->IsMainThread());
+  if (!major_sweeping_in_progress()) return true;
+  bool out_of_work = true;
+  ForAllSweepingSpaces([this, deadline, &out_of_work](AllocationSpace space) {
+    if (space == NEW_SPACE || !out_of_work) return;
+    if (IsSweepingDoneForSpace(space)) return;
+    auto scope_id = GetTracingScope(space, true);
+    TRACE_GC_EPOCH_WITH_FLOW(
+        heap_->tracer(), scope_id, ThreadKind::kMain,
+        GetTraceIdForFlowEvent(scope_id),
+        TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
+    while (!IsSweepingDoneForSpace(space)) {
+      if (base::TimeTicks::Now() >= deadline) {
+        out_of_work = false;
+        return;
+      }
+      main_thread_local_sweeper_.ParallelSweepSpace(
+          space, SweepingMode::kLazyOrConcurrent, 1);
+    }
+  });
+  return out_of_work;
+}
+
 void Sweeper::EnsurePageIsSwept(PageMetadata* page) {
   DCHECK(heap_->IsMainThread());
 
@@ -130,6 +130,11 @@ class Sweeper {
       AllocationSpace identity, SweepingMode sweeping_mode,
       uint32_t max_pages = std::numeric_limits<uint32_t>::max());
 
+  // Sweeps pages of the major sweeping spaces on the main thread until either
+  // no pages are left or `deadline` is reached. Returns true if no pages are
+  // left. Pages may still be in progress on background threads.
+  bool SweepMajorUntil(base::TimeTicks deadline);
+
   void EnsurePageIsSwept(PageMetadata* page);
   void WaitForPageToBeSwept(PageMetadata* page);
 
@@ -339,6 +344,10 @@ class Sweeper {
   base::Mutex promoted_pages_iteration_notification_mutex_;
   base::ConditionVariable promoted_pages_iteration_notification_variable_;
   std::atomic<bool> promoted_page_iteration_in_progress_{false};
+
+  // Whether iterating promoted pages records their slots in the remembered
+  // sets, or only clears their liveness.
+  bool record_slots_on_promoted_pages_ = false;
 };
 
 template <typename ShouldYieldCallback>
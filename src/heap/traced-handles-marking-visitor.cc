@@ -28,14 +28,19 @@ ConservativeTracedHandlesMarkingVisitor::
 
 void ConservativeTracedHandlesMarkingVisitor::VisitPointer(
     const void* address) {
-  const auto upper_it = std::upper_bound(
-      traced_node_bounds_.begin(), traced_node_bounds_.end(), address,
-      [](const void* needle, const auto& pair) { return needle < pair.first; });
-  // Also checks emptiness as begin() == end() on empty bounds.
-  if (upper_it == traced_node_bounds_.begin()) return;
-
-  const auto bounds = std::next(upper_it, -1);
+  const std::pair<const void*, const void*>* bounds = last_bounds_;
+  if (!bounds || address < bounds->first || address >= bounds->second) {
+    const auto upper_it =
+        std::upper_bound(traced_node_bounds_.begin(), traced_node_bounds_.end(),
+                         address, [](const void* needle, const auto& pair) {
+                           return needle < pair.first;
+                         });
+    // Also checks emptiness as begin() == end() on empty bounds.
+    if (upper_it == traced_node_bounds_.begin()) return;
+    bounds = &*std::next(upper_it, -1);
+  }
   if (address < bounds->second) {
+    last_bounds_ = bounds;
     auto object = TracedHandles::MarkConservatively(
         const_cast<Address*>(reinterpret_cast<const Address*>(address)),
         const_cast<Address*>(reinterpret_cast<const Address*>(bounds->first)),
@@ -31,6 +31,10 @@ class ConservativeTracedHandlesMarkingVisitor final
   MarkingState& marking_state_;
   MarkingWorklists::Local& local_marking_worklist_;
   const TracedHandles::NodeBounds traced_node_bounds_;
+  // Bounds of the block that the last visited pointer pointed into. Handles
+  // created together live in the same block, so consecutive pointers are
+  // likely to hit the same block again.
+  const std::pair<const void*, const void*>* last_bounds_ = nullptr;
   const TracedHandles::MarkMode mark_mode_;
 };
 
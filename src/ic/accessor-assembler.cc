@@ -2906,10 +2906,41 @@ void AccessorAssembler::GenericPropertyLoad(
     TNode<DescriptorArray> descriptors =
         LoadMapDescriptors(lookup_start_object_map);
 
-    Label if_descriptor_found(this), try_stub_cache(this);
+    Label if_descriptor_found(this), try_stub_cache(this),
+        descriptor_lookup(this);
     TVARIABLE(IntPtrT, var_name_index);
     Label* notfound = use_stub_cache == kUseStubCache ? &try_stub_cache
                                                       : &lookup_prototype_chain;
+
+    // Maps with many own descriptors need a binary search for every lookup.
+    // Megamorphic keyed loads from such objects probe the stub cache first;
+    // own data field handlers are added to it below.
+    TNode<BoolT> use_shape_cache;
+    if (use_stub_cache == kUseStubCache) {
+      TNode<Uint32T> nof =
+          DecodeWord32<Map::Bits3::NumberOfOwnDescriptorsBits>(bitfield3);
+      use_shape_cache = Word32And(
+          Uint32GreaterThan(nof, Uint32Constant(kMaxDescriptorsForLinearLoad)),
+          Word32BinaryNot(IsUndefined(p->vector())));
+      GotoIfNot(use_shape_cache, &descriptor_lookup);
+
+      Comment("stub cache probe for many-property receiver");
+      TVARIABLE(MaybeObject, var_handler);
+      Label found_handler(this, &var_handler);
+      TryProbeStubCache(isolate()->load_stub_cache(), lookup_start_object,
+                        lookup_start_object_map, name, &found_handler,
+                        &var_handler, &descriptor_lookup);
+      BIND(&found_handler);
+      {
+        LazyLoadICParameters lazy_p(p);
+        HandleLoadICHandlerCase(&lazy_p, var_handler.value(),
+                                &descriptor_lookup, &direct_exit);
+      }
+    } else {
+      Goto(&descriptor_lookup);
+    }
+
+    BIND(&descriptor_lookup);
     DescriptorLookup(name, descriptors, bitfield3, &if_descriptor_found,
                      &var_name_index, notfound);
 
@@ -2918,6 +2949,30 @@ void AccessorAssembler::GenericPropertyLoad(
       LoadPropertyFromFastObject(lookup_start_object, lookup_start_object_map,
                                  descriptors, var_name_index.value(),
                                  &var_details, &var_value);
+      if (use_stub_cache == kUseStubCache) {
+        Label done(this);
+        GotoIfNot(use_shape_cache, &done);
+        // Only own data fields get a handler; constants and accessors keep
+        // going through the descriptor array.
+        static_assert(static_cast<int>(PropertyKind::kData) == 0);
+        static_assert(static_cast<int>(PropertyLocation::kField) == 0);
+        GotoIf(IsSetWord32(var_details.value(),
+                           PropertyDetails::KindField::kMask |
+                               PropertyDetails::LocationField::kMask),
+               &done);
+        TNode<ExternalReference> function = ExternalConstant(
+            ExternalReference::stub_cache_add_load_field_handler_function());
+        TNode<ExternalReference> isolate_ptr =
+            ExternalConstant(ExternalReference::isolate_address());
+        CallCFunction(
+            function, std::nullopt,
+            std::make_pair(MachineType::Pointer(), isolate_ptr),
+            std::make_pair(MachineType::AnyTagged(), lookup_start_object_map),
+            std::make_pair(MachineType::AnyTagged(), name),
+            std::make_pair(MachineType::IntPtr(), var_name_index.value()));
+        Goto(&done);
+        BIND(&done);
+      }
       Goto(&if_found_on_lookup_start_object);
     }
 
@@ -3064,7 +3119,15 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<Word32T> AccessorAssembler::StubCacheMask(StubCache* stub_cache,
+                                                StubCacheTable table_id) {
+  StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  return Load<Uint32T>(ExternalConstant(
+      ExternalReference::Create(stub_cache->mask_reference(table))));
+}
+
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> raw_hash_field = LoadNameRawHash(name);
@@ -3082,15 +3145,13 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kPrimaryTableBits))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+      ChangeUint32ToWord(Word32And(hash, StubCacheMask(stub_cache, kPrimary)));
   return Signed(result);
 }
 
-TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
-                                                           TNode<Map> map) {
+TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
+    StubCache* stub_cache, TNode<Name> name, TNode<Map> map) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
@@ -3100,10 +3161,8 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryTableBits);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  TNode<UintPtrT> result = ChangeUint32ToWord(
+      Word32And(hash, StubCacheMask(stub_cache, kSecondary)));
   return Signed(result);
 }
 
@@ -3156,7 +3215,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
 
   // Probe the primary table.
   TNode<IntPtrT> primary_offset =
-      StubCachePrimaryOffset(name, lookup_start_object_map);
+      StubCachePrimaryOffset(stub_cache, name, lookup_start_object_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          lookup_start_object_map, if_handler, var_handler,
                          &try_secondary);
@@ -3165,7 +3224,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   {
     // Probe the secondary table.
     TNode<IntPtrT> secondary_offset =
-        StubCacheSecondaryOffset(name, lookup_start_object_map);
+        StubCacheSecondaryOffset(stub_cache, name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            lookup_start_object_map, if_handler, var_handler,
                            &miss);
@@ -4,9 +4,15 @@
 
 #include "src/ic/ic-stats.h"
 
+#include <algorithm>
+#include <ostream>
+
+#include "src/base/hashing.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/tracing/traced-value.h"
 
@@ -85,6 +91,61 @@ const char* ICStats::GetOrCacheFunctionName(IsolateForSandbox isolate,
   return function_name.get();
 }
 
+size_t MegamorphicICSiteStats::SiteKeyHash::operator()(
+    const SiteKey& key) const {
+  return base::Hasher()
+      .Add(std::get<0>(key))
+      .Add(std::get<1>(key))
+      .Add(std::get<2>(key))
+      .hash();
+}
+
+void MegamorphicICSiteStats::Record(Tagged<FeedbackVector> vector, int slot,
+                                    Tagged<Map> map) {
+  DisallowGarbageCollection no_gc;
+  Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+  Tagged<Object> script_object = shared->script();
+  int script_id =
+      IsScript(script_object) ? Cast<Script>(script_object)->id() : -1;
+  SiteKey key{script_id, shared->StartPosition(), slot};
+  auto [it, inserted] = sites_.try_emplace(key);
+  Site& site = it->second;
+  if (inserted) {
+    site.function_name = shared->DebugNameCStr().get();
+    site.slot = slot;
+    if (IsScript(script_object)) {
+      Tagged<Script> script = Cast<Script>(script_object);
+      if (IsString(script->name())) {
+        site.script_name = Cast<String>(script->name())->ToCString().get();
+      }
+      site.line = script->GetLineNumber(shared->StartPosition()) + 1;
+    }
+  }
+  site.updates++;
+  site.maps.insert(map.ptr());
+}
+
+void MegamorphicICSiteStats::Print(std::ostream& os, int count) const {
+  std::vector<const Site*> sorted;
+  sorted.reserve(sites_.size());
+  for (const auto& [key, site] : sites_) sorted.push_back(&site);
+  count = std::min(count, static_cast<int>(sorted.size()));
+  std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(),
+                    [](const Site* a, const Site* b) {
+                      return a->updates > b->updates;
+                    });
+  os << "=== Megamorphic IC sites (" << sites_.size() << " total) ==="
+     << std::endl;
+  for (int i = 0; i < count; i++) {
+    const Site* site = sorted[i];
+    os << "updates: " << site->updates << ", maps: " << site->maps.size()
+       << ", function: "
+       << (site->function_name.empty() ? "<anonymous>" : site->function_name)
+       << " (" << site->script_name << ":" << site->line << ")"
+       << ", slot: " << site->slot << std::endl;
+  }
+}
+
 ICInfo::ICInfo()
     : function_name(nullptr),
       script_offset(0),
@@ -5,9 +5,12 @@
 #ifndef V8_IC_IC_STATS_H_
 #define V8_IC_IC_STATS_H_
 
+#include <iosfwd>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "include/v8-internal.h"  // For Address.
@@ -23,7 +26,9 @@ class TracedValue;
 
 namespace internal {
 
+class FeedbackVector;
 class JSFunction;
+class Map;
 class Script;
 template <typename T>
 class Tagged;
@@ -79,6 +84,33 @@ class ICStats {
   int pos_;
 };
 
+// Counts megamorphic stub cache updates, i.e. stub cache misses, per IC site
+// for --trace-megamorphic-ic-sites, together with the maps seen there.
+class MegamorphicICSiteStats {
+ public:
+  void Record(Tagged<FeedbackVector> vector, int slot, Tagged<Map> map);
+  // Prints the {count} sites with the most updates.
+  void Print(std::ostream& os, int count) const;
+
+ private:
+  struct Site {
+    std::string function_name;
+    std::string script_name;
+    int line = -1;
+    int slot = -1;
+    uint64_t updates = 0;
+    // Map addresses; maps moved by the GC are counted twice.
+    std::unordered_set<Address> maps;
+  };
+  // Keyed by script id, function start position and slot, which do not
+  // change when the GC moves the function.
+  using SiteKey = std::tuple<int, int, int>;
+  struct SiteKeyHash {
+    size_t operator()(const SiteKey& key) const;
+  };
+  std::unordered_map<SiteKey, Site, SiteKeyHash> sites_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -29,6 +29,7 @@
 #include "src/ic/ic-inl.h"
 #include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
+#include "src/logging/metrics.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/field-type.h"
@@ -347,6 +348,18 @@ bool IC::ConfigureVectorState(IC::State new_state, DirectHandle<Object> key) {
       IsName(*key) ? IcCheckType::kProperty : IcCheckType::kElement);
   if (changed) {
     OnFeedbackChanged("Megamorphic");
+    const std::shared_ptr<metrics::Recorder>& recorder =
+        isolate()->metrics_recorder();
+    if (V8_UNLIKELY(recorder->HasEmbedderRecorder())) {
+      Tagged<SharedFunctionInfo> shared =
+          nexus()->vector()->shared_function_info();
+      Tagged<Object> script = shared->script();
+      recorder->RecordMegamorphicTransition(
+          shared->DebugNameCStr().get(),
+          IsScript(script) ? Cast<Script>(script)->id() : -1,
+          shared->StartPosition(), nexus()->slot().ToInt(),
+          FeedbackMetadata::Kind2String(kind()));
+    }
   }
   return changed;
 }
@@ -435,6 +448,7 @@ MaybeDirectHandle<Object> LoadIC::Load(Handle<JSAny> object, Handle<Name> name,
   }
 
   JSObject::MakePrototypesFast(object, kStartAtReceiver, isolate());
+  if (use_ic) JSObject::RecordDictionaryLoadMiss(object, isolate());
   update_lookup_start_object_map(object);
 
   PropertyKey key(isolate(), name);
@@ -856,6 +870,11 @@ void IC::UpdateMegamorphicCache(DirectHandle<Map> map, DirectHandle<Name> name,
                                 const MaybeObjectDirectHandle& handler) {
   if (!IsAnyHas()) {
     stub_cache()->Set(*name, *map, *handler);
+    if (V8_UNLIKELY(v8_flags.trace_megamorphic_ic_sites > 0) &&
+        state() != NO_FEEDBACK) {
+      isolate()->GetMegamorphicICSiteStats()->Record(
+          nexus()->vector(), nexus()->slot().ToInt(), *map);
+    }
   }
 }
 
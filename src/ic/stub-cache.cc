@@ -6,8 +6,10 @@
 
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/base/platform/memory.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/objects/tagged-value-inl.h"
 
@@ -18,6 +20,20 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(Tagged<MaybeObject>()));
+  // Entries are initialized by Clear(), only for the part of the tables that
+  // is in use.
+  primary_ = static_cast<Entry*>(
+      base::Calloc(kMaxPrimaryTableSize, sizeof(Entry)));
+  secondary_ = static_cast<Entry*>(
+      base::Calloc(kMaxSecondaryTableSize, sizeof(Entry)));
+  if (primary_ == nullptr || secondary_ == nullptr) {
+    V8::FatalProcessOutOfMemory(isolate, "StubCache");
+  }
+}
+
+StubCache::~StubCache() {
+  base::Free(primary_);
+  base::Free(secondary_);
 }
 
 void StubCache::Initialize() {
@@ -40,7 +56,7 @@ int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryTableBits));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -52,7 +68,7 @@ int StubCache::SecondaryOffset(Tagged<Name> name, Tagged<Map> old_map) {
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryTableBits);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
@@ -102,6 +118,10 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
         Cast<Name>(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (!secondary->map.IsSmi()) {
+      evictions_++;
+      isolate()->counters()->megamorphic_stub_cache_evictions()->Increment();
+    }
     *secondary = *primary;
   }
 
@@ -127,15 +147,30 @@ Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
   return Tagged<MaybeObject>();
 }
 
+void StubCache::MaybeGrow() {
+  // Losing more than half a table's worth of entries between two full GCs
+  // means that the megamorphic working set does not fit.
+  if (!v8_flags.grow_stub_cache) return;
+  if (primary_table_size() == kMaxPrimaryTableSize) return;
+  if (evictions_ <= primary_table_size() / 2) return;
+  primary_mask_ = (primary_mask_ << 1) | primary_mask_;
+  secondary_mask_ = (secondary_mask_ << 1) | secondary_mask_;
+  DCHECK_LE(primary_table_size(), kMaxPrimaryTableSize);
+  DCHECK_LE(secondary_table_size(), kMaxSecondaryTableSize);
+  isolate()->counters()->megamorphic_stub_cache_resizes()->Increment();
+}
+
 void StubCache::Clear() {
+  MaybeGrow();
+  evictions_ = 0;
   Tagged<MaybeObject> empty = isolate_->builtins()->code(Builtin::kIllegal);
   Tagged<Name> empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size(); j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
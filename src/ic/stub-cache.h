@@ -66,6 +66,18 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The hash masks for the tables, see PrimaryOffset() and SecondaryOffset().
+  // Generated code reads them to support growing the tables.
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
@@ -85,16 +97,30 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // Initial table sizes. With --grow-stub-cache, both tables double in size
+  // (up to kMaxTableGrowth times) when entries keep getting evicted.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kMaxTableGrowth = 3;
+  static const int kMaxPrimaryTableSize = kPrimaryTableSize << kMaxTableGrowth;
+  static const int kMaxSecondaryTableSize = kSecondaryTableSize
+                                            << kMaxTableGrowth;
 
-  static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
-  static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
+  int primary_table_size() const {
+    return (primary_mask_ >> kCacheIndexShift) + 1;
+  }
+  int secondary_table_size() const {
+    return (secondary_mask_ >> kCacheIndexShift) + 1;
+  }
+
+  int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
+  int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -109,12 +135,17 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Tagged<Name> name, Tagged<Map> map);
+  int PrimaryOffset(Tagged<Name> name, Tagged<Map> map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Tagged<Name> name, Tagged<Map> map);
+  int SecondaryOffset(Tagged<Name> name, Tagged<Map> map);
+
+  // Doubles the size of both tables if entries were evicted often enough
+  // since the last Clear(). Must be followed by clearing the tables, since
+  // entries are at different offsets afterwards.
+  void MaybeGrow();
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -131,8 +162,17 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // The tables are allocated at their maximal size up front, so that their
+  // addresses can be embedded in generated code, but only the first
+  // {primary,secondary}_table_size() entries are used. The remaining pages
+  // are never touched unless the tables grow.
+  Entry* primary_;
+  Entry* secondary_;
+  uint32_t primary_mask_ = (kPrimaryTableSize - 1) << kCacheIndexShift;
+  uint32_t secondary_mask_ = (kSecondaryTableSize - 1) << kCacheIndexShift;
+  // Number of valid entries dropped from the secondary table since the last
+  // Clear().
+  int evictions_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
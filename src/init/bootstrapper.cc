@@ -6013,6 +6013,8 @@ void Genesis::InitializeGlobal_js_base_64() {
                          .ToHandleChecked());
   SimpleInstallFunction(isolate(), uint8_array_function, "fromBase64",
                         Builtin::kUint8ArrayFromBase64, 1, kDontAdapt);
+  SimpleInstallFunction(isolate(), uint8_array_function, "fromHex",
+                        Builtin::kUint8ArrayFromHex, 1, kDontAdapt);
 
   DirectHandle<JSObject> uint8_array_prototype(
       Cast<JSObject>(
@@ -6020,6 +6022,8 @@ void Genesis::InitializeGlobal_js_base_64() {
       isolate());
   SimpleInstallFunction(isolate(), uint8_array_prototype, "toBase64",
                         Builtin::kUint8ArrayToBase64, 0, kDontAdapt);
+  SimpleInstallFunction(isolate(), uint8_array_prototype, "toHex",
+                        Builtin::kUint8ArrayToHex, 0, kDontAdapt);
 }
 
 void Genesis::InitializeGlobal_regexp_linear_flag() {
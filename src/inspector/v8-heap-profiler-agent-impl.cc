@@ -100,6 +100,25 @@ class HeapSnapshotOutputStream final : public v8::OutputStream {
   protocol::HeapProfiler::Frontend* m_frontend;
 };
 
+class HeapSnapshotBinaryOutputStream final : public v8::OutputStream {
+ public:
+  explicit HeapSnapshotBinaryOutputStream(
+      protocol::HeapProfiler::Frontend* frontend)
+      : m_frontend(frontend) {}
+  void EndOfStream() override {}
+  int GetChunkSize() override { return 1 * v8::internal::MB; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    m_frontend->addHeapSnapshotBinaryChunk(
+        protocol::Binary::fromSpan(v8::MemorySpan<const uint8_t>(
+            reinterpret_cast<const uint8_t*>(data), size)));
+    m_frontend->flush();
+    return kContinue;
+  }
+
+ private:
+  protocol::HeapProfiler::Frontend* m_frontend;
+};
+
 v8::Local<v8::Object> objectByHeapObjectId(v8::Isolate* isolate, int id) {
   v8::HeapProfiler* profiler = isolate->GetHeapProfiler();
   v8::Local<v8::Value> value = profiler->FindObjectById(id);
@@ -184,15 +203,18 @@ struct V8HeapProfilerAgentImpl::HeapSnapshotProtocolOptions {
   HeapSnapshotProtocolOptions(std::optional<bool> reportProgress,
                               std::optional<bool> treatGlobalObjectsAsRoots,
                               std::optional<bool> captureNumericValue,
-                              std::optional<bool> exposeInternals)
+                              std::optional<bool> exposeInternals,
+                              bool binaryFormat = false)
       : m_reportProgress(reportProgress.value_or(false)),
         m_treatGlobalObjectsAsRoots(treatGlobalObjectsAsRoots.value_or(true)),
         m_captureNumericValue(captureNumericValue.value_or(false)),
-        m_exposeInternals(exposeInternals.value_or(false)) {}
+        m_exposeInternals(exposeInternals.value_or(false)),
+        m_binaryFormat(binaryFormat) {}
   bool m_reportProgress;
   bool m_treatGlobalObjectsAsRoots;
   bool m_captureNumericValue;
   bool m_exposeInternals;
+  bool m_binaryFormat;
 };
 
 class V8HeapProfilerAgentImpl::HeapSnapshotTask : public v8::Task {
@@ -348,11 +370,24 @@ void V8HeapProfilerAgentImpl::takeHeapSnapshot(
     std::optional<bool> reportProgress,
     std::optional<bool> treatGlobalObjectsAsRoots,
     std::optional<bool> captureNumericValue,
-    std::optional<bool> exposeInternals,
+    std::optional<bool> exposeInternals, std::optional<String16> format,
     std::unique_ptr<TakeHeapSnapshotCallback> callback) {
+  bool binaryFormat = false;
+  if (format.has_value()) {
+    if (format.value() ==
+        protocol::HeapProfiler::TakeHeapSnapshot::FormatEnum::Binary) {
+      binaryFormat = true;
+    } else if (format.value() !=
+               protocol::HeapProfiler::TakeHeapSnapshot::FormatEnum::Json) {
+      callback->sendFailure(
+          Response::InvalidParams("Unknown heap snapshot format"));
+      return;
+    }
+  }
   HeapSnapshotProtocolOptions protocolOptions(
       std::move(reportProgress), std::move(treatGlobalObjectsAsRoots),
-      std::move(captureNumericValue), std::move(exposeInternals));
+      std::move(captureNumericValue), std::move(exposeInternals),
+      binaryFormat);
   std::shared_ptr<v8::TaskRunner> task_runner =
       v8::debug::GetCurrentPlatform()->GetForegroundTaskRunner(m_isolate);
 
@@ -404,6 +439,15 @@ Response V8HeapProfilerAgentImpl::takeHeapSnapshotNow(
           ? v8::HeapProfiler::NumericsMode::kExposeNumericValues
           : v8::HeapProfiler::NumericsMode::kHideNumericValues;
   options.stack_state = stackState;
+  if (protocolOptions.m_binaryFormat) {
+    // The binary format is written while the heap is traversed, so the
+    // snapshot graph never has to be held in memory as a whole.
+    HeapSnapshotBinaryOutputStream stream(&m_frontend);
+    if (!profiler->TakeHeapSnapshotToStream(&stream, options)) {
+      return Response::ServerError("Failed to take heap snapshot");
+    }
+    return Response::Success();
+  }
   const v8::HeapSnapshot* snapshot = profiler->TakeHeapSnapshot(options);
   if (!snapshot) return Response::ServerError("Failed to take heap snapshot");
   HeapSnapshotOutputStream stream(&m_frontend);
@@ -48,7 +48,7 @@ class V8HeapProfilerAgentImpl : public protocol::HeapProfiler::Backend {
       std::optional<bool> reportProgress,
       std::optional<bool> treatGlobalObjectsAsRoots,
       std::optional<bool> captureNumericValue,
-      std::optional<bool> exposeInternals,
+      std::optional<bool> exposeInternals, std::optional<String16> format,
       std::unique_ptr<TakeHeapSnapshotCallback> callback) override;
 
   Response getObjectByHeapObjectId(
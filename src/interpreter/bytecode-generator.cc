@@ -3238,7 +3238,8 @@ void BytecodeGenerator::AddToEagerLiteralsIfEager(FunctionLiteral* literal) {
   // position collection).
   if (!script_.is_null() && literal->should_parallel_compile()) {
     // If we should normally be eagerly compiling this function, we must be here
-    // because of post_parallel_compile_tasks_for_eager_toplevel.
+    // because of post_parallel_compile_tasks_for_eager_toplevel (possibly set
+    // by parallel_compile_tasks_for_streaming).
     DCHECK_IMPLIES(
         literal->ShouldEagerCompile(),
         info()->flags().post_parallel_compile_tasks_for_eager_toplevel());
@@ -285,7 +285,8 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
 
   // Dispatches to |target_bytecode| at BytecodeOffset(). Includes short-star
   // lookahead if the current bytecode_ is likely followed by a short-star
-  // instruction.
+  // instruction, and conditional jump lookahead if it is likely followed by a
+  // JumpIfTrue or JumpIfFalse instruction.
   void DispatchToBytecodeWithOptionalStarLookahead(
       TNode<WordT> target_bytecode);
 
@@ -449,6 +450,15 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch,
+  // including the subsequent dispatch.
+  void ConditionalJumpDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for the |jump_bytecode| conditional jump at the current
+  // BytecodeOffset(), which jumps if the accumulator is |jump_value|.
+  void InlineConditionalJump(Bytecode jump_bytecode,
+                             TNode<Boolean> jump_value);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
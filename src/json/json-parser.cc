@@ -6,6 +6,8 @@
 
 #include <optional>
 
+#include "hwy/highway.h"
+#include "src/base/numbers/strtod.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
 #include "src/common/assert-scope.h"
@@ -128,6 +130,45 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Returns the first character of [start, end) that may terminate a JSON
+// string, or {end}. For two-byte strings, the characters that don't fit in
+// one byte are accumulated in {bits} (only whether {bits} exceeds
+// Latin1::kMaxChar matters to the caller).
+//
+// Most string characters are plain, so whole blocks are skipped with SIMD; the
+// block that contains a candidate, and the remaining tail, are scanned with the
+// lookup table.
+template <typename Char>
+const Char* FindMayTerminateJsonString(const Char* start, const Char* end,
+                                       base::uc32* bits) {
+  namespace hw = hwy::HWY_NAMESPACE;
+  static constexpr size_t kStride = 16 / sizeof(Char);
+  hw::FixedTag<Char, kStride> tag;
+  const auto quote = hw::Set(tag, static_cast<Char>('"'));
+  const auto backslash = hw::Set(tag, static_cast<Char>('\\'));
+  const auto control = hw::Set(tag, static_cast<Char>(0x20));
+  auto max_char = hw::Zero(tag);
+  const Char* cursor = start;
+  for (; cursor + kStride <= end; cursor += kStride) {
+    const auto input = hw::LoadU(tag, cursor);
+    const auto mask = hw::Or(hw::Or(input == quote, input == backslash),
+                             input < control);
+    if (!hw::AllFalse(tag, mask)) break;
+    if constexpr (sizeof(Char) == 2) max_char = hw::Max(max_char, input);
+  }
+  if constexpr (sizeof(Char) == 2) {
+    Char max = hw::ReduceMax(tag, max_char);
+    if (V8_UNLIKELY(max > unibrow::Latin1::kMaxChar)) *bits |= max;
+  }
+  return std::find_if(cursor, end, [bits](Char c) {
+    if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
+      *bits |= c;
+      return false;
+    }
+    return MayTerminateJsonString(character_json_scan_flags[c]);
+  });
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -1434,6 +1475,157 @@ bool JsonParser<Char>::ParseRawJson() {
   return true;
 }
 
+template <typename Char>
+MaybeHandle<Object> JsonParser<Char>::ParseJsonProperties(
+    base::Vector<const DirectHandle<String>> names) {
+  SkipWhitespace();
+  if (peek() != JsonToken::LBRACE) {
+    return ParseJson(factory()->undefined_value());
+  }
+
+  Consume(JsonToken::LBRACE);
+  Handle<JSObject> result = factory()->NewJSObject(object_constructor_);
+  if (!Check(JsonToken::RBRACE)) {
+    bool first = true;
+    do {
+      ExpectNext(
+          JsonToken::STRING,
+          first ? MessageTemplate::kJsonParseExpectedPropNameOrRBrace
+                : MessageTemplate::kJsonParseExpectedDoubleQuotedPropertyName);
+      JsonString key = ScanJsonString(true);
+      ExpectNext(JsonToken::COLON,
+                 MessageTemplate::kJsonParseExpectedColonAfterPropertyName);
+      if (V8_UNLIKELY(isolate_->has_exception())) return {};
+      if (IsSelectedProperty(key, names)) {
+        Handle<String> name = MakeString(key);
+        Handle<Object> value;
+        if (V8_UNLIKELY(!ParseJsonValueRecursive().ToHandle(&value))) {
+          return {};
+        }
+        // Later duplicates replace earlier ones, like in ParseJsonObject.
+        CHECK(JSObject::CreateDataProperty(isolate_, result,
+                                           PropertyKey(isolate_, name), value)
+                  .FromJust());
+      } else {
+        SkipJsonValue();
+      }
+      first = false;
+    } while (Check(JsonToken::COMMA));
+    Expect(JsonToken::RBRACE,
+           MessageTemplate::kJsonParseExpectedCommaOrRBrace);
+  }
+
+  if (!Check(JsonToken::EOS)) {
+    ReportUnexpectedToken(
+        peek(), MessageTemplate::kJsonParseUnexpectedNonWhiteSpaceCharacter);
+    return {};
+  }
+  if (isolate_->has_exception()) return {};
+  return result;
+}
+
+template <typename Char>
+bool JsonParser<Char>::IsSelectedProperty(
+    const JsonString& key, base::Vector<const DirectHandle<String>> names) {
+  if (V8_UNLIKELY(key.has_escape())) {
+    DirectHandle<String> string = MakeString(key);
+    for (DirectHandle<String> name : names) {
+      if (String::Equals(isolate_, string, name)) return true;
+    }
+    return false;
+  }
+  DisallowGarbageCollection no_gc;
+  base::Vector<const Char> chars = GetKeyChars(key);
+  for (DirectHandle<String> name : names) {
+    if (name->IsEqualTo(chars, isolate_)) return true;
+  }
+  return false;
+}
+
+template <typename Char>
+void JsonParser<Char>::SkipJsonValue() {
+  // Whether each of the enclosing containers is an object or an array.
+  SmallVector<bool> in_object;
+  while (!isolate_->has_exception()) {
+    SkipWhitespace();
+    switch (peek()) {
+      case JsonToken::NUMBER: {
+        double double_value;
+        int smi_value;
+        ParseJsonNumberAsDoubleOrSmi(&double_value, &smi_value);
+        break;
+      }
+      case JsonToken::STRING:
+        Consume(JsonToken::STRING);
+        ScanJsonString(false);
+        break;
+      case JsonToken::TRUE_LITERAL:
+        ScanLiteral("true");
+        break;
+      case JsonToken::FALSE_LITERAL:
+        ScanLiteral("false");
+        break;
+      case JsonToken::NULL_LITERAL:
+        ScanLiteral("null");
+        break;
+
+      case JsonToken::LBRACE:
+        Consume(JsonToken::LBRACE);
+        if (Check(JsonToken::RBRACE)) break;
+        in_object.push_back(true);
+        ExpectNext(JsonToken::STRING,
+                   MessageTemplate::kJsonParseExpectedPropNameOrRBrace);
+        ScanJsonString(false);
+        ExpectNext(JsonToken::COLON,
+                   MessageTemplate::kJsonParseExpectedColonAfterPropertyName);
+        continue;
+      case JsonToken::LBRACK:
+        Consume(JsonToken::LBRACK);
+        if (Check(JsonToken::RBRACK)) break;
+        in_object.push_back(false);
+        continue;
+
+      case JsonToken::COLON:
+      case JsonToken::COMMA:
+      case JsonToken::ILLEGAL:
+      case JsonToken::RBRACE:
+      case JsonToken::RBRACK:
+      case JsonToken::EOS:
+        ReportUnexpectedCharacter(CurrentCharacter());
+        return;
+
+      case JsonToken::WHITESPACE:
+        UNREACHABLE();
+    }
+
+    // A value was skipped: continue with the next member of the enclosing
+    // container, or close it.
+    while (true) {
+      if (in_object.empty() || isolate_->has_exception()) return;
+      if (Check(JsonToken::COMMA)) {
+        if (in_object.back()) {
+          ExpectNext(
+              JsonToken::STRING,
+              MessageTemplate::kJsonParseExpectedDoubleQuotedPropertyName);
+          ScanJsonString(false);
+          ExpectNext(
+              JsonToken::COLON,
+              MessageTemplate::kJsonParseExpectedColonAfterPropertyName);
+        }
+        break;
+      }
+      if (in_object.back()) {
+        Expect(JsonToken::RBRACE,
+               MessageTemplate::kJsonParseExpectedCommaOrRBrace);
+      } else {
+        Expect(JsonToken::RBRACK,
+               MessageTemplate::kJsonParseExpectedCommaOrRBrack);
+      }
+      in_object.pop_back();
+    }
+  }
+}
+
 template <typename Char>
 V8_INLINE MaybeHandle<Object> JsonParser<Char>::ParseJsonValueRecursive(
     Handle<Map> feedback) {
@@ -1961,6 +2153,62 @@ void JsonParser<Char>::AdvanceToNonDecimal() {
       std::find_if(cursor_, end_, [](Char c) { return !IsDecimalDigit(c); });
 }
 
+namespace {
+
+// Converts an already validated JSON number with at most 19 significant digits
+// directly with the Eisel-Lemire algorithm. Returns false if the number has
+// more digits or the algorithm cannot decide the rounding; the caller then
+// falls back to StringToDouble.
+template <typename Char>
+bool TryFastJsonNumberToDouble(base::Vector<const Char> chars,
+                               double* result) {
+  static constexpr int kMaxSignificandDigits = 19;
+  // Larger exponents are out of range for any significand anyway.
+  static constexpr int kMaxExponent = 100000;
+  const Char* cursor = chars.begin();
+  const Char* end = chars.end();
+  bool negative = *cursor == '-';
+  if (negative) ++cursor;
+
+  uint64_t significand = 0;
+  int digits = 0;
+  int exponent = 0;
+  for (; cursor < end && IsDecimalDigit(*cursor); ++cursor) {
+    if (digits == 0 && *cursor == '0') continue;
+    if (++digits > kMaxSignificandDigits) return false;
+    significand = significand * 10 + (*cursor - '0');
+  }
+  if (cursor < end && *cursor == '.') {
+    for (++cursor; cursor < end && IsDecimalDigit(*cursor); ++cursor) {
+      exponent--;
+      if (digits == 0 && *cursor == '0') continue;
+      if (++digits > kMaxSignificandDigits) return false;
+      significand = significand * 10 + (*cursor - '0');
+    }
+  }
+  if (cursor < end) {
+    DCHECK_EQ(AsciiAlphaToLower(*cursor), 'e');
+    ++cursor;
+    bool negative_exponent = *cursor == '-';
+    if (*cursor == '-' || *cursor == '+') ++cursor;
+    int explicit_exponent = 0;
+    for (; cursor < end; ++cursor) {
+      DCHECK(IsDecimalDigit(*cursor));
+      if (explicit_exponent < kMaxExponent) {
+        explicit_exponent = explicit_exponent * 10 + (*cursor - '0');
+      }
+    }
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+
+  double value;
+  if (!base::EiselLemireStrtod(significand, exponent, &value)) return false;
+  *result = negative ? -value : value;
+  return true;
+}
+
+}  // namespace
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::ParseJsonNumber() {
   double double_number;
@@ -2063,10 +2311,12 @@ bool JsonParser<Char>::ParseJsonNumberAsDoubleOrSmi(double* result_double,
     }
 
     base::Vector<const Char> chars(start, cursor_ - start);
-    *result_double =
-        StringToDouble(chars,
-                       NO_CONVERSION_FLAG,  // Hex, octal or trailing junk.
-                       std::numeric_limits<double>::quiet_NaN());
+    if (!TryFastJsonNumberToDouble(chars, result_double)) {
+      *result_double =
+          StringToDouble(chars,
+                         NO_CONVERSION_FLAG,  // Hex, octal or trailing junk.
+                         std::numeric_limits<double>::quiet_NaN());
+    }
     DCHECK(!std::isnan(*result_double));
 
     // The result might still be a smi even if it has a decimal part.
@@ -2213,13 +2463,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
-    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
-      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
-        bits |= c;
-        return false;
-      }
-      return MayTerminateJsonString(character_json_scan_flags[c]);
-    });
+    cursor_ = FindMayTerminateJsonString(cursor_, end_, &bits);
 
     if (V8_UNLIKELY(is_at_end())) {
       AllowGarbageCollection allow_before_exception;
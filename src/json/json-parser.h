@@ -180,6 +180,18 @@ class JsonParser final {
     return result;
   }
 
+  // Parses {source} like Parse without a reviver, but if it contains an
+  // object, only materializes the values of its properties named in {names}.
+  // The values of the other properties are validated and skipped.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> ParseProperties(
+      Isolate* isolate, Handle<String> source,
+      base::Vector<const DirectHandle<String>> names) {
+    HighAllocationThroughputScope high_throughput_scope(
+        V8::GetCurrentPlatform());
+    JsonParser parser(isolate, source);
+    return parser.ParseJsonProperties(names);
+  }
+
   static constexpr base::uc32 kEndOfString = static_cast<base::uc32>(-1);
   static constexpr base::uc32 kInvalidUnicodeCharacter =
       static_cast<base::uc32>(-1);
@@ -217,6 +229,14 @@ class JsonParser final {
 
   bool ParseRawJson();
 
+  MaybeHandle<Object> ParseJsonProperties(
+      base::Vector<const DirectHandle<String>> names);
+  bool IsSelectedProperty(const JsonString& key,
+                          base::Vector<const DirectHandle<String>> names);
+  // Validates the next JSON value and advances past it, without creating any
+  // object.
+  void SkipJsonValue();
+
   void advance() { ++cursor_; }
 
   base::uc32 CurrentCharacter() {
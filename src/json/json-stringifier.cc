@@ -4,16 +4,22 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <algorithm>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include "hwy/highway.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
 #include "src/execution/protectors-inl.h"
+#include "src/logging/counters.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/heap-number-inl.h"
+#include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-raw-json-inl.h"
 #include "src/objects/lookup.h"
@@ -23,6 +29,7 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -1805,6 +1812,21 @@ class OutBuffer {
       CopyChars(dst, stack_buffer_, StackBufferLength());
     }
   }
+  // Calls {callback} with the filled parts of the segments, in order.
+  template <typename Callback>
+  void ForEachSegment(Callback callback) const {
+    if (ZoneUsed()) {
+      callback(base::Vector<const Char>(stack_buffer_, kStackBufferSize));
+      for (int i = 0; i < segments_->length() - 1; i++) {
+        callback(base::Vector<const Char>(segments_.value()[i].begin(),
+                                          kSegmentLength));
+      }
+      callback(base::Vector<const Char>(segments_->last().begin(),
+                                        CurSegmentLength()));
+    } else {
+      callback(base::Vector<const Char>(stack_buffer_, StackBufferLength()));
+    }
+  }
 
  private:
   static constexpr int kSegmentLength = 2048;
@@ -1868,6 +1890,20 @@ enum FastJsonStringifierResult {
   EXCEPTION
 };
 
+// Why FastJsonStringifier returned SLOW_PATH. Recorded in the
+// V8.JsonStringifyFastPathBailoutReason histogram, so don't reorder.
+enum class FastJsonStringifierBailoutReason : uint8_t {
+  kNone,
+  kUnsupportedType,
+  kUnsupportedObject,
+  kAccessorProperty,
+  kUnsupportedArray,
+  kNoElementsProtector,
+  kUnsupportedElementsKind,
+  kUnsupportedTypedArray,
+  kCycle,
+};
+
 template <typename Char>
 class FastJsonStringifier {
  public:
@@ -1878,6 +1914,13 @@ class FastJsonStringifier {
   void CopyResultTo(DstChar* out_buffer) {
     buffer_.CopyTo(out_buffer);
   }
+  template <typename Callback>
+  void ForEachResultChunk(Callback callback) const {
+    buffer_.ForEachSegment(callback);
+  }
+  FastJsonStringifierBailoutReason bailout_reason() const {
+    return bailout_reason_;
+  }
   V8_INLINE FastJsonStringifierResult
   SerializeObject(Tagged<JSAny> object, const DisallowGarbageCollection& no_gc);
 
@@ -1894,6 +1937,7 @@ class FastJsonStringifier {
     if (comma) AppendCharacter(',');
   }
   V8_INLINE void SerializeSmi(Tagged<Smi> object);
+  V8_INLINE void SerializeInt(int value);
   void SerializeDouble(double number);
   V8_INLINE FastJsonStringifierResult SerializeObjectKey(
       Tagged<String> key, bool comma, const DisallowGarbageCollection& no_gc);
@@ -1914,6 +1958,14 @@ class FastJsonStringifier {
   V8_INLINE FastJsonStringifierResult
   SerializeJSObject(Tagged<JSObject> obj, uint32_t start_idx,
                     const DisallowGarbageCollection& no_gc);
+  FastJsonStringifierResult SerializeDictionaryJSObject(
+      Tagged<JSObject> obj, uint32_t start_idx,
+      const DisallowGarbageCollection& no_gc);
+  V8_INLINE FastJsonStringifierResult SerializeJSObjectProperty(
+      Tagged<JSObject> obj, Tagged<String> key, Tagged<JSAny> value,
+      uint32_t next_idx, bool* comma, const DisallowGarbageCollection& no_gc);
+  const std::vector<InternalIndex>& DictionaryEnumerationOrder(
+      Tagged<JSObject> obj);
   FastJsonStringifierResult SerializeJSArray(Tagged<JSArray> array,
                                              uint32_t start_idx);
   template <ElementsKind kind>
@@ -1927,6 +1979,17 @@ class FastJsonStringifier {
   template <ElementsKind kind, typename T>
   V8_INLINE FastJsonStringifierResult SerializeFixedArrayElement(
       Tagged<T> elements, uint32_t i, Tagged<JSArray> array);
+  void SerializeDoubleElements(Tagged<FixedDoubleArray> elements,
+                               uint32_t start_index, uint32_t end_index);
+  FastJsonStringifierResult SerializeJSTypedArray(Tagged<JSTypedArray> array);
+  template <typename T>
+  FastJsonStringifierResult SerializeTypedArrayElements(const T* data,
+                                                        size_t length);
+
+  FastJsonStringifierResult Bailout(FastJsonStringifierBailoutReason reason) {
+    bailout_reason_ = reason;
+    return SLOW_PATH;
+  }
 
   FastJsonStringifierResult HandleInterruptAndCheckCycle();
   bool CheckCycle();
@@ -1990,6 +2053,13 @@ class FastJsonStringifier {
   Isolate* isolate_;
   OutBuffer<Char> buffer_;
   std::vector<ContinuationRecord> stack_;
+  FastJsonStringifierBailoutReason bailout_reason_ =
+      FastJsonStringifierBailoutReason::kNone;
+  // The properties of dictionary-mode objects sorted in enumeration order,
+  // which is computed once per object as serializing an object resumes after
+  // each of its nested objects and arrays.
+  std::unordered_map<Address, std::vector<InternalIndex>>
+      dictionary_enumeration_orders_;
 
   template <typename>
   friend class FastJsonStringifier;
@@ -2025,7 +2095,10 @@ V8_INLINE bool CanFastSerializeJSObjectFastPath(Tagged<JSObject> object,
                                                 Tagged<Map> map,
                                                 Isolate* isolate) {
   if (IsCustomElementsReceiverMap(map)) return false;
-  if (!object->HasFastProperties()) return false;
+  // Dictionary-mode objects are only supported with NameDictionaries.
+  if (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL && !object->HasFastProperties()) {
+    return false;
+  }
   auto roots = ReadOnlyRoots(isolate);
   auto elements = object->elements();
   if (elements != roots.empty_fixed_array() &&
@@ -2041,6 +2114,36 @@ V8_INLINE bool CanFastSerializeJSObjectFastPath(Tagged<JSObject> object,
   return !proto->map()->may_have_interesting_properties();
 }
 
+V8_INLINE bool CanFastSerializeJSTypedArrayFastPath(Tagged<JSTypedArray> array,
+                                                    Isolate* isolate) {
+  // Typed arrays are serialized like objects with their indices as keys, so
+  // they must not have named properties either.
+  Tagged<Map> map = array->map();
+  if (map->may_have_interesting_properties()) return false;
+  if (map->NumberOfOwnDescriptors() != 0) return false;
+  if (array->IsDetachedOrOutOfBounds() || array->buffer()->is_shared()) {
+    return false;
+  }
+  // Check that the prototype chain is the initial one (through
+  // %TypedArray%.prototype) without interesting properties (toJSON).
+  Tagged<NativeContext> native_context = map->map()->native_context();
+  Tagged<HeapObject> proto = map->prototype();
+  if (!IsJSObject(proto)) return false;
+  Tagged<Map> proto_map = proto->map();
+  if (proto_map->may_have_interesting_properties()) return false;
+  proto = proto_map->prototype();
+  if (native_context->get(Context::TYPED_ARRAY_PROTOTYPE_INDEX) != proto) {
+    return false;
+  }
+  proto_map = proto->map();
+  if (proto_map->may_have_interesting_properties()) return false;
+  proto = proto_map->prototype();
+  if (native_context->get(Context::INITIAL_OBJECT_PROTOTYPE_INDEX) != proto) {
+    return false;
+  }
+  return !proto->map()->may_have_interesting_properties();
+}
+
 }  // namespace
 
 template <typename Char>
@@ -2051,11 +2154,16 @@ template <typename Char>
 void FastJsonStringifier<Char>::SerializeSmi(Tagged<Smi> object) {
   static_assert(Smi::kMaxValue <= 2147483647);
   static_assert(Smi::kMinValue >= -2147483648);
+  SerializeInt(object.value());
+}
+
+template <typename Char>
+void FastJsonStringifier<Char>::SerializeInt(int value) {
   // sizeof(string) includes \0.
   static constexpr int kBufferSize = sizeof("-2147483648") - 1;
   char chars[kBufferSize];
   base::Vector<char> buffer(chars, kBufferSize);
-  AppendString(IntToStringView(object.value(), buffer));
+  AppendString(IntToStringView(value, buffer));
 }
 
 template <typename Char>
@@ -2064,6 +2172,12 @@ void FastJsonStringifier<Char>::SerializeDouble(double number) {
     AppendCStringLiteral("null");
     return;
   }
+  // Integral values are common in double arrays and typed arrays, and don't
+  // need the shortest representation search of DoubleToStringView.
+  if (IsInt32Double(number)) {
+    SerializeInt(static_cast<int>(number));
+    return;
+  }
   static constexpr int kBufferSize = 100;
   char chars[kBufferSize];
   base::Vector<char> buffer(chars, kBufferSize);
@@ -2273,9 +2387,10 @@ FastJsonStringifierResult FastJsonStringifier<Char>::TrySerializeSimpleObject(
       return UNDEFINED;
     case JS_OBJECT_TYPE:
     case JS_ARRAY_TYPE:
+    case JS_TYPED_ARRAY_TYPE:
       return UNCHANGED;
     default:
-      return SLOW_PATH;
+      return Bailout(FastJsonStringifierBailoutReason::kUnsupportedType);
   }
 
   UNREACHABLE();
@@ -2287,7 +2402,10 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSObject(
     const DisallowGarbageCollection& no_gc) {
   Tagged<Map> map = obj->map();
   if (V8_UNLIKELY(!CanFastSerializeJSObjectFastPath(obj, map, isolate_))) {
-    return SLOW_PATH;
+    return Bailout(FastJsonStringifierBailoutReason::kUnsupportedObject);
+  }
+  if (V8_UNLIKELY(map->is_dictionary_map())) {
+    return SerializeDictionaryJSObject(obj, start_idx, no_gc);
   }
   if (map->NumberOfOwnDescriptors() == 0) {
     AppendCStringLiteral("{}");
@@ -2314,65 +2432,143 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSObject(
         continue;
       }
       if (V8_UNLIKELY(details.location() != PropertyLocation::kField)) {
-        return SLOW_PATH;
+        return Bailout(FastJsonStringifierBailoutReason::kAccessorProperty);
       }
       DCHECK_EQ(PropertyKind::kData, details.kind());
       FieldIndex field_index = FieldIndex::ForDetails(map, details);
       Tagged<JSAny> property = obj->RawFastPropertyAt(field_index);
-      Tagged<String> key_name = Cast<String>(name);
       FastJsonStringifierResult result =
-          TrySerializeSimpleObject<true>(property, comma, key_name);
-      switch (result) {
-        case SUCCESS:
-          comma = true;
-          break;
-        case UNDEFINED:
-          break;
-        case UNCHANGED:
-          stack_.emplace_back(ContinuationRecord::kObject, obj,
-                              i.as_uint32() + 1);
-          // property can be an object or array. We don't need to distinguish
-          // as index is 0 anyways.
-          stack_.emplace_back(ContinuationRecord::kObject, property, 0);
-          result = SerializeObjectKey(key_name, comma, no_gc);
-          if constexpr (is_one_byte) {
-            if (V8_UNLIKELY(result != SUCCESS)) {
-              DCHECK_EQ(result, CHANGE_ENCODING);
-              stack_.emplace_back(ContinuationRecord::kObjectKey, key_name,
-                                  comma);
-              return result;
-            }
-          }
-          return result;
-        case CHANGE_ENCODING:
-          DCHECK(is_one_byte);
-          stack_.emplace_back(ContinuationRecord::kObject, obj,
-                              i.as_uint32() + 1);
-          stack_.emplace_back(ContinuationRecord::kResumeFromOther, property,
-                              0);
-          result = SerializeObjectKey(key_name, comma, no_gc);
-          if (V8_UNLIKELY(result != SUCCESS)) {
-            stack_.emplace_back(ContinuationRecord::kObjectKey, key_name,
-                                comma);
-            return result;
-          }
-          DCHECK(IsString(property));
-          return result;
-        case SLOW_PATH:
-        case EXCEPTION:
-          return result;
-      }
+          SerializeJSObjectProperty(obj, Cast<String>(name), property,
+                                    i.as_uint32() + 1, &comma, no_gc);
+      if (V8_UNLIKELY(result != SUCCESS)) return result;
     }
   }
   AppendCharacter('}');
   return SUCCESS;
 }
 
+template <typename Char>
+FastJsonStringifierResult
+FastJsonStringifier<Char>::SerializeDictionaryJSObject(
+    Tagged<JSObject> obj, uint32_t start_idx,
+    const DisallowGarbageCollection& no_gc) {
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    UNREACHABLE();
+  } else {
+    // Unlike for fast-mode objects, interesting properties (toJSON) are
+    // tracked on the dictionary.
+    if (V8_UNLIKELY(
+            obj->property_dictionary()->may_have_interesting_properties())) {
+      return Bailout(FastJsonStringifierBailoutReason::kUnsupportedObject);
+    }
+    const std::vector<InternalIndex>& entries = DictionaryEnumerationOrder(obj);
+    if (entries.empty()) {
+      AppendCStringLiteral("{}");
+      return SUCCESS;
+    }
+    uint32_t length = static_cast<uint32_t>(entries.size());
+    if (start_idx < length) {
+      bool comma = true;
+      if (start_idx == 0) {
+        AppendCharacter('{');
+        comma = false;
+      }
+      Tagged<NameDictionary> dictionary = obj->property_dictionary();
+      for (uint32_t i = start_idx; i < length; i++) {
+        InternalIndex entry = entries[i];
+        PropertyDetails details = dictionary->DetailsAt(entry);
+        if (V8_UNLIKELY(details.kind() != PropertyKind::kData)) {
+          return Bailout(FastJsonStringifierBailoutReason::kAccessorProperty);
+        }
+        FastJsonStringifierResult result = SerializeJSObjectProperty(
+            obj, Cast<String>(dictionary->KeyAt(entry)),
+            Cast<JSAny>(dictionary->ValueAt(entry)), i + 1, &comma, no_gc);
+        if (V8_UNLIKELY(result != SUCCESS)) return result;
+      }
+    }
+    AppendCharacter('}');
+    return SUCCESS;
+  }
+}
+
+template <typename Char>
+const std::vector<InternalIndex>&
+FastJsonStringifier<Char>::DictionaryEnumerationOrder(Tagged<JSObject> obj) {
+  DCHECK(!V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL);
+  auto [it, inserted] = dictionary_enumeration_orders_.try_emplace(obj.ptr());
+  std::vector<InternalIndex>& entries = it->second;
+  if (!inserted) return entries;
+  Tagged<NameDictionary> dictionary = obj->property_dictionary();
+  ReadOnlyRoots roots(isolate_);
+  for (InternalIndex entry : dictionary->IterateEntries()) {
+    Tagged<Object> key;
+    if (!dictionary->ToKey(roots, entry, &key)) continue;
+    // Symbols and non-enumerable properties are skipped by JSON.stringify.
+    if (IsSymbol(key) || dictionary->DetailsAt(entry).IsDontEnum()) continue;
+    DCHECK(IsInternalizedString(key));
+    entries.push_back(entry);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [dictionary](InternalIndex a, InternalIndex b) {
+              return dictionary->DetailsAt(a).dictionary_index() <
+                     dictionary->DetailsAt(b).dictionary_index();
+            });
+  return entries;
+}
+
+// Serializes the property {key} of {obj}, and returns SUCCESS if the
+// serialization of {obj} can continue with its next property. Otherwise,
+// {next_idx} is the index of the property to resume from.
+template <typename Char>
+FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSObjectProperty(
+    Tagged<JSObject> obj, Tagged<String> key, Tagged<JSAny> value,
+    uint32_t next_idx, bool* comma, const DisallowGarbageCollection& no_gc) {
+  FastJsonStringifierResult result =
+      TrySerializeSimpleObject<true>(value, *comma, key);
+  switch (result) {
+    case SUCCESS:
+      *comma = true;
+      return SUCCESS;
+    case UNDEFINED:
+      return SUCCESS;
+    case UNCHANGED:
+      stack_.emplace_back(ContinuationRecord::kObject, obj, next_idx);
+      // value can be an object or array. We don't need to distinguish
+      // as index is 0 anyways.
+      stack_.emplace_back(ContinuationRecord::kObject, value, 0);
+      result = SerializeObjectKey(key, *comma, no_gc);
+      if constexpr (is_one_byte) {
+        if (V8_UNLIKELY(result != SUCCESS)) {
+          DCHECK_EQ(result, CHANGE_ENCODING);
+          stack_.emplace_back(ContinuationRecord::kObjectKey, key, *comma);
+          return result;
+        }
+      }
+      // The caller returns to the main loop, which serializes {value}.
+      return result == SUCCESS ? UNCHANGED : result;
+    case CHANGE_ENCODING:
+      DCHECK(is_one_byte);
+      stack_.emplace_back(ContinuationRecord::kObject, obj, next_idx);
+      stack_.emplace_back(ContinuationRecord::kResumeFromOther, value, 0);
+      result = SerializeObjectKey(key, *comma, no_gc);
+      if (V8_UNLIKELY(result != SUCCESS)) {
+        stack_.emplace_back(ContinuationRecord::kObjectKey, key, *comma);
+        return result;
+      }
+      DCHECK(IsString(value));
+      return CHANGE_ENCODING;
+    case SLOW_PATH:
+    case EXCEPTION:
+      return result;
+  }
+  UNREACHABLE();
+}
+
 template <typename Char>
 FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSArray(
     Tagged<JSArray> array, uint32_t start_idx) {
   if (V8_UNLIKELY(!CanFastSerializeJSArrayFastPath(array, isolate_))) {
-    return SLOW_PATH;
+    return Bailout(FastJsonStringifierBailoutReason::kUnsupportedArray);
   }
   uint32_t length = 0;
   CHECK(Object::ToArrayLength(array->length(), &length));
@@ -2390,7 +2586,8 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSArray(
   case kind:                                                              \
     if constexpr (IsHoleyElementsKind(kind)) {                            \
       if (V8_UNLIKELY(!Protectors::IsNoElementsIntact(isolate_))) {       \
-        return SLOW_PATH;                                                 \
+        return Bailout(                                                   \
+            FastJsonStringifierBailoutReason::kNoElementsProtector);      \
       }                                                                   \
     }                                                                     \
     if (V8_UNLIKELY(length > kArrayInterruptLength)) {                    \
@@ -2408,7 +2605,8 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSArray(
       CASE(HOLEY_DOUBLE_ELEMENTS)
 #undef CASE
       default:
-        return SLOW_PATH;
+        return Bailout(
+            FastJsonStringifierBailoutReason::kUnsupportedElementsKind);
     }
   }
   if (result == SUCCESS) {
@@ -2437,10 +2635,16 @@ FastJsonStringifier<Char>::SerializeFixedArrayWithInterruptCheck(
 
   uint32_t i = start_index;
   while (true) {
-    for (; i < limit; i++) {
-      FastJsonStringifierResult result = SerializeFixedArrayElement<kind>(
-          Cast<ArrayT>(array->elements()), i, array);
-      if (result != SUCCESS) return result;
+    if constexpr (kind == PACKED_DOUBLE_ELEMENTS) {
+      SerializeDoubleElements(Cast<FixedDoubleArray>(array->elements()), i,
+                              limit);
+      i = limit;
+    } else {
+      for (; i < limit; i++) {
+        FastJsonStringifierResult result = SerializeFixedArrayElement<kind>(
+            Cast<ArrayT>(array->elements()), i, array);
+        if (result != SUCCESS) return result;
+      }
     }
     if (i >= length) return SUCCESS;
     DCHECK_LT(limit, kMaxAllowedFastPackedLength);
@@ -2468,6 +2672,11 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeFixedArray(
   using ArrayT = std::conditional_t<IsDoubleElementsKind(kind),
                                     FixedDoubleArray, FixedArray>;
 
+  if constexpr (kind == PACKED_DOUBLE_ELEMENTS) {
+    SerializeDoubleElements(Cast<FixedDoubleArray>(array->elements()),
+                            start_index, limit);
+    return SUCCESS;
+  }
   for (uint32_t i = start_index; i < limit; i++) {
     FastJsonStringifierResult result = SerializeFixedArrayElement<kind>(
         Cast<ArrayT>(array->elements()), i, array);
@@ -2476,6 +2685,26 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeFixedArray(
   return SUCCESS;
 }
 
+template <typename Char>
+void FastJsonStringifier<Char>::SerializeDoubleElements(
+    Tagged<FixedDoubleArray> elements, uint32_t start_index,
+    uint32_t end_index) {
+  // Packed double arrays contain no holes, so their elements can be converted
+  // in batches into a stack buffer that is appended at once.
+  static constexpr uint32_t kBatchSize = 32;
+  double values[kBatchSize];
+  char chars[kBatchSize * kDoubleToJsonMaxLength];
+  for (uint32_t i = start_index; i < end_index; i += kBatchSize) {
+    uint32_t count = std::min(kBatchSize, end_index - i);
+    for (uint32_t j = 0; j < count; j++) {
+      values[j] = elements->get_scalar(i + j);
+    }
+    AppendString(DoublesToJsonStringView(
+        base::Vector<const double>(values, count), i > 0,
+        base::Vector<char>(chars, arraysize(chars))));
+  }
+}
+
 template <typename Char>
 template <ElementsKind kind, typename T>
 FastJsonStringifierResult FastJsonStringifier<Char>::SerializeFixedArrayElement(
@@ -2516,6 +2745,68 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeFixedArrayElement(
   return SUCCESS;
 }
 
+template <typename Char>
+FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSTypedArray(
+    Tagged<JSTypedArray> array) {
+  if (V8_UNLIKELY(!CanFastSerializeJSTypedArrayFastPath(array, isolate_))) {
+    return Bailout(FastJsonStringifierBailoutReason::kUnsupportedTypedArray);
+  }
+  size_t length = array->GetLength();
+  // The keys are serialized as ints.
+  if (V8_UNLIKELY(length > static_cast<size_t>(kMaxInt))) {
+    return Bailout(FastJsonStringifierBailoutReason::kUnsupportedTypedArray);
+  }
+  void* data = array->DataPtr();
+  switch (array->GetElementsKind()) {
+#define CASE(kind, ctype) \
+  case kind:              \
+    return SerializeTypedArrayElements(static_cast<const ctype*>(data), length);
+    CASE(UINT8_ELEMENTS, uint8_t)
+    CASE(UINT8_CLAMPED_ELEMENTS, uint8_t)
+    CASE(INT8_ELEMENTS, int8_t)
+    CASE(UINT16_ELEMENTS, uint16_t)
+    CASE(INT16_ELEMENTS, int16_t)
+    CASE(UINT32_ELEMENTS, uint32_t)
+    CASE(INT32_ELEMENTS, int32_t)
+    CASE(FLOAT32_ELEMENTS, float)
+    CASE(FLOAT64_ELEMENTS, double)
+#undef CASE
+    default:
+      // BigInts throw, and Float16 values need a conversion.
+      return Bailout(FastJsonStringifierBailoutReason::kUnsupportedTypedArray);
+  }
+}
+
+template <typename Char>
+template <typename T>
+FastJsonStringifierResult
+FastJsonStringifier<Char>::SerializeTypedArrayElements(const T* data,
+                                                       size_t length) {
+  if (length == 0) {
+    AppendCStringLiteral("{}");
+    return SUCCESS;
+  }
+  AppendCharacter('{');
+  for (size_t i = 0; i < length; i++) {
+    if (V8_UNLIKELY(i % kArrayInterruptLength == kArrayInterruptLength - 1)) {
+      FastJsonStringifierResult result = HandleInterruptAndCheckCycle();
+      if (result != SUCCESS) return result;
+    }
+    Separator(i > 0);
+    AppendCharacter('"');
+    SerializeInt(static_cast<int>(i));
+    AppendCStringLiteral("\":");
+    if constexpr (std::is_integral_v<T> &&
+                  (std::is_signed_v<T> || sizeof(T) < sizeof(int))) {
+      SerializeInt(data[i]);
+    } else {
+      SerializeDouble(static_cast<double>(data[i]));
+    }
+  }
+  AppendCharacter('}');
+  return SUCCESS;
+}
+
 template <typename Char>
 template <typename OldChar>
   requires(sizeof(OldChar) < sizeof(Char))
@@ -2625,8 +2916,14 @@ FastJsonStringifierResult FastJsonStringifier<Char>::SerializeObject(
         result = SerializeJSArray(Cast<JSArray>(obj), array_cont_idx);
         break;
       }
+      case JS_TYPED_ARRAY_TYPE: {
+        // Typed arrays only contain numbers and are serialized at once.
+        DCHECK_EQ(obj_cont_idx, 0);
+        result = SerializeJSTypedArray(Cast<JSTypedArray>(obj));
+        break;
+      }
       default:
-        return SLOW_PATH;
+        return Bailout(FastJsonStringifierBailoutReason::kUnsupportedType);
     }
     static_assert(SUCCESS == 0);
     static_assert(UNCHANGED == 1);
@@ -2660,7 +2957,7 @@ FastJsonStringifier<Char>::HandleInterruptAndCheckCycle() {
   if (CheckCycle()) {
     // TODO(pthier): Construct exception message on fast-path and avoid falling
     // back to slow path just to handle the exception.
-    return SLOW_PATH;
+    return Bailout(FastJsonStringifierBailoutReason::kCycle);
   }
 
   return SUCCESS;
@@ -2848,6 +3145,15 @@ bool CanUseFastStringifier(DirectHandle<JSAny> replacer,
          IsUndefined(*gap);
 }
 
+template <typename Char>
+void RecordBailoutReason(Isolate* isolate,
+                         const FastJsonStringifier<Char>& stringifier) {
+  DCHECK_NE(stringifier.bailout_reason(),
+            FastJsonStringifierBailoutReason::kNone);
+  isolate->counters()->json_stringify_fast_path_bailout_reason()->AddSample(
+      static_cast<int>(stringifier.bailout_reason()));
+}
+
 MaybeDirectHandle<Object> FastJsonStringify(Isolate* isolate,
                                             Handle<JSAny> object) {
   DisallowGarbageCollection no_gc;
@@ -2899,6 +3205,11 @@ MaybeDirectHandle<Object> FastJsonStringify(Isolate* isolate,
   } else if (result == UNDEFINED) {
     return isolate->factory()->undefined_value();
   } else if (result == SLOW_PATH) {
+    if (result_is_one_byte) {
+      RecordBailoutReason(isolate, one_byte_stringifier);
+    } else {
+      RecordBailoutReason(isolate, *two_byte_stringifier);
+    }
     // TODO(pthier): Resume instead of restarting.
     AllowGarbageCollection allow_gc;
     JsonStringifier stringifier(isolate);
@@ -2923,5 +3234,125 @@ MaybeDirectHandle<Object> JsonStringify(Isolate* isolate, Handle<JSAny> object,
   }
 }
 
+namespace {
+
+// Encodes the characters of a JSON result as UTF-8, and passes them to the
+// sink in chunks of at most kChunkSize bytes. Surrogate pairs may be split
+// across the segments of the result.
+class Utf8ChunkWriter {
+ public:
+  explicit Utf8ChunkWriter(v8::JSON::OutputSink* sink) : sink_(sink) {}
+
+  template <typename Char>
+  void Write(base::Vector<const Char> chars) {
+    for (Char c : chars) {
+      if constexpr (sizeof(Char) == 2) {
+        if (V8_UNLIKELY(pending_lead_ != 0)) {
+          base::uc32 lead = pending_lead_;
+          pending_lead_ = 0;
+          if (unibrow::Utf16::IsTrailSurrogate(c)) {
+            Put(unibrow::Utf16::CombineSurrogatePair(lead, c));
+            continue;
+          }
+          Put(lead);
+        }
+        if (V8_UNLIKELY(unibrow::Utf16::IsLeadSurrogate(c))) {
+          pending_lead_ = c;
+          continue;
+        }
+      }
+      Put(c);
+    }
+  }
+
+  void Finish() {
+    if (pending_lead_ != 0) Put(pending_lead_);
+    if (length_ > 0) sink_->WriteUtf8Chunk(chunk_, length_);
+    length_ = 0;
+  }
+
+ private:
+  static constexpr size_t kChunkSize = 4096;
+
+  V8_INLINE void Put(base::uc32 c) {
+    if (V8_UNLIKELY(length_ + unibrow::Utf8::kMaxEncodedSize > kChunkSize)) {
+      sink_->WriteUtf8Chunk(chunk_, length_);
+      length_ = 0;
+    }
+    // Lone surrogates can't be encoded and are replaced.
+    length_ += unibrow::Utf8::Encode(chunk_ + length_, c,
+                                     unibrow::Utf16::kNoPreviousCharacter,
+                                     true);
+  }
+
+  v8::JSON::OutputSink* sink_;
+  base::uc32 pending_lead_ = 0;
+  size_t length_ = 0;
+  char chunk_[kChunkSize];
+};
+
+}  // namespace
+
+Maybe<bool> JsonStringifyTo(Isolate* isolate, Handle<JSAny> object,
+                            Handle<Object> gap, v8::JSON::OutputSink* sink) {
+  Handle<JSAny> undefined = isolate->factory()->undefined_value();
+  Utf8ChunkWriter writer(sink);
+  if (CanUseFastStringifier(undefined, gap)) {
+    // Write the segments of the fast stringifiers directly, without creating
+    // the result string.
+    DisallowGarbageCollection no_gc;
+    FastJsonStringifier<uint8_t> one_byte_stringifier(isolate);
+    std::optional<FastJsonStringifier<base::uc16>> two_byte_stringifier;
+    FastJsonStringifierResult result =
+        one_byte_stringifier.SerializeObject(*object, no_gc);
+    if (result == CHANGE_ENCODING) {
+      two_byte_stringifier.emplace(isolate);
+      result = two_byte_stringifier->ResumeFrom(one_byte_stringifier, no_gc);
+      DCHECK_NE(result, CHANGE_ENCODING);
+    }
+    if (V8_LIKELY(result == SUCCESS)) {
+      auto write = [&writer](auto chunk) { writer.Write(chunk); };
+      one_byte_stringifier.ForEachResultChunk(write);
+      if (two_byte_stringifier.has_value()) {
+        two_byte_stringifier->ForEachResultChunk(write);
+      }
+      writer.Finish();
+      return Just(true);
+    } else if (result == UNDEFINED) {
+      return Just(false);
+    } else if (result == EXCEPTION) {
+      CHECK(isolate->has_exception());
+      return Nothing<bool>();
+    }
+    DCHECK_EQ(result, SLOW_PATH);
+    if (two_byte_stringifier.has_value()) {
+      RecordBailoutReason(isolate, *two_byte_stringifier);
+    } else {
+      RecordBailoutReason(isolate, one_byte_stringifier);
+    }
+  }
+
+  // The slow path needs the result string.
+  JsonStringifier stringifier(isolate);
+  DirectHandle<Object> result;
+  if (!stringifier.Stringify(object, undefined, gap).ToHandle(&result)) {
+    return Nothing<bool>();
+  }
+  if (IsUndefined(*result, isolate)) return Just(false);
+  DirectHandle<String> string =
+      String::Flatten(isolate, Cast<String>(result));
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = string->GetFlatContent(no_gc);
+    if (content.IsOneByte()) {
+      writer.Write(content.ToOneByteVector());
+    } else {
+      writer.Write(content.ToUC16Vector());
+    }
+  }
+  writer.Finish();
+  return Just(true);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -35,7 +35,8 @@ constexpr int kMaxThreadPoolSize = 16;
 int GetActualThreadPoolSize(int thread_pool_size) {
   DCHECK_GE(thread_pool_size, 0);
   if (thread_pool_size < 1) {
-    thread_pool_size = base::SysInfo::NumberOfProcessors() - 1;
+    // Respect CPU quotas so that jobs don't oversubscribe containers.
+    thread_pool_size = base::SysInfo::NumberOfAvailableProcessors() - 1;
   }
   return std::max(std::min(thread_pool_size, kMaxThreadPoolSize), 1);
 }
@@ -143,6 +144,8 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
             time_function_for_testing_ ? time_function_for_testing_
                                        : DefaultTimeFunction,
             priority_from_index(i));
+    worker_threads_task_runners_[i]->SetDelayedTaskSlack(
+        delayed_task_slack_in_seconds_);
   }
   DCHECK_NOT_NULL(worker_threads_task_runners_[0]);
 }
@@ -155,6 +158,15 @@ void DefaultPlatform::SetTimeFunctionForTesting(
   DCHECK(foreground_task_runner_map_.empty());
 }
 
+void DefaultPlatform::SetDelayedTaskSlack(double slack_in_seconds) {
+  base::SpinningMutexGuard guard(&lock_);
+  delayed_task_slack_in_seconds_ = slack_in_seconds;
+  if (!worker_threads_task_runners_[0]) return;
+  for (int i = 0; i < num_worker_runners(); i++) {
+    worker_threads_task_runners_[i]->SetDelayedTaskSlack(slack_in_seconds);
+  }
+}
+
 bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate,
                                       MessageLoopBehavior wait_for_work) {
   bool failed_result = wait_for_work == MessageLoopBehavior::kWaitForWork;
@@ -53,6 +53,10 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void SetTimeFunctionForTesting(TimeFunction time_function);
 
+  // Lets delayed worker tasks run up to |slack_in_seconds| after their
+  // deadline, which batches wake-ups of otherwise idle worker threads.
+  void SetDelayedTaskSlack(double slack_in_seconds);
+
   // v8::Platform implementation.
   int NumberOfWorkerThreads() override;
   std::shared_ptr<TaskRunner> GetForegroundTaskRunner(
@@ -116,6 +120,7 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   const PriorityMode priority_mode_;
   TimeFunction time_function_for_testing_ = nullptr;
+  double delayed_task_slack_in_seconds_ = 0.0;
 };
 
 }  // namespace platform
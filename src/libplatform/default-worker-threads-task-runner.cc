@@ -4,6 +4,8 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
+#include <algorithm>
+
 #include "src/base/platform/time.h"
 #include "src/libplatform/delayed-task-queue.h"
 
@@ -14,8 +16,11 @@ DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function,
     base::Thread::Priority priority)
     : queue_(time_function), time_function_(time_function) {
+  for (uint32_t i = 0; i < std::max(thread_pool_size, 1u); ++i) {
+    work_queues_.push_back(std::make_unique<WorkQueue>());
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this, priority));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, i, priority));
   }
 }
 
@@ -25,12 +30,19 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
+void DefaultWorkerThreadsTaskRunner::SetDelayedTaskSlack(
+    double slack_in_seconds) {
+  base::MutexGuard guard(&lock_);
+  queue_.set_slack(slack_in_seconds);
+}
+
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   {
     base::MutexGuard guard(&lock_);
     terminated_ = true;
     queue_.Terminate();
     idle_threads_.clear();
+    num_idle_threads_ = 0;
   }
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
@@ -38,14 +50,21 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
 
 void DefaultWorkerThreadsTaskRunner::PostTaskImpl(
     std::unique_ptr<Task> task, const SourceLocation& location) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
-
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  WorkQueue& work_queue =
+      *work_queues_[next_work_queue_.fetch_add(1, std::memory_order_relaxed) %
+                    work_queues_.size()];
+  {
+    base::MutexGuard guard(&work_queue.mutex);
+    work_queue.tasks.push_back(std::move(task));
   }
+
+  // Pairs with the idle check in WorkerThread::Run(): either the worker going
+  // idle sees the new task, or we see the idle worker and wake it up.
+  num_queued_tasks_.fetch_add(1, std::memory_order_seq_cst);
+  if (num_idle_threads_.load(std::memory_order_seq_cst) == 0) return;
+  base::MutexGuard guard(&lock_);
+  NotifyIdleThreadLocked();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTaskImpl(
@@ -53,12 +72,43 @@ void DefaultWorkerThreadsTaskRunner::PostDelayedTaskImpl(
     const SourceLocation& location) {
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
-  queue_.AppendDelayed(std::move(task), delay_in_seconds);
+  // Idle threads already wait for an earlier deadline unless the new task is
+  // the first one due.
+  if (queue_.AppendDelayed(std::move(task), delay_in_seconds)) {
+    NotifyIdleThreadLocked();
+  }
+}
 
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TakeTask(size_t index) {
+  if (num_queued_tasks_.load(std::memory_order_relaxed) == 0) return {};
+  const size_t num_work_queues = work_queues_.size();
+  for (size_t i = 0; i < num_work_queues; ++i) {
+    WorkQueue& work_queue = *work_queues_[(index + i) % num_work_queues];
+    base::MutexGuard guard(&work_queue.mutex);
+    if (work_queue.tasks.empty()) continue;
+    std::unique_ptr<Task> task = std::move(work_queue.tasks.front());
+    work_queue.tasks.pop_front();
+    num_queued_tasks_.fetch_sub(1, std::memory_order_relaxed);
+    return task;
   }
+  return {};
+}
+
+void DefaultWorkerThreadsTaskRunner::NotifyIdleThreadLocked() {
+  lock_.AssertHeld();
+  if (idle_threads_.empty()) return;
+  idle_threads_.back()->Notify();
+  idle_threads_.pop_back();
+  num_idle_threads_.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+void DefaultWorkerThreadsTaskRunner::RemoveIdleThreadLocked(
+    WorkerThread* thread) {
+  lock_.AssertHeld();
+  auto it = std::find(idle_threads_.begin(), idle_threads_.end(), thread);
+  if (it == idle_threads_.end()) return;
+  idle_threads_.erase(it);
+  num_idle_threads_.fetch_sub(1, std::memory_order_seq_cst);
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTaskImpl(
@@ -73,10 +123,12 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
+    DefaultWorkerThreadsTaskRunner* runner, size_t index,
+    base::Thread::Priority priority)
     : Thread(
           Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread", priority)),
-      runner_(runner) {
+      runner_(runner),
+      index_(index) {
   CHECK(Start());
 }
 
@@ -86,8 +138,14 @@ DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() {
 }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  base::MutexGuard guard(&runner_->lock_);
   while (true) {
+    // Immediate tasks don't need |lock_|.
+    if (std::unique_ptr<Task> task = runner_->TakeTask(index_)) {
+      task->Run();
+      continue;
+    }
+
+    base::MutexGuard guard(&runner_->lock_);
     DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
     switch (next_task.state) {
       case DelayedTaskQueue::MaybeNextTask::kTask:
@@ -96,19 +154,30 @@ void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
         runner_->lock_.Lock();
         continue;
       case DelayedTaskQueue::MaybeNextTask::kTerminated:
+        // Run the immediate tasks that were posted before termination.
+        if (runner_->num_queued_tasks_.load() > 0) continue;
         return;
       case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
-        runner_->idle_threads_.push_back(this);
-        condition_var_.Wait(&runner_->lock_);
-        continue;
       case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
-        // WaitFor unfortunately doesn't care about our fake time and will wait
-        // the 'real' amount of time, based on whatever clock the system call
-        // uses.
         runner_->idle_threads_.push_back(this);
-        bool notified =
-            condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
-        USE(notified);
+        runner_->num_idle_threads_.fetch_add(1, std::memory_order_seq_cst);
+        // Pairs with PostTaskImpl(): an immediate task that was posted before
+        // we became idle must not be left waiting.
+        if (runner_->num_queued_tasks_.load(std::memory_order_seq_cst) == 0) {
+          if (next_task.state ==
+              DelayedTaskQueue::MaybeNextTask::kWaitIndefinite) {
+            condition_var_.Wait(&runner_->lock_);
+          } else {
+            // WaitFor unfortunately doesn't care about our fake time and will
+            // wait the 'real' amount of time, based on whatever clock the
+            // system call uses.
+            bool notified =
+                condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
+            USE(notified);
+          }
+        }
+        // Still registered as idle if we timed out or woke up spuriously.
+        runner_->RemoveIdleThreadLocked(this);
         continue;
     }
   }
@@ -5,6 +5,8 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -33,6 +35,10 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
+  // Lets delayed tasks run up to |slack_in_seconds| late, so that tasks with
+  // nearby deadlines share one wake-up of a worker thread.
+  void SetDelayedTaskSlack(double slack_in_seconds);
+
   // v8::TaskRunner implementation.
   bool IdleTasksEnabled() override;
 
@@ -49,8 +55,8 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner,
-                          base::Thread::Priority priority);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, size_t index,
+                 base::Thread::Priority priority);
     ~WorkerThread() override;
 
     WorkerThread(const WorkerThread&) = delete;
@@ -63,23 +69,48 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
+    // Index of the work queue this thread takes tasks from first.
+    const size_t index_;
     base::ConditionVariable condition_var_;
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  // Immediate tasks are spread round-robin over one queue per worker thread.
+  // Each queue has its own lock, so posting and running tasks on different
+  // queues does not contend.
+  struct WorkQueue {
+    base::Mutex mutex;
+    std::deque<std::unique_ptr<Task>> tasks;
+  };
+
+  // Called by the WorkerThread. Takes an immediate task from the work queue
+  // with the given index, or steals one from another queue if that one is
+  // empty. Returns nullptr if all queues are empty. Does not block.
+  std::unique_ptr<Task> TakeTask(size_t index);
+
+  // Wakes up the most recently idle thread, if any. Requires |lock_|.
+  void NotifyIdleThreadLocked();
+  // Removes |thread| from |idle_threads_| if it is still there. Requires
+  // |lock_|.
+  void RemoveIdleThreadLocked(WorkerThread* thread);
 
-  bool terminated_ = false;
+  std::atomic<bool> terminated_{false};
+  // Protects |queue_| and |idle_threads_|.
   base::Mutex lock_;
   // Vector of idle threads -- these are pushed in LIFO order, so that the most
   // recently active thread is the first to be reactivated.
   std::vector<WorkerThread*> idle_threads_;
+  // Size of |idle_threads_|, readable without |lock_| so that posting a task
+  // only takes |lock_| when there is a thread to wake up.
+  std::atomic<size_t> num_idle_threads_{0};
+  // Number of tasks in |work_queues_|.
+  std::atomic<size_t> num_queued_tasks_{0};
+  std::atomic<size_t> next_work_queue_{0};
+  std::vector<std::unique_ptr<WorkQueue>> work_queues_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
-  // Worker threads access this queue, so we can only destroy it after all
-  // workers stopped.
+  // Worker threads access these queues, so we can only destroy them after all
+  // workers stopped. |queue_| only holds delayed tasks; immediate tasks go to
+  // |work_queues_|.
   DelayedTaskQueue queue_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
   TimeFunction time_function_;
 };
 
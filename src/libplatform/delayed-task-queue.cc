@@ -28,14 +28,13 @@ void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
   task_queue_.push(std::move(task));
 }
 
-void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
+bool DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
                                      double delay_in_seconds) {
   DCHECK_GE(delay_in_seconds, 0.0);
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
-  {
-    DCHECK(!terminated_);
-    delayed_task_queue_.emplace(deadline, std::move(task));
-  }
+  DCHECK(!terminated_);
+  auto it = delayed_task_queue_.emplace(deadline, std::move(task));
+  return it == delayed_task_queue_.begin();
 }
 
 DelayedTaskQueue::MaybeNextTask DelayedTaskQueue::TryGetNext() {
@@ -58,8 +57,11 @@ DelayedTaskQueue::MaybeNextTask DelayedTaskQueue::TryGetNext() {
     }
 
     if (task_queue_.empty() && !delayed_task_queue_.empty()) {
-      // Wait for the next delayed task or a newly posted task.
-      double wait_in_seconds = delayed_task_queue_.begin()->first - now;
+      // Wait for the next delayed task or a newly posted task. Waiting for the
+      // slack on top lets one wake-up cover all tasks that become due in the
+      // meantime.
+      double wait_in_seconds =
+          delayed_task_queue_.begin()->first - now + slack_in_seconds_;
       return {
           MaybeNextTask::kWaitDelayed,
           {},
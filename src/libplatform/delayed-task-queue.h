@@ -10,6 +10,7 @@
 #include <queue>
 
 #include "include/libplatform/libplatform-export.h"
+#include "src/base/logging.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
@@ -43,8 +44,18 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
 
   // Appends a delayed task to the queue. There is no ordering guarantee
   // provided regarding delayed tasks, both with respect to other delayed tasks
-  // and non-delayed tasks that were appended using Append().
-  void AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds);
+  // and non-delayed tasks that were appended using Append(). Returns true if
+  // |task| now has the earliest deadline of all delayed tasks, i.e. if a thread
+  // waiting for the next delayed task has to wake up earlier than planned.
+  bool AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds);
+
+  // Lets delayed tasks run up to |slack_in_seconds| after their deadline, so
+  // that tasks with nearby deadlines are picked up by a single wake-up instead
+  // of one wake-up each.
+  void set_slack(double slack_in_seconds) {
+    DCHECK_GE(slack_in_seconds, 0.0);
+    slack_in_seconds_ = slack_in_seconds;
+  }
 
   struct MaybeNextTask {
     enum { kTask, kWaitIndefinite, kWaitDelayed, kTerminated } state;
@@ -67,6 +78,7 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   std::queue<std::unique_ptr<Task>> task_queue_;
   std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
   bool terminated_ = false;
+  double slack_in_seconds_ = 0.0;
   TimeFunction time_function_;
 };
 
@@ -4,54 +4,94 @@
 
 #include "src/libplatform/tracing/trace-buffer.h"
 
+#include "src/base/platform/yield-processor.h"
+
 namespace v8 {
 namespace platform {
 namespace tracing {
 
+namespace {
+
+std::atomic<uint64_t> next_buffer_id{1};
+
+}  // namespace
+
+thread_local TraceBufferRingBuffer::ThreadLocalChunk
+    TraceBufferRingBuffer::thread_local_chunk_;
+
 TraceBufferRingBuffer::TraceBufferRingBuffer(size_t max_chunks,
                                              TraceWriter* trace_writer)
-    : max_chunks_(max_chunks) {
+    : max_chunks_(max_chunks),
+      chunk_states_(new std::atomic<uint64_t>[max_chunks]),
+      buffer_id_(next_buffer_id.fetch_add(1, std::memory_order_relaxed)) {
   trace_writer_.reset(trace_writer);
   chunks_.resize(max_chunks);
+  for (size_t i = 0; i < max_chunks; ++i) {
+    chunk_states_[i].store(0, std::memory_order_relaxed);
+  }
 }
 
 TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
-  base::SpinningMutexGuard guard(&mutex_);
-  if (is_empty_ || chunks_[chunk_index_]->IsFull()) {
-    chunk_index_ = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
-    is_empty_ = false;
-    auto& chunk = chunks_[chunk_index_];
-    if (chunk) {
-      chunk->Reset(current_chunk_seq_++);
-    } else {
-      chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
+  ThreadLocalChunk* local = &thread_local_chunk_;
+  while (true) {
+    if (local->buffer_id == buffer_id_ &&
+        local->epoch == epoch_.load(std::memory_order_relaxed)) {
+      std::atomic<uint64_t>& state = chunk_states_[local->chunk_index];
+      uint64_t old_state = state.load(std::memory_order_relaxed);
+      size_t event_index = StateSize(old_state);
+      if (StateSeq(old_state) == local->seq &&
+          event_index < TraceBufferChunk::kChunkSize) {
+        // This only fails if another thread took over the chunk.
+        if (state.compare_exchange_strong(
+                old_state, MakeState(local->seq, event_index + 1, true),
+                std::memory_order_acquire, std::memory_order_relaxed)) {
+          *handle = MakeHandle(local->chunk_index, local->seq, event_index);
+          return chunks_[local->chunk_index]->GetEventAt(event_index);
+        }
+        continue;
+      }
     }
+    base::SpinningMutexGuard guard(&mutex_);
+    AcquireChunk(local);
   }
-  auto& chunk = chunks_[chunk_index_];
-  size_t event_index;
-  TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(chunk_index_, chunk->seq(), event_index);
-  return trace_object;
+}
+
+void TraceBufferRingBuffer::CommitTraceEvent(uint64_t handle) {
+  size_t chunk_index, event_index;
+  uint32_t chunk_seq;
+  ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
+  if (chunk_index >= max_chunks_) return;
+  std::atomic<uint64_t>& state = chunk_states_[chunk_index];
+  uint64_t old_state = state.load(std::memory_order_relaxed);
+  if (StateSeq(old_state) != chunk_seq || !(old_state & kWritingBit)) return;
+  // Other threads don't change the state while the writing bit is set.
+  state.store(old_state & ~kWritingBit, std::memory_order_release);
 }
 
 TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
-  base::SpinningMutexGuard guard(&mutex_);
   size_t chunk_index, event_index;
   uint32_t chunk_seq;
   ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
   if (chunk_index >= chunks_.size()) return nullptr;
-  auto& chunk = chunks_[chunk_index];
-  if (!chunk || chunk->seq() != chunk_seq) return nullptr;
-  return chunk->GetEventAt(event_index);
+  // The chunk exists if its sequence number matches, since the state is only
+  // published after the chunk is allocated.
+  uint64_t state = chunk_states_[chunk_index].load(std::memory_order_acquire);
+  if (StateSeq(state) != chunk_seq || event_index >= StateSize(state)) {
+    return nullptr;
+  }
+  return chunks_[chunk_index]->GetEventAt(event_index);
 }
 
 bool TraceBufferRingBuffer::Flush() {
   base::SpinningMutexGuard guard(&mutex_);
+  epoch_.store(epoch_.load(std::memory_order_relaxed) + 1,
+               std::memory_order_relaxed);
   // This flushes all the traces stored in the buffer.
   if (!is_empty_) {
     for (size_t i = NextChunkIndex(chunk_index_);; i = NextChunkIndex(i)) {
       if (auto& chunk = chunks_[i]) {
-        for (size_t j = 0; j < chunk->size(); ++j) {
+        size_t size = StateSize(WaitForWriter(i));
+        for (size_t j = 0; j < size; ++j) {
           trace_writer_->AppendTraceEvent(chunk->GetEventAt(j));
         }
       }
@@ -64,6 +104,52 @@ bool TraceBufferRingBuffer::Flush() {
   return true;
 }
 
+void TraceBufferRingBuffer::AcquireChunk(ThreadLocalChunk* local) {
+  // The events that the current thread added to its previous chunk are
+  // complete. Nobody else changes the state of the chunk until it is taken
+  // over with |mutex_| held.
+  if (local->buffer_id == buffer_id_) {
+    std::atomic<uint64_t>& previous_state = chunk_states_[local->chunk_index];
+    uint64_t state = previous_state.load(std::memory_order_relaxed);
+    if (StateSeq(state) == local->seq) {
+      previous_state.store(state & ~kWritingBit, std::memory_order_release);
+    }
+  }
+  size_t chunk_index = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
+  is_empty_ = false;
+  uint32_t seq = current_chunk_seq_++;
+  auto& chunk = chunks_[chunk_index];
+  if (!chunk) chunk.reset(new TraceBufferChunk(seq));
+  // Take over the chunk from its previous owner. Once the sequence number
+  // changed, the previous owner acquires a new chunk for its next event.
+  std::atomic<uint64_t>& state = chunk_states_[chunk_index];
+  uint64_t old_state = WaitForWriter(chunk_index);
+  while (!state.compare_exchange_weak(old_state, MakeState(seq, 0, false),
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+    old_state = WaitForWriter(chunk_index);
+  }
+  chunk->Reset(seq);
+  chunk_index_ = chunk_index;
+  *local = {buffer_id_, epoch_.load(std::memory_order_relaxed), chunk_index,
+            seq};
+}
+
+uint64_t TraceBufferRingBuffer::WaitForWriter(size_t chunk_index) const {
+  const ThreadLocalChunk& local = thread_local_chunk_;
+  while (true) {
+    uint64_t state = chunk_states_[chunk_index].load(std::memory_order_acquire);
+    if (!(state & kWritingBit)) return state;
+    // Events of the current thread are complete, whether or not they have been
+    // committed.
+    if (local.buffer_id == buffer_id_ && local.chunk_index == chunk_index &&
+        local.seq == StateSeq(state)) {
+      return state;
+    }
+    YIELD_PROCESSOR;
+  }
+}
+
 uint64_t TraceBufferRingBuffer::MakeHandle(size_t chunk_index,
                                            uint32_t chunk_seq,
                                            size_t event_index) const {
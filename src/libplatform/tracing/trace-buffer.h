@@ -5,6 +5,7 @@
 #ifndef V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 #define V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -15,6 +16,12 @@ namespace v8 {
 namespace platform {
 namespace tracing {
 
+// Each writing thread owns a chunk of the ring buffer and adds events to it
+// without taking the lock. The lock is only taken to hand out the next chunk
+// of the ring, which is taken over from its previous owner if necessary, and
+// to flush the buffer. Both wait until the event that the previous owner of a
+// chunk is writing is committed, so events added on other threads than the
+// flushing one must be committed.
 class TraceBufferRingBuffer : public TraceBuffer {
  public:
   // Takes ownership of |trace_writer|.
@@ -22,10 +29,34 @@ class TraceBufferRingBuffer : public TraceBuffer {
   ~TraceBufferRingBuffer() override = default;
 
   TraceObject* AddTraceEvent(uint64_t* handle) override;
+  void CommitTraceEvent(uint64_t handle) override;
   TraceObject* GetEventByHandle(uint64_t handle) override;
   bool Flush() override;
 
  private:
+  // The chunk the current thread adds events to.
+  struct ThreadLocalChunk {
+    uint64_t buffer_id = 0;
+    uint32_t epoch = 0;
+    size_t chunk_index = 0;
+    uint32_t seq = 0;
+  };
+
+  // The state of a chunk packs the sequence number of the chunk, which changes
+  // whenever the chunk gets a new owner, the number of events in the chunk and
+  // whether the owner is writing an event that has not been committed yet.
+  static constexpr uint64_t kWritingBit = uint64_t{1} << 31;
+  static constexpr uint64_t kSizeMask = kWritingBit - 1;
+  static uint64_t MakeState(uint32_t seq, size_t size, bool writing) {
+    return (uint64_t{seq} << 32) | (writing ? kWritingBit : 0) | size;
+  }
+  static uint32_t StateSeq(uint64_t state) {
+    return static_cast<uint32_t>(state >> 32);
+  }
+  static size_t StateSize(uint64_t state) {
+    return static_cast<size_t>(state & kSizeMask);
+  }
+
   uint64_t MakeHandle(size_t chunk_index, uint32_t chunk_seq,
                       size_t event_index) const;
   void ExtractHandle(uint64_t handle, size_t* chunk_index, uint32_t* chunk_seq,
@@ -33,10 +64,25 @@ class TraceBufferRingBuffer : public TraceBuffer {
   size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
   size_t NextChunkIndex(size_t index) const;
 
+  // Makes the current thread the owner of the next chunk of the ring. Must be
+  // called with |mutex_| held.
+  void AcquireChunk(ThreadLocalChunk* local);
+  // Waits until the event being written to the chunk, if any, is committed and
+  // returns the state of the chunk. Must be called with |mutex_| held.
+  uint64_t WaitForWriter(size_t chunk_index) const;
+
+  static thread_local ThreadLocalChunk thread_local_chunk_;
+
   mutable base::SpinningMutex mutex_;
   size_t max_chunks_;
   std::unique_ptr<TraceWriter> trace_writer_;
   std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
+  std::unique_ptr<std::atomic<uint64_t>[]> chunk_states_;
+  // Identifies the buffer in the thread local chunks of the writing threads.
+  const uint64_t buffer_id_;
+  // Incremented on every flush, so that all threads acquire a new chunk
+  // afterwards.
+  std::atomic<uint32_t> epoch_{0};
   size_t chunk_index_;
   bool is_empty_ = true;
   uint32_t current_chunk_seq_ = 1;
@@ -32,11 +32,42 @@ bool TraceConfig::IsCategoryGroupEnabled(const char* category_group) const {
   return false;
 }
 
+uint32_t TraceConfig::GetCategoryGroupSamplingInterval(
+    const char* category_group) const {
+  // Events of a category group are sampled only if all its enabled categories
+  // are, with the smallest of their intervals.
+  uint32_t result = 0;
+  std::stringstream category_stream(category_group);
+  while (category_stream.good()) {
+    std::string category;
+    getline(category_stream, category, ',');
+    bool is_included = false;
+    for (const auto& included_category : included_categories_) {
+      if (category == included_category) is_included = true;
+    }
+    if (!is_included) continue;
+    uint32_t interval = 1;
+    for (const auto& [sampled_category, sampling_interval] :
+         category_sampling_intervals_) {
+      if (category == sampled_category) interval = sampling_interval;
+    }
+    if (result == 0 || interval < result) result = interval;
+  }
+  return result == 0 ? 1 : result;
+}
+
 void TraceConfig::AddIncludedCategory(const char* included_category) {
   DCHECK(included_category != nullptr && strlen(included_category) > 0);
   included_categories_.push_back(included_category);
 }
 
+void TraceConfig::SetCategorySamplingInterval(const char* category,
+                                              uint32_t interval) {
+  DCHECK(category != nullptr && strlen(category) > 0);
+  DCHECK_LT(0u, interval);
+  category_sampling_intervals_.emplace_back(category, interval);
+}
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
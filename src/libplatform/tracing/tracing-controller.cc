@@ -21,6 +21,8 @@
 #include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
 #include "src/libplatform/tracing/trace-event-listener.h"
+#else  // !V8_USE_PERFETTO
+#include "src/tracing/trace-event-no-perfetto.h"
 #endif  // V8_USE_PERFETTO
 
 #ifdef V8_USE_PERFETTO
@@ -67,6 +69,42 @@ const int g_num_builtin_categories = 3;
 
 // Skip default categories.
 v8::base::AtomicWord g_category_index = g_num_builtin_categories;
+
+// The sampling intervals of the category groups, see
+// TraceConfig::SetCategorySamplingInterval, and the number of complete and
+// instant events seen for sampled category groups. Indexes match the
+// g_category_groups array indexes as well.
+std::atomic<uint32_t> g_category_group_sampling_interval[kMaxCategoryGroups];
+std::atomic<uint32_t> g_category_group_sample_count[kMaxCategoryGroups];
+
+namespace {
+
+// Complete and instant events of sampled category groups are dropped, except
+// for one per sampling interval. Other events come in pairs or carry state and
+// are always recorded.
+bool IsSampledOut(char phase, const uint8_t* category_group_enabled) {
+  if (phase != TRACE_EVENT_PHASE_COMPLETE &&
+      phase != TRACE_EVENT_PHASE_INSTANT) {
+    return false;
+  }
+  uintptr_t category_begin =
+      reinterpret_cast<uintptr_t>(g_category_group_enabled);
+  uintptr_t category_ptr = reinterpret_cast<uintptr_t>(category_group_enabled);
+  if (category_ptr < category_begin ||
+      category_ptr >= category_begin + kMaxCategoryGroups) {
+    return false;
+  }
+  size_t category_index = category_ptr - category_begin;
+  uint32_t interval = g_category_group_sampling_interval[category_index].load(
+      std::memory_order_relaxed);
+  if (interval <= 1) return false;
+  return g_category_group_sample_count[category_index].fetch_add(
+             1, std::memory_order_relaxed) %
+             interval !=
+         0;
+}
+
+}  // namespace
 #endif  // !defined(V8_USE_PERFETTO)
 
 TracingController::TracingController() {
@@ -135,20 +173,22 @@ uint64_t TracingController::AddTraceEventWithTimestamp(
     const uint64_t* arg_values,
     std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables,
     unsigned int flags, int64_t timestamp) {
+  uint64_t handle = 0;
+  if (!recording_.load(std::memory_order_acquire) ||
+      IsSampledOut(phase, category_enabled_flag)) {
+    return handle;
+  }
   int64_t cpu_now_us = CurrentCpuTimestampMicroseconds();
 
-  uint64_t handle = 0;
-  if (recording_.load(std::memory_order_acquire)) {
-    TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
-    if (trace_object) {
-      {
-        base::SpinningMutexGuard lock(mutex_.get());
-        trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
-                                 bind_id, num_args, arg_names, arg_types,
-                                 arg_values, arg_convertables, flags, timestamp,
-                                 cpu_now_us);
-      }
-    }
+  // The trace buffer hands out events without locking, and waits for them to
+  // be committed before flushing.
+  TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
+  if (trace_object) {
+    trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
+                             bind_id, num_args, arg_names, arg_types,
+                             arg_values, arg_convertables, flags, timestamp,
+                             cpu_now_us);
+    trace_buffer_->CommitTraceEvent(handle);
   }
   return handle;
 }
@@ -268,11 +308,16 @@ void TracingController::StopTracing() {
 #if !defined(V8_USE_PERFETTO)
 void TracingController::UpdateCategoryGroupEnabledFlag(size_t category_index) {
   unsigned char enabled_flag = 0;
+  uint32_t sampling_interval = 1;
   const char* category_group = g_category_groups[category_index];
   if (recording_.load(std::memory_order_acquire) &&
       trace_config_->IsCategoryGroupEnabled(category_group)) {
     enabled_flag |= ENABLED_FOR_RECORDING;
+    sampling_interval =
+        trace_config_->GetCategoryGroupSamplingInterval(category_group);
   }
+  g_category_group_sampling_interval[category_index].store(
+      sampling_interval, std::memory_order_relaxed);
 
   // TODO(fmeawad): EventCallback and ETW modes are not yet supported in V8.
   // TODO(primiano): this is a temporary workaround for catapult:#2341,
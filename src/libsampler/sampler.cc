@@ -14,6 +14,7 @@
 #include <pthread.h>
 #include <signal.h>
 #include <sys/time.h>
+#include <time.h>
 #include <atomic>
 
 #if !V8_OS_QNX && !V8_OS_AIX && !V8_OS_ZOS
@@ -205,9 +206,28 @@ class Sampler::PlatformData {
   int vm_tid() const { return vm_tid_; }
   pthread_t vm_tself() const { return vm_tself_; }
 
+#if V8_OS_LINUX
+  // The CPU time timer of the sampled thread, see StartCpuTimeSampling().
+  bool has_cpu_timer() const {
+    return has_cpu_timer_.load(std::memory_order_relaxed);
+  }
+  timer_t cpu_timer() const { return cpu_timer_; }
+  void set_cpu_timer(timer_t timer) {
+    cpu_timer_ = timer;
+    has_cpu_timer_.store(true, std::memory_order_relaxed);
+  }
+  void clear_cpu_timer() {
+    has_cpu_timer_.store(false, std::memory_order_relaxed);
+  }
+#endif  // V8_OS_LINUX
+
  private:
   int vm_tid_;
   pthread_t vm_tself_;
+#if V8_OS_LINUX
+  timer_t cpu_timer_;
+  std::atomic_bool has_cpu_timer_{false};
+#endif  // V8_OS_LINUX
 };
 
 void SamplerManager::AddSampler(Sampler* sampler) {
@@ -240,7 +260,8 @@ void SamplerManager::RemoveSampler(Sampler* sampler) {
   }
 }
 
-void SamplerManager::DoSample(const v8::RegisterState& state) {
+void SamplerManager::DoSample(const v8::RegisterState& state,
+                              const Sampler* timer_sampler) {
   AtomicGuard atomic_guard(&samplers_access_counter_, false);
   // TODO(petermarshall): Add stat counters for the bailouts here.
   if (!atomic_guard.is_success()) return;
@@ -250,7 +271,7 @@ void SamplerManager::DoSample(const v8::RegisterState& state) {
   SamplerList& samplers = it->second;
 
   for (Sampler* sampler : samplers) {
-    if (!sampler->ShouldRecordSample()) continue;
+    if (!sampler->ShouldRecordSample() && sampler != timer_sampler) continue;
     Isolate* isolate = sampler->isolate();
     // We require a fully initialized and entered isolate.
     if (isolate == nullptr || !isolate->IsInUse()) continue;
@@ -388,11 +409,15 @@ bool SignalHandler::signal_handler_installed_ = false;
 void SignalHandler::HandleProfilerSignal(int signal, siginfo_t* info,
                                          void* context) {
   v8::ThreadIsolatedAllocator::SetDefaultPermissionsForSignalHandler();
-  USE(info);
   if (signal != SIGPROF) return;
+  // Signals raised by the CPU time timer of a sampler carry that sampler.
+  const Sampler* timer_sampler = nullptr;
+  if (info != nullptr && info->si_code == SI_TIMER) {
+    timer_sampler = static_cast<const Sampler*>(info->si_value.sival_ptr);
+  }
   v8::RegisterState state;
   FillRegisterState(context, &state);
-  SamplerManager::instance()->DoSample(state);
+  SamplerManager::instance()->DoSample(state, timer_sampler);
 }
 
 void SignalHandler::FillRegisterState(void* context, RegisterState* state) {
@@ -579,6 +604,7 @@ void Sampler::Start() {
 }
 
 void Sampler::Stop() {
+  StopCpuTimeSampling();
 #if defined(USE_SIGNALS)
   SamplerManager::instance()->RemoveSampler(this);
   SignalHandler::DecreaseSamplerCount();
@@ -587,9 +613,61 @@ void Sampler::Stop() {
   SetActive(false);
 }
 
+#if defined(USE_SIGNALS) && V8_OS_LINUX
+
+bool Sampler::StartCpuTimeSampling(base::TimeDelta interval) {
+  DCHECK(IsActive());
+  DCHECK_LT(base::TimeDelta(), interval);
+  PlatformData* data = platform_data();
+  if (!data->has_cpu_timer()) {
+    clockid_t clock;
+    if (pthread_getcpuclockid(data->vm_tself(), &clock) != 0) return false;
+    struct sigevent event = {};
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = SIGPROF;
+    event.sigev_value.sival_ptr = this;
+    // Older C libraries do not provide the sigev_notify_thread_id alias.
+    event._sigev_un._tid = data->vm_tid();
+    timer_t timer;
+    if (timer_create(clock, &event, &timer) != 0) return false;
+    data->set_cpu_timer(timer);
+  }
+  struct itimerspec spec = {};
+  spec.it_interval = interval.ToTimespec();
+  spec.it_value = spec.it_interval;
+  if (timer_settime(data->cpu_timer(), 0, &spec, nullptr) != 0) {
+    StopCpuTimeSampling();
+    return false;
+  }
+  return true;
+}
+
+void Sampler::StopCpuTimeSampling() {
+  PlatformData* data = platform_data();
+  if (!data->has_cpu_timer()) return;
+  timer_delete(data->cpu_timer());
+  data->clear_cpu_timer();
+}
+
+bool Sampler::IsCpuTimeSampling() const {
+  return platform_data()->has_cpu_timer();
+}
+
+#else
+
+bool Sampler::StartCpuTimeSampling(base::TimeDelta interval) { return false; }
+
+void Sampler::StopCpuTimeSampling() {}
+
+bool Sampler::IsCpuTimeSampling() const { return false; }
+
+#endif  // defined(USE_SIGNALS) && V8_OS_LINUX
+
 #if defined(USE_SIGNALS)
 
 void Sampler::DoSample() {
+  // The kernel timer signals the thread itself.
+  if (IsCpuTimeSampling()) return;
   base::RecursiveMutexGuard lock_guard(SignalHandler::mutex());
   if (!SignalHandler::Installed()) return;
   SetShouldRecordSample();
@@ -12,6 +12,7 @@
 
 #include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
+#include "src/base/platform/time.h"
 
 #if V8_OS_POSIX && !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 #define USE_SIGNALS
@@ -62,6 +63,17 @@ class V8_EXPORT_PRIVATE Sampler {
 
   void DoSample();
 
+  // Instead of being signalled by DoSample(), the sampled thread is signalled
+  // by a kernel timer every time it has consumed |interval| of CPU time.
+  // Threads that are blocked, e.g. idle in a system call, are then neither
+  // interrupted nor sampled, and DoSample() becomes a no-op. Returns false if
+  // this is not supported, in which case DoSample() keeps working as before.
+  // Must be called while the sampler is active; calling it again re-arms the
+  // timer with the new interval.
+  bool StartCpuTimeSampling(base::TimeDelta interval);
+  void StopCpuTimeSampling();
+  bool IsCpuTimeSampling() const;
+
   // Used in tests to make sure that stack sampling is performed.
   unsigned js_sample_count() const { return js_sample_count_; }
   unsigned external_sample_count() const { return external_sample_count_; }
@@ -139,8 +151,11 @@ class V8_EXPORT_PRIVATE SamplerManager {
 
   // Take a sample for every sampler on the current thread. This function can
   // return without taking samples if AddSampler or RemoveSampler are being
-  // concurrently called on any thread.
-  void DoSample(const v8::RegisterState& state);
+  // concurrently called on any thread. |timer_sampler| is the sampler whose
+  // CPU time timer raised the signal, if any; it is only compared against the
+  // registered samplers and never dereferenced.
+  void DoSample(const v8::RegisterState& state,
+                const Sampler* timer_sampler = nullptr);
 
   // Get the lazily instantiated, global SamplerManager instance.
   static SamplerManager* instance();
@@ -115,7 +115,11 @@ namespace internal {
   HR(external_pointer_table_compaction_outcome,                                \
      V8.ExternalPointerTableCompactionOutcome, 0, 2, 3)                        \
   HR(wasm_compilation_method, V8.WasmCompilationMethod, 0, 4, 5)               \
-  HR(asmjs_instantiate_result, V8.AsmjsInstantiateResult, 0, 1, 2)
+  HR(asmjs_instantiate_result, V8.AsmjsInstantiateResult, 0, 1, 2)             \
+  /* Why JSON.stringify fell back from the fast path, see */                   \
+  /* FastJsonStringifierBailoutReason. */                                      \
+  HR(json_stringify_fast_path_bailout_reason,                                  \
+     V8.JsonStringifyFastPathBailoutReason, 0, 8, 9)
 
 #if V8_ENABLE_DRUMBRAKE
 #define HISTOGRAM_RANGE_LIST_SLOW(HR)                                         \
@@ -236,6 +240,9 @@ namespace internal {
   HT(gc_time_to_safepoint, V8.GC.TimeToSafepoint, 10000000, MICROSECOND)       \
   HT(gc_time_to_collection_on_background, V8.GC.TimeToCollectionOnBackground,  \
      10000000, MICROSECOND)                                                    \
+  /* Time spent acquiring a contended Atomics.Mutex. */                        \
+  HT(js_atomics_mutex_wait_time, V8.JSAtomicsMutexWaitTime, 10000000,          \
+     MICROSECOND)                                                              \
   /* Maglev timers. */                                                         \
   HT(maglev_optimize_prepare, V8.MaglevOptimizePrepare, 100000, MICROSECOND)   \
   HT(maglev_optimize_execute, V8.MaglevOptimizeExecute, 100000, MICROSECOND)   \
@@ -325,8 +332,9 @@ namespace internal {
   HT(debug_pause_to_paused_event, V8.DebugPauseToPausedEventMilliSeconds,      \
      1000000, MILLISECOND)
 
-#define AGGREGATABLE_HISTOGRAM_TIMER_LIST(AHT) \
-  AHT(compile_lazy, V8.CompileLazyMicroSeconds)
+#define AGGREGATABLE_HISTOGRAM_TIMER_LIST(AHT)                         \
+  AHT(compile_lazy, V8.CompileLazyMicroSeconds)                        \
+  AHT(compile_lazy_after_flush, V8.CompileLazyAfterFlushMicroSeconds)
 
 #define HISTOGRAM_PERCENTAGE_LIST(HP)                                          \
   /* Heap fragmentation. */                                                    \
@@ -363,7 +371,17 @@ namespace internal {
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(maps_created, V8.MapsCreated)                                             \
+  SC(deopt_materialized_objects, V8.DeoptMaterializedObjects)                  \
+  /* Number of lazy compilations of functions whose bytecode was flushed. */   \
+  SC(compile_lazy_after_flush_count, V8.CompileLazyAfterFlushCount)            \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  /* Valid entries dropped from a secondary stub cache table. */               \
+  SC(megamorphic_stub_cache_evictions, V8.MegamorphicStubCacheEvictions)       \
+  SC(megamorphic_stub_cache_resizes, V8.MegamorphicStubCacheResizes)           \
+  /* Dictionary-mode objects migrated to fast properties on IC misses. */     \
+  SC(dictionary_to_fast_migrations, V8.DictionaryToFastMigrations)             \
+  /* Property additions normalized because of a wide transition tree. */      \
+  SC(transition_tree_normalizations, V8.TransitionTreeNormalizations)          \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
@@ -385,7 +403,13 @@ namespace internal {
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_deopt_data_size, V8.WasmDeoptDataBytes)                              \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
-  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)
+  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)             \
+  /* Atomics.Mutex locks that found the mutex held by another thread. */      \
+  SC(js_atomics_mutex_contended_locks, V8.JSAtomicsMutexContendedLocks)        \
+  /* Contended Atomics.Mutex locks taken by spinning instead of parking. */    \
+  SC(js_atomics_mutex_spin_acquisitions, V8.JSAtomicsMutexSpinAcquisitions)    \
+  /* Atomics.Mutex unlocks that woke up a parked waiter. */                    \
+  SC(js_atomics_mutex_handoffs, V8.JSAtomicsMutexHandoffs)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
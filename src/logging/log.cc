@@ -1978,8 +1978,25 @@ void V8FileLogger::TickEvent(TickSample* sample, bool overflow) {
   }
   msg << kNext << static_cast<int>(sample->state);
   if (overflow) msg << kNext << "overflow";
-  for (unsigned i = 0; i < sample->frames_count; ++i) {
-    msg << kNext << reinterpret_cast<void*>(sample->stack[i]);
+  if (v8_flags.prof_compact_ticks) {
+    // Frames of one stack tend to be close to each other, so their offsets
+    // take fewer characters than their absolute addresses. The log reader
+    // resolves each offset relative to the previous frame, starting at pc.
+    Address previous_frame = reinterpret_cast<Address>(sample->pc);
+    for (unsigned i = 0; i < sample->frames_count; ++i) {
+      Address frame = reinterpret_cast<Address>(sample->stack[i]);
+      msg << kNext;
+      if (frame >= previous_frame) {
+        msg.AppendFormatString("+0x%" V8PRIxPTR, frame - previous_frame);
+      } else {
+        msg.AppendFormatString("-0x%" V8PRIxPTR, previous_frame - frame);
+      }
+      previous_frame = frame;
+    }
+  } else {
+    for (unsigned i = 0; i < sample->frames_count; ++i) {
+      msg << kNext << reinterpret_cast<void*>(sample->stack[i]);
+    }
   }
   msg.WriteToLogFile();
 }
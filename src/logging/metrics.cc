@@ -5,6 +5,7 @@
 #include "src/logging/metrics.h"
 
 #include "include/v8-platform.h"
+#include "src/flags/flags.h"
 
 namespace v8 {
 namespace internal {
@@ -31,6 +32,19 @@ class Recorder::Task : public v8::Task {
   std::shared_ptr<Recorder> recorder_;
 };
 
+class Recorder::WorkerTask : public v8::Task {
+ public:
+  WorkerTask(const std::shared_ptr<Recorder>& recorder,
+             std::unique_ptr<Recorder::DelayedEventBase>&& event)
+      : recorder_(recorder), event_(std::move(event)) {}
+
+  void Run() override { event_->Run(recorder_); }
+
+ private:
+  std::shared_ptr<Recorder> recorder_;
+  std::unique_ptr<Recorder::DelayedEventBase> event_;
+};
+
 void Recorder::SetEmbedderRecorder(
     Isolate* isolate,
     const std::shared_ptr<v8::metrics::Recorder>& embedder_recorder) {
@@ -38,16 +52,95 @@ void Recorder::SetEmbedderRecorder(
       reinterpret_cast<v8::Isolate*>(isolate));
   CHECK_NULL(embedder_recorder_);
   embedder_recorder_ = embedder_recorder;
+  last_jit_transitions_report_ = base::TimeTicks::Now();
 }
 
 bool Recorder::HasEmbedderRecorder() const { return embedder_recorder_.get(); }
 
 void Recorder::NotifyIsolateDisposal() {
   if (embedder_recorder_) {
+    std::optional<v8::metrics::JitTransitions> jit_transitions;
+    {
+      base::MutexGuard guard(&jit_transitions_mutex_);
+      jit_transitions = TakeJitTransitions(true);
+    }
+    if (jit_transitions) {
+      embedder_recorder_->AddThreadSafeEvent(*jit_transitions);
+    }
     embedder_recorder_->NotifyIsolateDisposal();
   }
 }
 
+void Recorder::RecordDeoptimization(std::string function_name, int script_id,
+                                    int function_position, int bytecode_offset,
+                                    const char* kind, const char* reason) {
+  if (!embedder_recorder_) return;
+  std::optional<v8::metrics::JitTransitions> report;
+  {
+    base::MutexGuard guard(&jit_transitions_mutex_);
+    auto key = std::make_tuple(script_id, function_position, bytecode_offset,
+                               kind, reason);
+    auto it = deoptimization_indices_.find(key);
+    if (it == deoptimization_indices_.end()) {
+      deoptimization_indices_.emplace(
+          key, jit_transitions_.deoptimizations.size());
+      jit_transitions_.deoptimizations.push_back(
+          {std::move(function_name), script_id, function_position,
+           bytecode_offset, kind, reason, 1});
+    } else {
+      jit_transitions_.deoptimizations[it->second].count++;
+    }
+    report = TakeJitTransitions(false);
+  }
+  if (report) PostThreadSafeEvent(std::move(*report));
+}
+
+void Recorder::RecordMegamorphicTransition(std::string function_name,
+                                           int script_id,
+                                           int function_position,
+                                           int feedback_slot,
+                                           const char* ic_kind) {
+  if (!embedder_recorder_) return;
+  std::optional<v8::metrics::JitTransitions> report;
+  {
+    base::MutexGuard guard(&jit_transitions_mutex_);
+    auto key = std::make_tuple(script_id, function_position, feedback_slot);
+    auto it = megamorphic_transition_indices_.find(key);
+    if (it == megamorphic_transition_indices_.end()) {
+      megamorphic_transition_indices_.emplace(
+          key, jit_transitions_.megamorphic_transitions.size());
+      jit_transitions_.megamorphic_transitions.push_back(
+          {std::move(function_name), script_id, function_position,
+           feedback_slot, ic_kind, 1});
+    } else {
+      jit_transitions_.megamorphic_transitions[it->second].count++;
+    }
+    report = TakeJitTransitions(false);
+  }
+  if (report) PostThreadSafeEvent(std::move(*report));
+}
+
+std::optional<v8::metrics::JitTransitions> Recorder::TakeJitTransitions(
+    bool force) {
+  if (jit_transitions_.deoptimizations.empty() &&
+      jit_transitions_.megamorphic_transitions.empty()) {
+    return {};
+  }
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (!force &&
+      now - last_jit_transitions_report_ <
+          base::TimeDelta::FromMilliseconds(
+              v8_flags.jit_transitions_report_interval)) {
+    return {};
+  }
+  last_jit_transitions_report_ = now;
+  v8::metrics::JitTransitions result;
+  std::swap(result, jit_transitions_);
+  deoptimization_indices_.clear();
+  megamorphic_transition_indices_.clear();
+  return result;
+}
+
 void Recorder::Delay(std::unique_ptr<Recorder::DelayedEventBase>&& event) {
   base::SpinningMutexGuard lock_scope(&lock_);
   bool was_empty = delayed_events_.empty();
@@ -58,6 +151,13 @@ void Recorder::Delay(std::unique_ptr<Recorder::DelayedEventBase>&& event) {
   }
 }
 
+void Recorder::PostToWorker(
+    std::unique_ptr<Recorder::DelayedEventBase>&& event) {
+  V8::GetCurrentPlatform()->PostTaskOnWorkerThread(
+      TaskPriority::kBestEffort,
+      std::make_unique<WorkerTask>(shared_from_this(), std::move(event)));
+}
+
 }  // namespace metrics
 }  // namespace internal
 }  // namespace v8
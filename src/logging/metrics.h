@@ -5,8 +5,13 @@
 #ifndef V8_LOGGING_METRICS_H_
 #define V8_LOGGING_METRICS_H_
 
+#include <map>
 #include <memory>
+#include <optional>
 #include <queue>
+#include <string>
+#include <tuple>
+#include <utility>
 
 #include "include/v8-metrics.h"
 #include "src/base/platform/mutex.h"
@@ -49,6 +54,30 @@ class Recorder : public std::enable_shared_from_this<Recorder> {
     if (embedder_recorder_) embedder_recorder_->AddThreadSafeEvent(event);
   }
 
+  // Aggregate deoptimizations and megamorphic IC transitions into the
+  // JitTransitions event. Callers should check HasEmbedderRecorder() before
+  // computing the arguments.
+  V8_EXPORT_PRIVATE void RecordDeoptimization(std::string function_name,
+                                              int script_id,
+                                              int function_position,
+                                              int bytecode_offset,
+                                              const char* kind,
+                                              const char* reason);
+  V8_EXPORT_PRIVATE void RecordMegamorphicTransition(std::string function_name,
+                                                     int script_id,
+                                                     int function_position,
+                                                     int feedback_slot,
+                                                     const char* ic_kind);
+
+  // Reports a thread-safe event from a worker thread. Use this for events that
+  // are expensive to consume so the embedder's handler does not run on the
+  // main thread.
+  template <class T>
+  void PostThreadSafeEvent(T event) {
+    if (!embedder_recorder_) return;
+    PostToWorker(std::make_unique<ThreadSafeEvent<T>>(std::move(event)));
+  }
+
  private:
   class DelayedEventBase {
    public:
@@ -72,15 +101,43 @@ class Recorder : public std::enable_shared_from_this<Recorder> {
     v8::metrics::Recorder::ContextId id_;
   };
 
+  template <class T>
+  class ThreadSafeEvent : public DelayedEventBase {
+   public:
+    explicit ThreadSafeEvent(T event) : event_(std::move(event)) {}
+
+    void Run(const std::shared_ptr<Recorder>& recorder) override {
+      recorder->AddThreadSafeEvent(event_);
+    }
+
+   protected:
+    T event_;
+  };
+
   class Task;
+  class WorkerTask;
 
   V8_EXPORT_PRIVATE void Delay(
       std::unique_ptr<Recorder::DelayedEventBase>&& event);
+  V8_EXPORT_PRIVATE void PostToWorker(
+      std::unique_ptr<Recorder::DelayedEventBase>&& event);
+
+  // Returns the aggregated JIT transitions if there are any and either {force}
+  // is set or the report interval has elapsed.
+  std::optional<v8::metrics::JitTransitions> TakeJitTransitions(bool force);
 
   base::SpinningMutex lock_;
   std::shared_ptr<v8::TaskRunner> foreground_task_runner_;
   std::shared_ptr<v8::metrics::Recorder> embedder_recorder_;
   std::queue<std::unique_ptr<DelayedEventBase>> delayed_events_;
+
+  base::Mutex jit_transitions_mutex_;
+  v8::metrics::JitTransitions jit_transitions_;
+  // Indices into {jit_transitions_} keyed by location.
+  std::map<std::tuple<int, int, int, const char*, const char*>, size_t>
+      deoptimization_indices_;
+  std::map<std::tuple<int, int, int>, size_t> megamorphic_transition_indices_;
+  base::TimeTicks last_jit_transitions_report_;
 };
 
 template <class T, int64_t (base::TimeDelta::*precision)() const =
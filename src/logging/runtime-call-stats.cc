@@ -102,6 +102,7 @@ class RuntimeCallStatEntries {
 void RuntimeCallCounter::Reset() {
   count_ = 0;
   time_ = 0;
+  sample_count_ = 0;
 }
 
 void RuntimeCallCounter::Dump(v8::tracing::TracedValue* value) {
@@ -114,6 +115,7 @@ void RuntimeCallCounter::Dump(v8::tracing::TracedValue* value) {
 void RuntimeCallCounter::Add(RuntimeCallCounter* other) {
   count_ += other->count();
   time_ += other->time().InMicroseconds();
+  sample_count_ += other->sample_count();
 }
 
 void RuntimeCallTimer::Snapshot() {
@@ -6,6 +6,7 @@
 #define V8_LOGGING_RUNTIME_CALL_STATS_H_
 
 #include <optional>
+#include <utility>
 
 #include "src/base/macros.h"
 
@@ -33,7 +34,7 @@ class RuntimeCallCounter final {
  public:
   RuntimeCallCounter() : RuntimeCallCounter(nullptr) {}
   explicit RuntimeCallCounter(const char* name)
-      : name_(name), count_(0), time_(0) {}
+      : name_(name), count_(0), time_(0), sample_count_(0) {}
   V8_NOINLINE void Reset();
   V8_NOINLINE void Dump(v8::tracing::TracedValue* value);
   void Add(RuntimeCallCounter* other);
@@ -46,6 +47,12 @@ class RuntimeCallCounter final {
   void Increment() { count_++; }
   void Add(base::TimeDelta delta) { time_ += delta.InMicroseconds(); }
 
+  // Number of profiler ticks that hit this counter, see
+  // RuntimeCallStats::RecordSample().
+  int64_t sample_count() const { return sample_count_; }
+  void IncrementSampleCount() { sample_count_++; }
+  int64_t TakeSampleCount() { return std::exchange(sample_count_, 0); }
+
  private:
   friend class RuntimeCallStats;
 
@@ -53,6 +60,7 @@ class RuntimeCallCounter final {
   int64_t count_;
   // Stored as int64_t so that its initialization can be deferred.
   int64_t time_;
+  int64_t sample_count_;
 };
 
 // RuntimeCallTimer is used to keep track of the stack of currently active
@@ -165,6 +173,7 @@ class RuntimeCallTimer final {
   V(Float32Array_New)                                      \
   V(Float64Array_New)                                      \
   V(Function_Call)                                         \
+  V(Function_CallBatch)                                    \
   V(Function_New)                                          \
   V(Function_FunctionProtoToString)                        \
   V(Function_NewInstance)                                  \
@@ -179,7 +188,9 @@ class RuntimeCallTimer final {
   V(Isolate_DateTimeConfigurationChangeNotification)       \
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
+  V(JSON_ParseProperties)                                  \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyTo)                                      \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -228,6 +239,7 @@ class RuntimeCallTimer final {
   V(Object_SetPrototype)                                   \
   V(ObjectTemplate_New)                                    \
   V(ObjectTemplate_NewInstance)                            \
+  V(ObjectTemplate_NewInstances)                           \
   V(Object_ToArrayIndex)                                   \
   V(Object_ToBigInt)                                       \
   V(Object_ToDetailString)                                 \
@@ -270,6 +282,7 @@ class RuntimeCallTimer final {
   V(String_Concat)                                         \
   V(String_NewExternalOneByte)                             \
   V(String_NewExternalTwoByte)                             \
+  V(String_NewExternalUtf8)                                \
   V(String_NewFromOneByte)                                 \
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
@@ -378,8 +391,13 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, SimplifiedLowering)                \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, SimplifyLoops)                     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TraceScheduleAndVerify)            \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize,                                    \
+                              TurboshaftAllocationEscapeAnalysis)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftBlockInstrumentation)    \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize,                                    \
+                              TurboshaftBoundsCheckElimination)               \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftBuildGraph)              \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftCheckHoisting)           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize,                                    \
                               TurboshaftCodeEliminationAndSimplification)     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftCsaBranchElimination)    \
@@ -396,6 +414,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftInstructionSelection)    \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftInt64Lowering)           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLateOptimization)        \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopInvariantCodeMotion) \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopPeeling)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopUnrolling)           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftMachineLowering)         \
@@ -409,6 +428,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftStoreStoreElimination)   \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTagUntagLowering)        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTypeAssertions)          \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTypedArrayVectorization)  \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTypedOptimizations)      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftWasmDeadCodeElimination) \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftWasmGCOptimize)          \
@@ -648,6 +668,21 @@ class RuntimeCallStats final {
   V8_EXPORT_PRIVATE void CorrectCurrentCounterId(
       RuntimeCallCounterId counter_id, CounterMode mode = kExact);
 
+  // Whether counters are sampled instead of timed. Timers then only maintain
+  // the stack of active counters and RecordSample() attributes profiler ticks
+  // to its top.
+  static bool IsSamplingEnabled() {
+    return TracingFlags::runtime_stats.load(std::memory_order_relaxed) &
+           v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING;
+  }
+
+  // Attributes a sample to the innermost active counter. Must be called on
+  // the thread of this table, e.g. from the CPU profiler's signal handler.
+  void RecordSample() {
+    RuntimeCallCounter* counter = current_counter();
+    if (counter != nullptr) counter->IncrementSampleCount();
+  }
+
   V8_EXPORT_PRIVATE void Reset();
   // Add all entries from another stats object.
   void Add(RuntimeCallStats* other);
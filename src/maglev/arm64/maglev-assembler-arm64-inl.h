@@ -801,6 +801,16 @@ inline void MaglevAssembler::LoadFloat64(DoubleRegister dst, MemOperand src) {
 inline void MaglevAssembler::StoreFloat64(MemOperand dst, DoubleRegister src) {
   Str(src, dst);
 }
+inline void MaglevAssembler::LoadFloat16(DoubleRegister dst, MemOperand src) {
+  Ldr(dst.H(), src);
+  Fcvt(dst, dst.H());
+}
+inline void MaglevAssembler::StoreFloat16(MemOperand dst, DoubleRegister src) {
+  TemporaryRegisterScope temps(this);
+  DoubleRegister scratch = temps.AcquireScratchDouble();
+  Fcvt(scratch.H(), src);
+  Str(scratch.H(), dst);
+}
 
 inline void MaglevAssembler::LoadUnalignedFloat64(DoubleRegister dst,
                                                   Register base,
@@ -463,6 +463,12 @@ class V8_EXPORT_PRIVATE MaglevAssembler : public MacroAssembler {
   inline void StoreFloat32(MemOperand dst, DoubleRegister src);
   inline void LoadFloat64(DoubleRegister dst, MemOperand src);
   inline void StoreFloat64(MemOperand dst, DoubleRegister src);
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+  // Only supported if the CPU can convert between float16 and float64, see
+  // IsSupported(CpuOperation::kFloat16RawBitsConversion).
+  inline void LoadFloat16(DoubleRegister dst, MemOperand src);
+  inline void StoreFloat16(MemOperand dst, DoubleRegister src);
+#endif  // V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
 
   inline void LoadUnalignedFloat64(DoubleRegister dst, Register base,
                                    Register index);
@@ -153,7 +153,8 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
     //   - Cleaning up identity nodes
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.Maglev.DeadCodeMarking");
-    GraphMultiProcessor<AnyUseMarkingProcessor> processor;
+    GraphMultiProcessor<AnyUseMarkingProcessor> processor(
+        AnyUseMarkingProcessor{compilation_info});
     processor.ProcessGraph(graph);
   }
 
@@ -53,8 +53,10 @@
 #include "src/objects/js-array.h"
 #include "src/objects/js-function.h"
 #include "src/objects/js-objects.h"
+#include "src/objects/js-proxy-inl.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/name-inl.h"
+#include "src/objects/objects-inl.h"
 #include "src/objects/object-list-macros.h"
 #include "src/objects/property-cell.h"
 #include "src/objects/property-details.h"
@@ -84,6 +86,7 @@ namespace {
 
 enum class CpuOperation {
   kFloat64Round,
+  kFloat16RawBitsConversion,
 };
 
 // TODO(leszeks): Add a generic mechanism for marking nodes as optionally
@@ -102,6 +105,17 @@ bool IsSupported(CpuOperation op) {
       return true;
 #else
 #error "V8 does not support this architecture."
+#endif
+    case CpuOperation::kFloat16RawBitsConversion:
+#if defined(V8_TARGET_ARCH_X64)
+      return CpuFeatures::IsSupported(F16C) && CpuFeatures::IsSupported(AVX);
+#elif defined(V8_TARGET_ARCH_ARM64)
+      // Conversions between half and double precision are part of the base
+      // ARMv8 instruction set, only half-precision arithmetic needs FP16.
+      return true;
+#else
+      // TODO(maglev): Fall back to a C call on the other architectures.
+      return false;
 #endif
   }
 }
@@ -227,8 +241,9 @@ class CallArguments {
     }
   }
 
+  // The array-like or spread argument, which is always the last one.
   ValueNode* array_like_argument() {
-    DCHECK_EQ(mode_, kWithArrayLike);
+    DCHECK_NE(mode_, kDefault);
     DCHECK_GT(count(), 0);
     return args_[args_.size() - 1];
   }
@@ -264,7 +279,7 @@ class CallArguments {
   ConvertReceiverMode receiver_mode() const { return receiver_mode_; }
 
   void PopArrayLikeArgument() {
-    DCHECK_EQ(mode_, kWithArrayLike);
+    DCHECK_NE(mode_, kDefault);
     DCHECK_GT(count(), 0);
     args_.pop_back();
   }
@@ -411,6 +426,13 @@ class V8_NODISCARD MaglevGraphBuilder::DeoptFrameScope {
       case Builtin::kGetIteratorWithFeedbackLazyDeoptContinuation:
       case Builtin::kCallIteratorWithFeedbackLazyDeoptContinuation:
       case Builtin::kArrayForEachLoopLazyDeoptContinuation:
+      case Builtin::kArrayEveryLoopLazyDeoptContinuation:
+      case Builtin::kArraySomeLoopLazyDeoptContinuation:
+      case Builtin::kArrayFindLoopLazyDeoptContinuation:
+      case Builtin::kArrayFindLoopAfterCallbackLazyDeoptContinuation:
+      case Builtin::kArrayFindIndexLoopLazyDeoptContinuation:
+      case Builtin::kArrayFindIndexLoopAfterCallbackLazyDeoptContinuation:
+      case Builtin::kArrayReduceLoopLazyDeoptContinuation:
       case Builtin::kGenericLazyDeoptContinuation:
       case Builtin::kToBooleanLazyDeoptContinuation:
         return true;
@@ -5761,6 +5783,116 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildPropertyAccess(
   }
 }
 
+MaybeReduceResult MaglevGraphBuilder::TryBuildProxyNamedAccess(
+    ValueNode* receiver, ValueNode* lookup_start_object,
+    compiler::ZoneRefSet<Map> const& maps, compiler::NameRef name,
+    compiler::AccessMode access_mode) {
+  // Private names never reach the proxy traps.
+  if (name.object()->IsPrivate()) return {};
+  if (access_mode != compiler::AccessMode::kLoad &&
+      access_mode != compiler::AccessMode::kStore) {
+    return {};
+  }
+
+  ZoneVector<compiler::MapRef> proxy_maps(maps.begin(), maps.end(), zone());
+  RETURN_IF_ABORT(
+      BuildCheckMaps(lookup_start_object, base::VectorOf(proxy_maps)));
+
+  if (access_mode == compiler::AccessMode::kStore) {
+    DCHECK_EQ(receiver, lookup_start_object);
+    BuildCallBuiltin<Builtin::kProxySetProperty>(
+        {GetTaggedValue(lookup_start_object), GetConstant(name),
+         GetTaggedValue(GetAccumulator()), GetTaggedValue(receiver)});
+    return ReduceResult::Done();
+  }
+
+  if (compiler::OptionalHeapObjectRef proxy =
+          TryGetConstant(lookup_start_object)) {
+    RETURN_IF_DONE(TryReduceConstantProxyGet(proxy.value(), receiver, name));
+  }
+  return BuildCallBuiltin<Builtin::kProxyGetProperty>(
+      {GetTaggedValue(lookup_start_object), GetConstant(name),
+       GetTaggedValue(receiver),
+       GetSmiConstant(static_cast<int>(OnNonExistent::kReturnUndefined))});
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryReduceConstantProxyGet(
+    compiler::HeapObjectRef proxy, ValueNode* receiver,
+    compiler::NameRef name) {
+  // The handler and target only change when the proxy is revoked, which
+  // clears both, so a check on the handler guards the target too.
+  Tagged<JSProxy> raw_proxy = Cast<JSProxy>(*proxy.object());
+  Tagged<Object> raw_handler = raw_proxy->handler();
+  Tagged<Object> raw_target = raw_proxy->target();
+  if (!IsJSObject(raw_handler) || !IsJSObject(raw_target)) return {};
+  compiler::OptionalJSObjectRef maybe_handler =
+      TryMakeRef(broker(), Cast<JSObject>(raw_handler));
+  compiler::OptionalJSObjectRef maybe_target =
+      TryMakeRef(broker(), Cast<JSObject>(raw_target));
+  if (!maybe_handler.has_value() || !maybe_target.has_value()) return {};
+  compiler::JSObjectRef handler = maybe_handler.value();
+  compiler::JSObjectRef target = maybe_target.value();
+
+  // The get trap is only called directly if it is a constant function on the
+  // handler or its prototype chain.
+  compiler::MapRef handler_map = handler.map(broker());
+  compiler::PropertyAccessInfo trap_info = broker()->GetPropertyAccessInfo(
+      handler_map, broker()->get_string(), compiler::AccessMode::kLoad);
+  if (!trap_info.IsFastDataConstant() ||
+      trap_info.field_representation().IsDouble()) {
+    return {};
+  }
+
+  // The result of the trap has to be checked against the target unless the
+  // target has no non-configurable own property with this name. Fast elements
+  // are always configurable, and depending on the stable map of the target
+  // keeps its properties that way.
+  compiler::MapRef target_map = target.map(broker());
+  if (!target_map.is_stable() || target_map.is_dictionary_map() ||
+      !IsFastElementsKind(target_map.elements_kind()) ||
+      IsSpecialReceiverInstanceType(target_map.instance_type())) {
+    return {};
+  }
+  for (InternalIndex i :
+       InternalIndex::Range(target_map.NumberOfOwnDescriptors())) {
+    if (target_map.GetPropertyKey(broker(), i).equals(name) &&
+        !target_map.GetPropertyDetails(broker(), i).IsConfigurable()) {
+      return {};
+    }
+  }
+
+  compiler::OptionalObjectRef trap = TryFoldLoadConstantDataField(
+      trap_info.holder().has_value() ? trap_info.holder().value() : handler,
+      trap_info);
+  if (!trap.has_value() || !trap->IsJSFunction()) return {};
+
+  ZoneVector<compiler::PropertyAccessInfo> trap_infos(zone());
+  compiler::AccessInfoFactory access_info_factory(broker(), zone());
+  if (!access_info_factory.FinalizePropertyAccessInfos(
+          ZoneVector<compiler::PropertyAccessInfo>({trap_info}, zone()),
+          compiler::AccessMode::kLoad, &trap_infos)) {
+    return {};
+  }
+  if (trap_info.holder().has_value()) {
+    broker()->dependencies()->DependOnStablePrototypeChains(
+        trap_info.lookup_start_object_maps(), kStartAtPrototype,
+        trap_info.holder().value());
+  }
+  broker()->dependencies()->DependOnStableMap(target_map);
+
+  ValueNode* proxy_handler = BuildLoadTaggedField(
+      GetConstant(proxy), JSProxy::kHandlerOffset);
+  RETURN_IF_ABORT(BuildCheckValue(proxy_handler, handler));
+  ValueNode* handler_node = GetConstant(handler);
+  RETURN_IF_ABORT(
+      BuildCheckMaps(handler_node, base::VectorOf({handler_map})));
+
+  CallArguments args(ConvertReceiverMode::kNotNullOrUndefined,
+                     {handler_node, GetConstant(target), GetConstant(name),
+                      receiver});
+  return TryReduceCallForConstant(trap->AsJSFunction(), args);
+}
+
 template <typename GenericAccessFunc>
 MaybeReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
     ValueNode* receiver, ValueNode* lookup_start_object,
@@ -5833,6 +5965,14 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
     return EmitUnconditionalDeopt(DeoptimizeReason::kWrongMap);
   }
 
+  if (v8_flags.maglev_proxy_access &&
+      std::all_of(inferred_maps.begin(), inferred_maps.end(),
+                  [](compiler::MapRef map) { return map.IsJSProxyMap(); })) {
+    return TryBuildProxyNamedAccess(receiver, lookup_start_object,
+                                    inferred_maps, feedback.name(),
+                                    access_mode);
+  }
+
   ZoneVector<compiler::PropertyAccessInfo> access_infos(zone());
   ZoneVector<compiler::PropertyAccessInfo> access_infos_for_feedback(zone());
 
@@ -6156,6 +6296,7 @@ ValueNode* MaglevGraphBuilder::BuildLoadTypedArrayElement(
     case UINT16_ELEMENTS:
     case UINT32_ELEMENTS:
       BUILD_AND_RETURN_LOAD_TYPED_ARRAY(UnsignedInt);
+    case FLOAT16_ELEMENTS:
     case FLOAT32_ELEMENTS:
     case FLOAT64_ELEMENTS:
       BUILD_AND_RETURN_LOAD_TYPED_ARRAY(Double);
@@ -6190,6 +6331,7 @@ void MaglevGraphBuilder::BuildStoreTypedArrayElement(
                    NodeType::kNumberOrOddball,
                    TaggedToFloat64ConversionType::kNumberOrOddball))
       break;
+    case FLOAT16_ELEMENTS:
     case FLOAT32_ELEMENTS:
     case FLOAT64_ELEMENTS:
       BUILD_STORE_TYPED_ARRAY(
@@ -6210,11 +6352,14 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildElementAccessOnTypedArray(
   DCHECK(HasOnlyJSTypedArrayMaps(
       base::VectorOf(access_info.lookup_start_object_maps())));
   ElementsKind elements_kind = access_info.elements_kind();
-  if (elements_kind == FLOAT16_ELEMENTS ||
-      elements_kind == BIGUINT64_ELEMENTS ||
+  if (elements_kind == BIGUINT64_ELEMENTS ||
       elements_kind == BIGINT64_ELEMENTS) {
     return {};
   }
+  if (elements_kind == FLOAT16_ELEMENTS &&
+      !IsSupported(CpuOperation::kFloat16RawBitsConversion)) {
+    return {};
+  }
   if (keyed_mode.access_mode() == compiler::AccessMode::kLoad &&
       LoadModeHandlesOOB(keyed_mode.load_mode())) {
     // TODO(victorgomes): Handle OOB mode.
@@ -8158,7 +8303,8 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIsArray(
   return {};
 }
 
-MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
+MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
+    const char* name, ArrayIteratingBuiltinKind kind,
     compiler::JSFunctionRef target, CallArguments& args) {
   if (!CanSpeculateCall()) return {};
 
@@ -8167,8 +8313,7 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
 
   if (args.count() < 1) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - not enough "
-                   "arguments"
+      std::cout << "  ! Failed to reduce " << name << " - not enough arguments"
                 << std::endl;
     }
     return {};
@@ -8177,9 +8322,8 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   auto node_info = known_node_aspects().TryGetInfoFor(receiver);
   if (!node_info || !node_info->possible_maps_are_known()) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - receiver "
-                   "map is unknown"
-                << std::endl;
+      std::cout << "  ! Failed to reduce " << name
+                << " - receiver map is unknown" << std::endl;
     }
     return {};
   }
@@ -8188,19 +8332,31 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   if (!CanInlineArrayIteratingBuiltin(broker(), node_info->possible_maps(),
                                       &elements_kind)) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - doesn't "
-                   "support fast array iteration or incompatible maps"
+      std::cout << "  ! Failed to reduce " << name
+                << " - doesn't support fast array iteration or incompatible "
+                   "maps"
                 << std::endl;
     }
     return {};
   }
 
+  // Without an initial value, reduce starts with the first element, which is
+  // only guaranteed to exist for packed elements kinds.
+  const bool is_reduce = kind == ArrayIteratingBuiltinKind::kReduce;
+  const bool has_initial_value = is_reduce && args.count() > 1;
+  if (is_reduce && !has_initial_value && IsHoleyElementsKind(elements_kind)) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce " << name
+                << " - no initial value for holey elements kind" << std::endl;
+    }
+    return {};
+  }
+
   // TODO(leszeks): May only be needed for holey elements kinds.
   if (!broker()->dependencies()->DependOnNoElementsProtector()) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - invalidated "
-                   "no elements protector"
-                << std::endl;
+      std::cout << "  ! Failed to reduce " << name
+                << " - invalidated no elements protector" << std::endl;
     }
     return {};
   }
@@ -8208,50 +8364,149 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   ValueNode* callback = args[0];
   if (!callback->is_tagged()) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - callback is "
-                   "untagged value"
-                << std::endl;
+      std::cout << "  ! Failed to reduce " << name
+                << " - callback is untagged value" << std::endl;
     }
     return {};
   }
 
-  ValueNode* this_arg =
-      args.count() > 1 ? args[1] : GetRootConstant(RootIndex::kUndefinedValue);
+  // The continuations that resume the builtin's own loop after a deopt. The
+  // after-callback continuation is entered with the callback's return value
+  // as an additional argument.
+  Builtin eager_continuation;
+  Builtin lazy_continuation;
+  Builtin after_callback_continuation;
+  switch (kind) {
+    case ArrayIteratingBuiltinKind::kForEach:
+      eager_continuation = Builtin::kArrayForEachLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayForEachLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+    case ArrayIteratingBuiltinKind::kEvery:
+      eager_continuation = Builtin::kArrayEveryLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayEveryLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+    case ArrayIteratingBuiltinKind::kSome:
+      eager_continuation = Builtin::kArraySomeLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArraySomeLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+    case ArrayIteratingBuiltinKind::kFind:
+      eager_continuation = Builtin::kArrayFindLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayFindLoopLazyDeoptContinuation;
+      after_callback_continuation =
+          Builtin::kArrayFindLoopAfterCallbackLazyDeoptContinuation;
+      break;
+    case ArrayIteratingBuiltinKind::kFindIndex:
+      eager_continuation = Builtin::kArrayFindIndexLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayFindIndexLoopLazyDeoptContinuation;
+      after_callback_continuation =
+          Builtin::kArrayFindIndexLoopAfterCallbackLazyDeoptContinuation;
+      break;
+    case ArrayIteratingBuiltinKind::kReduce:
+      eager_continuation = Builtin::kArrayReduceLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayReduceLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+  }
+
+  // reduce has no thisArg, and calls the callback with an undefined receiver.
+  ValueNode* this_arg = !is_reduce && args.count() > 1
+                            ? args[1]
+                            : GetRootConstant(RootIndex::kUndefinedValue);
 
   ValueNode* original_length = BuildLoadJSArrayLength(receiver);
 
+  // The parameters of the continuations, which continue the loop at index {k}.
+  // {extra} is the accumulator for reduce, and the value to return if the
+  // callback found an element for find and findIndex.
+  auto continuation_params = [&](ValueNode* k, ValueNode* extra = nullptr) {
+    base::SmallVector<ValueNode*, 6> params = {receiver, callback};
+    if (!is_reduce) params.push_back(this_arg);
+    params.push_back(k);
+    params.push_back(original_length);
+    if (extra) params.push_back(extra);
+    return params;
+  };
+
   // Elide the callable check if the node is known callable.
   EnsureType(callback, NodeType::kCallable, [&](NodeType old_type) {
     // ThrowIfNotCallable is wrapped in a lazy_deopt_scope to make sure the
     // exception has the right call stack.
     DeoptFrameScope lazy_deopt_scope(
-        this, Builtin::kArrayForEachLoopLazyDeoptContinuation, target,
-        base::VectorOf<ValueNode*>({receiver, callback, this_arg,
-                                    GetSmiConstant(0), original_length}));
+        this, lazy_continuation, target,
+        base::VectorOf(continuation_params(GetSmiConstant(0))));
     AddNewNode<ThrowIfNotCallable>({callback});
   });
 
   ValueNode* original_length_int32 = GetInt32(original_length);
 
+  ValueNode* initial_index = GetSmiConstant(0);
+  ValueNode* initial_accumulator = nullptr;
+  if (is_reduce) {
+    if (has_initial_value) {
+      initial_accumulator = args[1];
+    } else {
+      // ```
+      // if (length == 0) throw TypeError
+      // accumulator = array.elements[0]
+      // ```
+      // The continuation throws the TypeError for an empty array.
+      DeoptFrameScope eager_deopt_scope(
+          this, Builtin::kArrayReducePreLoopEagerDeoptContinuation, target,
+          base::VectorOf<ValueNode*>({receiver, callback, original_length}));
+      RETURN_IF_ABORT(TryBuildCheckInt32Condition(
+          GetInt32Constant(0), original_length_int32, AssertCondition::kLessThan,
+          DeoptimizeReason::kNoInitialElement));
+      ValueNode* elements = BuildLoadElements(receiver);
+      initial_accumulator =
+          IsDoubleElementsKind(elements_kind)
+              ? BuildLoadFixedDoubleArrayElement(elements, 0)
+              : BuildLoadFixedArrayElement(elements, 0);
+      initial_index = GetSmiConstant(1);
+    }
+  }
+
   // Remember the receiver map set before entering the loop the call.
   bool receiver_maps_were_unstable = node_info->possible_maps_are_unstable();
   PossibleMaps receiver_maps_before_loop(node_info->possible_maps());
 
-  // Create a sub graph builder with two variable (index and length)
-  MaglevSubGraphBuilder sub_builder(this, 2);
+  // Create a sub graph builder with three variables (index, length and
+  // result). The result is the accumulator for reduce, and the value returned
+  // on leaving the loop for every, some, find and findIndex.
+  MaglevSubGraphBuilder sub_builder(this, 3);
   MaglevSubGraphBuilder::Variable var_index(0);
   MaglevSubGraphBuilder::Variable var_length(1);
-
-  MaglevSubGraphBuilder::Label loop_end(&sub_builder, 1);
+  MaglevSubGraphBuilder::Variable var_result(2);
+
+  // every, some, find and findIndex can also leave the loop early, depending
+  // on the callback's return value.
+  const bool has_early_exit = kind != ArrayIteratingBuiltinKind::kForEach &&
+                              kind != ArrayIteratingBuiltinKind::kReduce;
+  std::optional<MaglevSubGraphBuilder::Label> loop_end;
+  if (kind == ArrayIteratingBuiltinKind::kForEach) {
+    loop_end.emplace(&sub_builder, 1);
+  } else {
+    loop_end.emplace(
+        &sub_builder, has_early_exit ? 2 : 1,
+        std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_result});
+  }
 
   // ```
   // index = 0
   // bind loop_header
   // ```
-  sub_builder.set(var_index, GetSmiConstant(0));
+  sub_builder.set(var_index, initial_index);
   sub_builder.set(var_length, original_length);
-  MaglevSubGraphBuilder::LoopLabel loop_header =
-      sub_builder.BeginLoop({&var_index, &var_length});
+  std::optional<MaglevSubGraphBuilder::LoopLabel> loop_header;
+  if (is_reduce) {
+    sub_builder.set(var_result, initial_accumulator);
+    loop_header.emplace(
+        sub_builder.BeginLoop({&var_index, &var_length, &var_result}));
+  } else {
+    loop_header.emplace(sub_builder.BeginLoop({&var_index, &var_length}));
+  }
 
   // Reset known state that is cleared by BeginLoop, but is known to be true on
   // the first iteration, and will be re-checked at the end of the loop.
@@ -8282,8 +8537,25 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   EnsureType(index_tagged, NodeType::kSmi);
   ValueNode* index_int32 = GetInt32(index_tagged);
 
+  switch (kind) {
+    case ArrayIteratingBuiltinKind::kEvery:
+      sub_builder.set(var_result, GetBooleanConstant(true));
+      break;
+    case ArrayIteratingBuiltinKind::kSome:
+      sub_builder.set(var_result, GetBooleanConstant(false));
+      break;
+    case ArrayIteratingBuiltinKind::kFind:
+      sub_builder.set(var_result, GetRootConstant(RootIndex::kUndefinedValue));
+      break;
+    case ArrayIteratingBuiltinKind::kFindIndex:
+      sub_builder.set(var_result, GetSmiConstant(-1));
+      break;
+    case ArrayIteratingBuiltinKind::kForEach:
+    case ArrayIteratingBuiltinKind::kReduce:
+      break;
+  }
   sub_builder.GotoIfFalse<BranchIfInt32Compare>(
-      &loop_end, {index_int32, original_length_int32}, Operation::kLessThan);
+      &*loop_end, {index_int32, original_length_int32}, Operation::kLessThan);
 
   // ```
   // next_index = index + 1
@@ -8295,9 +8567,9 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
     // possible array length is less than int32 max value. Add a new
     // Int32Increment that asserts no overflow instead of deopting.
     DeoptFrameScope eager_deopt_scope(
-        this, Builtin::kArrayForEachLoopEagerDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, index_int32, original_length}));
+        this, eager_continuation, target,
+        base::VectorOf(continuation_params(
+            index_int32, is_reduce ? sub_builder.get(var_result) : nullptr)));
     next_index_int32 = AddNewNode<Int32IncrementWithOverflow>({index_int32});
     EnsureType(next_index_int32, NodeType::kSmi);
   }
@@ -8306,22 +8578,38 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   // ```
   // element = array.elements[index]
   // ```
+  // find and findIndex visit holes as undefined, the others skip them.
+  const bool skips_holes = kind != ArrayIteratingBuiltinKind::kFind &&
+                           kind != ArrayIteratingBuiltinKind::kFindIndex;
   ValueNode* elements = BuildLoadElements(receiver);
   ValueNode* element;
   if (IsDoubleElementsKind(elements_kind)) {
-    element = BuildLoadFixedDoubleArrayElement(elements, index_int32);
+    element = !skips_holes && IsHoleyElementsKind(elements_kind)
+                  ? BuildLoadHoleyFixedDoubleArrayElement(
+                        elements, index_int32, /*convert_hole*/ true)
+                  : BuildLoadFixedDoubleArrayElement(elements, index_int32);
   } else {
     element = BuildLoadFixedArrayElement(elements, index_int32);
+    if (!skips_holes && IsHoleyElementsKind(elements_kind)) {
+      element = BuildConvertHoleToUndefined(element);
+    }
   }
 
   std::optional<MaglevSubGraphBuilder::Label> skip_call;
-  if (IsHoleyElementsKind(elements_kind)) {
+  if (skips_holes && IsHoleyElementsKind(elements_kind)) {
     // ```
     // if (element is hole) goto skip_call
     // ```
-    skip_call.emplace(
-        &sub_builder, 2,
-        std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_length});
+    if (is_reduce) {
+      skip_call.emplace(
+          &sub_builder, 2,
+          std::initializer_list<MaglevSubGraphBuilder::Variable*>{
+              &var_length, &var_result});
+    } else {
+      skip_call.emplace(
+          &sub_builder, 2,
+          std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_length});
+    }
     if (elements_kind == HOLEY_DOUBLE_ELEMENTS) {
       sub_builder.GotoIfTrue<BranchIfFloat64IsHole>(&*skip_call, {element});
     } else {
@@ -8331,17 +8619,31 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   }
 
   // ```
-  // callback(this_arg, element, array)
+  // callback(this_arg, element, index, array)
   // ```
+  // every and some continue after the callback by re-checking the current
+  // index, the other continuations expect the next one.
+  const bool is_every_or_some = kind == ArrayIteratingBuiltinKind::kEvery ||
+                                kind == ArrayIteratingBuiltinKind::kSome;
+  ValueNode* found_value = nullptr;
+  if (kind == ArrayIteratingBuiltinKind::kFind) {
+    found_value = element;
+  } else if (kind == ArrayIteratingBuiltinKind::kFindIndex) {
+    found_value = index_tagged;
+  }
   MaybeReduceResult result;
   {
     DeoptFrameScope lazy_deopt_scope(
-        this, Builtin::kArrayForEachLoopLazyDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, next_index_int32, original_length}));
+        this, after_callback_continuation, target,
+        base::VectorOf(continuation_params(
+            is_every_or_some ? index_int32 : next_index_int32, found_value)));
 
     CallArguments call_args =
-        args.count() < 2
+        is_reduce
+            ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
+                            {sub_builder.get(var_result), element,
+                             index_tagged, receiver})
+        : args.count() < 2
             ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
                             {element, index_tagged, receiver})
             : CallArguments(ConvertReceiverMode::kAny,
@@ -8359,6 +8661,38 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
 
   // No need to finish the loop if this code is unreachable.
   if (!result.IsDoneWithAbort()) {
+    switch (kind) {
+      case ArrayIteratingBuiltinKind::kForEach:
+        break;
+      case ArrayIteratingBuiltinKind::kReduce:
+        // ```
+        // accumulator = callback_result
+        // ```
+        sub_builder.set(var_result, result.value());
+        break;
+      case ArrayIteratingBuiltinKind::kEvery:
+      case ArrayIteratingBuiltinKind::kSome:
+      case ArrayIteratingBuiltinKind::kFind:
+      case ArrayIteratingBuiltinKind::kFindIndex: {
+        // ```
+        // if (ToBoolean(callback_result) != continue) goto end
+        // ```
+        ValueNode* is_done;
+        if (kind == ArrayIteratingBuiltinKind::kEvery) {
+          is_done = BuildToBoolean</* flip */ true>(result.value());
+          sub_builder.set(var_result, GetBooleanConstant(false));
+        } else {
+          is_done = BuildToBoolean(result.value());
+          sub_builder.set(var_result, kind == ArrayIteratingBuiltinKind::kSome
+                                          ? GetBooleanConstant(true)
+                                          : found_value);
+        }
+        sub_builder.GotoIfTrue<BranchIfRootConstant>(
+            &*loop_end, {is_done}, RootIndex::kTrueValue);
+        break;
+      }
+    }
+
     // If any of the receiver's maps were unstable maps, we have to re-check the
     // maps on each iteration, in case the callback changed them. That said, we
     // know that the maps are valid on the first iteration, so we can rotate the
@@ -8383,9 +8717,10 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
     // Make sure to finish the loop if we eager deopt in the map check or index
     // check.
     DeoptFrameScope eager_deopt_scope(
-        this, Builtin::kArrayForEachLoopEagerDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, next_index_int32, original_length}));
+        this, eager_continuation, target,
+        base::VectorOf(continuation_params(
+            next_index_int32,
+            is_reduce ? sub_builder.get(var_result) : nullptr)));
 
     if (recheck_maps_after_call) {
       // Build the CheckMap manually, since we're doing it with already known
@@ -8418,6 +8753,9 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
                                       AssertCondition::kUnsignedLessThanEqual,
                                       DeoptimizeReason::kArrayLengthChanged));
     }
+  } else if (has_early_exit) {
+    // The callback never returns, so neither does the early exit.
+    sub_builder.ReducePredecessorCount(&*loop_end);
   }
 
   if (skip_call.has_value()) {
@@ -8426,14 +8764,60 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   }
 
   sub_builder.set(var_index, next_index_int32);
-  sub_builder.EndLoop(&loop_header);
+  sub_builder.EndLoop(&*loop_header);
 
   // ```
   // bind end
   // ```
-  sub_builder.Bind(&loop_end);
+  sub_builder.Bind(&*loop_end);
 
-  return GetRootConstant(RootIndex::kUndefinedValue);
+  if (kind == ArrayIteratingBuiltinKind::kForEach) {
+    return GetRootConstant(RootIndex::kUndefinedValue);
+  }
+  return sub_builder.get(var_result);
+}
+
+
+MaybeReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin("Array.prototype.forEach",
+                                        ArrayIteratingBuiltinKind::kForEach,
+                                        target, args);
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryReduceArrayEvery(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin("Array.prototype.every",
+                                        ArrayIteratingBuiltinKind::kEvery,
+                                        target, args);
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryReduceArraySome(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin("Array.prototype.some",
+                                        ArrayIteratingBuiltinKind::kSome,
+                                        target, args);
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryReduceArrayPrototypeFind(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin("Array.prototype.find",
+                                        ArrayIteratingBuiltinKind::kFind,
+                                        target, args);
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryReduceArrayPrototypeFindIndex(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin("Array.prototype.findIndex",
+                                        ArrayIteratingBuiltinKind::kFindIndex,
+                                        target, args);
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryReduceArrayReduce(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin("Array.prototype.reduce",
+                                        ArrayIteratingBuiltinKind::kReduce,
+                                        target, args);
 }
 
 MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratorPrototypeNext(
@@ -10300,9 +10684,11 @@ ReduceResult MaglevGraphBuilder::ReduceCallWithArrayLikeForArgumentsObject(
     ValueNode* target_node, CallArguments& args,
     VirtualObject* arguments_object,
     const compiler::FeedbackSource& feedback_source) {
-  DCHECK_EQ(args.mode(), CallArguments::kWithArrayLike);
+  DCHECK_NE(args.mode(), CallArguments::kDefault);
   DCHECK(arguments_object->map().IsJSArgumentsObjectMap() ||
          arguments_object->map().IsJSArrayMap());
+  DCHECK_IMPLIES(args.mode() == CallArguments::kWithSpread,
+                 arguments_object->map().IsJSArrayMap());
   args.PopArrayLikeArgument();
   ValueNode* elements_value =
       arguments_object->get(JSArgumentsObject::kElementsOffset);
@@ -10417,6 +10803,24 @@ MaglevGraphBuilder::TryGetNonEscapingArgumentsObject(ValueNode* value) {
   return {};
 }
 
+MaybeReduceResult MaglevGraphBuilder::TryReduceCallWithSpread(
+    ValueNode* target_node, CallArguments& args,
+    const compiler::FeedbackSource& feedback_source) {
+  DCHECK_EQ(args.mode(), CallArguments::kWithSpread);
+
+  // Spreading a rest parameter that hasn't escaped yields exactly the
+  // arguments it was created from, as long as array iteration is unmodified,
+  // so forward those instead of iterating the array.
+  std::optional<VirtualObject*> rest_parameter =
+      TryGetNonEscapingArgumentsObject(args.array_like_argument());
+  if (!rest_parameter.has_value() || !(*rest_parameter)->map().IsJSArrayMap()) {
+    return {};
+  }
+  if (!broker()->dependencies()->DependOnArrayIteratorProtector()) return {};
+  return ReduceCallWithArrayLikeForArgumentsObject(
+      target_node, args, *rest_parameter, feedback_source);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCallWithArrayLike(
     ValueNode* target_node, CallArguments& args,
     const compiler::FeedbackSource& feedback_source) {
@@ -10436,6 +10840,10 @@ ReduceResult MaglevGraphBuilder::ReduceCallWithArrayLike(
 ReduceResult MaglevGraphBuilder::ReduceCall(
     ValueNode* target_node, CallArguments& args,
     const compiler::FeedbackSource& feedback_source) {
+  if (args.mode() == CallArguments::kWithSpread) {
+    RETURN_IF_DONE(TryReduceCallWithSpread(target_node, args, feedback_source));
+  }
+
   if (compiler::OptionalHeapObjectRef maybe_constant =
           TryGetConstant(target_node)) {
     if (maybe_constant->IsJSFunction()) {
@@ -14237,8 +14645,15 @@ ReduceResult MaglevGraphBuilder::VisitDebugger() {
 }
 
 ReduceResult MaglevGraphBuilder::VisitIncBlockCounter() {
-  ValueNode* closure = GetClosure();
   ValueNode* coverage_array_slot = GetSmiConstant(iterator_.GetIndexOperand(0));
+  compiler::OptionalHeapObjectRef coverage_info =
+      compilation_unit_->shared_function_info().coverage_info(broker());
+  if (coverage_info.has_value()) {
+    BuildCallBuiltin<Builtin::kIncCoverageInfoBlockCounter>(
+        {GetConstant(coverage_info.value()), coverage_array_slot});
+    return ReduceResult::Done();
+  }
+  ValueNode* closure = GetClosure();
   BuildCallBuiltin<Builtin::kIncBlockCounter>(
       {GetTaggedValue(closure), coverage_array_slot});
   return ReduceResult::Done();
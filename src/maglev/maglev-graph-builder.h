@@ -1927,12 +1927,17 @@ class MaglevGraphBuilder {
 
 #define MAGLEV_REDUCED_BUILTIN(V)              \
   V(ArrayConstructor)                          \
+  V(ArrayEvery)                                \
   V(ArrayForEach)                              \
   V(ArrayIsArray)                              \
   V(ArrayIteratorPrototypeNext)                \
   V(ArrayPrototypeEntries)                     \
   V(ArrayPrototypeKeys)                        \
+  V(ArrayPrototypeFind)                        \
+  V(ArrayPrototypeFindIndex)                   \
   V(ArrayPrototypeValues)                      \
+  V(ArrayReduce)                               \
+  V(ArraySome)                                 \
   V(DataViewPrototypeGetInt8)                  \
   V(DataViewPrototypeSetInt8)                  \
   V(DataViewPrototypeGetInt16)                 \
@@ -1971,6 +1976,20 @@ class MaglevGraphBuilder {
   MAGLEV_REDUCED_BUILTIN(DEFINE_BUILTIN_REDUCER)
 #undef DEFINE_BUILTIN_REDUCER
 
+  // The Array.prototype builtins that call a callback for each element, and
+  // are inlined as a loop over a fast JSArray receiver.
+  enum class ArrayIteratingBuiltinKind {
+    kForEach,
+    kEvery,
+    kSome,
+    kFind,
+    kFindIndex,
+    kReduce,
+  };
+  MaybeReduceResult TryReduceArrayIteratingBuiltin(
+      const char* name, ArrayIteratingBuiltinKind kind,
+      compiler::JSFunctionRef target, CallArguments& args);
+
   MaybeReduceResult TryReduceGetProto(ValueNode* node);
 
   template <typename MapKindsT, typename IndexToElementsKindFunc,
@@ -2055,6 +2074,9 @@ class MaglevGraphBuilder {
   ReduceResult ReduceCallWithArrayLike(
       ValueNode* target_node, CallArguments& args,
       const compiler::FeedbackSource& feedback_source);
+  MaybeReduceResult TryReduceCallWithSpread(
+      ValueNode* target_node, CallArguments& args,
+      const compiler::FeedbackSource& feedback_source);
   ReduceResult ReduceCall(ValueNode* target_node, CallArguments& args,
                           const compiler::FeedbackSource& feedback_source =
                               compiler::FeedbackSource());
@@ -2297,6 +2319,13 @@ class MaglevGraphBuilder {
       ValueNode* receiver, ValueNode* lookup_start_object,
       compiler::NameRef name, compiler::PropertyAccessInfo const& access_info,
       compiler::AccessMode access_mode);
+  MaybeReduceResult TryBuildProxyNamedAccess(
+      ValueNode* receiver, ValueNode* lookup_start_object,
+      compiler::ZoneRefSet<Map> const& maps, compiler::NameRef name,
+      compiler::AccessMode access_mode);
+  MaybeReduceResult TryReduceConstantProxyGet(compiler::HeapObjectRef proxy,
+                                              ValueNode* receiver,
+                                              compiler::NameRef name);
   template <typename GenericAccessFunc>
   MaybeReduceResult TryBuildNamedAccess(
       ValueNode* receiver, ValueNode* lookup_start_object,
@@ -4761,6 +4761,14 @@ void GeneratorStore::GenerateCode(MaglevAssembler* masm,
     // inputs.
     register_snapshot_during_store.live_registers.set(value);
     register_snapshot_during_store.live_tagged_registers.set(value);
+    // Dead registers are stored as the optimized_out root. Neither read-only
+    // roots nor Smis need a write barrier, so those are plain stores.
+    if (value_input.node()->Is<RootConstant>() ||
+        value_input.node()->Is<SmiConstant>()) {
+      __ StoreTaggedFieldNoWriteBarrier(array, FixedArray::OffsetOfElementAt(i),
+                                        value);
+      continue;
+    }
     __ StoreTaggedFieldWithWriteBarrier(
         array, FixedArray::OffsetOfElementAt(i), value,
         register_snapshot_during_store,
@@ -6829,6 +6837,11 @@ void GenerateTypedArrayLoad(MaglevAssembler* masm, NodeT* node, Register object,
     DCHECK(IsFloatTypedArrayElementsKind(kind));
 #endif
     switch (kind) {
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+      case FLOAT16_ELEMENTS:
+        __ LoadFloat16(result_reg, operand);
+        break;
+#endif  // V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
       case FLOAT32_ELEMENTS:
         __ LoadFloat32(result_reg, operand);
         break;
@@ -6870,6 +6883,11 @@ void GenerateTypedArrayStore(MaglevAssembler* masm, NodeT* node,
     DCHECK(IsFloatTypedArrayElementsKind(kind));
 #endif
     switch (kind) {
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+      case FLOAT16_ELEMENTS:
+        __ StoreFloat16(operand, value);
+        break;
+#endif  // V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
       case FLOAT32_ELEMENTS:
         __ StoreFloat32(operand, value);
         break;
@@ -6914,7 +6932,13 @@ DEF_LOAD_TYPED_ARRAY(LoadDoubleTypedArrayElement, DoubleRegister,
     UseRegister(object_input());                                               \
     UseRegister(index_input());                                                \
     UseRegister(value_input());                                                \
-    set_temporaries_needed(1);                                                 \
+    if (elements_kind_ == FLOAT16_ELEMENTS) {                                  \
+      /* For the conversion in MaglevAssembler::StoreFloat16. */               \
+      set_temporaries_needed(2);                                               \
+      set_double_temporaries_needed(1);                                        \
+    } else {                                                                   \
+      set_temporaries_needed(1);                                               \
+    }                                                                          \
   }                                                                            \
   void Name::GenerateCode(MaglevAssembler* masm,                               \
                           const ProcessingState& state) {                      \
@@ -5,6 +5,8 @@
 #ifndef V8_MAGLEV_MAGLEV_POST_HOC_OPTIMIZATIONS_PROCESSORS_H_
 #define V8_MAGLEV_MAGLEV_POST_HOC_OPTIMIZATIONS_PROCESSORS_H_
 
+#include <map>
+
 #include "src/compiler/heap-refs.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-graph-builder.h"
@@ -135,18 +137,61 @@ class LoopOptimizationProcessor {
     if (IsLoopPhi(object)) {
       return ProcessResult::kSkipBlock;
     }
-    if (!loop_effects->unstable_aspects_cleared && CanHoist(maps)) {
-      if (auto j = current_block->predecessor_at(0)
-                       ->control_node()
-                       ->TryCast<CheckpointedJump>()) {
-        maps->SetEagerDeoptInfo(zone, j->eager_deopt_info()->top_frame(),
-                                maps->eager_deopt_info()->feedback_to_update());
-        return ProcessResult::kHoist;
-      }
+    if (!loop_effects->unstable_aspects_cleared && CanHoist(maps) &&
+        TryMoveEagerDeoptInfoToLoopEntry(maps)) {
+      return ProcessResult::kHoist;
+    }
+    return ProcessResult::kSkipBlock;
+  }
+
+  // Unlike maps, the aspects checked by these checks never change for a given
+  // value, thus they can be hoisted even if the loop clears unstable aspects.
+  ProcessResult Process(CheckSmi* check, const ProcessingState& state) {
+    return ProcessStableCheck(check, check->receiver_input().node());
+  }
+
+  ProcessResult Process(CheckHeapObject* check, const ProcessingState& state) {
+    return ProcessStableCheck(check, check->receiver_input().node());
+  }
+
+  ProcessResult Process(CheckNumber* check, const ProcessingState& state) {
+    return ProcessStableCheck(check, check->receiver_input().node());
+  }
+
+  ProcessResult Process(CheckString* check, const ProcessingState& state) {
+    return ProcessStableCheck(check, check->receiver_input().node());
+  }
+
+  ProcessResult Process(CheckSymbol* check, const ProcessingState& state) {
+    return ProcessStableCheck(check, check->receiver_input().node());
+  }
+
+  template <typename NodeT>
+  ProcessResult ProcessStableCheck(NodeT* check, ValueNode* object) {
+    DCHECK(loop_effects);
+    // See CheckMaps for why we stop at the first check that is not hoisted.
+    if (was_deoptimized) return ProcessResult::kSkipBlock;
+    if (IsLoopPhi(object)) return ProcessResult::kSkipBlock;
+    if (CanHoist(check) && TryMoveEagerDeoptInfoToLoopEntry(check)) {
+      return ProcessResult::kHoist;
     }
     return ProcessResult::kSkipBlock;
   }
 
+  // A hoisted check deopts to the state before the loop, which is only
+  // available if the loop is entered through a CheckpointedJump.
+  template <typename NodeT>
+  bool TryMoveEagerDeoptInfoToLoopEntry(NodeT* check) {
+    if (auto j = current_block->predecessor_at(0)
+                     ->control_node()
+                     ->TryCast<CheckpointedJump>()) {
+      check->SetEagerDeoptInfo(zone, j->eager_deopt_info()->top_frame(),
+                               check->eager_deopt_info()->feedback_to_update());
+      return true;
+    }
+    return false;
+  }
+
   template <typename NodeT>
   ProcessResult Process(NodeT* node, const ProcessingState& state) {
     // Ensure we are not hoisting over checks.
@@ -176,6 +221,12 @@ constexpr bool CanBeStoreToNonEscapedObject() {
 
 class AnyUseMarkingProcessor {
  public:
+  explicit AnyUseMarkingProcessor(MaglevCompilationInfo* compilation_info) {
+    if (V8_UNLIKELY(compilation_info->has_graph_labeller())) {
+      labeller_ = compilation_info->graph_labeller();
+    }
+  }
+
   void PreProcessGraph(Graph* graph) {}
   BlockProcessResult PreProcessBasicBlock(BasicBlock* block) {
     return BlockProcessResult::kContinue;
@@ -201,6 +252,16 @@ class AnyUseMarkingProcessor {
       }
     }
 
+    if constexpr (std::is_same_v<NodeT, FastCreateClosure> ||
+                  std::is_same_v<NodeT, CreateClosure>) {
+      ValueNode* context = node->context().node();
+      if (V8_UNLIKELY(v8_flags.trace_maglev_escape_analysis) &&
+          context->template Is<InlinedAllocation>()) {
+        closures_over_allocations_[context->template Cast<InlinedAllocation>()]
+            .push_back(node);
+      }
+    }
+
     return ProcessResult::kContinue;
   }
 
@@ -212,11 +273,38 @@ class AnyUseMarkingProcessor {
 
   void PostProcessGraph(Graph* graph) {
     RunEscapeAnalysis(graph);
+    if (V8_UNLIKELY(v8_flags.trace_maglev_escape_analysis && labeller_)) {
+      TraceContextsEscapingThroughClosures();
+    }
     DropUseOfValueInStoresToCapturedAllocations();
   }
 
  private:
   std::vector<Node*> stores_to_allocations_;
+  // Closures whose context is an inlined allocation. Closures are created by
+  // a runtime call that takes the context as a regular input, which escapes
+  // the context even if every call to the closure was inlined.
+  std::map<InlinedAllocation*, std::vector<ValueNode*>>
+      closures_over_allocations_;
+  MaglevGraphLabeller* labeller_ = nullptr;
+
+  // Reports context allocations that could have been elided if their closures
+  // were virtual objects too, i.e. allocations whose only escaping uses are
+  // closure creations.
+  void TraceContextsEscapingThroughClosures() {
+    for (const auto& [context, closures] : closures_over_allocations_) {
+      if (!context->HasEscaped()) continue;
+      int escaping_uses =
+          context->use_count() - context->non_escaping_use_count();
+      if (escaping_uses != static_cast<int>(closures.size())) continue;
+      std::cout << "* Context allocation " << PrintNodeLabel(labeller_, context)
+                << " only escapes through closures";
+      for (ValueNode* closure : closures) {
+        std::cout << " " << PrintNodeLabel(labeller_, closure);
+      }
+      std::cout << std::endl;
+    }
+  }
 
   void EscapeAllocation(Graph* graph, InlinedAllocation* alloc,
                         Graph::SmallAllocationVector& deps) {
@@ -178,7 +178,9 @@ bool IsDeadNodeToSkip(Node* node) {
 
 StraightForwardRegisterAllocator::StraightForwardRegisterAllocator(
     MaglevCompilationInfo* compilation_info, Graph* graph)
-    : compilation_info_(compilation_info), graph_(graph) {
+    : compilation_info_(compilation_info),
+      graph_(graph),
+      catch_block_uses_(compilation_info->zone()) {
   ComputePostDominatingHoles();
   AllocateRegisters();
   uint32_t tagged_stack_slots = tagged_.top;
@@ -668,6 +670,54 @@ void StraightForwardRegisterAllocator::AllocateLazyDeopt(
                            });
 }
 
+const ZoneSet<ValueNode*>& StraightForwardRegisterAllocator::GetCatchBlockUses(
+    BasicBlock* catch_block) {
+  auto [it, inserted] =
+      catch_block_uses_.try_emplace(catch_block, compilation_info_->zone());
+  ZoneSet<ValueNode*>& uses = it->second;
+  if (!inserted) return uses;
+
+  // Collect every value used in a block reachable from the catch block,
+  // including through back edges and nested exception handlers. This
+  // over-approximates the values live on entry to the catch block.
+  ZoneQueue<BasicBlock*> queue(compilation_info_->zone());
+  ZoneSet<BasicBlock*> seen(compilation_info_->zone());
+  auto visit_block = [&](BasicBlock* succ) {
+    if (seen.insert(succ).second) queue.push(succ);
+  };
+  auto add_use = [&](ValueNode* value, InputLocation*) {
+    uses.insert(value);
+  };
+  auto visit_node = [&](NodeBase* node) {
+    for (Input& input : *node) uses.insert(input.node());
+    if (node->properties().can_eager_deopt()) {
+      detail::DeepForEachInput(node->eager_deopt_info(), add_use);
+    }
+    if (node->properties().can_lazy_deopt()) {
+      detail::DeepForEachInput(node->lazy_deopt_info(), add_use);
+    }
+    if (node->properties().can_throw()) {
+      ExceptionHandlerInfo* info = node->exception_handler_info();
+      if (info->HasExceptionHandler() && !info->ShouldLazyDeopt()) {
+        visit_block(info->catch_block.block_ptr());
+      }
+    }
+  };
+
+  visit_block(catch_block);
+  while (!queue.empty()) {
+    BasicBlock* block = queue.front();
+    queue.pop();
+    if (block->has_phi()) {
+      for (Phi* phi : *block->phis()) visit_node(phi);
+    }
+    for (Node* node : block->nodes()) visit_node(node);
+    visit_node(block->control_node());
+    block->ForEachSuccessor(visit_block);
+  }
+  return uses;
+}
+
 #ifdef DEBUG
 namespace {
 #define GET_NODE_RESULT_REGISTER_T(RegisterT, AssignedRegisterT) \
@@ -725,14 +775,19 @@ void StraightForwardRegisterAllocator::AllocateNode(Node* node) {
       printing_visitor_->os() << "Allocating lazy deopt inputs...\n";
     }
     // Ensure all values live from a throwing node across its catch block are
-    // spilled so they can properly be merged after the catch block.
+    // spilled so they can properly be merged after the catch block. Values
+    // that are only used on paths the catch block can't reach (e.g. after a
+    // catch block that returns) stay in registers, so that the non-throwing
+    // path doesn't pay for the spill.
     if (node->properties().can_throw()) {
       ExceptionHandlerInfo* info = node->exception_handler_info();
       if (info->HasExceptionHandler() && !info->ShouldLazyDeopt() &&
           !node->properties().is_call()) {
         BasicBlock* block = info->catch_block.block_ptr();
+        const ZoneSet<ValueNode*>& catch_block_uses = GetCatchBlockUses(block);
         auto spill = [&](auto reg, ValueNode* node) {
           if (node->live_range().end < block->first_id()) return;
+          if (!catch_block_uses.contains(node)) return;
           Spill(node);
         };
         general_registers_.ForEachUsedRegister(spill);
@@ -183,6 +183,7 @@ class StraightForwardRegisterAllocator {
   void AllocateNodeResult(ValueNode* node);
   void AllocateEagerDeopt(const EagerDeoptInfo& deopt_info);
   void AllocateLazyDeopt(const LazyDeoptInfo& deopt_info);
+  const ZoneSet<ValueNode*>& GetCatchBlockUses(BasicBlock* catch_block);
   void AssignFixedInput(Input& input);
   void AssignArbitraryRegisterInput(NodeBase* result_node, Input& input);
   void AssignAnyInput(Input& input);
@@ -297,6 +298,9 @@ class StraightForwardRegisterAllocator {
   NodeIterator node_it_;
   // The current node, whether a Node in the body or the ControlNode.
   NodeBase* current_node_;
+  // Values used on some path starting at an exception handler block, computed
+  // on demand for the catch blocks of non-call throwing nodes.
+  ZoneMap<BasicBlock*, ZoneSet<ValueNode*>> catch_block_uses_;
 };
 
 }  // namespace maglev
@@ -675,6 +675,22 @@ inline void MaglevAssembler::LoadFloat64(DoubleRegister dst, MemOperand src) {
 inline void MaglevAssembler::StoreFloat64(MemOperand dst, DoubleRegister src) {
   Movsd(dst, src);
 }
+inline void MaglevAssembler::LoadFloat16(DoubleRegister dst, MemOperand src) {
+  TemporaryRegisterScope temps(this);
+  Register scratch = temps.AcquireScratch();
+  movzxwl(scratch, src);
+  Movd(dst, scratch);
+  Cvtph2pd(dst, dst);
+}
+inline void MaglevAssembler::StoreFloat16(MemOperand dst, DoubleRegister src) {
+  TemporaryRegisterScope temps(this);
+  Register scratch = temps.Acquire();
+  DoubleRegister half = temps.AcquireDouble();
+  // Cvtpd2ph also clobbers kScratchRegister and kScratchDoubleReg.
+  Cvtpd2ph(half, src, scratch);
+  Movd(scratch, half);
+  movw(dst, scratch);
+}
 
 inline void MaglevAssembler::LoadUnalignedFloat64(DoubleRegister dst,
                                                   Register base,
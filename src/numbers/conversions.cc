@@ -107,7 +107,8 @@ class SimpleStringBuilder final {
     uint32_t number = static_cast<uint32_t>(value);
     if (value < 0) {
       AddCharacter('-');
-      number = static_cast<uint32_t>(-value);
+      // Negate as unsigned, which is also well-defined for kMinInt.
+      number = 0u - number;
     }
     int digits = 1;
     for (uint32_t factor = 10; digits < 10; digits++, factor *= 10) {
@@ -940,6 +941,57 @@ std::unique_ptr<char[]> BigIntLiteralToDecimal(
   return helper.DecimalString(isolate->bigint_processor());
 }
 
+namespace {
+
+// Adds the ECMA-262 9.8.1 representation of a finite, non-zero double that is
+// not an int32 to the builder.
+void AddDoubleRepresentation(SimpleStringBuilder* builder, double v) {
+  int decimal_point;
+  int sign;
+  constexpr int kV8DtoaBufferCapacity = base::kBase10MaximalLength + 1;
+  char decimal_rep[kV8DtoaBufferCapacity];
+  int length;
+
+  base::DoubleToAscii(v, base::DTOA_SHORTEST, 0,
+                      base::Vector<char>(decimal_rep, kV8DtoaBufferCapacity),
+                      &sign, &length, &decimal_point);
+
+  if (sign) builder->AddCharacter('-');
+
+  if (length <= decimal_point && decimal_point <= 21) {
+    // ECMA-262 section 9.8.1 step 6.
+    builder->AddString(decimal_rep, length);
+    builder->AddPadding('0', decimal_point - length);
+
+  } else if (0 < decimal_point && decimal_point <= 21) {
+    // ECMA-262 section 9.8.1 step 7.
+    builder->AddSubstring(decimal_rep, decimal_point);
+    builder->AddCharacter('.');
+    builder->AddString(decimal_rep + decimal_point, length - decimal_point);
+
+  } else if (decimal_point <= 0 && decimal_point > -6) {
+    // ECMA-262 section 9.8.1 step 8.
+    builder->AddStringLiteral("0.");
+    builder->AddPadding('0', -decimal_point);
+    builder->AddString(decimal_rep, length);
+
+  } else {
+    // ECMA-262 section 9.8.1 step 9 and 10 combined.
+    builder->AddCharacter(decimal_rep[0]);
+    if (length != 1) {
+      builder->AddCharacter('.');
+      builder->AddString(decimal_rep + 1, length - 1);
+    }
+    builder->AddCharacter('e');
+    builder->AddCharacter((decimal_point >= 0) ? '+' : '-');
+    int exponent = decimal_point - 1;
+    if (exponent < 0) exponent = -exponent;
+    builder->AddDecimalInteger(exponent);
+  }
+}
+
+}  // namespace
+
 std::string_view DoubleToStringView(double v, base::Vector<char> buffer) {
   switch (FPCLASSIFY_NAMESPACE::fpclassify(v)) {
     case FP_NAN:
@@ -955,54 +1007,34 @@ std::string_view DoubleToStringView(double v, base::Vector<char> buffer) {
         return IntToStringView(FastD2I(v), buffer);
       }
       SimpleStringBuilder builder(buffer.begin(), buffer.size());
-      int decimal_point;
-      int sign;
-      constexpr int kV8DtoaBufferCapacity = base::kBase10MaximalLength + 1;
-      char decimal_rep[kV8DtoaBufferCapacity];
-      int length;
-
-      base::DoubleToAscii(
-          v, base::DTOA_SHORTEST, 0,
-          base::Vector<char>(decimal_rep, kV8DtoaBufferCapacity), &sign,
-          &length, &decimal_point);
-
-      if (sign) builder.AddCharacter('-');
-
-      if (length <= decimal_point && decimal_point <= 21) {
-        // ECMA-262 section 9.8.1 step 6.
-        builder.AddString(decimal_rep, length);
-        builder.AddPadding('0', decimal_point - length);
-
-      } else if (0 < decimal_point && decimal_point <= 21) {
-        // ECMA-262 section 9.8.1 step 7.
-        builder.AddSubstring(decimal_rep, decimal_point);
-        builder.AddCharacter('.');
-        builder.AddString(decimal_rep + decimal_point, length - decimal_point);
-
-      } else if (decimal_point <= 0 && decimal_point > -6) {
-        // ECMA-262 section 9.8.1 step 8.
-        builder.AddStringLiteral("0.");
-        builder.AddPadding('0', -decimal_point);
-        builder.AddString(decimal_rep, length);
-
-      } else {
-        // ECMA-262 section 9.8.1 step 9 and 10 combined.
-        builder.AddCharacter(decimal_rep[0]);
-        if (length != 1) {
-          builder.AddCharacter('.');
-          builder.AddString(decimal_rep + 1, length - 1);
-        }
-        builder.AddCharacter('e');
-        builder.AddCharacter((decimal_point >= 0) ? '+' : '-');
-        int exponent = decimal_point - 1;
-        if (exponent < 0) exponent = -exponent;
-        builder.AddDecimalInteger(exponent);
-      }
+      AddDoubleRepresentation(&builder, v);
       return {buffer.begin(), builder.Finalize()};
     }
   }
 }
 
+std::string_view DoublesToJsonStringView(base::Vector<const double> values,
+                                         bool leading_comma,
+                                         base::Vector<char> buffer) {
+  DCHECK_GE(buffer.size(), values.size() * kDoubleToJsonMaxLength);
+  SimpleStringBuilder builder(buffer.begin(), buffer.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    if (i > 0 || leading_comma) builder.AddCharacter(',');
+    double v = values[i];
+    if (!std::isfinite(v)) {
+      builder.AddStringLiteral("null");
+    } else if (v == 0) {
+      // Also covers -0, which is stringified to "0".
+      builder.AddCharacter('0');
+    } else if (IsInt32Double(v)) {
+      builder.AddDecimalInteger(FastD2I(v));
+    } else {
+      AddDoubleRepresentation(&builder, v);
+    }
+  }
+  return {buffer.begin(), builder.Finalize()};
+}
+
 std::string_view IntToStringView(int n, base::Vector<char> buffer) {
   bool negative = true;
   if (n >= 0) {
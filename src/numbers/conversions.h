@@ -204,6 +204,19 @@ constexpr int kDoubleToStringMinBufferSize = 100;
 V8_EXPORT_PRIVATE std::string_view DoubleToStringView(
     double value, base::Vector<char> buffer);
 
+// The longest element DoublesToJsonStringView writes: a comma followed by the
+// representation of a double, e.g. ",-0.0000012345678901234567".
+constexpr int kDoubleToJsonMaxLength = 26;
+
+// Batched DoubleToStringView for serializing double arrays to JSON. Writes the
+// representations of all values to the buffer, separated by commas (and
+// preceded by one if leading_comma is set). NaN and infinities are written
+// as "null". The buffer must hold values.size() * kDoubleToJsonMaxLength
+// characters. The returned string_view points to the start of the buffer.
+V8_EXPORT_PRIVATE std::string_view DoublesToJsonStringView(
+    base::Vector<const double> values, bool leading_comma,
+    base::Vector<char> buffer);
+
 V8_EXPORT_PRIVATE std::unique_ptr<char[]> BigIntLiteralToDecimal(
     LocalIsolate* isolate, base::Vector<const uint8_t> literal);
 // Convert an int to string value. The returned string is located inside the
@@ -184,6 +184,13 @@ BackingStore::~BackingStore() {
     return;
   }
 
+  if (pool_) {
+    TRACE_BS("BS:pool   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
+             buffer_start_, byte_length(), byte_capacity_);
+    pool_->Release(buffer_start_, byte_capacity_);
+    return;
+  }
+
   if (custom_deleter_) {
     TRACE_BS("BS:custom deleter bs=%p mem=%p (length=%zu, capacity=%zu)\n",
              this, buffer_start_, byte_length(), byte_capacity_);
@@ -207,7 +214,17 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   auto allocator = isolate->array_buffer_allocator();
   CHECK_NOT_NULL(allocator);
   if (byte_length > allocator->MaxAllocationSize()) return {};
-  if (byte_length != 0) {
+  std::shared_ptr<BackingStorePool> pool;
+  size_t byte_capacity = byte_length;
+  if (shared == SharedFlag::kNotShared &&
+      BackingStorePool::IsPoolable(byte_length)) {
+    pool = isolate->heap()->backing_store_pool();
+  }
+  if (pool) {
+    byte_capacity = BackingStorePool::SizeClassCapacity(byte_length);
+    buffer_start = pool->TryAllocate(byte_length);
+  }
+  if (byte_length != 0 && buffer_start == nullptr) {
     auto counters = isolate->counters();
     int mb_length = static_cast<int>(byte_length / MB);
     if (mb_length > 0) {
@@ -223,8 +240,10 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
       return allocator->Allocate(byte_length);
     };
 
+    // Pooled backing stores are allocated with the capacity of their size
+    // class so that the memory can be reused for any length in that class.
     buffer_start = isolate->heap()->AllocateExternalBackingStore(
-        allocate_buffer, byte_length);
+        allocate_buffer, byte_capacity);
 
     if (buffer_start == nullptr) {
       // Allocation failed.
@@ -244,7 +263,7 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   auto result = new BackingStore(buffer_start,                  // start
                                  byte_length,                   // length
                                  byte_length,                   // max length
-                                 byte_length,                   // capacity
+                                 byte_capacity,                 // capacity
                                  shared,                        // shared
                                  ResizableFlag::kNotResizable,  // resizable
                                  false,   // is_wasm_memory
@@ -256,9 +275,117 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   TRACE_BS("BS:alloc  bs=%p mem=%p (length=%zu)\n", result,
            result->buffer_start(), byte_length);
   result->SetAllocatorFromIsolate(isolate);
+  result->pool_ = std::move(pool);
   return std::unique_ptr<BackingStore>(result);
 }
 
+BackingStorePool::BackingStorePool(Heap* heap,
+                                   v8::ArrayBuffer::Allocator* allocator)
+    : heap_(heap), allocator_(allocator) {}
+
+BackingStorePool::~BackingStorePool() { DCHECK_EQ(0, cached_bytes_); }
+
+// static
+size_t BackingStorePool::SizeClassIndex(size_t byte_length) {
+  DCHECK(IsPoolable(byte_length));
+  const size_t rounded = base::bits::RoundUpToPowerOfTwo(
+      std::max(byte_length, size_t{1} << kMinSizeLog2));
+  return base::bits::WhichPowerOfTwo(rounded) - kMinSizeLog2;
+}
+
+// static
+size_t BackingStorePool::SizeClassCapacity(size_t byte_length) {
+  return size_t{1} << (SizeClassIndex(byte_length) + kMinSizeLog2);
+}
+
+void* BackingStorePool::TryAllocate(size_t byte_length) {
+  const size_t capacity = SizeClassCapacity(byte_length);
+  void* buffer = nullptr;
+  {
+    base::MutexGuard guard(&mutex_);
+    SizeClass& size_class = size_classes_[SizeClassIndex(byte_length)];
+    size_class.demand_since_trim++;
+    if (size_class.free_list.empty()) return nullptr;
+    buffer = size_class.free_list.back();
+    size_class.free_list.pop_back();
+    cached_bytes_ -= capacity;
+  }
+  heap_->UpdateExternalMemory(-static_cast<int64_t>(capacity));
+  return buffer;
+}
+
+void BackingStorePool::Release(void* buffer, size_t capacity) {
+  DCHECK_EQ(capacity, SizeClassCapacity(capacity));
+  // Zero outside of the lock. This usually runs on the array buffer sweeper's
+  // background thread.
+  memset(buffer, 0, capacity);
+  {
+    base::MutexGuard guard(&mutex_);
+    SizeClass& size_class = size_classes_[SizeClassIndex(capacity)];
+    if (heap_ != nullptr &&
+        size_class.free_list.size() < kMaxCachedPerSizeClass) {
+      size_class.free_list.push_back(buffer);
+      cached_bytes_ += capacity;
+      heap_->UpdateExternalMemory(static_cast<int64_t>(capacity));
+      return;
+    }
+  }
+  allocator_->Free(buffer, capacity);
+}
+
+void BackingStorePool::Trim() {
+  for (size_t index = 0; index < kNumSizeClasses; ++index) {
+    const size_t capacity = size_t{1} << (index + kMinSizeLog2);
+    std::vector<void*> to_free;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (heap_ == nullptr) return;
+      SizeClass& size_class = size_classes_[index];
+      // Keep as many buffers as were requested since the last trim.
+      const size_t keep = std::min(size_class.free_list.size(),
+                                   size_class.demand_since_trim);
+      to_free.assign(size_class.free_list.begin() + keep,
+                     size_class.free_list.end());
+      size_class.free_list.resize(keep);
+      size_class.demand_since_trim = 0;
+      cached_bytes_ -= to_free.size() * capacity;
+    }
+    FreeBuffers(to_free, capacity);
+  }
+}
+
+void BackingStorePool::Detach() {
+  std::array<std::vector<void*>, kNumSizeClasses> to_free;
+  {
+    base::MutexGuard guard(&mutex_);
+    for (size_t index = 0; index < kNumSizeClasses; ++index) {
+      to_free[index].swap(size_classes_[index].free_list);
+      cached_bytes_ -= to_free[index].size() * (size_t{1}
+                                                << (index + kMinSizeLog2));
+    }
+    DCHECK_EQ(0, cached_bytes_);
+  }
+  for (size_t index = 0; index < kNumSizeClasses; ++index) {
+    FreeBuffers(to_free[index], size_t{1} << (index + kMinSizeLog2));
+  }
+  base::MutexGuard guard(&mutex_);
+  heap_ = nullptr;
+}
+
+void BackingStorePool::FreeBuffers(const std::vector<void*>& buffers,
+                                   size_t capacity) {
+  if (buffers.empty()) return;
+  for (void* buffer : buffers) {
+    allocator_->Free(buffer, capacity);
+  }
+  heap_->UpdateExternalMemory(-static_cast<int64_t>(buffers.size() * capacity));
+}
+
+size_t BackingStorePool::CachedBytesForTesting() const {
+  base::MutexGuard guard(&mutex_);
+  return cached_bytes_;
+}
+
 void BackingStore::SetAllocatorFromIsolate(Isolate* isolate) {
   if (auto allocator_shared = isolate->array_buffer_allocator_shared()) {
     holds_shared_ptr_to_allocator_ = true;
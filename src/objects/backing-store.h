@@ -5,16 +5,22 @@
 #ifndef V8_OBJECTS_BACKING_STORE_H_
 #define V8_OBJECTS_BACKING_STORE_H_
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "include/v8-array-buffer.h"
 #include "include/v8-internal.h"
+#include "src/base/platform/mutex.h"
 #include "src/handles/handles.h"
 #include "src/sandbox/sandbox.h"
 
 namespace v8::internal {
 
+class BackingStorePool;
+class Heap;
 class Isolate;
 class WasmMemoryObject;
 
@@ -223,6 +229,80 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   bool globally_registered_ : 1;
   const bool custom_deleter_ : 1;
   const bool empty_deleter_ : 1;
+
+  // Set if the memory was handed out by a BackingStorePool (see
+  // --array-buffer-pooling). The memory is then returned to the pool instead
+  // of being freed through the allocator.
+  std::shared_ptr<BackingStorePool> pool_;
+};
+
+// A per-isolate cache of zeroed array buffer memory in power-of-two size
+// classes. Backing stores that are freed, usually by the ArrayBufferSweeper on
+// a background thread, return their memory to the pool. Allocations of a
+// matching size class are then served without going through the embedder's
+// ArrayBuffer::Allocator.
+//
+// Memory held in free lists is reported as external memory of the owning heap
+// so that GC heuristics see it. The free lists are trimmed after each array
+// buffer sweep to the number of buffers that were recently in demand.
+//
+// The pool may outlive its heap as backing stores can outlive their isolate.
+// After Detach() the pool no longer caches memory.
+class BackingStorePool final {
+ public:
+  static constexpr size_t kMinSizeLog2 = 12;  // 4KB
+  static constexpr size_t kMaxSizeLog2 = 16;  // 64KB
+  static constexpr size_t kNumSizeClasses = kMaxSizeLog2 - kMinSizeLog2 + 1;
+  // Upper bound for the number of cached buffers per size class.
+  static constexpr size_t kMaxCachedPerSizeClass = 256;
+
+  BackingStorePool(Heap* heap, v8::ArrayBuffer::Allocator* allocator);
+  ~BackingStorePool();
+
+  BackingStorePool(const BackingStorePool&) = delete;
+  BackingStorePool& operator=(const BackingStorePool&) = delete;
+
+  static bool IsPoolable(size_t byte_length) {
+    return byte_length > 0 && byte_length <= (size_t{1} << kMaxSizeLog2);
+  }
+  static size_t SizeClassCapacity(size_t byte_length);
+
+  // Returns zero-initialized memory of SizeClassCapacity(byte_length) bytes,
+  // or nullptr if no cached memory is available.
+  void* TryAllocate(size_t byte_length);
+
+  // Returns `buffer` of `capacity` bytes to the pool. May be called from any
+  // thread. Frees the memory through the allocator if the pool is full or
+  // detached.
+  void Release(void* buffer, size_t capacity);
+
+  // Frees cached buffers beyond the recent demand of each size class. Called
+  // from the ArrayBufferSweeper after sweeping.
+  void Trim();
+
+  // Frees all cached memory and stops caching. Called on heap tear down.
+  void Detach();
+
+  size_t CachedBytesForTesting() const;
+
+ private:
+  struct SizeClass {
+    std::vector<void*> free_list;
+    // Number of allocations served or attempted since the last trim.
+    size_t demand_since_trim = 0;
+  };
+
+  static size_t SizeClassIndex(size_t byte_length);
+
+  // Frees `buffers` through the allocator and updates accounting. Must not be
+  // called with `mutex_` held.
+  void FreeBuffers(const std::vector<void*>& buffers, size_t capacity);
+
+  mutable base::Mutex mutex_;
+  Heap* heap_;
+  v8::ArrayBuffer::Allocator* const allocator_;
+  std::array<SizeClass, kNumSizeClasses> size_classes_;
+  size_t cached_bytes_ = 0;
 };
 
 // A global, per-process mapping from buffer addresses to backing stores
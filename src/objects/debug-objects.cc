@@ -6,6 +6,7 @@
 
 #include "src/base/platform/mutex.h"
 #include "src/debug/debug-evaluate.h"
+#include "src/debug/debug.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/call-site-info-inl.h"
 #include "src/objects/debug-objects-inl.h"
@@ -36,6 +37,12 @@ void DebugInfo::SetDebugExecutionMode(ExecutionMode value) {
 
 void DebugInfo::ClearBreakInfo(Isolate* isolate) {
   if (HasInstrumentedBytecodeArray()) {
+    // Baseline code compiled with --sparkplug-break-checks refers to the debug
+    // BytecodeArray, so it has to go before that is uninstalled.
+    if (shared()->HasBaselineCode()) {
+      isolate->debug()->DiscardBaselineCode(shared());
+    }
+
     // If the function is currently running on the stack, we need to update the
     // bytecode pointers on the stack so they point to the original
     // BytecodeArray before releasing that BytecodeArray from this DebugInfo.
@@ -6,6 +6,7 @@
 #define V8_OBJECTS_DICTIONARY_INL_H_
 
 #include <optional>
+#include <type_traits>
 
 #include "src/execution/isolate-utils-inl.h"
 #include "src/numbers/hash-seed-inl.h"
@@ -107,6 +108,11 @@ PropertyDetails Dictionary<Derived, Shape>::DetailsAt(InternalIndex entry) {
 template <typename Derived, typename Shape>
 void Dictionary<Derived, Shape>::DetailsAtPut(InternalIndex entry,
                                               PropertyDetails value) {
+  if constexpr (std::is_same_v<Derived, NameDictionary>) {
+    if (DetailsAt(entry).IsDontEnum() != value.IsDontEnum()) {
+      Cast<Derived>(this)->ClearEnumCache();
+    }
+  }
   Shape::DetailsAtPut(Cast<Derived>(this), entry, value);
 }
 
@@ -172,7 +178,14 @@ void Dictionary<Derived, Shape>::SetEntry(InternalIndex entry,
   WriteBarrierMode mode = this->GetWriteBarrierMode(no_gc);
   this->set(index + Derived::kEntryKeyIndex, key, mode);
   this->set(index + Derived::kEntryValueIndex, value, mode);
-  if (Shape::kHasDetails) DetailsAtPut(entry, details);
+  if constexpr (std::is_same_v<Derived, NameDictionary>) {
+    Cast<Derived>(this)->ClearEnumCache();
+  }
+  // The entry may have been empty, so don't go through DetailsAtPut, which
+  // looks at the old details.
+  if (Shape::kHasDetails) {
+    Shape::DetailsAtPut(Cast<Derived>(this), entry, details);
+  }
 }
 
 template <typename Derived, typename Shape>
@@ -234,6 +247,28 @@ void NameDictionary::set_flags(uint32_t flags) {
 BIT_FIELD_ACCESSORS(NameDictionary, flags, may_have_interesting_properties,
                     NameDictionary::MayHaveInterestingPropertiesBit)
 
+Tagged<Object> NameDictionary::enum_cache() const {
+  return this->get(kEnumCacheIndex);
+}
+
+void NameDictionary::set_enum_cache(Tagged<FixedArray> keys) {
+  this->set(kEnumCacheIndex, keys);
+}
+
+void NameDictionary::ClearEnumCache() {
+  // Avoid the store in the common case, which also keeps the read-only empty
+  // dictionary untouched.
+  if (IsUndefined(enum_cache())) return;
+  this->set(kEnumCacheIndex, GetReadOnlyRoots().undefined_value());
+}
+
+uint32_t NameDictionary::KeySetStamp() {
+  // Adding a key bumps the next enumeration index, deleting one drops the
+  // number of elements.
+  return (static_cast<uint32_t>(next_enumeration_index()) & 0x3FF) << 10 |
+         (static_cast<uint32_t>(NumberOfElements()) & 0x3FF);
+}
+
 Tagged<PropertyCell> GlobalDictionary::CellAt(InternalIndex entry) {
   PtrComprCageBase cage_base = GetPtrComprCageBase();
   return CellAt(cage_base, entry);
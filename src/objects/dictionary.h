@@ -171,7 +171,7 @@ class BaseNameDictionaryShape : public BaseDictionaryShape<DirectHandle<Name>> {
 
 class NameDictionaryShape : public BaseNameDictionaryShape {
  public:
-  static const int kPrefixSize = 3;
+  static const int kPrefixSize = 4;
   static const int kEntrySize = 3;
   static const bool kMatchNeedsHoleCheck = false;
 };
@@ -245,6 +245,7 @@ class V8_EXPORT_PRIVATE NameDictionary
   DECL_PRINTER(NameDictionary)
 
   static const int kFlagsIndex = kObjectHashIndex + 1;
+  static const int kEnumCacheIndex = kFlagsIndex + 1;
   static const int kEntryValueIndex = 1;
   static const int kEntryDetailsIndex = 2;
   static const int kInitialCapacity = 2;
@@ -259,11 +260,25 @@ class V8_EXPORT_PRIVATE NameDictionary
   using MayHaveInterestingPropertiesBit = base::BitField<bool, 0, 1, uint32_t>;
   DECL_BOOLEAN_ACCESSORS(may_have_interesting_properties)
 
+  // Load IC misses on the owning object since its key set last changed, see
+  // JSObject::RecordDictionaryLoadMiss. The key set stamp is derived from the
+  // next enumeration index and the number of elements.
+  using LoadMissCountBits = MayHaveInterestingPropertiesBit::Next<uint32_t, 3>;
+  using KeySetStampBits = LoadMissCountBits::Next<uint32_t, 20>;
+  inline uint32_t KeySetStamp();
+
   static constexpr int kFlagsDefault = 0;
 
   inline uint32_t flags() const;
   inline void set_flags(uint32_t flags);
 
+  // The enumerable string keys in enumeration order, or undefined if they
+  // haven't been collected since a key was last added, removed or changed its
+  // enumerability. The array is shared and must not be modified.
+  inline Tagged<Object> enum_cache() const;
+  inline void set_enum_cache(Tagged<FixedArray> keys);
+  inline void ClearEnumCache();
+
   // Creates a new NameDictionary.
   template <typename IsolateT>
   V8_WARN_UNUSED_RESULT static Handle<NameDictionary> New(
@@ -22,8 +22,10 @@
 #include "src/objects/js-shared-array-inl.h"
 #include "src/objects/keys.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/simd.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/fp16/src/include/fp16.h"
 
@@ -3288,6 +3290,14 @@ class TypedElementsAccessor
   static ElementType FromScalar(int64_t value) { UNREACHABLE(); }
   static ElementType FromScalar(uint64_t value) { UNREACHABLE(); }
 
+  // Conversion from Smis, which Float16 arrays convert through float.
+  static ElementType FromSmi(Tagged<Object> value) {
+    if (IsFloat16TypedArrayElementsKind(Kind)) {
+      return fp16_ieee_from_fp32_value(Smi::ToInt(value));
+    }
+    return FromScalar(Smi::ToInt(value));
+  }
+
   // Conversions from objects / handles.
   static ElementType FromObject(Tagged<Object> value,
                                 bool* lossless = nullptr) {
@@ -3367,6 +3377,26 @@ class TypedElementsAccessor
     }
   }
 
+  // Stores {convert(i, is_shared)} for each i < {length} at {data_ptr}. The
+  // unshared case is a plain loop of unaligned loads and stores that the C++
+  // compiler can vectorize, while shared buffers need the per-element relaxed
+  // atomic accesses of {SetImpl}.
+  template <typename Convert>
+  static void ConvertAndSetImpl(ElementType* data_ptr, size_t length,
+                                IsSharedBuffer is_shared,
+                                const Convert& convert) {
+    if (is_shared == kUnshared) {
+      for (size_t i = 0; i < length; i++) {
+        base::WriteUnalignedValue(reinterpret_cast<Address>(data_ptr + i),
+                                  convert(i, kUnshared));
+      }
+      return;
+    }
+    for (size_t i = 0; i < length; i++) {
+      SetImpl(data_ptr + i, convert(i, kShared), kShared);
+    }
+  }
+
   static Handle<Object> GetInternalImpl(Isolate* isolate,
                                         DirectHandle<JSObject> holder,
                                         InternalIndex entry) {
@@ -3589,6 +3619,17 @@ class TypedElementsAccessor
     return MaybeDirectHandle<Object>(typed_array);
   }
 
+  // Whether the search kernels in simd.h can be used on {data_ptr}. Shared
+  // buffers have to be read with relaxed atomics (see GetImpl), 8-byte
+  // elements of on-heap arrays may be misaligned with pointer compression, and
+  // Float16 elements are raw bits that do not compare like numbers.
+  static bool CanUseSimdSearch(Tagged<JSTypedArray> typed_array,
+                               const ElementType* data_ptr) {
+    return !IsFloat16TypedArrayElementsKind(Kind) &&
+           !typed_array->buffer()->is_shared() &&
+           IsAligned(reinterpret_cast<Address>(data_ptr), alignof(ElementType));
+  }
+
   static Maybe<bool> IncludesValueImpl(Isolate* isolate,
                                        DirectHandle<JSObject> receiver,
                                        DirectHandle<Object> value,
@@ -3656,6 +3697,11 @@ class TypedElementsAccessor
       }
     }
 
+    if (CanUseSimdSearch(typed_array, data_ptr)) {
+      uintptr_t index = TypedArrayIndexOf<ElementType>(
+          data_ptr, length, start_from, typed_search_value);
+      return Just(static_cast<intptr_t>(index) >= 0);
+    }
     for (size_t k = start_from; k < length; ++k) {
       ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
       if (elem_k == typed_search_value) return Just(true);
@@ -3714,6 +3760,11 @@ class TypedElementsAccessor
       }
     }
 
+    if (CanUseSimdSearch(typed_array, data_ptr)) {
+      uintptr_t index = TypedArrayIndexOf<ElementType>(
+          data_ptr, length, start_from, typed_search_value);
+      return Just<int64_t>(static_cast<intptr_t>(index));
+    }
     auto is_shared = typed_array->buffer()->is_shared() ? kShared : kUnshared;
     for (size_t k = start_from; k < length; ++k) {
       ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
@@ -3769,6 +3820,11 @@ class TypedElementsAccessor
       start_from = typed_array_length - 1;
     }
 
+    if (CanUseSimdSearch(typed_array, data_ptr)) {
+      uintptr_t index = TypedArrayLastIndexOf<ElementType>(
+          data_ptr, start_from, typed_search_value);
+      return Just<int64_t>(static_cast<intptr_t>(index));
+    }
     size_t k = start_from;
     auto is_shared = typed_array->buffer()->is_shared() ? kShared : kUnshared;
     do {
@@ -3923,8 +3979,14 @@ class TypedElementsAccessor
             reinterpret_cast<base::Atomic8*>(source_data),
             length * element_size);
       } else {
-        std::memmove(dest_data + offset * element_size, source_data,
-                     length * element_size);
+        uint8_t* dest_start = dest_data + offset * element_size;
+        size_t byte_length = length * element_size;
+        if (dest_start + byte_length <= source_data ||
+            source_data + byte_length <= dest_start) {
+          MemCopyNonTemporal(dest_start, source_data, byte_length);
+        } else {
+          std::memmove(dest_start, source_data, byte_length);
+        }
       }
     } else {
       std::unique_ptr<uint8_t[]> cloned_source_elements;
@@ -4031,57 +4093,47 @@ class TypedElementsAccessor
     // Fast-path for packed Smi kind.
     if (kind == PACKED_SMI_ELEMENTS) {
       Tagged<FixedArray> source_store = Cast<FixedArray>(source->elements());
-
-      for (size_t i = 0; i < length; i++) {
-        Tagged<Object> elem = source_store->get(static_cast<int>(i));
-        ElementType elem_k;
-        if (IsFloat16TypedArrayElementsKind(Kind))
-          elem_k = fp16_ieee_from_fp32_value(Smi::ToInt(elem));
-        else
-          elem_k = FromScalar(Smi::ToInt(elem));
-        SetImpl(dest_data + i, elem_k, destination_shared);
-      }
+      ConvertAndSetImpl(
+          dest_data, length, destination_shared, [&](size_t i, IsSharedBuffer) {
+            return FromSmi(source_store->get(static_cast<int>(i)));
+          });
       return true;
     } else if (kind == HOLEY_SMI_ELEMENTS) {
       Tagged<FixedArray> source_store = Cast<FixedArray>(source->elements());
-      for (size_t i = 0; i < length; i++) {
-        if (source_store->is_the_hole(isolate, static_cast<int>(i))) {
-          SetImpl(dest_data + i, FromObject(undefined), destination_shared);
-        } else {
-          Tagged<Object> elem = source_store->get(static_cast<int>(i));
-          ElementType elem_k;
-          if (IsFloat16TypedArrayElementsKind(Kind))
-            elem_k = fp16_ieee_from_fp32_value(Smi::ToInt(elem));
-          else
-            elem_k = FromScalar(Smi::ToInt(elem));
-          SetImpl(dest_data + i, elem_k, destination_shared);
-        }
-      }
+      ElementType undefined_k = FromObject(undefined);
+      ConvertAndSetImpl(dest_data, length, destination_shared,
+                        [&](size_t i, IsSharedBuffer) {
+                          Tagged<Object> elem =
+                              source_store->get(static_cast<int>(i));
+                          return IsTheHole(elem, isolate) ? undefined_k
+                                                          : FromSmi(elem);
+                        });
       return true;
     } else if (kind == PACKED_DOUBLE_ELEMENTS) {
       // Fast-path for packed double kind. We avoid boxing and then immediately
       // unboxing the double here by using get_scalar.
       Tagged<FixedDoubleArray> source_store =
           Cast<FixedDoubleArray>(source->elements());
-
-      for (size_t i = 0; i < length; i++) {
-        // Use the from_double conversion for this specific TypedArray type,
-        // rather than relying on C++ to convert elem.
-        double elem = source_store->get_scalar(static_cast<int>(i));
-        SetImpl(dest_data + i, FromScalar(elem), destination_shared);
-      }
+      ConvertAndSetImpl(dest_data, length, destination_shared,
+                        [&](size_t i, IsSharedBuffer) {
+                          // Use the from_double conversion for this specific
+                          // TypedArray type, rather than relying on C++ to
+                          // convert elem.
+                          return FromScalar(
+                              source_store->get_scalar(static_cast<int>(i)));
+                        });
       return true;
     } else if (kind == HOLEY_DOUBLE_ELEMENTS) {
       Tagged<FixedDoubleArray> source_store =
           Cast<FixedDoubleArray>(source->elements());
-      for (size_t i = 0; i < length; i++) {
-        if (source_store->is_the_hole(static_cast<int>(i))) {
-          SetImpl(dest_data + i, FromObject(undefined), destination_shared);
-        } else {
-          double elem = source_store->get_scalar(static_cast<int>(i));
-          SetImpl(dest_data + i, FromScalar(elem), destination_shared);
-        }
-      }
+      ElementType undefined_k = FromObject(undefined);
+      ConvertAndSetImpl(
+          dest_data, length, destination_shared, [&](size_t i, IsSharedBuffer) {
+            if (source_store->is_the_hole(static_cast<int>(i))) {
+              return undefined_k;
+            }
+            return FromScalar(source_store->get_scalar(static_cast<int>(i)));
+          });
       return true;
     }
     return false;
@@ -4197,62 +4249,45 @@ struct CopyBetweenBackingStoresImpl {
   static void Copy(SourceElementType* source_data_ptr,
                    ElementType* dest_data_ptr, size_t length,
                    IsSharedBuffer is_shared) {
-    for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
-      // We use scalar accessors to avoid boxing/unboxing, so there are no
-      // allocations.
-      SourceElementType source_elem =
-          TypedElementsAccessor<SourceKind, SourceElementType>::GetImpl(
-              source_data_ptr, is_shared);
-      ElementType dest_elem =
-          TypedElementsAccessor<Kind, ElementType>::FromScalar(source_elem);
-
-      TypedElementsAccessor<Kind, ElementType>::SetImpl(dest_data_ptr,
-                                                        dest_elem, is_shared);
-    }
+    // We use scalar accessors to avoid boxing/unboxing, so there are no
+    // allocations.
+    TypedElementsAccessor<Kind, ElementType>::ConvertAndSetImpl(
+        dest_data_ptr, length, is_shared,
+        [=](size_t i, IsSharedBuffer shared) {
+          return TypedElementsAccessor<Kind, ElementType>::FromScalar(
+              TypedElementsAccessor<SourceKind, SourceElementType>::GetImpl(
+                  source_data_ptr + i, shared));
+        });
   }
 };
 
-template <ElementsKind Kind, typename ElementType>
-struct CopyBetweenBackingStoresImpl<Kind, ElementType, FLOAT16_ELEMENTS,
-                                    uint16_t> {
+template <ElementsKind Kind, typename ElementType, ElementsKind SourceKind>
+struct CopyFromFloat16BackingStoreImpl {
   static void Copy(uint16_t* source_data_ptr, ElementType* dest_data_ptr,
                    size_t length, IsSharedBuffer is_shared) {
-    for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
-      // We use scalar accessors to avoid boxing/unboxing, so there are no
-      // allocations.
-      uint16_t source_elem =
-          TypedElementsAccessor<FLOAT16_ELEMENTS, uint16_t>::GetImpl(
-              source_data_ptr, is_shared);
-      ElementType dest_elem =
-          TypedElementsAccessor<Kind, ElementType>::FromScalar(
-              fp16_ieee_to_fp32_value(source_elem));
-
-      TypedElementsAccessor<Kind, ElementType>::SetImpl(dest_data_ptr,
-                                                        dest_elem, is_shared);
-    }
+    // We use scalar accessors to avoid boxing/unboxing, so there are no
+    // allocations.
+    TypedElementsAccessor<Kind, ElementType>::ConvertAndSetImpl(
+        dest_data_ptr, length, is_shared,
+        [=](size_t i, IsSharedBuffer shared) {
+          return TypedElementsAccessor<Kind, ElementType>::FromScalar(
+              fp16_ieee_to_fp32_value(
+                  TypedElementsAccessor<SourceKind, uint16_t>::GetImpl(
+                      source_data_ptr + i, shared)));
+        });
   }
 };
 
 template <ElementsKind Kind, typename ElementType>
-struct CopyBetweenBackingStoresImpl<Kind, ElementType,
-                                    RAB_GSAB_FLOAT16_ELEMENTS, uint16_t> {
-  static void Copy(uint16_t* source_data_ptr, ElementType* dest_data_ptr,
-                   size_t length, IsSharedBuffer is_shared) {
-    for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
-      // We use scalar accessors to avoid boxing/unboxing, so there are no
-      // allocations.
-      uint16_t source_elem =
-          TypedElementsAccessor<RAB_GSAB_FLOAT16_ELEMENTS, uint16_t>::GetImpl(
-              source_data_ptr, is_shared);
-      ElementType dest_elem =
-          TypedElementsAccessor<Kind, ElementType>::FromScalar(
-              fp16_ieee_to_fp32_value(source_elem));
+struct CopyBetweenBackingStoresImpl<Kind, ElementType, FLOAT16_ELEMENTS,
+                                    uint16_t>
+    : CopyFromFloat16BackingStoreImpl<Kind, ElementType, FLOAT16_ELEMENTS> {};
 
-      TypedElementsAccessor<Kind, ElementType>::SetImpl(dest_data_ptr,
-                                                        dest_elem, is_shared);
-    }
-  }
-};
+template <ElementsKind Kind, typename ElementType>
+struct CopyBetweenBackingStoresImpl<Kind, ElementType,
+                                    RAB_GSAB_FLOAT16_ELEMENTS, uint16_t>
+    : CopyFromFloat16BackingStoreImpl<Kind, ElementType,
+                                      RAB_GSAB_FLOAT16_ELEMENTS> {};
 
 // static
 template <>
@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_FEEDBACK_VECTOR_INL_H_
 #define V8_OBJECTS_FEEDBACK_VECTOR_INL_H_
 
+#include <algorithm>
 #include <optional>
 
 #include "src/common/globals.h"
@@ -203,6 +204,27 @@ void FeedbackVector::set_was_once_deoptimized() {
                                      kRelaxedStore);
 }
 
+int FeedbackVector::deopts_without_ic_change() const {
+  return DeoptsWithoutIcChangeBits::decode(flags());
+}
+
+bool FeedbackVector::last_deopt_was_maglev() const {
+  return LastDeoptWasMaglevBit::decode(flags());
+}
+
+void FeedbackVector::RecordDeopt(CodeKind code_kind) {
+  DCHECK(CodeKindIsOptimizedJSFunction(code_kind));
+  int count = std::min(deopts_without_ic_change() + 1,
+                       kMaxDeoptsWithoutIcChange);
+  set_flags(LastDeoptWasMaglevBit::update(
+      DeoptsWithoutIcChangeBits::update(flags(), count),
+      code_kind == CodeKind::MAGLEV));
+}
+
+void FeedbackVector::ResetDeoptsWithoutIcChange() {
+  set_flags(DeoptsWithoutIcChangeBits::update(flags(), 0));
+}
+
 #ifdef V8_ENABLE_LEAPTIERING
 
 bool FeedbackVector::tiering_in_progress() const {
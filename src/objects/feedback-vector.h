@@ -330,6 +330,16 @@ class FeedbackVector
   inline bool was_once_deoptimized() const;
   inline void set_was_once_deoptimized();
 
+  // Deopts that happen again and again without new feedback indicate a deopt
+  // loop, in which reoptimizing the function is a waste of compile time. See
+  // TieringManager::ShouldOptimize.
+  static constexpr int kMaxDeoptsWithoutIcChange =
+      DeoptsWithoutIcChangeBits::kMax;
+  inline int deopts_without_ic_change() const;
+  inline bool last_deopt_was_maglev() const;
+  inline void RecordDeopt(CodeKind code_kind);
+  inline void ResetDeoptsWithoutIcChange();
+
   void reset_flags();
 
   // Conversion from a slot to an integer index to the underlying array.
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "src/api/api-inl.h"
@@ -50,6 +51,8 @@
 #include "unicode/numfmt.h"
 #include "unicode/numsys.h"
 #include "unicode/timezone.h"
+#include "unicode/tzrule.h"
+#include "unicode/tztrans.h"
 #include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/uvernum.h"  // U_ICU_VERSION_MAJOR_NUM
@@ -142,21 +145,35 @@ bool ToUpperOneByte(base::Vector<const Char> src, uint8_t* dest,
   //  1. U+00B5 and U+00FF are mapped to a character beyond U+00FF.
   //  2. Lower case sharp-S converts to "SS" (two characters)
   *sharp_s_count = 0;
-  for (auto it = src.begin(); it != src.end(); ++it) {
-    uint8_t ch = AsOneByte(*it);
-    if (V8_UNLIKELY(ch == sharp_s)) {
+  if constexpr (sizeof(Char) == 1) {
+    // The output is only used if there is no sharp-S, so characters after one
+    // need not be shifted.
+    uint32_t length = static_cast<uint32_t>(src.size());
+    uint32_t index = 0;
+    while (true) {
+      index += Latin1ConvertToUpper(dest + index, src.begin() + index,
+                                    length - index);
+      if (index == length) return true;
+      if (src[index] != sharp_s) return false;
       ++(*sharp_s_count);
-      continue;
+      ++index;
     }
-    if (V8_UNLIKELY(ch == 0xB5 || ch == 0xFF)) {
-      // Since this upper-cased character does not fit in an 8-bit string, we
-      // need to take the 16-bit path.
-      return false;
+  } else {
+    for (auto it = src.begin(); it != src.end(); ++it) {
+      uint8_t ch = AsOneByte(*it);
+      if (V8_UNLIKELY(ch == sharp_s)) {
+        ++(*sharp_s_count);
+        continue;
+      }
+      if (V8_UNLIKELY(ch == 0xB5 || ch == 0xFF)) {
+        // Since this upper-cased character does not fit in an 8-bit string, we
+        // need to take the 16-bit path.
+        return false;
+      }
+      *dest++ = ToLatin1Upper(ch);
     }
-    *dest++ = ToLatin1Upper(ch);
+    return true;
   }
-
-  return true;
 }
 
 template <typename Char>
@@ -302,6 +319,34 @@ MaybeHandle<String> LocaleConvertCase(Isolate* isolate, DirectHandle<String> s,
   return SeqString::Truncate(isolate, result, dest_length);
 }
 
+// Two-byte strings from the embedder often contain only ASCII characters,
+// which don't need ICU. Returns false, leaving {result} unset, if {s} has a
+// non-ASCII character.
+template <bool is_lower>
+bool ConvertTwoByteAsciiCase(Isolate* isolate, DirectHandle<String> s,
+                             Handle<String>* result) {
+  DCHECK(s->IsFlat());
+  uint32_t length = s->length();
+  if (length == 0) return false;
+  Handle<SeqTwoByteString> converted =
+      isolate->factory()->NewRawTwoByteString(length).ToHandleChecked();
+  DisallowGarbageCollection no_gc;
+  String::FlatContent flat = s->GetFlatContent(no_gc);
+  DCHECK(flat.IsTwoByte());
+  bool has_changed_character = false;
+  if (FastAsciiConvert<is_lower>(converted->GetChars(no_gc),
+                                 flat.ToUC16Vector().begin(), length,
+                                 &has_changed_character) != length) {
+    return false;
+  }
+  if (has_changed_character) {
+    *result = converted;
+  } else {
+    *result = indirect_handle(s, isolate);
+  }
+  return true;
+}
+
 }  // namespace
 
 // A stripped-down version of ConvertToLower that can only handle flat one-byte
@@ -336,9 +381,9 @@ Tagged<String> Intl::ConvertOneByteToLower(Tagged<String> src,
 
     // If not ASCII, we keep the result up to index_to_first_unprocessed and
     // process the rest.
-    for (int index = index_to_first_unprocessed; index < length; ++index) {
-      dst_data[index] = ToLatin1Lower(src_data[index]);
-    }
+    Latin1ConvertToLower(dst_data + index_to_first_unprocessed,
+                         src_data + index_to_first_unprocessed,
+                         length - index_to_first_unprocessed);
   } else {
     DCHECK(src_flat.IsTwoByte());
     int index_to_first_unprocessed = FindFirstUpperOrNonAscii(src, length);
@@ -361,6 +406,8 @@ Tagged<String> Intl::ConvertOneByteToLower(Tagged<String> src,
 MaybeHandle<String> Intl::ConvertToLower(Isolate* isolate,
                                          DirectHandle<String> s) {
   if (!s->IsOneByteRepresentation()) {
+    Handle<String> result;
+    if (ConvertTwoByteAsciiCase<true>(isolate, s, &result)) return result;
     // Use a slower implementation for strings with characters beyond U+00FF.
     return LocaleConvertCase(isolate, s, false, "");
   }
@@ -451,6 +498,10 @@ MaybeDirectHandle<String> Intl::ConvertToUpper(Isolate* isolate,
     return result;
   }
 
+  if (!s->IsOneByteRepresentation()) {
+    Handle<String> result;
+    if (ConvertTwoByteAsciiCase<false>(isolate, s, &result)) return result;
+  }
   return LocaleConvertCase(isolate, s, true, "");
 }
 
@@ -2682,6 +2733,10 @@ class ICUTimezoneCache : public base::TimezoneCache {
 
   double LocalTimeOffset(double time_ms, bool is_utc) override;
 
+  bool LocalTimeOffsetTransitions(
+      double start_ms, double end_ms,
+      std::vector<OffsetTransition>* transitions) override;
+
   void Clear(TimeZoneDetection time_zone_detection) override;
 
  private:
@@ -2747,6 +2802,33 @@ double ICUTimezoneCache::LocalTimeOffset(double time_ms, bool is_utc) {
   return raw_offset + dst_offset;
 }
 
+bool ICUTimezoneCache::LocalTimeOffsetTransitions(
+    double start_ms, double end_ms,
+    std::vector<OffsetTransition>* transitions) {
+  int32_t raw_offset, dst_offset;
+  if (!GetOffsets(start_ms, true, &raw_offset, &dst_offset)) return false;
+  double offset_ms = raw_offset + dst_offset;
+  transitions->push_back({start_ms, offset_ms});
+  // Note that casting TimeZone to BasicTimeZone is safe because we know that
+  // icu::TimeZone used here is a BasicTimeZone.
+  const icu::BasicTimeZone* time_zone =
+      static_cast<const icu::BasicTimeZone*>(GetTimeZone());
+  icu::TimeZoneTransition transition;
+  double time_ms = start_ms;
+  while (time_zone->getNextTransition(time_ms, false, transition)) {
+    time_ms = transition.getTime();
+    if (time_ms > end_ms) break;
+    const icu::TimeZoneRule* rule = transition.getTo();
+    double new_offset_ms = rule->getRawOffset() + rule->getDSTSavings();
+    // Some transitions only rename the zone or shift between raw and DST
+    // offset.
+    if (new_offset_ms == offset_ms) continue;
+    offset_ms = new_offset_ms;
+    transitions->push_back({time_ms, offset_ms});
+  }
+  return true;
+}
+
 void ICUTimezoneCache::Clear(TimeZoneDetection time_zone_detection) {
   delete timezone_;
   timezone_ = nullptr;
@@ -2967,25 +3049,57 @@ bool Intl::IsValidTimeZoneName(const icu::TimeZone& tz) {
   return IsUnicodeStringValidTimeZoneName(id);
 }
 
+namespace {
+
+// The time zone ids in the order of icu::TimeZone::createEnumeration(). The
+// time zone index used by Temporal is the position of the id in this list plus
+// one, index 0 is UTC.
+class TimeZoneIds {
+ public:
+  TimeZoneIds() {
+    std::unique_ptr<icu::StringEnumeration> enumeration(
+        icu::TimeZone::createEnumeration());
+    UErrorCode status = U_ZERO_ERROR;
+    const char* id;
+    while ((id = enumeration->next(nullptr, status)) != nullptr &&
+           U_SUCCESS(status)) {
+      ids_.push_back(id);
+      indices_.emplace(id, static_cast<int32_t>(ids_.size()));
+    }
+    CHECK(U_SUCCESS(status));
+  }
+
+  const std::string& Id(int32_t index) const {
+    CHECK_LE(1, index);
+    CHECK_LE(static_cast<size_t>(index), ids_.size());
+    return ids_[index - 1];
+  }
+
+  // Returns the index of the id, or 0 if it is not in the list.
+  int32_t Index(const std::string& id) const {
+    auto it = indices_.find(id);
+    return it == indices_.end() ? 0 : it->second;
+  }
+
+ private:
+  std::vector<std::string> ids_;
+  std::unordered_map<std::string, int32_t> indices_;
+};
+
+const TimeZoneIds& GetTimeZoneIds() {
+  static base::LazyInstance<TimeZoneIds>::type time_zone_ids =
+      LAZY_INSTANCE_INITIALIZER;
+  return *time_zone_ids.Pointer();
+}
+
+}  // namespace
+
 // Function to support Temporal
 std::string Intl::TimeZoneIdFromIndex(int32_t index) {
   if (index == JSTemporalTimeZone::kUTCTimeZoneIndex) {
     return "UTC";
   }
-  std::unique_ptr<icu::StringEnumeration> enumeration(
-      icu::TimeZone::createEnumeration());
-  int32_t curr = 0;
-  const char* id;
-
-  UErrorCode status = U_ZERO_ERROR;
-  while (U_SUCCESS(status) && curr < index &&
-         ((id = enumeration->next(nullptr, status)) != nullptr)) {
-    CHECK(U_SUCCESS(status));
-    curr++;
-  }
-  CHECK(U_SUCCESS(status));
-  CHECK(id != nullptr);
-  return id;
+  return GetTimeZoneIds().Id(index);
 }
 
 int32_t Intl::GetTimeZoneIndex(Isolate* isolate,
@@ -3001,22 +3115,10 @@ int32_t Intl::GetTimeZoneIndex(Isolate* isolate,
     return -1;
   }
 
-  std::unique_ptr<icu::StringEnumeration> enumeration(
-      icu::TimeZone::createEnumeration());
-  int32_t curr = 0;
-  const char* id;
-
-  UErrorCode status = U_ZERO_ERROR;
-  while (U_SUCCESS(status) &&
-         (id = enumeration->next(nullptr, status)) != nullptr) {
-    curr++;
-    if (identifier_str == id) {
-      return curr;
-    }
-  }
-  CHECK(U_SUCCESS(status));
+  int32_t index = GetTimeZoneIds().Index(identifier_str);
   // We should not reach here, the !IsValidTimeZoneName should return earlier
-  UNREACHABLE();
+  CHECK_NE(index, 0);
+  return index;
 }
 
 Intl::FormatRangeSourceTracker::FormatRangeSourceTracker() {
@@ -3076,12 +3178,23 @@ DirectHandle<String> Intl::DefaultTimeZone(Isolate* isolate) {
 
 namespace {
 
-const icu::BasicTimeZone* CreateBasicTimeZoneFromIndex(
-    int32_t time_zone_index) {
+// Returns the time zone for the index. The time zone is owned by the isolate's
+// ICU object cache, since creating it from the id means loading and parsing
+// the zone rules from the ICU data.
+const icu::BasicTimeZone* GetBasicTimeZoneFromIndex(Isolate* isolate,
+                                                    int32_t time_zone_index) {
   DCHECK_NE(time_zone_index, 0);
-  return static_cast<const icu::BasicTimeZone*>(
-      icu::TimeZone::createTimeZone(icu::UnicodeString(
-          Intl::TimeZoneIdFromIndex(time_zone_index).c_str(), -1, US_INV)));
+  icu::UMemory* cached = isolate->get_cached_icu_time_zone(time_zone_index);
+  if (cached != nullptr) {
+    return static_cast<const icu::BasicTimeZone*>(cached);
+  }
+  std::shared_ptr<icu::BasicTimeZone> basic_time_zone(
+      static_cast<icu::BasicTimeZone*>(
+          icu::TimeZone::createTimeZone(icu::UnicodeString(
+              Intl::TimeZoneIdFromIndex(time_zone_index).c_str(), -1,
+              US_INV))));
+  isolate->set_icu_time_zone_in_cache(time_zone_index, basic_time_zone);
+  return basic_time_zone.get();
 }
 
 // ICU only support TimeZone information in millisecond but Temporal require
@@ -3094,6 +3207,17 @@ enum class Direction { kPast, kFuture };
 int64_t ApproximateMillisecondEpoch(Isolate* isolate,
                                     DirectHandle<BigInt> nanosecond_epoch,
                                     Direction direction = Direction::kPast) {
+  // Epochs of the current era fit into an int64_t, so the division can usually
+  // be done without allocating BigInts.
+  bool lossless;
+  int64_t ns = nanosecond_epoch->AsInt64(&lossless);
+  if (lossless) {
+    int64_t ms = ns / 1000000;
+    int64_t remainder = ns % 1000000;
+    if (direction == Direction::kPast && remainder < 0) ms -= 1;
+    if (direction == Direction::kFuture && remainder > 0) ms += 1;
+    return ms;
+  }
   DirectHandle<BigInt> one_million = BigInt::FromUint64(isolate, 1000000);
   int64_t ms = BigInt::Divide(isolate, nanosecond_epoch, one_million)
                    .ToHandleChecked()
@@ -3133,8 +3257,8 @@ DirectHandle<BigInt> MillisecondToNanosecond(Isolate* isolate, int64_t ms) {
 DirectHandle<Object> Intl::GetTimeZoneOffsetTransitionNanoseconds(
     Isolate* isolate, int32_t time_zone_index,
     DirectHandle<BigInt> nanosecond_epoch, Intl::Transition transition) {
-  std::unique_ptr<const icu::BasicTimeZone> basic_time_zone(
-      CreateBasicTimeZoneFromIndex(time_zone_index));
+  const icu::BasicTimeZone* basic_time_zone =
+      GetBasicTimeZoneFromIndex(isolate, time_zone_index);
 
   icu::TimeZoneTransition icu_transition;
   UBool has_transition;
@@ -3177,8 +3301,8 @@ DirectHandle<Object> Intl::GetTimeZoneOffsetTransitionNanoseconds(
 DirectHandleVector<BigInt> Intl::GetTimeZonePossibleOffsetNanoseconds(
     Isolate* isolate, int32_t time_zone_index,
     DirectHandle<BigInt> nanosecond_epoch) {
-  std::unique_ptr<const icu::BasicTimeZone> basic_time_zone(
-      CreateBasicTimeZoneFromIndex(time_zone_index));
+  const icu::BasicTimeZone* basic_time_zone =
+      GetBasicTimeZoneFromIndex(isolate, time_zone_index);
   int64_t time_ms = ApproximateMillisecondEpoch(isolate, nanosecond_epoch);
   int32_t raw_offset;
   int32_t dst_offset;
@@ -3223,8 +3347,8 @@ DirectHandleVector<BigInt> Intl::GetTimeZonePossibleOffsetNanoseconds(
 int64_t Intl::GetTimeZoneOffsetNanoseconds(
     Isolate* isolate, int32_t time_zone_index,
     DirectHandle<BigInt> nanosecond_epoch) {
-  std::unique_ptr<const icu::BasicTimeZone> basic_time_zone(
-      CreateBasicTimeZoneFromIndex(time_zone_index));
+  const icu::BasicTimeZone* basic_time_zone =
+      GetBasicTimeZoneFromIndex(isolate, time_zone_index);
   int64_t time_ms = ApproximateMillisecondEpoch(isolate, nanosecond_epoch);
   int32_t raw_offset;
   int32_t dst_offset;
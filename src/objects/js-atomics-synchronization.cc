@@ -7,6 +7,7 @@
 #include "src/base/macros.h"
 #include "src/base/platform/yield-processor.h"
 #include "src/execution/isolate-inl.h"
+#include "src/logging/counters-scopes.h"
 #include "src/objects/js-atomics-synchronization-inl.h"
 #include "src/objects/js-promise-inl.h"
 #include "src/objects/waiter-queue-node.h"
@@ -598,15 +599,27 @@ bool JSAtomicsMutex::TryLockExplicit(std::atomic<StateT>* state,
 bool JSAtomicsMutex::BackoffTryLock(Isolate* requester,
                                     DirectHandle<JSAtomicsMutex> mutex,
                                     std::atomic<StateT>* state) {
-  // The backoff algorithm is copied from PartitionAlloc's SpinningMutex.
-  constexpr int kSpinCount = 64;
+  // The backoff algorithm is copied from PartitionAlloc's SpinningMutex. The
+  // number of tries adapts to how long contended locks were recently held:
+  // spin for up to twice the tries that sufficed recently, and spin less when
+  // spinning didn't pay off.
+  constexpr int kMinSpinCount = 16;
+  constexpr int kMaxSpinCount = 256;
   constexpr int kMaxBackoff = 16;
 
+  const int spin_estimate = requester->atomics_mutex_spin_estimate();
+  const int spin_count =
+      std::min(kMaxSpinCount, kMinSpinCount + 2 * spin_estimate);
   int tries = 0;
   int backoff = 1;
   StateT current_state = state->load(std::memory_order_relaxed);
   do {
-    if (JSAtomicsMutex::TryLockExplicit(state, current_state)) return true;
+    if (JSAtomicsMutex::TryLockExplicit(state, current_state)) {
+      requester->set_atomics_mutex_spin_estimate(spin_estimate +
+                                                 (tries - spin_estimate) / 8);
+      requester->counters()->js_atomics_mutex_spin_acquisitions()->Increment();
+      return true;
+    }
 
     for (int yields = 0; yields < backoff; yields++) {
       YIELD_PROCESSOR;
@@ -614,7 +627,9 @@ bool JSAtomicsMutex::BackoffTryLock(Isolate* requester,
     }
 
     backoff = std::min(kMaxBackoff, backoff << 1);
-  } while (tries < kSpinCount);
+  } while (tries < spin_count);
+  requester->set_atomics_mutex_spin_estimate(spin_estimate -
+                                             spin_estimate / 8);
   return false;
 }
 
@@ -737,6 +752,9 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
                                   DirectHandle<JSAtomicsMutex> mutex,
                                   std::atomic<StateT>* state,
                                   std::optional<base::TimeDelta> timeout) {
+  requester->counters()->js_atomics_mutex_contended_locks()->Increment();
+  TimedHistogramScope wait_timer(
+      requester->counters()->js_atomics_mutex_wait_time());
   for (;;) {
     // Spin for a little bit to try to acquire the lock, so as to be fast under
     // microcontention.
@@ -806,6 +824,7 @@ void JSAtomicsMutex::UnlockSlowPath(Isolate* requester,
   new_state = SetWaiterQueueHead(requester, waiter_head, new_state);
   waiter_queue_lock_guard.set_new_state(new_state);
 
+  requester->counters()->js_atomics_mutex_handoffs()->Increment();
   old_head->Notify();
 }
 
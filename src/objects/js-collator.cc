@@ -8,6 +8,12 @@
 
 #include "src/objects/js-collator.h"
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/execution/isolate.h"
 #include "src/objects/js-collator-inl.h"
 #include "src/objects/js-locale.h"
@@ -246,6 +252,43 @@ CaseFirst ToCaseFirst(const char* str) {
   return CaseFirst::kUndefined;
 }
 
+// Creating an icu::Collator loads and parses the tailoring of the locale,
+// while cloning one shares it. Keep the most recently created collators
+// around, keyed by locale (including the collation extension), and hand out
+// clones of them.
+class CollatorCache {
+ public:
+  icu::Collator* Create(const icu::Locale& icu_locale, UErrorCode& status) {
+    std::string key = icu_locale.getName();
+
+    base::MutexGuard guard(&mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) return it->second->clone();
+
+    if (map_.size() > 8) {  // Cache at most 8 Collators.
+      map_.clear();
+    }
+    std::unique_ptr<icu::Collator> instance(
+        icu::Collator::createInstance(icu_locale, status));
+    if (U_FAILURE(status) || instance == nullptr) return nullptr;
+    icu::Collator* clone = instance->clone();
+    map_[key] = std::move(instance);
+    return clone;
+  }
+
+ private:
+  std::map<std::string, std::unique_ptr<icu::Collator>> map_;
+  base::Mutex mutex_;
+};
+
+std::unique_ptr<icu::Collator> CreateICUCollatorFromCache(
+    const icu::Locale& icu_locale, UErrorCode& status) {
+  static base::LazyInstance<CollatorCache>::type cache =
+      LAZY_INSTANCE_INITIALIZER;
+  return std::unique_ptr<icu::Collator>(
+      cache.Pointer()->Create(icu_locale, status));
+}
+
 UColAttributeValue ToUColAttributeValue(CaseFirst case_first) {
   switch (case_first) {
     case CaseFirst::kUpper:
@@ -420,8 +463,8 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, DirectHandle<Map> map,
   // here. The collation value can be looked up from icu::Collator on
   // demand, as part of Intl.Collator.prototype.resolvedOptions.
 
-  std::unique_ptr<icu::Collator> icu_collator(
-      icu::Collator::createInstance(icu_locale, status));
+  std::unique_ptr<icu::Collator> icu_collator =
+      CreateICUCollatorFromCache(icu_locale, status);
   if (U_FAILURE(status) || icu_collator == nullptr) {
     status = U_ZERO_ERROR;
     // Remove extensions and try again.
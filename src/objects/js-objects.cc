@@ -4906,6 +4906,42 @@ void JSObject::MakePrototypesFast(DirectHandle<Object> receiver,
   }
 }
 
+void JSObject::RecordDictionaryLoadMiss(DirectHandle<Object> receiver,
+                                        Isolate* isolate) {
+  // SwissNameDictionary has no spare bits to count misses in.
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) return;
+  int threshold =
+      std::min(v8_flags.dictionary_load_misses_before_fast_mode.value(),
+               static_cast<int>(NameDictionary::LoadMissCountBits::kMax));
+  if (threshold <= 0) return;
+  if (!IsJSObject(*receiver)) return;
+  DirectHandle<JSObject> object = Cast<JSObject>(receiver);
+  Tagged<Map> map = object->map();
+  // Prototypes are handled by MakePrototypesFast; leave globals, API objects
+  // and other special receivers alone.
+  if (!map->is_dictionary_map() || map->is_prototype_map() ||
+      map->instance_type() != JS_OBJECT_TYPE) {
+    return;
+  }
+  Tagged<NameDictionary> dictionary = object->property_dictionary();
+  if (dictionary->NumberOfElements() > v8_flags.max_fast_properties) return;
+
+  uint32_t flags = dictionary->flags();
+  uint32_t stamp = dictionary->KeySetStamp();
+  int misses = 0;
+  if (NameDictionary::KeySetStampBits::decode(flags) == stamp) {
+    misses = NameDictionary::LoadMissCountBits::decode(flags);
+  }
+  if (++misses < threshold) {
+    flags = NameDictionary::LoadMissCountBits::update(flags, misses);
+    flags = NameDictionary::KeySetStampBits::update(flags, stamp);
+    dictionary->set_flags(flags);
+    return;
+  }
+  isolate->counters()->dictionary_to_fast_migrations()->Increment();
+  JSObject::MigrateSlowToFast(object, 0, "RecordDictionaryLoadMiss");
+}
+
 static bool PrototypeBenefitsFromNormalization(Tagged<JSObject> object) {
   DisallowGarbageCollection no_gc;
   if (!object->HasFastProperties()) return false;
@@ -5063,6 +5099,7 @@ void JSObject::LazyRegisterPrototypeUser(DirectHandle<Map> user,
     int slot = 0;
     Handle<WeakArrayList> new_array =
         PrototypeUsers::Add(isolate, registry, current_user, &slot);
+    isolate->BumpPrototypeChainEpoch();
     current_user_info->set_registry_slot(slot);
     if (!maybe_registry.is_identical_to(new_array)) {
       proto_info->set_prototype_users(*new_array);
@@ -5162,17 +5199,25 @@ void InvalidateOnePrototypeValidityCellInternal(Tagged<Map> map) {
   }
 }
 
-void InvalidatePrototypeChainsInternal(Tagged<Map> map) {
+void InvalidatePrototypeChainsInternal(Tagged<Map> map, uint32_t epoch) {
   // We handle linear prototype chains by looping, and multiple children
   // by recursion, in order to reduce the likelihood of running into stack
   // overflows. So, conceptually, the outer loop iterates the depth of the
   // prototype tree, and the inner loop iterates the breadth of a node.
   Tagged<Map> next_map;
   for (; !map.is_null(); map = next_map, next_map = Map()) {
+    Tagged<PrototypeInfo> proto_info;
+    bool has_proto_info = map->TryGetPrototypeInfo(&proto_info);
+    if (has_proto_info && epoch != 0) {
+      // Nothing below this map can have become valid again since the last
+      // time it was invalidated, so there is nothing left to do.
+      if (proto_info->invalidated_epoch() == epoch) return;
+      proto_info->set_invalidated_epoch(epoch);
+    }
+
     InvalidateOnePrototypeValidityCellInternal(map);
 
-    Tagged<PrototypeInfo> proto_info;
-    if (!map->TryGetPrototypeInfo(&proto_info)) return;
+    if (!has_proto_info) return;
     if (!IsWeakArrayList(proto_info->prototype_users())) {
       return;
     }
@@ -5189,7 +5234,7 @@ void InvalidatePrototypeChainsInternal(Tagged<Map> map) {
         if (next_map.is_null()) {
           next_map = Cast<Map>(heap_object);
         } else {
-          InvalidatePrototypeChainsInternal(Cast<Map>(heap_object));
+          InvalidatePrototypeChainsInternal(Cast<Map>(heap_object), epoch);
         }
       }
     }
@@ -5201,7 +5246,19 @@ void InvalidatePrototypeChainsInternal(Tagged<Map> map) {
 // static
 Tagged<Map> JSObject::InvalidatePrototypeChains(Tagged<Map> map) {
   DisallowGarbageCollection no_gc;
-  InvalidatePrototypeChainsInternal(map);
+  // Subtrees are skipped when nothing could have revalidated them since their
+  // last invalidation. Dictionary constant tracking deopts on every
+  // invalidation, and a saturated epoch no longer tells anything apart.
+  uint32_t epoch = 0;
+  if (!V8_DICT_PROPERTY_CONST_TRACKING_BOOL) {
+    Isolate* isolate = GetIsolateFromWritableObject(map);
+    static_assert(Isolate::kMaxPrototypeChainEpoch ==
+                  PrototypeInfo::InvalidatedEpochBits::kMax);
+    if (isolate->prototype_chain_epoch() < Isolate::kMaxPrototypeChainEpoch) {
+      epoch = isolate->prototype_chain_epoch();
+    }
+  }
+  InvalidatePrototypeChainsInternal(map, epoch);
   return map;
 }
 
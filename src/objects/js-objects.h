@@ -554,6 +554,10 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
   static void ReoptimizeIfPrototype(DirectHandle<JSObject> object);
   static void MakePrototypesFast(DirectHandle<Object> receiver,
                                  WhereToStart where_to_start, Isolate* isolate);
+  // Called on load IC misses. Migrates a dictionary-mode receiver back to
+  // fast properties once it has seen enough misses without its keys changing.
+  static void RecordDictionaryLoadMiss(DirectHandle<Object> receiver,
+                                       Isolate* isolate);
   static void LazyRegisterPrototypeUser(DirectHandle<Map> user,
                                         Isolate* isolate);
   static void UpdatePrototypeUserRegistration(DirectHandle<Map> old_map,
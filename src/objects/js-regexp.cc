@@ -4,6 +4,7 @@
 
 #include "src/objects/js-regexp.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "src/base/strings.h"
@@ -406,6 +407,16 @@ void IrRegExpData::MarkTierUpForNextExec() {
   set_ticks_until_tier_up(0);
 }
 
+void IrRegExpData::DelayTierUpForBytecodeLength(int bytecode_length) {
+  DCHECK(v8_flags.regexp_tier_up);
+  if (MarkedForTierUp()) return;
+  const int delay =
+      std::min(bytecode_length / JSRegExp::kTierUpDelayBytecodeLength,
+               JSRegExp::kMaxTierUpDelayTicks);
+  set_ticks_until_tier_up(std::max(ticks_until_tier_up(),
+                                   v8_flags.regexp_tier_up_ticks + delay));
+}
+
 bool IrRegExpData::ShouldProduceBytecode() {
   return v8_flags.regexp_interpret_all ||
          (v8_flags.regexp_tier_up && !MarkedForTierUp());
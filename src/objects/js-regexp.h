@@ -136,6 +136,13 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // tier-up to the compiler immediately, instead of using the interpreter.
   static constexpr int kTierUpForSubjectLengthValue = 1000;
 
+  // Native compilation runs on the main thread and its cost grows with the
+  // pattern. Regexps with large bytecode get one extra interpreter execution
+  // before tier-up per kTierUpDelayBytecodeLength bytes of bytecode, up to
+  // kMaxTierUpDelayTicks, so that they prove hot before we pay for it.
+  static constexpr int kTierUpDelayBytecodeLength = 4 * KB;
+  static constexpr int kMaxTierUpDelayTicks = 16;
+
   // Maximum number of captures allowed.
   static constexpr int kMaxCaptures = 1 << 16;
 
@@ -267,6 +274,7 @@ class IrRegExpData : public RegExpData {
   void ResetLastTierUpTick();
   void TierUpTick();
   void MarkTierUpForNextExec();
+  void DelayTierUpForBytecodeLength(int bytecode_length);
   bool ShouldProduceBytecode();
 
   void DiscardCompiledCodeForSerialization();
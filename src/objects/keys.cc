@@ -5,6 +5,7 @@
 #include "src/objects/keys.h"
 
 #include <optional>
+#include <type_traits>
 
 #include "src/api/api-arguments-inl.h"
 #include "src/api/api.h"
@@ -13,6 +14,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/factory.h"
+#include "src/heap/heap-layout-inl.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/elements-inl.h"
 #include "src/objects/field-index-inl.h"
@@ -115,6 +117,7 @@ Handle<FixedArray> KeyAccumulator::GetKeys(GetKeysConversion convert) {
   if (try_prototype_info_cache_ && !first_prototype_map_.is_null()) {
     Cast<PrototypeInfo>(first_prototype_map_->prototype_info())
         ->set_prototype_chain_enum_cache(*result);
+    isolate_->BumpPrototypeChainEpoch();
     Map::GetOrCreatePrototypeChainValidityCell(
         direct_handle(receiver_->map(), isolate_), isolate_);
     DCHECK(first_prototype_map_->IsPrototypeValidityCellValid());
@@ -921,6 +924,40 @@ void CopyEnumKeysTo(Isolate* isolate,
   // now contains the actual values from |dictionary|, rather than indices.
 }
 
+// Returns the enumerable string keys of a non-empty {dictionary} in
+// enumeration order, from the dictionary's enum cache if it is valid. The
+// result is shared with the dictionary and must be copied before handing it
+// out.
+DirectHandle<FixedArray> GetOrCreateDictionaryEnumCache(
+    Isolate* isolate, DirectHandle<NameDictionary> dictionary) {
+  DCHECK_LT(0, dictionary->NumberOfElements());
+  Tagged<Object> cache = dictionary->enum_cache();
+  if (IsFixedArray(cache)) {
+    DCHECK_EQ(Cast<FixedArray>(cache)->length(),
+              dictionary->NumberOfEnumerableProperties());
+    return direct_handle(Cast<FixedArray>(cache), isolate);
+  }
+  int length = dictionary->NumberOfEnumerableProperties();
+  DirectHandle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
+  CopyEnumKeysTo(isolate, dictionary, storage, KeyCollectionMode::kOwnOnly,
+                 nullptr);
+  // Shared objects may be modified concurrently, so don't cache their keys.
+  if (!HeapLayout::InAnySharedSpace(*dictionary)) {
+    dictionary->set_enum_cache(*storage);
+  }
+  return storage;
+}
+
+// Whether the enumerable keys of {object} can be taken from the enum cache of
+// its property dictionary. When collecting keys of prototypes too, the
+// non-enumerable ones shadow prototype properties, so the cache only suffices
+// if there are no prototypes.
+bool CanUseDictionaryEnumCache(Isolate* isolate, KeyCollectionMode mode,
+                               DirectHandle<JSObject> object) {
+  return mode == KeyCollectionMode::kOwnOnly ||
+         IsNull(object->map()->prototype(), isolate);
+}
+
 template <class T>
 Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(
     Isolate* isolate, KeyCollectionMode mode, KeyAccumulator* accumulator,
@@ -929,6 +966,13 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(
   if (dictionary->NumberOfElements() == 0) {
     return isolate->factory()->empty_fixed_array();
   }
+  if constexpr (std::is_same_v<T, NameDictionary>) {
+    if (CanUseDictionaryEnumCache(isolate, mode, object)) {
+      DirectHandle<FixedArray> keys =
+          GetOrCreateDictionaryEnumCache(isolate, dictionary);
+      return isolate->factory()->CopyFixedArrayUpTo(keys, keys->length());
+    }
+  }
   int length = dictionary->NumberOfEnumerableProperties();
   Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
   CopyEnumKeysTo(isolate, dictionary, storage, mode, accumulator);
@@ -1033,6 +1077,11 @@ Maybe<bool> KeyAccumulator::CollectOwnPropertyNames(
     } else if (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
       enum_keys = GetOwnEnumPropertyDictionaryKeys(
           isolate_, mode_, this, object, object->property_dictionary_swiss());
+    } else if (object->property_dictionary()->NumberOfElements() > 0 &&
+               CanUseDictionaryEnumCache(isolate_, mode_, object)) {
+      // The keys are only read below, so they don't need to be copied.
+      enum_keys = GetOrCreateDictionaryEnumCache(
+          isolate_, direct_handle(object->property_dictionary(), isolate_));
     } else {
       enum_keys = GetOwnEnumPropertyDictionaryKeys(
           isolate_, mode_, this, object, object->property_dictionary());
@@ -58,11 +58,19 @@ void ObjectBoilerplateDescription::set_backing_store_size(int value) {
   backing_store_size_.store(this, Smi::FromInt(value));
 }
 int ObjectBoilerplateDescription::flags() const {
-  return flags_.load().value();
+  return flags_.load().value() & ~kPretenureHintBit;
 }
 void ObjectBoilerplateDescription::set_flags(int value) {
+  DCHECK_EQ(value & kPretenureHintBit, 0);
   flags_.store(this, Smi::FromInt(value));
 }
+bool ObjectBoilerplateDescription::pretenure_hint() const {
+  return (flags_.load().value() & kPretenureHintBit) != 0;
+}
+void ObjectBoilerplateDescription::set_pretenure_hint(bool value) {
+  int flags = this->flags();
+  flags_.store(this, Smi::FromInt(value ? flags | kPretenureHintBit : flags));
+}
 
 Tagged<Object> ObjectBoilerplateDescription::name(int index) const {
   return get(NameIndex(index));
@@ -111,13 +119,22 @@ ACCESSORS(ClassBoilerplate, instance_computed_properties, Tagged<FixedArray>,
 TQ_OBJECT_CONSTRUCTORS_IMPL(ArrayBoilerplateDescription)
 
 ElementsKind ArrayBoilerplateDescription::elements_kind() const {
-  return static_cast<ElementsKind>(flags());
+  return static_cast<ElementsKind>(flags() & ~kPretenureHintBit);
 }
 
 void ArrayBoilerplateDescription::set_elements_kind(ElementsKind kind) {
   set_flags(kind);
 }
 
+bool ArrayBoilerplateDescription::pretenure_hint() const {
+  return (flags() & kPretenureHintBit) != 0;
+}
+
+void ArrayBoilerplateDescription::set_pretenure_hint(bool value) {
+  int kind = elements_kind();
+  set_flags(value ? kind | kPretenureHintBit : kind);
+}
+
 bool ArrayBoilerplateDescription::is_empty() const {
   return constant_elements()->length() == 0;
 }
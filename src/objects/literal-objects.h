@@ -56,6 +56,11 @@ class ObjectBoilerplateDescription
   inline int flags() const;
   inline void set_flags(int value);
 
+  // Whether the literal's AllocationSite was pretenured when the code cache
+  // was created, see --code-cache-pretenuring-decisions.
+  inline bool pretenure_hint() const;
+  inline void set_pretenure_hint(bool value);
+
   // Number of boilerplate properties and properties with computed names.
   inline int backing_store_size() const;
   inline void set_backing_store_size(int backing_store_size);
@@ -74,6 +79,9 @@ class ObjectBoilerplateDescription
   class BodyDescriptor;
 
  private:
+  // Kept in the flags field, above the ObjectLiteral::Flags.
+  static constexpr int kPretenureHintBit = 1 << 16;
+
   static constexpr int kElementsPerEntry = 2;
   static constexpr int NameIndex(int i) { return i * kElementsPerEntry; }
   static constexpr int ValueIndex(int i) { return i * kElementsPerEntry + 1; }
@@ -86,6 +94,11 @@ class ArrayBoilerplateDescription
   inline ElementsKind elements_kind() const;
   inline void set_elements_kind(ElementsKind kind);
 
+  // Whether the literal's AllocationSite was pretenured when the code cache
+  // was created, see --code-cache-pretenuring-decisions.
+  inline bool pretenure_hint() const;
+  inline void set_pretenure_hint(bool value);
+
   inline bool is_empty() const;
 
   // Dispatched behavior.
@@ -95,6 +108,10 @@ class ArrayBoilerplateDescription
   using BodyDescriptor = StructBodyDescriptor;
 
  private:
+  // Kept in the flags field, above the elements kind.
+  static constexpr int kPretenureHintBit = 1 << 16;
+  static_assert(kLastElementsKind < kPretenureHintBit);
+
   TQ_OBJECT_CONSTRUCTORS(ArrayBoilerplateDescription)
 };
 
@@ -2027,6 +2027,18 @@ DirectHandle<Map> Map::TransitionToDataProperty(
   // Do not track transitions during bootstrapping.
   TransitionFlag flag =
       isolate->bootstrapper()->IsActive() ? OMIT_TRANSITION : INSERT_TRANSITION;
+  // Objects that get the same properties in many different orders grow wide
+  // transition trees. Past the configured fan-out, share normalized maps
+  // instead of adding yet another ordering.
+  if (v8_flags.max_property_transitions_per_map > 0 &&
+      flag == INSERT_TRANSITION && !map->is_prototype_map() &&
+      TransitionsAccessor(isolate, *map).NumberOfTransitions() >=
+          v8_flags.max_property_transitions_per_map) {
+    isolate->counters()->transition_tree_normalizations()->Increment();
+    return Map::Normalize(isolate, map, CLEAR_INOBJECT_PROPERTIES,
+                          "TooManyPropertyOrders");
+  }
+
   MaybeDirectHandle<Map> maybe_map;
   if (!map->TooManyFastProperties(store_origin)) {
     Representation representation =
@@ -2458,6 +2470,7 @@ Handle<UnionOf<Smi, Cell>> Map::GetOrCreatePrototypeChainValidityCell(
     }
   }
   // Otherwise create a new cell.
+  isolate->BumpPrototypeChainEpoch();
   Handle<Cell> cell = isolate->factory()->NewCell(Map::kPrototypeChainValidSmi);
   prototype->map()->set_prototype_validity_cell(*cell, kRelaxedStore);
   return cell;
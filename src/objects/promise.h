@@ -93,6 +93,9 @@ class PromiseCapability
 // instance (in the fast case of a native promise) or a PromiseCapability in
 // case of a Promise subclass. In case of await it can also be undefined if
 // PromiseHooks are disabled (see https://github.com/tc39/ecma262/pull/1146).
+// For reactions registered by Promise.all and Promise.allSettled on native
+// promises it holds the index of the element as a Smi instead, and the
+// handlers are shared by all elements of the combinator.
 //
 // The PromiseReaction objects form a singly-linked list, terminated by
 // Smi 0. On the JSPromise instance they are linked in reverse order,
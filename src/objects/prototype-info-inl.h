@@ -133,6 +133,8 @@ bool PrototypeInfo::IsPrototypeInfoFast(Tagged<Object> object) {
 
 BOOL_ACCESSORS(PrototypeInfo, bit_field, should_be_fast_map,
                ShouldBeFastBit::kShift)
+BIT_FIELD_ACCESSORS(PrototypeInfo, bit_field, invalidated_epoch,
+                    InvalidatedEpochBits)
 
 void PrototypeUsers::MarkSlotEmpty(Tagged<WeakArrayList> array, int index) {
   DCHECK_GT(index, 0);
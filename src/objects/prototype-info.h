@@ -41,6 +41,7 @@ class PrototypeInfo
   static inline bool IsPrototypeInfoFast(Tagged<Object> object);
 
   DECL_BOOLEAN_ACCESSORS(should_be_fast_map)
+  DECL_PRIMITIVE_ACCESSORS(invalidated_epoch, uint32_t)
 
   // Dispatched behavior.
   DECL_PRINTER(PrototypeInfo)
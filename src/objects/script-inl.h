@@ -56,6 +56,8 @@ SMI_ACCESSORS_CHECKED(Script, eval_from_position, kEvalFromPositionOffset,
 
 ACCESSORS(Script, compiled_lazy_function_positions, Tagged<Object>,
           kCompiledLazyFunctionPositionsOffset)
+ACCESSORS(Script, literal_allocation_sites, Tagged<Object>,
+          kLiteralAllocationSitesOffset)
 
 bool Script::is_wrapped() const {
   return IsFixedArray(eval_from_shared_or_wrapped_arguments());
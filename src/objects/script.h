@@ -150,6 +150,10 @@ class Script : public TorqueGeneratedScript<Script, Struct> {
 
   DECL_ACCESSORS(compiled_lazy_function_positions, Tagged<Object>)
 
+  // [literal_allocation_sites]: only tracked with
+  // --code-cache-pretenuring-decisions, and never serialized.
+  DECL_ACCESSORS(literal_allocation_sites, Tagged<Object>)
+
   // If script source is an external string, check that the underlying
   // resource is accessible. Otherwise, always return true.
   inline bool HasValidSource();
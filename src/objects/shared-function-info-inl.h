@@ -389,6 +389,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
                     has_reported_binary_coverage,
                     SharedFunctionInfo::HasReportedBinaryCoverageBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
+                    bytecode_flushing_disabled,
+                    SharedFunctionInfo::BytecodeFlushingDisabledBit)
 
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, is_toplevel,
                     SharedFunctionInfo::IsTopLevelBit)
@@ -577,6 +577,10 @@ class SharedFunctionInfo
   // Indicates that the function has been reported for binary code coverage.
   DECL_BOOLEAN_ACCESSORS(has_reported_binary_coverage)
 
+  // Indicates that the bytecode of this function is never flushed, because
+  // the embedder pinned it.
+  DECL_BOOLEAN_ACCESSORS(bytecode_flushing_disabled)
+
   // Indicates that the private name lookups inside the function skips the
   // closest outer class scope.
   DECL_BOOLEAN_ACCESSORS(private_name_lookup_skips_outer_class)
@@ -74,6 +74,19 @@ inline uintptr_t slow_search(T* array, uintptr_t array_len, uintptr_t index,
   return -1;
 }
 
+// Same as slow_search, but scans [0, |end|) backwards.
+template <typename T>
+inline uintptr_t slow_search_reverse(T* array, uintptr_t end,
+                                     T search_element) {
+  while (end > 0) {
+    end--;
+    if (array[end] == search_element) {
+      return end;
+    }
+  }
+  return -1;
+}
+
 #ifdef NEON64
 // extract_first_nonzero_index returns the first non-zero index in |v|. |v| is a
 // Neon vector that can be either 32x4 (the return is then 0, 1, 2 or 3) or 64x2
@@ -121,6 +134,48 @@ inline int extract_first_nonzero_index_uint64x2_t(uint64x2_t v) {
   return 2 - vmaxvq_u32(mask);
 }
 
+inline int extract_first_nonzero_index_uint8x16_t(uint8x16_t v) {
+  static constexpr uint8_t kIndexMask[16] = {16, 15, 14, 13, 12, 11, 10, 9,
+                                             8,  7,  6,  5,  4,  3,  2,  1};
+  uint8x16_t mask = vandq_u8(vld1q_u8(kIndexMask), v);
+  return 16 - vmaxvq_u8(mask);
+}
+
+inline int extract_first_nonzero_index_uint16x8_t(uint16x8_t v) {
+  static constexpr uint16_t kIndexMask[8] = {8, 7, 6, 5, 4, 3, 2, 1};
+  uint16x8_t mask = vandq_u16(vld1q_u16(kIndexMask), v);
+  return 8 - vmaxvq_u16(mask);
+}
+
+// The extract_last_nonzero_index_* functions are the counterpart of the
+// functions above for backward searches: the mask holds "index + 1" for each
+// item, so the maximum of the masked vector is one more than the index of the
+// last match.
+inline int extract_last_nonzero_index_uint8x16_t(uint8x16_t v) {
+  static constexpr uint8_t kIndexMask[16] = {1, 2,  3,  4,  5,  6,  7,  8,
+                                             9, 10, 11, 12, 13, 14, 15, 16};
+  uint8x16_t mask = vandq_u8(vld1q_u8(kIndexMask), v);
+  return vmaxvq_u8(mask) - 1;
+}
+
+inline int extract_last_nonzero_index_uint16x8_t(uint16x8_t v) {
+  static constexpr uint16_t kIndexMask[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  uint16x8_t mask = vandq_u16(vld1q_u16(kIndexMask), v);
+  return vmaxvq_u16(mask) - 1;
+}
+
+inline int extract_last_nonzero_index_uint32x4_t(uint32x4_t v) {
+  uint32x4_t mask = PACK32x4(1, 2, 3, 4);
+  mask = vandq_u32(mask, v);
+  return vmaxvq_u32(mask) - 1;
+}
+
+inline int extract_last_nonzero_index_uint64x2_t(uint64x2_t v) {
+  uint32x4_t mask = PACK32x4(1, 0, 2, 0);
+  mask = vandq_u32(mask, vreinterpretq_u32_u64(v));
+  return vmaxvq_u32(mask) - 1;
+}
+
 inline int32_t reinterpret_vmaxvq_u64(uint64x2_t v) {
   return vmaxvq_u32(vreinterpretq_u32_u64(v));
 }
@@ -155,6 +210,41 @@ inline int32_t reinterpret_vmaxvq_u64(uint64x2_t v) {
     }                                                                         \
   }
 
+// The reverse loops scan [0, |end|) backwards, one vector at a time. |end|
+// needs to be aligned to the vector size.
+#define VECTORIZED_REVERSE_LOOP_Neon(type_load, type_eq, set1, cmp, movemask) \
+  {                                                                           \
+    constexpr uintptr_t elems_in_vector = sizeof(type_load) / sizeof(T);      \
+    type_load search_element_vec = set1(search_element);                      \
+                                                                              \
+    for (; end >= elems_in_vector; end -= elems_in_vector) {                  \
+      type_load vector =                                                      \
+          *reinterpret_cast<type_load*>(&array[end - elems_in_vector]);       \
+      type_eq eq = cmp(vector, search_element_vec);                           \
+      if (movemask(eq)) {                                                     \
+        return end - elems_in_vector +                                        \
+               extract_last_nonzero_index_##type_eq(eq);                      \
+      }                                                                       \
+    }                                                                         \
+  }
+
+#define VECTORIZED_REVERSE_LOOP_x86(type_load, type_eq, set1, cmp, movemask, \
+                                    extract)                                 \
+  {                                                                          \
+    constexpr uintptr_t elems_in_vector = sizeof(type_load) / sizeof(T);     \
+    type_load search_element_vec = set1(search_element);                     \
+                                                                             \
+    for (; end >= elems_in_vector; end -= elems_in_vector) {                 \
+      type_load vector =                                                     \
+          *reinterpret_cast<type_load*>(&array[end - elems_in_vector]);      \
+      type_eq eq = cmp(vector, search_element_vec);                          \
+      int eq_mask = movemask(eq);                                            \
+      if (eq_mask) {                                                         \
+        return end - elems_in_vector + extract(eq_mask);                     \
+      }                                                                      \
+    }                                                                        \
+  }
+
 #ifdef __SSE3__
 __m128i _mm_cmpeq_epi64_nosse4_2(__m128i a, __m128i b) {
   __m128i res = _mm_cmpeq_epi32(a, b);
@@ -172,14 +262,21 @@ __m128i _mm_cmpeq_epi64_nosse4_2(__m128i a, __m128i b) {
 template <typename T>
 inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
                                    uintptr_t index, T search_element) {
+  static constexpr bool is_uint8 =
+      sizeof(T) == sizeof(uint8_t) && std::is_integral_v<T>;
+  static constexpr bool is_uint16 =
+      sizeof(T) == sizeof(uint16_t) && std::is_integral_v<T>;
   static constexpr bool is_uint32 =
       sizeof(T) == sizeof(uint32_t) && std::is_integral_v<T>;
   static constexpr bool is_uint64 =
       sizeof(T) == sizeof(uint64_t) && std::is_integral_v<T>;
+  static constexpr bool is_float =
+      sizeof(T) == sizeof(float) && std::is_floating_point_v<T>;
   static constexpr bool is_double =
       sizeof(T) == sizeof(double) && std::is_floating_point_v<T>;
 
-  static_assert(is_uint32 || is_uint64 || is_double);
+  static_assert(is_uint8 || is_uint16 || is_uint32 || is_uint64 || is_float ||
+                is_double);
 
 #if !(defined(__SSE3__) || defined(NEON64))
   // No SIMD available.
@@ -207,7 +304,18 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
 
   // Inserting one of the vectorized loop
 #ifdef __SSE3__
-  if constexpr (is_uint32) {
+  if constexpr (is_uint8) {
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m128i, __m128i, _mm_set1_epi8, _mm_cmpeq_epi8,
+                        _mm_movemask_epi8, EXTRACT)
+#undef EXTRACT
+  } else if constexpr (is_uint16) {
+// _mm_movemask_epi8 produces two bits per 16-bit item.
+#define EXTRACT(x) (base::bits::CountTrailingZeros32(x) / 2)
+    VECTORIZED_LOOP_x86(__m128i, __m128i, _mm_set1_epi16, _mm_cmpeq_epi16,
+                        _mm_movemask_epi8, EXTRACT)
+#undef EXTRACT
+  } else if constexpr (is_uint32) {
 #define MOVEMASK(x) _mm_movemask_ps(_mm_castsi128_ps(x))
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
     VECTORIZED_LOOP_x86(__m128i, __m128i, _mm_set1_epi32, _mm_cmpeq_epi32,
@@ -231,10 +339,21 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
     VECTORIZED_LOOP_x86(__m128d, __m128d, _mm_set1_pd, _mm_cmpeq_pd,
                         _mm_movemask_pd, EXTRACT)
+#undef EXTRACT
+  } else if constexpr (is_float) {
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m128, __m128, _mm_set1_ps, _mm_cmpeq_ps,
+                        _mm_movemask_ps, EXTRACT)
 #undef EXTRACT
   }
 #elif defined(NEON64)
-  if constexpr (is_uint32) {
+  if constexpr (is_uint8) {
+    VECTORIZED_LOOP_Neon(uint8x16_t, uint8x16_t, vdupq_n_u8, vceqq_u8,
+                         vmaxvq_u8)
+  } else if constexpr (is_uint16) {
+    VECTORIZED_LOOP_Neon(uint16x8_t, uint16x8_t, vdupq_n_u16, vceqq_u16,
+                         vmaxvq_u16)
+  } else if constexpr (is_uint32) {
     VECTORIZED_LOOP_Neon(uint32x4_t, uint32x4_t, vdupq_n_u32, vceqq_u32,
                          vmaxvq_u32)
   } else if constexpr (is_uint64) {
@@ -243,6 +362,9 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
   } else if constexpr (is_double) {
     VECTORIZED_LOOP_Neon(float64x2_t, uint64x2_t, vdupq_n_f64, vceqq_f64,
                          reinterpret_vmaxvq_u64)
+  } else if constexpr (is_float) {
+    VECTORIZED_LOOP_Neon(float32x4_t, uint32x4_t, vdupq_n_f32, vceqq_f32,
+                         vmaxvq_u32)
   }
 #else
   UNREACHABLE();
@@ -254,6 +376,104 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
   return slow_search(array, array_len, index, search_element);
 }
 
+// Backward version of fast_search_noavx: returns the index of the last
+// occurrence of |search_element| in [0, |end|). Backward searches are only
+// used by lastIndexOf, so there is no AVX2 variant.
+template <typename T>
+inline uintptr_t fast_search_reverse(T* array, uintptr_t end,
+                                     T search_element) {
+  static constexpr bool is_uint8 =
+      sizeof(T) == sizeof(uint8_t) && std::is_integral_v<T>;
+  static constexpr bool is_uint16 =
+      sizeof(T) == sizeof(uint16_t) && std::is_integral_v<T>;
+  static constexpr bool is_uint32 =
+      sizeof(T) == sizeof(uint32_t) && std::is_integral_v<T>;
+  static constexpr bool is_uint64 =
+      sizeof(T) == sizeof(uint64_t) && std::is_integral_v<T>;
+  static constexpr bool is_float =
+      sizeof(T) == sizeof(float) && std::is_floating_point_v<T>;
+  static constexpr bool is_double =
+      sizeof(T) == sizeof(double) && std::is_floating_point_v<T>;
+
+  static_assert(is_uint8 || is_uint16 || is_uint32 || is_uint64 || is_float ||
+                is_double);
+
+#if !(defined(__SSE3__) || defined(NEON64))
+  // No SIMD available.
+  return slow_search_reverse(array, end, search_element);
+#endif
+
+  const int target_align = 16;
+
+  // Scalar loop to align the end of the range.
+  while (end > 0 &&
+         (reinterpret_cast<std::uintptr_t>(&(array[end])) % target_align) !=
+             0) {
+    end--;
+    if (array[end] == search_element) {
+      return end;
+    }
+  }
+
+#ifdef __SSE3__
+#define EXTRACT(x) (31 - base::bits::CountLeadingZeros32(x))
+  if constexpr (is_uint8) {
+    VECTORIZED_REVERSE_LOOP_x86(__m128i, __m128i, _mm_set1_epi8,
+                                _mm_cmpeq_epi8, _mm_movemask_epi8, EXTRACT)
+  } else if constexpr (is_uint16) {
+#define EXTRACT16(x) (EXTRACT(x) / 2)
+    VECTORIZED_REVERSE_LOOP_x86(__m128i, __m128i, _mm_set1_epi16,
+                                _mm_cmpeq_epi16, _mm_movemask_epi8, EXTRACT16)
+#undef EXTRACT16
+  } else if constexpr (is_uint32) {
+#define MOVEMASK(x) _mm_movemask_ps(_mm_castsi128_ps(x))
+    VECTORIZED_REVERSE_LOOP_x86(__m128i, __m128i, _mm_set1_epi32,
+                                _mm_cmpeq_epi32, MOVEMASK, EXTRACT)
+#undef MOVEMASK
+  } else if constexpr (is_uint64) {
+#define MOVEMASK(x) _mm_movemask_ps(_mm_castsi128_ps(x))
+// See fast_search_noavx for the possible patterns; the second value matches
+// iff the most significant bit is set.
+#define EXTRACT64(x) (((x) & 0b1000) ? 1 : 0)
+    VECTORIZED_REVERSE_LOOP_x86(__m128i, __m128i, _mm_set1_epi64x,
+                                _mm_cmpeq_epi64_nosse4_2, MOVEMASK, EXTRACT64)
+#undef MOVEMASK
+#undef EXTRACT64
+  } else if constexpr (is_float) {
+    VECTORIZED_REVERSE_LOOP_x86(__m128, __m128, _mm_set1_ps, _mm_cmpeq_ps,
+                                _mm_movemask_ps, EXTRACT)
+  } else if constexpr (is_double) {
+    VECTORIZED_REVERSE_LOOP_x86(__m128d, __m128d, _mm_set1_pd, _mm_cmpeq_pd,
+                                _mm_movemask_pd, EXTRACT)
+  }
+#undef EXTRACT
+#elif defined(NEON64)
+  if constexpr (is_uint8) {
+    VECTORIZED_REVERSE_LOOP_Neon(uint8x16_t, uint8x16_t, vdupq_n_u8, vceqq_u8,
+                                 vmaxvq_u8)
+  } else if constexpr (is_uint16) {
+    VECTORIZED_REVERSE_LOOP_Neon(uint16x8_t, uint16x8_t, vdupq_n_u16,
+                                 vceqq_u16, vmaxvq_u16)
+  } else if constexpr (is_uint32) {
+    VECTORIZED_REVERSE_LOOP_Neon(uint32x4_t, uint32x4_t, vdupq_n_u32,
+                                 vceqq_u32, vmaxvq_u32)
+  } else if constexpr (is_uint64) {
+    VECTORIZED_REVERSE_LOOP_Neon(uint64x2_t, uint64x2_t, vdupq_n_u64,
+                                 vceqq_u64, reinterpret_vmaxvq_u64)
+  } else if constexpr (is_float) {
+    VECTORIZED_REVERSE_LOOP_Neon(float32x4_t, uint32x4_t, vdupq_n_f32,
+                                 vceqq_f32, vmaxvq_u32)
+  } else if constexpr (is_double) {
+    VECTORIZED_REVERSE_LOOP_Neon(float64x2_t, uint64x2_t, vdupq_n_f64,
+                                 vceqq_f64, reinterpret_vmaxvq_u64)
+  }
+#else
+  UNREACHABLE();
+#endif
+
+  return slow_search_reverse(array, end, search_element);
+}
+
 #if defined(_MSC_VER) && defined(__clang__)
 // Generating AVX2 code with Clang on Windows without the /arch:AVX2 flag does
 // not seem possible at the moment.
@@ -274,14 +494,21 @@ template <typename T>
 TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
                                              uintptr_t index,
                                              T search_element) {
+  static constexpr bool is_uint8 =
+      sizeof(T) == sizeof(uint8_t) && std::is_integral_v<T>;
+  static constexpr bool is_uint16 =
+      sizeof(T) == sizeof(uint16_t) && std::is_integral_v<T>;
   static constexpr bool is_uint32 =
       sizeof(T) == sizeof(uint32_t) && std::is_integral_v<T>;
   static constexpr bool is_uint64 =
       sizeof(T) == sizeof(uint64_t) && std::is_integral_v<T>;
+  static constexpr bool is_float =
+      sizeof(T) == sizeof(float) && std::is_floating_point_v<T>;
   static constexpr bool is_double =
       sizeof(T) == sizeof(double) && std::is_floating_point_v<T>;
 
-  static_assert(is_uint32 || is_uint64 || is_double);
+  static_assert(is_uint8 || is_uint16 || is_uint32 || is_uint64 || is_float ||
+                is_double);
 
   const int target_align = 32;
   // Scalar loop to reach desired alignment
@@ -295,7 +522,17 @@ TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
   }
 
   // Generating vectorized loop
-  if constexpr (is_uint32) {
+  if constexpr (is_uint8) {
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m256i, __m256i, _mm256_set1_epi8, _mm256_cmpeq_epi8,
+                        _mm256_movemask_epi8, EXTRACT)
+#undef EXTRACT
+  } else if constexpr (is_uint16) {
+#define EXTRACT(x) (base::bits::CountTrailingZeros32(x) / 2)
+    VECTORIZED_LOOP_x86(__m256i, __m256i, _mm256_set1_epi16,
+                        _mm256_cmpeq_epi16, _mm256_movemask_epi8, EXTRACT)
+#undef EXTRACT
+  } else if constexpr (is_uint32) {
 #define MOVEMASK(x) _mm256_movemask_ps(_mm256_castsi256_ps(x))
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
     VECTORIZED_LOOP_x86(__m256i, __m256i, _mm256_set1_epi32, _mm256_cmpeq_epi32,
@@ -315,6 +552,13 @@ TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
     VECTORIZED_LOOP_x86(__m256d, __m256d, _mm256_set1_pd, CMP,
                         _mm256_movemask_pd, EXTRACT)
 #undef CMP
+#undef EXTRACT
+  } else if constexpr (is_float) {
+#define CMP(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m256, __m256, _mm256_set1_ps, CMP,
+                        _mm256_movemask_ps, EXTRACT)
+#undef CMP
 #undef EXTRACT
   }
 
@@ -343,6 +587,8 @@ uintptr_t fast_search_avx(T* array, uintptr_t array_len, uintptr_t index,
 #undef IS_CLANG_WIN
 #undef VECTORIZED_LOOP_Neon
 #undef VECTORIZED_LOOP_x86
+#undef VECTORIZED_REVERSE_LOOP_Neon
+#undef VECTORIZED_REVERSE_LOOP_x86
 
 template <typename T>
 inline uintptr_t search(T* array, uintptr_t array_len, uintptr_t index,
@@ -428,6 +674,20 @@ Address ArrayIndexOfIncludes(Address array_start, uintptr_t array_len,
   }
 }
 
+// TypedArray elements are compared by value, which for integers is the same
+// as comparing their bits. Searching on the unsigned type with the same size
+// lets all integer types share the kernels above.
+template <typename T, bool = std::is_floating_point_v<T>>
+struct SearchTypeFor {
+  using type = std::make_unsigned_t<T>;
+};
+template <typename T>
+struct SearchTypeFor<T, true> {
+  using type = T;
+};
+template <typename T>
+using SearchType = typename SearchTypeFor<T>::type;
+
 }  // namespace
 
 uintptr_t ArrayIndexOfIncludesSmiOrObject(Address array_start,
@@ -445,6 +705,59 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
       array_start, array_len, from_index, search_element);
 }
 
+uintptr_t ArrayLastIndexOfSmiOrObject(Address array_start, uintptr_t from_index,
+                                      Address search_element) {
+  Tagged<FixedArray> fixed_array =
+      Cast<FixedArray>(Tagged<Object>(array_start));
+  DCHECK_LT(from_index, static_cast<uintptr_t>(fixed_array->length()));
+  Tagged_t* array = static_cast<Tagged_t*>(
+      fixed_array->RawFieldOfFirstElement().ToVoidPtr());
+
+  DCHECK(!IsHeapNumber(Tagged<Object>(search_element)));
+  DCHECK(!IsBigInt(Tagged<Object>(search_element)));
+  DCHECK(!IsString(Tagged<Object>(search_element)));
+
+  return fast_search_reverse<Tagged_t>(array, from_index + 1,
+                                       static_cast<Tagged_t>(search_element));
+}
+
+template <typename T>
+uintptr_t TypedArrayIndexOf(const T* array, uintptr_t array_len,
+                            uintptr_t from_index, T search_element) {
+  if constexpr (std::is_floating_point_v<T>) {
+    DCHECK(!std::isnan(search_element));
+  }
+  using U = SearchType<T>;
+  return search<U>(reinterpret_cast<U*>(const_cast<T*>(array)), array_len,
+                   from_index, static_cast<U>(search_element));
+}
+
+template <typename T>
+uintptr_t TypedArrayLastIndexOf(const T* array, uintptr_t from_index,
+                                T search_element) {
+  if constexpr (std::is_floating_point_v<T>) {
+    DCHECK(!std::isnan(search_element));
+  }
+  using U = SearchType<T>;
+  return fast_search_reverse<U>(reinterpret_cast<U*>(const_cast<T*>(array)),
+                                from_index + 1, static_cast<U>(search_element));
+}
+
+#define INSTANTIATE_TYPED_ARRAY_SEARCH(T)                                    \
+  template uintptr_t TypedArrayIndexOf<T>(const T*, uintptr_t, uintptr_t, T); \
+  template uintptr_t TypedArrayLastIndexOf<T>(const T*, uintptr_t, T);
+INSTANTIATE_TYPED_ARRAY_SEARCH(int8_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint8_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(int16_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint16_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(int32_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint32_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(int64_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint64_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(float)
+INSTANTIATE_TYPED_ARRAY_SEARCH(double)
+#undef INSTANTIATE_TYPED_ARRAY_SEARCH
+
 #ifdef NEON64
 #undef NEON64
 #endif
@@ -20,6 +20,25 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
                                      uintptr_t from_index,
                                      Address search_element);
 
+// Returns the index of the last occurrence of |search_element| in the
+// FixedArray at |array_start| at or before |from_index|, or -1. Like
+// ArrayIndexOfIncludesSmiOrObject, this compares tagged values, so it can only
+// be used when strict equality is identity.
+uintptr_t ArrayLastIndexOfSmiOrObject(Address array_start, uintptr_t from_index,
+                                      Address search_element);
+
+// Searches the (non-shared) backing store of a TypedArray for
+// |search_element|. Floating point elements are compared with ==, so -0
+// matches +0, and |search_element| must not be NaN. Returns -1 if there is no
+// match.
+template <typename T>
+uintptr_t TypedArrayIndexOf(const T* array, uintptr_t array_len,
+                            uintptr_t from_index, T search_element);
+// Same as above, but searches backwards starting at |from_index|.
+template <typename T>
+uintptr_t TypedArrayLastIndexOf(const T* array, uintptr_t from_index,
+                                T search_element);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -5,6 +5,7 @@
 #include "src/objects/string-table.h"
 
 #include <atomic>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -159,22 +160,44 @@ void StringTable::Data::Print(PtrComprCageBase cage_base) const {
 }
 
 StringTable::StringTable(Isolate* isolate)
-    : data_(Data::New(OffHeapStringHashSet::kMinCapacity).release()),
+    : shard_bits_(v8_flags.shared_string_table ? kSharedShardBits : 0),
+      number_of_shards_(1 << shard_bits_),
+      shards_(std::make_unique<Shard[]>(number_of_shards_)),
       isolate_(isolate) {
   DCHECK_EQ(empty_element(), OffHeapStringHashSet::empty_element());
   DCHECK_EQ(deleted_element(), OffHeapStringHashSet::deleted_element());
+  for (int i = 0; i < number_of_shards_; i++) {
+    shards_[i].data.store(
+        Data::New(OffHeapStringHashSet::kMinCapacity).release(),
+        std::memory_order_relaxed);
+  }
 }
 
-StringTable::~StringTable() { delete data_; }
+StringTable::~StringTable() {
+  for (int i = 0; i < number_of_shards_; i++) {
+    delete shards_[i].data.load(std::memory_order_relaxed);
+  }
+}
 
 int StringTable::Capacity() const {
-  return data_.load(std::memory_order_acquire)->table().capacity();
+  int capacity = 0;
+  for (int i = 0; i < number_of_shards_; i++) {
+    capacity +=
+        shards_[i].data.load(std::memory_order_acquire)->table().capacity();
+  }
+  return capacity;
 }
+
 int StringTable::NumberOfElements() const {
-  {
-    base::SpinningMutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->table().number_of_elements();
-  }
+  int number_of_elements = 0;
+  for (int i = 0; i < number_of_shards_; i++) {
+    base::SpinningMutexGuard table_write_guard(&shards_[i].write_mutex);
+    number_of_elements += shards_[i]
+                              .data.load(std::memory_order_relaxed)
+                              ->table()
+                              .number_of_elements();
+  }
+  return number_of_elements;
 }
 
 // InternalizedStringKey carries a string/internalized-string object as key.
@@ -395,7 +418,7 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   //
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
-  //   - All writes to the string table are guarded by the Isolate string table
+  //   - All writes to a string table shard are guarded by that shard's write
   //     mutex,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
@@ -425,9 +448,13 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   // allocation if another write also did an allocation. This assumes that
   // writes are rarer than reads.
 
-  // Load the current string table data, in case another thread updates the
-  // data while we're reading.
-  Data* const current_data = data_.load(std::memory_order_acquire);
+  // Keys are partitioned into shards by hash, so only writers hashing to the
+  // same shard contend for its lock.
+  Shard& shard = ShardFor(key->hash());
+
+  // Load the current shard data, in case another thread updates the data while
+  // we're reading.
+  Data* const current_data = shard.data.load(std::memory_order_acquire);
   OffHeapStringHashSet& current_table = current_data->table();
 
   // First try to find the string in the table. This is safe to do even if the
@@ -447,9 +474,9 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
   {
-    base::SpinningMutexGuard table_write_guard(&write_mutex_);
+    base::SpinningMutexGuard table_write_guard(&shard.write_mutex);
 
-    Data* data = EnsureCapacity(isolate, 1);
+    Data* data = EnsureCapacity(shard, isolate, 1);
     OffHeapStringHashSet& table = data->table();
 
     // Check one last time if the key is present in the table, in case it was
@@ -497,14 +524,15 @@ template DirectHandle<String> StringTable::LookupKey(
 template DirectHandle<String> StringTable::LookupKey(
     LocalIsolate* isolate, StringTableInsertionKey* key);
 
-StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
+StringTable::Data* StringTable::EnsureCapacity(Shard& shard,
+                                               PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the shard's write mutex is held.
+  shard.write_mutex.AssertHeld();
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
-  Data* data = data_.load(std::memory_order_relaxed);
+  Data* data = shard.data.load(std::memory_order_relaxed);
 
   int new_capacity;
   if (data->table().ShouldResizeToAdd(additional_elements, &new_capacity)) {
@@ -512,11 +540,11 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
         Data::Resize(cage_base, std::unique_ptr<Data>(data), new_capacity);
     // `new_data` is the new owner of `data`.
     DCHECK_EQ(new_data->PreviousData(), data);
-    // Release-store the new data pointer as `data_`, so that it can be
-    // acquire-loaded by other threads. This string table becomes the owner of
-    // the pointer.
+    // Release-store the new data pointer into the shard, so that it can be
+    // acquire-loaded by other threads. The shard becomes the owner of the
+    // pointer. Other shards are unaffected and keep accepting inserts.
     data = new_data.release();
-    data_.store(data, std::memory_order_release);
+    shard.data.store(data, std::memory_order_release);
   }
 
   return data;
@@ -606,8 +634,9 @@ Address StringTable::Data::TryStringToIndexOrLookupExisting(
     return Smi::FromInt(ResultSentinel::kUnsupported).ptr();
   }
 
-  Data* string_table_data =
-      isolate->string_table()->data_.load(std::memory_order_acquire);
+  Data* string_table_data = isolate->string_table()
+                                ->ShardFor(key.hash())
+                                .data.load(std::memory_order_acquire);
 
   InternalIndex entry =
       string_table_data->table().FindEntry(isolate, &key, key.hash());
@@ -678,21 +707,33 @@ void StringTable::InsertForIsolateDeserialization(
   DCHECK_EQ(NumberOfElements(), 0);
 
   const int length = static_cast<int>(strings.size());
-  {
-    base::SpinningMutexGuard table_write_guard(&write_mutex_);
 
-    Data* const data = EnsureCapacity(isolate, length);
+  // Grow each shard once up front rather than on every insert.
+  std::vector<int> shard_lengths(number_of_shards_, 0);
+  for (const DirectHandle<String>& s : strings) {
+    StringTableInsertionKey key(
+        isolate, s, DeserializingUserCodeOption::kNotDeserializingUserCode);
+    shard_lengths[ShardIndexFor(key.hash())]++;
+  }
+  for (int i = 0; i < number_of_shards_; i++) {
+    if (shard_lengths[i] == 0) continue;
+    base::SpinningMutexGuard table_write_guard(&shards_[i].write_mutex);
+    EnsureCapacity(shards_[i], isolate, shard_lengths[i]);
+  }
 
-    for (const DirectHandle<String>& s : strings) {
-      StringTableInsertionKey key(
-          isolate, s, DeserializingUserCodeOption::kNotDeserializingUserCode);
-      InternalIndex entry =
-          data->table().FindEntryOrInsertionEntry(isolate, &key, key.hash());
+  for (const DirectHandle<String>& s : strings) {
+    StringTableInsertionKey key(
+        isolate, s, DeserializingUserCodeOption::kNotDeserializingUserCode);
+    Shard& shard = ShardFor(key.hash());
+    base::SpinningMutexGuard table_write_guard(&shard.write_mutex);
 
-      DirectHandle<String> inserted_string = key.GetHandleForInsertion(isolate);
-      DCHECK_IMPLIES(v8_flags.shared_string_table, inserted_string->IsShared());
-      data->table().AddAt(isolate, entry, *inserted_string);
-    }
+    Data* const data = shard.data.load(std::memory_order_relaxed);
+    InternalIndex entry =
+        data->table().FindEntryOrInsertionEntry(isolate, &key, key.hash());
+
+    DirectHandle<String> inserted_string = key.GetHandleForInsertion(isolate);
+    DCHECK_IMPLIES(v8_flags.shared_string_table, inserted_string->IsShared());
+    data->table().AddAt(isolate, entry, *inserted_string);
   }
 
   DCHECK_EQ(NumberOfElements(), length);
@@ -701,13 +742,14 @@ void StringTable::InsertForIsolateDeserialization(
 void StringTable::InsertEmptyStringForBootstrapping(Isolate* isolate) {
   DCHECK_EQ(NumberOfElements(), 0);
   {
-    base::SpinningMutexGuard table_write_guard(&write_mutex_);
-
-    Data* const data = EnsureCapacity(isolate, 1);
-
     DirectHandle<String> empty_string = isolate->factory()->empty_string();
     uint32_t hash = empty_string->EnsureHash();
 
+    Shard& shard = ShardFor(hash);
+    base::SpinningMutexGuard table_write_guard(&shard.write_mutex);
+
+    Data* const data = EnsureCapacity(shard, isolate, 1);
+
     InternalIndex entry = data->table().FindInsertionEntry(isolate, hash);
 
     DCHECK_IMPLIES(v8_flags.shared_string_table, empty_string->IsShared());
@@ -717,19 +759,33 @@ void StringTable::InsertEmptyStringForBootstrapping(Isolate* isolate) {
 }
 
 void StringTable::Print(PtrComprCageBase cage_base) const {
-  data_.load(std::memory_order_acquire)->Print(cage_base);
+  for (int i = 0; i < number_of_shards_; i++) {
+    shards_[i].data.load(std::memory_order_acquire)->Print(cage_base);
+  }
 }
 
 size_t StringTable::GetCurrentMemoryUsage() const {
-  return sizeof(*this) +
-         data_.load(std::memory_order_acquire)->GetCurrentMemoryUsage();
+  size_t usage = sizeof(*this) + number_of_shards_ * sizeof(Shard);
+  for (int i = 0; i < number_of_shards_; i++) {
+    usage += shards_[i]
+                 .data.load(std::memory_order_acquire)
+                 ->GetCurrentMemoryUsage();
+  }
+  return usage;
 }
 
 void StringTable::IterateElements(RootVisitor* visitor) {
+  for (int i = 0; i < number_of_shards_; i++) {
+    IterateElements(i, visitor);
+  }
+}
+
+void StringTable::IterateElements(int shard, RootVisitor* visitor) {
   // This should only happen during garbage collection when background threads
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
-  data_.load(std::memory_order_relaxed)->IterateElements(visitor);
+  DCHECK_LT(shard, number_of_shards_);
+  shards_[shard].data.load(std::memory_order_relaxed)->IterateElements(visitor);
 }
 
 void StringTable::DropOldData() {
@@ -737,15 +793,19 @@ void StringTable::DropOldData() {
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
-  data_.load(std::memory_order_relaxed)->DropPreviousData();
+  for (int i = 0; i < number_of_shards_; i++) {
+    shards_[i].data.load(std::memory_order_relaxed)->DropPreviousData();
+  }
 }
 
-void StringTable::NotifyElementsRemoved(int count) {
+void StringTable::NotifyElementsRemoved(int shard, int count) {
   // This should only happen during garbage collection when background threads
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
-  data_.load(std::memory_order_relaxed)->table().ElementsRemoved(count);
+  DCHECK_LT(shard, number_of_shards_);
+  shards_[shard].data.load(std::memory_order_relaxed)->table().ElementsRemoved(
+      count);
 }
 
 }  // namespace internal
@@ -43,7 +43,12 @@ class SeqOneByteString;
 // StringTable, for internalizing strings. The Lookup methods are designed to be
 // thread-safe, in combination with GC safepoints.
 //
-// The string table layout is defined by its Data implementation class, see
+// The table is split into shards selected by the string hash, each with its
+// own data and write mutex, so that concurrent inserts (e.g. from many Isolates
+// sharing the table) only contend when they hit the same shard. Reads never
+// take a lock. A table that isn't shared has a single shard.
+//
+// The layout of each shard is defined by the Data implementation class, see
 // StringTable::Data for details.
 class V8_EXPORT_PRIVATE StringTable {
  public:
@@ -82,11 +87,14 @@ class V8_EXPORT_PRIVATE StringTable {
   void Print(PtrComprCageBase cage_base) const;
   size_t GetCurrentMemoryUsage() const;
 
+  int NumberOfShards() const { return number_of_shards_; }
+
   // The following methods must be called either while holding the write lock,
   // or while in a Heap safepoint.
   void IterateElements(RootVisitor* visitor);
+  void IterateElements(int shard, RootVisitor* visitor);
   void DropOldData();
-  void NotifyElementsRemoved(int count);
+  void NotifyElementsRemoved(int shard, int count);
 
   void VerifyIfOwnedBy(Isolate* isolate);
 
@@ -94,12 +102,33 @@ class V8_EXPORT_PRIVATE StringTable {
   class OffHeapStringHashSet;
   class Data;
 
-  Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
+  // Number of shards used when the table is shared between Isolates.
+  static constexpr int kSharedShardBits = 4;
+
+  // Shards are padded to a cache line so that writers on different shards
+  // don't false-share the mutex or data pointer.
+  struct alignas(64) Shard {
+    std::atomic<Data*> data;
+    // Write mutex is mutable so that readers of concurrently mutated values
+    // (e.g. NumberOfElements) are allowed to lock it while staying const.
+    mutable base::SpinningMutex write_mutex;
+  };
+
+  int ShardIndexFor(uint32_t hash) const {
+    // The probe sequence within a shard starts from the low hash bits, so mix
+    // all bits into the top ones to select the shard. Array index hashes in
+    // particular keep the digit count in the top bits.
+    if (shard_bits_ == 0) return 0;
+    return (hash * 0x9E3779B1u) >> (32 - shard_bits_);
+  }
+  Shard& ShardFor(uint32_t hash) const { return shards_[ShardIndexFor(hash)]; }
+
+  Data* EnsureCapacity(Shard& shard, PtrComprCageBase cage_base,
+                       int additional_elements);
 
-  std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::SpinningMutex write_mutex_;
+  const int shard_bits_;
+  const int number_of_shards_;
+  std::unique_ptr<Shard[]> shards_;
   Isolate* isolate_;
 };
 
@@ -1161,27 +1161,33 @@ template <typename IsolateT>
 String::LineEndsVector String::CalculateLineEndsVector(
     IsolateT* isolate, DirectHandle<String> src, bool include_ending_line) {
   src = Flatten(isolate, src);
+  DisallowGarbageCollection no_gc;
+  // Dispatch on type of strings.
+  String::FlatContent content = src->GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  if (content.IsOneByte()) {
+    return CalculateLineEndsVector(content.ToOneByteVector(),
+                                   include_ending_line);
+  }
+  return CalculateLineEndsVector(content.ToUC16Vector(), include_ending_line);
+}
+
+template <typename Char>
+String::LineEndsVector String::CalculateLineEndsVector(
+    base::Vector<const Char> chars, bool include_ending_line) {
   // Rough estimate of line count based on a roughly estimated average
   // length of packed code. Most scripts have < 32 lines.
-  int line_count_estimate = (src->length() >> 6) + 16;
+  int line_count_estimate = (chars.length() >> 6) + 16;
   LineEndsVector line_ends;
   line_ends.reserve(line_count_estimate);
-  {
-    DisallowGarbageCollection no_gc;
-    // Dispatch on type of strings.
-    String::FlatContent content = src->GetFlatContent(no_gc);
-    DCHECK(content.IsFlat());
-    if (content.IsOneByte()) {
-      CalculateLineEndsImpl(&line_ends, content.ToOneByteVector(),
-                            include_ending_line);
-    } else {
-      CalculateLineEndsImpl(&line_ends, content.ToUC16Vector(),
-                            include_ending_line);
-    }
-  }
+  CalculateLineEndsImpl(&line_ends, chars, include_ending_line);
   return line_ends;
 }
 
+template String::LineEndsVector String::CalculateLineEndsVector(
+    base::Vector<const uint8_t> chars, bool include_ending_line);
+template String::LineEndsVector String::CalculateLineEndsVector(
+    base::Vector<const base::uc16> chars, bool include_ending_line);
 template String::LineEndsVector String::CalculateLineEndsVector(
     Isolate* isolate, DirectHandle<String> src, bool include_ending_line);
 template String::LineEndsVector String::CalculateLineEndsVector(
@@ -632,6 +632,12 @@ V8_OBJECT class String : public Name {
                                                 DirectHandle<String> string,
                                                 bool include_ending_line);
 
+  // Same as above, for the characters of a flat string. Does not access the
+  // heap, so it may run on any thread as long as {chars} stays valid.
+  template <typename Char>
+  static LineEndsVector CalculateLineEndsVector(base::Vector<const Char> chars,
+                                                bool include_ending_line);
+
   template <typename IsolateT>
   static Handle<FixedArray> CalculateLineEnds(IsolateT* isolate,
                                               DirectHandle<String> string,
@@ -1013,6 +1019,13 @@ V8_OBJECT class ConsString : public String {
   // Minimum length for a cons string.
   static const uint32_t kMinLength = 13;
 
+  // When JS string addition appends a string shorter than kMinLength to a
+  // cons string whose second part is a sequential string, it copies both
+  // into a new flat second part instead of nesting another cons string, as
+  // long as the copy is at most this long. This keeps ropes built by `s += c`
+  // loops shallow. See StringBuiltinsAssembler::StringAdd.
+  static const uint32_t kMaxCoalescedLeafLength = 64;
+
   DECL_VERIFIER(ConsString)
 
  private:
@@ -242,6 +242,11 @@ enum class SerializationTag : uint8_t {
   kLegacyReservedRTCCertificate = 'k',
 };
 
+// Elements of dense arrays of numbers are each encoded as a kDouble tag
+// followed by the raw value.
+constexpr size_t kDenseDoubleElementSize =
+    sizeof(SerializationTag) + sizeof(double);
+
 namespace {
 
 enum class ArrayBufferViewTag : uint8_t {
@@ -503,7 +508,13 @@ Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
     }
     default:
       if (InstanceTypeChecker::IsString(instance_type)) {
-        WriteString(Cast<String>(object));
+        Handle<String> string = Cast<String>(object);
+        if (ShouldShareString(*string)) {
+          // The receiving isolate gets the shared string itself instead of
+          // a copy of its contents.
+          return WriteSharedObject(String::Share(isolate_, string));
+        }
+        WriteString(string);
         return ThrowIfOutOfMemory();
       } else if (InstanceTypeChecker::IsJSReceiver(instance_type)) {
         return WriteJSReceiver(Cast<JSReceiver>(object));
@@ -550,6 +561,13 @@ void ValueSerializer::WriteBigInt(Tagged<BigInt> bigint) {
   WriteBigIntContents(bigint);
 }
 
+bool ValueSerializer::ShouldShareString(Tagged<String> string) const {
+  const int min_length = v8_flags.value_serializer_shared_string_min_length;
+  return min_length > 0 && v8_flags.shared_string_table &&
+         delegate_ != nullptr && isolate_->has_shared_space() &&
+         string->length() >= static_cast<uint32_t>(min_length);
+}
+
 void ValueSerializer::WriteString(Handle<String> string) {
   string = String::Flatten(isolate_, string);
   DisallowGarbageCollection no_gc;
@@ -766,9 +784,17 @@ Maybe<bool> ValueSerializer::WriteJSArray(DirectHandle<JSArray> array) {
         DisallowGarbageCollection no_gc;
         Tagged<FixedDoubleArray> elements =
             Cast<FixedDoubleArray>(array->elements());
-        for (i = 0; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements->get_scalar(i));
+        // Every element is encoded as a kDouble tag followed by the raw value,
+        // so reserve the space for all of them at once.
+        uint8_t* dest;
+        if (!ReserveRawBytes(length * kDenseDoubleElementSize).To(&dest)) {
+          return ThrowIfOutOfMemory();
+        }
+        for (i = 0; i < length; i++, dest += kDenseDoubleElementSize) {
+          // Warning: this uses host endianness.
+          double value = elements->get_scalar(i);
+          *dest = static_cast<uint8_t>(SerializationTag::kDouble);
+          memcpy(dest + sizeof(SerializationTag), &value, sizeof(value));
         }
         break;
       }
@@ -1822,33 +1848,50 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSArray> array = isolate_->factory()->NewJSArray(
-      HOLEY_ELEMENTS, length, length,
-      ArrayStorageAllocationMode::INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
-  AddObjectWithID(id, array);
-
-  DirectHandle<FixedArray> elements(Cast<FixedArray>(array->elements()),
-                                    isolate_);
-  auto elements_length = static_cast<uint32_t>(elements->length());
-  for (uint32_t i = 0; i < length; i++) {
-    SerializationTag tag;
-    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
-      ConsumeTag(SerializationTag::kTheHole);
-      continue;
+  Handle<JSArray> array;
+  if (HasDenseDoubleElements(length)) {
+    // Decode arrays of numbers straight into double elements instead of
+    // allocating a heap number for each of them.
+    array = isolate_->factory()->NewJSArray(
+        PACKED_DOUBLE_ELEMENTS, length, length,
+        ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS);
+    AddObjectWithID(id, array);
+    DisallowGarbageCollection no_gc;
+    Tagged<FixedDoubleArray> elements =
+        Cast<FixedDoubleArray>(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      position_ += sizeof(SerializationTag);
+      elements->set(i, ReadDouble().FromJust());
     }
+  } else {
+    array = isolate_->factory()->NewJSArray(
+        HOLEY_ELEMENTS, length, length,
+        ArrayStorageAllocationMode::INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
+    AddObjectWithID(id, array);
+
+    DirectHandle<FixedArray> elements(Cast<FixedArray>(array->elements()),
+                                      isolate_);
+    auto elements_length = static_cast<uint32_t>(elements->length());
+    for (uint32_t i = 0; i < length; i++) {
+      SerializationTag tag;
+      if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+        ConsumeTag(SerializationTag::kTheHole);
+        continue;
+      }
 
-    DirectHandle<Object> element;
-    if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
+      DirectHandle<Object> element;
+      if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
 
-    // Serialization versions less than 11 encode the hole the same as
-    // undefined. For consistency with previous behavior, store these as the
-    // hole. Past version 11, undefined means undefined.
-    if (version_ < 11 && IsUndefined(*element, isolate_)) continue;
+      // Serialization versions less than 11 encode the hole the same as
+      // undefined. For consistency with previous behavior, store these as the
+      // hole. Past version 11, undefined means undefined.
+      if (version_ < 11 && IsUndefined(*element, isolate_)) continue;
 
-    // Safety check.
-    if (i >= elements_length) return MaybeHandle<JSArray>();
+      // Safety check.
+      if (i >= elements_length) return MaybeHandle<JSArray>();
 
-    elements->set(i, *element);
+      elements->set(i, *element);
+    }
   }
 
   uint32_t num_properties;
@@ -1866,6 +1909,22 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   return scope.CloseAndEscape(array);
 }
 
+bool ValueDeserializer::HasDenseDoubleElements(uint32_t length) const {
+  if (length == 0 ||
+      length > static_cast<uint32_t>(FixedDoubleArray::kMaxLength) ||
+      length * kDenseDoubleElementSize >
+          static_cast<size_t>(end_ - position_)) {
+    return false;
+  }
+  for (size_t offset = 0; offset < length * kDenseDoubleElementSize;
+       offset += kDenseDoubleElementSize) {
+    if (position_[offset] != static_cast<uint8_t>(SerializationTag::kDouble)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 MaybeHandle<JSDate> ValueDeserializer::ReadJSDate() {
   double value;
   if (!ReadDouble().To(&value)) return MaybeHandle<JSDate>();
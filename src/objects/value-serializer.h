@@ -118,6 +118,9 @@ class ValueSerializer {
   void WriteHeapNumber(Tagged<HeapNumber> number);
   void WriteBigInt(Tagged<BigInt> bigint);
   void WriteString(Handle<String> string);
+  // Whether {string} is transferred through the shared heap instead of
+  // being copied.
+  bool ShouldShareString(Tagged<String> string) const;
   Maybe<bool> WriteJSReceiver(Handle<JSReceiver> receiver)
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(DirectHandle<JSObject> object)
@@ -291,6 +294,8 @@ class ValueDeserializer {
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
+  // Whether the next {length} elements of a dense array are all doubles.
+  bool HasDenseDoubleElements(uint32_t length) const;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSPrimitiveWrapper> ReadJSPrimitiveWrapper(SerializationTag tag)
       V8_WARN_UNUSED_RESULT;
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <optional>
 
+#include "hwy/highway.h"
 #include "src/ast/ast-value-factory.h"
 #include "src/base/strings.h"
 #include "src/numbers/conversions-inl.h"
@@ -222,6 +223,40 @@ Token::Value Scanner::PeekAheadAhead() {
   return next_next_next().token;
 }
 
+namespace {
+
+namespace hw = hwy::HWY_NAMESPACE;
+
+template <uint16_t kChar, uint16_t... kRest, typename D, typename V>
+auto EqualsAnyOf(D tag, V input) {
+  auto found = input == hw::Set(tag, kChar);
+  if constexpr (sizeof...(kRest) == 0) {
+    return found;
+  } else {
+    return hw::Or(found, EqualsAnyOf<kRest...>(tag, input));
+  }
+}
+
+// Returns the position of the first code unit of [start, end) that is one of
+// {kChars}, or {end}. Comments are usually long enough for most of them to be
+// skipped a block of code units at a time.
+template <uint16_t... kChars>
+const uint16_t* FindFirstOf(const uint16_t* start, const uint16_t* end) {
+  hw::FixedTag<uint16_t, 8> tag;
+  const size_t stride = hw::Lanes(tag);
+  for (; end - start >= static_cast<ptrdiff_t>(stride); start += stride) {
+    const auto found = EqualsAnyOf<kChars...>(tag, hw::LoadU(tag, start));
+    if (V8_LIKELY(hw::AllFalse(tag, found))) continue;
+    return start + hw::FindKnownFirstTrue(tag, found);
+  }
+  for (; start < end; ++start) {
+    if (((*start == kChars) || ...)) return start;
+  }
+  return end;
+}
+
+}  // namespace
+
 Token::Value Scanner::SkipSingleHTMLComment() {
   if (flags_.is_module()) {
     ReportScannerError(source_pos(), MessageTemplate::kHtmlCommentInModule);
@@ -236,7 +271,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntilFound(FindFirstOf<'\n', '\r', 0x2028, 0x2029>);
 
   return Token::kWhitespace;
 }
@@ -315,13 +350,10 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      // These are the characters for which
+      // MultilineCommentCharacterNeedsSlowPath holds, and the non-ASCII line
+      // terminators.
+      AdvanceUntilFound(FindFirstOf<'*', '\n', '\r', 0x2028, 0x2029>);
 
       while (c0_ == '*') {
         Advance();
@@ -340,7 +372,7 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilFound(FindFirstOf<'*'>);
 
     while (c0_ == '*') {
       Advance();
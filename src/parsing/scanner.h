@@ -75,12 +75,21 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE base::uc32 AdvanceUntil(FunctionType check) {
-    while (true) {
-      auto next_cursor_pos =
-          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
+    return AdvanceUntilFound(
+        [&check](const uint16_t* start, const uint16_t* end) {
+          return std::find_if(start, end, [&check](uint16_t raw_c0_) {
             base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
             return check(c0_);
           });
+        });
+  }
+
+  // Like AdvanceUntil, but {find} searches whole buffers at once: it returns
+  // the position of the first matching code unit in [start, end), or {end}.
+  template <typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntilFound(FunctionType find) {
+    while (true) {
+      const uint16_t* next_cursor_pos = find(buffer_cursor_, buffer_end_);
 
       if (next_cursor_pos == buffer_end_) {
         buffer_cursor_ = buffer_end_;
@@ -559,6 +568,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntilFound(FunctionType find) {
+    c0_ = source_->AdvanceUntilFound(find);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -6,58 +6,85 @@
 #define V8_PROFILER_CIRCULAR_QUEUE_INL_H_
 
 #include "src/profiler/circular-queue.h"
+#include "src/utils/allocation.h"
 
 namespace v8 {
 namespace internal {
 
-template<typename T, unsigned L>
-SamplingCircularQueue<T, L>::SamplingCircularQueue()
-    : enqueue_pos_(buffer_),
-      dequeue_pos_(buffer_) {
+template <typename T>
+SamplingCircularQueue<T>::SamplingCircularQueue(size_t length) {
+  AllocateBuffer(length);
 }
 
-template <typename T, unsigned L>
-SamplingCircularQueue<T, L>::~SamplingCircularQueue() = default;
+template <typename T>
+SamplingCircularQueue<T>::~SamplingCircularQueue() {
+  FreeBuffer();
+}
+
+template <typename T>
+void SamplingCircularQueue<T>::Resize(size_t length) {
+  DCHECK_NULL(Peek());
+  if (length == length_) return;
+  FreeBuffer();
+  AllocateBuffer(length);
+}
 
-template<typename T, unsigned L>
-T* SamplingCircularQueue<T, L>::Peek() {
-  base::SeqCst_MemoryFence();
+template <typename T>
+void SamplingCircularQueue<T>::AllocateBuffer(size_t length) {
+  DCHECK_LT(0, length);
+  buffer_ = static_cast<Entry*>(
+      AlignedAllocWithRetry(length * sizeof(Entry), alignof(Entry)));
+  for (size_t i = 0; i < length; ++i) new (&buffer_[i]) Entry();
+  length_ = length;
+  enqueue_pos_ = buffer_;
+  dequeue_pos_ = buffer_;
+}
+
+template <typename T>
+void SamplingCircularQueue<T>::FreeBuffer() {
+  for (size_t i = 0; i < length_; ++i) buffer_[i].~Entry();
+  AlignedFree(buffer_);
+  buffer_ = nullptr;
+  length_ = 0;
+}
+
+// There is a single producer and a single consumer, each of which only touches
+// an entry after observing the marker value stored by the other one. The
+// acquire loads and release stores of the markers therefore suffice to order
+// the accesses to the records.
+template <typename T>
+T* SamplingCircularQueue<T>::Peek() {
   if (base::Acquire_Load(&dequeue_pos_->marker) == kFull) {
     return &dequeue_pos_->record;
   }
   return nullptr;
 }
 
-
-template<typename T, unsigned L>
-void SamplingCircularQueue<T, L>::Remove() {
+template <typename T>
+void SamplingCircularQueue<T>::Remove() {
   base::Release_Store(&dequeue_pos_->marker, kEmpty);
   dequeue_pos_ = Next(dequeue_pos_);
 }
 
-
-template<typename T, unsigned L>
-T* SamplingCircularQueue<T, L>::StartEnqueue() {
-  base::SeqCst_MemoryFence();
+template <typename T>
+T* SamplingCircularQueue<T>::StartEnqueue() {
   if (base::Acquire_Load(&enqueue_pos_->marker) == kEmpty) {
     return &enqueue_pos_->record;
   }
   return nullptr;
 }
 
-
-template<typename T, unsigned L>
-void SamplingCircularQueue<T, L>::FinishEnqueue() {
+template <typename T>
+void SamplingCircularQueue<T>::FinishEnqueue() {
   base::Release_Store(&enqueue_pos_->marker, kFull);
   enqueue_pos_ = Next(enqueue_pos_);
 }
 
-
-template<typename T, unsigned L>
-typename SamplingCircularQueue<T, L>::Entry* SamplingCircularQueue<T, L>::Next(
+template <typename T>
+typename SamplingCircularQueue<T>::Entry* SamplingCircularQueue<T>::Next(
     Entry* entry) {
   Entry* next = entry + 1;
-  if (next == &buffer_[L]) return buffer_;
+  if (next == &buffer_[length_]) return buffer_;
   return next;
 }
 
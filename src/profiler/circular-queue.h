@@ -17,15 +17,23 @@ namespace internal {
 // StartEnqueue will return nullptr. The queue is designed with
 // a goal in mind to evade cache lines thrashing by preventing
 // simultaneous reads and writes to adjanced memory locations.
-template<typename T, unsigned Length>
+// The number of entries is chosen on construction and can only be changed
+// while neither the producer nor the consumer is active, because the
+// producer may run in a signal handler and must not allocate.
+template <typename T>
 class SamplingCircularQueue {
  public:
   // Executed on the application thread.
-  SamplingCircularQueue();
+  explicit SamplingCircularQueue(size_t length);
   ~SamplingCircularQueue();
   SamplingCircularQueue(const SamplingCircularQueue&) = delete;
   SamplingCircularQueue& operator=(const SamplingCircularQueue&) = delete;
 
+  // Replaces the entries by |length| empty ones. Must only be called while
+  // the queue is empty and no producer or consumer is running.
+  void Resize(size_t length);
+  size_t length() const { return length_; }
+
   // StartEnqueue returns a pointer to a memory location for storing the next
   // record or nullptr if all entries are full at the moment.
   T* StartEnqueue();
@@ -55,13 +63,15 @@ class SamplingCircularQueue {
   };
 
   Entry* Next(Entry* entry);
+  void AllocateBuffer(size_t length);
+  void FreeBuffer();
 
-  Entry buffer_[Length];
+  Entry* buffer_ = nullptr;
+  size_t length_ = 0;
   alignas(PROCESSOR_CACHE_LINE_SIZE) Entry* enqueue_pos_;
   alignas(PROCESSOR_CACHE_LINE_SIZE) Entry* dequeue_pos_;
 };
 
-
 }  // namespace internal
 }  // namespace v8
 
@@ -4,6 +4,7 @@
 
 #include "src/profiler/cpu-profiler.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
@@ -51,6 +52,11 @@ class CpuSampler : public sampler::Sampler {
 #if V8_HEAP_USE_PKU_JIT_WRITE_PROTECT
     i::RwxMemoryWriteScope::SetDefaultPermissionsForSignalHandler();
 #endif
+#ifdef V8_RUNTIME_CALL_STATS
+    if (V8_UNLIKELY(RuntimeCallStats::IsSamplingEnabled())) {
+      isolate->counters()->runtime_call_stats()->RecordSample();
+    }
+#endif  // V8_RUNTIME_CALL_STATS
     TickSample* sample = processor_->StartTickSample();
     if (sample == nullptr) {
       ProfilerStats::Instance()->AddReason(
@@ -126,6 +132,7 @@ SamplingEventsProcessor::SamplingEventsProcessor(
     ProfilerCodeObserver* code_observer, CpuProfilesCollection* profiles,
     base::TimeDelta period, bool use_precise_sampling)
     : ProfilerEventsProcessor(isolate, symbolizer, code_observer, profiles),
+      ticks_buffer_(TickSampleQueueLength(period)),
       sampler_(new CpuSampler(isolate, this)),
       period_(period),
       use_precise_sampling_(use_precise_sampling) {
@@ -134,10 +141,26 @@ SamplingEventsProcessor::SamplingEventsProcessor(
 #endif  // V8_OS_WIN
 
   sampler_->Start();
+  if (v8_flags.cpu_profiler_cpu_time_sampling) {
+    sampler_->StartCpuTimeSampling(period);
+  }
 }
 
 SamplingEventsProcessor::~SamplingEventsProcessor() { sampler_->Stop(); }
 
+// static
+size_t SamplingEventsProcessor::TickSampleQueueLength(base::TimeDelta period) {
+  constexpr size_t kMinLength =
+      kMinTickSampleBufferSize / sizeof(TickSampleEventRecord);
+  constexpr size_t kMaxLength =
+      kMaxTickSampleBufferSize / sizeof(TickSampleEventRecord);
+  if (period <= base::TimeDelta()) return kMaxLength;
+  const size_t length =
+      static_cast<size_t>(kTickSampleBufferTime.InMicroseconds() /
+                          std::max<int64_t>(period.InMicroseconds(), 1));
+  return std::clamp(length, kMinLength, kMaxLength);
+}
+
 ProfilerEventsProcessor::~ProfilerEventsProcessor() {
   DCHECK_EQ(code_observer_->processor(), this);
   code_observer_->clear_processor();
@@ -343,6 +366,13 @@ void SamplingEventsProcessor::SetSamplingInterval(base::TimeDelta period) {
   StopSynchronously();
 
   period_ = period;
+  // The processor thread has drained the buffer and there is no producer
+  // while it is stopped, so the buffer can be resized for the new rate. A CPU
+  // time timer would still produce samples, so it is stopped meanwhile.
+  const bool cpu_time_sampling = sampler_->IsCpuTimeSampling();
+  sampler_->StopCpuTimeSampling();
+  ticks_buffer_.Resize(TickSampleQueueLength(period));
+  if (cpu_time_sampling) sampler_->StartCpuTimeSampling(period);
   running_.store(true, std::memory_order_relaxed);
 
   CHECK(StartSynchronously());
@@ -700,6 +730,12 @@ CpuProfile* CpuProfiler::StopProfiling(ProfilerId id) {
   return profile;
 }
 
+bool CpuProfiler::TakeProfileChunk(
+    ProfilerId id, std::vector<const ProfileNode*>* nodes,
+    std::vector<CpuProfile::SampleInfo>* samples) {
+  return profiles_->TakeProfileChunk(id, nodes, samples);
+}
+
 CpuProfile* CpuProfiler::StopProfiling(Tagged<String> title) {
   return StopProfiling(profiles_->GetName(title));
 }
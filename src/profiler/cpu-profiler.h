@@ -250,11 +250,17 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   SampleProcessingResult ProcessOneSample() override;
   void SymbolizeAndAddToProfiles(const TickSampleEventRecord* record);
 
-  static const size_t kTickSampleBufferSize = 512 * KB;
-  static const size_t kTickSampleQueueLength =
-      kTickSampleBufferSize / sizeof(TickSampleEventRecord);
-  SamplingCircularQueue<TickSampleEventRecord,
-                        kTickSampleQueueLength> ticks_buffer_;
+  // The ticks buffer holds the samples of at least kTickSampleBufferTime, so
+  // that short stalls of the processor thread (e.g. on code events) don't
+  // drop samples at high sampling rates. Its size is bounded by
+  // [kMinTickSampleBufferSize, kMaxTickSampleBufferSize].
+  static constexpr base::TimeDelta kTickSampleBufferTime =
+      base::TimeDelta::FromMilliseconds(100);
+  static const size_t kMinTickSampleBufferSize = 512 * KB;
+  static const size_t kMaxTickSampleBufferSize = 16 * MB;
+  static size_t TickSampleQueueLength(base::TimeDelta period);
+
+  SamplingCircularQueue<TickSampleEventRecord> ticks_buffer_;
   std::unique_ptr<sampler::Sampler> sampler_;
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
@@ -368,6 +374,9 @@ class V8_EXPORT_PRIVATE CpuProfiler {
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(Tagged<String> title);
   CpuProfile* StopProfiling(ProfilerId id);
+  bool TakeProfileChunk(ProfilerId id,
+                        std::vector<const ProfileNode*>* nodes,
+                        std::vector<CpuProfile::SampleInfo>* samples);
 
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
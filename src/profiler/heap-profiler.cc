@@ -140,6 +140,43 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
       snapshots_.emplace_back(result);
     }
   });
+  FinishTakingSnapshot();
+
+  return result;
+}
+
+bool HeapProfiler::TakeSnapshotToStream(
+    const v8::HeapProfiler::HeapSnapshotOptions options,
+    v8::OutputStream* stream) {
+  is_taking_snapshot_ = true;
+  bool result = false;
+
+  heap()->stack().SetMarkerIfNeededAndCallback([this, &options, stream,
+                                                &result]() {
+    HeapSnapshot snapshot(this, options.snapshot_mode, options.numerics_mode);
+    std::optional<CppClassNamesAsHeapObjectNameScope> use_cpp_class_name;
+    if (snapshot.expose_internals() && heap()->cpp_heap()) {
+      use_cpp_class_name.emplace(heap()->cpp_heap());
+    }
+
+    // Edges are written out as they are discovered. Only the nodes are kept
+    // until the graph is complete.
+    HeapSnapshotBinarySerializer serializer(&snapshot, stream);
+    serializer.SerializeHeader();
+    snapshot.set_streaming_serializer(&serializer);
+    HeapSnapshotGenerator generator(&snapshot, options.control,
+                                    options.global_object_name_resolver, heap(),
+                                    options.stack_state);
+    if (!generator.GenerateSnapshot()) return;
+    serializer.SerializeNodesAndFinalize();
+    result = !serializer.aborted();
+  });
+  FinishTakingSnapshot();
+
+  return result;
+}
+
+void HeapProfiler::FinishTakingSnapshot() {
   ids_->RemoveDeadEntries();
   if (native_move_listener_) {
     native_move_listener_->StartListening();
@@ -147,8 +184,6 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   is_tracking_object_moves_ = true;
   heap()->isolate()->UpdateLogObjectRelocation();
   is_taking_snapshot_ = false;
-
-  return result;
 }
 
 class FileOutputStream : public v8::OutputStream {
@@ -62,6 +62,10 @@ class HeapProfiler : public HeapObjectAllocationTracker {
 
   HeapSnapshot* TakeSnapshot(
       const v8::HeapProfiler::HeapSnapshotOptions options);
+  // Writes the snapshot to |stream| in the binary format while it is being
+  // generated. The snapshot is not retained.
+  bool TakeSnapshotToStream(const v8::HeapProfiler::HeapSnapshotOptions options,
+                            v8::OutputStream* stream);
 
   // Implementation of --heap-snapshot-on-oom.
   void WriteSnapshotToDiskAfterGC(
@@ -141,6 +145,7 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   }
 
  private:
+  void FinishTakingSnapshot();
   void MaybeClearStringsStorage();
 
   Heap* heap() const;
@@ -4,6 +4,7 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <atomic>
 #include <optional>
 #include <utility>
 
@@ -19,6 +20,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/safepoint.h"
 #include "src/heap/visit-object.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -293,7 +295,7 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type, const char* name,
                                   HeapSnapshotGenerator* generator,
                                   ReferenceVerification verification) {
   ++children_count_;
-  snapshot_->edges().emplace_back(type, name, this, entry);
+  snapshot_->AddEdge(type, name, this, entry);
   VerifyReference(type, entry, generator, verification);
 }
 
@@ -302,7 +304,7 @@ void HeapEntry::SetIndexedReference(HeapGraphEdge::Type type, int index,
                                     HeapSnapshotGenerator* generator,
                                     ReferenceVerification verification) {
   ++children_count_;
-  snapshot_->edges().emplace_back(type, index, this, entry);
+  snapshot_->AddEdge(type, index, this, entry);
   VerifyReference(type, entry, generator, verification);
 }
 
@@ -486,6 +488,24 @@ HeapEntry* HeapSnapshot::AddEntry(HeapEntry::Type type, const char* name,
   return &entries_.back();
 }
 
+void HeapSnapshot::AddEdge(HeapGraphEdge::Type type, const char* name,
+                           HeapEntry* from, HeapEntry* to) {
+  if (streaming_serializer_) {
+    streaming_serializer_->SerializeEdge(HeapGraphEdge(type, name, from, to));
+    return;
+  }
+  edges_.emplace_back(type, name, from, to);
+}
+
+void HeapSnapshot::AddEdge(HeapGraphEdge::Type type, int index,
+                           HeapEntry* from, HeapEntry* to) {
+  if (streaming_serializer_) {
+    streaming_serializer_->SerializeEdge(HeapGraphEdge(type, index, from, to));
+    return;
+  }
+  edges_.emplace_back(type, index, from, to);
+}
+
 void HeapSnapshot::AddScriptLineEnds(int script_id,
                                      String::LineEndsVector&& line_ends) {
   scripts_line_ends_map_.emplace(script_id, std::move(line_ends));
@@ -498,6 +518,8 @@ String::LineEndsVector& HeapSnapshot::GetScriptLineEnds(int script_id) {
 }
 
 void HeapSnapshot::FillChildren() {
+  // Edges have already been written out.
+  if (streaming_serializer_) return;
   DCHECK(children().empty());
   int children_index = 0;
   for (HeapEntry& entry : entries()) {
@@ -576,10 +598,8 @@ HeapObjectsMap::HeapObjectsMap(Heap* heap)
     : next_id_(kFirstAvailableObjectId),
       next_native_id_(kFirstAvailableNativeId),
       heap_(heap) {
-  // The dummy element at zero index is needed as entries_map_ cannot hold
-  // an entry with zero value. Otherwise it's impossible to tell if
-  // LookupOrInsert has added a new item or just returning exisiting one
-  // having the value of zero.
+  // The dummy element at zero index keeps index zero reserved, so that no
+  // entry of entries_map_ ever refers to it.
   entries_.emplace_back(0, kNullAddress, 0, true);
 }
 
@@ -587,47 +607,41 @@ bool HeapObjectsMap::MoveObject(Address from, Address to, int object_size) {
   DCHECK_NE(kNullAddress, to);
   DCHECK_NE(kNullAddress, from);
   if (from == to) return false;
-  void* from_value = entries_map_.Remove(reinterpret_cast<void*>(from),
-                                         ComputeAddressHash(from));
-  if (from_value == nullptr) {
+  auto from_it = entries_map_.find(from);
+  if (from_it == entries_map_.end()) {
     // It may occur that some untracked object moves to an address X and there
     // is a tracked object at that address. In this case we should remove the
     // entry as we know that the object has died.
-    void* to_value = entries_map_.Remove(reinterpret_cast<void*>(to),
-                                         ComputeAddressHash(to));
-    if (to_value != nullptr) {
-      int to_entry_info_index =
-          static_cast<int>(reinterpret_cast<intptr_t>(to_value));
-      entries_.at(to_entry_info_index).addr = kNullAddress;
+    auto to_it = entries_map_.find(to);
+    if (to_it != entries_map_.end()) {
+      entries_.at(to_it->second).addr = kNullAddress;
+      entries_map_.erase(to_it);
     }
-  } else {
-    base::HashMap::Entry* to_entry = entries_map_.LookupOrInsert(
-        reinterpret_cast<void*>(to), ComputeAddressHash(to));
-    if (to_entry->value != nullptr) {
-      // We found the existing entry with to address for an old object.
-      // Without this operation we will have two EntryInfo's with the same
-      // value in addr field. It is bad because later at RemoveDeadEntries
-      // one of this entry will be removed with the corresponding entries_map_
-      // entry.
-      int to_entry_info_index =
-          static_cast<int>(reinterpret_cast<intptr_t>(to_entry->value));
-      entries_.at(to_entry_info_index).addr = kNullAddress;
-    }
-    int from_entry_info_index =
-        static_cast<int>(reinterpret_cast<intptr_t>(from_value));
-    entries_.at(from_entry_info_index).addr = to;
-    // Size of an object can change during its life, so to keep information
-    // about the object in entries_ consistent, we have to adjust size when the
-    // object is migrated.
-    if (v8_flags.heap_profiler_trace_objects) {
-      PrintF("Move object from %p to %p old size %6d new size %6d\n",
-             reinterpret_cast<void*>(from), reinterpret_cast<void*>(to),
-             entries_.at(from_entry_info_index).size, object_size);
-    }
-    entries_.at(from_entry_info_index).size = object_size;
-    to_entry->value = from_value;
+    return false;
+  }
+  size_t from_entry_info_index = from_it->second;
+  entries_map_.erase(from_it);
+  auto [to_it, inserted] = entries_map_.try_emplace(to, from_entry_info_index);
+  if (!inserted) {
+    // We found the existing entry with to address for an old object.
+    // Without this operation we will have two EntryInfo's with the same
+    // value in addr field. It is bad because later at RemoveDeadEntries
+    // one of this entry will be removed with the corresponding entries_map_
+    // entry.
+    entries_.at(to_it->second).addr = kNullAddress;
+    to_it->second = from_entry_info_index;
+  }
+  entries_.at(from_entry_info_index).addr = to;
+  // Size of an object can change during its life, so to keep information
+  // about the object in entries_ consistent, we have to adjust size when the
+  // object is migrated.
+  if (v8_flags.heap_profiler_trace_objects) {
+    PrintF("Move object from %p to %p old size %6d new size %6d\n",
+           reinterpret_cast<void*>(from), reinterpret_cast<void*>(to),
+           entries_.at(from_entry_info_index).size, object_size);
   }
-  return from_value != nullptr;
+  entries_.at(from_entry_info_index).size = object_size;
+  return true;
 }
 
 void HeapObjectsMap::UpdateObjectSize(Address addr, int size) {
@@ -635,12 +649,10 @@ void HeapObjectsMap::UpdateObjectSize(Address addr, int size) {
 }
 
 SnapshotObjectId HeapObjectsMap::FindEntry(Address addr) {
-  base::HashMap::Entry* entry = entries_map_.Lookup(
-      reinterpret_cast<void*>(addr), ComputeAddressHash(addr));
-  if (entry == nullptr) return v8::HeapProfiler::kUnknownObjectId;
-  int entry_index = static_cast<int>(reinterpret_cast<intptr_t>(entry->value));
-  EntryInfo& entry_info = entries_.at(entry_index);
-  DCHECK(static_cast<uint32_t>(entries_.size()) > entries_map_.occupancy());
+  auto it = entries_map_.find(addr);
+  if (it == entries_map_.end()) return v8::HeapProfiler::kUnknownObjectId;
+  EntryInfo& entry_info = entries_.at(it->second);
+  DCHECK_GT(entries_.size(), entries_map_.size());
   return entry_info.id;
 }
 
@@ -649,13 +661,10 @@ SnapshotObjectId HeapObjectsMap::FindOrAddEntry(
     IsNativeObject is_native_object) {
   bool accessed_bool = accessed == MarkEntryAccessed::kYes;
   bool is_native_object_bool = is_native_object == IsNativeObject::kYes;
-  DCHECK(static_cast<uint32_t>(entries_.size()) > entries_map_.occupancy());
-  base::HashMap::Entry* entry = entries_map_.LookupOrInsert(
-      reinterpret_cast<void*>(addr), ComputeAddressHash(addr));
-  if (entry->value != nullptr) {
-    int entry_index =
-        static_cast<int>(reinterpret_cast<intptr_t>(entry->value));
-    EntryInfo& entry_info = entries_.at(entry_index);
+  DCHECK_GT(entries_.size(), entries_map_.size());
+  auto [it, inserted] = entries_map_.try_emplace(addr, entries_.size());
+  if (!inserted) {
+    EntryInfo& entry_info = entries_.at(it->second);
     entry_info.accessed = accessed_bool;
     if (v8_flags.heap_profiler_trace_objects) {
       PrintF("Update object size : %p with old size %d and new size %d\n",
@@ -665,11 +674,10 @@ SnapshotObjectId HeapObjectsMap::FindOrAddEntry(
     DCHECK_EQ(is_native_object_bool, entry_info.id % 2 == 0);
     return entry_info.id;
   }
-  entry->value = reinterpret_cast<void*>(entries_.size());
   SnapshotObjectId id =
       is_native_object_bool ? get_next_native_id() : get_next_id();
   entries_.push_back(EntryInfo(id, addr, size, accessed_bool));
-  DCHECK(static_cast<uint32_t>(entries_.size()) > entries_map_.occupancy());
+  DCHECK_GT(entries_.size(), entries_map_.size());
   return id;
 }
 
@@ -682,13 +690,11 @@ SnapshotObjectId HeapObjectsMap::FindMergedNativeEntry(NativeObject addr) {
 
 void HeapObjectsMap::AddMergedNativeEntry(NativeObject addr,
                                           Address canonical_addr) {
-  base::HashMap::Entry* entry =
-      entries_map_.Lookup(reinterpret_cast<void*>(canonical_addr),
-                          ComputeAddressHash(canonical_addr));
-  auto result = merged_native_entries_map_.insert(
-      {addr, reinterpret_cast<size_t>(entry->value)});
+  auto it = entries_map_.find(canonical_addr);
+  DCHECK_NE(it, entries_map_.end());
+  auto result = merged_native_entries_map_.insert({addr, it->second});
   if (!result.second) {
-    result.first->second = reinterpret_cast<size_t>(entry->value);
+    result.first->second = it->second;
   }
 }
 
@@ -696,8 +702,8 @@ void HeapObjectsMap::StopHeapObjectsTracking() { time_intervals_.clear(); }
 
 void HeapObjectsMap::UpdateHeapObjectsMap() {
   if (v8_flags.heap_profiler_trace_objects) {
-    PrintF("Begin HeapObjectsMap::UpdateHeapObjectsMap. map has %d entries.\n",
-           entries_map_.occupancy());
+    PrintF("Begin HeapObjectsMap::UpdateHeapObjectsMap. map has %zu entries.\n",
+           entries_map_.size());
   }
   heap_->PreciseCollectAllGarbage(GCFlag::kNoFlags,
                                   GarbageCollectionReason::kHeapProfiler);
@@ -715,8 +721,8 @@ void HeapObjectsMap::UpdateHeapObjectsMap() {
   }
   RemoveDeadEntries();
   if (v8_flags.heap_profiler_trace_objects) {
-    PrintF("End HeapObjectsMap::UpdateHeapObjectsMap. map has %d entries.\n",
-           entries_map_.occupancy());
+    PrintF("End HeapObjectsMap::UpdateHeapObjectsMap. map has %zu entries.\n",
+           entries_map_.size());
   }
 }
 
@@ -791,11 +797,9 @@ void HeapObjectsMap::RemoveDeadEntries() {
         entries_.at(first_free_entry) = entry_info;
       }
       entries_.at(first_free_entry).accessed = false;
-      base::HashMap::Entry* entry =
-          entries_map_.Lookup(reinterpret_cast<void*>(entry_info.addr),
-                              ComputeAddressHash(entry_info.addr));
-      DCHECK(entry);
-      entry->value = reinterpret_cast<void*>(first_free_entry);
+      auto map_it = entries_map_.find(entry_info.addr);
+      DCHECK_NE(map_it, entries_map_.end());
+      map_it->second = first_free_entry;
       if (merged_reverse_it != reverse_merged_native_entries_map.end()) {
         auto it = merged_native_entries_map_.find(merged_reverse_it->second);
         DCHECK_NE(merged_native_entries_map_.end(), it);
@@ -804,8 +808,7 @@ void HeapObjectsMap::RemoveDeadEntries() {
       ++first_free_entry;
     } else {
       if (entry_info.addr) {
-        entries_map_.Remove(reinterpret_cast<void*>(entry_info.addr),
-                            ComputeAddressHash(entry_info.addr));
+        entries_map_.erase(entry_info.addr);
         if (merged_reverse_it != reverse_merged_native_entries_map.end()) {
           merged_native_entries_map_.erase(merged_reverse_it->second);
         }
@@ -814,8 +817,7 @@ void HeapObjectsMap::RemoveDeadEntries() {
   }
   entries_.erase(entries_.begin() + first_free_entry, entries_.end());
 
-  DCHECK(static_cast<uint32_t>(entries_.size()) - 1 ==
-         entries_map_.occupancy());
+  DCHECK_EQ(entries_.size() - 1, entries_map_.size());
 }
 
 V8HeapExplorer::V8HeapExplorer(HeapSnapshot* snapshot,
@@ -1163,6 +1165,45 @@ HeapEntry::Type V8HeapExplorer::GetSystemEntryType(Tagged<HeapObject> object) {
   return HeapEntry::kHidden;
 }
 
+namespace {
+
+// Computes the line ends of flat script sources on worker threads. The
+// characters must stay in place until the job has been joined.
+class LineEndsJob final : public JobTask {
+ public:
+  struct Source {
+    base::Vector<const uint8_t> one_byte_chars;
+    base::Vector<const base::uc16> two_byte_chars;
+    String::LineEndsVector* line_ends;
+  };
+
+  explicit LineEndsJob(base::Vector<const Source> sources)
+      : sources_(sources) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_source_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= sources_.size()) return;
+      const Source& source = sources_[index];
+      *source.line_ends =
+          source.two_byte_chars.empty()
+              ? String::CalculateLineEndsVector(source.one_byte_chars, true)
+              : String::CalculateLineEndsVector(source.two_byte_chars, true);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_source = next_source_.load(std::memory_order_relaxed);
+    return next_source < sources_.size() ? sources_.size() - next_source : 0;
+  }
+
+ private:
+  const base::Vector<const Source> sources_;
+  std::atomic<size_t> next_source_{0};
+};
+
+}  // namespace
+
 void V8HeapExplorer::PopulateLineEnds() {
   std::vector<Handle<Script>> scripts;
   HandleScope scope(isolate());
@@ -1177,9 +1218,39 @@ void V8HeapExplorer::PopulateLineEnds() {
     }
   }
 
-  for (auto& script : scripts) {
-    snapshot_->AddScriptLineEnds(script->id(),
-                                 Script::GetLineEnds(isolate(), script));
+  // Flatten all sources before looking at their characters, as flattening
+  // may allocate and thereby move sources that were flattened before.
+  std::vector<Handle<String>> sources(scripts.size());
+  for (size_t i = 0; i < scripts.size(); i++) {
+    Tagged<Object> source = scripts[i]->source();
+    if (!IsString(source)) continue;
+    sources[i] =
+        String::Flatten(isolate(), handle(Cast<String>(source), isolate()));
+  }
+
+  // Scripts without a source have no line ends.
+  std::vector<String::LineEndsVector> line_ends(scripts.size());
+  {
+    DisallowGarbageCollection no_gc;
+    std::vector<LineEndsJob::Source> flat_sources;
+    for (size_t i = 0; i < scripts.size(); i++) {
+      if (sources[i].is_null()) continue;
+      String::FlatContent content = sources[i]->GetFlatContent(no_gc);
+      DCHECK(content.IsFlat());
+      if (content.IsOneByte()) {
+        flat_sources.push_back({content.ToOneByteVector(), {}, &line_ends[i]});
+      } else {
+        flat_sources.push_back({{}, content.ToUC16Vector(), &line_ends[i]});
+      }
+    }
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<LineEndsJob>(base::VectorOf(flat_sources)))
+        ->Join();
+  }
+
+  for (size_t i = 0; i < scripts.size(); i++) {
+    snapshot_->AddScriptLineEnds(scripts[i]->id(), std::move(line_ends[i]));
   }
 }
 
@@ -3277,6 +3348,10 @@ void HeapSnapshotGenerator::ProgressStep() {
 }
 
 bool HeapSnapshotGenerator::ProgressReport(bool force) {
+  if (snapshot_->streaming_serializer() &&
+      snapshot_->streaming_serializer()->aborted()) {
+    return false;
+  }
   const int kProgressReportGranularity = 10000;
   if (control_ != nullptr &&
       (force || progress_counter_ % kProgressReportGranularity == 0)) {
@@ -3800,4 +3875,96 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+HeapSnapshotBinarySerializer::HeapSnapshotBinarySerializer(
+    HeapSnapshot* snapshot, v8::OutputStream* stream)
+    : snapshot_(snapshot),
+      writer_(std::make_unique<OutputStreamWriter>(stream)) {}
+
+HeapSnapshotBinarySerializer::~HeapSnapshotBinarySerializer() = default;
+
+bool HeapSnapshotBinarySerializer::aborted() const {
+  return writer_->aborted();
+}
+
+void HeapSnapshotBinarySerializer::Serialize() {
+  DCHECK(snapshot_->is_complete());
+  SerializeHeader();
+  for (const HeapGraphEdge& edge : snapshot_->edges()) {
+    SerializeEdge(edge);
+    if (aborted()) return;
+  }
+  SerializeNodesAndFinalize();
+}
+
+void HeapSnapshotBinarySerializer::SerializeHeader() {
+  writer_->AddBytes(kMagic, sizeof(kMagic) - 1);
+  WriteVarint(kVersion);
+}
+
+void HeapSnapshotBinarySerializer::SerializeEdge(const HeapGraphEdge& edge) {
+  const uint32_t name_or_index = edge.type() == HeapGraphEdge::kElement ||
+                                         edge.type() == HeapGraphEdge::kHidden
+                                     ? static_cast<uint32_t>(edge.index())
+                                     : GetStringId(edge.name());
+  WriteTag(kEdge);
+  WriteVarint(edge.type());
+  WriteVarint(name_or_index);
+  WriteVarint(static_cast<uint32_t>(edge.from()->index()));
+  WriteVarint(static_cast<uint32_t>(edge.to()->index()));
+}
+
+void HeapSnapshotBinarySerializer::SerializeNodesAndFinalize() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  for (const HeapEntry& entry : snapshot_->entries()) {
+    const uint32_t name = GetStringId(entry.name());
+    WriteTag(kNode);
+    WriteVarint(entry.type());
+    WriteVarint(name);
+    WriteVarint(entry.id());
+    WriteVarint(entry.self_size());
+    WriteVarint(entry.trace_node_id());
+    WriteVarint(entry.detachedness());
+    if (aborted()) return;
+  }
+  for (const EntrySourceLocation& location : snapshot_->locations()) {
+    WriteTag(kLocation);
+    WriteVarint(static_cast<uint32_t>(location.entry_index));
+    WriteVarint(static_cast<uint32_t>(location.scriptId));
+    WriteVarint(static_cast<uint32_t>(location.line));
+    WriteVarint(static_cast<uint32_t>(location.col));
+  }
+  WriteTag(kEnd);
+  writer_->Finalize();
+}
+
+uint32_t HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  auto [it, inserted] = strings_.emplace(
+      std::string_view(s), static_cast<uint32_t>(strings_.size()));
+  if (inserted) {
+    // Strings are numbered implicitly by their first occurrence.
+    WriteTag(kString);
+    WriteVarint(it->first.size());
+    writer_->AddBytes(it->first.data(), static_cast<int>(it->first.size()));
+  }
+  return it->second;
+}
+
+void HeapSnapshotBinarySerializer::WriteTag(RecordTag tag) {
+  const char byte = static_cast<char>(tag);
+  writer_->AddBytes(&byte, 1);
+}
+
+void HeapSnapshotBinarySerializer::WriteVarint(uint64_t value) {
+  // Unsigned LEB128.
+  char buffer[10];
+  int length = 0;
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value != 0) byte |= 0x80;
+    buffer[length++] = static_cast<char>(byte);
+  } while (value != 0);
+  writer_->AddBytes(buffer, length);
+}
+
 }  // namespace v8::internal
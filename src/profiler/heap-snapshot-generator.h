@@ -8,10 +8,12 @@
 #include <deque>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "include/v8-profiler.h"
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
@@ -36,6 +38,7 @@ class AllocationTraceNode;
 class HeapEntry;
 class HeapProfiler;
 class HeapSnapshot;
+class HeapSnapshotBinarySerializer;
 class HeapSnapshotGenerator;
 class IsolateSafepointScope;
 class JSArrayBuffer;
@@ -264,9 +267,24 @@ class HeapSnapshot {
                       size_t size,
                       unsigned trace_node_id);
   void AddSyntheticRootEntries();
+  void AddEdge(HeapGraphEdge::Type type, const char* name, HeapEntry* from,
+               HeapEntry* to);
+  void AddEdge(HeapGraphEdge::Type type, int index, HeapEntry* from,
+               HeapEntry* to);
   HeapEntry* GetEntryById(SnapshotObjectId id);
   void FillChildren();
 
+  // While a streaming serializer is attached, edges are handed to it as they
+  // are added instead of being stored in the snapshot. Such a snapshot never
+  // becomes complete.
+  void set_streaming_serializer(HeapSnapshotBinarySerializer* serializer) {
+    DCHECK(edges_.empty());
+    streaming_serializer_ = serializer;
+  }
+  HeapSnapshotBinarySerializer* streaming_serializer() const {
+    return streaming_serializer_;
+  }
+
   void AddScriptLineEnds(int script_id, String::LineEndsVector&& line_ends);
   String::LineEndsVector& GetScriptLineEnds(int script_id);
 
@@ -293,6 +311,7 @@ class HeapSnapshot {
   v8::HeapProfiler::HeapSnapshotMode snapshot_mode_;
   v8::HeapProfiler::NumericsMode numerics_mode_;
   size_t extra_native_bytes_ = 0;
+  HeapSnapshotBinarySerializer* streaming_serializer_ = nullptr;
 
   // The ScriptsLineEndsMap instance stores the line ends of scripts that did
   // not get their line_ends() information populated in heap.
@@ -378,8 +397,8 @@ class HeapObjectsMap {
 
   SnapshotObjectId next_id_;
   SnapshotObjectId next_native_id_;
-  // TODO(jkummerow): Use a map that uses {Address} as the key type.
-  base::HashMap entries_map_;
+  // Map from object address to EntryInfo index in entries_.
+  absl::flat_hash_map<Address, size_t> entries_map_;
   std::vector<EntryInfo> entries_;
   std::vector<TimeInterval> time_intervals_;
   // Map from NativeObject to EntryInfo index in entries_.
@@ -637,7 +656,7 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
  public:
   // The HeapEntriesMap instance is used to track a mapping between
   // real heap objects and their representations in heap snapshots.
-  using HeapEntriesMap = base::HashMap;
+  using HeapEntriesMap = absl::flat_hash_map<HeapThing, HeapEntry*>;
   // The SmiEntriesMap instance is used to track a mapping between smi and
   // their representations in heap snapshots.
   using SmiEntriesMap = std::unordered_map<int, HeapEntry*>;
@@ -651,9 +670,8 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
   bool GenerateSnapshotAfterGC();
 
   HeapEntry* FindEntry(HeapThing ptr) {
-    HeapEntriesMap::Entry* entry =
-        entries_map_.Lookup(ptr, ComputePointerHash(ptr));
-    return entry ? static_cast<HeapEntry*>(entry->value) : nullptr;
+    auto it = entries_map_.find(ptr);
+    return it != entries_map_.end() ? it->second : nullptr;
   }
 
   HeapEntry* FindEntry(Tagged<Smi> smi) {
@@ -684,13 +702,10 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
   }
 
   HeapEntry* FindOrAddEntry(HeapThing ptr, HeapEntriesAllocator* allocator) {
-    HeapEntriesMap::Entry* entry =
-        entries_map_.LookupOrInsert(ptr, ComputePointerHash(ptr));
-    if (entry->value != nullptr) {
-      return static_cast<HeapEntry*>(entry->value);
-    }
+    auto [it, inserted] = entries_map_.try_emplace(ptr, nullptr);
+    if (!inserted) return it->second;
     HeapEntry* result = allocator->AllocateEntry(ptr);
-    entry->value = result;
+    it->second = result;
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
     if (v8_flags.heap_snapshot_verify) {
       reverse_entries_map_.emplace(result, ptr);
@@ -787,6 +802,51 @@ class HeapSnapshotJSONSerializer {
   friend class HeapSnapshotJSONSerializerIterator;
 };
 
+// Writes a snapshot in the binary format described at
+// v8::HeapSnapshot::Serialize(). Because edges precede nodes in this format,
+// the serializer can also be attached to a snapshot that is being generated,
+// see HeapSnapshot::set_streaming_serializer().
+class HeapSnapshotBinarySerializer {
+ public:
+  HeapSnapshotBinarySerializer(HeapSnapshot* snapshot,
+                               v8::OutputStream* stream);
+  ~HeapSnapshotBinarySerializer();
+  HeapSnapshotBinarySerializer(const HeapSnapshotBinarySerializer&) = delete;
+  HeapSnapshotBinarySerializer& operator=(const HeapSnapshotBinarySerializer&) =
+      delete;
+
+  // Serializes a complete snapshot.
+  void Serialize();
+
+  // Streaming mode: SerializeHeader(), then SerializeEdge() for every edge as
+  // it is discovered, then SerializeNodesAndFinalize() once the graph is done.
+  void SerializeHeader();
+  void SerializeEdge(const HeapGraphEdge& edge);
+  void SerializeNodesAndFinalize();
+
+  bool aborted() const;
+
+  static constexpr char kMagic[] = "V8HS";
+  static constexpr uint32_t kVersion = 1;
+
+  enum RecordTag : uint8_t {
+    kEnd = 0,
+    kString = 1,
+    kEdge = 2,
+    kNode = 3,
+    kLocation = 4,
+  };
+
+ private:
+  uint32_t GetStringId(const char* s);
+  void WriteTag(RecordTag tag);
+  void WriteVarint(uint64_t value);
+
+  HeapSnapshot* snapshot_;
+  std::unique_ptr<OutputStreamWriter> writer_;
+  std::unordered_map<std::string_view, uint32_t> strings_;
+};
+
 }  // namespace v8::internal
 
 #endif  // V8_PROFILER_HEAP_SNAPSHOT_GENERATOR_H_
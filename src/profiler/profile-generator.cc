@@ -471,6 +471,36 @@ ProfileTree::~ProfileTree() {
   TraverseDepthFirst(&cb);
 }
 
+class CollectNodesCallback {
+ public:
+  explicit CollectNodesCallback(std::vector<const ProfileNode*>* nodes)
+      : nodes_(nodes) {}
+
+  void BeforeTraversingChild(ProfileNode*, ProfileNode* child) {
+    nodes_->push_back(child);
+  }
+
+  void AfterAllChildrenTraversed(ProfileNode*) {}
+
+  void AfterChildTraversed(ProfileNode*, ProfileNode*) {}
+
+ private:
+  std::vector<const ProfileNode*>* nodes_;
+};
+
+std::vector<const ProfileNode*> ProfileTree::TakeNewNodes() {
+  std::vector<const ProfileNode*> nodes;
+  if (track_new_nodes_) {
+    nodes.swap(new_nodes_);
+    return nodes;
+  }
+  track_new_nodes_ = true;
+  nodes.push_back(root_);
+  CollectNodesCallback cb(&nodes);
+  TraverseDepthFirst(&cb);
+  return nodes;
+}
+
 ProfileNode* ProfileTree::AddPathFromEnd(const std::vector<CodeEntry*>& path,
                                          int src_line, bool update_stats) {
   ProfileNode* node = root_;
@@ -576,6 +606,7 @@ CpuProfile::CpuProfile(CpuProfiler* profiler, ProfilerId id, const char* title,
       options_(std::move(options)),
       delegate_(std::move(delegate)),
       start_time_(base::TimeTicks::Now()),
+      last_taken_sample_time_(start_time_),
       top_down_(profiler->isolate(), profiler->code_entries()),
       profiler_(profiler),
       streaming_next_sample_(0),
@@ -712,8 +743,9 @@ void CpuProfile::StreamPendingTraceEvents() {
         if (!samples_[i].trace_id.has_value()) {
           continue;
         }
-        value->SetUnsignedInteger(std::to_string(i).c_str(),
-                                  samples_[i].trace_id.value());
+        value->SetUnsignedInteger(
+            std::to_string(taken_samples_count_ + i).c_str(),
+            samples_[i].trace_id.value());
       }
       value->EndDictionary();
     }
@@ -733,7 +765,7 @@ void CpuProfile::StreamPendingTraceEvents() {
     value->BeginArray("timeDeltas");
     base::TimeTicks lastTimestamp =
         streaming_next_sample_ ? samples_[streaming_next_sample_ - 1].timestamp
-                               : start_time();
+                               : last_taken_sample_time_;
     for (size_t i = streaming_next_sample_; i < samples_.size(); ++i) {
       value->AppendInteger(static_cast<int>(
           (samples_[i].timestamp - lastTimestamp).InMicroseconds()));
@@ -757,6 +789,20 @@ void CpuProfile::StreamPendingTraceEvents() {
                               "ProfileChunk", id_, "data", std::move(value));
 }
 
+void CpuProfile::TakeChunk(std::vector<const ProfileNode*>* nodes,
+                           std::vector<SampleInfo>* samples) {
+  // Stream the samples to the trace before they are dropped.
+  StreamPendingTraceEvents();
+  DCHECK_EQ(streaming_next_sample_, samples_.size());
+  *nodes = top_down_.TakeNewNodes();
+  samples->clear();
+  for (const SampleInfo& sample : samples_) samples->push_back(sample);
+  if (!samples_.empty()) last_taken_sample_time_ = samples_.back().timestamp;
+  taken_samples_count_ += samples_.size();
+  samples_.clear();
+  streaming_next_sample_ = 0;
+}
+
 void CpuProfile::FinishProfile() {
   end_time_ = base::TimeTicks::Now();
   // Stop tracking context movements after profiling stops.
@@ -1124,6 +1170,18 @@ CpuProfile* CpuProfilesCollection::StopProfiling(ProfilerId id) {
   return profile;
 }
 
+bool CpuProfilesCollection::TakeProfileChunk(
+    ProfilerId id, std::vector<const ProfileNode*>* nodes,
+    std::vector<CpuProfile::SampleInfo>* samples) {
+  base::RecursiveMutexGuard profiles_guard{&current_profiles_mutex_};
+  auto it = std::find_if(
+      current_profiles_.begin(), current_profiles_.end(),
+      [=](const std::unique_ptr<CpuProfile>& p) { return id == p->id(); });
+  if (it == current_profiles_.end()) return false;
+  (*it)->TakeChunk(nodes, samples);
+  return true;
+}
+
 CpuProfile* CpuProfilesCollection::Lookup(const char* title) {
   if (title == nullptr) return nullptr;
   // http://crbug/51594, edge case console.profile may provide an empty title
@@ -384,11 +384,17 @@ class V8_EXPORT_PRIVATE ProfileTree {
 
   Isolate* isolate() const { return isolate_; }
 
-  void EnqueueNode(const ProfileNode* node) { pending_nodes_.push_back(node); }
+  void EnqueueNode(const ProfileNode* node) {
+    pending_nodes_.push_back(node);
+    if (track_new_nodes_) new_nodes_.push_back(node);
+  }
   size_t pending_nodes_count() const { return pending_nodes_.size(); }
   std::vector<const ProfileNode*> TakePendingNodes() {
     return std::move(pending_nodes_);
   }
+  // Returns the nodes created since the previous call, each after its parent.
+  // The first call returns the whole tree.
+  std::vector<const ProfileNode*> TakeNewNodes();
 
   CodeEntryStorage* code_entries() { return code_entries_; }
 
@@ -397,6 +403,8 @@ class V8_EXPORT_PRIVATE ProfileTree {
   void TraverseDepthFirst(Callback* callback);
 
   std::vector<const ProfileNode*> pending_nodes_;
+  std::vector<const ProfileNode*> new_nodes_;
+  bool track_new_nodes_ = false;
 
   unsigned next_node_id_;
   Isolate* isolate_;
@@ -434,6 +442,10 @@ class CpuProfile {
                EmbedderStateTag embedder_state,
                const std::optional<uint64_t> trace_id = std::nullopt);
   void FinishProfile();
+  // Moves the nodes and samples recorded since the previous call out of the
+  // profile, see v8::CpuProfiler::TakeProfileChunk.
+  void TakeChunk(std::vector<const ProfileNode*>* nodes,
+                 std::vector<SampleInfo>* samples);
 
   const char* title() const { return title_; }
   const ProfileTree* top_down() const { return &top_down_; }
@@ -464,6 +476,10 @@ class CpuProfile {
   ContextFilter context_filter_;
   base::TimeTicks start_time_;
   base::TimeTicks end_time_;
+  // Timestamp of the last sample moved out by TakeChunk(), or the start time.
+  base::TimeTicks last_taken_sample_time_;
+  // Number of samples moved out by TakeChunk().
+  size_t taken_samples_count_ = 0;
   std::deque<SampleInfo> samples_;
   ProfileTree top_down_;
   CpuProfiler* const profiler_;
@@ -555,6 +571,9 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   // This Method is only visible for testing
   CpuProfilingResult StartProfilingForTesting(ProfilerId id);
   CpuProfile* StopProfiling(ProfilerId id);
+  bool TakeProfileChunk(ProfilerId id,
+                        std::vector<const ProfileNode*>* nodes,
+                        std::vector<CpuProfile::SampleInfo>* samples);
   bool IsLastProfileLeft(ProfilerId id);
   CpuProfile* Lookup(const char* title);
 
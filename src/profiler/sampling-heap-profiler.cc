@@ -94,8 +94,8 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
+  auto sample = std::make_unique<Sample>(size, node, loc, this,
+                                         next_sample_id(), TopBytecodeOffset());
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
   samples_.emplace(sample.get(), std::move(sample));
@@ -232,6 +232,17 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   return node;
 }
 
+int SamplingHeapProfiler::TopBytecodeOffset() {
+  // Optimized frames would need a frame summary, which can't be built without
+  // allocating, so only unoptimized frames report the allocation site.
+  JavaScriptStackFrameIterator frame_it(isolate_);
+  if (frame_it.done() || !frame_it.frame()->is_unoptimized()) {
+    return v8::AllocationProfile::kNoBytecodeOffset;
+  }
+  return static_cast<UnoptimizedJSFrame*>(frame_it.frame())
+      ->GetBytecodeOffset();
+}
+
 v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
     AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
     const std::map<int, Handle<Script>>& scripts) {
@@ -307,11 +318,21 @@ const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
   std::vector<v8::AllocationProfile::Sample> samples;
   samples.reserve(samples_.size());
+  HandleScope scope(isolate_);
   for (const auto& it : samples_) {
     const Sample* sample = it.second.get();
+    // Samples of collected objects may be kept, depending on flags_.
+    bool in_old_generation = false;
+    if (!sample->global.IsEmpty()) {
+      DirectHandle<Object> object = Utils::OpenDirectHandle(
+          *sample->global.Get(reinterpret_cast<v8::Isolate*>(isolate_)));
+      in_old_generation =
+          IsHeapObject(*object) &&
+          !HeapLayout::InYoungGeneration(Cast<HeapObject>(*object));
+    }
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id, sample->bytecode_offset, in_old_generation});
   }
   return samples;
 }
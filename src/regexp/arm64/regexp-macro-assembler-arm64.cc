@@ -764,6 +764,76 @@ bool RegExpMacroAssemblerARM64::SkipUntilBitInTableUseSimd(int advance_by) {
   return v8_flags.regexp_simd && advance_by * char_size() == 1;
 }
 
+void RegExpMacroAssemblerARM64::SkipUntilCharacterAfterAnd(unsigned c,
+                                                           unsigned mask,
+                                                           int cp_offset,
+                                                           int advance_by) {
+  Label cont, scalar_repeat;
+
+  if (SkipUntilCharacterAfterAndUseSimd()) {
+    Label simd_repeat, found, scalar;
+    static constexpr int kVectorSize = 16;
+    const int kCharsPerVector = kVectorSize / char_size();
+
+    // Fallback to scalar version if there are less than kCharsPerVector chars
+    // left in the subject (see SkipUntilBitInTable).
+    CheckPosition(cp_offset + kCharsPerVector - 1, &scalar);
+
+    // Broadcast the character and the mask to all lanes.
+    VRegister char_vec = mode_ == LATIN1 ? v0.V16B() : v0.V8H();
+    VRegister mask_vec = mode_ == LATIN1 ? v1.V16B() : v1.V8H();
+    const unsigned lane_mask = mode_ == LATIN1 ? 0xff : 0xffff;
+    __ Movi(char_vec, c & mask & lane_mask);
+    __ Movi(mask_vec, mask & lane_mask);
+
+    Bind(&simd_repeat);
+    // result = (input & mask) == c
+    VRegister result = mode_ == LATIN1 ? v2.V16B() : v2.V8H();
+    __ Add(x8, input_end(), Operand(current_input_offset(), SXTW));
+    __ Add(x8, x8, cp_offset * char_size());
+    __ Ld1(result.V16B(), MemOperand(x8));
+    __ And(result.V16B(), result.V16B(), mask_vec.V16B());
+    __ Cmeq(result, result, char_vec);
+
+    // Narrow the result to 64 bit, keeping 4 bits per byte.
+    __ Shrn(result.V8B(), result.V8H(), 4);
+    __ Umov(x8, result.V1D(), 0);
+    __ Cbnz(x8, &found);
+
+    AdvanceCurrentPosition(kCharsPerVector);
+    CheckPosition(cp_offset + kCharsPerVector - 1, &scalar);
+    __ B(&simd_repeat);
+
+    Bind(&found);
+    // Extract position. In two-byte subjects both bytes of a matching lane
+    // are set, so the lowest set nibble is always at an even byte offset.
+    __ Rbit(x8, x8);
+    __ Clz(x8, x8);
+    __ Lsr(x8, x8, 2);
+    __ Add(current_input_offset(), current_input_offset(), w8);
+    __ B(&cont);
+    Bind(&scalar);
+  }
+
+  // Scalar version.
+  Bind(&scalar_repeat);
+  CheckPosition(cp_offset, &cont);
+  LoadCurrentCharacterUnchecked(cp_offset, 1);
+  __ And(w10, current_character(), mask);
+  __ Cmp(w10, c);
+  __ B(eq, &cont);
+  AdvanceCurrentPosition(advance_by);
+  __ B(&scalar_repeat);
+
+  Bind(&cont);
+}
+
+bool RegExpMacroAssemblerARM64::SkipUntilCharacterAfterAndUseSimd() {
+  // Unlike the table lookup, a compare is cheap enough that the vectorized
+  // loop wins for both subject encodings and any advance distance.
+  return v8_flags.regexp_simd;
+}
+
 bool RegExpMacroAssemblerARM64::CheckSpecialClassRanges(
     StandardCharacterSet type, Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
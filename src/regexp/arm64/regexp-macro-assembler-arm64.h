@@ -61,6 +61,9 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
                            Handle<ByteArray> nibble_table,
                            int advance_by) override;
   bool SkipUntilBitInTableUseSimd(int advance_by) override;
+  void SkipUntilCharacterAfterAnd(unsigned c, unsigned mask, int cp_offset,
+                                  int advance_by) override;
+  bool SkipUntilCharacterAfterAndUseSimd() override;
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
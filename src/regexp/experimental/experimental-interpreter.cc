@@ -4,6 +4,11 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/sandbox/check.h"
@@ -237,6 +242,192 @@ class FilterGroups {
   base::Vector<const RegExpInstruction> bytecode_;
 };
 
+// Computes which characters can start a match of an unanchored regexp, so that
+// the interpreter can skip input that can't start one instead of stepping the
+// /.*?/ preamble thread through it character by character.
+//
+// The compiler emits the preamble (see CompileVisitor::Compile) as
+//
+//   0: FORK 2
+//   1: JMP 6
+//   2: BEGIN_LOOP
+//   3: CONSUME_RANGE [0x0000, 0xFFFF]
+//   4: END_LOOP
+//   5: FORK 2
+//
+// followed by the regexp body. The filter collects the ranges of every
+// CONSUME_RANGE or RANGE_COUNT reachable from the body start without
+// consuming input. Assertions are treated as always passing, which can only
+// make the set larger. If the body can accept without consuming input, or
+// contains lookarounds, no filter is created.
+class MatchStartFilter {
+ public:
+  static constexpr int kPreambleConsumePc = 3;
+  static constexpr int kBodyStartPc = 6;
+
+  static std::optional<MatchStartFilter> TryCreate(
+      base::Vector<const RegExpInstruction> bytecode, Zone* zone) {
+    if (!HasUnanchoredPreamble(bytecode)) return std::nullopt;
+
+    MatchStartFilter filter(bytecode.length(), zone);
+    base::Vector<bool> visited = zone->AllocateVector<bool>(bytecode.length());
+    std::fill(visited.begin(), visited.end(), false);
+    ZoneList<int> worklist(4, zone);
+    worklist.Add(kBodyStartPc, zone);
+    while (!worklist.is_empty()) {
+      int pc = worklist.RemoveLast();
+      SBXCHECK_GE(pc, 0);
+      SBXCHECK_LT(pc, bytecode.length());
+      if (visited[pc]) continue;
+      visited[pc] = true;
+
+      const RegExpInstruction& inst = bytecode[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::FORK:
+          worklist.Add(inst.payload.pc, zone);
+          worklist.Add(pc + 1, zone);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.Add(inst.payload.pc, zone);
+          break;
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        case RegExpInstruction::BEGIN_LOOP:
+        case RegExpInstruction::END_LOOP:
+          worklist.Add(pc + 1, zone);
+          break;
+        case RegExpInstruction::CONSUME_RANGE:
+          filter.first_consume_pcs_[pc] = true;
+          filter.AddRange(inst.payload.consume_range, zone);
+          break;
+        case RegExpInstruction::RANGE_COUNT: {
+          filter.first_consume_pcs_[pc] = true;
+          int32_t ranges = inst.payload.num_ranges;
+          SBXCHECK_LT(pc + ranges, bytecode.length());
+          for (int i = 1; i <= ranges; ++i) {
+            DCHECK_EQ(bytecode[pc + i].opcode,
+                      RegExpInstruction::CONSUME_RANGE);
+            filter.AddRange(bytecode[pc + i].payload.consume_range, zone);
+          }
+          break;
+        }
+        default:
+          // ACCEPT means that the empty string matches, so every position
+          // can start a match. Lookaround instructions are not handled.
+          return std::nullopt;
+      }
+    }
+
+    // Skipping never pays off if every one-byte character can start a match.
+    if (std::all_of(filter.one_byte_.begin(), filter.one_byte_.end(),
+                    [](bool b) { return b; })) {
+      return std::nullopt;
+    }
+    filter.ComputeSingleChar();
+    return filter;
+  }
+
+  // Whether a thread blocked at `pc` waits for the first character of a match.
+  bool IsFirstConsumePc(int pc) const { return first_consume_pcs_[pc]; }
+
+  // Returns the first index at or after `from` whose character can start a
+  // match, or `input.length()` if there is none.
+  template <class Character>
+  int NextCandidate(base::Vector<const Character> input, int from) const {
+    DCHECK_LE(from, input.length());
+    if (single_char_.has_value()) {
+      const base::uc16 c = *single_char_;
+      if constexpr (sizeof(Character) == 1) {
+        if (c > String::kMaxOneByteCharCode) return input.length();
+        const void* found =
+            memchr(input.begin() + from, c, input.length() - from);
+        if (found == nullptr) return input.length();
+        return static_cast<int>(static_cast<const Character*>(found) -
+                                input.begin());
+      } else {
+        return static_cast<int>(
+            std::find(input.begin() + from, input.end(), c) - input.begin());
+      }
+    }
+    for (int i = from; i < input.length(); ++i) {
+      if (Accepts(input[i])) return i;
+    }
+    return input.length();
+  }
+
+ private:
+  MatchStartFilter(int bytecode_length, Zone* zone)
+      : first_consume_pcs_(zone->AllocateVector<bool>(bytecode_length)),
+        two_byte_ranges_(0, zone) {
+    std::fill(first_consume_pcs_.begin(), first_consume_pcs_.end(), false);
+    one_byte_.fill(false);
+  }
+
+  static bool HasUnanchoredPreamble(
+      base::Vector<const RegExpInstruction> bytecode) {
+    if (bytecode.length() <= kBodyStartPc) return false;
+    const RegExpInstruction::Uc16Range& any =
+        bytecode[kPreambleConsumePc].payload.consume_range;
+    return bytecode[0].opcode == RegExpInstruction::FORK &&
+           bytecode[0].payload.pc == 2 &&
+           bytecode[1].opcode == RegExpInstruction::JMP &&
+           bytecode[1].payload.pc == kBodyStartPc &&
+           bytecode[2].opcode == RegExpInstruction::BEGIN_LOOP &&
+           bytecode[kPreambleConsumePc].opcode ==
+               RegExpInstruction::CONSUME_RANGE &&
+           any.min == 0x0000 && any.max == 0xFFFF &&
+           bytecode[4].opcode == RegExpInstruction::END_LOOP &&
+           bytecode[5].opcode == RegExpInstruction::FORK &&
+           bytecode[5].payload.pc == 2;
+  }
+
+  void AddRange(RegExpInstruction::Uc16Range range, Zone* zone) {
+    // Empty ranges (min > max) encode failure.
+    for (int c = range.min;
+         c <= std::min<int>(range.max, String::kMaxOneByteCharCode); ++c) {
+      one_byte_[c] = true;
+    }
+    if (range.max > String::kMaxOneByteCharCode && range.min <= range.max) {
+      two_byte_ranges_.Add(
+          {std::max<base::uc16>(range.min, String::kMaxOneByteCharCode + 1),
+           range.max},
+          zone);
+    }
+  }
+
+  void ComputeSingleChar() {
+    int count = 0;
+    base::uc16 c = 0;
+    for (int i = 0; i <= String::kMaxOneByteCharCode; ++i) {
+      if (one_byte_[i]) {
+        ++count;
+        c = i;
+      }
+    }
+    for (const RegExpInstruction::Uc16Range& range : two_byte_ranges_) {
+      count += range.max - range.min + 1;
+      c = range.min;
+    }
+    if (count == 1) single_char_ = c;
+  }
+
+  bool Accepts(base::uc16 c) const {
+    if (c <= String::kMaxOneByteCharCode) return one_byte_[c];
+    for (const RegExpInstruction::Uc16Range& range : two_byte_ranges_) {
+      if (c >= range.min && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  base::Vector<bool> first_consume_pcs_;
+  std::array<bool, String::kMaxOneByteCharCode + 1> one_byte_;
+  // Ranges of two-byte characters, clamped to start above the one-byte range.
+  ZoneList<RegExpInstruction::Uc16Range> two_byte_ranges_;
+  std::optional<base::uc16> single_char_;
+};
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -365,6 +556,7 @@ class NfaInterpreter {
         reverse_(false),
         current_lookaround_(-1),
         filter_groups_pc_(std::nullopt),
+        match_start_filter_(std::nullopt),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -466,6 +658,10 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    if (lookarounds_.is_empty()) {
+      match_start_filter_ = MatchStartFilter::TryCreate(bytecode_, zone_);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -700,6 +896,10 @@ class NfaInterpreter {
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
 
+      if (match_start_filter_.has_value() && !FoundMatch()) {
+        SkipToNextPossibleMatchStart();
+      }
+
       if (lookbehind_table_.has_value()) {
         std::fill(lookbehind_table_->begin(), lookbehind_table_->end(), false);
       }
@@ -730,6 +930,35 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // If every blocked thread is either the /.*?/ preamble thread or waits for
+  // the first character of a match, then only a position whose character can
+  // start a match lets any thread other than the preamble survive. Advances
+  // `input_index_` to just before the next such position, keeping only the
+  // preamble thread, which then forks a fresh match attempt there.
+  void SkipToNextPossibleMatchStart() {
+    DCHECK(!reverse_);
+    std::optional<InterpreterThread> preamble;
+    for (InterpreterThread t : blocked_threads_) {
+      if (t.pc == MatchStartFilter::kPreambleConsumePc) {
+        preamble = t;
+      } else if (!match_start_filter_->IsFirstConsumePc(t.pc)) {
+        return;
+      }
+    }
+    if (!preamble.has_value()) return;
+
+    const int next = match_start_filter_->NextCandidate(input_, input_index_);
+    // The preamble thread consumes the character at `next - 1`.
+    if (next - 1 <= input_index_) return;
+
+    for (InterpreterThread t : blocked_threads_) {
+      if (t.pc != MatchStartFilter::kPreambleConsumePc) DestroyThread(t);
+    }
+    blocked_threads_.Rewind(0);
+    blocked_threads_.Add(*preamble, zone_);
+    input_index_ = next - 1;
+  }
+
   // Handles pending interrupts if there are any.  Returns
   // RegExp::kInternalRegExpSuccess if execution can continue, and an error
   // code otherwise.
@@ -1534,6 +1763,10 @@ class NfaInterpreter {
   // quantifiers).
   std::optional<int> filter_groups_pc_;
 
+  // Set for unanchored regexps without lookarounds whose first character is
+  // restricted. See `SkipToNextPossibleMatchStart`.
+  std::optional<MatchStartFilter> match_start_filter_;
+
   uint64_t memory_consumption_per_thread_;
 
   Zone* zone_;
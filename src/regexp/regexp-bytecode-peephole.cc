@@ -614,6 +614,64 @@ void RegExpBytecodePeephole::DefineStandardSequences() {
       .IgnoreArgument(2, 4, 4)   // indirect loop jump
       .IgnoreArgument(3, 4, 4)   // jump out of loop
       .IgnoreArgument(4, 4, 4);  // loop jump
+
+  // Emitted for single-character Boyer-Moore skips (see
+  // RegExpMacroAssembler::SkipUntilCharacterAfterAnd).
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_AND_CHECK_CHAR)
+      .FollowedBy(BC_ADVANCE_CP_AND_GOTO)
+      // Sequence is only valid if the jump target of ADVANCE_CP_AND_GOTO is the
+      // first bytecode in this sequence.
+      .IfArgumentEqualsOffset(4, 4, 0)
+      .ReplaceWith(BC_SKIP_UNTIL_MASKED_CHAR)
+      .MapArgument(0, 1, 3)      // load offset
+      .MapArgument(2, 1, 3, 2)   // advance by
+      .MapArgument(1, 1, 3, 2)   // c
+      .MapArgument(1, 4, 4)      // mask
+      .MapArgument(1, 8, 4)      // goto when match
+      .MapArgument(0, 4, 4)      // goto on failure
+      .IgnoreArgument(2, 4, 4);  // loop jump
+
+  // Character class loops, e.g. the body of a greedy loop over a single
+  // range.
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_CHECK_CHAR_IN_RANGE)
+      .FollowedBy(BC_ADVANCE_CP_AND_GOTO)
+      // Sequence is only valid if the jump target of ADVANCE_CP_AND_GOTO is the
+      // first bytecode in this sequence.
+      .IfArgumentEqualsOffset(4, 4, 0)
+      .ReplaceWith(BC_SKIP_UNTIL_CHAR_IN_RANGE)
+      .MapArgument(0, 1, 3)      // load offset
+      .MapArgument(2, 1, 3, 4)   // advance by
+      .MapArgument(1, 4, 2)      // from
+      .MapArgument(1, 6, 2)      // to
+      .MapArgument(1, 8, 4)      // goto when in range
+      .MapArgument(0, 4, 4)      // goto on failure
+      .IgnoreArgument(2, 4, 4);  // loop jump
+
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_CHECK_CHAR_NOT_IN_RANGE)
+      .FollowedBy(BC_ADVANCE_CP_AND_GOTO)
+      // Sequence is only valid if the jump target of ADVANCE_CP_AND_GOTO is the
+      // first bytecode in this sequence.
+      .IfArgumentEqualsOffset(4, 4, 0)
+      .ReplaceWith(BC_SKIP_UNTIL_CHAR_NOT_IN_RANGE)
+      .MapArgument(0, 1, 3)      // load offset
+      .MapArgument(2, 1, 3, 4)   // advance by
+      .MapArgument(1, 4, 2)      // from
+      .MapArgument(1, 6, 2)      // to
+      .MapArgument(1, 8, 4)      // goto when not in range
+      .MapArgument(0, 4, 4)      // goto on failure
+      .IgnoreArgument(2, 4, 4);  // loop jump
+
+  // Backtracking out of a greedy loop (see ChoiceNode::EmitGreedyLoop) steps
+  // back one iteration at a time until the pushed start position is reached.
+  CreateSequence(BC_CHECK_GREEDY)
+      .FollowedBy(BC_ADVANCE_CP_AND_GOTO)
+      .ReplaceWith(BC_CHECK_GREEDY_OR_ADVANCE_CP_AND_GOTO)
+      .MapArgument(1, 1, 3)      // advance by
+      .MapArgument(0, 4, 4)      // goto when unwound
+      .MapArgument(1, 4, 4);  // goto otherwise
 }
 
 bool RegExpBytecodePeephole::OptimizeBytecode(const uint8_t* bytecode,
@@ -211,7 +211,52 @@ static_assert(1 << BYTECODE_SHIFT > BYTECODE_MASK);
   /* 0x40 - 0xBF    Bit Table                                               */ \
   /* 0xC0 - 0xDF    Address of bytecode when character is matched           */ \
   /* 0xE0 - 0xFF    Address of bytecode when no match                       */ \
-  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)
+  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)                                 \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR, AND_CHECK_CHAR and ADVANCE_CP_AND_GOTO              */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3B (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x2F    Number of characters to advance                         */ \
+  /* 0x30 - 0x3F    Character to match against (after mask applied)         */ \
+  /* 0x40 - 0x5F:   Bitmask bitwise and combined with current character     */ \
+  /* 0x60 - 0x7F    Address of bytecode when character is matched           */ \
+  /* 0x80 - 0x9F    Address of bytecode when no match                       */ \
+  V(SKIP_UNTIL_MASKED_CHAR, 59, 20)                                            \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR, CHECK_CHAR_IN_RANGE and ADVANCE_CP_AND_GOTO         */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3C (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Number of characters to advance                         */ \
+  /* 0x40 - 0x4F    Range from                                              */ \
+  /* 0x50 - 0x5F    Range to (inclusive)                                    */ \
+  /* 0x60 - 0x7F    Address of bytecode when character is in range          */ \
+  /* 0x80 - 0x9F    Address of bytecode when no match                       */ \
+  V(SKIP_UNTIL_CHAR_IN_RANGE, 60, 20)                                          \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR, CHECK_CHAR_NOT_IN_RANGE and ADVANCE_CP_AND_GOTO     */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3D (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Number of characters to advance                         */ \
+  /* 0x40 - 0x4F    Range from                                              */ \
+  /* 0x50 - 0x5F    Range to (inclusive)                                    */ \
+  /* 0x60 - 0x7F    Address of bytecode when character is not in range      */ \
+  /* 0x80 - 0x9F    Address of bytecode when no match                       */ \
+  V(SKIP_UNTIL_CHAR_NOT_IN_RANGE, 61, 20)                                      \
+  /* Combination of:                                                        */ \
+  /* CHECK_GREEDY and ADVANCE_CP_AND_GOTO                                   */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3E (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Number of characters to advance                         */ \
+  /* 0x20 - 0x3F    Address of bytecode when the greedy loop is unwound     */ \
+  /* 0x40 - 0x5F    Address of bytecode otherwise                           */ \
+  V(CHECK_GREEDY_OR_ADVANCE_CP_AND_GOTO, 62, 12)
 
 #define COUNT(...) +1
 static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
@@ -221,7 +266,7 @@ static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
 // contiguous, strictly increasing, and start at 0.
 // TODO(jgruber): Do not explicitly assign values, instead generate them
 // implicitly from the list order.
-static_assert(kRegExpBytecodeCount == 59);
+static_assert(kRegExpBytecodeCount == 63);
 
 #define DECLARE_BYTECODES(name, code, length) \
   static constexpr int BC_##name = code;
@@ -3039,25 +3039,18 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
   int lookahead_width = max_lookahead + 1 - min_lookahead;
 
-  if (found_single_character && lookahead_width == 1 && max_lookahead < 3) {
-    // The mask-compare can probably handle this better.
+  if (found_single_character && lookahead_width == 1 && max_lookahead < 3 &&
+      !masm->SkipUntilCharacterAfterAndUseSimd()) {
+    // The mask-compare can probably handle this better, unless we can scan
+    // for the character a whole vector at a time.
     return;
   }
 
   if (found_single_character) {
-    // TODO(pthier): Add vectorized version.
-    Label cont, again;
-    masm->Bind(&again);
-    masm->LoadCurrentCharacter(max_lookahead, &cont, true);
-    if (max_char_ > kSize) {
-      masm->CheckCharacterAfterAnd(single_character,
-                                   RegExpMacroAssembler::kTableMask, &cont);
-    } else {
-      masm->CheckCharacter(single_character, &cont);
-    }
-    masm->AdvanceCurrentPosition(lookahead_width);
-    masm->GoTo(&again);
-    masm->Bind(&cont);
+    const unsigned mask =
+        max_char_ > kSize ? RegExpMacroAssembler::kTableMask : max_char_;
+    masm->SkipUntilCharacterAfterAnd(single_character, mask, max_lookahead,
+                                     lookahead_width);
     return;
   }
 
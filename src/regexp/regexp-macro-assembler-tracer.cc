@@ -405,6 +405,18 @@ void RegExpMacroAssemblerTracer::SkipUntilBitInTable(
   assembler_->SkipUntilBitInTable(cp_offset, table, nibble_table, advance_by);
 }
 
+void RegExpMacroAssemblerTracer::SkipUntilCharacterAfterAnd(unsigned c,
+                                                            unsigned mask,
+                                                            int cp_offset,
+                                                            int advance_by) {
+  PrintablePrinter printable(c);
+  PrintF(
+      " SkipUntilCharacterAfterAnd(c=0x%04x%s, mask=0x%04x, cp_offset=%d, "
+      "advance_by=%d);\n",
+      c, *printable, mask, cp_offset, advance_by);
+  assembler_->SkipUntilCharacterAfterAnd(c, mask, cp_offset, advance_by);
+}
+
 void RegExpMacroAssemblerTracer::CheckNotBackReference(int start_reg,
                                                        bool read_backward,
                                                        Label* on_no_match) {
@@ -61,6 +61,11 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void SkipUntilBitInTable(int cp_offset, Handle<ByteArray> table,
                            Handle<ByteArray> nibble_table,
                            int advance_by) override;
+  bool SkipUntilCharacterAfterAndUseSimd() override {
+    return assembler_->SkipUntilCharacterAfterAndUseSimd();
+  }
+  void SkipUntilCharacterAfterAnd(unsigned c, unsigned mask, int cp_offset,
+                                  int advance_by) override;
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialClassRanges(StandardCharacterSet type,
                                Label* on_no_match) override;
@@ -114,6 +114,14 @@ class RegExpMacroAssembler {
                                    int advance_by) = 0;
   virtual bool SkipUntilBitInTableUseSimd(int advance_by) { return false; }
 
+  // Advances the current position until the character at cp_offset, and'ed
+  // with mask, equals c. Any position skipped on the way has been checked, so
+  // implementations may step by less than advance_by. Stops when cp_offset is
+  // past the end of the subject.
+  virtual void SkipUntilCharacterAfterAnd(unsigned c, unsigned mask,
+                                          int cp_offset, int advance_by);
+  virtual bool SkipUntilCharacterAfterAndUseSimd() { return false; }
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
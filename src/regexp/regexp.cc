@@ -4,6 +4,7 @@
 
 #include "src/regexp/regexp.h"
 
+#include "src/base/hashing.h"
 #include "src/base/strings.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
@@ -657,6 +658,12 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
     // interpreter in code.
     re_data->set_bytecode(is_one_byte,
                           Cast<TrustedByteArray>(*compile_data.code));
+    // Only the first compilation sets the delay, so that compiling for the
+    // other subject encoding doesn't undo interpreter ticks already taken.
+    if (v8_flags.regexp_tier_up && !re_data->has_bytecode(!is_one_byte)) {
+      re_data->DelayTierUpForBytecodeLength(
+          re_data->bytecode(is_one_byte)->length());
+    }
     DirectHandle<Code> trampoline =
         BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
     re_data->set_code(is_one_byte, *trampoline);
@@ -1287,9 +1294,7 @@ Tagged<Object> RegExpResultsCache::Lookup(Heap* heap, Tagged<String> key_string,
     cache = heap->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
+  uint32_t index = FirstEntryIndex(heap->isolate(), key_string, key_pattern);
   if (cache->get(index + kStringOffset) != key_string ||
       cache->get(index + kPatternOffset) != key_pattern) {
     index =
@@ -1314,6 +1319,7 @@ void RegExpResultsCache::Enter(Isolate* isolate,
   Factory* factory = isolate->factory();
   DirectHandle<FixedArray> cache;
   if (!IsInternalizedString(*key_string)) return;
+  if (value_array->length() > kMaxCachedArrayLength) return;
   if (type == STRING_SPLIT_SUBSTRINGS) {
     DCHECK(IsString(*key_pattern));
     if (!IsInternalizedString(*key_pattern)) return;
@@ -1324,9 +1330,7 @@ void RegExpResultsCache::Enter(Isolate* isolate,
     cache = factory->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
+  uint32_t index = FirstEntryIndex(isolate, *key_string, *key_pattern);
   if (cache->get(index + kStringOffset) == Smi::zero()) {
     cache->set(index + kStringOffset, *key_string);
     cache->set(index + kPatternOffset, *key_pattern);
@@ -1365,6 +1369,22 @@ void RegExpResultsCache::Enter(Isolate* isolate,
       isolate, ReadOnlyRoots(isolate).fixed_cow_array_map());
 }
 
+// static
+uint32_t RegExpResultsCache::FirstEntryIndex(Isolate* isolate,
+                                             Tagged<String> key_string,
+                                             Tagged<Object> key_pattern) {
+  // Mix in the pattern so that a subject used with several regexps (e.g.
+  // split by different separators) doesn't keep evicting its own entries.
+  Tagged<String> pattern_source =
+      IsString(key_pattern)
+          ? Cast<String>(key_pattern)
+          : Cast<RegExpDataWrapper>(key_pattern)->data(isolate)->source();
+  uint32_t hash = static_cast<uint32_t>(
+      base::hash_combine(key_string->hash(), pattern_source->EnsureHash()));
+  return (hash & (kRegExpResultsCacheSize - 1)) &
+         ~(kArrayEntriesPerCacheEntry - 1);
+}
+
 void RegExpResultsCache::Clear(Tagged<FixedArray> cache) {
   for (int i = 0; i < kRegExpResultsCacheSize; i++) {
     cache->set(i, Smi::zero());
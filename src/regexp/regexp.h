@@ -237,9 +237,17 @@ class RegExpResultsCache final : public AllStatic {
                     ResultsCacheType type);
   static void Clear(Tagged<FixedArray> cache);
 
-  static constexpr int kRegExpResultsCacheSize = 0x100;
+  // The caches are only cleared on full GCs, so bound the size of what they
+  // retain: results longer than kMaxCachedArrayLength are not cached.
+  static constexpr int kRegExpResultsCacheSize = 0x400;
+  static constexpr int kMaxCachedArrayLength = 0x4000;
 
  private:
+  // Entries are two-way set associative. Returns the index of the first entry
+  // for (key_string, key_pattern); the second one follows it.
+  static uint32_t FirstEntryIndex(Isolate* isolate, Tagged<String> key_string,
+                                  Tagged<Object> key_pattern);
+
   static constexpr int kStringOffset = 0;
   static constexpr int kPatternOffset = 1;
   static constexpr int kArrayOffset = 2;
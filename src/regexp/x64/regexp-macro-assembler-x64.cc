@@ -731,6 +731,80 @@ bool RegExpMacroAssemblerX64::SkipUntilBitInTableUseSimd(int advance_by) {
          CpuFeatures::IsSupported(SSSE3);
 }
 
+void RegExpMacroAssemblerX64::SkipUntilCharacterAfterAnd(unsigned c,
+                                                         unsigned mask,
+                                                         int cp_offset,
+                                                         int advance_by) {
+  Label cont, scalar_repeat;
+
+  if (SkipUntilCharacterAfterAndUseSimd()) {
+    Label simd_repeat, found, scalar;
+    static constexpr int kVectorSize = 16;
+    const int kCharsPerVector = kVectorSize / char_size();
+
+    // Fallback to scalar version if there are less than kCharsPerVector chars
+    // left in the subject (see SkipUntilBitInTable).
+    CheckPosition(cp_offset + kCharsPerVector - 1, &scalar);
+
+    // Broadcast the character and the mask to all lanes.
+    const uint32_t lane_splat = mode_ == LATIN1 ? 0x01010101 : 0x00010001;
+    const uint32_t lane_mask = mode_ == LATIN1 ? 0xff : 0xffff;
+    XMMRegister char_vec = xmm0;
+    __ Move(r11, (c & mask & lane_mask) * lane_splat);
+    __ Movd(char_vec, r11);
+    __ Pshufd(char_vec, char_vec, uint8_t{0});
+    XMMRegister mask_vec = xmm1;
+    __ Move(r11, (mask & lane_mask) * lane_splat);
+    __ Movd(mask_vec, r11);
+    __ Pshufd(mask_vec, mask_vec, uint8_t{0});
+
+    Bind(&simd_repeat);
+    // result = (input & mask) == c
+    XMMRegister result = xmm2;
+    __ Movdqu(result, Operand(rsi, rdi, times_1, cp_offset * char_size()));
+    __ Andps(result, result, mask_vec);
+    if (mode_ == LATIN1) {
+      __ Pcmpeqb(result, result, char_vec);
+    } else {
+      __ Pcmpeqw(result, result, char_vec);
+    }
+    __ Pmovmskb(r11, result);
+    __ testl(r11, r11);
+    __ j(not_zero, &found);
+
+    AdvanceCurrentPosition(kCharsPerVector);
+    CheckPosition(cp_offset + kCharsPerVector - 1, &scalar);
+    __ jmp(&simd_repeat);
+
+    Bind(&found);
+    // Extract position. In two-byte subjects both bytes of a matching lane
+    // are set, so the lowest set bit is always at an even byte offset.
+    __ bsfl(r11, r11);
+    __ addq(rdi, r11);
+    __ jmp(&cont);
+    Bind(&scalar);
+  }
+
+  // Scalar version.
+  Bind(&scalar_repeat);
+  CheckPosition(cp_offset, &cont);
+  LoadCurrentCharacterUnchecked(cp_offset, 1);
+  __ movl(rax, current_character());
+  __ andl(rax, Immediate(mask));
+  __ cmpl(rax, Immediate(c));
+  __ j(equal, &cont);
+  AdvanceCurrentPosition(advance_by);
+  __ jmp(&scalar_repeat);
+
+  __ bind(&cont);
+}
+
+bool RegExpMacroAssemblerX64::SkipUntilCharacterAfterAndUseSimd() {
+  // Unlike the table lookup, a compare is cheap enough that the vectorized
+  // loop wins for both subject encodings and any advance distance.
+  return v8_flags.regexp_simd;
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialClassRanges(StandardCharacterSet type,
                                                       Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
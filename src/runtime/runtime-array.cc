@@ -6,7 +6,9 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/protectors-inl.h"
 #include "src/heap/factory.h"
+#include "src/debug/debug.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-inl.h"
@@ -219,6 +221,81 @@ RUNTIME_FUNCTION(Runtime_ArraySpeciesConstructor) {
       isolate, Object::ArraySpeciesConstructor(isolate, original_array));
 }
 
+namespace {
+
+// Keep in sync with the kUserCmpFn* constants in array-sort.tq.
+enum class SortComparatorKind {
+  kUnclassified = 0,
+  kGeneric = 1,
+  kSubtract = 2,         // (a, b) => a - b
+  kReverseSubtract = 3,  // (a, b) => b - a
+};
+
+// Recognizes comparators whose entire bytecode is
+//
+//   Ldar aX
+//   Sub aY, [slot]
+//   Return
+//
+// with {X, Y} being the first two parameters. Such a function has no
+// observable effect beyond the subtraction as long as both arguments are
+// Numbers, so Array.prototype.sort can perform the subtraction inline.
+SortComparatorKind ClassifySortComparator(Isolate* isolate,
+                                          DirectHandle<Object> comparefn) {
+  if (!IsJSFunction(*comparefn)) return SortComparatorKind::kGeneric;
+  // Skipping calls would be observable through the debugger and through
+  // precise code coverage.
+  if (isolate->debug()->is_active() ||
+      !isolate->is_best_effort_code_coverage()) {
+    return SortComparatorKind::kGeneric;
+  }
+  DirectHandle<SharedFunctionInfo> shared(
+      Cast<JSFunction>(*comparefn)->shared(), isolate);
+  if (!shared->HasBytecodeArray()) return SortComparatorKind::kGeneric;
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate), isolate);
+  if (bytecode->parameter_count_without_receiver() < 2) {
+    return SortComparatorKind::kGeneric;
+  }
+
+  const interpreter::Register first =
+      interpreter::Register::FromParameterIndex(1);
+  const interpreter::Register second =
+      interpreter::Register::FromParameterIndex(2);
+  interpreter::BytecodeArrayIterator it(bytecode);
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kLdar) {
+    return SortComparatorKind::kGeneric;
+  }
+  const interpreter::Register subtrahend = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kSub) {
+    return SortComparatorKind::kGeneric;
+  }
+  const interpreter::Register minuend = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return SortComparatorKind::kGeneric;
+  }
+  it.Advance();
+  if (!it.done()) return SortComparatorKind::kGeneric;
+
+  if (minuend == first && subtrahend == second) {
+    return SortComparatorKind::kSubtract;
+  }
+  if (minuend == second && subtrahend == first) {
+    return SortComparatorKind::kReverseSubtract;
+  }
+  return SortComparatorKind::kGeneric;
+}
+
+}  // namespace
+
+RUNTIME_FUNCTION(Runtime_ArraySortClassifyComparator) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  DirectHandle<Object> comparefn = args.at(0);
+  return Smi::FromEnum(ClassifySortComparator(isolate, comparefn));
+}
+
 // ES7 22.1.3.11 Array.prototype.includes
 RUNTIME_FUNCTION(Runtime_ArrayIncludes_Slow) {
   HandleScope shs(isolate);
@@ -648,8 +648,11 @@ Tagged<Object> CompileOptimizedOSR(Isolate* isolate,
           ? ConcurrencyMode::kConcurrent
           : ConcurrencyMode::kSynchronous;
 
+  // The OSR code of concurrent jobs is installed into the OSR cache of the
+  // feedback vector, and entered from the next JumpLoop back edge.
   if (V8_UNLIKELY(isolate->EfficiencyModeEnabledForTiering() &&
-                  min_opt_level == CodeKind::MAGLEV)) {
+                  min_opt_level == CodeKind::MAGLEV &&
+                  !v8_flags.concurrent_maglev_osr_in_efficiency_mode)) {
     mode = ConcurrencyMode::kSynchronous;
   }
 
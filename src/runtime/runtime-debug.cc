@@ -109,6 +109,53 @@ RUNTIME_FUNCTION_RETURN_PAIR(Runtime_DebugBreakOnBytecode) {
                   Smi::FromInt(static_cast<uint8_t>(bytecode)));
 }
 
+// Called from Sparkplug code compiled with --sparkplug-break-checks when the
+// debug bytecode has a break at the current bytecode offset.
+RUNTIME_FUNCTION(Runtime_DebugBreakOnBaseline) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  DirectHandle<Object> value = args.at(0);
+
+  // Return value can be changed by debugger. Last set value will be used as
+  // return value.
+  ReturnValueScope result_scope(isolate->debug());
+  isolate->debug()->set_return_value(*value);
+
+  // Get the top-most JavaScript frame.
+  {
+    JavaScriptStackFrameIterator it(isolate);
+    DCHECK(it.frame()->is_baseline());
+    if (isolate->debug_execution_mode() == DebugInfo::kBreakpoints) {
+      isolate->debug()->Break(it.frame(),
+                              direct_handle(it.frame()->function(), isolate));
+    }
+  }
+
+  // Removing the last break point while paused discards the baseline code and
+  // continues this frame in the interpreter after the current bytecode. The
+  // break check runs before the bytecode though, so continue at it instead.
+  JavaScriptStackFrameIterator it(isolate);
+  if (it.frame()->is_interpreted() &&
+      it.frame()->pc() ==
+          BUILTIN_CODE(isolate, InterpreterEnterAtNextBytecode)
+              ->instruction_start()) {
+    PointerAuthentication::ReplacePC(
+        it.frame()->pc_address(),
+        BUILTIN_CODE(isolate, InterpreterEnterAtBytecode)->instruction_start(),
+        kSystemPointerSize);
+  }
+
+  // If the user requested to restart a frame, there is no need to continue
+  // with the current bytecode.
+  if (isolate->debug()->IsRestartFrameScheduled()) {
+    return isolate->TerminateExecution();
+  }
+
+  Tagged<Object> interrupt_object = isolate->stack_guard()->HandleInterrupts();
+  if (IsException(interrupt_object, isolate)) return interrupt_object;
+  return isolate->debug()->return_value();
+}
+
 RUNTIME_FUNCTION(Runtime_DebugBreakAtEntry) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -811,6 +858,10 @@ RUNTIME_FUNCTION(Runtime_IncBlockCounter) {
   UNREACHABLE();  // Never called. See the IncBlockCounter builtin instead.
 }
 
+RUNTIME_FUNCTION(Runtime_IncCoverageInfoBlockCounter) {
+  UNREACHABLE();  // Never called. See the IncCoverageInfoBlockCounter builtin.
+}
+
 RUNTIME_FUNCTION(Runtime_DebugAsyncFunctionSuspended) {
   DCHECK_EQ(4, args.length());
   HandleScope scope(isolate);
@@ -6,6 +6,7 @@
 #include "src/common/globals.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/heap/heap-layout-inl.h"
 #include "src/objects/allocation-site-scopes-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-number-inl.h"
@@ -31,6 +32,48 @@ void PreInitializeLiteralSite(DirectHandle<FeedbackVector> vector,
   vector->SynchronizedSet(slot, Smi::FromInt(1));
 }
 
+// Remembers the boilerplate description that {site} was created for, so that
+// the code cache can record whether the literal got pretenured.
+void RecordLiteralAllocationSite(Isolate* isolate,
+                                 DirectHandle<FeedbackVector> vector,
+                                 DirectHandle<AllocationSite> site,
+                                 DirectHandle<HeapObject> description) {
+  if (HeapLayout::InReadOnlySpace(*description)) return;
+  Tagged<Object> maybe_script = vector->shared_function_info()->script();
+  if (!IsScript(maybe_script)) return;
+  DirectHandle<Script> script(Cast<Script>(maybe_script), isolate);
+
+  Handle<WeakArrayList> sites;
+  if (IsUndefined(script->literal_allocation_sites(), isolate)) {
+    sites = isolate->factory()->empty_weak_array_list();
+  } else {
+    sites = handle(Cast<WeakArrayList>(script->literal_allocation_sites()),
+                   isolate);
+    if (sites->length() + 2 > sites->capacity()) {
+      // Drop the entries whose AllocationSite died before growing the list.
+      DisallowGarbageCollection no_gc;
+      Tagged<WeakArrayList> raw = *sites;
+      int new_length = 0;
+      for (int i = 0; i < raw->length(); i += 2) {
+        if (raw->Get(i).IsCleared()) continue;
+        raw->Set(new_length, raw->Get(i));
+        raw->Set(new_length + 1, raw->Get(i + 1));
+        new_length += 2;
+      }
+      raw->set_length(new_length);
+    }
+  }
+  int length = sites->length();
+  sites = WeakArrayList::EnsureSpace(isolate, sites, length + 2,
+                                     AllocationType::kOld);
+  DisallowGarbageCollection no_gc;
+  Tagged<WeakArrayList> raw = *sites;
+  raw->Set(length, MakeWeak(*site));
+  raw->Set(length + 1, *description);
+  raw->set_length(length + 2);
+  script->set_literal_allocation_sites(raw);
+}
+
 template <class ContextObject>
 class JSObjectWalkVisitor {
  public:
@@ -351,6 +394,9 @@ struct ObjectLiteralHelper {
     return CreateObjectLiteral(isolate, object_boilerplate_description, flags,
                                allocation);
   }
+  static inline bool HasPretenureHint(Tagged<HeapObject> description) {
+    return Cast<ObjectBoilerplateDescription>(description)->pretenure_hint();
+  }
 };
 
 struct ArrayLiteralHelper {
@@ -363,6 +409,9 @@ struct ArrayLiteralHelper {
     return CreateArrayLiteral(isolate, array_boilerplate_description,
                               allocation);
   }
+  static inline bool HasPretenureHint(Tagged<HeapObject> description) {
+    return Cast<ArrayBoilerplateDescription>(description)->pretenure_hint();
+  }
 };
 
 Handle<JSObject> CreateObjectLiteral(
@@ -557,6 +606,17 @@ MaybeDirectHandle<JSObject> CreateLiteral(Isolate* isolate,
     RETURN_ON_EXCEPTION(isolate, DeepWalk(boilerplate, &creation_context));
     creation_context.ExitScope(site, boilerplate);
 
+    if (V8_UNLIKELY(v8_flags.code_cache_pretenuring_decisions)) {
+      // Start out with the decision of the run that created the code cache,
+      // instead of copying long-lived literals through the young generation
+      // until enough feedback is collected again.
+      if (v8_flags.allocation_site_pretenuring &&
+          LiteralHelper::HasPretenureHint(*description)) {
+        site->set_pretenure_decision(AllocationSite::kTenure);
+      }
+      RecordLiteralAllocationSite(isolate, vector, site, description);
+    }
+
     vector->SynchronizedSet(literals_slot, *site);
   }
 
@@ -2,7 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include "src/base/atomicops.h"
+#include "src/base/macros.h"
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
@@ -11,6 +19,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/runtime/runtime-utils.h"
 #include "src/runtime/runtime.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
@@ -105,6 +114,91 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Arrays shorter than this are sorted with std::sort; below it the counting
+// passes and the temporary buffer of the radix sort do not pay off.
+constexpr size_t kMinRadixSortLength = 1024;
+
+template <typename T>
+struct RadixSortKey {
+  using type = std::make_unsigned_t<T>;
+};
+template <>
+struct RadixSortKey<float> {
+  using type = uint32_t;
+};
+template <>
+struct RadixSortKey<double> {
+  using type = uint64_t;
+};
+
+// Maps {value} to an unsigned key whose unsigned order matches CompareNum:
+// the sign bit of signed integers is flipped, negative floats have all their
+// bits flipped and non-negative floats only the sign bit, which also orders
+// -0 before +0. NaNs map to the largest key so they end up last.
+template <typename T>
+typename RadixSortKey<T>::type ToRadixSortKey(T value) {
+  using Key = typename RadixSortKey<T>::type;
+  constexpr Key kSignBit = Key{1} << (sizeof(Key) * kBitsPerByte - 1);
+  if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(value)) return std::numeric_limits<Key>::max();
+    Key bits = base::bit_cast<Key>(value);
+    return (bits & kSignBit) ? static_cast<Key>(~bits)
+                             : static_cast<Key>(bits | kSignBit);
+  } else if constexpr (std::is_signed_v<T>) {
+    return static_cast<Key>(value) ^ kSignBit;
+  } else {
+    return value;
+  }
+}
+
+// Stable LSD radix sort with one pass per key byte. {data} may be unaligned
+// for 8-byte elements when pointer compression is enabled (see
+// UnalignedSlot<T>), so all accesses to it go through unaligned loads and
+// stores. Passes in which every key has the same byte are skipped.
+template <typename T>
+void RadixSort(Address data, size_t length) {
+  using Key = typename RadixSortKey<T>::type;
+  constexpr int kPasses = sizeof(Key);
+  constexpr int kRadix = 1 << kBitsPerByte;
+  constexpr Key kDigitMask = kRadix - 1;
+
+  std::array<std::array<size_t, kRadix>, kPasses> counts = {};
+  for (size_t i = 0; i < length; i++) {
+    Key key =
+        ToRadixSortKey(base::ReadUnalignedValue<T>(data + i * sizeof(T)));
+    for (int pass = 0; pass < kPasses; pass++) {
+      counts[pass][(key >> (pass * kBitsPerByte)) & kDigitMask]++;
+    }
+  }
+
+  std::vector<T> buffer(length);
+  Address from = data;
+  Address to = reinterpret_cast<Address>(buffer.data());
+  for (int pass = 0; pass < kPasses; pass++) {
+    std::array<size_t, kRadix>& offsets = counts[pass];
+    if (std::find(offsets.begin(), offsets.end(), length) != offsets.end()) {
+      continue;
+    }
+    size_t offset = 0;
+    for (size_t& count : offsets) {
+      size_t bucket_size = count;
+      count = offset;
+      offset += bucket_size;
+    }
+    for (size_t i = 0; i < length; i++) {
+      T value = base::ReadUnalignedValue<T>(from + i * sizeof(T));
+      size_t digit = (ToRadixSortKey(value) >> (pass * kBitsPerByte)) &
+                     kDigitMask;
+      base::WriteUnalignedValue<T>(to + offsets[digit]++ * sizeof(T), value);
+    }
+    std::swap(from, to);
+  }
+  if (from != data) {
+    MemCopy(reinterpret_cast<void*>(data), reinterpret_cast<void*>(from),
+            length * sizeof(T));
+  }
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -160,7 +254,11 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
+    /* Float16 elements are stored as uint16_t bit patterns. */            \
+    if (length >= kMinRadixSortLength &&                                   \
+        kExternal##Type##Array != kExternalFloat16Array) {                 \
+      RadixSort<ctype>(reinterpret_cast<Address>(data), length);           \
+    } else if (kExternal##Type##Array == kExternalFloat64Array ||          \
         kExternal##Type##Array == kExternalFloat32Array ||                 \
         kExternal##Type##Array == kExternalFloat16Array) {                 \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
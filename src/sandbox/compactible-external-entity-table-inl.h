@@ -78,7 +78,7 @@ CompactibleExternalEntityTable<Entry, size>::FinishCompaction(
 }
 
 template <typename Entry, size_t size>
-void CompactibleExternalEntityTable<Entry, size>::MaybeCreateEvacuationEntry(
+void CompactibleExternalEntityTable<Entry, size>::MaybeEvacuateEntry(
     Space* space, uint32_t index, Address handle_location) {
   // Check if the entry should be evacuated for table compaction.
   // The current value of the start of the evacuation area is cached in a local
@@ -94,12 +94,14 @@ void CompactibleExternalEntityTable<Entry, size>::MaybeCreateEvacuationEntry(
     if (new_index) {
       DCHECK_LT(new_index, start_of_evacuation_area);
       DCHECK(space->Contains(new_index));
-      // Even though the new entry will only be accessed during sweeping, this
-      // still needs to be an atomic write as another thread may attempt (and
-      // fail) to allocate the same table entry, thereby causing a read from
-      // this memory location. Without an atomic store here, TSan would then
-      // complain about a data race.
-      Base::at(new_index).MakeEvacuationEntry(handle_location);
+      // Evacuate the entry right away so that only the handle needs to be
+      // updated during sweeping. The copy is written atomically as another
+      // thread may attempt (and fail) to allocate the same table entry,
+      // thereby causing a read from this memory location. The copy is marked
+      // so that it survives sweeping even if the handle is not updated in the
+      // end, in which case it is freed explicitly.
+      Base::at(index).CopyForEvacuation(Base::at(new_index));
+      space->AddEvacuatedEntry(handle_location, index, new_index);
     } else {
       // In this case, the application has allocated a sufficiently large
       // number of entries from the freelist so that new entries would now be
@@ -118,6 +120,7 @@ template <typename Entry, size_t size>
 void CompactibleExternalEntityTable<Entry, size>::Space::StartCompacting(
     uint32_t start_of_evacuation_area) {
   DCHECK_EQ(invalidated_fields_.size(), 0);
+  DCHECK_EQ(evacuated_entries_.size(), 0);
   start_of_evacuation_area_.store(start_of_evacuation_area,
                                   std::memory_order_relaxed);
 }
@@ -175,6 +178,13 @@ void CompactibleExternalEntityTable<Entry, size>::Space::AddInvalidatedField(
   }
 }
 
+template <typename Entry, size_t size>
+void CompactibleExternalEntityTable<Entry, size>::Space::AddEvacuatedEntry(
+    Address handle_location, uint32_t old_index, uint32_t new_index) {
+  base::SpinningMutexGuard guard(&evacuated_entries_mutex_);
+  evacuated_entries_.push_back({handle_location, old_index, new_index});
+}
+
 template <typename Entry, size_t size>
 void CompactibleExternalEntityTable<Entry,
                                     size>::Space::StartCompactingIfNeeded() {
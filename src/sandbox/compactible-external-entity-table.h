@@ -54,12 +54,21 @@ enum class ExternalEntityTableCompactionOutcome {
  *    simple compaction invariant: compaction always moves an entry at or above
  *    the threshold to a new position before the threshold.
  *  - During marking, whenever a live entry inside the evacuation area is
- *    found, a new "evacuation entry" is allocated from the freelist (which is
- *    assumed to have enough free slots) and the address of the handle in the
- *    object owning the table entry is written into it.
- *  - During sweeping, these evacuation entries are resolved: the content of
- *    the old entry is copied into the new entry and the handle in the object
- *    is updated to point to the new entry.
+ *    found, a new entry is allocated from the freelist (which is assumed to
+ *    have enough free slots) and the content of the old entry is copied into
+ *    it right away, on whichever thread found the entry. The address of the
+ *    handle in the object owning the table entry is remembered together with
+ *    the old and the new entry index.
+ *  - During sweeping, only the handles are fixed up: each remembered handle is
+ *    updated to point to the new entry, and the old entry is invalidated.
+ *
+ * The old entry stays in use by the mutator until its handle is updated. The
+ * mutator may therefore still write to it after it was copied. Such races are
+ * caught when fixing up the handles: if the old entry no longer holds what was
+ * copied, the copy is refreshed. Similarly, handles that no longer reference
+ * the old entry, e.g. because the field was invalidated, the owning object was
+ * freed by the Scavenger, or the entry was already evacuated before, are not
+ * updated and the new entry is freed again.
  *
  * When compacting, it is expected that the evacuation area contains few live
  * entries and that the freelist will be able to serve all evacuation entry
@@ -125,6 +134,17 @@ class V8_EXPORT_PRIVATE CompactibleExternalEntityTable
     inline void ClearInvalidatedFields();
     inline void AddInvalidatedField(Address field_address);
 
+    // An entry that was copied out of the evacuation area during marking, but
+    // whose handle still needs to be updated.
+    struct EvacuatedEntry {
+      Address handle_location;
+      uint32_t old_index;
+      uint32_t new_index;
+    };
+
+    inline void AddEvacuatedEntry(Address handle_location, uint32_t old_index,
+                                  uint32_t new_index);
+
     // This value indicates that this space is not currently being compacted. It
     // is set to uint32_t max so that determining whether an entry should be
     // evacuated becomes a single comparison:
@@ -161,6 +181,13 @@ class V8_EXPORT_PRIVATE CompactibleExternalEntityTable
 
     // Mutex guarding access to the invalidated_fields_ set.
     base::SpinningMutex invalidated_fields_mutex_;
+
+    // Entries that have been evacuated during marking and whose handles are
+    // updated during sweeping. Only used when table compaction is running.
+    std::vector<EvacuatedEntry> evacuated_entries_;
+
+    // Mutex guarding access to evacuated_entries_.
+    base::SpinningMutex evacuated_entries_mutex_;
   };
 
   // Allocate an EPT entry from the space's freelist, or add a freshly-allocated
@@ -170,8 +197,13 @@ class V8_EXPORT_PRIVATE CompactibleExternalEntityTable
 
   CompactionResult FinishCompaction(Space* space, Histogram* counter);
 
-  inline void MaybeCreateEvacuationEntry(Space* space, uint32_t index,
-                                         Address handle_location);
+  // If the entry is inside the evacuation area of a compacting space, copies
+  // it to a new entry below the evacuation area and remembers the handle
+  // location so that the handle can be updated during sweeping.
+  //
+  // This method is atomic and can be called from background threads.
+  inline void MaybeEvacuateEntry(Space* space, uint32_t index,
+                                 Address handle_location);
 };
 
 }  // namespace internal
@@ -87,16 +87,6 @@ void CppHeapPointerTableEntry::Mark() {
   USE(success);
 }
 
-void CppHeapPointerTableEntry::MakeEvacuationEntry(Address handle_location) {
-  Payload new_payload(handle_location, CppHeapPointerTag::kEvacuationEntryTag);
-  payload_.store(new_payload, std::memory_order_relaxed);
-}
-
-bool CppHeapPointerTableEntry::HasEvacuationEntry() const {
-  auto payload = payload_.load(std::memory_order_relaxed);
-  return payload.ContainsEvacuationEntry();
-}
-
 void CppHeapPointerTableEntry::Evacuate(CppHeapPointerTableEntry& dest) {
   auto payload = payload_.load(std::memory_order_relaxed);
   // We expect to only evacuate entries containing external pointers.
@@ -114,6 +104,23 @@ void CppHeapPointerTableEntry::Evacuate(CppHeapPointerTableEntry& dest) {
   MakeZappedEntry();
 }
 
+void CppHeapPointerTableEntry::CopyForEvacuation(
+    CppHeapPointerTableEntry& dest) const {
+  auto payload = payload_.load(std::memory_order_relaxed);
+  DCHECK(payload.ContainsPointer());
+  payload.SetMarkBit();
+  dest.payload_.store(payload, std::memory_order_relaxed);
+}
+
+bool CppHeapPointerTableEntry::HasSameContentAs(
+    const CppHeapPointerTableEntry& other) const {
+  auto payload = payload_.load(std::memory_order_relaxed);
+  auto other_payload = other.payload_.load(std::memory_order_relaxed);
+  payload.SetMarkBit();
+  other_payload.SetMarkBit();
+  return payload == other_payload;
+}
+
 Address CppHeapPointerTable::Get(CppHeapPointerHandle handle,
                                  CppHeapPointerTagRange tag_range) const {
   uint32_t index = HandleToIndex(handle);
@@ -161,11 +168,11 @@ void CppHeapPointerTable::Mark(Space* space, CppHeapPointerHandle handle,
   DCHECK(space->Contains(index));
 
   // If the table is being compacted and the entry is inside the evacuation
-  // area, then allocate and set up an evacuation entry for it.
-  MaybeCreateEvacuationEntry(space, index, handle_location);
+  // area, then evacuate it to a new entry.
+  MaybeEvacuateEntry(space, index, handle_location);
 
-  // Even if the entry is marked for evacuation, it still needs to be marked as
-  // alive as it may be visited during sweeping before being evacuation.
+  // Even if the entry was evacuated, it still needs to be marked as alive as
+  // the mutator keeps using it until its handle is updated during sweeping.
   at(index).Mark();
 }
 
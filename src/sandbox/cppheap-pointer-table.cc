@@ -40,7 +40,7 @@ uint32_t CppHeapPointerTable::SweepAndCompact(Space* space,
   if (space->IsCompacting()) {
     if (space->CompactingWasAborted()) {
       // Extract the original start_of_evacuation_area value so that the
-      // DCHECKs below and in TryResolveEvacuationEntryDuringSweeping work.
+      // DCHECKs in FixUpEvacuatedEntryHandles work.
       start_of_evacuation_area &= ~Space::kCompactionAbortedMarker;
     } else {
       evacuation_was_successful = true;
@@ -50,12 +50,17 @@ uint32_t CppHeapPointerTable::SweepAndCompact(Space* space,
     space->StopCompacting();
   }
 
+  // Update the handles of all entries that were evacuated during marking. This
+  // must happen before sweeping so that the old entries are no longer
+  // referenced.
+  FixUpEvacuatedEntryHandles(space, start_of_evacuation_area);
+
   // Sweep top to bottom and rebuild the freelist from newly dead and
   // previously freed entries while also clearing the marking bit on live
-  // entries and resolving evacuation entries table when compacting the table.
-  // This way, the freelist ends up sorted by index which already makes the
-  // table somewhat self-compacting and is required for the compaction
-  // algorithm so that evacuated entries are evacuated to the start of a space.
+  // entries. This way, the freelist ends up sorted by index which already
+  // makes the table somewhat self-compacting and is required for the
+  // compaction algorithm so that evacuated entries are evacuated to the start
+  // of a space.
   // This method must run either on the mutator thread or while the mutator is
   // stopped.
   uint32_t current_freelist_head = 0;
@@ -71,6 +76,14 @@ uint32_t CppHeapPointerTable::SweepAndCompact(Space* space,
     bool segment_will_be_evacuated =
         evacuation_was_successful &&
         segment.first_entry() >= start_of_evacuation_area;
+    // Segments that will be evacuated only contain dead and zapped entries
+    // now. As the CppHeapPointerTable does not own any resources, there is no
+    // need to sweep them.
+    if (segment_will_be_evacuated) {
+      segments_to_deallocate.push_back(segment);
+      continue;
+    }
+
     // Remember the state of the freelist before this segment in case this
     // segment turns out to be completely empty and we deallocate it.
     uint32_t previous_freelist_head = current_freelist_head;
@@ -79,59 +92,19 @@ uint32_t CppHeapPointerTable::SweepAndCompact(Space* space,
     // Process every entry in this segment, again going top to bottom.
     for (uint32_t i = segment.last_entry(); i >= segment.first_entry(); i--) {
       auto payload = at(i).GetRawPayload();
-      if (payload.ContainsEvacuationEntry()) {
-        // Segments that will be evacuated cannot contain evacuation entries
-        // into which other entries would be evacuated.
-        DCHECK(!segment_will_be_evacuated);
-
-        // An evacuation entry contains the address of the slot that owns the
-        // entry that is to be evacuated.
-        Address handle_location =
-            payload.ExtractEvacuationEntryHandleLocation();
-
-        // The CppHeapPointerTable does not support field invalidation.
-        DCHECK(!space->FieldWasInvalidated(handle_location));
-
-        // Resolve the evacuation entry: take the pointer to the handle from the
-        // evacuation entry, copy the entry to its new location, and finally
-        // update the handle to point to the new entry.
-        //
-        // While we now know that the entry being evacuated is free, we don't
-        // add it to (the start of) the freelist because that would immediately
-        // cause new fragmentation when the next entry is allocated. Instead, we
-        // assume that the segments out of which entries are evacuated will all
-        // be decommitted anyway after this loop, which is usually the case
-        // unless compaction was already aborted during marking.
-        ResolveEvacuationEntryDuringSweeping(
-            i, reinterpret_cast<CppHeapPointerHandle*>(handle_location),
-            start_of_evacuation_area);
-
-        // The entry must now contain a pointer and be unmarked as the entry
-        // that was evacuated must have been processed already (it is in an
-        // evacuated segment, which are processed first as they are at the end
-        // of the space). This will have cleared the marking bit.
-        DCHECK(at(i).GetRawPayload().ContainsPointer());
-        DCHECK(!at(i).GetRawPayload().HasMarkBitSet());
-      } else if (!payload.HasMarkBitSet()) {
+      if (!payload.HasMarkBitSet()) {
         AddToFreelist(i);
       } else {
         auto new_payload = payload;
         new_payload.ClearMarkBit();
         at(i).SetRawPayload(new_payload);
       }
-
-      // We must have resolved all evacuation entries. Otherwise, we'll try to
-      // process them again during the next GC, which would cause problems.
-      DCHECK(!at(i).HasEvacuationEntry());
     }
 
-    // If a segment is completely empty, or if all live entries will be
-    // evacuated out of it at the end of this loop, free the segment.
-    // Note: for segments that will be evacuated, we could avoid building up a
-    // freelist, but it's probably not worth the effort.
+    // If a segment is completely empty, free the segment.
     uint32_t free_entries = current_freelist_length - previous_freelist_length;
     bool segment_is_empty = free_entries == kEntriesPerSegment;
-    if (segment_is_empty || segment_will_be_evacuated) {
+    if (segment_is_empty) {
       segments_to_deallocate.push_back(segment);
       // Restore the state of the freelist before this segment.
       current_freelist_head = previous_freelist_head;
@@ -154,22 +127,43 @@ uint32_t CppHeapPointerTable::SweepAndCompact(Space* space,
   return num_live_entries;
 }
 
-void CppHeapPointerTable::ResolveEvacuationEntryDuringSweeping(
-    uint32_t new_index, CppHeapPointerHandle* handle_location,
-    uint32_t start_of_evacuation_area) {
-  CppHeapPointerHandle old_handle = *handle_location;
-  CHECK(IsValidHandle(old_handle));
-
-  uint32_t old_index = HandleToIndex(old_handle);
-  CppHeapPointerHandle new_handle = IndexToHandle(new_index);
-
-  // The compaction algorithm always moves an entry from the evacuation area to
-  // the front of the table. These DCHECKs verify this invariant.
-  DCHECK_GE(old_index, start_of_evacuation_area);
-  DCHECK_LT(new_index, start_of_evacuation_area);
-  auto& new_entry = at(new_index);
-  at(old_index).Evacuate(new_entry);
-  *handle_location = new_handle;
+void CppHeapPointerTable::FixUpEvacuatedEntryHandles(
+    Space* space, uint32_t start_of_evacuation_area) {
+  space->invalidated_fields_mutex_.AssertHeld();
+  base::SpinningMutexGuard guard(&space->evacuated_entries_mutex_);
+
+  for (const Space::EvacuatedEntry& entry : space->evacuated_entries_) {
+    const uint32_t old_index = entry.old_index;
+    const uint32_t new_index = entry.new_index;
+    // The compaction algorithm always moves an entry from the evacuation area
+    // to the front of the table. These DCHECKs verify this invariant.
+    DCHECK_GE(old_index, start_of_evacuation_area);
+    DCHECK_LT(new_index, start_of_evacuation_area);
+    USE(start_of_evacuation_area);
+
+    // The CppHeapPointerTable does not support field invalidation.
+    DCHECK(!space->FieldWasInvalidated(entry.handle_location));
+
+    // If the slot no longer references the old entry (for example because the
+    // entry was evacuated twice), the copy is dead and freed during sweeping.
+    auto* handle_location =
+        reinterpret_cast<CppHeapPointerHandle*>(entry.handle_location);
+    if (*handle_location != IndexToHandle(old_index)) {
+      at(new_index).MakeZappedEntry();
+      continue;
+    }
+
+    // The mutator may have written to the old entry after it was copied. In
+    // that case, the copy is stale and needs to be refreshed.
+    CppHeapPointerTableEntry& old_entry = at(old_index);
+    CppHeapPointerTableEntry& new_entry = at(new_index);
+    if (V8_UNLIKELY(!old_entry.HasSameContentAs(new_entry))) {
+      old_entry.CopyForEvacuation(new_entry);
+    }
+    old_entry.MakeZappedEntry();
+    *handle_location = IndexToHandle(new_index);
+  }
+  space->evacuated_entries_.clear();
 }
 
 }  // namespace internal
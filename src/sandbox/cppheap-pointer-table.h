@@ -32,10 +32,7 @@ class Counters;
  *  - A "regular" entry, containing the pointer together with a type tag and
  *    the marking bit, or
  *  - A freelist entry, tagged with the kFreeEntryTag and containing the index
- *    of the next free entry, or
- *  - An evacuation entry, tagged with the kEvacuationEntryTag and containing
- *    the address of the CppHeapPointerSlot referencing the entry that will be
- *    evacuated into this entry.
+ *    of the next free entry.
  */
 struct CppHeapPointerTableEntry {
   // Make this entry a cpp heap pointer entry containing the given pointer
@@ -71,18 +68,20 @@ struct CppHeapPointerTableEntry {
   // for efficient entry allocation, see TryAllocateEntryFromFreelist.
   inline uint32_t GetNextFreelistEntryIndex() const;
 
-  // Make this entry an evacuation entry containing the address of the handle to
-  // the entry being evacuated.
-  inline void MakeEvacuationEntry(Address handle_location);
-
-  // Returns true if this entry contains an evacuation entry.
-  inline bool HasEvacuationEntry() const;
-
   // Move the content of this entry into the provided entry, possibly clearing
   // the marking bit. Used during table compaction and during promotion.
   // Invalidates the source entry.
   inline void Evacuate(CppHeapPointerTableEntry& dest);
 
+  // Copy the content of this entry into the provided entry and mark the copy
+  // as alive. Used during table compaction while marking. Unlike Evacuate(),
+  // this leaves the source entry intact as it may still be in use.
+  inline void CopyForEvacuation(CppHeapPointerTableEntry& dest) const;
+
+  // Returns true if this entry and the provided entry contain the same value,
+  // ignoring the marking bit.
+  inline bool HasSameContentAs(const CppHeapPointerTableEntry& other) const;
+
   // Mark this entry as alive during table garbage collection.
   inline void Mark();
 
@@ -280,9 +279,9 @@ class V8_EXPORT_PRIVATE CppHeapPointerTable
   static inline uint32_t HandleToIndex(CppHeapPointerHandle handle);
   static inline CppHeapPointerHandle IndexToHandle(uint32_t index);
 
-  void ResolveEvacuationEntryDuringSweeping(
-      uint32_t index, CppHeapPointerHandle* handle_location,
-      uint32_t start_of_evacuation_area);
+  // Updates the handles of all entries that were evacuated while marking.
+  void FixUpEvacuatedEntryHandles(Space* space,
+                                  uint32_t start_of_evacuation_area);
 };
 
 static_assert(sizeof(CppHeapPointerTable) == CppHeapPointerTable::kSize);
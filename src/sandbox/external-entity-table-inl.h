@@ -316,37 +316,67 @@ uint32_t ExternalEntityTable<Entry, size>::GenericSweep(Space* space,
 
   // Here we can iterate over the segments collection without taking a lock
   // because no other thread can currently allocate entries in this space.
-  uint32_t current_freelist_head = 0;
-  uint32_t current_freelist_length = 0;
+  //
+  // Every segment first gets a freelist of its own. These are then linked
+  // together such that the free entries of densely populated segments come
+  // before those of sparsely populated ones. Entries are never moved, but
+  // this way sparse segments receive no new entries while there is space
+  // elsewhere, so they can drain and eventually be freed, and live entries
+  // end up packed into fewer segments.
+  struct SegmentFreelist {
+    uint32_t head;
+    uint32_t tail;
+    uint32_t length;
+  };
+  static constexpr uint32_t kSparseSegmentMaxLiveEntries =
+      kEntriesPerSegment / 4;
+  std::vector<SegmentFreelist> dense_segment_freelists;
+  std::vector<SegmentFreelist> sparse_segment_freelists;
   std::vector<Segment> segments_to_deallocate;
 
   for (auto segment : base::Reversed(space->segments_)) {
-    // Remember the state of the freelist before this segment in case this
-    // segment turns out to be completely empty and we deallocate it.
-    uint32_t previous_freelist_head = current_freelist_head;
-    uint32_t previous_freelist_length = current_freelist_length;
+    uint32_t segment_freelist_head = 0;
+    uint32_t segment_freelist_tail = 0;
+    uint32_t free_entries = 0;
 
     // Process every entry in this segment, again going top to bottom.
     for (WriteIterator it = this->iter_at(segment.last_entry());
          it.index() >= segment.first_entry(); --it) {
       if (!it->IsMarked()) {
-        it->MakeFreelistEntry(current_freelist_head);
-        current_freelist_head = it.index();
-        current_freelist_length++;
+        it->MakeFreelistEntry(segment_freelist_head);
+        if (free_entries == 0) segment_freelist_tail = it.index();
+        segment_freelist_head = it.index();
+        free_entries++;
       } else {
         callback(*it);
         it->Unmark();
       }
     }
 
+    if (free_entries == 0) continue;
     // If a segment is completely empty, free it.
-    uint32_t free_entries = current_freelist_length - previous_freelist_length;
-    bool segment_is_empty = free_entries == kEntriesPerSegment;
-    if (segment_is_empty) {
+    if (free_entries == kEntriesPerSegment) {
       segments_to_deallocate.push_back(segment);
-      // Restore the state of the freelist before this segment.
-      current_freelist_head = previous_freelist_head;
-      current_freelist_length = previous_freelist_length;
+      continue;
+    }
+    uint32_t live_entries = kEntriesPerSegment - free_entries;
+    auto& freelists = live_entries <= kSparseSegmentMaxLiveEntries
+                          ? sparse_segment_freelists
+                          : dense_segment_freelists;
+    freelists.push_back(
+        {segment_freelist_head, segment_freelist_tail, free_entries});
+  }
+
+  // The segment freelists were collected top to bottom, so prepending them in
+  // that order keeps both groups sorted.
+  uint32_t current_freelist_head = 0;
+  uint32_t current_freelist_length = 0;
+  for (std::vector<SegmentFreelist>* freelists :
+       {&sparse_segment_freelists, &dense_segment_freelists}) {
+    for (const SegmentFreelist& freelist : *freelists) {
+      this->iter_at(freelist.tail)->MakeFreelistEntry(current_freelist_head);
+      current_freelist_head = freelist.head;
+      current_freelist_length += freelist.length;
     }
   }
 
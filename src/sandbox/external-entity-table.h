@@ -192,8 +192,9 @@ class V8_EXPORT_PRIVATE ExternalEntityTable
   // Sweeps the given space.
   //
   // This will free all unmarked entries to the freelist and unmark all live
-  // entries. The table is swept top-to-bottom so that the freelist ends up
-  // sorted. During sweeping, new entries must not be allocated.
+  // entries. The freelist ends up sorted, except that the entries of sparsely
+  // populated segments come last so that these segments can drain. During
+  // sweeping, new entries must not be allocated.
   //
   // This is a generic implementation of table sweeping and requires that the
   // Entry type implements the following additional methods:
@@ -123,16 +123,6 @@ void ExternalPointerTableEntry::Mark() {
   USE(success);
 }
 
-void ExternalPointerTableEntry::MakeEvacuationEntry(Address handle_location) {
-  Payload new_payload(handle_location, kExternalPointerEvacuationEntryTag);
-  payload_.store(new_payload, std::memory_order_relaxed);
-}
-
-bool ExternalPointerTableEntry::HasEvacuationEntry() const {
-  auto payload = payload_.load(std::memory_order_relaxed);
-  return payload.ContainsEvacuationEntry();
-}
-
 void ExternalPointerTableEntry::Evacuate(ExternalPointerTableEntry& dest,
                                          EvacuateMarkMode mode) {
   auto payload = payload_.load(std::memory_order_relaxed);
@@ -160,6 +150,26 @@ void ExternalPointerTableEntry::Evacuate(ExternalPointerTableEntry& dest,
   MakeZappedEntry();
 }
 
+void ExternalPointerTableEntry::CopyForEvacuation(
+    ExternalPointerTableEntry& dest) const {
+  auto payload = payload_.load(std::memory_order_relaxed);
+  DCHECK(payload.ContainsPointer());
+  payload.SetMarkBit();
+  dest.payload_.store(payload, std::memory_order_relaxed);
+#if defined(LEAK_SANITIZER)
+  dest.raw_pointer_for_lsan_ = raw_pointer_for_lsan_;
+#endif  // LEAK_SANITIZER
+}
+
+bool ExternalPointerTableEntry::HasSameContentAs(
+    const ExternalPointerTableEntry& other) const {
+  auto payload = payload_.load(std::memory_order_relaxed);
+  auto other_payload = other.payload_.load(std::memory_order_relaxed);
+  payload.SetMarkBit();
+  other_payload.SetMarkBit();
+  return payload == other_payload;
+}
+
 Address ExternalPointerTable::Get(ExternalPointerHandle handle,
                                   ExternalPointerTagRange tag_range) const {
   uint32_t index = HandleToIndex(handle);
@@ -237,11 +247,11 @@ void ExternalPointerTable::Mark(Space* space, ExternalPointerHandle handle,
   DCHECK(space->Contains(index));
 
   // If the table is being compacted and the entry is inside the evacuation
-  // area, then allocate and set up an evacuation entry for it.
-  MaybeCreateEvacuationEntry(space, index, handle_location);
+  // area, then evacuate it to a new entry.
+  MaybeEvacuateEntry(space, index, handle_location);
 
-  // Even if the entry is marked for evacuation, it still needs to be marked as
-  // alive as it may be visited during sweeping before being evacuation.
+  // Even if the entry was evacuated, it still needs to be marked as alive as
+  // the mutator keeps using it until its handle is updated during sweeping.
   at(index).Mark();
 }
 
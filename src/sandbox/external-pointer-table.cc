@@ -129,16 +129,25 @@ uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
     FreelistHead empty_freelist;
     from_space->freelist_head_.store(empty_freelist, std::memory_order_relaxed);
 
+    // Entries evacuated within from_space must be fixed up while its
+    // invalidated fields are still available.
+    FixUpEvacuatedEntryHandles(from_space,
+                               from_space_compaction.start_of_evacuation_area);
+
     for (Address field : from_space->invalidated_fields_)
       space->invalidated_fields_.push_back(field);
     from_space->ClearInvalidatedFields();
   }
 
+  // Update the handles of all entries that were evacuated during marking. This
+  // must happen before sweeping so that the old entries are no longer
+  // referenced.
+  FixUpEvacuatedEntryHandles(space, space_compaction.start_of_evacuation_area);
+
   // Sweep top to bottom and rebuild the freelist from newly dead and
   // previously freed entries while also clearing the marking bit on live
-  // entries and resolving evacuation entries table when compacting the table.
-  // This way, the freelist ends up sorted by index which already makes the
-  // table somewhat self-compacting and is required for the compaction
+  // entries. This way, the freelist ends up sorted by index which already makes
+  // the table somewhat self-compacting and is required for the compaction
   // algorithm so that evacuated entries are evacuated to the start of a space.
   // This method must run either on the mutator thread or while the mutator is
   // stopped.
@@ -167,57 +176,7 @@ uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
     // Process every entry in this segment, again going top to bottom.
     for (uint32_t i = segment.last_entry(); i >= segment.first_entry(); i--) {
       auto payload = at(i).GetRawPayload();
-      if (payload.ContainsEvacuationEntry()) {
-        // Segments that will be evacuated cannot contain evacuation entries
-        // into which other entries would be evacuated.
-        DCHECK(!segment_will_be_evacuated);
-
-        // An evacuation entry contains the address of the external pointer
-        // field that owns the entry that is to be evacuated.
-        Address handle_location =
-            payload.ExtractEvacuationEntryHandleLocation();
-
-        // The evacuation entry may be invalidated by the Scavenger that has
-        // freed the object.
-        if (handle_location == kNullAddress) {
-          AddToFreelist(i);
-          continue;
-        }
-
-        // The external pointer field may have been invalidated in the meantime
-        // (for example if the host object has been in-place converted to a
-        // different type of object). In that case, the field no longer
-        // contains an external pointer handle and we therefore cannot evacuate
-        // the old entry. This is fine as the entry is guaranteed to be dead.
-        if (space->FieldWasInvalidated(handle_location)) {
-          // In this case, we must, however, free the evacuation entry.
-          // Otherwise, we would be left with effectively a stale evacuation
-          // entry that we'd try to process again during the next GC.
-          AddToFreelist(i);
-          continue;
-        }
-
-        // Resolve the evacuation entry: take the pointer to the handle from the
-        // evacuation entry, copy the entry to its new location, and finally
-        // update the handle to point to the new entry.
-        //
-        // While we now know that the entry being evacuated is free, we don't
-        // add it to (the start of) the freelist because that would immediately
-        // cause new fragmentation when the next entry is allocated. Instead, we
-        // assume that the segments out of which entries are evacuated will all
-        // be decommitted anyway after this loop, which is usually the case
-        // unless compaction was already aborted during marking.
-        ResolveEvacuationEntryDuringSweeping(
-            i, reinterpret_cast<ExternalPointerHandle*>(handle_location),
-            compaction.start_of_evacuation_area);
-
-        // The entry must now contain an external pointer and be unmarked as
-        // the entry that was evacuated must have been processed already (it
-        // is in an evacuated segment, which are processed first as they are
-        // at the end of the space). This will have cleared the marking bit.
-        DCHECK(at(i).HasExternalPointer(kAnyExternalPointerTagRange));
-        DCHECK(!at(i).GetRawPayload().HasMarkBitSet());
-      } else if (!payload.HasMarkBitSet()) {
+      if (!payload.HasMarkBitSet()) {
         FreeManagedResourceIfPresent(i);
         AddToFreelist(i);
       } else {
@@ -225,10 +184,6 @@ uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
         new_payload.ClearMarkBit();
         at(i).SetRawPayload(new_payload);
       }
-
-      // We must have resolved all evacuation entries. Otherwise, we'll try to
-      // process them again during the next GC, which would cause problems.
-      DCHECK(!at(i).HasEvacuationEntry());
     }
 
     // If a segment is completely empty, or if all live entries will be
@@ -283,33 +238,64 @@ uint32_t ExternalPointerTable::Sweep(Space* space, Counters* counters) {
   return SweepAndCompact(space, counters);
 }
 
-void ExternalPointerTable::ResolveEvacuationEntryDuringSweeping(
-    uint32_t new_index, ExternalPointerHandle* handle_location,
-    uint32_t start_of_evacuation_area) {
-  // We must have a valid handle here. If this fails, it might mean that an
-  // object with external pointers was in-place converted to another type of
-  // object without informing the external pointer table.
-  ExternalPointerHandle old_handle = *handle_location;
-  CHECK(IsValidHandle(old_handle));
-
-  uint32_t old_index = HandleToIndex(old_handle);
-  ExternalPointerHandle new_handle = IndexToHandle(new_index);
-
-  // The compaction algorithm always moves an entry from the evacuation area to
-  // the front of the table. These DCHECKs verify this invariant.
-  DCHECK_GE(old_index, start_of_evacuation_area);
-  DCHECK_LT(new_index, start_of_evacuation_area);
-  auto& new_entry = at(new_index);
-  at(old_index).Evacuate(new_entry, EvacuateMarkMode::kLeaveUnmarked);
-  *handle_location = new_handle;
-
-  // If this entry references a managed resource, update the resource to
-  // reference the new entry.
-  if (Address addr = at(new_index).ExtractManagedResourceOrNull()) {
-    ManagedResource* resource = reinterpret_cast<ManagedResource*>(addr);
-    DCHECK_EQ(resource->ept_entry_, old_handle);
-    resource->ept_entry_ = new_handle;
+void ExternalPointerTable::FixUpEvacuatedEntryHandles(
+    Space* space, uint32_t start_of_evacuation_area) {
+  space->invalidated_fields_mutex_.AssertHeld();
+  base::SpinningMutexGuard guard(&space->evacuated_entries_mutex_);
+
+  for (const Space::EvacuatedEntry& entry : space->evacuated_entries_) {
+    const uint32_t old_index = entry.old_index;
+    const uint32_t new_index = entry.new_index;
+    // The compaction algorithm always moves an entry from the evacuation area
+    // to the front of the table. These DCHECKs verify this invariant.
+    DCHECK_GE(old_index, start_of_evacuation_area);
+    DCHECK_LT(new_index, start_of_evacuation_area);
+    USE(start_of_evacuation_area);
+
+    // The handle is not updated if the object owning it has been freed by the
+    // Scavenger, if the external pointer field has been invalidated in the
+    // meantime (for example if the host object has been in-place converted to
+    // a different type of object), or if the field no longer references the
+    // old entry (for example if the entry was evacuated twice). In all these
+    // cases, the new entry must be freed again. Otherwise, we would be left
+    // with a leaked copy of the old entry.
+    Address handle_location = entry.handle_location;
+    auto* handle_ptr = reinterpret_cast<ExternalPointerHandle*>(handle_location);
+    const ExternalPointerHandle old_handle = IndexToHandle(old_index);
+    if (handle_location == kNullAddress ||
+        space->FieldWasInvalidated(handle_location) ||
+        *handle_ptr != old_handle) {
+      at(new_index).MakeZappedEntry();
+      continue;
+    }
+
+    // The mutator may have written to the old entry after it was copied. In
+    // that case, the copy is stale and needs to be refreshed.
+    ExternalPointerTableEntry& old_entry = at(old_index);
+    ExternalPointerTableEntry& new_entry = at(new_index);
+    if (V8_UNLIKELY(!old_entry.HasSameContentAs(new_entry))) {
+      old_entry.CopyForEvacuation(new_entry);
+    }
+
+    // The old entry is invalidated and freed during sweeping. We don't add it
+    // to (the start of) the freelist because that would immediately cause new
+    // fragmentation when the next entry is allocated. Instead, we assume that
+    // the segments out of which entries are evacuated will all be decommitted
+    // anyway after sweeping, which is usually the case unless compaction was
+    // aborted during marking.
+    old_entry.MakeZappedEntry();
+    ExternalPointerHandle new_handle = IndexToHandle(new_index);
+    *handle_ptr = new_handle;
+
+    // If this entry references a managed resource, update the resource to
+    // reference the new entry.
+    if (Address addr = new_entry.ExtractManagedResourceOrNull()) {
+      ManagedResource* resource = reinterpret_cast<ManagedResource*>(addr);
+      DCHECK_EQ(resource->ept_entry_, old_handle);
+      resource->ept_entry_ = new_handle;
+    }
   }
+  space->evacuated_entries_.clear();
 }
 
 void ExternalPointerTable::UpdateAllEvacuationEntries(
@@ -319,31 +305,12 @@ void ExternalPointerTable::UpdateAllEvacuationEntries(
 
   if (!space->IsCompacting()) return;
 
-  // Lock the space. Technically this is not necessary since no other thread can
-  // allocate entries at this point, but some of the methods we call on the
-  // space assert that the lock is held.
-  base::SpinningMutexGuard guard(&space->mutex_);
-  // Same for the invalidated fields mutex.
-  base::SpinningMutexGuard invalidated_fields_guard(
-      &space->invalidated_fields_mutex_);
+  // Lock the list of evacuated entries. Technically this is not necessary
+  // since no other thread can evacuate entries at this point.
+  base::SpinningMutexGuard guard(&space->evacuated_entries_mutex_);
 
-  const uint32_t start_of_evacuation_area =
-      space->start_of_evacuation_area_.load(std::memory_order_relaxed);
-
-  // Iterate until the start of evacuation area.
-  for (auto& segment : space->segments_) {
-    if (segment.first_entry() == start_of_evacuation_area) return;
-    for (uint32_t i = segment.first_entry(); i < segment.last_entry() + 1;
-         ++i) {
-      ExternalPointerTableEntry& entry = at(i);
-      ExternalPointerTableEntry::Payload payload = entry.GetRawPayload();
-      if (!payload.ContainsEvacuationEntry()) {
-        continue;
-      }
-      Address new_location =
-          function(payload.ExtractEvacuationEntryHandleLocation());
-      entry.MakeEvacuationEntry(new_location);
-    }
+  for (Space::EvacuatedEntry& entry : space->evacuated_entries_) {
+    entry.handle_location = function(entry.handle_location);
   }
 }
 
@@ -32,11 +32,7 @@ class ReadOnlyArtifacts;
  *  - A "regular" entry, containing the external pointer together with a type
  *    tag and the marking bit in the unused upper bits, or
  *  - A freelist entry, tagged with the kExternalPointerFreeEntryTag and
- *    containing the index of the next free entry in the lower 32 bits, or
- *  - An evacuation entry, tagged with the kExternalPointerEvacuationEntryTag
- *    and containing the address of the ExternalPointerSlot referencing the
- *    entry that will be evacuated into this entry. See the compaction
- *    algorithm overview for more details about these entries.
+ *    containing the index of the next free entry in the lower 32 bits.
  */
 struct ExternalPointerTableEntry {
   enum class EvacuateMarkMode { kTransferMark, kLeaveUnmarked, kClearMark };
@@ -87,18 +83,19 @@ struct ExternalPointerTableEntry {
   // for efficient entry allocation, see TryAllocateEntryFromFreelist.
   inline uint32_t GetNextFreelistEntryIndex() const;
 
-  // Make this entry an evacuation entry containing the address of the handle to
-  // the entry being evacuated.
-  inline void MakeEvacuationEntry(Address handle_location);
-
-  // Returns true if this entry contains an evacuation entry.
-  inline bool HasEvacuationEntry() const;
-
   // Move the content of this entry into the provided entry, possibly clearing
-  // the marking bit. Used during table compaction and during promotion.
-  // Invalidates the source entry.
+  // the marking bit. Used during promotion. Invalidates the source entry.
   inline void Evacuate(ExternalPointerTableEntry& dest, EvacuateMarkMode mode);
 
+  // Copy the content of this entry into the provided entry and mark the copy
+  // as alive. Unlike Evacuate(), this entry stays valid. Used during table
+  // compaction, see CompactibleExternalEntityTable.
+  inline void CopyForEvacuation(ExternalPointerTableEntry& dest) const;
+
+  // Returns true if the provided entry holds the same content as this entry,
+  // ignoring the marking bit.
+  inline bool HasSameContentAs(const ExternalPointerTableEntry& other) const;
+
   // Mark this entry as alive during table garbage collection.
   inline void Mark();
 
@@ -438,8 +435,8 @@ class V8_EXPORT_PRIVATE ExternalPointerTable
   uint32_t SweepAndCompact(Space* space, Counters* counters);
   uint32_t Sweep(Space* space, Counters* counters);
 
-  // Updates all evacuation entries with new handle locations. The function
-  // takes the old hanlde location and returns the new one.
+  // Updates the handle locations of all entries evacuated during marking. The
+  // function takes the old handle location and returns the new one.
   void UpdateAllEvacuationEntries(Space*, std::function<Address(Address)>);
 
   inline bool Contains(Space* space, ExternalPointerHandle handle) const;
@@ -484,9 +481,10 @@ class V8_EXPORT_PRIVATE ExternalPointerTable
       Address value, ExternalPointerHandle handle, ExternalPointerTag tag);
   inline void FreeManagedResourceIfPresent(uint32_t entry_index);
 
-  void ResolveEvacuationEntryDuringSweeping(
-      uint32_t index, ExternalPointerHandle* handle_location,
-      uint32_t start_of_evacuation_area);
+  // Updates the handles of the entries of `space` that were evacuated during
+  // marking. See CompactibleExternalEntityTable.
+  void FixUpEvacuatedEntryHandles(Space* space,
+                                  uint32_t start_of_evacuation_area);
 };
 
 static_assert(sizeof(ExternalPointerTable) == ExternalPointerTable::kSize);
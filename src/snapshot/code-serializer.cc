@@ -5,13 +5,16 @@
 #include "src/snapshot/code-serializer.h"
 
 #include <memory>
+#include <unordered_set>
 
+#include "src/base/hashing.h"
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/background-merge-task.h"
 #include "src/common/globals.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
@@ -19,10 +22,13 @@
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/allocation-site-inl.h"
+#include "src/objects/literal-objects-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/parsing/scanner-character-streams.h"
 #include "src/snapshot/object-deserializer.h"
 #include "src/snapshot/snapshot-utils.h"
 #include "src/snapshot/snapshot.h"
@@ -42,6 +48,64 @@ AlignedCachedData::AlignedCachedData(const uint8_t* data, int length)
   }
 }
 
+namespace {
+
+// Identifies the set of compiled functions of a script, and with it the
+// contents of its code cache up to details that do not matter for
+// deserialization.
+size_t CompiledFunctionsFingerprint(Isolate* isolate, Tagged<Script> script) {
+  size_t fingerprint = FlagList::Hash();
+  SharedFunctionInfo::ScriptIterator it(isolate, script);
+  for (Tagged<SharedFunctionInfo> sfi = it.Next(); !sfi.is_null();
+       sfi = it.Next()) {
+    if (!sfi->is_compiled()) continue;
+    fingerprint = base::hash_combine(fingerprint, sfi->function_literal_id());
+    if (v8_flags.profile_guided_optimization) {
+      fingerprint = base::hash_combine(
+          fingerprint, static_cast<size_t>(sfi->cached_tiering_decision()));
+    }
+  }
+  return fingerprint;
+}
+
+// Carries the pretenuring decisions of the script's literal allocation sites
+// over to the boilerplate descriptions, which are part of the code cache.
+// Returns whether any description changed.
+bool RecordPretenuringDecisions(Isolate* isolate, Tagged<Script> script) {
+  DisallowGarbageCollection no_gc;
+  if (IsUndefined(script->literal_allocation_sites(), isolate)) return false;
+  Tagged<WeakArrayList> sites =
+      Cast<WeakArrayList>(script->literal_allocation_sites());
+  bool changed = false;
+  for (int i = 0; i < sites->length(); i += 2) {
+    Tagged<HeapObject> site;
+    if (!sites->Get(i).GetHeapObjectIfWeak(&site)) continue;
+    // Undecided sites keep whatever the previous run decided.
+    AllocationSite::PretenureDecision decision =
+        Cast<AllocationSite>(site)->pretenure_decision();
+    if (decision != AllocationSite::kTenure &&
+        decision != AllocationSite::kDontTenure) {
+      continue;
+    }
+    bool hint = decision == AllocationSite::kTenure;
+    Tagged<HeapObject> description =
+        sites->Get(i + 1).GetHeapObjectAssumeStrong();
+    if (IsObjectBoilerplateDescription(description)) {
+      auto object_description = Cast<ObjectBoilerplateDescription>(description);
+      if (object_description->pretenure_hint() == hint) continue;
+      object_description->set_pretenure_hint(hint);
+    } else {
+      auto array_description = Cast<ArrayBoilerplateDescription>(description);
+      if (array_description->pretenure_hint() == hint) continue;
+      array_description->set_pretenure_hint(hint);
+    }
+    changed = true;
+  }
+  return changed;
+}
+
+}  // namespace
+
 CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
@@ -69,6 +133,32 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   if (script->ContainsAsmModule()) return nullptr;
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+  const bool recorded_pretenuring_decisions =
+      v8_flags.code_cache_pretenuring_decisions &&
+      RecordPretenuringDecisions(isolate, *script);
+
+  // Refreshing the cache of a script without newly compiled functions
+  // produces the same cache again, so hand out the previous one.
+  const bool use_memo =
+      v8_flags.reuse_unchanged_code_cache && info->is_toplevel();
+  size_t fingerprint = 0;
+  if (use_memo) {
+    HandleScope scope(isolate);
+    fingerprint = CompiledFunctionsFingerprint(isolate, *script);
+    CodeCacheMemo* memo = isolate->code_cache_memo();
+    if (memo != nullptr && !recorded_pretenuring_decisions &&
+        memo->script_id == script->id() && memo->fingerprint == fingerprint) {
+      int length = static_cast<int>(memo->data.size());
+      uint8_t* data = NewArray<uint8_t>(length);
+      CopyBytes(data, memo->data.data(), memo->data.size());
+      if (v8_flags.profile_deserialization) {
+        PrintF("[Reusing %d bytes of unchanged code cache]\n", length);
+      }
+      return new ScriptCompiler::CachedData(
+          data, length, ScriptCompiler::CachedData::BufferOwned);
+    }
+  }
+
   // Serialize code object.
   DirectHandle<String> source(Cast<String>(script->source()), isolate);
   DirectHandle<FixedArray> wrapped_arguments;
@@ -94,6 +184,14 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
     PrintF("[Serializing to %d bytes took %0.3f ms]\n", length, ms);
   }
 
+  if (use_memo) {
+    isolate->set_code_cache_memo(std::make_unique<CodeCacheMemo>(
+        CodeCacheMemo{script->id(), fingerprint,
+                      std::vector<uint8_t>(
+                          cached_data->data(),
+                          cached_data->data() + cached_data->length())}));
+  }
+
   ScriptCompiler::CachedData* result =
       new ScriptCompiler::CachedData(cached_data->data(), cached_data->length(),
                                      ScriptCompiler::CachedData::BufferOwned);
@@ -136,6 +234,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
   if (InstanceTypeChecker::IsScript(instance_type)) {
     DirectHandle<FixedArray> host_options;
     DirectHandle<UnionOf<Smi, Symbol, Undefined>> context_data;
+    DirectHandle<Object> literal_allocation_sites;
     {
       DisallowGarbageCollection no_gc;
       Tagged<Script> script_obj = Cast<Script>(*obj);
@@ -156,11 +255,17 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       host_options =
           direct_handle(script_obj->host_defined_options(), isolate());
       script_obj->set_host_defined_options(roots.empty_fixed_array());
+      // The allocation sites only live as long as the isolate, the decisions
+      // were recorded on the boilerplate descriptions.
+      literal_allocation_sites =
+          direct_handle(script_obj->literal_allocation_sites(), isolate());
+      script_obj->set_literal_allocation_sites(roots.undefined_value());
     }
     SerializeGeneric(obj, slot_type);
     {
       DisallowGarbageCollection no_gc;
       Tagged<Script> script_obj = Cast<Script>(*obj);
+      script_obj->set_literal_allocation_sites(*literal_allocation_sites);
       script_obj->set_host_defined_options(*host_options);
       script_obj->set_context_data(*context_data);
     }
@@ -188,7 +293,11 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
               debug_info->OriginalBytecodeArray(isolate()), isolate());
         }
       }
-      if (v8_flags.profile_guided_optimization) {
+      // Decisions to optimize early are only kept if requested: they are
+      // revalidated by the feedback collected before the early optimization,
+      // and are reset when the optimized code deoptimizes.
+      if (v8_flags.profile_guided_optimization &&
+          !v8_flags.code_cache_tiering_decisions) {
         cached_tiering_decision = sfi->cached_tiering_decision();
         if (cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
           sfi->set_cached_tiering_decision(
@@ -204,6 +313,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
                                   isolate());
     }
     if (v8_flags.profile_guided_optimization &&
+        !v8_flags.code_cache_tiering_decisions &&
         cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
       sfi->set_cached_tiering_decision(cached_tiering_decision);
     }
@@ -278,6 +388,10 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
   SerializeGeneric(obj, slot_type);
 }
 
+bool CodeSerializer::SerializesCompileHints() const {
+  return v8_flags.code_cache_compile_hints;
+}
+
 void CodeSerializer::SerializeGeneric(Handle<HeapObject> heap_object,
                                       SlotType slot_type) {
   // Object has not yet been serialized.  Serialize it here.
@@ -369,6 +483,47 @@ class StressOffThreadDeserializeThread final : public base::Thread {
   CodeSerializer::OffThreadDeserializeData off_thread_data_;
 };
 
+// Posts compile jobs for the functions that were lazily compiled before the
+// script was serialized, but whose bytecode isn't in the cache (e.g. because it
+// was flushed).
+void CompileHintedFunctions(Isolate* isolate, DirectHandle<Script> script) {
+  LazyCompileDispatcher* dispatcher = isolate->lazy_compile_dispatcher();
+  if (!dispatcher || !IsString(script->source()) ||
+      IsUndefined(script->compiled_lazy_function_positions(), isolate)) {
+    return;
+  }
+  std::unique_ptr<Utf16CharacterStream> stream(ScannerStream::For(
+      isolate, handle(Cast<String>(script->source()), isolate)));
+  if (!stream->can_be_cloned_for_parallel_access()) return;
+
+  std::unordered_set<int> hinted_positions;
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<ArrayList> positions =
+        Cast<ArrayList>(script->compiled_lazy_function_positions());
+    for (int i = 0; i < positions->length(); ++i) {
+      hinted_positions.insert(Smi::ToInt(positions->get(i)));
+    }
+  }
+
+  // Enqueueing a job allocates, so the functions are collected first.
+  std::vector<Handle<SharedFunctionInfo>> hinted_functions;
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info->is_compiled() || !info->HasUncompiledData() ||
+        !hinted_positions.contains(info->StartPosition())) {
+      continue;
+    }
+    hinted_functions.push_back(handle(info, isolate));
+  }
+  for (Handle<SharedFunctionInfo> shared_info : hinted_functions) {
+    if (dispatcher->IsEnqueued(shared_info)) continue;
+    dispatcher->Enqueue(isolate->main_thread_local_isolate(), shared_info,
+                        stream->Clone());
+  }
+}
+
 void FinalizeDeserialization(Isolate* isolate,
                              DirectHandle<SharedFunctionInfo> result,
                              const base::ElapsedTimer& timer,
@@ -392,6 +547,10 @@ void FinalizeDeserialization(Isolate* isolate,
     SetScriptFieldsFromDetails(isolate, *script, script_details, &no_gc);
   }
 
+  if (V8_UNLIKELY(v8_flags.code_cache_compile_hints)) {
+    CompileHintedFunctions(isolate, script);
+  }
+
   bool needs_source_positions = isolate->NeedsSourcePositions();
   if (!log_code_creation && !needs_source_positions) return;
 
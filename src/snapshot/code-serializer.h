@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <vector>
+
 #include "src/base/macros.h"
 #include "src/codegen/script-details.h"
 #include "src/snapshot/serializer.h"
@@ -50,6 +52,16 @@ class V8_EXPORT_PRIVATE AlignedCachedData {
   int length_;
 };
 
+// The code cache most recently produced for a top-level script, together with
+// a fingerprint of the compiled functions it contains. Refreshing the cache of
+// a script whose compiled functions did not change since then returns a copy
+// of this data instead of serializing the script again.
+struct CodeCacheMemo {
+  int script_id;
+  size_t fingerprint;
+  std::vector<uint8_t> data;
+};
+
 typedef v8::ScriptCompiler::CachedData::CompatibilityCheckResult
     SerializedCodeSanityCheckResult;
 
@@ -106,6 +118,7 @@ class CodeSerializer : public Serializer {
 
  private:
   void SerializeObjectImpl(Handle<HeapObject> o, SlotType slot_type) override;
+  bool SerializesCompileHints() const override;
 
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
@@ -4,8 +4,16 @@
 
 #include "src/snapshot/read-only-deserializer.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/base/platform/platform.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/memory-allocator.h"
 #include "src/heap/read-only-heap.h"
 #include "src/logging/counters-scopes.h"
 #include "src/objects/objects-inl.h"
@@ -13,21 +21,196 @@
 #include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/read-only-serializer-deserializer.h"
 #include "src/snapshot/snapshot-data.h"
+#include "src/snapshot/snapshot-utils.h"
+#include "src/utils/memcopy.h"
+#include "src/utils/version.h"
 
 namespace v8 {
 namespace internal {
 
+#ifdef V8_STATIC_ROOTS
+// A page-aligned image of the read-only space as it looks right after the
+// pages have been populated, i.e. before any process-specific data such as
+// external pointers has been written. With static roots, the read-only pages
+// are allocated at fixed offsets in the pointer compression cage, so the image
+// is the same in all processes using the same snapshot. Mapping it
+// copy-on-write instead of copying the objects allows these processes to share
+// all pages that are not written to later on through the page cache.
+class ReadOnlySpaceImage final {
+ public:
+  // Opens the image at `path` if it exists and was created from a snapshot
+  // with the given `checksum`.
+  static std::unique_ptr<ReadOnlySpaceImage> Open(const char* path,
+                                                  uint32_t checksum) {
+    std::unique_ptr<base::OS::MemoryMappedFile> file(
+        base::OS::MemoryMappedFile::open(
+            path, base::OS::MemoryMappedFile::FileMode::kReadOnly));
+    if (!file || file->size() < sizeof(Header)) return {};
+    std::unique_ptr<ReadOnlySpaceImage> image(
+        new ReadOnlySpaceImage(std::move(file)));
+    const Header* header = image->header();
+    if (header->magic != kMagic || header->version_hash != Version::Hash() ||
+        header->snapshot_checksum != checksum ||
+        header->page_size != MemoryAllocator::GetCommitPageSize() ||
+        image->file_->size() <
+            sizeof(Header) + header->page_count * sizeof(PageEntry)) {
+      return {};
+    }
+    for (uint32_t i = 0; i < header->page_count; i++) {
+      const PageEntry& entry = image->page_entries()[i];
+      if (!IsAligned(entry.file_offset, header->page_size) ||
+          entry.area_start > entry.area_end ||
+          entry.area_end > kRegularPageSize ||
+          entry.file_offset + entry.area_end > image->file_->size()) {
+        return {};
+      }
+    }
+    return image;
+  }
+
+  // Writes an image of the pages of `space` to `path`. The image is written to
+  // a temporary file first and then moved into place so that other processes
+  // never see a partially written image.
+  static void Write(const char* path, uint32_t checksum,
+                    const ReadOnlySpace* space) {
+    const size_t page_size = MemoryAllocator::GetCommitPageSize();
+    Header header;
+    header.magic = kMagic;
+    header.version_hash = Version::Hash();
+    header.snapshot_checksum = checksum;
+    header.page_size = static_cast<uint32_t>(page_size);
+    header.page_count = static_cast<uint32_t>(space->pages().size());
+
+    std::vector<PageEntry> entries;
+    size_t file_offset = RoundUp(
+        sizeof(Header) + header.page_count * sizeof(PageEntry), page_size);
+    for (const ReadOnlyPageMetadata* page : space->pages()) {
+      PageEntry entry;
+      entry.compressed_address =
+          V8HeapCompressionScheme::CompressAny(page->ChunkAddress());
+      entry.area_start =
+          static_cast<uint32_t>(page->Offset(page->area_start()));
+      entry.area_end = static_cast<uint32_t>(page->Offset(page->area_end()));
+      entry.file_offset = static_cast<uint32_t>(file_offset);
+      entries.push_back(entry);
+      file_offset += RoundUp(entry.area_end, page_size);
+    }
+
+    std::string temp_path =
+        std::string(path) + "." +
+        std::to_string(base::OS::GetCurrentProcessId()) + ".tmp";
+    FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+    if (file == nullptr) return;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(entries.data(), sizeof(PageEntry), entries.size(),
+                     file) == entries.size();
+    for (size_t i = 0; ok && i < entries.size(); i++) {
+      const ReadOnlyPageMetadata* page = space->pages()[i];
+      const PageEntry& entry = entries[i];
+      // The page header is process-specific and not part of the image.
+      ok = fseek(file, entry.file_offset + entry.area_start, SEEK_SET) == 0 &&
+           fwrite(reinterpret_cast<const void*>(page->area_start()),
+                  entry.area_end - entry.area_start, 1, file) == 1;
+    }
+    ok = fclose(file) == 0 && ok;
+    if (!ok || std::rename(temp_path.c_str(), path) != 0) {
+      base::OS::Remove(temp_path.c_str());
+    }
+  }
+
+  // Maps the image on top of the pages of `space`. The pages must have been
+  // allocated at the same addresses as the ones the image was created from.
+  void MapInto(const ReadOnlySpace* space) const {
+    const size_t page_size = MemoryAllocator::GetCommitPageSize();
+    CHECK_EQ(header()->page_count, space->pages().size());
+    const Address image_start = reinterpret_cast<Address>(file_->memory());
+    for (size_t i = 0; i < space->pages().size(); i++) {
+      const ReadOnlyPageMetadata* page = space->pages()[i];
+      const PageEntry& entry = page_entries()[i];
+      // With static roots, the page layout is fully determined by the
+      // snapshot which was verified to match when opening the image.
+      CHECK_EQ(entry.compressed_address,
+               V8HeapCompressionScheme::CompressAny(page->ChunkAddress()));
+      CHECK_EQ(entry.area_start, page->Offset(page->area_start()));
+      CHECK_EQ(entry.area_end, page->Offset(page->area_end()));
+
+      const Address source = image_start + entry.file_offset;
+      const Address chunk = page->ChunkAddress();
+      // The first OS page also holds the page header, and the last one may be
+      // only partially covered by the image. Both are copied.
+      Address remap_start =
+          std::min(RoundUp(page->area_start(), page_size), page->area_end());
+      Address remap_end =
+          std::max(RoundDown(page->area_end(), page_size), remap_start);
+      bool remapped = false;
+      if constexpr (base::OS::IsRemapPageSupported()) {
+        remapped =
+            remap_start < remap_end &&
+            base::OS::RemapPages(
+                reinterpret_cast<const void*>(source + (remap_start - chunk)),
+                remap_end - remap_start, reinterpret_cast<void*>(remap_start),
+                base::OS::MemoryPermission::kReadWrite);
+      }
+      if (!remapped) remap_end = remap_start = page->area_end();
+      MemCopy(reinterpret_cast<void*>(page->area_start()),
+              reinterpret_cast<const void*>(source + entry.area_start),
+              remap_start - page->area_start());
+      MemCopy(reinterpret_cast<void*>(remap_end),
+              reinterpret_cast<const void*>(source + (remap_end - chunk)),
+              page->area_end() - remap_end);
+    }
+  }
+
+ private:
+  static constexpr uint32_t kMagic = 0x524f494d;  // "ROIM"
+
+  struct Header {
+    uint32_t magic;
+    uint32_t version_hash;
+    uint32_t snapshot_checksum;
+    uint32_t page_size;
+    uint32_t page_count;
+  };
+
+  // All offsets except `file_offset` are relative to the start of the page.
+  struct PageEntry {
+    uint32_t compressed_address;
+    uint32_t area_start;
+    uint32_t area_end;
+    uint32_t file_offset;
+  };
+
+  explicit ReadOnlySpaceImage(std::unique_ptr<base::OS::MemoryMappedFile> file)
+      : file_(std::move(file)) {}
+
+  const Header* header() const {
+    return reinterpret_cast<const Header*>(file_->memory());
+  }
+  const PageEntry* page_entries() const {
+    return reinterpret_cast<const PageEntry*>(header() + 1);
+  }
+
+  std::unique_ptr<base::OS::MemoryMappedFile> file_;
+};
+#endif  // V8_STATIC_ROOTS
+
 class ReadOnlyHeapImageDeserializer final {
  public:
-  static void Deserialize(Isolate* isolate, SnapshotByteSource* source) {
-    ReadOnlyHeapImageDeserializer{isolate, source}.DeserializeImpl();
+  // If `skip_segments` is set, only the pages are allocated and the roots
+  // table is initialized. The contents of the pages are expected to be
+  // provided separately.
+  static void Deserialize(Isolate* isolate, SnapshotByteSource* source,
+                          bool skip_segments) {
+    ReadOnlyHeapImageDeserializer{isolate, source, skip_segments}
+        .DeserializeImpl();
   }
 
  private:
   using Bytecode = ro::Bytecode;
 
-  ReadOnlyHeapImageDeserializer(Isolate* isolate, SnapshotByteSource* source)
-      : source_(source), isolate_(isolate) {}
+  ReadOnlyHeapImageDeserializer(Isolate* isolate, SnapshotByteSource* source,
+                                bool skip_segments)
+      : source_(source), isolate_(isolate), skip_segments_(skip_segments) {}
 
   void DeserializeImpl() {
     while (true) {
@@ -84,6 +267,11 @@ class ReadOnlyHeapImageDeserializer final {
     Address start = page->area_start() + source_->GetUint30();
     int size_in_bytes = source_->GetUint30();
     CHECK_LE(start + size_in_bytes, page->area_end());
+    if (skip_segments_) {
+      DCHECK(V8_STATIC_ROOTS_BOOL);
+      source_->Advance(size_in_bytes);
+      return;
+    }
     source_->CopyRaw(reinterpret_cast<void*>(start), size_in_bytes);
 
     if (!V8_STATIC_ROOTS_BOOL) {
@@ -146,6 +334,7 @@ class ReadOnlyHeapImageDeserializer final {
 
   SnapshotByteSource* const source_;
   Isolate* const isolate_;
+  const bool skip_segments_;
 };
 
 ReadOnlyDeserializer::ReadOnlyDeserializer(Isolate* isolate,
@@ -161,9 +350,31 @@ void ReadOnlyDeserializer::DeserializeIntoIsolate() {
       isolate()->counters()->snapshot_deserialize_rospace());
   HandleScope scope(isolate());
 
-  ReadOnlyHeapImageDeserializer::Deserialize(isolate(), source());
   ReadOnlyHeap* ro_heap = isolate()->read_only_heap();
+#ifdef V8_STATIC_ROOTS
+  const char* image_path = v8_flags.read_only_space_image.value();
+  uint32_t checksum = 0;
+  std::unique_ptr<ReadOnlySpaceImage> image;
+  if (V8_UNLIKELY(image_path != nullptr) && base::OS::IsRemapPageSupported()) {
+    checksum = Checksum(base::VectorOf(source()->data(), source()->length()));
+    image = ReadOnlySpaceImage::Open(image_path, checksum);
+  }
+  ReadOnlyHeapImageDeserializer::Deserialize(isolate(), source(),
+                                             image != nullptr);
+  ro_heap->read_only_space()->RepairFreeSpacesAfterDeserialization();
+  if (image) {
+    // Fillers were created above in the same way as when the image was
+    // written, so the image can be mapped on top of them.
+    image->MapInto(ro_heap->read_only_space());
+  } else if (V8_UNLIKELY(image_path != nullptr) &&
+             base::OS::IsRemapPageSupported()) {
+    ReadOnlySpaceImage::Write(image_path, checksum,
+                              ro_heap->read_only_space());
+  }
+#else
+  ReadOnlyHeapImageDeserializer::Deserialize(isolate(), source(), false);
   ro_heap->read_only_space()->RepairFreeSpacesAfterDeserialization();
+#endif  // V8_STATIC_ROOTS
   PostProcessNewObjects();
 
   ReadOnlyRoots roots(isolate());
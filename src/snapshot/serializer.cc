@@ -19,6 +19,7 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/map.h"
 #include "src/objects/objects-body-descriptors-inl.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/objects/slots-inl.h"
 #include "src/objects/slots.h"
 #include "src/objects/smi.h"
@@ -177,7 +178,14 @@ void Serializer::SerializeObject(Handle<HeapObject> obj, SlotType slot_type) {
   SerializeObjectImpl(obj, slot_type);
 }
 
-bool Serializer::MustBeDeferred(Tagged<HeapObject> object) { return false; }
+bool Serializer::MustBeDeferred(Tagged<HeapObject> object) {
+  // Functions that were never compiled before the snapshot was taken are
+  // unlikely to be needed right after deserialization either. Serializing
+  // them last keeps the objects that are used at startup close together.
+  if (!v8_flags.serialize_cold_functions_last) return false;
+  return IsSharedFunctionInfo(object) &&
+         !Cast<SharedFunctionInfo>(object)->is_compiled();
+}
 
 void Serializer::VisitRootPointers(Root root, const char* description,
                                    FullObjectSlot start, FullObjectSlot end) {
@@ -842,10 +850,15 @@ void Serializer::ObjectSerializer::Serialize(SlotType slot_type) {
     return;
   }
   if (InstanceTypeChecker::IsScript(instance_type)) {
-    // Clear cached line ends & compiled lazy function positions.
+    // Clear cached line ends, literal allocation sites & compiled lazy
+    // function positions.
     Cast<Script>(object_)->set_line_ends(Smi::zero());
-    Cast<Script>(object_)->set_compiled_lazy_function_positions(
+    Cast<Script>(object_)->set_literal_allocation_sites(
         ReadOnlyRoots(isolate()).undefined_value());
+    if (!serializer_->SerializesCompileHints()) {
+      Cast<Script>(object_)->set_compiled_lazy_function_positions(
+          ReadOnlyRoots(isolate()).undefined_value());
+    }
   }
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -239,6 +239,10 @@ class Serializer : public SerializerDeserializer {
 
   virtual bool MustBeDeferred(Tagged<HeapObject> object);
 
+  // Whether the positions of the lazily compiled functions of scripts are
+  // serialized, to be used as compile hints after deserialization.
+  virtual bool SerializesCompileHints() const { return false; }
+
   void VisitRootPointers(Root root, const char* description,
                          FullObjectSlot start, FullObjectSlot end) override;
   void SerializeRootObject(FullObjectSlot slot);
@@ -4,7 +4,15 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +20,91 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+uint32_t ReadUint32(const Bytef* data) {
+  uint32_t value;
+  MemCopy(&value, data, sizeof(value));
+  return value;
+}
+
+void WriteUint32(Bytef* data, uint32_t value) {
+  MemCopy(data, &value, sizeof(value));
+}
+
+uint32_t NumberOfChunks(uint32_t payload_length) {
+  return std::max<uint32_t>(
+      1, (payload_length + SnapshotCompression::kChunkSize - 1) /
+             SnapshotCompression::kChunkSize);
 }
 
+uint32_t HeaderSize(uint32_t num_chunks) {
+  return (2 + num_chunks) * kUInt32Size;
+}
+
+// Decompresses the chunks of a compressed snapshot. Chunks are claimed one at
+// a time, so the calling thread and any number of workers can participate.
+class DecompressionJob final : public JobTask {
+ public:
+  DecompressionJob(const Bytef* input, uint8_t* output,
+                   uint32_t payload_length, uint32_t num_chunks)
+      : input_(input),
+        output_(output),
+        payload_length_(payload_length),
+        num_chunks_(num_chunks),
+        input_offsets_(num_chunks + 1) {
+    const Bytef* sizes = input + 2 * kUInt32Size;
+    input_offsets_[0] = HeaderSize(num_chunks);
+    for (uint32_t i = 0; i < num_chunks; ++i) {
+      input_offsets_[i + 1] =
+          input_offsets_[i] + ReadUint32(sizes + i * kUInt32Size);
+    }
+  }
+  DecompressionJob(const DecompressionJob&) = delete;
+  DecompressionJob& operator=(const DecompressionJob&) = delete;
+
+  size_t input_size() const { return input_offsets_[num_chunks_]; }
+
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield() && DecompressNextChunk()) {
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    uint32_t next = next_chunk_.load(std::memory_order_relaxed);
+    return next < num_chunks_ ? num_chunks_ - next : 0;
+  }
+
+  // Returns false once every chunk has been claimed.
+  bool DecompressNextChunk() {
+    uint32_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+    if (chunk >= num_chunks_) return false;
+    uint32_t output_offset = chunk * SnapshotCompression::kChunkSize;
+    uint32_t chunk_size = std::min(SnapshotCompression::kChunkSize,
+                                   payload_length_ - output_offset);
+    uLongf uncompressed_size = chunk_size;
+    CHECK_EQ(zlib_internal::UncompressHelper(
+                 zlib_internal::ZRAW, output_ + output_offset,
+                 &uncompressed_size, input_ + input_offsets_[chunk],
+                 static_cast<uLong>(input_offsets_[chunk + 1] -
+                                    input_offsets_[chunk])),
+             Z_OK);
+    CHECK_EQ(uncompressed_size, chunk_size);
+    return true;
+  }
+
+ private:
+  const Bytef* const input_;
+  uint8_t* const output_;
+  const uint32_t payload_length_;
+  const uint32_t num_chunks_;
+  std::vector<size_t> input_offsets_;
+  std::atomic<uint32_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,40 +112,50 @@ SnapshotData SnapshotCompression::Compress(
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  base::Vector<const uint8_t> payload = uncompressed_data->RawData();
+  uint32_t payload_length = static_cast<uint32_t>(payload.size());
+  uint32_t num_chunks = NumberOfChunks(payload_length);
+  uint32_t header_size = HeaderSize(num_chunks);
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+  size_t max_size = header_size;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    uint32_t offset = i * kChunkSize;
+    max_size += compressBound(std::min(kChunkSize, payload_length - offset));
+  }
+  snapshot_data.AllocateData(static_cast<uint32_t>(max_size));
 
-  uint8_t* compressed_data =
-      const_cast<uint8_t*>(snapshot_data.RawData().begin());
+  Bytef* compressed_data =
+      const_cast<Bytef*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
   // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  WriteUint32(compressed_data, payload_length);
+  WriteUint32(compressed_data + kUInt32Size, num_chunks);
+
+  size_t compressed_size = header_size;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    uint32_t offset = i * kChunkSize;
+    uLong chunk_size = std::min(kChunkSize, payload_length - offset);
+    uLongf compressed_chunk_size = compressBound(chunk_size);
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + compressed_size,
+                 &compressed_chunk_size,
+                 reinterpret_cast<const Bytef*>(payload.begin() + offset),
+                 chunk_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    WriteUint32(compressed_data + (2 + i) * kUInt32Size,
+                static_cast<uint32_t>(compressed_chunk_size));
+    compressed_size += compressed_chunk_size;
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(static_cast<uint32_t>(compressed_size));
+  DCHECK_EQ(payload_length, ReadUint32(snapshot_data.RawData().begin()));
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks took %0.3f ms]\n",
+           payload_length, num_chunks, ms);
   }
   return snapshot_data;
 }
@@ -71,27 +168,36 @@ SnapshotData SnapshotCompression::Decompress(
 
   const Bytef* input_bytef =
       reinterpret_cast<const Bytef*>(compressed_data.begin());
+  CHECK_GE(compressed_data.size(), HeaderSize(0));
 
   // Since we are doing raw compression (no zlib or gzip headers), we need to
   // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  uint32_t uncompressed_payload_length = ReadUint32(input_bytef);
+  uint32_t num_chunks = ReadUint32(input_bytef + kUInt32Size);
+  CHECK_EQ(num_chunks, NumberOfChunks(uncompressed_payload_length));
+  CHECK_GE(compressed_data.size(), HeaderSize(num_chunks));
 
   snapshot_data.AllocateData(uncompressed_payload_length);
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               const_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  auto job = std::make_unique<DecompressionJob>(
+      input_bytef, const_cast<uint8_t*>(snapshot_data.RawData().begin()),
+      uncompressed_payload_length, num_chunks);
+  CHECK_EQ(job->input_size(), compressed_data.size());
+  if (num_chunks > 1 && v8_flags.parallel_snapshot_decompression &&
+      V8::GetCurrentPlatform() != nullptr) {
+    // The calling thread joins and decompresses chunks as well.
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking, std::move(job))
+        ->Join();
+  } else {
+    while (job->DecompressNextChunk()) {
+    }
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_payload_length, num_chunks, ms);
   }
   return snapshot_data;
 }
@@ -11,8 +11,18 @@
 namespace v8 {
 namespace internal {
 
+// Compressed snapshot data is split into chunks of kChunkSize uncompressed
+// bytes that are compressed independently, so that they can be decompressed
+// in parallel. Layout:
+//
+//   uint32_t uncompressed payload length
+//   uint32_t number of chunks
+//   uint32_t compressed size of each chunk
+//   compressed chunks, back to back
 class SnapshotCompression : public AllStatic {
  public:
+  static constexpr uint32_t kChunkSize = 256 * KB;
+
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
@@ -6,6 +6,8 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <atomic>
+
 #include "src/api/api-inl.h"  // For OpenHandle.
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/common/assert-scope.h"
@@ -15,6 +17,7 @@
 #include "src/heap/read-only-promotion.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/js-regexp-inl.h"
@@ -145,6 +148,82 @@ SnapshotData MaybeDecompress(Isolate* isolate,
 #endif
 }
 
+class ContextSnapshotCache::DecompressionJob final : public JobTask {
+ public:
+  explicit DecompressionJob(ContextSnapshotCache* cache)
+      : cache_(cache),
+        num_contexts_(static_cast<uint32_t>(cache->contexts_.size())) {}
+
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      uint32_t index = next_context_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= num_contexts_) return;
+      cache_->Decompress(index);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    uint32_t next = next_context_.load(std::memory_order_relaxed);
+    return next < num_contexts_ ? num_contexts_ - next : 0;
+  }
+
+ private:
+  ContextSnapshotCache* const cache_;
+  const uint32_t num_contexts_;
+  std::atomic<uint32_t> next_context_{0};
+};
+
+ContextSnapshotCache::ContextSnapshotCache(const v8::StartupData* blob,
+                                           uint32_t num_contexts)
+    : blob_(blob), contexts_(num_contexts) {}
+
+ContextSnapshotCache::~ContextSnapshotCache() {
+  if (job_handle_ && job_handle_->IsValid()) job_handle_->Cancel();
+}
+
+void ContextSnapshotCache::StartBackgroundDecompression() {
+  DCHECK_NULL(job_handle_);
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible, std::make_unique<DecompressionJob>(this));
+}
+
+const SnapshotData* ContextSnapshotCache::Get(Isolate* isolate,
+                                              uint32_t context_index) {
+  DCHECK_LT(context_index, contexts_.size());
+  {
+    base::MutexGuard guard(&mutex_);
+    if (contexts_[context_index]) return contexts_[context_index].get();
+  }
+  TRACE_EVENT0("v8", "V8.SnapshotDecompress");
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
+  NestedTimedHistogramScope histogram_timer(
+      isolate->counters()->snapshot_decompress());
+  return Decompress(context_index);
+}
+
+const SnapshotData* ContextSnapshotCache::Decompress(uint32_t context_index) {
+  {
+    base::MutexGuard guard(&mutex_);
+    if (contexts_[context_index]) return contexts_[context_index].get();
+  }
+  // Decompress without holding the lock. If two threads race on the same
+  // context, the first result wins and the other one is dropped.
+  base::Vector<const uint8_t> context_data =
+      SnapshotImpl::ExtractContextData(blob_, context_index);
+#ifdef V8_SNAPSHOT_COMPRESSION
+  auto snapshot_data = std::make_unique<SnapshotData>(
+      SnapshotCompression::Decompress(context_data));
+#else
+  auto snapshot_data = std::make_unique<SnapshotData>(context_data);
+#endif
+  base::MutexGuard guard(&mutex_);
+  if (!contexts_[context_index]) {
+    contexts_[context_index] = std::move(snapshot_data);
+  }
+  return contexts_[context_index].get();
+}
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -195,9 +274,23 @@ bool Snapshot::Initialize(Isolate* isolate) {
   SnapshotData shared_heap_snapshot_data(
       MaybeDecompress(isolate, shared_heap_data));
 
-  return isolate->InitWithSnapshot(
-      &startup_snapshot_data, &read_only_snapshot_data,
-      &shared_heap_snapshot_data, ExtractRehashability(blob));
+  if (!isolate->InitWithSnapshot(
+          &startup_snapshot_data, &read_only_snapshot_data,
+          &shared_heap_snapshot_data, ExtractRehashability(blob))) {
+    return false;
+  }
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // Without compression, context snapshots are deserialized in place and
+  // there is nothing to cache.
+  if (v8_flags.cache_context_snapshots) {
+    auto cache = std::make_unique<ContextSnapshotCache>(
+        blob, SnapshotImpl::ExtractNumContexts(blob));
+    cache->StartBackgroundDecompression();
+    isolate->set_context_snapshot_cache(std::move(cache));
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+  return true;
 }
 
 MaybeDirectHandle<Context> Snapshot::NewContextFromSnapshot(
@@ -208,6 +301,11 @@ MaybeDirectHandle<Context> Snapshot::NewContextFromSnapshot(
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   bool can_rehash = ExtractRehashability(blob);
+  if (ContextSnapshotCache* cache = isolate->context_snapshot_cache()) {
+    return ContextDeserializer::DeserializeContext(
+        isolate, cache->Get(isolate, static_cast<uint32_t>(context_index)),
+        context_index, can_rehash, global_proxy, embedder_fields_deserializer);
+  }
   base::Vector<const uint8_t> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
   SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
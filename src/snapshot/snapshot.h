@@ -5,10 +5,13 @@
 #ifndef V8_SNAPSHOT_SNAPSHOT_H_
 #define V8_SNAPSHOT_SNAPSHOT_H_
 
+#include <memory>
 #include <vector>
 
 #include "include/v8-array-buffer.h"  // For ArrayBuffer::Allocator.
+#include "include/v8-platform.h"
 #include "include/v8-snapshot.h"  // For StartupData.
+#include "src/base/platform/mutex.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -119,6 +122,37 @@ class Snapshot : public AllStatic {
 #endif  // DEBUG
 };
 
+// Keeps the decompressed context snapshots of an isolate's snapshot blob for
+// the lifetime of the isolate. They are decompressed on a worker thread right
+// after isolate initialization, so that creating a context from the snapshot
+// only pays for deserialization.
+class ContextSnapshotCache final {
+ public:
+  ContextSnapshotCache(const v8::StartupData* blob, uint32_t num_contexts);
+  ~ContextSnapshotCache();
+  ContextSnapshotCache(const ContextSnapshotCache&) = delete;
+  ContextSnapshotCache& operator=(const ContextSnapshotCache&) = delete;
+
+  // Posts a job that decompresses all context snapshots.
+  void StartBackgroundDecompression();
+
+  // Returns the decompressed snapshot of the given context. Decompresses it
+  // on the calling thread if the background job did not get to it yet.
+  const SnapshotData* Get(Isolate* isolate, uint32_t context_index);
+
+ private:
+  class DecompressionJob;
+
+  // Decompresses the snapshot of the given context unless another thread
+  // already did.
+  const SnapshotData* Decompress(uint32_t context_index);
+
+  const v8::StartupData* const blob_;
+  base::Mutex mutex_;
+  std::vector<std::unique_ptr<SnapshotData>> contexts_;
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
 // Convenience wrapper around snapshot data blob creation used e.g. by tests.
 V8_EXPORT_PRIVATE v8::StartupData CreateSnapshotDataBlobInternal(
     v8::SnapshotCreator::FunctionCodeHandling function_code_handling,
@@ -0,0 +1,111 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/hex-encoding.h"
+
+#include "hwy/highway.h"
+#include "src/base/logging.h"
+#include "src/base/strings.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+namespace hw = hwy::HWY_NAMESPACE;
+
+constexpr uint8_t kHexDigits[] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                  '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+template <typename Char>
+int HexValue(Char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  Char lower = c | 0x20;
+  if (lower >= 'a' && lower <= 'f') return lower - 'a' + 10;
+  return -1;
+}
+
+template <typename Char>
+bool HexDecodeScalar(const Char* input, size_t length, uint8_t* output) {
+  for (size_t i = 0; i < length; i += 2) {
+    int high = HexValue(input[i]);
+    int low = HexValue(input[i + 1]);
+    if ((high | low) < 0) return false;
+    *output++ = static_cast<uint8_t>(high << 4 | low);
+  }
+  return true;
+}
+
+// Maps 16 characters to their hex digit values, or to 0xFF for characters
+// that aren't hex digits.
+template <typename D, typename V = hw::VFromD<D>>
+V8_INLINE V HexValues(D d, V chars) {
+  const V digit = hw::Sub(chars, hw::Set(d, '0'));
+  // Setting bit 5 maps 'A'-'F' to 'a'-'f' and leaves digits distinct from
+  // letters.
+  const V letter = hw::Sub(hw::Or(chars, hw::Set(d, 0x20)), hw::Set(d, 'a'));
+  return hw::IfThenElse(
+      hw::Lt(digit, hw::Set(d, 10)), digit,
+      hw::IfThenElse(hw::Lt(letter, hw::Set(d, 6)),
+                     hw::Add(letter, hw::Set(d, 10)), hw::Set(d, 0xFF)));
+}
+
+}  // namespace
+
+void HexEncode(const uint8_t* input, size_t length, uint8_t* output) {
+  hw::FixedTag<uint8_t, 16> d;
+  constexpr size_t kStride = 16;
+  const auto digits = hw::LoadU(d, kHexDigits);
+  const auto low_nibble_mask = hw::Set(d, 0x0F);
+  size_t i = 0;
+  for (; i + kStride <= length; i += kStride) {
+    const auto bytes = hw::LoadU(d, input + i);
+    const auto high = hw::TableLookupBytes(digits, hw::ShiftRight<4>(bytes));
+    const auto low =
+        hw::TableLookupBytes(digits, hw::And(bytes, low_nibble_mask));
+    // Each byte becomes its high digit followed by its low digit.
+    hw::StoreU(hw::InterleaveLower(d, high, low), d, output + 2 * i);
+    hw::StoreU(hw::InterleaveUpper(d, high, low), d, output + 2 * i + kStride);
+  }
+  for (; i < length; i++) {
+    output[2 * i] = kHexDigits[input[i] >> 4];
+    output[2 * i + 1] = kHexDigits[input[i] & 0x0F];
+  }
+}
+
+template <typename Char>
+bool HexDecode(const Char* input, size_t length, uint8_t* output) {
+  DCHECK_EQ(length % 2, 0);
+  if constexpr (sizeof(Char) == 1) {
+    hw::FixedTag<uint8_t, 16> d;
+    constexpr size_t kStride = 16;
+    const uint8_t* chars = reinterpret_cast<const uint8_t*>(input);
+    size_t i = 0;
+    // Each iteration decodes 2 * kStride digits into kStride bytes.
+    for (; i + 2 * kStride <= length; i += 2 * kStride) {
+      const auto first = hw::LoadU(d, chars + i);
+      const auto second = hw::LoadU(d, chars + i + kStride);
+      const auto high = HexValues(d, hw::ConcatEven(d, second, first));
+      const auto low = HexValues(d, hw::ConcatOdd(d, second, first));
+      // Valid digits are below 16, so this catches an invalid character in
+      // either half.
+      if (V8_UNLIKELY(
+              !hw::AllTrue(d, hw::Lt(hw::Or(high, low), hw::Set(d, 16))))) {
+        return false;
+      }
+      hw::StoreU(hw::Or(hw::ShiftLeft<4>(high), low), d, output + i / 2);
+    }
+    return HexDecodeScalar(input + i, length - i, output + i / 2);
+  } else {
+    return HexDecodeScalar(input, length, output);
+  }
+}
+
+template V8_EXPORT_PRIVATE bool HexDecode(const uint8_t* input, size_t length,
+                                          uint8_t* output);
+template V8_EXPORT_PRIVATE bool HexDecode(const base::uc16* input,
+                                          size_t length, uint8_t* output);
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,32 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_HEX_ENCODING_H_
+#define V8_STRINGS_HEX_ENCODING_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Writes the lowercase hex encoding of the {length} bytes at {input} to
+// {output}, which must have room for 2 * {length} characters.
+V8_EXPORT_PRIVATE void HexEncode(const uint8_t* input, size_t length,
+                                 uint8_t* output);
+
+// Decodes the {length} hex digits at {input} into {output}, which must have
+// room for {length} / 2 bytes. {length} must be even. Both upper and lower case
+// digits are accepted. Returns false if any character is not a hex digit, in
+// which case the contents of {output} are unspecified.
+template <typename Char>
+V8_EXPORT_PRIVATE bool HexDecode(const Char* input, size_t length,
+                                 uint8_t* output);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_HEX_ENCODING_H_
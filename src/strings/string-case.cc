@@ -4,25 +4,28 @@
 
 #include "src/strings/string-case.h"
 
+#include "hwy/highway.h"
 #include "src/base/logging.h"
 #include "src/common/assert-scope.h"
-#include "src/common/globals.h"
-#include "src/utils/utils.h"
 
 namespace v8 {
 namespace internal {
 
-// FastAsciiConvert tries to do character processing on a word_t basis if
-// source and destination strings are properly aligned. Natural alignment of
-// string data depends on kTaggedSize so we define word_t via Tagged_t.
-using word_t = std::make_unsigned_t<Tagged_t>;
+namespace {
 
-const word_t kWordTAllBitsSet = std::numeric_limits<word_t>::max();
-const word_t kOneInEveryByte = kWordTAllBitsSet / 0xFF;
-const word_t kAsciiMask = kOneInEveryByte << 7;
+namespace hw = hwy::HWY_NAMESPACE;
+
+// Case conversion works on 16 bytes at a time, independent of alignment, so
+// it also applies to sliced strings and to the end of a string.
+constexpr size_t kStrideBytes = 16;
+
+// The distance between upper and lower case letters, both in ASCII and in the
+// Latin-1 range, is this bit.
+constexpr uint8_t kCaseBit = 1 << 5;
 
 #ifdef DEBUG
-bool CheckFastAsciiConvert(char* dst, const char* src, uint32_t length,
+template <typename Char>
+bool CheckFastAsciiConvert(Char* dst, const Char* src, uint32_t length,
                            bool changed, bool is_to_lower) {
   bool expected_changed = false;
   for (uint32_t i = 0; i < length; i++) {
@@ -40,97 +43,163 @@ bool CheckFastAsciiConvert(char* dst, const char* src, uint32_t length,
 }
 #endif
 
-// Given a word and two range boundaries returns a word with high bit
-// set in every byte iff the corresponding input byte was strictly in
-// the range (m, n). All the other bits in the result are cleared.
-// This function is only useful when it can be inlined and the
-// boundaries are statically known.
-// Requires: all bytes in the input word and the boundaries must be
-// ASCII (less than 0x7F).
-static inline word_t AsciiRangeMask(word_t w, char m, char n) {
-  // Use strict inequalities since in edge cases the function could be
-  // further simplified.
-  DCHECK(0 < m && m < n);
-  // Has high bit set in every w byte less than n.
-  word_t tmp1 = kOneInEveryByte * (0x7F + n) - w;
-  // Has high bit set in every w byte greater than m.
-  word_t tmp2 = w + kOneInEveryByte * (0x7F - m);
-  return (tmp1 & tmp2 & (kOneInEveryByte * 0x80));
-}
-
-template <bool is_lower>
-uint32_t FastAsciiConvert(char* dst, const char* src, uint32_t length,
-                          bool* changed_out) {
-#ifdef DEBUG
-  char* saved_dst = dst;
-#endif
-  const char* saved_src = src;
+template <bool is_lower, typename Char>
+uint32_t FastAsciiConvertImpl(Char* dst, const Char* src, uint32_t length,
+                              bool* changed_out) {
   DisallowGarbageCollection no_gc;
   // We rely on the distance between upper and lower case letters
   // being a known power of 2.
-  DCHECK_EQ('a' - 'A', 1 << 5);
-  // Boundaries for the range of input characters than require conversion.
-  static const char lo = is_lower ? 'A' - 1 : 'a' - 1;
-  static const char hi = is_lower ? 'Z' + 1 : 'z' + 1;
+  DCHECK_EQ('a' - 'A', kCaseBit);
+  // The first character that requires conversion.
+  constexpr Char first = is_lower ? 'A' : 'a';
+  constexpr Char kLetters = 'Z' - 'A' + 1;
   bool changed = false;
-  const char* const limit = src + length;
-
-  // dst is newly allocated and always aligned.
-  DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
-  // Only attempt processing one word at a time if src is also aligned.
-  if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
-    // Process the prefix of the input that requires no conversion one aligned
-    // (machine) word at a time.
-    while (src <= limit - sizeof(word_t)) {
-      const word_t w = *reinterpret_cast<const word_t*>(src);
-      if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
-      if (AsciiRangeMask(w, lo, hi) != 0) {
-        changed = true;
-        break;
-      }
-      *reinterpret_cast<word_t*>(dst) = w;
-      src += sizeof(word_t);
-      dst += sizeof(word_t);
-    }
-    // Process the remainder of the input performing conversion when
-    // required one word at a time.
-    while (src <= limit - sizeof(word_t)) {
-      const word_t w = *reinterpret_cast<const word_t*>(src);
-      if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
-      word_t m = AsciiRangeMask(w, lo, hi);
-      // The mask has high (7th) bit set in every byte that needs
-      // conversion and we know that the distance between cases is
-      // 1 << 5.
-      *reinterpret_cast<word_t*>(dst) = w ^ (m >> 2);
-      src += sizeof(word_t);
-      dst += sizeof(word_t);
-    }
+  uint32_t i = 0;
+
+  hw::FixedTag<Char, kStrideBytes / sizeof(Char)> d;
+  constexpr uint32_t kStride = hw::MaxLanes(d);
+  const auto max_ascii = hw::Set(d, Char{0x7F});
+  const auto firsts = hw::Set(d, first);
+  const auto letters = hw::Set(d, kLetters);
+  const auto case_bits = hw::Set(d, Char{kCaseBit});
+  for (; i + kStride <= length; i += kStride) {
+    const auto chars = hw::LoadU(d, src + i);
+    if (!hw::AllFalse(d, hw::Gt(chars, max_ascii))) return i;
+    // Unsigned wrap-around turns the range check into a single comparison.
+    const auto convert = hw::Lt(hw::Sub(chars, firsts), letters);
+    changed |= !hw::AllFalse(d, convert);
+    hw::StoreU(hw::Xor(chars, hw::IfThenElseZero(convert, case_bits)), d,
+               dst + i);
   }
-  // Process the last few bytes of the input (or the whole input if
-  // unaligned access is not supported).
-  while (src < limit) {
-    char c = *src;
-    if ((c & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
-    if (lo < c && c < hi) {
-      c ^= (1 << 5);
+  // Process the last few characters of the input.
+  for (; i < length; i++) {
+    Char c = src[i];
+    if (c > 0x7F) return i;
+    if (static_cast<Char>(c - first) < kLetters) {
+      c ^= kCaseBit;
       changed = true;
     }
-    *dst = c;
-    ++src;
-    ++dst;
+    dst[i] = c;
   }
 
-  DCHECK(
-      CheckFastAsciiConvert(saved_dst, saved_src, length, changed, is_lower));
+  DCHECK(CheckFastAsciiConvert(dst, src, length, changed, is_lower));
 
   *changed_out = changed;
   return length;
 }
 
+// Latin-1 letters in [U+00C0, U+00DE] and [U+00E0, U+00FE] are upper and lower
+// case pairs, except for U+00D7 and U+00F7, which are the multiplication and
+// division signs.
+constexpr uint8_t kLatin1UpperFirst = 0xC0;
+constexpr uint8_t kLatin1LowerFirst = 0xE0;
+constexpr uint8_t kLatin1Letters = 0xDE - 0xC0 + 1;
+constexpr uint8_t kLatin1UpperException = 0xD7;
+constexpr uint8_t kLatin1LowerException = 0xF7;
+
+constexpr bool IsLatin1Upper(uint8_t c) {
+  return static_cast<uint8_t>(c - 'A') <= 'Z' - 'A' ||
+         (static_cast<uint8_t>(c - kLatin1UpperFirst) < kLatin1Letters &&
+          c != kLatin1UpperException);
+}
+
+constexpr bool IsLatin1Lower(uint8_t c) {
+  return static_cast<uint8_t>(c - 'a') <= 'z' - 'a' ||
+         (static_cast<uint8_t>(c - kLatin1LowerFirst) < kLatin1Letters &&
+          c != kLatin1LowerException);
+}
+
+// Lower case characters whose upper case is not a single Latin-1 character.
+constexpr bool IsLatin1UpperSpecial(uint8_t c) {
+  return c == 0xB5 || c == 0xDF || c == 0xFF;
+}
+
+// Returns a mask of the lanes of {chars} that are in one of the two letter
+// ranges starting at {ascii_first} and {latin1_first}.
+template <typename D, typename V = hw::VFromD<D>>
+V8_INLINE hw::MFromD<D> Latin1LetterMask(D d, V chars, uint8_t ascii_first,
+                                         uint8_t latin1_first,
+                                         uint8_t latin1_exception) {
+  const auto ascii =
+      hw::Lt(hw::Sub(chars, hw::Set(d, ascii_first)), hw::Set(d, 'Z' - 'A' + 1));
+  const auto latin1 = hw::And(
+      hw::Lt(hw::Sub(chars, hw::Set(d, latin1_first)),
+             hw::Set(d, kLatin1Letters)),
+      hw::Ne(chars, hw::Set(d, latin1_exception)));
+  return hw::Or(ascii, latin1);
+}
+
+}  // namespace
+
+template <bool is_lower>
+uint32_t FastAsciiConvert(char* dst, const char* src, uint32_t length,
+                          bool* changed_out) {
+  return FastAsciiConvertImpl<is_lower>(reinterpret_cast<uint8_t*>(dst),
+                                        reinterpret_cast<const uint8_t*>(src),
+                                        length, changed_out);
+}
+
+template <bool is_lower>
+uint32_t FastAsciiConvert(base::uc16* dst, const base::uc16* src,
+                          uint32_t length, bool* changed_out) {
+  return FastAsciiConvertImpl<is_lower>(dst, src, length, changed_out);
+}
+
 template uint32_t FastAsciiConvert<false>(char* dst, const char* src,
                                           uint32_t length, bool* changed_out);
 template uint32_t FastAsciiConvert<true>(char* dst, const char* src,
                                          uint32_t length, bool* changed_out);
+template uint32_t FastAsciiConvert<false>(base::uc16* dst,
+                                          const base::uc16* src,
+                                          uint32_t length, bool* changed_out);
+template uint32_t FastAsciiConvert<true>(base::uc16* dst, const base::uc16* src,
+                                         uint32_t length, bool* changed_out);
+
+void Latin1ConvertToLower(uint8_t* dst, const uint8_t* src, uint32_t length) {
+  DisallowGarbageCollection no_gc;
+  uint32_t i = 0;
+  hw::FixedTag<uint8_t, kStrideBytes> d;
+  const auto case_bits = hw::Set(d, kCaseBit);
+  for (; i + kStrideBytes <= length; i += kStrideBytes) {
+    const auto chars = hw::LoadU(d, src + i);
+    const auto convert = Latin1LetterMask(d, chars, 'A', kLatin1UpperFirst,
+                                          kLatin1UpperException);
+    // Upper case letters have the case bit cleared.
+    hw::StoreU(hw::Or(chars, hw::IfThenElseZero(convert, case_bits)), d,
+               dst + i);
+  }
+  for (; i < length; i++) {
+    uint8_t c = src[i];
+    dst[i] = IsLatin1Upper(c) ? c | kCaseBit : c;
+  }
+}
+
+uint32_t Latin1ConvertToUpper(uint8_t* dst, const uint8_t* src,
+                              uint32_t length) {
+  DisallowGarbageCollection no_gc;
+  uint32_t i = 0;
+  hw::FixedTag<uint8_t, kStrideBytes> d;
+  const auto case_bits = hw::Set(d, kCaseBit);
+  for (; i + kStrideBytes <= length; i += kStrideBytes) {
+    const auto chars = hw::LoadU(d, src + i);
+    const auto special =
+        hw::Or(hw::Or(hw::Eq(chars, hw::Set(d, 0xB5)),
+                      hw::Eq(chars, hw::Set(d, 0xDF))),
+               hw::Eq(chars, hw::Set(d, 0xFF)));
+    // Let the scalar loop find the exact position of the special character.
+    if (!hw::AllFalse(d, special)) break;
+    const auto convert = Latin1LetterMask(d, chars, 'a', kLatin1LowerFirst,
+                                          kLatin1LowerException);
+    hw::StoreU(hw::AndNot(hw::IfThenElseZero(convert, case_bits), chars), d,
+               dst + i);
+  }
+  for (; i < length; i++) {
+    uint8_t c = src[i];
+    if (IsLatin1UpperSpecial(c)) return i;
+    dst[i] = IsLatin1Lower(c) ? c & ~kCaseBit : c;
+  }
+  return length;
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -7,12 +7,31 @@
 
 #include <cinttypes>
 
+#include "src/base/strings.h"
+
 namespace v8 {
 namespace internal {
 
+// Converts the case of the ASCII string {src} into {dst}. Stops at the first
+// non-ASCII character and returns the number of characters converted, which
+// may be smaller than the index of that character. Sets {changed_out} only if
+// the whole string was converted.
 template <bool is_lower>
 uint32_t FastAsciiConvert(char* dst, const char* src, uint32_t length,
                           bool* changed_out);
+template <bool is_lower>
+uint32_t FastAsciiConvert(base::uc16* dst, const base::uc16* src,
+                          uint32_t length, bool* changed_out);
+
+// Converts the Latin-1 string {src} to lower case in the root locale, which
+// always results in a Latin-1 string of the same length.
+void Latin1ConvertToLower(uint8_t* dst, const uint8_t* src, uint32_t length);
+
+// Converts the Latin-1 string {src} to upper case in the root locale, up to
+// the first character whose upper case is not a single Latin-1 character
+// (U+00B5, U+00DF and U+00FF). Returns the number of characters converted.
+uint32_t Latin1ConvertToUpper(uint8_t* dst, const uint8_t* src,
+                              uint32_t length);
 
 }  // namespace internal
 }  // namespace v8
@@ -41,9 +41,31 @@ uint32_t ConvertRawHashToUsableHash(T raw_hash) {
 }
 
 V8_INLINE bool IsOnly8Bit(const uint16_t* chars, unsigned len) {
-  // TODO(leszeks): This could be SIMD for efficiency on large strings, if we
-  // need it.
-  for (unsigned i = 0; i < len; ++i) {
+  // Every two-byte string is scanned before hashing, so check eight
+  // characters at a time for any set bit in the high byte.
+  unsigned i = 0;
+#ifdef __SSE2__
+  const __m128i high_bytes = _mm_set1_epi16(static_cast<int16_t>(0xff00));
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 8 <= len; i += 8) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    __m128i is_8bit = _mm_cmpeq_epi16(_mm_and_si128(x, high_bytes), zero);
+    if (_mm_movemask_epi8(is_8bit) != 0xffff) return false;
+  }
+#elif defined(__ARM_NEON__)
+  for (; i + 8 <= len; i += 8) {
+    uint16x8_t x = vld1q_u16(chars + i);
+    uint8x8_t high = vshrn_n_u16(x, 8);
+    if (vget_lane_u64(vreinterpret_u64_u8(high), 0) != 0) return false;
+  }
+#else
+  for (; i + 4 <= len; i += 4) {
+    uint64_t x;
+    memcpy(&x, chars + i, sizeof(x));
+    if (x & uint64_t{0xff00ff00ff00ff00}) return false;
+  }
+#endif
+  for (; i < len; ++i) {
     if (chars[i] > 255) {
       return false;
     }
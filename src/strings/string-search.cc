@@ -0,0 +1,99 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+#include "hwy/highway.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Work the filter may spend on rejected candidates, in characters compared,
+// before it is considered worse than a linear-time search.
+constexpr int kFirstLastCharSearchSlack = 256;
+
+template <typename PatternChar, typename SubjectChar>
+int FirstLastCharSearchImpl(base::Vector<const PatternChar> pattern,
+                            base::Vector<const SubjectChar> subject,
+                            int* index) {
+  namespace hw = hwy::HWY_NAMESPACE;
+  static constexpr int kStride = 16 / sizeof(SubjectChar);
+  hw::FixedTag<SubjectChar, kStride> tag;
+
+  const int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+  const int last = pattern_length - 1;
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char = static_cast<SubjectChar>(pattern[last]);
+  DCHECK_EQ(first_char, pattern[0]);
+  DCHECK_EQ(last_char, pattern[last]);
+  const auto first_chars = hw::Set(tag, first_char);
+  const auto last_chars = hw::Set(tag, last_char);
+
+  const SubjectChar* chars = subject.begin();
+  // The last position at which the pattern can start.
+  const int n = subject.length() - pattern_length;
+  // Grows with the characters compared at rejected candidates, and shrinks
+  // with the positions skipped by the filter.
+  int badness = -kFirstLastCharSearchSlack;
+
+  auto matches_at = [&](int i) {
+    return chars[i] == first_char && chars[i + last] == last_char &&
+           CompareCharsEqual(pattern.begin() + 1, chars + i + 1, last - 1);
+  };
+
+  int i = *index;
+  for (; i + kStride - 1 <= n; i += kStride) {
+    const auto mask =
+        hw::And(hw::Eq(hw::LoadU(tag, chars + i), first_chars),
+                hw::Eq(hw::LoadU(tag, chars + i + last), last_chars));
+    if (V8_LIKELY(hw::AllFalse(tag, mask))) {
+      badness -= kStride;
+      continue;
+    }
+    for (int j = static_cast<int>(hw::FindKnownFirstTrue(tag, mask));
+         j < kStride; j++) {
+      if (matches_at(i + j)) return i + j;
+    }
+    badness += pattern_length;
+    if (V8_UNLIKELY(badness > 0)) {
+      *index = i + kStride;
+      return kFirstLastCharSearchBailout;
+    }
+  }
+  // Fewer than kStride positions are left.
+  for (; i <= n; i++) {
+    if (matches_at(i)) return i;
+  }
+  return -1;
+}
+
+}  // namespace
+
+int SimdFirstLastCharSearch(base::Vector<const uint8_t> pattern,
+                            base::Vector<const uint8_t> subject, int* index) {
+  return FirstLastCharSearchImpl(pattern, subject, index);
+}
+
+int SimdFirstLastCharSearch(base::Vector<const uint8_t> pattern,
+                            base::Vector<const base::uc16> subject,
+                            int* index) {
+  return FirstLastCharSearchImpl(pattern, subject, index);
+}
+
+int SimdFirstLastCharSearch(base::Vector<const base::uc16> pattern,
+                            base::Vector<const uint8_t> subject, int* index) {
+  return FirstLastCharSearchImpl(pattern, subject, index);
+}
+
+int SimdFirstLastCharSearch(base::Vector<const base::uc16> pattern,
+                            base::Vector<const base::uc16> subject,
+                            int* index) {
+  return FirstLastCharSearchImpl(pattern, subject, index);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -37,10 +37,10 @@ class StringSearchBase {
   static const int kLatin1AlphabetSize = 256;
   static const int kUC16AlphabetSize = Isolate::kUC16AlphabetSize;
 
-  // Bad-char shift table stored in the state. It's length is the alphabet size.
-  // For patterns below this length, the skip length of Boyer-Moore is too short
-  // to compensate for the algorithmic overhead compared to simple brute force.
-  static const int kBMMinPatternLength = 7;
+  // Patterns up to this length are searched by filtering candidate positions
+  // on their first and last character with SIMD. Longer patterns have enough
+  // skip distance for Boyer-Moore-Horspool to pay off.
+  static const int kFirstLastCharMaxPatternLength = 32;
 
   static inline bool IsOneByteString(base::Vector<const uint8_t> string) {
     return true;
@@ -67,12 +67,12 @@ class StringSearch : private StringSearchBase {
       }
     }
     int pattern_length = pattern_.length();
-    if (pattern_length < kBMMinPatternLength) {
-      if (pattern_length == 1) {
-        strategy_ = &SingleCharSearch;
-        return;
-      }
-      strategy_ = &LinearSearch;
+    if (pattern_length == 1) {
+      strategy_ = &SingleCharSearch;
+      return;
+    }
+    if (pattern_length <= kFirstLastCharMaxPatternLength) {
+      strategy_ = &FirstLastCharSearch;
       return;
     }
     strategy_ = &InitialSearch;
@@ -106,7 +106,11 @@ class StringSearch : private StringSearchBase {
                               base::Vector<const SubjectChar> subject,
                               int start_index);
 
-  static int LinearSearch(StringSearch<PatternChar, SubjectChar>* search,
+  static int FirstLastCharSearch(StringSearch<PatternChar, SubjectChar>* search,
+                                 base::Vector<const SubjectChar> subject,
+                                 int start_index);
+
+  static int TwoWaySearch(StringSearch<PatternChar, SubjectChar>* search,
                           base::Vector<const SubjectChar> subject,
                           int start_index);
 
@@ -126,6 +130,10 @@ class StringSearch : private StringSearchBase {
 
   void PopulateBoyerMooreTable();
 
+  void PopulateTwoWayFactorization();
+
+  int MaximalSuffix(bool reversed_order, int* period);
+
   static inline bool exceedsOneByte(uint8_t c) { return false; }
 
   static inline bool exceedsOneByte(uint16_t c) {
@@ -180,8 +188,35 @@ class StringSearch : private StringSearchBase {
   SearchFunction strategy_;
   // Cache value of max(0, pattern_length() - kBMMaxShift)
   int start_;
+  // Critical factorization of the pattern used by the Two-Way search: the
+  // pattern is split after two_way_suffix_, and two_way_period_ is the shift
+  // after a mismatch in the left part.
+  int two_way_suffix_ = 0;
+  int two_way_period_ = 0;
+  bool two_way_periodic_ = false;
 };
 
+// Searches for {pattern} in {subject} from {*index} on. The first and last
+// pattern characters are compared against a whole vector of subject positions
+// at once, and the rest of the pattern only where both match. Returns the
+// index of the first match or -1. Returns kFirstLastCharSearchBailout once too
+// many candidates turned out not to match; {*index} is then the position from
+// which the search has to be continued with another algorithm.
+// The pattern must have at least two characters, and fit into SubjectChar.
+constexpr int kFirstLastCharSearchBailout = -2;
+V8_EXPORT_PRIVATE int SimdFirstLastCharSearch(
+    base::Vector<const uint8_t> pattern, base::Vector<const uint8_t> subject,
+    int* index);
+V8_EXPORT_PRIVATE int SimdFirstLastCharSearch(
+    base::Vector<const uint8_t> pattern,
+    base::Vector<const base::uc16> subject, int* index);
+V8_EXPORT_PRIVATE int SimdFirstLastCharSearch(
+    base::Vector<const base::uc16> pattern,
+    base::Vector<const uint8_t> subject, int* index);
+V8_EXPORT_PRIVATE int SimdFirstLastCharSearch(
+    base::Vector<const base::uc16> pattern,
+    base::Vector<const base::uc16> subject, int* index);
+
 template <typename T, typename U>
 inline T AlignDown(T value, U alignment) {
   return reinterpret_cast<T>(
@@ -247,48 +282,135 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
 }
 
 //---------------------------------------------------------------------
-// Linear Search Strategy
+// First and last character filter search
 //---------------------------------------------------------------------
 
+// Vectorized search for short and medium patterns. Falls back to Two-Way,
+// which is linear in the worst case, if the filter lets through too many
+// positions that don't match (e.g. for highly repetitive subjects).
 template <typename PatternChar, typename SubjectChar>
-inline bool CharCompare(const PatternChar* pattern, const SubjectChar* subject,
-                        int length) {
-  DCHECK_GT(length, 0);
-  int pos = 0;
-  do {
-    if (pattern[pos] != subject[pos]) {
-      return false;
-    }
-    pos++;
-  } while (pos < length);
-  return true;
+int StringSearch<PatternChar, SubjectChar>::FirstLastCharSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    base::Vector<const SubjectChar> subject, int index) {
+  DCHECK_GT(search->pattern_.length(), 1);
+  int result = SimdFirstLastCharSearch(search->pattern_, subject, &index);
+  if (V8_LIKELY(result != kFirstLastCharSearchBailout)) return result;
+  search->PopulateTwoWayFactorization();
+  search->strategy_ = &TwoWaySearch;
+  return TwoWaySearch(search, subject, index);
 }
 
-// Simple linear search for short patterns. Never bails out.
+//---------------------------------------------------------------------
+// Two-Way string search
+//---------------------------------------------------------------------
+
+// Crochemore and Perrin's Two-Way algorithm. It runs in linear time and
+// constant space, so unlike Boyer-Moore it needs no tables.
 template <typename PatternChar, typename SubjectChar>
-int StringSearch<PatternChar, SubjectChar>::LinearSearch(
+int StringSearch<PatternChar, SubjectChar>::TwoWaySearch(
     StringSearch<PatternChar, SubjectChar>* search,
     base::Vector<const SubjectChar> subject, int index) {
   base::Vector<const PatternChar> pattern = search->pattern_;
-  DCHECK_GT(pattern.length(), 1);
   int pattern_length = pattern.length();
-  int i = index;
   int n = subject.length() - pattern_length;
-  while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
-    if (i == -1) return -1;
-    DCHECK_LE(i, n);
-    i++;
-    // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.begin() + 1, subject.begin() + i,
-                    pattern_length - 1)) {
-      return i - 1;
+  int suffix = search->two_way_suffix_;
+  int period = search->two_way_period_;
+  if (search->two_way_periodic_) {
+    // Characters before {memory} are known to match from the previous
+    // attempt, since we shifted by exactly one period.
+    int memory = -1;
+    while (index <= n) {
+      int i = std::max(suffix, memory) + 1;
+      while (i < pattern_length && pattern[i] == subject[index + i]) i++;
+      if (i < pattern_length) {
+        index += i - suffix;
+        memory = -1;
+        continue;
+      }
+      i = suffix;
+      while (i > memory && pattern[i] == subject[index + i]) i--;
+      if (i <= memory) return index;
+      index += period;
+      memory = pattern_length - period - 1;
+    }
+  } else {
+    while (index <= n) {
+      int i = suffix + 1;
+      while (i < pattern_length && pattern[i] == subject[index + i]) i++;
+      if (i < pattern_length) {
+        index += i - suffix;
+        continue;
+      }
+      i = suffix;
+      while (i >= 0 && pattern[i] == subject[index + i]) i--;
+      if (i < 0) return index;
+      index += period;
     }
   }
   return -1;
 }
 
+// Computes the maximal suffix of the pattern with respect to the character
+// order (or the reversed order), and its period. Returns the index before the
+// start of the suffix.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::MaximalSuffix(bool reversed_order,
+                                                          int* period) {
+  int pattern_length = pattern_.length();
+  int suffix = -1;
+  int j = 0;
+  int k = 1;
+  int p = 1;
+  while (j + k < pattern_length) {
+    PatternChar a = pattern_[j + k];
+    PatternChar b = pattern_[suffix + k];
+    if (reversed_order ? a > b : a < b) {
+      j += k;
+      k = 1;
+      p = j - suffix;
+    } else if (a == b) {
+      if (k != p) {
+        k++;
+      } else {
+        j += p;
+        k = 1;
+      }
+    } else {
+      suffix = j;
+      j = suffix + 1;
+      k = p = 1;
+    }
+  }
+  *period = p;
+  return suffix;
+}
+
+template <typename PatternChar, typename SubjectChar>
+void StringSearch<PatternChar, SubjectChar>::PopulateTwoWayFactorization() {
+  // The later of the two maximal suffixes gives a critical factorization.
+  int period;
+  int reversed_period;
+  int suffix = MaximalSuffix(false, &period);
+  int reversed_suffix = MaximalSuffix(true, &reversed_period);
+  if (reversed_suffix > suffix) {
+    suffix = reversed_suffix;
+    period = reversed_period;
+  }
+  int pattern_length = pattern_.length();
+  two_way_suffix_ = suffix;
+  // The factorization is periodic if the left part is a suffix of the first
+  // period of the right part.
+  two_way_periodic_ =
+      suffix + 1 + period <= pattern_length &&
+      CompareCharsEqual(pattern_.begin(), pattern_.begin() + period,
+                        suffix + 1);
+  if (two_way_periodic_) {
+    two_way_period_ = period;
+  } else {
+    two_way_period_ = std::max(suffix + 1, pattern_length - suffix - 1) + 1;
+  }
+}
+
 //---------------------------------------------------------------------
 // Boyer-Moore string search
 //---------------------------------------------------------------------
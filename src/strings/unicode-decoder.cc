@@ -4,8 +4,11 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include <algorithm>
+
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
+#include "third_party/simdutf/simdutf.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "third_party/utf8-decoder/generalized-utf8-decoder.h"
@@ -64,6 +67,24 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
   using Traits = DecoderTraits<Decoder>;
   if (non_ascii_start_ == data.length()) return;
 
+  // Well-formed UTF-8 only contains Unicode scalar values, which all decoders
+  // decode in the same way, so it is validated and measured with SIMD. Only
+  // ill-formed data goes through the DFA.
+  const char* rest = reinterpret_cast<const char*>(data.begin()) +
+                     non_ascii_start_;
+  size_t rest_length = data.length() - non_ascii_start_;
+  if (simdutf::validate_utf8(rest, rest_length)) {
+    is_well_formed_ = true;
+    utf16_length_ += static_cast<int>(
+        simdutf::utf16_length_from_utf8(rest, rest_length));
+    // Only the code points above U+00FF have a leading byte above 0xC3.
+    bool is_one_byte = std::none_of(rest, rest + rest_length, [](char c) {
+      return static_cast<uint8_t>(c) > 0xC3;
+    });
+    encoding_ = is_one_byte ? Encoding::kLatin1 : Encoding::kUtf16;
+    return;
+  }
+
   bool is_one_byte = true;
   auto state = Traits::DfaDecoder::kAccept;
   uint32_t current = 0;
@@ -135,6 +156,20 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
 
   out += non_ascii_start_;
 
+  if (is_well_formed_) {
+    const char* rest = reinterpret_cast<const char*>(data.begin()) +
+                       non_ascii_start_;
+    size_t rest_length = data.length() - non_ascii_start_;
+    if constexpr (sizeof(Char) == 1) {
+      simdutf::convert_valid_utf8_to_latin1(rest, rest_length,
+                                            reinterpret_cast<char*>(out));
+    } else {
+      simdutf::convert_valid_utf8_to_utf16(rest, rest_length,
+                                           reinterpret_cast<char16_t*>(out));
+    }
+    return;
+  }
+
   auto state = Traits::DfaDecoder::kAccept;
   uint32_t current = 0;
   const uint8_t* cursor = data.begin() + non_ascii_start_;
@@ -75,6 +75,9 @@ class Utf8DecoderBase {
   Encoding encoding_;
   int non_ascii_start_;
   int utf16_length_;
+  // Whether the data after {non_ascii_start_} is well-formed UTF-8, which is
+  // then decoded with SIMD.
+  bool is_well_formed_ = false;
 };
 
 class V8_EXPORT_PRIVATE Utf8Decoder final
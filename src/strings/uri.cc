@@ -6,6 +6,7 @@
 
 #include <vector>
 
+#include "hwy/highway.h"
 #include "src/execution/isolate-inl.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-search.h"
@@ -172,11 +173,27 @@ bool IntoOneAndTwoByte(DirectHandle<String> uri, bool is_uri,
   return true;
 }
 
+template <typename Char>
+bool HasEscapeSequence(Isolate* isolate, base::Vector<const Char> chars) {
+  StringSearch<uint8_t, Char> search(isolate, base::StaticOneByteVector("%"));
+  return search.Search(chars, 0) >= 0;
+}
+
 }  // anonymous namespace
 
 MaybeDirectHandle<String> Uri::Decode(Isolate* isolate,
                                       DirectHandle<String> uri, bool is_uri) {
   uri = String::Flatten(isolate, uri);
+  {
+    // Strings without escape sequences decode to themselves.
+    DisallowGarbageCollection no_gc;
+    String::FlatContent uri_content = uri->GetFlatContent(no_gc);
+    bool has_escape_sequence =
+        uri_content.IsOneByte()
+            ? HasEscapeSequence(isolate, uri_content.ToOneByteVector())
+            : HasEscapeSequence(isolate, uri_content.ToUC16Vector());
+    if (!has_escape_sequence) return uri;
+  }
   std::vector<uint8_t> one_byte_buffer;
   std::vector<base::uc16> two_byte_buffer;
 
@@ -209,7 +226,7 @@ MaybeDirectHandle<String> Uri::Decode(Isolate* isolate,
 }
 
 namespace {  // anonymous namespace for EncodeURI helper functions
-bool IsUnescapePredicateInUriComponent(base::uc16 c) {
+constexpr bool IsUnescapePredicateInUriComponent(base::uc16 c) {
   if (IsAlphaNumeric(c)) {
     return true;
   }
@@ -230,7 +247,7 @@ bool IsUnescapePredicateInUriComponent(base::uc16 c) {
   }
 }
 
-bool IsUriSeparator(base::uc16 c) {
+constexpr bool IsUriSeparator(base::uc16 c) {
   switch (c) {
     case '#':
     case ':':
@@ -249,6 +266,133 @@ bool IsUriSeparator(base::uc16 c) {
   }
 }
 
+namespace hw = hwy::HWY_NAMESPACE;
+
+// The ASCII characters that are copied to the output unchanged, as a pair of
+// nibble-indexed tables: {c} is in the set iff the bit selected by its high
+// nibble is set in the entry for its low nibble. This lets 16 characters be
+// classified with two byte shuffles.
+class UnescapedCharacterSet {
+ public:
+  constexpr explicit UnescapedCharacterSet(bool is_uri) {
+    for (int c = 0; c < 0x80; c++) {
+      if (IsUnescapePredicateInUriComponent(c) ||
+          (is_uri && IsUriSeparator(c))) {
+        low_nibble_bits_[c & 0x0F] |= 1 << (c >> 4);
+      }
+    }
+    // Characters with the high bit set are always escaped.
+    for (int high = 0; high < 8; high++) {
+      high_nibble_bits_[high] = 1 << high;
+    }
+  }
+
+  constexpr bool Contains(uint8_t c) const {
+    return (low_nibble_bits_[c & 0x0F] & high_nibble_bits_[c >> 4]) != 0;
+  }
+
+  template <typename D>
+  V8_INLINE hw::MFromD<D> Contains(D d, hw::VFromD<D> chars) const {
+    const auto low = hw::TableLookupBytes(hw::LoadU(d, low_nibble_bits_),
+                                          hw::And(chars, hw::Set(d, 0x0F)));
+    const auto high = hw::TableLookupBytes(hw::LoadU(d, high_nibble_bits_),
+                                           hw::ShiftRight<4>(chars));
+    return hw::Ne(hw::And(low, high), hw::Zero(d));
+  }
+
+ private:
+  uint8_t low_nibble_bits_[16] = {};
+  uint8_t high_nibble_bits_[16] = {};
+};
+
+constexpr UnescapedCharacterSet kUriUnescaped(true);
+constexpr UnescapedCharacterSet kUriComponentUnescaped(false);
+
+uint8_t* WriteEncodedOctet(uint8_t octet, uint8_t* dest) {
+  dest[0] = '%';
+  dest[1] = base::HexCharOfValue(octet >> 4);
+  dest[2] = base::HexCharOfValue(octet & 0x0F);
+  return dest + 3;
+}
+
+// One-byte strings cannot contain surrogates, so they are encoded without
+// failure into a result whose length is computed upfront. Runs of unescaped
+// characters, which make up most of typical input, are copied 16 at a time.
+MaybeDirectHandle<String> EncodeOneByte(Isolate* isolate,
+                                        DirectHandle<String> uri,
+                                        bool is_uri) {
+  const UnescapedCharacterSet& unescaped =
+      is_uri ? kUriUnescaped : kUriComponentUnescaped;
+  hw::FixedTag<uint8_t, 16> d;
+  constexpr uint32_t kStride = hw::MaxLanes(d);
+  const auto max_ascii = hw::Set(d, unibrow::Utf8::kMaxOneByteChar);
+  const uint32_t length = uri->length();
+
+  // Escaped ASCII characters take three characters, and non-ASCII ones are
+  // two UTF-8 octets of three characters each.
+  size_t encoded_length;
+  {
+    DisallowGarbageCollection no_gc;
+    const uint8_t* chars =
+        uri->GetFlatContent(no_gc).ToOneByteVector().begin();
+    size_t escaped = 0;
+    size_t non_ascii = 0;
+    uint32_t i = 0;
+    for (; i + kStride <= length; i += kStride) {
+      const auto block = hw::LoadU(d, chars + i);
+      escaped += kStride - hw::CountTrue(d, unescaped.Contains(d, block));
+      non_ascii += hw::CountTrue(d, hw::Gt(block, max_ascii));
+    }
+    for (; i < length; i++) {
+      if (!unescaped.Contains(chars[i])) escaped++;
+      if (chars[i] > unibrow::Utf8::kMaxOneByteChar) non_ascii++;
+    }
+    encoded_length = length + 2 * escaped + 3 * non_ascii;
+  }
+
+  if (encoded_length == length) return uri;
+  if (encoded_length > String::kMaxLength) {
+    THROW_NEW_ERROR(isolate, NewInvalidStringLengthError());
+  }
+  Handle<SeqOneByteString> result;
+  ASSIGN_RETURN_ON_EXCEPTION(isolate, result,
+                             isolate->factory()->NewRawOneByteString(
+                                 static_cast<int>(encoded_length)));
+
+  DisallowGarbageCollection no_gc;
+  const uint8_t* chars = uri->GetFlatContent(no_gc).ToOneByteVector().begin();
+  uint8_t* dest = result->GetChars(no_gc);
+  uint32_t i = 0;
+  while (i < length) {
+    if (i + kStride <= length) {
+      const auto block = hw::LoadU(d, chars + i);
+      // The rest of the output is at least as long as the rest of the input,
+      // so the whole block can be stored even if only a prefix is kept.
+      hw::StoreU(block, d, dest);
+      const auto escape = hw::Not(unescaped.Contains(d, block));
+      if (hw::AllFalse(d, escape)) {
+        i += kStride;
+        dest += kStride;
+        continue;
+      }
+      const size_t run = hw::FindKnownFirstTrue(d, escape);
+      i += run;
+      dest += run;
+    }
+    const uint8_t c = chars[i++];
+    if (unescaped.Contains(c)) {
+      *dest++ = c;
+    } else if (c <= unibrow::Utf8::kMaxOneByteChar) {
+      dest = WriteEncodedOctet(c, dest);
+    } else {
+      dest = WriteEncodedOctet(0xC0 | (c >> 6), dest);
+      dest = WriteEncodedOctet(0x80 | (c & 0x3F), dest);
+    }
+  }
+  DCHECK_EQ(dest, result->GetChars(no_gc) + encoded_length);
+  return result;
+}
+
 void AddEncodedOctetToBuffer(uint8_t octet, std::vector<uint8_t>* buffer) {
   buffer->push_back('%');
   buffer->push_back(base::HexCharOfValue(octet >> 4));
@@ -280,6 +424,13 @@ void EncodePair(base::uc16 cc1, base::uc16 cc2, std::vector<uint8_t>* buffer) {
 MaybeDirectHandle<String> Uri::Encode(Isolate* isolate,
                                       DirectHandle<String> uri, bool is_uri) {
   uri = String::Flatten(isolate, uri);
+  bool is_one_byte;
+  {
+    DisallowGarbageCollection no_gc;
+    is_one_byte = uri->GetFlatContent(no_gc).IsOneByte();
+  }
+  if (is_one_byte) return EncodeOneByte(isolate, uri, is_uri);
+
   int uri_length = uri->length();
   std::vector<uint8_t> buffer;
   buffer.reserve(uri_length);
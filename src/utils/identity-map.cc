@@ -12,9 +12,31 @@
 namespace v8 {
 namespace internal {
 
-static const int kInitialIdentityMapSize = 4;
+using swiss_table::ctrl_t;
+using swiss_table::Group;
+
+static const int kGroupWidth = static_cast<int>(Group::kWidth);
+static const int kInitialIdentityMapSize = kGroupWidth;
 static const int kResizeFactor = 2;
 
+// Control bytes are allocated through NewPointerArray, so they are stored as
+// whole words filled with kEmpty.
+static_assert(kGroupWidth % kSystemPointerSize == 0);
+static const uintptr_t kEmptyControlWord =
+    static_cast<uintptr_t>(0x8080808080808080ULL);
+static_assert(static_cast<ctrl_t>(kEmptyControlWord & 0xFF) ==
+              swiss_table::kEmpty);
+
+namespace {
+
+using ProbeSequence = swiss_table::ProbeSequence<1>;
+
+bool IsFull(ctrl_t c) { return c >= 0; }
+
+int ControlWords(int capacity) { return capacity / kSystemPointerSize; }
+
+}  // namespace
+
 IdentityMapBase::~IdentityMapBase() {
   // Clear must be called by the subclass to avoid calling the virtual
   // DeleteArray function from the destructor.
@@ -26,14 +48,18 @@ void IdentityMapBase::Clear() {
     DCHECK(!is_iterable());
     DCHECK_NOT_NULL(strong_roots_entry_);
     heap_->UnregisterStrongRoots(strong_roots_entry_);
+    DeletePointerArray(reinterpret_cast<uintptr_t*>(ctrl_),
+                       ControlWords(capacity_));
     DeletePointerArray(reinterpret_cast<uintptr_t*>(keys_), capacity_);
     DeletePointerArray(values_, capacity_);
+    ctrl_ = nullptr;
     keys_ = nullptr;
     strong_roots_entry_ = nullptr;
     values_ = nullptr;
     size_ = 0;
+    deleted_ = 0;
     capacity_ = 0;
-    mask_ = 0;
+    group_mask_ = 0;
   }
 }
 
@@ -47,24 +73,24 @@ void IdentityMapBase::DisableIteration() {
   is_iterable_ = false;
 }
 
-std::pair<int, bool> IdentityMapBase::ScanKeysFor(Address address,
-                                                  uint32_t hash) const {
-  int start = hash & mask_;
-  Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-  for (int index = start; index < capacity_; index++) {
-    if (keys_[index] == address) return {index, true};      // Found.
-    if (keys_[index] == not_mapped) return {index, false};  // Not found.
-  }
-  for (int index = 0; index < start; index++) {
-    if (keys_[index] == address) return {index, true};      // Found.
-    if (keys_[index] == not_mapped) return {index, false};  // Not found.
+int IdentityMapBase::ScanKeysFor(Address address, uint32_t hash) const {
+  const swiss_table::h2_t h2 = swiss_table::H2(hash);
+  for (ProbeSequence seq(swiss_table::H1(hash), group_mask_);; seq.next()) {
+    DCHECK_LE(seq.index(), group_mask_);
+    int group_start = seq.offset() * kGroupWidth;
+    Group group(ctrl_ + group_start);
+    for (int i : group.Match(h2)) {
+      if (keys_[group_start + i] == address) return group_start + i;  // Found.
+    }
+    // A group with an empty slot ends the probe sequence.
+    if (group.MatchEmpty()) return -1;  // Not found.
   }
-  return {-1, false};
 }
 
 bool IdentityMapBase::ShouldGrow() const {
-  // Grow the map if we reached >= 80% occupancy.
-  return size_ + size_ / 4 >= capacity_;
+  // Grow the map if inserting would take empty and deleted slots together
+  // above 87.5% occupancy.
+  return (size_ + deleted_ + 1) * 8 > capacity_ * 7;
 }
 
 std::pair<int, bool> IdentityMapBase::InsertKey(Address address,
@@ -73,111 +99,103 @@ std::pair<int, bool> IdentityMapBase::InsertKey(Address address,
   DCHECK_EQ(gc_counter_, heap_->gc_count());
 
   if (ShouldGrow()) {
-    Resize(capacity_ * kResizeFactor);
+    // If most of the occupied slots are deleted ones, rebuilding the table at
+    // the same capacity is enough.
+    Resize(size_ * kResizeFactor >= capacity_ ? capacity_ * kResizeFactor
+                                              : capacity_);
   }
 
-  Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-
-  int start = hash & mask_;
-  // Guaranteed to terminate since size_ < capacity_, there must be at least
-  // one empty slot.
-  int index = start;
-  while (true) {
-    if (keys_[index] == address) return {index, true};  // Found.
-    if (keys_[index] == not_mapped) {                   // Free entry.
-      size_++;
-      DCHECK_LE(size_, capacity_);
-      keys_[index] = address;
-      return {index, false};
+  const swiss_table::h2_t h2 = swiss_table::H2(hash);
+  int index = -1;
+  // Guaranteed to terminate since ShouldGrow() leaves at least one empty slot.
+  for (ProbeSequence seq(swiss_table::H1(hash), group_mask_);; seq.next()) {
+    DCHECK_LE(seq.index(), group_mask_);
+    int group_start = seq.offset() * kGroupWidth;
+    Group group(ctrl_ + group_start);
+    for (int i : group.Match(h2)) {
+      if (keys_[group_start + i] == address) {
+        return {group_start + i, true};  // Found.
+      }
+    }
+    if (index < 0) {
+      // Remember the first deleted slot so that it can be reused.
+      for (int i : group.Match(static_cast<swiss_table::h2_t>(
+               swiss_table::kDeleted))) {
+        if (ctrl_[group_start + i] == swiss_table::kDeleted) {
+          index = group_start + i;
+          break;
+        }
+      }
+    }
+    auto empty = group.MatchEmpty();
+    if (empty) {
+      if (index < 0) index = group_start + empty.LowestBitSet();
+      break;
     }
-    index = (index + 1) & mask_;
-    // We should never loop back to the start.
-    DCHECK_NE(index, start);
   }
+
+  // Free entry.
+  if (ctrl_[index] == swiss_table::kDeleted) deleted_--;
+  ctrl_[index] = h2;
+  keys_[index] = address;
+  size_++;
+  DCHECK_LE(size_ + deleted_, capacity_);
+  return {index, false};
 }
 
 bool IdentityMapBase::DeleteIndex(int index, uintptr_t* deleted_value) {
   DCHECK_NE(heap_->gc_state(), Heap::MARK_COMPACT);
   if (deleted_value != nullptr) *deleted_value = values_[index];
   Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
+  DCHECK(IsFull(ctrl_[index]));
   DCHECK_NE(keys_[index], not_mapped);
   keys_[index] = not_mapped;
   values_[index] = 0;
   size_--;
   DCHECK_GE(size_, 0);
 
+  // Once a group has been full it never gets an empty slot back until the
+  // table is rebuilt. So if this group still has an empty slot, no probe
+  // sequence has ever continued past it and the slot can become empty again.
+  // Otherwise it has to stay a tombstone.
+  int group_start = index & ~(kGroupWidth - 1);
+  if (Group(ctrl_ + group_start).MatchEmpty()) {
+    ctrl_[index] = swiss_table::kEmpty;
+  } else {
+    ctrl_[index] = swiss_table::kDeleted;
+    deleted_++;
+  }
+
   if (capacity_ > kInitialIdentityMapSize &&
       size_ * kResizeFactor < capacity_ / kResizeFactor) {
     Resize(capacity_ / kResizeFactor);
-    return true;  // No need to fix collisions as resize reinserts keys.
   }
-
-  // Move any collisions to their new correct location.
-  int next_index = index;
-  for (;;) {
-    next_index = (next_index + 1) & mask_;
-    Address key = keys_[next_index];
-    if (key == not_mapped) break;
-
-    int expected_index = Hash(key) & mask_;
-    if (index < next_index) {
-      if (index < expected_index && expected_index <= next_index) continue;
-    } else {
-      DCHECK_GT(index, next_index);
-      if (index < expected_index || expected_index <= next_index) continue;
-    }
-
-    DCHECK_EQ(not_mapped, keys_[index]);
-    DCHECK_EQ(values_[index], 0);
-    std::swap(keys_[index], keys_[next_index]);
-    std::swap(values_[index], values_[next_index]);
-    index = next_index;
-  }
-
   return true;
 }
 
 int IdentityMapBase::Lookup(Address key) const {
   DCHECK_NE(heap_->gc_state(), Heap::MARK_COMPACT);
   uint32_t hash = Hash(key);
-  int index;
-  bool found;
-  std::tie(index, found) = ScanKeysFor(key, hash);
-  if (!found && gc_counter_ != heap_->gc_count()) {
+  int index = ScanKeysFor(key, hash);
+  if (index < 0 && gc_counter_ != heap_->gc_count()) {
     // Miss; rehash if there was a GC, then lookup again.
     const_cast<IdentityMapBase*>(this)->Rehash();
-    std::tie(index, found) = ScanKeysFor(key, hash);
+    index = ScanKeysFor(key, hash);
   }
-  return found ? index : -1;
+  return index;
 }
 
 std::pair<int, bool> IdentityMapBase::LookupOrInsert(Address key) {
   DCHECK_NE(heap_->gc_state(), Heap::MARK_COMPACT);
   uint32_t hash = Hash(key);
-  // Perform an optimistic lookup.
-  int index;
-  bool already_exists;
-  std::tie(index, already_exists) = ScanKeysFor(key, hash);
-  if (!already_exists) {
-    // Miss; rehash if there was a GC, then insert.
-    if (gc_counter_ != heap_->gc_count()) {
-      Rehash();
-      index = -1;
-    }
-    if (index < 0 || ShouldGrow()) {
-      std::tie(index, already_exists) = InsertKey(key, hash);
-    } else {
-      // If rehashing is not necessary, and the table is already big enough,
-      // then avoid calling InsertKey because it would search the table again
-      // and we already found an adequate location to insert the new key.
-      size_++;
-      DCHECK_LE(size_, capacity_);
-      DCHECK_EQ(keys_[index], ReadOnlyRoots(heap_).not_mapped_symbol().ptr());
-      keys_[index] = key;
-    }
+  if (gc_counter_ != heap_->gc_count()) {
+    // Perform an optimistic lookup; on a miss, rehash before inserting.
+    int index = ScanKeysFor(key, hash);
+    if (index >= 0) return {index, true};
+    Rehash();
   }
-  DCHECK_GE(index, 0);
-  return {index, already_exists};
+  // InsertKey finds an existing key and a free slot in the same pass.
+  return InsertKey(key, hash);
 }
 
 uint32_t IdentityMapBase::Hash(Address address) const {
@@ -220,16 +238,8 @@ IdentityMapBase::RawEntry IdentityMapBase::InsertEntry(Address key) {
   // Don't allow find by key while iterable (might rehash).
   CHECK(!is_iterable());
   if (capacity_ == 0) {
-    // Allocate the initial storage for keys and values.
-    capacity_ = kInitialIdentityMapSize;
-    mask_ = kInitialIdentityMapSize - 1;
-    gc_counter_ = heap_->gc_count();
-
-    uintptr_t not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-    keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_, not_mapped));
-    for (int i = 0; i < capacity_; i++) keys_[i] = not_mapped;
-    values_ = NewPointerArray(capacity_, 0);
-
+    // Allocate the initial storage for control bytes, keys and values.
+    AllocateTables(kInitialIdentityMapSize);
     strong_roots_entry_ =
         heap_->RegisterStrongRoots("IdentityMapBase", FullObjectSlot(keys_),
                                    FullObjectSlot(keys_ + capacity_));
@@ -259,7 +269,7 @@ bool IdentityMapBase::DeleteEntry(Address key, uintptr_t* deleted_value) {
 Address IdentityMapBase::KeyAtIndex(int index) const {
   DCHECK_LE(0, index);
   DCHECK_LT(index, capacity_);
-  DCHECK_NE(keys_[index], ReadOnlyRoots(heap_).not_mapped_symbol().ptr());
+  DCHECK(IsFull(ctrl_[index]));
   CHECK(is_iterable());  // Must be iterable to access by index;
   return keys_[index];
 }
@@ -267,7 +277,7 @@ Address IdentityMapBase::KeyAtIndex(int index) const {
 IdentityMapBase::RawEntry IdentityMapBase::EntryAtIndex(int index) const {
   DCHECK_LE(0, index);
   DCHECK_LT(index, capacity_);
-  DCHECK_NE(keys_[index], ReadOnlyRoots(heap_).not_mapped_symbol().ptr());
+  DCHECK(IsFull(ctrl_[index]));
   CHECK(is_iterable());  // Must be iterable to access by index;
   return &values_[index];
 }
@@ -276,11 +286,9 @@ int IdentityMapBase::NextIndex(int index) const {
   DCHECK_LE(-1, index);
   DCHECK_LE(index, capacity_);
   CHECK(is_iterable());  // Must be iterable to access by index;
-  Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
+  // Only the control bytes need to be scanned to skip free slots.
   for (++index; index < capacity_; ++index) {
-    if (keys_[index] != not_mapped) {
-      return index;
-    }
+    if (IsFull(ctrl_[index])) return index;
   }
   return capacity_;
 }
@@ -288,35 +296,26 @@ int IdentityMapBase::NextIndex(int index) const {
 void IdentityMapBase::Rehash() {
   DCHECK_NE(heap_->gc_state(), Heap::MARK_COMPACT);
   CHECK(!is_iterable());  // Can't rehash while iterating.
-  // Record the current GC counter.
+  // Moved objects have different hashes, which invalidates both their control
+  // bytes and their probe positions. Rebuild the table at the same capacity,
+  // which also drops any deleted slots.
+  Resize(capacity_);
+}
+
+void IdentityMapBase::AllocateTables(int capacity) {
+  DCHECK(base::bits::IsPowerOfTwo(capacity));
+  DCHECK_GE(capacity, kGroupWidth);
+  capacity_ = capacity;
+  group_mask_ = capacity / kGroupWidth - 1;
   gc_counter_ = heap_->gc_count();
-  // Assume that most objects won't be moved.
-  std::vector<std::pair<Address, uintptr_t>> reinsert;
-  // Search the table looking for keys that wouldn't be found with their
-  // current hashcode and evacuate them.
-  int last_empty = -1;
+  size_ = 0;
+  deleted_ = 0;
+
   Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-  for (int i = 0; i < capacity_; i++) {
-    if (keys_[i] == not_mapped) {
-      last_empty = i;
-    } else {
-      int pos = Hash(keys_[i]) & mask_;
-      if (pos <= last_empty || pos > i) {
-        // Evacuate an entry that is in the wrong place.
-        reinsert.push_back(std::pair<Address, uintptr_t>(keys_[i], values_[i]));
-        keys_[i] = not_mapped;
-        values_[i] = 0;
-        last_empty = i;
-        size_--;
-      }
-    }
-  }
-  // Reinsert all the key/value pairs that were in the wrong place.
-  for (auto pair : reinsert) {
-    int index = InsertKey(pair.first, Hash(pair.first)).first;
-    DCHECK_GE(index, 0);
-    values_[index] = pair.second;
-  }
+  ctrl_ = reinterpret_cast<ctrl_t*>(
+      NewPointerArray(ControlWords(capacity_), kEmptyControlWord));
+  keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_, not_mapped));
+  values_ = NewPointerArray(capacity_, 0);
 }
 
 void IdentityMapBase::Resize(int new_capacity) {
@@ -325,20 +324,16 @@ void IdentityMapBase::Resize(int new_capacity) {
   // Resize the internal storage and reinsert all the key/value pairs.
   DCHECK_GT(new_capacity, size_);
   int old_capacity = capacity_;
+  ctrl_t* old_ctrl = ctrl_;
   Address* old_keys = keys_;
   uintptr_t* old_values = values_;
 
-  capacity_ = new_capacity;
-  mask_ = capacity_ - 1;
-  gc_counter_ = heap_->gc_count();
-  size_ = 0;
-
-  Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-  keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_, not_mapped));
-  values_ = NewPointerArray(capacity_, 0);
+  AllocateTables(new_capacity);
 
   for (int i = 0; i < old_capacity; i++) {
-    if (old_keys[i] == not_mapped) continue;
+    if (!IsFull(old_ctrl[i])) continue;
+    // After a GC, two keys may have become the same object (e.g. a ThinString
+    // and its internalized string); InsertKey then keeps only the first.
     int index = InsertKey(old_keys[i], Hash(old_keys[i])).first;
     DCHECK_GE(index, 0);
     values_[index] = old_values[i];
@@ -350,6 +345,8 @@ void IdentityMapBase::Resize(int new_capacity) {
                            FullObjectSlot(keys_ + capacity_));
 
   // Delete old storage;
+  DeletePointerArray(reinterpret_cast<uintptr_t*>(old_ctrl),
+                     ControlWords(old_capacity));
   DeletePointerArray(reinterpret_cast<uintptr_t*>(old_keys), old_capacity);
   DeletePointerArray(old_values, old_capacity);
 }
@@ -9,6 +9,7 @@
 
 #include "src/base/hashing.h"
 #include "src/handles/handles.h"
+#include "src/objects/swiss-hash-table-helpers.h"
 #include "src/objects/tagged.h"
 
 namespace v8 {
@@ -26,6 +27,12 @@ struct IdentityMapFindResult {
 
 // Base class of identity maps contains shared code for all template
 // instantiations.
+//
+// The table is a Swiss table: every slot has a control byte holding either
+// the low 7 bits of the key's hash or an empty/deleted marker, and lookups
+// probe whole groups of control bytes at once (using SIMD where available)
+// before comparing any keys. Groups are aligned, so the capacity is always a
+// multiple of the group width.
 class V8_EXPORT_PRIVATE IdentityMapBase {
  public:
   IdentityMapBase(const IdentityMapBase&) = delete;
@@ -47,7 +54,9 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
         gc_counter_(-1),
         size_(0),
         capacity_(0),
-        mask_(0),
+        deleted_(0),
+        group_mask_(0),
+        ctrl_(nullptr),
         keys_(nullptr),
         strong_roots_entry_(nullptr),
         values_(nullptr),
@@ -73,17 +82,17 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
 
  private:
   // Internal implementation should not be called directly by subclasses.
-  // The result is {index, found}. The index is either:
-  //   * The index where the key was found (found=true)
-  //   * The index of the first empty space encountered (found=false)
-  //   * -1 if the table is full and the key was not found (found=false)
-  std::pair<int, bool> ScanKeysFor(Address address, uint32_t hash) const;
+  // Returns the index where the key was found, or -1.
+  int ScanKeysFor(Address address, uint32_t hash) const;
+  // The result is {index, found}, where index is either the index where the
+  // key was found (found=true) or where it was inserted (found=false).
   std::pair<int, bool> InsertKey(Address address, uint32_t hash);
   int Lookup(Address key) const;
   std::pair<int, bool> LookupOrInsert(Address key);
   bool DeleteIndex(int index, uintptr_t* deleted_value);
   void Rehash();
   void Resize(int new_capacity);
+  void AllocateTables(int capacity);
   uint32_t Hash(Address address) const;
   bool ShouldGrow() const;
 
@@ -92,7 +101,11 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
   int gc_counter_;
   int size_;
   int capacity_;
-  int mask_;
+  // Number of slots whose control byte is kDeleted.
+  int deleted_;
+  // Number of groups minus one.
+  uint32_t group_mask_;
+  swiss_table::ctrl_t* ctrl_;
   Address* keys_;
   StrongRootsEntry* strong_roots_entry_;
   uintptr_t* values_;
@@ -4,11 +4,162 @@
 
 #include "src/utils/memcopy.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "src/codegen/cpu-features.h"
+#include "src/flags/flags.h"
 #include "src/snapshot/embedded/embedded-data-inl.h"
 
+#if V8_OS_POSIX
+#include <unistd.h>
+#endif
+
+#if V8_HOST_ARCH_X64 && V8_TARGET_ARCH_X64
+#include <immintrin.h>
+#define V8_NON_TEMPORAL_MEMCOPY 1
+// Since we don't compile with -mavx2 (or /arch:AVX2 on MSVC), the AVX2 kernel
+// is compiled for that target explicitly and only called if the CPU supports
+// it. Clang on Windows cannot do this without /arch:AVX2.
+#if defined(__SSE3__) && !(defined(_MSC_VER) && defined(__clang__))
+#define V8_NON_TEMPORAL_MEMCOPY_AVX2 1
+#ifdef _MSC_VER
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+#endif  // V8_HOST_ARCH_X64 && V8_TARGET_ARCH_X64
+
 namespace v8 {
 namespace internal {
 
+namespace {
+
+#if V8_NON_TEMPORAL_MEMCOPY
+// Assumed size of the last-level cache if it cannot be queried.
+constexpr size_t kDefaultLastLevelCacheSize = 8 * MB;
+
+// The kernels need room for aligning the destination and a few whole blocks.
+constexpr size_t kMinNonTemporalMemCopySize = 256;
+
+size_t LastLevelCacheSize() {
+#if V8_OS_LINUX && defined(_SC_LEVEL3_CACHE_SIZE)
+  long size = sysconf(_SC_LEVEL3_CACHE_SIZE);  // NOLINT(runtime/int)
+  if (size <= 0) size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  if (size > 0) return static_cast<size_t>(size);
+#endif
+  return kDefaultLastLevelCacheSize;
+}
+
+// All kernels align the destination, stream whole blocks and leave the
+// remainder to memcpy.
+void MemCopyNonTemporalSSE2(uint8_t* dst, const uint8_t* src, size_t size) {
+  constexpr size_t kAlignment = sizeof(__m128i);
+  constexpr size_t kBlockSize = 4 * sizeof(__m128i);
+  size_t head = RoundUp(reinterpret_cast<uintptr_t>(dst), kAlignment) -
+                reinterpret_cast<uintptr_t>(dst);
+  memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  size -= head;
+  for (; size >= kBlockSize; size -= kBlockSize) {
+    const __m128i* s = reinterpret_cast<const __m128i*>(src);
+    __m128i* d = reinterpret_cast<__m128i*>(dst);
+    __m128i v0 = _mm_loadu_si128(s);
+    __m128i v1 = _mm_loadu_si128(s + 1);
+    __m128i v2 = _mm_loadu_si128(s + 2);
+    __m128i v3 = _mm_loadu_si128(s + 3);
+    _mm_stream_si128(d, v0);
+    _mm_stream_si128(d + 1, v1);
+    _mm_stream_si128(d + 2, v2);
+    _mm_stream_si128(d + 3, v3);
+    src += kBlockSize;
+    dst += kBlockSize;
+  }
+  // Non-temporal stores are weakly ordered; make them visible before any
+  // following store.
+  _mm_sfence();
+  memcpy(dst, src, size);
+}
+
+#if V8_NON_TEMPORAL_MEMCOPY_AVX2
+TARGET_AVX2 void MemCopyNonTemporalAVX2(uint8_t* dst, const uint8_t* src,
+                                        size_t size) {
+  constexpr size_t kAlignment = sizeof(__m256i);
+  constexpr size_t kBlockSize = 4 * sizeof(__m256i);
+  size_t head = RoundUp(reinterpret_cast<uintptr_t>(dst), kAlignment) -
+                reinterpret_cast<uintptr_t>(dst);
+  memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  size -= head;
+  for (; size >= kBlockSize; size -= kBlockSize) {
+    const __m256i* s = reinterpret_cast<const __m256i*>(src);
+    __m256i* d = reinterpret_cast<__m256i*>(dst);
+    __m256i v0 = _mm256_loadu_si256(s);
+    __m256i v1 = _mm256_loadu_si256(s + 1);
+    __m256i v2 = _mm256_loadu_si256(s + 2);
+    __m256i v3 = _mm256_loadu_si256(s + 3);
+    _mm256_stream_si256(d, v0);
+    _mm256_stream_si256(d + 1, v1);
+    _mm256_stream_si256(d + 2, v2);
+    _mm256_stream_si256(d + 3, v3);
+    src += kBlockSize;
+    dst += kBlockSize;
+  }
+  _mm_sfence();
+  memcpy(dst, src, size);
+}
+#undef TARGET_AVX2
+#endif  // V8_NON_TEMPORAL_MEMCOPY_AVX2
+#endif  // V8_NON_TEMPORAL_MEMCOPY
+
+void MemCopyNonTemporalWrapper(uint8_t* dst, const uint8_t* src, size_t size) {
+  MemCopy(dst, src, size);
+}
+
+using MemCopyNonTemporalFunction = void (*)(uint8_t* dst, const uint8_t* src,
+                                            size_t size);
+
+// Until init_memcopy_functions() has run, all copies go through MemCopy.
+size_t non_temporal_memcopy_threshold = std::numeric_limits<size_t>::max();
+MemCopyNonTemporalFunction non_temporal_memcopy_function =
+    &MemCopyNonTemporalWrapper;
+
+void InitNonTemporalMemCopy() {
+  non_temporal_memcopy_threshold = std::numeric_limits<size_t>::max();
+  non_temporal_memcopy_function = &MemCopyNonTemporalWrapper;
+#if V8_NON_TEMPORAL_MEMCOPY
+  if (!v8_flags.non_temporal_memcopy) return;
+  non_temporal_memcopy_function = &MemCopyNonTemporalSSE2;
+#if V8_NON_TEMPORAL_MEMCOPY_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    non_temporal_memcopy_function = &MemCopyNonTemporalAVX2;
+  }
+#endif
+  size_t threshold = v8_flags.non_temporal_memcopy_threshold;
+  if (threshold == 0) {
+    // Copies of this size would evict at least half of the cache anyway.
+    threshold = LastLevelCacheSize() / 2;
+  }
+  non_temporal_memcopy_threshold =
+      std::max(threshold, kMinNonTemporalMemCopySize);
+#endif  // V8_NON_TEMPORAL_MEMCOPY
+}
+
+}  // namespace
+
+DISABLE_CFI_ICALL
+void MemCopyNonTemporal(void* dest, const void* src, size_t size) {
+  if (size < non_temporal_memcopy_threshold) {
+    MemCopy(dest, src, size);
+    return;
+  }
+  (*non_temporal_memcopy_function)(static_cast<uint8_t*>(dest),
+                                   static_cast<const uint8_t*>(src), size);
+}
+
 #if V8_TARGET_ARCH_IA32
 static void MemMoveWrapper(void* dest, const void* src, size_t size) {
   memmove(dest, src, size);
@@ -34,6 +185,7 @@ V8_EXPORT_PRIVATE MemCopyUint8Function memcopy_uint8_function =
 #endif
 
 void init_memcopy_functions() {
+  InitNonTemporalMemCopy();
 #if V8_TARGET_ARCH_IA32
   if (Isolate::CurrentEmbeddedBlobIsBinaryEmbedded()) {
     EmbeddedData d = EmbeddedData::FromBlob();
@@ -221,6 +221,13 @@ V8_EXPORT_PRIVATE inline void MemMove(void* dest, const void* src,
 const size_t kMinComplexMemCopy = 8;
 #endif  // V8_TARGET_ARCH_IA32
 
+// Copies a memory area to a disjoint memory area whose contents are unlikely
+// to be read again soon, e.g. the backing store of a new ArrayBuffer. Copies
+// that are large relative to the last-level cache use non-temporal stores, so
+// that they do not evict the working set; all others use MemCopy.
+V8_EXPORT_PRIVATE void MemCopyNonTemporal(void* dest, const void* src,
+                                          size_t size);
+
 // Copies words from |src| to |dst|. The data spans must not overlap.
 // |src| and |dst| must be TWord-size aligned.
 template <size_t kBlockCopyLimit, typename T>
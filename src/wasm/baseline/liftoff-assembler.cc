@@ -497,6 +497,7 @@ void LiftoffAssembler::MergeFullStackWith(CacheState& target) {
   // TODO(clemensb): Reuse the same ParallelMove object to save some
   // allocations.
   ParallelMove parallel_move{this};
+  parallel_move.AllowCycleBreakingViaUnusedRegisters();
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     parallel_move.Transfer(target.stack_state[i], cache_state_.stack_state[i]);
     DCHECK(!SlotInterference(target.stack_state[i],
@@ -528,6 +529,7 @@ void LiftoffAssembler::MergeStackWith(CacheState& target, uint32_t arity,
   uint32_t stack_base = stack_height - arity;
   uint32_t target_stack_base = target_stack_height - arity;
   ParallelMove parallel_move{this};
+  parallel_move.AllowCycleBreakingViaUnusedRegisters();
   for (uint32_t i = 0; i < target_stack_base; ++i) {
     parallel_move.Transfer(target.stack_state[i], cache_state_.stack_state[i]);
     DCHECK(!SlotInterference(
@@ -54,12 +54,28 @@ void ParallelMove::ExecuteMoves() {
     ExecuteMove(dst);
   }
 
-  // All remaining moves are parts of a cycle. Just spill the first one, then
-  // process all remaining moves in that cycle. Repeat for all cycles.
+  // All remaining moves are parts of a cycle. Move the source of the first
+  // one to an unused register if possible, otherwise spill it. Then process
+  // all remaining moves in that cycle. Repeat for all cycles.
   while (!move_dst_regs_.is_empty()) {
-    // TODO(clemensb): Use an unused register if available.
     LiftoffRegister dst = move_dst_regs_.GetFirstRegSet();
     RegisterMove* move = register_move(dst);
+    if (break_cycles_via_unused_registers_) {
+      if (std::optional<LiftoffRegister> tmp =
+              GetUnusedCycleBreakingRegister(move->src.reg_class())) {
+        LiftoffRegister src = move->src;
+        asm_->Move(*tmp, src, move->kind);
+        // Redirect the move to read from {tmp}. If nothing else reads {src}
+        // now, the move into {src} can execute, which unrolls the cycle up
+        // to {dst}.
+        move->src = *tmp;
+        ++*src_reg_use_count(*tmp);
+        if (--*src_reg_use_count(src) == 0 && move_dst_regs_.has(src)) {
+          ExecuteMove(src);
+        }
+        continue;
+      }
+    }
     last_spill_offset_ += LiftoffAssembler::SlotSizeForType(move->kind);
     LiftoffRegister spill_reg = move->src;
     asm_->Spill(last_spill_offset_, spill_reg, move->kind);
@@ -69,6 +85,21 @@ void ParallelMove::ExecuteMoves() {
   }
 }
 
+std::optional<LiftoffRegister> ParallelMove::GetUnusedCycleBreakingRegister(
+    RegClass rc) {
+  DCHECK(rc == kGpReg || rc == kFpReg);
+  LiftoffRegList candidates = GetCacheRegList(rc)
+                                  .MaskOut(asm_->cache_state()->used_registers)
+                                  .MaskOut(move_dst_regs_)
+                                  .MaskOut(load_dst_regs_);
+  for (LiftoffRegister reg : candidates) {
+    // Sources of pending moves are normally in the cache state, but be
+    // defensive in case the state was already cleared.
+    if (*src_reg_use_count(reg) == 0) return reg;
+  }
+  return {};
+}
+
 void ParallelMove::ExecuteLoads() {
   for (LiftoffRegister dst : load_dst_regs_) {
     RegisterLoad* load = register_load(dst);
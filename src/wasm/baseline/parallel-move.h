@@ -5,6 +5,8 @@
 #ifndef V8_WASM_BASELINE_PARALLEL_MOVE_H_
 #define V8_WASM_BASELINE_PARALLEL_MOVE_H_
 
+#include <optional>
+
 #include "src/wasm/baseline/liftoff-assembler.h"
 #include "src/wasm/baseline/liftoff-register.h"
 #include "src/wasm/wasm-value.h"
@@ -102,6 +104,14 @@ class ParallelMove {
 
   void TransferToStack(int dst_offset, const VarState& src);
 
+  // Allow breaking move cycles via registers which are unused in the current
+  // cache state, instead of spilling and refilling one value. Only valid if
+  // no registers outside of the cache state are live while the moves execute
+  // (e.g. merges on branch paths).
+  void AllowCycleBreakingViaUnusedRegisters() {
+    break_cycles_via_unused_registers_ = true;
+  }
+
   V8_INLINE void LoadIntoRegister(LiftoffRegister dst, const VarState& src) {
     if (src.is_reg()) {
       DCHECK_EQ(dst.reg_class(), src.reg_class());
@@ -250,6 +260,7 @@ class ParallelMove {
   // Cache the last spill offset in case we need to spill for resolving move
   // cycles.
   int last_spill_offset_;
+  bool break_cycles_via_unused_registers_ = false;
 
   RegisterMove* register_move(LiftoffRegister reg) {
     return reinterpret_cast<RegisterMove*>(register_moves_) +
@@ -282,6 +293,10 @@ class ParallelMove {
     ExecuteMove(move->src);
   }
 
+  // Returns a register of class {rc} which is neither used in the cache state
+  // nor involved in any pending move or load, if there is one.
+  std::optional<LiftoffRegister> GetUnusedCycleBreakingRegister(RegClass rc);
+
   V8_NOINLINE V8_PRESERVE_MOST void ExecuteMoves();
 
   V8_NOINLINE V8_PRESERVE_MOST void ExecuteLoads();
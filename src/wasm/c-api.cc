@@ -1832,11 +1832,12 @@ WASM_EXPORT auto Func::call(const vec<Val>& args, vec<Val>& results) const
       function_data->instance_data(), isolate};
   int function_index = function_data->function_index();
   const i::wasm::WasmModule* module = instance_data->module();
-  // Caching {sig} would reduce overhead substantially.
-  const i::wasm::CanonicalSig* sig =
-      i::wasm::GetTypeCanonicalizer()->LookupFunctionSignature(
-          module->canonical_sig_id(
-              module->functions[function_index].sig_index));
+  // Use the signature cached on the function data; looking it up in the type
+  // canonicalizer takes a lock on every call.
+  const i::wasm::CanonicalSig* sig = function_data->sig();
+  DCHECK_EQ(sig, i::wasm::GetTypeCanonicalizer()->LookupFunctionSignature(
+                     module->canonical_sig_id(
+                         module->functions[function_index].sig_index)));
   PrepareFunctionData(isolate, function_data, sig);
   i::DirectHandle<i::Code> wrapper_code(function_data->c_wrapper_code(isolate),
                                         isolate);
@@ -761,6 +761,8 @@
   V(s2s_Branch)                                 \
   V(r2s_BranchIf)                               \
   V(s2s_BranchIf)                               \
+  V(r2s_BranchIfNot)                            \
+  V(s2s_BranchIfNot)                            \
   V(r2s_BranchIfWithParams)                     \
   V(s2s_BranchIfWithParams)                     \
   V(r2s_If)                                     \
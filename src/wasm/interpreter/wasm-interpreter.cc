@@ -2884,6 +2884,35 @@ class Handlers : public HandlersBase {
     NextOp();
   }
 
+  // Superinstruction for i32.eqz + br_if.
+  INSTRUCTION_HANDLER_FUNC r2s_BranchIfNot(const uint8_t* code, uint32_t* sp,
+                                           WasmInterpreterRuntime* wasm_runtime,
+                                           int64_t r0, double fp0) {
+    int64_t cond = r0;
+
+    int32_t if_false_offset = Read<int32_t>(code);
+    if (!cond) {
+      // If condition is false, jump to the target branch.
+      code += (if_false_offset - kCodeOffsetSize);
+    }
+
+    NextOp();
+  }
+
+  INSTRUCTION_HANDLER_FUNC s2s_BranchIfNot(const uint8_t* code, uint32_t* sp,
+                                           WasmInterpreterRuntime* wasm_runtime,
+                                           int64_t r0, double fp0) {
+    int32_t cond = pop<int32_t>(sp, code, wasm_runtime);
+
+    int32_t if_false_offset = Read<int32_t>(code);
+    if (!cond) {
+      // If condition is false, jump to the target branch.
+      code += (if_false_offset - kCodeOffsetSize);
+    }
+
+    NextOp();
+  }
+
   INSTRUCTION_HANDLER_FUNC r2s_BranchIfWithParams(
       const uint8_t* code, uint32_t* sp, WasmInterpreterRuntime* wasm_runtime,
       int64_t r0, double fp0) {
@@ -12894,6 +12923,23 @@ bool WasmBytecodeGenerator::DoEncodeSuperInstruction(
       default:
         return false;
     }
+  } else if (curr_instr.orig == kExprI32Eqz &&
+             next_instr.orig == kExprBrIf) {
+    // Negated loop exit conditions are very common; branch on the inverted
+    // condition instead of materializing the result of i32.eqz.
+    int32_t target_branch_index = GetTargetBranch(next_instr.optional.depth);
+    if (!HasVoidSignature(blocks_[target_branch_index])) return false;
+    if (reg_mode == RegMode::kI32Reg) {
+      EMIT_INSTR_HANDLER(r2s_BranchIfNot);
+    } else {
+      DCHECK_EQ(reg_mode, RegMode::kNoReg);
+      EMIT_INSTR_HANDLER(s2s_BranchIfNot);
+      I32Pop();  // condition
+    }
+    // Emit code offset to branch to if the condition is false.
+    EmitBranchOffset(next_instr.optional.depth);
+    reg_mode = RegMode::kNoReg;
+    return true;
   } else if (curr_instr.orig == kExprLocalGet &&
              next_instr.orig >= kExprI32StoreMem &&
              next_instr.orig <= kExprI64StoreMem32) {
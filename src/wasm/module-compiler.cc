@@ -23,6 +23,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/compilation-environment-inl.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/jump-table-assembler.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/pgo.h"
@@ -632,6 +633,10 @@ class CompilationStateImpl {
   void CommitCompilationUnits(base::Vector<WasmCompilationUnit> baseline_units,
                               base::Vector<WasmCompilationUnit> top_tier_units);
   void CommitTopTierCompilationUnit(WasmCompilationUnit);
+  // Commits baseline units for lazy functions which are called directly by a
+  // function that just got compiled lazily. Units for functions that were
+  // committed this way before are dropped.
+  void CommitLazyCalleeUnits(std::vector<WasmCompilationUnit> units);
   void AddTopTierPriorityCompilationUnit(WasmCompilationUnit, size_t);
 
   CompilationUnitQueues::Queue* GetQueueForCompileTask(int task_id);
@@ -734,6 +739,10 @@ class CompilationStateImpl {
                                   int function_index,
                                   uint8_t function_progress);
 
+  // Whether a compilation hint asks for eager top-tier compilation of
+  // {func_index}.
+  bool IsHintedHotFunction(int func_index) const;
+
   // Trigger callbacks according to the internal counters below
   // (outstanding_...).
   // Hold the {callbacks_mutex_} when calling this method.
@@ -832,6 +841,7 @@ class CompilationStateImpl {
   using RequiredBaselineTierField = base::BitField8<ExecutionTier, 0, 2>;
   using RequiredTopTierField = base::BitField8<ExecutionTier, 2, 2>;
   using ReachedTierField = base::BitField8<ExecutionTier, 4, 2>;
+  using LazyCalleeCommittedField = base::BitField8<bool, 6, 1>;
 };
 
 CompilationStateImpl* Impl(CompilationState* compilation_state) {
@@ -1117,16 +1127,29 @@ class CompilationUnitBuilder {
     tiering_units_.emplace_back(func_index, tier, kNotForDebugging);
   }
 
+  // Top-tier units for functions that a compilation hint marks as hot. They
+  // are queued as priority units, so top-tier tasks pick them up before any
+  // other initial top-tier unit.
+  void AddHintedTopTierUnit(int func_index, ExecutionTier tier) {
+    hinted_tiering_units_.emplace_back(func_index, tier, kNotForDebugging);
+  }
+
   void Commit() {
-    if (baseline_units_.empty() && tiering_units_.empty()) return;
-    compilation_state()->CommitCompilationUnits(base::VectorOf(baseline_units_),
-                                                base::VectorOf(tiering_units_));
+    if (!baseline_units_.empty() || !tiering_units_.empty()) {
+      compilation_state()->CommitCompilationUnits(
+          base::VectorOf(baseline_units_), base::VectorOf(tiering_units_));
+    }
+    for (WasmCompilationUnit unit : hinted_tiering_units_) {
+      compilation_state()->AddTopTierPriorityCompilationUnit(
+          unit, kHintedTopTierPriority);
+    }
     Clear();
   }
 
   void Clear() {
     baseline_units_.clear();
     tiering_units_.clear();
+    hinted_tiering_units_.clear();
   }
 
   const WasmModule* module() { return native_module_->module(); }
@@ -1136,9 +1159,14 @@ class CompilationUnitBuilder {
     return Impl(native_module_->compilation_state());
   }
 
+  // The lowest priority of dynamic tier-up requests (see {TriggerTierUp}), so
+  // functions which turn out to be hot at runtime are not delayed by hints.
+  static constexpr size_t kHintedTopTierPriority = 1;
+
   NativeModule* const native_module_;
   std::vector<WasmCompilationUnit> baseline_units_;
   std::vector<WasmCompilationUnit> tiering_units_;
+  std::vector<WasmCompilationUnit> hinted_tiering_units_;
 };
 
 DecodeResult ValidateSingleFunction(Zone* zone, const WasmModule* module,
@@ -1189,6 +1217,49 @@ class CompileLazyTimingScope {
   base::ElapsedTimer timer_;
 };
 
+// Compiles the lazy functions that {func_index} calls directly in the
+// background, so that the first calls to them do not each stall on lazy
+// compilation once {func_index} starts executing.
+void CompileDirectCalleesInBackground(NativeModule* native_module,
+                                      int func_index) {
+  const WasmModule* module = native_module->module();
+  CompilationStateImpl* compilation_state =
+      Impl(native_module->compilation_state());
+  const bool lazy_module = IsLazyModule(module);
+  std::shared_ptr<WireBytesStorage> wire_bytes_storage =
+      compilation_state->GetWireBytesStorage();
+  base::Vector<const uint8_t> code =
+      wire_bytes_storage->GetCode(module->functions[func_index].code);
+
+  std::vector<WasmCompilationUnit> units;
+  for (BytecodeIterator it(code.begin(), code.end()); it.has_next();
+       it.next()) {
+    WasmOpcode opcode = it.current();
+    if (opcode != kExprCallFunction && opcode != kExprReturnCall) continue;
+    uint32_t callee =
+        it.read_u32v<Decoder::NoValidationTag>(it.pc() + 1).first;
+    if (callee < module->num_imported_functions) continue;
+    // Compiling an unvalidated function could report a validation error
+    // before the function is called.
+    if (v8_flags.wasm_lazy_validation &&
+        !module->function_was_validated(callee)) {
+      continue;
+    }
+    if (GetCompileStrategy(module, native_module->enabled_features(), callee,
+                           lazy_module) != CompileStrategy::kLazy) {
+      continue;
+    }
+    if (native_module->HasCode(callee)) continue;
+    ExecutionTierPair tiers =
+        GetLazyCompilationTiers(native_module, callee, kNotDebugging);
+    units.emplace_back(callee, tiers.baseline_tier, kNotForDebugging);
+  }
+  if (units.empty()) return;
+  TRACE_LAZY("Compiling %zu callees of wasm-function#%d in the background.\n",
+             units.size(), func_index);
+  compilation_state->CommitLazyCalleeUnits(std::move(units));
+}
+
 }  // namespace
 
 bool CompileLazy(Isolate* isolate,
@@ -1258,6 +1329,9 @@ bool CompileLazy(Isolate* isolate,
                                      kNotForDebugging};
     compilation_state->CommitTopTierCompilationUnit(tiering_unit);
   }
+  if (v8_flags.wasm_lazy_compile_callees && !is_in_debug_state) {
+    CompileDirectCalleesInBackground(native_module, func_index);
+  }
   return true;
 }
 
@@ -3843,8 +3917,25 @@ void CompilationStateImpl::AddCompilationUnitInternal(
   }
   if (reached_tier < required_top_tier &&
       required_baseline_tier != required_top_tier) {
-    builder->AddTopTierUnit(function_index, required_top_tier);
+    if (IsHintedHotFunction(function_index)) {
+      builder->AddHintedTopTierUnit(function_index, required_top_tier);
+    } else {
+      builder->AddTopTierUnit(function_index, required_top_tier);
+    }
+  }
+}
+
+bool CompilationStateImpl::IsHintedHotFunction(int func_index) const {
+  if (!native_module_->enabled_features().has_compilation_hints()) {
+    return false;
   }
+  const WasmCompilationHint* hint =
+      GetCompilationHint(native_module_->module(), func_index);
+  return hint != nullptr &&
+         hint->top_tier == WasmCompilationHintTier::kOptimized &&
+         (hint->strategy == WasmCompilationHintStrategy::kEager ||
+          hint->strategy ==
+              WasmCompilationHintStrategy::kLazyBaselineEagerTopTier);
 }
 
 void CompilationStateImpl::InitializeCompilationUnits(
@@ -3992,6 +4083,24 @@ void CompilationStateImpl::CommitTopTierCompilationUnit(
   CommitCompilationUnits({}, {&unit, 1});
 }
 
+void CompilationStateImpl::CommitLazyCalleeUnits(
+    std::vector<WasmCompilationUnit> units) {
+  {
+    base::SpinningMutexGuard guard(&callbacks_mutex_);
+    std::erase_if(units, [this](const WasmCompilationUnit& unit) {
+      int slot_index =
+          declared_function_index(native_module_->module(), unit.func_index());
+      uint8_t& function_progress = compilation_progress_[slot_index];
+      if (LazyCalleeCommittedField::decode(function_progress)) return true;
+      function_progress =
+          LazyCalleeCommittedField::update(function_progress, true);
+      return false;
+    });
+  }
+  if (units.empty()) return;
+  CommitCompilationUnits(base::VectorOf(units), {});
+}
+
 void CompilationStateImpl::AddTopTierPriorityCompilationUnit(
     WasmCompilationUnit unit, size_t priority) {
   compilation_unit_queues_.AddTopTierPriorityUnit(unit, priority);
@@ -512,15 +512,13 @@ class ValidateFunctionsTask : public JobTask {
  public:
   explicit ValidateFunctionsTask(
       base::Vector<const uint8_t> wire_bytes, const WasmModule* module,
-      WasmEnabledFeatures enabled_features, std::function<bool(int)> filter,
+      WasmEnabledFeatures enabled_features, std::vector<int> functions,
       WasmError* error_out,
       std::atomic<WasmDetectedFeatures>* detected_features)
       : wire_bytes_(wire_bytes),
         module_(module),
         enabled_features_(enabled_features),
-        filter_(std::move(filter)),
-        next_function_(module->num_imported_functions),
-        after_last_function_(next_function_ + module->num_declared_functions),
+        functions_(std::move(functions)),
         error_out_(error_out),
         detected_features_(detected_features) {
     DCHECK(!error_out->has_error());
@@ -533,39 +531,36 @@ class ValidateFunctionsTask : public JobTask {
     WasmDetectedFeatures detected_features;
     Zone zone(GetWasmEngine()->allocator(), ZONE_NAME);
     do {
-      // Get the index of the next function to validate.
-      // {fetch_add} might overrun {after_last_function_} by a bit. Since the
-      // number of functions is limited to a value much smaller than the
-      // integer range, this is near impossible to happen.
-      static_assert(kV8MaxWasmTotalFunctions < kMaxInt / 2);
-      int func_index;
-      do {
-        func_index = next_function_.fetch_add(1, std::memory_order_relaxed);
-        if (V8_UNLIKELY(func_index >= after_last_function_)) {
-          UpdateDetectedFeatures(detected_features);
-          return;
-        }
-        DCHECK_LE(0, func_index);
-      } while ((filter_ && !filter_(func_index)) ||
-               module_->function_was_validated(func_index));
-
-      zone.Reset();
-      if (!ValidateFunction(func_index, &zone, &detected_features)) {
-        // No need to validate any more functions.
-        next_function_.store(after_last_function_, std::memory_order_relaxed);
+      // Get the next function to validate. {fetch_add} might overrun the end
+      // of {functions_} by a bit, which is harmless.
+      size_t next = next_function_.fetch_add(1, std::memory_order_relaxed);
+      if (V8_UNLIKELY(next >= functions_.size())) {
+        UpdateDetectedFeatures(detected_features);
         return;
       }
+      int func_index = functions_[next];
+      // Functions are not validated in index order. To still report the
+      // first error deterministically, keep validating all functions before
+      // the first invalid one found so far, and skip all after it.
+      if (func_index >
+          first_invalid_function_.load(std::memory_order_relaxed)) {
+        continue;
+      }
+      if (module_->function_was_validated(func_index)) continue;
+
+      zone.Reset();
+      ValidateFunction(func_index, &zone, &detected_features);
     } while (!delegate->ShouldYield());
     UpdateDetectedFeatures(detected_features);
   }
 
   size_t GetMaxConcurrency(size_t /* worker_count */) const override {
-    int next_func = next_function_.load(std::memory_order_relaxed);
-    return std::max(0, after_last_function_ - next_func);
+    size_t next = next_function_.load(std::memory_order_relaxed);
+    return functions_.size() - std::min(next, functions_.size());
   }
 
  private:
-  bool ValidateFunction(int func_index, Zone* zone,
+  void ValidateFunction(int func_index, Zone* zone,
                         WasmDetectedFeatures* detected_features) {
     const WasmFunction& function = module_->functions[func_index];
     DCHECK_LT(0, function.code.offset());
@@ -578,16 +573,18 @@ class ValidateFunctionsTask : public JobTask {
         zone, enabled_features_, module_, detected_features, body);
     if (V8_UNLIKELY(validation_result.failed())) {
       SetError(func_index, std::move(validation_result).error());
-      return false;
+      return;
     }
     module_->set_function_validated(func_index);
-    return true;
   }
 
   // Set the error from the argument if it's earlier than the error we already
   // have (or if we have none yet). Thread-safe.
   void SetError(int func_index, WasmError error) {
     base::SpinningMutexGuard mutex_guard{&set_error_mutex_};
+    if (func_index < first_invalid_function_.load(std::memory_order_relaxed)) {
+      first_invalid_function_.store(func_index, std::memory_order_relaxed);
+    }
     if (error_out_->has_error() && error_out_->offset() <= error.offset()) {
       return;
     }
@@ -607,9 +604,10 @@ class ValidateFunctionsTask : public JobTask {
   const base::Vector<const uint8_t> wire_bytes_;
   const WasmModule* const module_;
   const WasmEnabledFeatures enabled_features_;
-  const std::function<bool(int)> filter_;
-  std::atomic<int> next_function_;
-  const int after_last_function_;
+  // The function indexes to validate, largest bodies first.
+  const std::vector<int> functions_;
+  std::atomic<size_t> next_function_{0};
+  std::atomic<int> first_invalid_function_{kMaxInt};
   base::SpinningMutex set_error_mutex_;
   WasmError* const error_out_;
   std::atomic<WasmDetectedFeatures>* const detected_features_;
@@ -635,23 +633,45 @@ WasmError ValidateFunctions(const WasmModule* module,
     uint8_t GetTaskId() override { UNIMPLEMENTED(); }
   };
 
+  // Collect the functions to validate. Starting with the largest bodies keeps
+  // a single big function from being validated alone at the end.
+  std::vector<int> functions;
+  size_t total_body_size = 0;
+  int first_function = module->num_imported_functions;
+  int after_last_function = first_function + module->num_declared_functions;
+  for (int func_index = first_function; func_index < after_last_function;
+       ++func_index) {
+    if (filter && !filter(func_index)) continue;
+    if (module->function_was_validated(func_index)) continue;
+    functions.push_back(func_index);
+    total_body_size += module->functions[func_index].code.length();
+  }
+  if (functions.empty()) return {};
+  std::stable_sort(functions.begin(), functions.end(), [module](int a, int b) {
+    return module->functions[a].code.length() >
+           module->functions[b].code.length();
+  });
+
   // Create a {ValidateFunctionsTask} to validate all functions. The earliest
   // error found will be set on this decoder.
   WasmError validation_error;
   std::atomic<WasmDetectedFeatures> detected_features;
   std::unique_ptr<JobTask> validate_job =
       std::make_unique<ValidateFunctionsTask>(
-          wire_bytes, module, enabled_features, std::move(filter),
+          wire_bytes, module, enabled_features, std::move(functions),
           &validation_error, &detected_features);
 
-  if (v8_flags.single_threaded) {
-    // In single-threaded mode, run the {ValidateFunctionsTask} synchronously.
+  // Posting a job only pays off if there is enough code to share.
+  static constexpr size_t kMinBodySizeForParallelValidation = 64 * KB;
+  if (v8_flags.single_threaded ||
+      total_body_size < kMinBodySizeForParallelValidation) {
+    // Run the {ValidateFunctionsTask} synchronously.
     NeverYieldDelegate delegate;
     validate_job->Run(&delegate);
   } else {
     // Spawn the task and join it.
     std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->CreateJob(
-        TaskPriority::kUserVisible, std::move(validate_job));
+        TaskPriority::kUserBlocking, std::move(validate_job));
     job_handle->Join();
   }
 
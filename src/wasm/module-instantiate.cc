@@ -172,8 +172,9 @@ bool CompareWithNormalizedCType(const CTypeInfo& info,
   if (t.semantic() == MachineSemantic::kBool) {
     return expected == kCanonicalI32;
   }
-  if (info.GetType() == CTypeInfo::Type::kSeqOneByteString) {
-    // WebAssembly does not support one byte strings in fast API calls as
+  if (info.GetType() == CTypeInfo::Type::kSeqOneByteString ||
+      info.GetType() == CTypeInfo::Type::kSeqTwoByteString) {
+    // WebAssembly does not support sequential strings in fast API calls as
     // runtime type checks are not supported so far.
     return false;
   }
@@ -1878,23 +1879,10 @@ bool InstanceBuilder::ProcessImportedFunction(
       WasmCode* wasm_code =
           cache->MaybeGet(kind, sig_index, expected_arity, kNoSuspend);
       if (wasm_code == nullptr) {
-        {
-          WasmImportWrapperCache::ModificationScope cache_scope(cache);
-          WasmCompilationResult result =
-              compiler::CompileWasmCapiCallWrapper(expected_sig);
-          WasmImportWrapperCache::CacheKey key(kind, sig_index, expected_arity,
-                                               kNoSuspend);
-          wasm_code = cache_scope.AddWrapper(key, std::move(result),
-                                             WasmCode::Kind::kWasmToCapiWrapper,
-                                             expected_sig->signature_hash());
-        }
-        // To avoid lock order inversion, code printing must happen after the
-        // end of the {cache_scope}.
-        wasm_code->MaybePrint();
-        isolate_->counters()->wasm_generated_code_size()->Increment(
-            wasm_code->instructions().length());
-        isolate_->counters()->wasm_reloc_size()->Increment(
-            wasm_code->reloc_info().length());
+        // Compiling outside the cache lock lets other threads keep using
+        // the cache meanwhile.
+        wasm_code = cache->CompileWasmCapiCallWrapper(isolate_, expected_sig,
+                                                      sig_index);
       }
 
       // We reuse the SetCompiledWasmToJs infrastructure because it passes the
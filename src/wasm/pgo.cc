@@ -29,6 +29,12 @@ class ProfileGenerator {
     return base::OwnedCopyOf(buffer);
   }
 
+  base::OwnedVector<uint8_t> GetTypeFeedbackData() {
+    ZoneBuffer buffer{&zone_};
+    SerializeTypeFeedback(buffer);
+    return base::OwnedCopyOf(buffer);
+  }
+
  private:
   void SerializeTypeFeedback(ZoneBuffer& buffer) {
     const std::unordered_map<uint32_t, FunctionTypeFeedback>&
@@ -70,6 +76,7 @@ class ProfileGenerator {
   }
 
   void SerializeTieringInfo(ZoneBuffer& buffer) {
+    DCHECK_NOT_NULL(tiering_budget_array_);
     const std::unordered_map<uint32_t, FunctionTypeFeedback>&
         feedback_for_function = module_->type_feedback.feedback_for_function;
     const uint32_t initial_budget = v8_flags.wasm_tiering_budget;
@@ -194,6 +201,19 @@ std::unique_ptr<ProfileInformation> RestoreProfileData(
   return pgo_info;
 }
 
+base::OwnedVector<uint8_t> SerializeTypeFeedback(const WasmModule* module) {
+  ProfileGenerator profile_generator{module, nullptr};
+  return profile_generator.GetTypeFeedbackData();
+}
+
+void RestoreTypeFeedback(const WasmModule* module,
+                         base::Vector<const uint8_t> type_feedback) {
+  Decoder decoder{type_feedback.begin(), type_feedback.end()};
+  DeserializeTypeFeedback(decoder, module);
+  CHECK(decoder.ok());
+  CHECK_EQ(decoder.pc(), decoder.end());
+}
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array) {
@@ -47,6 +47,15 @@ void DumpProfileToFile(const WasmModule* module,
 V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfileFromFile(
     const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
 
+// Serializes the call target feedback of {module} (the first part of a
+// profile file), e.g. to store it next to a serialized module.
+base::OwnedVector<uint8_t> SerializeTypeFeedback(const WasmModule* module);
+
+// Restores feedback written by {SerializeTypeFeedback}, so later TurboFan
+// compilations make the same inlining decisions as in the previous run.
+void RestoreTypeFeedback(const WasmModule* module,
+                         base::Vector<const uint8_t> type_feedback);
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_PGO_H_
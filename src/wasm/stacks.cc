@@ -125,11 +125,23 @@ void StackMemory::Reset() {
   size_ = active_segment_->size_;
 }
 
-std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
-  while (size_ > kMaxSize) {
-    size_ -= freelist_.back()->allocated_size();
-    freelist_.pop_back();
+size_t StackMemory::ReleaseGrownSegments() {
+  DCHECK(owned_);
+  DCHECK_EQ(active_segment_, first_segment_);
+  size_t released = 0;
+  auto segment = first_segment_->next_segment_;
+  first_segment_->next_segment_ = nullptr;
+  while (segment) {
+    auto next_segment = segment->next_segment_;
+    released += segment->size_;
+    delete segment;
+    segment = next_segment;
   }
+  return released;
+}
+
+std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
+  if (size_ > kMaxSize) Trim();
   std::unique_ptr<StackMemory> stack;
   if (freelist_.empty()) {
     stack = StackMemory::New();
@@ -154,6 +166,22 @@ void StackPool::Add(std::unique_ptr<StackMemory> stack) {
   freelist_.push_back(std::move(stack));
 }
 
+void StackPool::Trim() {
+  // Most suspensions never grow their stack, so a pooled stack is just as
+  // useful without its grown segments.
+  for (auto& stack : freelist_) {
+    if (size_ <= kMaxSize) return;
+    size_ -= stack->ReleaseGrownSegments();
+  }
+  // The most recently added stacks are reused first, so free the oldest ones.
+  size_t count = 0;
+  while (size_ > kMaxSize) {
+    DCHECK_LT(count, freelist_.size());
+    size_ -= freelist_[count++]->allocated_size();
+  }
+  freelist_.erase(freelist_.begin(), freelist_.begin() + count);
+}
+
 void StackPool::ReleaseFinishedStacks() {
   size_ = 0;
   freelist_.clear();
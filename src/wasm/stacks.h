@@ -112,6 +112,9 @@ class StackMemory {
   bool Grow(Address current_fp);
   Address Shrink();
   void Reset();
+  // Frees all segments that were added by {Grow}, and returns the number of
+  // bytes released. Only valid after {Reset}.
+  size_t ReleaseGrownSegments();
 
   class StackSegment {
    public:
@@ -203,6 +206,11 @@ class StackPool {
   size_t Size() const;
 
  private:
+  // Brings {size_} back under {kMaxSize}, first by releasing the grown
+  // segments of pooled stacks, then by freeing the least recently added
+  // stacks.
+  void Trim();
+
   std::vector<std::unique_ptr<StackMemory>> freelist_;
   size_t size_ = 0;
   // If the next finished stack would move the total size above this limit, the
@@ -2694,7 +2694,8 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
       if (__ generating_unreachable_operations()) return;
 
       if (should_inline(decoder, feedback_slot_,
-                        std::numeric_limits<int>::max())) {
+                        std::numeric_limits<int>::max()) ||
+          is_monomorphic_call_indirect(feedback_slot_)) {
         V<WordPtr> index_wordptr = TableAddressToUintPtrOrOOBTrap(
             imm.table_imm.table->address_type, index.op);
 
@@ -2705,7 +2706,7 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         V<WasmTrustedInstanceData> instance = trusted_instance_data(kNotShared);
 
         // We are only interested in the target here for comparison against
-        // the inlined call target below.
+        // the inlined (or speculatively called) target below.
         // In particular, we don't need a dynamic type or null check: If the
         // actual call target (at runtime) is equal to the inlined call target,
         // we know already from the static check on the inlinee (see below) that
@@ -2764,9 +2765,47 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
                    kUnlikelyCrossInstanceCall},
                   case_blocks[0], no_inline_block);
 
+        const bool is_monomorphic =
+            is_monomorphic_call_indirect(feedback_slot_);
         for (size_t i = 0; i < feedback_cases.size(); i++) {
           __ Bind(case_blocks[i]);
           InliningTree* tree = feedback_cases[i];
+          if (tree && !tree->is_inlined() && is_monomorphic &&
+              InlineTargetIsTypeCompatible(
+                  decoder->module_, imm.sig,
+                  decoder->module_->functions[tree->function_index()].sig)) {
+            // Call the single known target directly if it is still the one in
+            // the table. As for inlined targets, its signature was checked
+            // statically.
+            uint32_t callee_index = tree->function_index();
+            V<Word32> callee_target =
+                __ RelocatableWasmIndirectCallTarget(callee_index);
+            TSBlock* call_block = __ NewBlock();
+            __ Branch(
+                {__ Word32Equal(target, callee_target), BranchHint::kTrue},
+                call_block, case_blocks[i + 1]);
+            __ Bind(call_block);
+            if (v8_flags.trace_wasm_inlining) {
+              PrintF(
+                  "[function %d%s: Speculatively calling call_indirect #%d "
+                  "target function %d without a signature check]\n",
+                  func_index_, mode_ == kRegular ? "" : " (inlined)",
+                  feedback_slot_, callee_index);
+            }
+            SmallZoneVector<Value, 4> speculative_returns(return_count,
+                                                          decoder->zone_);
+            BuildWasmCall(decoder, imm.sig, callee_target, instance, args,
+                          speculative_returns.data(),
+                          compiler::kWasmIndirectFunction);
+            for (size_t ret = 0; ret < speculative_returns.size(); ret++) {
+              case_returns[ret].push_back(speculative_returns[ret].op);
+            }
+            __ Goto(merge);
+            // As for other targets that are not inlined, a deopt slowpath
+            // could lead to a deopt loop.
+            use_deopt_slowpath = false;
+            continue;
+          }
           if (!tree || !tree->is_inlined()) {
             // Fall through to the next case.
             __ Goto(case_blocks[i + 1]);
@@ -4191,6 +4230,31 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         dst_memory->is_memory64() && src_memory->is_memory64()
             ? AddressType::kI64
             : AddressType::kI32;
+    if (std::optional<uintptr_t> inline_size = InlineBulkMemorySize(size.op)) {
+      BoundsCheckMemRange(dst_memory, dst_uintptr, *inline_size);
+      BoundsCheckMemRange(src_memory, src_uintptr, *inline_size);
+      base::SmallVector<MemoryRepresentation, 16> chunks =
+          BulkMemoryChunks(*inline_size);
+      // Load everything before storing anything, so that overlapping ranges
+      // behave like {memmove}.
+      base::SmallVector<OpIndex, 16> values;
+      V<WordPtr> src_start = MemStart(src_memory->index);
+      int32_t offset = 0;
+      for (MemoryRepresentation repr : chunks) {
+        values.push_back(__ Load(src_start, src_uintptr,
+                                 BulkMemoryAccessKind(repr), repr, offset));
+        offset += repr.SizeInBytes();
+      }
+      V<WordPtr> dst_start = MemStart(dst_memory->index);
+      offset = 0;
+      for (size_t i = 0; i < chunks.size(); ++i) {
+        __ Store(dst_start, dst_uintptr, values[i],
+                 BulkMemoryAccessKind(chunks[i]), chunks[i],
+                 compiler::kNoWriteBarrier, offset);
+        offset += chunks[i].SizeInBytes();
+      }
+      return;
+    }
     V<WordPtr> size_uintptr =
         MemoryAddressToUintPtrOrOOBTrap(min_address_type, size.op);
     auto sig = FixedSizeSignature<MachineType>::Returns(MachineType::Int32())
@@ -4212,6 +4276,42 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     AddressType address_type = imm.memory->address_type;
     V<WordPtr> dst_uintptr =
         MemoryAddressToUintPtrOrOOBTrap(address_type, dst.op);
+    if (std::optional<uintptr_t> inline_size = InlineBulkMemorySize(size.op)) {
+      BoundsCheckMemRange(imm.memory, dst_uintptr, *inline_size);
+      V<Word32> byte = __ Word32BitwiseAnd(value.op, 0xFF);
+      // Replicate the byte for each access width, lazily.
+      V<Word32> pattern32;
+      V<Word64> pattern64;
+      V<Simd128> pattern128;
+      V<WordPtr> dst_start = MemStart(imm.memory->index);
+      int32_t offset = 0;
+      for (MemoryRepresentation repr : BulkMemoryChunks(*inline_size)) {
+        OpIndex pattern;
+        if (repr == MemoryRepresentation::Simd128()) {
+          if (!pattern128.valid()) {
+            pattern128 = __ Simd128Splat(
+                byte, compiler::turboshaft::Simd128SplatOp::Kind::kI8x16);
+          }
+          pattern = pattern128;
+        } else if (repr == MemoryRepresentation::Int64()) {
+          if (!pattern64.valid()) {
+            pattern64 = __ Word64Mul(__ ChangeUint32ToUint64(byte),
+                                     uint64_t{0x0101010101010101});
+          }
+          pattern = pattern64;
+        } else {
+          // Narrower stores only use the low bytes of the 32-bit pattern.
+          if (!pattern32.valid()) {
+            pattern32 = __ Word32Mul(byte, 0x01010101);
+          }
+          pattern = pattern32;
+        }
+        __ Store(dst_start, dst_uintptr, pattern, BulkMemoryAccessKind(repr),
+                 repr, compiler::kNoWriteBarrier, offset);
+        offset += repr.SizeInBytes();
+      }
+      return;
+    }
     V<WordPtr> size_uintptr =
         MemoryAddressToUintPtrOrOOBTrap(address_type, size.op);
     auto sig = FixedSizeSignature<MachineType>::Returns(MachineType::Int32())
@@ -7064,27 +7164,25 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     DCHECK_LT(end_offset, memory->max_memory_size);
 
     // The index can be invalid if we are generating unreachable operations.
-    if (end_offset <= memory->min_memory_size && index.valid() &&
-        __ output_graph().Get(index).Is<ConstantOp>()) {
-      ConstantOp& constant_index_op =
-          __ output_graph().Get(index).Cast<ConstantOp>();
-      uintptr_t constant_index = memory->is_memory64()
-                                     ? constant_index_op.word64()
-                                     : constant_index_op.word32();
-      if (constant_index < memory->min_memory_size - end_offset) {
-        return {converted_index, compiler::BoundsCheckResult::kInBounds};
-      }
+    std::optional<uint64_t> max_index =
+        index.valid() ? MemoryIndexUpperBound(index) : std::nullopt;
+    if (end_offset <= memory->min_memory_size && max_index.has_value() &&
+        *max_index < memory->min_memory_size - end_offset) {
+      return {converted_index, compiler::BoundsCheckResult::kInBounds};
     }
 
 #if V8_TRAP_HANDLER_SUPPORTED
     if (bounds_checks == kTrapHandler &&
         enforce_bounds_check ==
             compiler::EnforceBoundsCheck::kCanOmitBoundsCheck) {
-      if (memory->is_memory64()) {
-        // Bounds check `index` against `kMaxMemory64Size - end_offset`, such
-        // that at runtime `index + end_offset` will be within
-        // `kMaxMemory64Size`, where the trap handler can handle out-of-bound
-        // accesses.
+      // Bounds check `index` against `kMaxMemory64Size - end_offset`, such
+      // that at runtime `index + end_offset` will be within
+      // `kMaxMemory64Size`, where the trap handler can handle out-of-bound
+      // accesses. This is statically true for indexes that are known to be
+      // small, e.g. zero-extended from 32 bits.
+      if (memory->is_memory64() &&
+          (!max_index.has_value() ||
+           *max_index >= wasm::kMaxMemory64Size - end_offset)) {
         V<Word32> cond = __ Uint64LessThan(
             V<Word64>::Cast(converted_index),
             __ Word64Constant(uint64_t{wasm::kMaxMemory64Size - end_offset}));
@@ -7152,6 +7250,106 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     }
   }
 
+  // Returns an upper bound of the (unsigned) memory index {index}, derived
+  // from the operations computing it, or nullopt if nothing is known.
+  std::optional<uint64_t> MemoryIndexUpperBound(OpIndex index, int depth = 0) {
+    static constexpr int kMaxDepth = 4;
+    const Operation& op = __ output_graph().Get(index);
+    if (const ConstantOp* constant = op.TryCast<ConstantOp>()) {
+      if (constant->kind == ConstantOp::Kind::kWord32 ||
+          constant->kind == ConstantOp::Kind::kWord64) {
+        return constant->integral();
+      }
+      return std::nullopt;
+    }
+    if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+      // i64.extend_i32_u
+      if (change->kind == ChangeOp::Kind::kZeroExtend &&
+          change->from == RegisterRepresentation::Word32()) {
+        return std::numeric_limits<uint32_t>::max();
+      }
+      return std::nullopt;
+    }
+    if (depth >= kMaxDepth) return std::nullopt;
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      if (binop->kind != WordBinopOp::Kind::kBitwiseAnd) return std::nullopt;
+      // The result of an unsigned "and" is at most each of its inputs.
+      std::optional<uint64_t> left =
+          MemoryIndexUpperBound(binop->left(), depth + 1);
+      std::optional<uint64_t> right =
+          MemoryIndexUpperBound(binop->right(), depth + 1);
+      if (!left.has_value()) return right;
+      if (!right.has_value()) return left;
+      return std::min(*left, *right);
+    }
+    if (const ShiftOp* shift = op.TryCast<ShiftOp>()) {
+      if (shift->kind != ShiftOp::Kind::kShiftRightLogical) return std::nullopt;
+      std::optional<uint64_t> amount =
+          MemoryIndexUpperBound(shift->right(), depth + 1);
+      uint64_t bits = shift->rep.bit_width();
+      if (!amount.has_value() || *amount >= bits) return std::nullopt;
+      return shift->rep.MaxUnsignedValue() >> *amount;
+    }
+    return std::nullopt;
+  }
+
+  // memory.copy and memory.fill with a small constant size are inlined as a
+  // few wide loads and stores instead of calling into C.
+  static constexpr uintptr_t kMaxInlineBulkMemorySize = 64;
+
+  std::optional<uintptr_t> InlineBulkMemorySize(OpIndex size) {
+    if (!v8_flags.wasm_inline_bulk_memory) return std::nullopt;
+    const ConstantOp* constant =
+        __ output_graph().Get(size).TryCast<ConstantOp>();
+    if (constant == nullptr || !constant->IsIntegral()) return std::nullopt;
+    if (constant->integral() > kMaxInlineBulkMemorySize) return std::nullopt;
+    return static_cast<uintptr_t>(constant->integral());
+  }
+
+  // Splits {size} bytes into the widest accesses available.
+  base::SmallVector<MemoryRepresentation, 16> BulkMemoryChunks(
+      uintptr_t size) {
+    base::SmallVector<MemoryRepresentation, 16> chunks;
+    auto add = [&](MemoryRepresentation repr) {
+      while (size >= repr.SizeInBytes()) {
+        chunks.push_back(repr);
+        size -= repr.SizeInBytes();
+      }
+    };
+    if (CpuFeatures::SupportsWasmSimd128()) {
+      add(MemoryRepresentation::Simd128());
+    }
+    if (Is64()) add(MemoryRepresentation::Int64());
+    add(MemoryRepresentation::Int32());
+    add(MemoryRepresentation::Int16());
+    add(MemoryRepresentation::Uint8());
+    return chunks;
+  }
+
+  // Traps unless [index, index + size) lies within {memory}. In contrast to
+  // {BoundsCheckMem}, this never relies on the trap handler: bulk memory
+  // operations must not write anything if they trap.
+  void BoundsCheckMemRange(const WasmMemory* memory, V<WordPtr> index,
+                           uintptr_t size) {
+    if (memory->bounds_checks == wasm::kNoBoundsChecks) return;
+    V<WordPtr> memory_size = MemSize(memory->index);
+    if (size > memory->min_memory_size) {
+      __ TrapIfNot(
+          __ UintPtrLessThanOrEqual(__ UintPtrConstant(size), memory_size),
+          TrapId::kTrapMemOutOfBounds);
+    }
+    // This doesn't underflow since {size <= mem_size}.
+    __ TrapIfNot(
+        __ UintPtrLessThanOrEqual(index, __ WordPtrSub(memory_size, size)),
+        TrapId::kTrapMemOutOfBounds);
+  }
+
+  // The accesses of inlined bulk operations are always explicitly checked.
+  LoadOp::Kind BulkMemoryAccessKind(MemoryRepresentation repr) {
+    return GetMemoryAccessKind(
+        repr, compiler::BoundsCheckResult::kDynamicallyChecked);
+  }
+
   LoadOp::Kind GetMemoryAccessKind(
       MemoryRepresentation repr,
       compiler::BoundsCheckResult bounds_check_result) {
@@ -8351,6 +8549,21 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     return false;
   }
 
+  // Whether the indirect call at {feedback_slot} only ever called a single
+  // local function. Then it is worth guarding on that target even if it does
+  // not get inlined, as the target check replaces the signature check, which
+  // is expensive if the target's signature is a strict subtype of the
+  // expected one.
+  bool is_monomorphic_call_indirect(int feedback_slot) {
+    if (shared_ || !v8_flags.liftoff) return false;
+    if (!inlining_decisions_ || !inlining_decisions_->feedback_found()) {
+      return false;
+    }
+    DCHECK_GT(inlining_decisions_->function_calls().size(), feedback_slot);
+    return inlining_decisions_->function_calls()[feedback_slot].size() == 1 &&
+           !inlining_decisions_->has_non_inlineable_targets()[feedback_slot];
+  }
+
   void set_inlining_decisions(InliningTree* inlining_decisions) {
     inlining_decisions_ = inlining_decisions;
   }
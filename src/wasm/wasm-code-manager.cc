@@ -806,6 +806,18 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
   size = RoundUp<kCodeAlignment>(size);
   base::AddressRegion code_space =
       free_code_space_.AllocateInRegion(size, region);
+  if (V8_UNLIKELY(code_space.is_empty()) && region == kUnrestrictedRegion &&
+      v8_flags.wasm_reuse_freed_code_space) {
+    // Fill the holes left by dead code before growing the code space.
+    // {AllocateInFreedCodeSpace} already committed the needed pages.
+    code_space = AllocateInFreedCodeSpace(size);
+    if (!code_space.is_empty()) {
+      TRACE_HEAP("Code alloc (reused) for %p: 0x%" PRIxPTR ",+%zu\n", this,
+                 code_space.begin(), size);
+      return {reinterpret_cast<uint8_t*>(code_space.begin()),
+              code_space.size()};
+    }
+  }
   if (V8_UNLIKELY(code_space.is_empty())) {
     // Only allocations without a specific region are allowed to fail. Otherwise
     // the region must have been allocated big enough to hold all initial
@@ -879,14 +891,49 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
   return {reinterpret_cast<uint8_t*>(code_space.begin()), code_space.size()};
 }
 
+base::AddressRegion WasmCodeAllocator::AllocateInFreedCodeSpace(
+    size_t size) {
+  for (base::AddressRegion freed : freed_code_space_.regions()) {
+    if (freed.size() < size) continue;
+    base::AddressRegion code_space =
+        freed_code_space_.AllocateInRegion(size, freed);
+    DCHECK_EQ(freed.begin(), code_space.begin());
+    DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
+    // {FreeCode} discarded exactly the full pages within {freed}, so commit
+    // those that the new allocation touches. This mirrors the computation of
+    // the discarded range there.
+    const Address commit_page_size = CommitPageSize();
+    Address commit_start =
+        std::max(RoundUp(freed.begin(), commit_page_size),
+                 RoundDown(code_space.begin(), commit_page_size));
+    Address commit_end = std::min(RoundDown(freed.end(), commit_page_size),
+                                  RoundUp(code_space.end(), commit_page_size));
+    if (commit_start < commit_end) {
+      for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
+               {commit_start, commit_end - commit_start}, owned_code_space_)) {
+        GetWasmCodeManager()->Commit(split_range);
+      }
+      committed_code_space_.fetch_add(commit_end - commit_start);
+    }
+    generated_code_size_.fetch_add(code_space.size(),
+                                   std::memory_order_relaxed);
+    reused_code_size_.fetch_add(code_space.size(), std::memory_order_relaxed);
+    return code_space;
+  }
+  return {};
+}
+
 void WasmCodeAllocator::FreeCode(base::Vector<WasmCode* const> codes) {
   // Zap code area and collect freed code regions.
   DisjointAllocationPool freed_regions;
   size_t code_size = 0;
   for (WasmCode* code : codes) {
     code_size += code->instructions().size();
-    freed_regions.Merge(base::AddressRegion{code->instruction_start(),
-                                            code->instructions().size()});
+    // Code was allocated in {kCodeAlignment} steps; include the padding so
+    // that neighboring freed regions merge and can be reused.
+    freed_regions.Merge(base::AddressRegion{
+        code->instruction_start(),
+        RoundUp<kCodeAlignment>(code->instructions().size())});
     ThreadIsolation::UnregisterWasmAllocation(code->instruction_start(),
                                               code->instructions().size());
   }
@@ -499,6 +499,9 @@ class WasmCodeAllocator {
   size_t freed_code_size() const {
     return freed_code_size_.load(std::memory_order_acquire);
   }
+  size_t reused_code_size() const {
+    return reused_code_size_.load(std::memory_order_acquire);
+  }
 
   // Allocate code space. Returns a valid buffer or fails with OOM (crash).
   // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
@@ -523,6 +526,10 @@ class WasmCodeAllocator {
   Counters* counters() const { return async_counters_.get(); }
 
  private:
+  // Allocates from {freed_code_space_} and re-commits the pages that
+  // {FreeCode} discarded. Returns an empty region if nothing fits.
+  base::AddressRegion AllocateInFreedCodeSpace(size_t size);
+
   //////////////////////////////////////////////////////////////////////////////
   // These fields are protected by the mutex in {NativeModule}.
 
@@ -541,6 +548,7 @@ class WasmCodeAllocator {
   std::atomic<size_t> committed_code_space_{0};
   std::atomic<size_t> generated_code_size_{0};
   std::atomic<size_t> freed_code_size_{0};
+  std::atomic<size_t> reused_code_size_{0};
 
   std::shared_ptr<Counters> async_counters_;
 };
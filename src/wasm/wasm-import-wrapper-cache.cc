@@ -24,6 +24,12 @@ WasmCode* WasmImportWrapperCache::ModificationScope::operator[](
   return cache_->entry_map_[key];
 }
 
+WasmCode* WasmImportWrapperCache::ModificationScope::Find(
+    const CacheKey& key) const {
+  auto it = cache_->entry_map_.find(key);
+  return it == cache_->entry_map_.end() ? nullptr : it->second;
+}
+
 // The wrapper cache is shared per-process; but it is initialized on demand, and
 // this action is triggered by some isolate; so we use this isolate for error
 // reporting and running GCs if required.
@@ -160,9 +166,14 @@ WasmCode* WasmImportWrapperCache::CompileWasmImportCallWrapper(
     ModificationScope cache_scope(this);
     CacheKey key(kind, sig_index, expected_arity, suspend);
     // Now that we have the lock (in the form of the cache_scope), check
-    // again whether another thread has just created the wrapper.
-    wasm_code = cache_scope[key];
-    if (wasm_code) return wasm_code;
+    // again whether another thread (possibly of another isolate) has just
+    // created the wrapper. If so, share that one and drop our result, like
+    // {MaybeGet} would have done.
+    wasm_code = cache_scope.Find(key);
+    if (wasm_code) {
+      WasmCodeRefScope::AddRef(wasm_code);
+      return wasm_code;
+    }
 
     wasm_code = cache_scope.AddWrapper(key, std::move(result),
                                        WasmCode::Kind::kWasmToJsWrapper,
@@ -183,6 +194,33 @@ WasmCode* WasmImportWrapperCache::CompileWasmImportCallWrapper(
   return wasm_code;
 }
 
+WasmCode* WasmImportWrapperCache::CompileWasmCapiCallWrapper(
+    Isolate* isolate, const CanonicalSig* sig, CanonicalTypeIndex sig_index) {
+  WasmCompilationResult result = compiler::CompileWasmCapiCallWrapper(sig);
+  WasmCode* wasm_code;
+  {
+    ModificationScope cache_scope(this);
+    CacheKey key(ImportCallKind::kWasmToCapi, sig_index,
+                 static_cast<int>(sig->parameter_count()), kNoSuspend);
+    wasm_code = cache_scope.Find(key);
+    if (wasm_code) {
+      WasmCodeRefScope::AddRef(wasm_code);
+      return wasm_code;
+    }
+    wasm_code = cache_scope.AddWrapper(key, std::move(result),
+                                       WasmCode::Kind::kWasmToCapiWrapper,
+                                       sig->signature_hash());
+  }
+  // To avoid lock order inversion, code printing must happen after the
+  // end of the {cache_scope}.
+  wasm_code->MaybePrint();
+  isolate->counters()->wasm_generated_code_size()->Increment(
+      wasm_code->instructions().length());
+  isolate->counters()->wasm_reloc_size()->Increment(
+      wasm_code->reloc_info().length());
+  return wasm_code;
+}
+
 void WasmImportWrapperCache::LogForIsolate(Isolate* isolate) {
   for (const auto& entry : codes_) {
     entry.second->LogCode(isolate, "", -1);  // No source URL, no ScriptId.
@@ -46,7 +46,8 @@ class WasmImportWrapperCache {
    public:
     size_t operator()(const CacheKey& key) const {
       return base::hash_combine(static_cast<uint8_t>(key.kind),
-                                key.type_index.index, key.expected_arity);
+                                key.type_index.index, key.expected_arity,
+                                static_cast<uint8_t>(key.suspend));
     }
   };
 
@@ -58,6 +59,10 @@ class WasmImportWrapperCache {
 
     V8_EXPORT_PRIVATE WasmCode* operator[](const CacheKey& key);
 
+    // Returns nullptr if the key doesn't exist in the map. Unlike
+    // {operator[]}, this does not insert an empty entry for {key}.
+    WasmCode* Find(const CacheKey& key) const;
+
     WasmCode* AddWrapper(const CacheKey& key, WasmCompilationResult result,
                          WasmCode::Kind kind, uint64_t signature_hash);
 
@@ -95,6 +100,12 @@ class WasmImportWrapperCache {
                                          bool source_positions,
                                          int expected_arity, Suspend suspend);
 
+  // Compiles a Wasm-to-C-API wrapper for {sig}, unless another thread
+  // installed one for the same signature in the meantime.
+  WasmCode* CompileWasmCapiCallWrapper(Isolate* isolate,
+                                       const CanonicalSig* sig,
+                                       CanonicalTypeIndex sig_index);
+
  private:
   std::unique_ptr<WasmCodeAllocator> code_allocator_;
   mutable base::SpinningMutex mutex_;
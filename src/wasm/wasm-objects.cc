@@ -701,23 +701,7 @@ void WasmTableObject::UpdateDispatchTable(
   wasm::WasmCode* wasm_code =
       cache->MaybeGet(kind, sig_index, param_count, wasm::kNoSuspend);
   if (wasm_code == nullptr) {
-    wasm::WasmCompilationResult result =
-        compiler::CompileWasmCapiCallWrapper(sig);
-    {
-      wasm::WasmImportWrapperCache::ModificationScope cache_scope(cache);
-      wasm::WasmImportWrapperCache::CacheKey key(kind, sig_index, param_count,
-                                                 wasm::kNoSuspend);
-      wasm_code = cache_scope.AddWrapper(
-          key, std::move(result), wasm::WasmCode::Kind::kWasmToCapiWrapper,
-          sig->signature_hash());
-    }
-    // To avoid lock order inversion, code printing must happen after the
-    // end of the {cache_scope}.
-    wasm_code->MaybePrint();
-    isolate->counters()->wasm_generated_code_size()->Increment(
-        wasm_code->instructions().length());
-    isolate->counters()->wasm_reloc_size()->Increment(
-        wasm_code->reloc_info().length());
+    wasm_code = cache->CompileWasmCapiCallWrapper(isolate, sig, sig_index);
   }
   Tagged<HeapObject> implicit_arg = func_data->internal()->implicit_arg();
   Address call_target = wasm_code->instruction_start();
@@ -15,6 +15,7 @@
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module.h"
@@ -305,7 +306,8 @@ static_assert(std::is_trivially_destructible_v<ExternalReferenceList>,
 class V8_EXPORT_PRIVATE NativeModuleSerializer {
  public:
   NativeModuleSerializer(const NativeModule*, base::Vector<WasmCode* const>,
-                         base::Vector<WellKnownImport const>);
+                         base::Vector<WellKnownImport const>,
+                         base::Vector<const uint8_t> type_feedback);
   NativeModuleSerializer(const NativeModuleSerializer&) = delete;
   NativeModuleSerializer& operator=(const NativeModuleSerializer&) = delete;
 
@@ -318,12 +320,14 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   void WriteCode(const WasmCode*, Writer*,
                  const NativeModule::CallIndirectTargetMap&);
   void WriteTieringBudget(Writer* writer);
+  void WriteTypeFeedback(Writer* writer);
 
   uint32_t CanonicalSigIdToModuleLocalTypeId(uint32_t canonical_sig_id);
 
   const NativeModule* const native_module_;
   const base::Vector<WasmCode* const> code_table_;
   const base::Vector<WellKnownImport const> import_statuses_;
+  const base::Vector<const uint8_t> type_feedback_;
   // Map back canonical signature IDs to module-local IDs. Initialized lazily.
   std::unordered_map<uint32_t, uint32_t> canonical_sig_ids_to_module_local_ids_;
   bool write_called_ = false;
@@ -333,10 +337,12 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
 
 NativeModuleSerializer::NativeModuleSerializer(
     const NativeModule* module, base::Vector<WasmCode* const> code_table,
-    base::Vector<WellKnownImport const> import_statuses)
+    base::Vector<WellKnownImport const> import_statuses,
+    base::Vector<const uint8_t> type_feedback)
     : native_module_(module),
       code_table_(code_table),
-      import_statuses_(import_statuses) {
+      import_statuses_(import_statuses),
+      type_feedback_(type_feedback) {
   DCHECK_NOT_NULL(native_module_);
   // TODO(mtrofin): persist the export wrappers. Ideally, we'd only persist
   // the unique ones, i.e. the cache.
@@ -372,6 +378,9 @@ size_t NativeModuleSerializer::Measure() const {
   // Tiering budget, wrote in {Write} directly.
   size += native_module_->module()->num_declared_functions * sizeof(uint32_t);
 
+  // Type feedback, from {WriteTypeFeedback}.
+  size += sizeof(uint32_t) + type_feedback_.size();
+
   return size;
 }
 
@@ -568,6 +577,11 @@ void NativeModuleSerializer::WriteTieringBudget(Writer* writer) {
   }
 }
 
+void NativeModuleSerializer::WriteTypeFeedback(Writer* writer) {
+  writer->Write(base::checked_cast<uint32_t>(type_feedback_.size()));
+  writer->WriteVector(type_feedback_);
+}
+
 uint32_t NativeModuleSerializer::CanonicalSigIdToModuleLocalTypeId(
     uint32_t canonical_sig_id) {
   if (canonical_sig_ids_to_module_local_ids_.empty()) {
@@ -620,23 +634,29 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   CHECK_EQ(total_written_code_, total_code_size);
 
   WriteTieringBudget(writer);
+  WriteTypeFeedback(writer);
   return true;
 }
 
 WasmSerializer::WasmSerializer(NativeModule* native_module)
     : native_module_(native_module) {
   std::tie(code_table_, import_statuses_) = native_module->SnapshotCodeTable();
+  if (v8_flags.wasm_serialize_type_feedback) {
+    type_feedback_ = SerializeTypeFeedback(native_module->module());
+  }
 }
 
 size_t WasmSerializer::GetSerializedNativeModuleSize() const {
-  NativeModuleSerializer serializer(native_module_, base::VectorOf(code_table_),
-                                    base::VectorOf(import_statuses_));
+  NativeModuleSerializer serializer(
+      native_module_, base::VectorOf(code_table_),
+      base::VectorOf(import_statuses_), type_feedback_.as_vector());
   return kHeaderSize + serializer.Measure();
 }
 
 bool WasmSerializer::SerializeNativeModule(base::Vector<uint8_t> buffer) const {
-  NativeModuleSerializer serializer(native_module_, base::VectorOf(code_table_),
-                                    base::VectorOf(import_statuses_));
+  NativeModuleSerializer serializer(
+      native_module_, base::VectorOf(code_table_),
+      base::VectorOf(import_statuses_), type_feedback_.as_vector());
   size_t measured_size = kHeaderSize + serializer.Measure();
   if (buffer.size() < measured_size) return false;
 
@@ -715,6 +735,8 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   void ReadHeader(Reader* reader);
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
   void ReadTieringBudget(Reader* reader);
+  bool ReadTypeFeedback(Reader* reader);
+  void CopyAndRelocate(const std::vector<DeserializationUnit>& batch);
   void CopyAndRelocate(const DeserializationUnit& unit);
   void Publish(std::vector<DeserializationUnit> batch);
 
@@ -747,9 +769,7 @@ class DeserializeCodeTask : public JobTask {
 
       auto batch = reloc_queue_->Pop();
       if (batch.empty()) break;
-      for (const auto& unit : batch) {
-        deserializer_->CopyAndRelocate(unit);
-      }
+      deserializer_->CopyAndRelocate(batch);
       publish_queue_.Add(std::move(batch));
       delegate->NotifyConcurrencyIncrease();
     }
@@ -860,6 +880,7 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   job_handle->Join();
 
   ReadTieringBudget(reader);
+  if (!ReadTypeFeedback(reader)) return false;
   return reader->current_size() == 0;
 }
 
@@ -961,12 +982,37 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
   return unit;
 }
 
+void NativeModuleDeserializer::CopyAndRelocate(
+    const std::vector<DeserializationUnit>& batch) {
+  // Units are laid out back to back in the code space, except where a new
+  // code space was started. Register each contiguous run of allocations at
+  // once (like {NativeModule::AddCompiledCode} does) and flush the icache per
+  // run instead of per function.
+  auto it = batch.begin();
+  while (it != batch.end()) {
+    base::Vector<uint8_t> run = it->code->instructions();
+    std::vector<size_t> sizes{run.size()};
+    auto run_end = it + 1;
+    for (; run_end != batch.end(); ++run_end) {
+      base::Vector<uint8_t> instructions = run_end->code->instructions();
+      if (instructions.begin() != run.end()) break;
+      sizes.push_back(instructions.size());
+      run = base::VectorOf(run.begin(), run.size() + instructions.size());
+    }
+    ThreadIsolation::RegisterJitAllocations(
+        reinterpret_cast<Address>(run.begin()), sizes,
+        ThreadIsolation::JitAllocationType::kWasmCode);
+    for (; it != run_end; ++it) CopyAndRelocate(*it);
+    FlushInstructionCache(run.begin(), run.size());
+  }
+}
+
 void NativeModuleDeserializer::CopyAndRelocate(
     const DeserializationUnit& unit) {
-  WritableJitAllocation jit_allocation = ThreadIsolation::RegisterJitAllocation(
+  WritableJitAllocation jit_allocation = ThreadIsolation::LookupJitAllocation(
       reinterpret_cast<Address>(unit.code->instructions().begin()),
       unit.code->instructions().size(),
-      ThreadIsolation::JitAllocationType::kWasmCode, false);
+      ThreadIsolation::JitAllocationType::kWasmCode);
 
   jit_allocation.CopyCode(0, unit.src_code_buffer.begin(),
                           unit.src_code_buffer.size());
@@ -1037,10 +1083,6 @@ void NativeModuleDeserializer::CopyAndRelocate(
         UNREACHABLE();
     }
   }
-
-  // Finally, flush the icache for that code.
-  FlushInstructionCache(unit.code->instructions().begin(),
-                        unit.code->instructions().size());
 }
 
 void NativeModuleDeserializer::ReadTieringBudget(Reader* reader) {
@@ -1056,6 +1098,20 @@ void NativeModuleDeserializer::ReadTieringBudget(Reader* reader) {
          size_of_tiering_budget);
 }
 
+bool NativeModuleDeserializer::ReadTypeFeedback(Reader* reader) {
+  if (reader->current_size() < sizeof(uint32_t)) return false;
+  uint32_t size = reader->Read<uint32_t>();
+  if (size > reader->current_size()) return false;
+  base::Vector<const uint8_t> type_feedback =
+      reader->ReadVector<uint8_t>(size);
+  // The feedback was written with the same flags (see the flag hash in the
+  // header), but only restore it if it is wanted.
+  if (v8_flags.wasm_serialize_type_feedback && !type_feedback.empty()) {
+    RestoreTypeFeedback(native_module_->module(), type_feedback);
+  }
+  return true;
+}
+
 void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
   DCHECK(!batch.empty());
   std::vector<UnpublishedWasmCode> codes;
@@ -50,6 +50,9 @@ class V8_EXPORT_PRIVATE WasmSerializer {
   WasmCodeRefScope code_ref_scope_;
   std::vector<WasmCode*> code_table_;
   std::vector<WellKnownImport> import_statuses_;
+  // Call target feedback, snapshotted together with the code table so that
+  // measuring and writing see the same data.
+  base::OwnedVector<uint8_t> type_feedback_;
 };
 
 // Support for deserializing WebAssembly {NativeModule} objects.
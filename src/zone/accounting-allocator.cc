@@ -9,6 +9,8 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/sanitizer/asan.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -75,39 +77,128 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { TrimSegmentPool(0); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
-  void* memory;
-  if (COMPRESS_ZONES_BOOL && supports_compression) {
-    bytes = RoundUp(bytes, kZonePageSize);
-    memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
-                           kZonePageSize, PageAllocator::kReadWrite);
-
-  } else {
-    auto result = AllocAtLeastWithRetry(bytes);
-    memory = result.ptr;
-    bytes = result.count;
+  Segment* segment = GetSegmentFromPool(bytes, supports_compression);
+  if (segment == nullptr) {
+    void* memory;
+    if (COMPRESS_ZONES_BOOL && supports_compression) {
+      bytes = RoundUp(bytes, kZonePageSize);
+      memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
+                             kZonePageSize, PageAllocator::kReadWrite);
+
+    } else {
+      auto result = AllocAtLeastWithRetry(bytes);
+      memory = result.ptr;
+      bytes = result.count;
+    }
+    if (memory == nullptr) return nullptr;
+    DCHECK_LE(sizeof(Segment), bytes);
+    segment = new (memory) Segment(bytes);
   }
-  if (memory == nullptr) return nullptr;
 
-  size_t current =
-      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  const size_t segment_size = segment->total_size();
+  size_t current = current_memory_usage_.fetch_add(
+                       segment_size, std::memory_order_relaxed) +
+                   segment_size;
   size_t max = max_memory_usage_.load(std::memory_order_relaxed);
   while (current > max && !max_memory_usage_.compare_exchange_weak(
                               max, current, std::memory_order_relaxed)) {
     // {max} was updated by {compare_exchange_weak}; retry.
   }
-  DCHECK_LE(sizeof(Segment), bytes);
-  return new (memory) Segment(bytes);
+  return segment;
 }
 
 void AccountingAllocator::ReturnSegment(Segment* segment,
                                         bool supports_compression) {
   segment->ZapContents();
-  size_t segment_size = segment->total_size();
-  current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
+  current_memory_usage_.fetch_sub(segment->total_size(),
+                                  std::memory_order_relaxed);
+  if (AddSegmentToPool(segment, supports_compression)) return;
+  FreeSegment(segment, supports_compression);
+}
+
+void AccountingAllocator::TrimSegmentPool(size_t max_pool_size) {
+  base::MutexGuard guard(&pool_mutex_);
+  // Release the largest segments first.
+  for (int size_class = kNumberOfSizeClasses - 1; size_class >= 0;
+       --size_class) {
+    for (int pool = 0; pool < 2; ++pool) {
+      Segment** head = &pools_[pool].size_classes[size_class];
+      while (*head != nullptr &&
+             current_pool_size_.load(std::memory_order_relaxed) >
+                 max_pool_size) {
+        Segment* segment = *head;
+        *head = segment->next();
+        current_pool_size_.fetch_sub(segment->total_size(),
+                                     std::memory_order_relaxed);
+        ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<void*>(segment->start()),
+                                    segment->capacity());
+        FreeSegment(segment, pool == 1);
+      }
+    }
+  }
+}
+
+Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size,
+                                                 bool supports_compression) {
+  if (requested_size > (size_t{1} << kMaxSegmentSizePower)) return nullptr;
+  if (current_pool_size_.load(std::memory_order_relaxed) == 0) return nullptr;
+
+  int power = kMinSegmentSizePower;
+  while (requested_size > (size_t{1} << power)) power++;
+
+  base::MutexGuard guard(&pool_mutex_);
+  SegmentPool& pool = pools_[COMPRESS_ZONES_BOOL && supports_compression];
+  Segment** head = &pool.size_classes[power - kMinSegmentSizePower];
+  Segment* segment = *head;
+  if (segment == nullptr) return nullptr;
+  *head = segment->next();
+  current_pool_size_.fetch_sub(segment->total_size(),
+                               std::memory_order_relaxed);
+
+  ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<void*>(segment->start()),
+                              segment->capacity());
+  segment->set_zone(nullptr);
+  segment->set_next(nullptr);
+  DCHECK_GE(segment->total_size(), requested_size);
+  return segment;
+}
+
+bool AccountingAllocator::AddSegmentToPool(Segment* segment,
+                                           bool supports_compression) {
+  const size_t size = segment->total_size();
+  if (size < (size_t{1} << kMinSegmentSizePower) ||
+      size >= (size_t{1} << (kMaxSegmentSizePower + 1))) {
+    return false;
+  }
+
+  int power = kMaxSegmentSizePower;
+  while (size < (size_t{1} << power)) power--;
+
+  base::MutexGuard guard(&pool_mutex_);
+  if (current_pool_size_.load(std::memory_order_relaxed) + size >
+      v8_flags.zone_segment_pool_size) {
+    return false;
+  }
+  SegmentPool& pool = pools_[COMPRESS_ZONES_BOOL && supports_compression];
+  Segment** head = &pool.size_classes[power - kMinSegmentSizePower];
+  segment->set_zone(nullptr);
+  segment->set_next(*head);
+  *head = segment;
+  current_pool_size_.fetch_add(size, std::memory_order_relaxed);
+
+  // Catch uses of zone memory after the zone has been freed.
+  ASAN_POISON_MEMORY_REGION(reinterpret_cast<void*>(segment->start()),
+                            segment->capacity());
+  return true;
+}
+
+void AccountingAllocator::FreeSegment(Segment* segment,
+                                      bool supports_compression) {
+  const size_t segment_size = segment->total_size();
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
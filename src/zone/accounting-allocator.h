@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +47,16 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Returns the size of the segments that are kept for reuse. They are not
+  // included in GetCurrentMemoryUsage().
+  size_t GetCurrentPoolSize() const {
+    return current_pool_size_.load(std::memory_order_relaxed);
+  }
+
+  // Releases pooled segments until at most {max_pool_size} bytes remain in
+  // the pool. May be called from any thread.
+  void TrimSegmentPool(size_t max_pool_size);
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,9 +78,30 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments are pooled in power-of-two size classes from 8 KB to 1 MB. A
+  // segment of class {i} holds at least 2^(kMinSegmentSizePower + i) bytes.
+  static constexpr int kMinSegmentSizePower = 13;
+  static constexpr int kMaxSegmentSizePower = 20;
+  static constexpr int kNumberOfSizeClasses =
+      kMaxSegmentSizePower - kMinSegmentSizePower + 1;
+
+  // Free lists of pooled segments, linked through Segment::next().
+  struct SegmentPool {
+    Segment* size_classes[kNumberOfSizeClasses] = {};
+  };
+
+  Segment* GetSegmentFromPool(size_t requested_size, bool supports_compression);
+  bool AddSegmentToPool(Segment* segment, bool supports_compression);
+  void FreeSegment(Segment* segment, bool supports_compression);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  base::Mutex pool_mutex_;
+  // Indexed by whether the segments support compression.
+  SegmentPool pools_[2];
+  std::atomic<size_t> current_pool_size_{0};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 };
@@ -0,0 +1,113 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdint>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/strings/hex-encoding.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+#include "third_party/simdutf/simdutf.h"
+
+// Kernels behind Uint8Array.prototype.toHex/toBase64 and
+// Uint8Array.fromHex/fromBase64, measured over payload sizes from a short
+// token to a large response body.
+
+namespace {
+
+std::vector<uint8_t> Payload(size_t size) {
+  std::vector<uint8_t> bytes(size);
+  uint32_t state = 0x12345678;
+  for (auto& byte : bytes) {
+    state = state * 1664525 + 1013904223;
+    byte = static_cast<uint8_t>(state >> 24);
+  }
+  return bytes;
+}
+
+// The byte-at-a-time loop that the vector kernels replace.
+void HexEncodeScalar(const uint8_t* input, size_t length, uint8_t* output) {
+  static constexpr char kDigits[] = "0123456789abcdef";
+  for (size_t i = 0; i < length; i++) {
+    output[2 * i] = kDigits[input[i] >> 4];
+    output[2 * i + 1] = kDigits[input[i] & 0x0F];
+  }
+}
+
+void SetBytesProcessed(benchmark::State& st, size_t size) {
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * size));
+}
+
+}  // namespace
+
+static void HexEncodeScalar(benchmark::State& st) {
+  const size_t size = static_cast<size_t>(st.range(0));
+  std::vector<uint8_t> input = Payload(size);
+  std::vector<uint8_t> output(2 * size);
+  for (auto _ : st) {
+    USE(_);
+    HexEncodeScalar(input.data(), size, output.data());
+    benchmark::DoNotOptimize(output.data());
+  }
+  SetBytesProcessed(st, size);
+}
+
+static void HexEncode(benchmark::State& st) {
+  const size_t size = static_cast<size_t>(st.range(0));
+  std::vector<uint8_t> input = Payload(size);
+  std::vector<uint8_t> output(2 * size);
+  for (auto _ : st) {
+    USE(_);
+    v8::internal::HexEncode(input.data(), size, output.data());
+    benchmark::DoNotOptimize(output.data());
+  }
+  SetBytesProcessed(st, size);
+}
+
+static void HexDecode(benchmark::State& st) {
+  const size_t size = static_cast<size_t>(st.range(0));
+  std::vector<uint8_t> bytes = Payload(size);
+  std::vector<uint8_t> hex(2 * size);
+  v8::internal::HexEncode(bytes.data(), size, hex.data());
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        v8::internal::HexDecode(hex.data(), hex.size(), bytes.data()));
+  }
+  SetBytesProcessed(st, size);
+}
+
+static void Base64Encode(benchmark::State& st) {
+  const size_t size = static_cast<size_t>(st.range(0));
+  std::vector<uint8_t> input = Payload(size);
+  std::vector<char> output(simdutf::base64_length_from_binary(size));
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(simdutf::binary_to_base64(
+        reinterpret_cast<const char*>(input.data()), size, output.data()));
+  }
+  SetBytesProcessed(st, size);
+}
+
+static void Base64Decode(benchmark::State& st) {
+  const size_t size = static_cast<size_t>(st.range(0));
+  std::vector<uint8_t> bytes = Payload(size);
+  std::vector<char> base64(simdutf::base64_length_from_binary(size));
+  simdutf::binary_to_base64(reinterpret_cast<const char*>(bytes.data()), size,
+                            base64.data());
+  for (auto _ : st) {
+    USE(_);
+    size_t output_length = size;
+    benchmark::DoNotOptimize(simdutf::base64_to_binary_safe(
+        base64.data(), base64.size(), reinterpret_cast<char*>(bytes.data()),
+        output_length));
+  }
+  SetBytesProcessed(st, size);
+}
+
+BENCHMARK(HexEncodeScalar)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(HexEncode)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(HexDecode)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(Base64Encode)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(Base64Decode)->RangeMultiplier(16)->Range(16, 1 << 20);
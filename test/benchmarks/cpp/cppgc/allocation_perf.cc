@@ -33,6 +33,47 @@ BENCHMARK_F(Allocate, Tiny)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(TinyObject));
 }
 
+template <size_t Size>
+class SizedObject final : public GarbageCollected<SizedObject<Size>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[Size];
+};
+
+// Cycles through objects of all regular size classes.
+BENCHMARK_F(Allocate, MixedSizeClasses)(benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  AllocationHandle& handle = heap().GetAllocationHandle();
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<8>>(handle));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<48>>(handle));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<112>>(handle));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<240>>(handle));
+  }
+  st.SetBytesProcessed(st.iterations() *
+                       (sizeof(SizedObject<8>) + sizeof(SizedObject<48>) +
+                        sizeof(SizedObject<112>) + sizeof(SizedObject<240>)));
+}
+
+// Allocates tiny objects from multiple threads. cppgc heaps are thread-affine,
+// so each thread uses its own heap and only the page backend is shared.
+BENCHMARK_DEFINE_F(Allocate, TinyMultiThreaded)(benchmark::State& st) {
+  std::unique_ptr<cppgc::Heap> thread_heap =
+      cppgc::Heap::Create(GetPlatform());
+  {
+    subtle::NoGarbageCollectionScope no_gc(*Heap::From(thread_heap.get()));
+    AllocationHandle& handle = thread_heap->GetAllocationHandle();
+    for (auto _ : st) {
+      USE(_);
+      benchmark::DoNotOptimize(MakeGarbageCollected<TinyObject>(handle));
+    }
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(TinyObject));
+}
+
+BENCHMARK_REGISTER_F(Allocate, TinyMultiThreaded)->ThreadRange(1, 8);
+
 class LargeObject final : public GarbageCollected<LargeObject> {
  public:
   void Trace(cppgc::Visitor*) const {}
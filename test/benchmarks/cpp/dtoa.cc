@@ -2,14 +2,20 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <vector>
+
 #include "src/base/macros.h"
 #include "src/base/numbers/fast-dtoa.h"
+#include "src/base/numbers/schubfach-dtoa.h"
+#include "src/base/numbers/strtod.h"
 #include "src/base/vector.h"
 #include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
 
 using v8::base::FAST_DTOA_PRECISION;
 using v8::base::FAST_DTOA_SHORTEST;
 using v8::base::kFastDtoaMaximalLength;
+using v8::base::kSchubfachDtoaMaximalLength;
+using v8::base::Strtod;
 using v8::base::Vector;
 
 // This is a dump from a benchmark (MotionMark suits).
@@ -1065,5 +1071,46 @@ static void BM_DtoaSixDigits(benchmark::State& state) {
   }
 }
 
+static void BM_SchubfachDtoaShortest(benchmark::State& state) {
+  char output[kSchubfachDtoaMaximalLength + 10];
+  Vector<char> buffer(output, sizeof(output));
+  int length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    SchubfachDtoa(kTestDoubles[idx++ % 4096], buffer, &length,
+                  &decimal_point);
+    benchmark::DoNotOptimize(length);
+  }
+}
+
+// Parses decimal strings with state.range(0) significant digits, with
+// exponents spread over the range of normal doubles.
+static void BM_Strtod(benchmark::State& state) {
+  constexpr int kInputCount = 4096;
+  const int digits = static_cast<int>(state.range(0));
+  std::vector<char> chars(kInputCount * digits);
+  std::vector<int> exponents(kInputCount);
+  uint32_t seed = 0x64D1C3C9;
+  for (int i = 0; i < kInputCount; i++) {
+    for (int j = 0; j < digits; j++) {
+      seed = seed * 1664525 + 1013904223;
+      // The buffer must not start with '0'.
+      chars[i * digits + j] = static_cast<char>(
+          j == 0 ? '1' + (seed >> 24) % 9 : '0' + (seed >> 24) % 10);
+    }
+    seed = seed * 1664525 + 1013904223;
+    exponents[i] = static_cast<int>((seed >> 16) % 600) - 300 - digits;
+  }
+  unsigned idx = 0;
+  for (auto _ : state) {
+    unsigned i = idx++ % kInputCount;
+    double result = Strtod(Vector<const char>(&chars[i * digits], digits),
+                           exponents[i]);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
 BENCHMARK(BM_DtoaShortest);
+BENCHMARK(BM_SchubfachDtoaShortest);
 BENCHMARK(BM_DtoaSixDigits);
+BENCHMARK(BM_Strtod)->DenseRange(1, 20)->Arg(25)->Arg(40)->Arg(100);
@@ -40,6 +40,12 @@ class FastApiBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
     return str.length;
   }
 
+  static uint32_t FastTwoByteString(v8::Local<v8::Value> receiver,
+                                    const v8::FastTwoByteString& str,
+                                    v8::FastApiCallbackOptions& options) {
+    return str.length;
+  }
+
   static void RegularString(const v8::FunctionCallbackInfo<v8::Value>& info) {
     v8::Local<v8::String> str = info[0].As<v8::String>();
     v8::String::ValueView view(info.GetIsolate(), str);
@@ -80,6 +86,17 @@ class FastApiBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
               v8::Local<v8::Signature>(), 1, v8::ConstructorBehavior::kThrow,
               v8::SideEffectType::kHasSideEffect, &fast_callback));
     }
+    {
+      v8::CFunction fast_callback =
+          v8::CFunction::Make(FastApiBenchmark::FastTwoByteString);
+
+      object_template->Set(
+          isolate, "fastTwoByteString",
+          v8::FunctionTemplate::New(
+              isolate, FastApiBenchmark::RegularString, v8::Local<v8::Value>(),
+              v8::Local<v8::Signature>(), 1, v8::ConstructorBehavior::kThrow,
+              v8::SideEffectType::kHasSideEffect, &fast_callback));
+    }
     {
       v8::CFunction fast_callback =
           v8::CFunction::Make(FastApiBenchmark::FastStringValueView);
@@ -187,6 +204,69 @@ BENCHMARK_F(FastApiBenchmark, FastOneByteString)(benchmark::State& st) {
   }
 }
 
+BENCHMARK_F(FastApiBenchmark, FastTwoByteString)(benchmark::State& st) {
+  const char* kScript =
+      "function invoke() {"
+      "  globalThis.fastTwoByteString('Hello W\\u00f6rld \\u{1F30D}');"
+      "}"
+      "\%PrepareFunctionForOptimization(invoke);"
+      "invoke();"
+      "\%OptimizeFunctionOnNextCall(invoke);"
+      "for (var i =0; i < 1_000_000; i++) invoke();";
+
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Script> script = CompileBenchmarkScript(kScript);
+  v8::HandleScope benchmark_handle_scope(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_F(FastApiBenchmark, FastStringValueViewTwoByte)(benchmark::State& st) {
+  const char* kScript =
+      "function invoke() {"
+      "  globalThis.fastStringValueView('Hello W\\u00f6rld \\u{1F30D}');"
+      "}"
+      "\%PrepareFunctionForOptimization(invoke);"
+      "invoke();"
+      "\%OptimizeFunctionOnNextCall(invoke);"
+      "for (var i =0; i < 1_000_000; i++) invoke();";
+
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Script> script = CompileBenchmarkScript(kScript);
+  v8::HandleScope benchmark_handle_scope(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_F(FastApiBenchmark, RegularStringTwoByte)(benchmark::State& st) {
+  const char* kScript =
+      "function invoke() {"
+      "  globalThis.regularString('Hello W\\u00f6rld \\u{1F30D}');"
+      "}"
+      "\%PrepareFunctionForOptimization(invoke);"
+      "invoke();"
+      "\%OptimizeFunctionOnNextCall(invoke);"
+      "for (var i =0; i < 1_000_000; i++) invoke();";
+
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Script> script = CompileBenchmarkScript(kScript);
+  v8::HandleScope benchmark_handle_scope(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
 BENCHMARK_F(FastApiBenchmark, FastStringValueView)(benchmark::State& st) {
   const char* kScript =
       "function invoke() { globalThis.fastStringValueView('Hello World'); }"
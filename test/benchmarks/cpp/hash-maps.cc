@@ -0,0 +1,223 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "include/v8-isolate.h"
+#include "src/base/hashmap.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/utils/identity-map.h"
+#include "src/utils/utils.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace i = v8::internal;
+
+using ObjectMap = i::IdentityMap<int, v8::base::DefaultAllocationPolicy>;
+
+enum AddressMapKind : int64_t {
+  kTemplateHashMap,
+  kFlatHashMap,
+};
+
+class HashMapBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ protected:
+  i::Isolate* i_isolate() {
+    return reinterpret_cast<i::Isolate*>(v8_isolate());
+  }
+  i::Heap* heap() { return i_isolate()->heap(); }
+
+  void MinorGC() {
+    heap()->CollectGarbage(i::NEW_SPACE, i::GarbageCollectionReason::kTesting);
+  }
+
+  // Allocates `count` distinct old objects to be used as map keys.
+  std::vector<i::Handle<i::FixedArray>> NewKeys(int count) {
+    std::vector<i::Handle<i::FixedArray>> keys;
+    keys.reserve(count);
+    for (int n = 0; n < count; ++n) {
+      keys.push_back(i_isolate()->factory()->NewFixedArray(
+          1, i::AllocationType::kOld));
+    }
+    return keys;
+  }
+
+  void Fill(ObjectMap* map,
+            const std::vector<i::Handle<i::FixedArray>>& keys) {
+    for (size_t n = 0; n < keys.size(); ++n) {
+      map->Insert(*keys[n], static_cast<int>(n));
+    }
+  }
+};
+
+}  // namespace
+
+// Inserting objects into a fresh IdentityMap, including all resizes, as the
+// serializer does for every object it visits.
+BENCHMARK_DEFINE_F(HashMapBenchmark, IdentityMapInsert)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  i::HandleScope scope(i_isolate());
+  auto keys = NewKeys(count);
+  for (auto _ : st) {
+    USE(_);
+    ObjectMap map(heap());
+    Fill(&map, keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(HashMapBenchmark, IdentityMapInsert)
+    ->Arg(1 << 8)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16);
+
+// Looking up objects that are present in the map.
+BENCHMARK_DEFINE_F(HashMapBenchmark, IdentityMapFind)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  i::HandleScope scope(i_isolate());
+  auto keys = NewKeys(count);
+  ObjectMap map(heap());
+  Fill(&map, keys);
+  for (auto _ : st) {
+    USE(_);
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(map.Find(*key));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(HashMapBenchmark, IdentityMapFind)
+    ->Arg(1 << 8)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16);
+
+// Looking up objects that are not in the map. Misses end the probe sequence
+// at the first group with an empty slot.
+BENCHMARK_DEFINE_F(HashMapBenchmark, IdentityMapMiss)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  i::HandleScope scope(i_isolate());
+  auto keys = NewKeys(count);
+  auto absent = NewKeys(count);
+  ObjectMap map(heap());
+  Fill(&map, keys);
+  for (auto _ : st) {
+    USE(_);
+    for (const auto& key : absent) {
+      benchmark::DoNotOptimize(map.Find(*key));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(HashMapBenchmark, IdentityMapMiss)
+    ->Arg(1 << 8)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16);
+
+// Iterating over all entries, as the serializer and the Maglev code generator
+// do once they are done.
+BENCHMARK_DEFINE_F(HashMapBenchmark, IdentityMapIterate)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  i::HandleScope scope(i_isolate());
+  auto keys = NewKeys(count);
+  ObjectMap map(heap());
+  Fill(&map, keys);
+  for (auto _ : st) {
+    USE(_);
+    ObjectMap::IteratableScope it_scope(&map);
+    int sum = 0;
+    for (auto it = it_scope.begin(); it != it_scope.end(); ++it) {
+      sum += **it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(HashMapBenchmark, IdentityMapIterate)
+    ->Arg(1 << 8)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16);
+
+// The first miss after a GC rehashes the whole map.
+BENCHMARK_DEFINE_F(HashMapBenchmark, IdentityMapRehashAfterGC)
+(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  i::HandleScope scope(i_isolate());
+  auto keys = NewKeys(count);
+  i::DirectHandle<i::FixedArray> absent =
+      i_isolate()->factory()->NewFixedArray(1, i::AllocationType::kOld);
+  ObjectMap map(heap());
+  Fill(&map, keys);
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    MinorGC();
+    st.ResumeTiming();
+    benchmark::DoNotOptimize(map.Find(*absent));
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(HashMapBenchmark, IdentityMapRehashAfterGC)
+    ->Arg(1 << 8)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16);
+
+// Address-keyed maps, as used by the heap profiler to track object ids: every
+// address is looked up or inserted, then half of them move.
+BENCHMARK_DEFINE_F(HashMapBenchmark, AddressMap)(benchmark::State& st) {
+  const AddressMapKind kind = static_cast<AddressMapKind>(st.range(0));
+  const int count = static_cast<int>(st.range(1));
+  std::vector<i::Address> addresses;
+  addresses.reserve(count);
+  for (int n = 0; n < count; ++n) {
+    // Objects are at least pointer aligned, so the low bits are always zero.
+    addresses.push_back(0x10000 + static_cast<i::Address>(n) * 48);
+  }
+  const i::Address shift = static_cast<i::Address>(count) * 48;
+  for (auto _ : st) {
+    USE(_);
+    if (kind == kTemplateHashMap) {
+      v8::base::HashMap map;
+      for (size_t n = 0; n < addresses.size(); ++n) {
+        void* key = reinterpret_cast<void*>(addresses[n]);
+        map.LookupOrInsert(key, i::ComputeAddressHash(addresses[n]))->value =
+            reinterpret_cast<void*>(n + 1);
+      }
+      for (size_t n = 0; n < addresses.size(); n += 2) {
+        i::Address to = addresses[n] + shift;
+        void* value = map.Remove(reinterpret_cast<void*>(addresses[n]),
+                                 i::ComputeAddressHash(addresses[n]));
+        map.LookupOrInsert(reinterpret_cast<void*>(to),
+                           i::ComputeAddressHash(to))
+            ->value = value;
+      }
+      benchmark::DoNotOptimize(map.occupancy());
+    } else {
+      absl::flat_hash_map<i::Address, size_t> map;
+      for (size_t n = 0; n < addresses.size(); ++n) {
+        map.try_emplace(addresses[n], n + 1);
+      }
+      for (size_t n = 0; n < addresses.size(); n += 2) {
+        auto it = map.find(addresses[n]);
+        size_t value = it->second;
+        map.erase(it);
+        map.try_emplace(addresses[n] + shift, value);
+      }
+      benchmark::DoNotOptimize(map.size());
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * count * 3 / 2);
+}
+BENCHMARK_REGISTER_F(HashMapBenchmark, AddressMap)
+    ->ArgNames({"kind", "count"})
+    ->ArgsProduct({{kTemplateHashMap, kFlatHashMap},
+                   {1 << 8, 1 << 12, 1 << 16}});
@@ -0,0 +1,322 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "src/base/macros.h"
+#include "src/base/platform/time.h"
+#include "src/common/assert-scope.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/heap/incremental-marking.h"
+#include "src/heap/local-factory.h"
+#include "src/heap/parked-scope-inl.h"
+#include "src/objects/fixed-array-inl.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace i = v8::internal;
+
+// Every node of the synthetic object graphs is a FixedArray with this many
+// pointer fields.
+constexpr int kNodeFields = 4;
+
+enum GraphShape : int64_t {
+  // Every node points to its successor. The marker cannot parallelize this.
+  kList,
+  // Every node points to kNodeFields children.
+  kTree,
+};
+
+enum WriteBarrierKind : int64_t {
+  // Stores a Smi, which needs no barrier. Serves as the baseline.
+  kSmi,
+  kOldToOld,
+  kOldToYoung,
+  // Stores an old object while incremental marking is running.
+  kMarking,
+};
+
+size_t GraphSize(int nodes) {
+  return static_cast<size_t>(nodes) * i::FixedArray::SizeFor(kNodeFields);
+}
+
+class HeapBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ protected:
+  i::Isolate* i_isolate() {
+    return reinterpret_cast<i::Isolate*>(v8_isolate());
+  }
+  i::Heap* heap() { return i_isolate()->heap(); }
+  i::Factory* factory() { return i_isolate()->factory(); }
+
+  void MinorGC() {
+    heap()->CollectGarbage(i::NEW_SPACE, i::GarbageCollectionReason::kTesting);
+  }
+  void MajorGC() {
+    heap()->CollectAllGarbage(i::GCFlag::kNoFlags,
+                              i::GarbageCollectionReason::kTesting);
+  }
+
+  // Builds a graph of `nodes` nodes and returns its root, which keeps all
+  // nodes alive.
+  i::Handle<i::FixedArray> BuildGraph(GraphShape shape, int nodes,
+                                      i::AllocationType allocation) {
+    i::HandleScope scope(i_isolate());
+    i::DirectHandle<i::FixedArray> all =
+        factory()->NewFixedArray(nodes, allocation);
+    for (int n = 0; n < nodes; ++n) {
+      i::DirectHandle<i::FixedArray> node =
+          factory()->NewFixedArray(kNodeFields, allocation);
+      all->set(n, *node);
+    }
+    for (int n = 0; n < nodes; ++n) {
+      i::Tagged<i::FixedArray> node = i::Cast<i::FixedArray>(all->get(n));
+      if (shape == kList) {
+        if (n + 1 < nodes) node->set(0, all->get(n + 1));
+        continue;
+      }
+      for (int field = 0; field < kNodeFields; ++field) {
+        const int child = n * kNodeFields + field + 1;
+        if (child >= nodes) break;
+        node->set(field, all->get(child));
+      }
+    }
+    return scope.CloseAndEscape(
+        i::handle(i::Cast<i::FixedArray>(all->get(0)), i_isolate()));
+  }
+};
+
+// Allocates `bytes` worth of small old-space objects through its own
+// LocalHeap.
+class AllocationThread final : public i::ParkingThread {
+ public:
+  AllocationThread(i::Isolate* isolate, size_t bytes)
+      : i::ParkingThread(
+            v8::base::Thread::Options("HeapBenchmarkAllocation")),
+        isolate_(isolate),
+        bytes_(bytes) {}
+
+  void Run() override {
+    static constexpr int kBatchSize = 1024;
+    i::LocalIsolate local_isolate(isolate_, i::ThreadKind::kBackground);
+    i::UnparkedScope unparked_scope(&local_isolate);
+    const size_t count = bytes_ / i::FixedArray::SizeFor(kNodeFields);
+    for (size_t allocated = 0; allocated < count; allocated += kBatchSize) {
+      i::LocalHandleScope handle_scope(&local_isolate);
+      for (int n = 0; n < kBatchSize; ++n) {
+        benchmark::DoNotOptimize(local_isolate.factory()->NewFixedArray(
+            kNodeFields, i::AllocationType::kOld));
+      }
+      local_isolate.heap()->Safepoint();
+    }
+  }
+
+ private:
+  i::Isolate* isolate_;
+  size_t bytes_;
+};
+
+// Records the wall-clock duration of all atomic GC pauses between the
+// prologue and epilogue callbacks.
+class PauseRecorder final {
+ public:
+  explicit PauseRecorder(v8::Isolate* isolate) : isolate_(isolate) {
+    isolate_->AddGCPrologueCallback(&Prologue, this);
+    isolate_->AddGCEpilogueCallback(&Epilogue, this);
+  }
+  ~PauseRecorder() {
+    isolate_->RemoveGCPrologueCallback(&Prologue, this);
+    isolate_->RemoveGCEpilogueCallback(&Epilogue, this);
+  }
+
+  void ReportTo(benchmark::State& state) {
+    state.counters["pauses"] = static_cast<double>(pauses_.size());
+    if (pauses_.empty()) return;
+    std::sort(pauses_.begin(), pauses_.end());
+    state.counters["p50_us"] = Percentile(50);
+    state.counters["p90_us"] = Percentile(90);
+    state.counters["p99_us"] = Percentile(99);
+    state.counters["max_us"] = pauses_.back();
+  }
+
+ private:
+  static void Prologue(v8::Isolate*, v8::GCType, v8::GCCallbackFlags,
+                       void* data) {
+    static_cast<PauseRecorder*>(data)->start_ = v8::base::TimeTicks::Now();
+  }
+  static void Epilogue(v8::Isolate*, v8::GCType, v8::GCCallbackFlags,
+                       void* data) {
+    PauseRecorder* recorder = static_cast<PauseRecorder*>(data);
+    recorder->pauses_.push_back(
+        (v8::base::TimeTicks::Now() - recorder->start_).InMicrosecondsF());
+  }
+
+  double Percentile(size_t percent) const {
+    const size_t index = pauses_.size() * percent / 100;
+    return pauses_[std::min(index, pauses_.size() - 1)];
+  }
+
+  v8::Isolate* isolate_;
+  v8::base::TimeTicks start_;
+  std::vector<double> pauses_;
+};
+
+}  // namespace
+
+// Bytes of a live young graph evacuated per second by a scavenge.
+BENCHMARK_DEFINE_F(HeapBenchmark, ScavengeThroughput)(benchmark::State& st) {
+  const int nodes = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    i::HandleScope scope(i_isolate());
+    // Start from an empty new space so that the graph is not promoted while
+    // it is being built.
+    MinorGC();
+    i::DirectHandle<i::FixedArray> root =
+        BuildGraph(kTree, nodes, i::AllocationType::kYoung);
+    st.ResumeTiming();
+    MinorGC();
+    benchmark::DoNotOptimize(root);
+  }
+  st.SetBytesProcessed(st.iterations() * GraphSize(nodes));
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, ScavengeThroughput)
+    ->Arg(1 << 10)
+    ->Arg(1 << 12)
+    ->Arg(1 << 14);
+
+// Nodes of a live old graph processed per second by a full GC.
+BENCHMARK_DEFINE_F(HeapBenchmark, MajorGCMarkingRate)(benchmark::State& st) {
+  const GraphShape shape = static_cast<GraphShape>(st.range(0));
+  const int nodes = static_cast<int>(st.range(1));
+  i::HandleScope scope(i_isolate());
+  i::DirectHandle<i::FixedArray> root =
+      BuildGraph(shape, nodes, i::AllocationType::kOld);
+  // Gets rid of the garbage left behind by BuildGraph().
+  MajorGC();
+  for (auto _ : st) {
+    USE(_);
+    MajorGC();
+  }
+  benchmark::DoNotOptimize(root);
+  st.SetItemsProcessed(st.iterations() * nodes);
+  st.SetBytesProcessed(st.iterations() * GraphSize(nodes));
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, MajorGCMarkingRate)
+    ->ArgNames({"shape", "nodes"})
+    ->ArgsProduct({{kList, kTree}, {1 << 12, 1 << 16, 1 << 19}});
+
+// Cost of a tagged store into an old object, including its write barrier.
+BENCHMARK_DEFINE_F(HeapBenchmark, WriteBarrier)(benchmark::State& st) {
+  static constexpr int kLength = 1024;
+  const WriteBarrierKind kind = static_cast<WriteBarrierKind>(st.range(0));
+  i::HandleScope scope(i_isolate());
+  i::DirectHandle<i::FixedArray> holder =
+      factory()->NewFixedArray(kLength, i::AllocationType::kOld);
+  i::DirectHandle<i::Object> value =
+      kind == kSmi ? i::DirectHandle<i::Object>(i::Smi::FromInt(1),
+                                                i_isolate())
+                   : factory()->NewFixedArray(kNodeFields,
+                                              kind == kOldToYoung
+                                                  ? i::AllocationType::kYoung
+                                                  : i::AllocationType::kOld);
+  if (kind == kMarking && heap()->incremental_marking()->IsStopped()) {
+    heap()->StartIncrementalMarking(i::GCFlag::kNoFlags,
+                                    i::GarbageCollectionReason::kTesting);
+  }
+  {
+    i::DisallowGarbageCollection no_gc;
+    i::Tagged<i::FixedArray> raw_holder = *holder;
+    i::Tagged<i::Object> raw_value = *value;
+    for (auto _ : st) {
+      USE(_);
+      for (int index = 0; index < kLength; ++index) {
+        raw_holder->set(index, raw_value);
+      }
+      benchmark::ClobberMemory();
+    }
+  }
+  // Finalizes incremental marking, if any.
+  MajorGC();
+  st.SetItemsProcessed(st.iterations() * kLength);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, WriteBarrier)
+    ->ArgName("kind")
+    ->DenseRange(kSmi, kMarking);
+
+// Old-space allocation throughput of `threads` background threads that each
+// allocate through their own LocalHeap.
+BENCHMARK_DEFINE_F(HeapBenchmark, LocalHeapAllocation)(benchmark::State& st) {
+  static constexpr size_t kBytesPerThread = 8 * i::MB;
+  const int threads = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    std::vector<std::unique_ptr<AllocationThread>> workers;
+    for (int t = 0; t < threads; ++t) {
+      workers.push_back(
+          std::make_unique<AllocationThread>(i_isolate(), kBytesPerThread));
+      CHECK(workers.back()->Start());
+    }
+    i::ParkingThread::ParkedJoinAll(i_isolate()->main_thread_local_isolate(),
+                                    workers);
+    st.PauseTiming();
+    MajorGC();
+    st.ResumeTiming();
+  }
+  st.SetBytesProcessed(st.iterations() * threads * kBytesPerThread);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, LocalHeapAllocation)
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+
+// Distribution of GC pauses while a mutator churns through short-lived nodes
+// and keeps replacing parts of a long-lived graph of `live` nodes. Reports
+// percentiles of the atomic pause times in microseconds.
+BENCHMARK_DEFINE_F(HeapBenchmark, PauseDistribution)(benchmark::State& st) {
+  static constexpr int kAllocationsPerIteration = 1 << 14;
+  // Every kRetainEvery-th node replaces a slot of the long-lived graph.
+  static constexpr int kRetainEvery = 16;
+  const int live = static_cast<int>(st.range(0));
+  i::HandleScope scope(i_isolate());
+  i::DirectHandle<i::FixedArray> retained =
+      factory()->NewFixedArray(live, i::AllocationType::kOld);
+  for (int n = 0; n < live; ++n) {
+    retained->set(n, *factory()->NewFixedArray(kNodeFields,
+                                               i::AllocationType::kOld));
+  }
+  MajorGC();
+  PauseRecorder recorder(v8_isolate());
+  int next_slot = 0;
+  for (auto _ : st) {
+    USE(_);
+    i::HandleScope iteration_scope(i_isolate());
+    for (int n = 0; n < kAllocationsPerIteration; ++n) {
+      i::DirectHandle<i::FixedArray> node =
+          factory()->NewFixedArray(kNodeFields);
+      if (n % kRetainEvery != 0) continue;
+      retained->set(next_slot, *node);
+      next_slot = (next_slot + 1) % live;
+    }
+  }
+  recorder.ReportTo(st);
+  st.SetBytesProcessed(st.iterations() *
+                       GraphSize(kAllocationsPerIteration));
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, PauseDistribution)
+    ->ArgName("live")
+    ->Arg(1 << 14)
+    ->Arg(1 << 18);
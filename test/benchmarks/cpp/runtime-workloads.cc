@@ -0,0 +1,364 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "include/v8-context.h"
+#include "include/v8-json.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-regexp.h"
+#include "src/base/macros.h"
+#include "src/base/utils/random-number-generator.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// The corpora below mimic the shape of payloads that embedders process:
+// API responses, numeric telemetry, localized text and service logs. They are
+// generated with a fixed seed so that results are comparable across runs.
+// Corpora captured from production can be added to the tables as additional
+// generators that return the captured text.
+
+constexpr int64_t kSeed = 42;
+
+const char* const kFirstNames[] = {"Ada",   "Grace", "Linus", "Barbara",
+                                   "Alan",  "Edsger", "Frances", "Ken"};
+const char* const kLastNames[] = {"Lovelace", "Hopper",  "Torvalds",
+                                  "Liskov",   "Turing",  "Dijkstra",
+                                  "Allen",    "Thompson"};
+const char* const kCities[] = {"Aarhus", "Munich", "Tokyo", "Mountain View",
+                               "London", "Zurich"};
+const char* const kTags[] = {"admin", "beta", "premium", "trial", "staff",
+                             "verified"};
+const char* const kMessages[] = {
+    "Grüße aus München",
+    "Ça va très bien, merci",
+    "日本語のテキストです",
+    "Добро пожаловать",
+    "안녕하세요 세계",
+    "¡Hola, señor!",
+    "Ελληνικά γράμματα",
+    "Emoji 🎉🚀 inside",
+    "Plain ASCII message",
+};
+const char* const kLocales[] = {"de", "fr", "ja", "ru", "ko",
+                                "es", "el", "en", "en"};
+
+template <typename T, size_t N>
+const T& Pick(v8::base::RandomNumberGenerator* rng, const T (&values)[N]) {
+  return values[rng->NextInt(static_cast<int>(N))];
+}
+
+std::string ApiResponseCorpus() {
+  v8::base::RandomNumberGenerator rng(kSeed);
+  std::ostringstream out;
+  out << "[";
+  for (int n = 0; n < 5000; ++n) {
+    if (n > 0) out << ",";
+    out << "{\"id\":" << 100000 + n << ",\"name\":\""
+        << Pick(&rng, kFirstNames) << " " << Pick(&rng, kLastNames)
+        << "\",\"email\":\"user" << n << "@example.com\",\"active\":"
+        << (rng.NextBool() ? "true" : "false")
+        << ",\"score\":" << rng.NextInt(10000) / 100.0 << ",\"tags\":[\""
+        << Pick(&rng, kTags) << "\",\"" << Pick(&rng, kTags)
+        << "\"],\"address\":{\"street\":\"" << rng.NextInt(1000)
+        << " Main St\",\"city\":\"" << Pick(&rng, kCities) << "\",\"zip\":\""
+        << 10000 + rng.NextInt(90000) << "\"}}";
+  }
+  out << "]";
+  return out.str();
+}
+
+std::string TelemetryCorpus() {
+  static const char* const kMetrics[] = {"cpu", "memory", "latency", "qps"};
+  v8::base::RandomNumberGenerator rng(kSeed);
+  std::ostringstream out;
+  out << "{\"host\":\"worker-17\",\"series\":[";
+  for (int n = 0; n < 4000; ++n) {
+    if (n > 0) out << ",";
+    out << "{\"metric\":\"" << Pick(&rng, kMetrics)
+        << "\",\"ts\":" << 1767225600000 + n * 1000 << ",\"values\":[";
+    for (int v = 0; v < 16; ++v) {
+      if (v > 0) out << ",";
+      out << rng.NextDouble() * 1000;
+    }
+    out << "]}";
+  }
+  out << "]}";
+  return out.str();
+}
+
+std::string I18nCorpus() {
+  v8::base::RandomNumberGenerator rng(kSeed);
+  std::ostringstream out;
+  out << "[";
+  for (int n = 0; n < 10000; ++n) {
+    if (n > 0) out << ",";
+    const int message = rng.NextInt(static_cast<int>(arraysize(kMessages)));
+    out << "{\"locale\":\"" << kLocales[message] << "\",\"key\":\"msg." << n
+        << "\",\"text\":\"" << kMessages[message] << "\"}";
+  }
+  out << "]";
+  return out.str();
+}
+
+struct JsonCorpus {
+  const char* name;
+  std::string (*generate)();
+};
+
+constexpr JsonCorpus kJsonCorpora[] = {
+    {"api_response", &ApiResponseCorpus},
+    {"telemetry", &TelemetryCorpus},
+    {"i18n", &I18nCorpus},
+};
+
+// Returns the contents of the string literals of `json`, i.e. property names
+// and string values, which are typical of the short strings embedders pass
+// through the API.
+std::vector<std::string> StringLiterals(const std::string& json) {
+  std::vector<std::string> literals;
+  size_t start = json.find('"');
+  while (start != std::string::npos) {
+    const size_t end = json.find('"', start + 1);
+    literals.push_back(json.substr(start + 1, end - start - 1));
+    start = json.find('"', end + 1);
+  }
+  return literals;
+}
+
+std::vector<std::string> LogCorpus() {
+  static const char* const kLevels[] = {"INFO", "INFO", "INFO", "WARN",
+                                        "ERROR"};
+  static const char* const kMethods[] = {"GET", "GET", "POST", "PUT",
+                                         "DELETE"};
+  static const char* const kAgents[] = {
+      "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36",
+      "Mozilla/5.0 (Macintosh; Intel Mac OS X 14_4) Safari/605.1.15",
+      "curl/8.5.0", "okhttp/4.12.0"};
+  v8::base::RandomNumberGenerator rng(kSeed);
+  std::vector<std::string> lines;
+  char buffer[512];
+  for (int n = 0; n < 10000; ++n) {
+    snprintf(buffer, sizeof(buffer),
+             "2026-03-14T12:%02d:%02d.%03dZ %s [svc-%d] %s "
+             "/api/v1/users/%d?session=%08x-%04x-%04x-%04x-%04x%08x %d %dms "
+             "ua=\"%s\"",
+             n / 600 % 60, n / 10 % 60, rng.NextInt(1000),
+             Pick(&rng, kLevels), rng.NextInt(32), Pick(&rng, kMethods),
+             rng.NextInt(1000000), static_cast<unsigned>(rng.NextInt()),
+             rng.NextInt(0x10000), rng.NextInt(0x10000),
+             rng.NextInt(0x10000), rng.NextInt(0x10000),
+             static_cast<unsigned>(rng.NextInt()),
+             rng.NextInt(10) == 0 ? 500 : 200, rng.NextInt(2000),
+             Pick(&rng, kAgents));
+    lines.push_back(buffer);
+  }
+  return lines;
+}
+
+struct RegExpPattern {
+  const char* name;
+  const char* source;
+  v8::RegExp::Flags flags;
+};
+
+const RegExpPattern kRegExpPatterns[] = {
+    {"access_log",
+     "^(\\S+) (\\w+) \\[([^\\]]+)\\] (GET|POST|PUT|DELETE) (\\S+) (\\d{3}) "
+     "(\\d+)ms",
+     v8::RegExp::kNone},
+    {"uuid",
+     "[0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12}",
+     v8::RegExp::kNone},
+    {"user_agent", "ua=\"([^\"]*)\"", v8::RegExp::kNone},
+    // Rarely matches, so most of the time is spent failing.
+    {"fatal", "\\b(?:fatal|panic)\\b", v8::RegExp::kIgnoreCase},
+};
+
+class CountingSink final : public v8::JSON::OutputSink {
+ public:
+  void WriteUtf8Chunk(const char* data, size_t length) override {
+    bytes_ += length;
+  }
+  size_t bytes() const { return bytes_; }
+
+ private:
+  size_t bytes_ = 0;
+};
+
+class RuntimeWorkloadsBenchmark
+    : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    context_.Reset(v8_isolate(), context);
+    context->Enter();
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    context_.Reset();
+  }
+
+ protected:
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+
+  v8::Local<v8::String> NewString(const std::string& value) {
+    return v8::String::NewFromUtf8(v8_isolate(), value.data(),
+                                   v8::NewStringType::kNormal,
+                                   static_cast<int>(value.size()))
+        .ToLocalChecked();
+  }
+
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(RuntimeWorkloadsBenchmark, JsonParse)
+(benchmark::State& st) {
+  const JsonCorpus& corpus = kJsonCorpora[st.range(0)];
+  const std::string json = corpus.generate();
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::String> source = NewString(json);
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::Value> result =
+        v8::JSON::Parse(context, source).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+  st.SetLabel(corpus.name);
+  st.SetBytesProcessed(st.iterations() * json.size());
+}
+BENCHMARK_REGISTER_F(RuntimeWorkloadsBenchmark, JsonParse)
+    ->DenseRange(0, arraysize(kJsonCorpora) - 1);
+
+BENCHMARK_DEFINE_F(RuntimeWorkloadsBenchmark, JsonStringify)
+(benchmark::State& st) {
+  const JsonCorpus& corpus = kJsonCorpora[st.range(0)];
+  const std::string json = corpus.generate();
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Value> value =
+      v8::JSON::Parse(context, NewString(json)).ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::String> result =
+        v8::JSON::Stringify(context, value).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+  st.SetLabel(corpus.name);
+  st.SetBytesProcessed(st.iterations() * json.size());
+}
+BENCHMARK_REGISTER_F(RuntimeWorkloadsBenchmark, JsonStringify)
+    ->DenseRange(0, arraysize(kJsonCorpora) - 1);
+
+BENCHMARK_DEFINE_F(RuntimeWorkloadsBenchmark, JsonStringifyTo)
+(benchmark::State& st) {
+  const JsonCorpus& corpus = kJsonCorpora[st.range(0)];
+  const std::string json = corpus.generate();
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Value> value =
+      v8::JSON::Parse(context, NewString(json)).ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    CountingSink sink;
+    CHECK(v8::JSON::StringifyTo(context, value, &sink).FromJust());
+    benchmark::DoNotOptimize(sink.bytes());
+  }
+  st.SetLabel(corpus.name);
+  st.SetBytesProcessed(st.iterations() * json.size());
+}
+BENCHMARK_REGISTER_F(RuntimeWorkloadsBenchmark, JsonStringifyTo)
+    ->DenseRange(0, arraysize(kJsonCorpora) - 1);
+
+BENCHMARK_DEFINE_F(RuntimeWorkloadsBenchmark, NewFromUtf8)
+(benchmark::State& st) {
+  const JsonCorpus& corpus = kJsonCorpora[st.range(0)];
+  const std::vector<std::string> literals = StringLiterals(corpus.generate());
+  size_t bytes = 0;
+  for (const std::string& literal : literals) bytes += literal.size();
+  v8::HandleScope handle_scope(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    for (const std::string& literal : literals) {
+      benchmark::DoNotOptimize(NewString(literal));
+    }
+  }
+  st.SetLabel(corpus.name);
+  st.SetBytesProcessed(st.iterations() * bytes);
+}
+BENCHMARK_REGISTER_F(RuntimeWorkloadsBenchmark, NewFromUtf8)
+    ->DenseRange(0, arraysize(kJsonCorpora) - 1);
+
+BENCHMARK_DEFINE_F(RuntimeWorkloadsBenchmark, WriteUtf8)
+(benchmark::State& st) {
+  const JsonCorpus& corpus = kJsonCorpora[st.range(0)];
+  const std::vector<std::string> literals = StringLiterals(corpus.generate());
+  v8::HandleScope handle_scope(v8_isolate());
+  std::vector<v8::Local<v8::String>> strings;
+  size_t bytes = 0;
+  size_t max_length = 0;
+  for (const std::string& literal : literals) {
+    strings.push_back(NewString(literal));
+    bytes += literal.size();
+    max_length = std::max(max_length, literal.size());
+  }
+  std::vector<char> buffer(max_length);
+  for (auto _ : st) {
+    USE(_);
+    for (v8::Local<v8::String> string : strings) {
+      benchmark::DoNotOptimize(
+          string->WriteUtf8V2(v8_isolate(), buffer.data(), buffer.size()));
+    }
+    benchmark::ClobberMemory();
+  }
+  st.SetLabel(corpus.name);
+  st.SetBytesProcessed(st.iterations() * bytes);
+}
+BENCHMARK_REGISTER_F(RuntimeWorkloadsBenchmark, WriteUtf8)
+    ->DenseRange(0, arraysize(kJsonCorpora) - 1);
+
+BENCHMARK_DEFINE_F(RuntimeWorkloadsBenchmark, RegExpExec)
+(benchmark::State& st) {
+  const RegExpPattern& pattern = kRegExpPatterns[st.range(0)];
+  const std::vector<std::string> lines = LogCorpus();
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::RegExp> regexp =
+      v8::RegExp::New(context, NewString(pattern.source), pattern.flags)
+          .ToLocalChecked();
+  std::vector<v8::Local<v8::String>> subjects;
+  size_t bytes = 0;
+  for (const std::string& line : lines) {
+    subjects.push_back(NewString(line));
+    bytes += line.size();
+  }
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    for (v8::Local<v8::String> subject : subjects) {
+      benchmark::DoNotOptimize(regexp->Exec(context, subject));
+    }
+  }
+  st.SetLabel(pattern.name);
+  st.SetBytesProcessed(st.iterations() * bytes);
+}
+BENCHMARK_REGISTER_F(RuntimeWorkloadsBenchmark, RegExpExec)
+    ->DenseRange(0, arraysize(kRegExpPatterns) - 1);
@@ -0,0 +1,80 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/base/macros.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using v8::platform::DefaultWorkerThreadsTaskRunner;
+
+double RealTime() {
+  return v8::base::TimeTicks::Now().ToInternalValue() /
+         static_cast<double>(v8::base::Time::kMicrosecondsPerSecond);
+}
+
+class CountdownTask final : public v8::Task {
+ public:
+  CountdownTask(std::atomic<int>* remaining, v8::base::Semaphore* done)
+      : remaining_(remaining), done_(done) {}
+
+  void Run() override {
+    if (remaining_->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      done_->Signal();
+    }
+  }
+
+ private:
+  std::atomic<int>* remaining_;
+  v8::base::Semaphore* done_;
+};
+
+constexpr int kTasksPerIteration = 10000;
+
+// Posts a burst of empty tasks and waits until all of them ran, which measures
+// the dispatch overhead of the worker pool at a high post rate.
+void BM_PostTaskBurst(benchmark::State& state) {
+  DefaultWorkerThreadsTaskRunner runner(static_cast<uint32_t>(state.range(0)),
+                                        RealTime);
+  v8::base::Semaphore done(0);
+  std::atomic<int> remaining;
+  for (auto _ : state) {
+    USE(_);
+    remaining.store(kTasksPerIteration);
+    for (int i = 0; i < kTasksPerIteration; ++i) {
+      runner.PostTask(std::make_unique<CountdownTask>(&remaining, &done));
+    }
+    done.Wait();
+  }
+  runner.Terminate();
+  state.SetItemsProcessed(state.iterations() * kTasksPerIteration);
+}
+
+// Posts a single task and waits for it, which measures the latency of waking
+// up an idle worker.
+void BM_PostTaskRoundTrip(benchmark::State& state) {
+  DefaultWorkerThreadsTaskRunner runner(static_cast<uint32_t>(state.range(0)),
+                                        RealTime);
+  v8::base::Semaphore done(0);
+  std::atomic<int> remaining;
+  for (auto _ : state) {
+    USE(_);
+    remaining.store(1);
+    runner.PostTask(std::make_unique<CountdownTask>(&remaining, &done));
+    done.Wait();
+  }
+  runner.Terminate();
+}
+
+}  // namespace
+
+BENCHMARK(BM_PostTaskBurst)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->UseRealTime();
+BENCHMARK(BM_PostTaskRoundTrip)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
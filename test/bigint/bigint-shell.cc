@@ -5,6 +5,8 @@
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -36,6 +38,7 @@ int PrintHelp(char** argv) {
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
+  V(kParallel, "parallel")           \
   V(kToom, "toom")                   \
   V(kToString, "tostring")
 
@@ -123,6 +126,20 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs each unit of work of a parallel operation on its own thread.
+class ThreadedPlatform : public Platform {
+ public:
+  int NumberOfWorkerThreads() override { return 3; }
+
+  void RunParallel(ParallelTask* task, int count) override {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < count; i++) {
+      threads.emplace_back([task, i]() { task->Run(i); });
+    }
+    for (std::thread& thread : threads) thread.join();
+  }
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -204,6 +221,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestParallel(&count);
+      }
     } else if (test_ == kToom) {
       for (int i = 0; i < runs_; i++) {
         TestToom(&count);
@@ -311,6 +332,35 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    std::unique_ptr<Processor, Processor::Destroyer> parallel(
+        Processor::New(new ThreadedPlatform()));
+    // Toom-Cook with a long left input, and FFT, with and without squaring.
+    const int kSizes[][2] = {{kParallelMultiplyThreshold, kToomThreshold},
+                             {3 * kParallelMultiplyThreshold, kFftThreshold - 1},
+                             {kParallelMultiplyThreshold, kFftThreshold},
+                             {kParallelMultiplyThreshold,
+                              kParallelMultiplyThreshold},
+                             {4 * kParallelMultiplyThreshold, 0}};
+    for (const auto& sizes : kSizes) {
+      ScratchDigits A(sizes[0]);
+      GenerateRandom(A);
+      ScratchDigits B(sizes[1] > 0 ? sizes[1] : sizes[0]);
+      GenerateRandom(B);
+      Digits right = sizes[1] > 0 ? Digits(B) : Digits(A);
+      int result_len = MultiplyResultLength(A, right);
+      ScratchDigits result(result_len);
+      ScratchDigits result_sequential(result_len);
+      CHECK(parallel->Multiply(result, A, right) == Status::kOk);
+      processor()->Multiply(result_sequential, A, right);
+      AssertEquals(A, right, result_sequential, result);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
@@ -410,6 +460,25 @@ class Runner {
         (*count)++;
       }
     }
+    // Larger inputs, in decreasing size, reuse the radix powers cached by
+    // the processor for earlier ones.
+    for (int size = kToStringCacheMaxDigits; size >= kMax; size /= 3) {
+      ScratchDigits X(size);
+      GenerateRandom(X);
+      int radix = 2 + static_cast<int>(rng_.NextUint64() % 35);
+      uint32_t result_len = ToStringResultLength(X, radix, false);
+      uint32_t reference_len = result_len;
+      std::unique_ptr<char[]> result(new char[result_len]);
+      std::unique_ptr<char[]> reference(new char[reference_len]);
+      processor()->ToStringImpl(result.get(), &result_len, X, radix, false,
+                                true);
+      processor()->ToStringImpl(reference.get(), &reference_len, X, radix,
+                                false, false);
+      AssertEquals(X, radix, reference.get(), reference_len, result.get(),
+                   result_len);
+      if (error_) return;
+      (*count)++;
+    }
   }
 
   void TestFromString(int* count) {
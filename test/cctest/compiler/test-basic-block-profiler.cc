@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/builtins/profile-data-reader.h"
 #include "src/diagnostics/basic-block-profiler.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/cctest.h"
@@ -140,6 +141,31 @@ TEST(ProfileLoop) {
   }
 }
 
+TEST(BranchHintsFromBlockCounts) {
+  BasicBlockProfilerData* data = BasicBlockProfiler::Get()->NewData(7);
+  data->SetFunctionName(std::make_unique<char[]>(1));
+  data->SetHash(42);
+  uint32_t counts[] = {5000, 4990, 10, 2000, 1000, 100, 0};
+  for (size_t i = 0; i < arraysize(counts); ++i) {
+    data->SetBlockId(i, static_cast<int32_t>(i));
+    const_cast<uint32_t*>(data->counts())[i] = counts[i];
+  }
+  data->AddBranch(1, 2);
+  data->AddBranch(3, 4);
+  data->AddBranch(6, 5);
+  CHECK_EQ(data, BasicBlockProfiler::Get()->FindData("", 42));
+  CHECK_NULL(BasicBlockProfiler::Get()->FindData("", 43));
+
+  std::unique_ptr<ProfileDataFromFile> profile =
+      ProfileDataFromFile::FromBlockCounts(*data);
+  CHECK_EQ(42, profile->hash());
+  CHECK_EQ(BranchHint::kTrue, profile->GetHint(1, 2));
+  // The ratio between the destinations is too small.
+  CHECK_EQ(BranchHint::kNone, profile->GetHint(3, 4));
+  // The destinations are not executed often enough.
+  CHECK_EQ(BranchHint::kNone, profile->GetHint(6, 5));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -1150,6 +1150,58 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingDisabledByEmbedder) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::Function> api_function = v8::Local<v8::Function>::Cast(
+        CompileRun("function foo() { return 42; }; foo(); foo"));
+    api_function->SetBytecodeFlushingDisabled(true);
+    IndirectHandle<JSFunction> function =
+        Cast<JSFunction>(v8::Utils::OpenHandle(*api_function));
+    CHECK(function->shared()->is_compiled());
+
+    i::SharedFunctionInfo::EnsureOldForTesting(function->shared());
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(function->shared()->is_compiled());
+
+    int recompilations_before_flush =
+        i_isolate->counters()->compile_lazy_after_flush_count()->Get();
+    api_function->SetBytecodeFlushingDisabled(false);
+    i::SharedFunctionInfo::EnsureOldForTesting(function->shared());
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(!function->shared()->is_compiled());
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    if (i_isolate->counters()->compile_lazy_after_flush_count()->Enabled()) {
+      CHECK_EQ(i_isolate->counters()->compile_lazy_after_flush_count()->Get(),
+               recompilations_before_flush + 1);
+    }
+  }
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
   v8_flags.turbofan = false;
@@ -10,6 +10,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/compiler/function-tester.h"
 #include "test/common/code-assembler-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -27,18 +28,19 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, JSParameterCount(kNumParams));
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -75,11 +77,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       DirectHandle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -112,7 +114,9 @@ Handle<Code> CreateCodeOfKind(CodeKind kind) {
 
 }  // namespace
 
-TEST(TryProbeStubCache) {
+namespace {
+
+void TestTryProbeStubCache(bool grow) {
   using Label = CodeStubAssembler::Label;
   Isolate* isolate(CcTest::InitIsolateOnce());
   const int kNumParams = 3;
@@ -205,15 +209,31 @@ TEST(TryProbeStubCache) {
   // own stub cache instance with raw values.
   DisallowGarbageCollection no_gc;
 
+  auto populate = [&](int count) {
+    for (int i = 0; i < count; i++) {
+      int index = rand_gen.NextInt();
+      DirectHandle<Name> name = names[index % names.size()];
+      DirectHandle<JSObject> receiver = receivers[index % receivers.size()];
+      DirectHandle<Code> handler = handlers[index % handlers.size()];
+      stub_cache.Set(*name, receiver->map(), *handler);
+    }
+  };
+
+  if (grow) {
+    // Evict enough entries between clears to make the tables grow to their
+    // maximal size. The generated code picks up the new hash masks.
+    for (int i = 0; i < StubCache::kMaxTableGrowth; i++) {
+      populate(2 * stub_cache.primary_table_size());
+      stub_cache.Clear();
+    }
+    CHECK_EQ(StubCache::kMaxPrimaryTableSize, stub_cache.primary_table_size());
+    CHECK_EQ(StubCache::kMaxSecondaryTableSize,
+             stub_cache.secondary_table_size());
+  }
+
   // Populate {stub_cache}.
   const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
-  for (int i = 0; i < N; i++) {
-    int index = rand_gen.NextInt();
-    DirectHandle<Name> name = names[index % names.size()];
-    DirectHandle<JSObject> receiver = receivers[index % receivers.size()];
-    DirectHandle<Code> handler = handlers[index % handlers.size()];
-    stub_cache.Set(*name, receiver->map(), *handler);
-  }
+  populate(N);
 
   // Perform some queries.
   bool queried_existing = false;
@@ -252,6 +272,15 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+}  // namespace
+
+TEST(TryProbeStubCache) { TestTryProbeStubCache(false); }
+
+TEST(TryProbeGrownStubCache) {
+  FlagScope<bool> grow_stub_cache(&v8_flags.grow_stub_cache, true);
+  TestTryProbeStubCache(true);
+}
+
 #include "src/codegen/undef-code-stub-assembler-macros.inc"
 
 }  // namespace internal
@@ -674,6 +674,48 @@ TEST(ScriptUsingOneByteStringResource) {
   CHECK_EQ(1, dispose_count);
 }
 
+TEST(NewExternalUtf8) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // ASCII data is used in place.
+  int ascii_dispose_count = 0;
+  TestOneByteResource* ascii_resource = new TestOneByteResource(
+      i::StrDup("content-type"), &ascii_dispose_count);
+  Local<String> ascii =
+      String::NewExternalUtf8(isolate, ascii_resource).ToLocalChecked();
+  CHECK(ascii->IsExternalOneByte());
+  CHECK_EQ(static_cast<const String::ExternalStringResourceBase*>(
+               ascii_resource),
+           ascii->GetExternalOneByteStringResource());
+  CHECK(ascii->StrictEquals(v8_str("content-type")));
+  CHECK_EQ(0, ascii_dispose_count);
+
+  // Anything else is decoded and the resource is released immediately.
+  const char* kUtf8 = "gr\xC3\xBC\xC3\x9F \xF0\x9F\x8C\x8D";
+  int utf8_dispose_count = 0;
+  TestOneByteResource* utf8_resource =
+      new TestOneByteResource(i::StrDup(kUtf8), &utf8_dispose_count);
+  Local<String> utf8 =
+      String::NewExternalUtf8(isolate, utf8_resource).ToLocalChecked();
+  CHECK_EQ(1, utf8_dispose_count);
+  CHECK(!utf8->IsExternal());
+  CHECK(
+      utf8->StrictEquals(String::NewFromUtf8(isolate, kUtf8).ToLocalChecked()));
+  CHECK_EQ(7, utf8->Length());
+
+  // Invalid sequences are replaced, as with NewFromUtf8.
+  int invalid_dispose_count = 0;
+  TestOneByteResource* invalid_resource =
+      new TestOneByteResource(i::StrDup("a\xFFb"), &invalid_dispose_count);
+  Local<String> invalid =
+      String::NewExternalUtf8(isolate, invalid_resource).ToLocalChecked();
+  CHECK_EQ(1, invalid_dispose_count);
+  CHECK(invalid->StrictEquals(
+      String::NewFromUtf8(isolate, "a\xFFb").ToLocalChecked()));
+}
+
 TEST(ScriptMakingExternalString) {
   int dispose_count = 0;
   uint16_t* two_byte_source = AsciiToTwoByteString(u"1 + 2 * 3 /* π */");
@@ -3266,6 +3308,61 @@ THREADED_TEST(InternalFieldsAlignedPointers) {
   CHECK_EQ(huge, Object::GetAlignedPointerFromInternalField(persistent, 0));
 }
 
+THREADED_TEST(ObjectTemplateNewInstances) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  templ->SetInternalFieldCount(2);
+  templ->Set(isolate, "kind", v8_str("row"));
+  templ->SetAccessorProperty(
+      v8_str("self"),
+      v8::FunctionTemplate::New(
+          isolate, [](const v8::FunctionCallbackInfo<v8::Value>& info) {
+            info.GetReturnValue().Set(info.This());
+          }));
+
+  constexpr int kCount = 64;
+  Local<v8::Object> objects[kCount];
+  int fields[kCount][2];
+  void* values[kCount * 2];
+  for (int i = 0; i < kCount; ++i) {
+    values[2 * i] = &fields[i][0];
+    values[2 * i + 1] = &fields[i][1];
+  }
+  CHECK(templ->NewInstances(env.local(), kCount, objects, values).IsJust());
+  i::heap::InvokeMajorGC(CcTest::heap());
+
+  Local<v8::Object> reference =
+      templ->NewInstance(env.local()).ToLocalChecked();
+  i::DirectHandle<i::Map> map(v8::Utils::OpenDirectHandle(*reference)->map(),
+                              CcTest::i_isolate());
+  for (int i = 0; i < kCount; ++i) {
+    CHECK_EQ(2, objects[i]->InternalFieldCount());
+    CHECK_EQ(&fields[i][0], objects[i]->GetAlignedPointerFromInternalField(0));
+    CHECK_EQ(&fields[i][1], objects[i]->GetAlignedPointerFromInternalField(1));
+    // Every instance is a distinct object with the same shape as one created
+    // by NewInstance().
+    CHECK(!objects[i]->StrictEquals(objects[(i + 1) % kCount]));
+    CHECK_EQ(*map, v8::Utils::OpenDirectHandle(*objects[i])->map());
+    CHECK(objects[i]
+              ->Get(env.local(), v8_str("kind"))
+              .ToLocalChecked()
+              ->StrictEquals(v8_str("row")));
+    CHECK(objects[i]
+              ->Get(env.local(), v8_str("self"))
+              .ToLocalChecked()
+              ->StrictEquals(objects[i]));
+  }
+
+  // Internal fields are optional.
+  Local<v8::Object> more[2];
+  CHECK(templ->NewInstances(env.local(), 2, more).IsJust());
+  CHECK_EQ(2, more[1]->InternalFieldCount());
+  CHECK(templ->NewInstances(env.local(), 0, nullptr).IsJust());
+}
+
 THREADED_TEST(SetAlignedPointerInInternalFields) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -5693,6 +5790,65 @@ THREADED_TEST(FunctionCall) {
   CHECK(r10->StrictEquals(v8::True(isolate)));
 }
 
+TEST(FunctionCallBatch) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "var sum = 0, microtasks = 0, seenAtMicrotask = [];"
+      "function handler(a, b) {"
+      "  if (a === 'throw') throw new Error(b);"
+      "  sum += a * b;"
+      "  Promise.resolve().then(() => {"
+      "    microtasks++; seenAtMicrotask.push(sum);"
+      "  });"
+      "}");
+  Local<Function> handler = Local<Function>::Cast(
+      context->Global()
+          ->Get(context.local(), v8_str("handler"))
+          .ToLocalChecked());
+
+  Local<Value> argv[] = {v8_num(1), v8_num(2), v8_num(3),
+                         v8_num(4), v8_num(5), v8_num(6)};
+  int completed = -1;
+  CHECK(handler
+            ->CallBatch(context.local(), v8::Undefined(isolate), 3, 2, argv,
+                        &completed)
+            .IsJust());
+  CHECK_EQ(3, completed);
+  CHECK_EQ(2 + 12 + 30,
+           CompileRun("sum")->Int32Value(context.local()).FromJust());
+  // Microtasks only ran once the whole batch was done.
+  CHECK_EQ(3, CompileRun("microtasks")->Int32Value(context.local()).FromJust());
+  CHECK(CompileRun("seenAtMicrotask.every(s => s === 44)")->IsTrue());
+
+  // The batch stops at the first exception.
+  {
+    v8::TryCatch try_catch(isolate);
+    Local<Value> throwing_argv[] = {v8_num(1), v8_num(1), v8_str("throw"),
+                                    v8_str("boom"), v8_num(1), v8_num(1)};
+    CHECK(handler
+              ->CallBatch(context.local(), v8::Undefined(isolate), 3, 2,
+                          throwing_argv, &completed)
+              .IsNothing());
+    CHECK_EQ(1, completed);
+    CHECK(try_catch.HasCaught());
+    CHECK_EQ(45, CompileRun("sum")->Int32Value(context.local()).FromJust());
+  }
+
+  // Calls without arguments don't need an argument buffer.
+  CompileRun("var calls = 0; function counter() { calls++; }");
+  Local<Function> counter = Local<Function>::Cast(
+      context->Global()
+          ->Get(context.local(), v8_str("counter"))
+          .ToLocalChecked());
+  CHECK(counter
+            ->CallBatch(context.local(), v8::Undefined(isolate), 1000, 0,
+                        nullptr)
+            .IsJust());
+  CHECK_EQ(1000, CompileRun("calls")->Int32Value(context.local()).FromJust());
+}
+
 
 THREADED_TEST(ConstructCall) {
   LocalContext context;
@@ -17225,6 +17381,36 @@ TEST(GetHeapSpaceStatistics) {
   CHECK_EQ(total_physical_size, heap_statistics.total_physical_size());
 }
 
+TEST(GetScriptCodeStatistics) {
+  i::v8_flags.allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::Local<v8::Script> script =
+      v8_compile("function f(a) { return a.x + 1; }"
+                 "%EnsureFeedbackVectorForFunction(f);"
+                 "f({x: 1});");
+  int script_id = script->GetUnboundScript()->GetId();
+  script->Run(env.local()).ToLocalChecked();
+
+  std::vector<v8::ScriptCodeStatistics> statistics;
+  CHECK(!isolate->GetScriptCodeStatistics(nullptr));
+  CHECK(isolate->GetScriptCodeStatistics(&statistics));
+
+  bool found = false;
+  for (v8::ScriptCodeStatistics& entry : statistics) {
+    CHECK_NE(v8::UnboundScript::kNoScriptId, entry.script_id());
+    if (entry.script_id() != script_id) continue;
+    CHECK(!found);
+    found = true;
+    CHECK_GT(entry.bytecode_size(), 0);
+    CHECK_GT(entry.feedback_metadata_size(), 0);
+    if (!i::v8_flags.lite_mode) CHECK_GT(entry.feedback_vector_size(), 0);
+  }
+  CHECK(found);
+}
+
 TEST(NumberOfNativeContexts) {
   static const size_t kNumTestContexts = 10;
   i::Isolate* isolate = CcTest::i_isolate();
@@ -21121,6 +21307,51 @@ THREADED_TEST(JSONParseNumber) {
   ExpectString("JSON.stringify(obj)", "42");
 }
 
+namespace {
+v8::MaybeLocal<Value> JSONParseProperties(Local<Context> context,
+                                          const char* source) {
+  Local<String> names[] = {v8_str("a"), v8_str("c\u20ac"), v8_str("1")};
+  return v8::JSON::ParseProperties(context, v8_str(source), names);
+}
+}  // namespace
+
+THREADED_TEST(JSONParseProperties) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  Local<Object> global = context->Global();
+  const char* sources[][2] = {
+      {"{\"a\": [1, {\"b\": 2}], \"b\": {\"a\": [[], {}]}, \"1\": 3}",
+       "{\"1\":3,\"a\":[1,{\"b\":2}]}"},
+      // Escaped names, two-byte names, and duplicates.
+      {"{\"\\u0061\": 1, \"c\u20ac\": \"x\", \"a\": 2,"
+       " \"d\": \"\\\"}\"}",
+       "{\"a\":2,\"c\u20ac\":\"x\"}"},
+      {" { } ", "{}"},
+      // Other values are parsed like with JSON::Parse.
+      {"[{\"x\": 1}]", "[{\"x\":1}]"},
+      {"\"a\"", "\"a\""},
+  };
+  for (auto [source, expected] : sources) {
+    Local<Value> obj =
+        JSONParseProperties(context.local(), source).ToLocalChecked();
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectString("JSON.stringify(obj)", expected);
+  }
+
+  // Skipped values are still validated.
+  const char* invalid[] = {
+      "{\"b\": [1, 2}",    "{\"b\": {\"x\" 1}}", "{\"b\": [01]}",
+      "{\"b\": tru}",      "{\"b\": {}, }",        "{\"a\": 1} x",
+      "{\"b\": [[[[[[[",   "{\"b\": \"\\x\"}",
+  };
+  for (const char* source : invalid) {
+    v8::TryCatch try_catch(context->GetIsolate());
+    CHECK(JSONParseProperties(context.local(), source).IsEmpty());
+    CHECK(try_catch.HasCaught());
+    CHECK(try_catch.Exception()->IsNativeError());
+  }
+}
+
 namespace {
 void TestJSONParseArray(Local<Context> context, const char* input_str,
                         const char* expected_output_str,
@@ -21186,6 +21417,66 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class StringJsonOutputSink : public v8::JSON::OutputSink {
+ public:
+  void WriteUtf8Chunk(const char* data, size_t length) override {
+    CHECK_GT(length, 0u);
+    result_.append(data, length);
+    chunks_++;
+  }
+  const std::string& result() const { return result_; }
+  int chunks() const { return chunks_; }
+
+ private:
+  std::string result_;
+  int chunks_ = 0;
+};
+
+void CheckJSONStringifyTo(LocalContext& context, const char* source,
+                          Local<String> gap = Local<String>()) {
+  Local<Value> value = CompileRun(source);
+  Local<String> expected =
+      v8::JSON::Stringify(context.local(), value, gap).ToLocalChecked();
+  v8::String::Utf8Value utf8(context->GetIsolate(), expected);
+  StringJsonOutputSink sink;
+  CHECK(v8::JSON::StringifyTo(context.local(), value, &sink, gap).FromJust());
+  CHECK_EQ(std::string(*utf8, utf8.length()), sink.result());
+}
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyTo) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  CheckJSONStringifyTo(context, "({x: 42, y: [1, 'a', null]})");
+  CheckJSONStringifyTo(context, "({x: 42, y: [1, 'a', null]})", v8_str("*"));
+  // Results that are larger than a segment, with two-byte characters and
+  // surrogate pairs after one-byte characters.
+  CheckJSONStringifyTo(context,
+                       "Array(1000).fill({a: 'abc', b: 'd\u00e9f'})");
+  CheckJSONStringifyTo(context,
+                       "['x'.repeat(5000), '\u20ac\u{1F600}'.repeat(3000)]");
+  // The slow path, and lone surrogates which are escaped.
+  CheckJSONStringifyTo(context, "({toJSON() { return '\uD800x'.repeat(9); }})");
+
+  StringJsonOutputSink sink;
+  CHECK(!v8::JSON::StringifyTo(context.local(),
+                               v8::Undefined(context->GetIsolate()), &sink)
+             .FromJust());
+  CHECK(!v8::JSON::StringifyTo(context.local(), CompileRun("(() => {})"),
+                               &sink)
+             .FromJust());
+  CHECK_EQ(sink.chunks(), 0);
+
+  v8::TryCatch try_catch(context->GetIsolate());
+  CHECK(v8::JSON::StringifyTo(context.local(),
+                              CompileRun("({toJSON() { throw 1; }})"), &sink)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -29794,6 +30085,123 @@ TEST(FastApiCallsString) {
         // defined(V8_ENABLE_TURBOFAN)
 }
 
+struct SeqTwoByteStringChecker {
+  static uint32_t FastCallback(v8::Local<v8::Object> receiver,
+                               const v8::FastTwoByteString& string) {
+    SeqTwoByteStringChecker* receiver_ptr =
+        GetInternalField<SeqTwoByteStringChecker>(*receiver);
+    receiver_ptr->result_ |= ApiCheckerResult::kFastCalled;
+    receiver_ptr->chars_.assign(string.data, string.data + string.length);
+    return string.length;
+  }
+
+  static void SlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Object* receiver_obj = v8::Object::Cast(*info.This());
+    SeqTwoByteStringChecker* receiver_ptr =
+        GetInternalField<SeqTwoByteStringChecker>(receiver_obj);
+    receiver_ptr->result_ |= ApiCheckerResult::kSlowCalled;
+    if (info[0]->IsString()) {
+      info.GetReturnValue().Set(info[0].As<v8::String>()->Length());
+    }
+  }
+
+  bool DidCallFast() const { return (result_ & ApiCheckerResult::kFastCalled); }
+  bool DidCallSlow() const { return (result_ & ApiCheckerResult::kSlowCalled); }
+
+  void Reset() {
+    result_ = ApiCheckerResult::kNotCalled;
+    chars_.clear();
+  }
+
+  ApiCheckerResultFlags result_ = ApiCheckerResult::kNotCalled;
+  std::vector<uint16_t> chars_;
+};
+
+TEST(FastApiCallsTwoByteString) {
+#if !defined(V8_LITE_MODE) &&                          \
+    !defined(V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS) && \
+    defined(V8_ENABLE_TURBOFAN)
+  if (i::v8_flags.jitless) return;
+  if (i::v8_flags.disable_optimizing_compilers) return;
+
+  i::v8_flags.turbofan = true;
+  i::v8_flags.turbo_fast_api_calls = true;
+  i::v8_flags.allow_natives_syntax = true;
+  // Disable --always_turbofan, otherwise we haven't generated the necessary
+  // feedback to go down the "best optimization" path for the fast call.
+  i::v8_flags.always_turbofan = false;
+  i::FlagList::EnforceFlagImplications();
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i_isolate->set_embedder_wrapper_type_index(kV8WrapperTypeIndex);
+  i_isolate->set_embedder_wrapper_object_index(kV8WrapperObjectIndex);
+
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  static v8::CFunction c_function =
+      v8::CFunction::Make(SeqTwoByteStringChecker::FastCallback);
+  v8::Local<v8::FunctionTemplate> checker_templ = v8::FunctionTemplate::New(
+      isolate, SeqTwoByteStringChecker::SlowCallback, {}, {}, 1,
+      v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasSideEffect,
+      &c_function);
+  v8::Local<v8::ObjectTemplate> object_template =
+      v8::ObjectTemplate::New(isolate);
+  object_template->SetInternalFieldCount(kV8WrapperObjectIndex + 1);
+  object_template->Set(isolate, "api_func", checker_templ);
+
+  SeqTwoByteStringChecker checker;
+  v8::Local<v8::Object> object =
+      object_template->NewInstance(env.local()).ToLocalChecked();
+  object->SetAlignedPointerInInternalField(kV8WrapperObjectIndex,
+                                           reinterpret_cast<void*>(&checker));
+  CHECK((*env)
+            ->Global()
+            ->Set(env.local(), v8_str("receiver"), object)
+            .FromJust());
+
+  v8::TryCatch try_catch(isolate);
+  CompileRun(
+      "function func(arg) { return receiver.api_func(arg); }"
+      "%PrepareFunctionForOptimization(func);"
+      "func('\\u{1F4A9}');"
+      "%OptimizeFunctionOnNextCall(func);");
+  CHECK(!try_catch.HasCaught());
+  CHECK(checker.DidCallSlow());
+  checker.Reset();
+
+  // A sequential two-byte string is passed as a view on its characters.
+  CHECK_EQ(3, CompileRun("func('\\u{1F4A9}z')")
+                  ->Int32Value(env.local())
+                  .FromJust());
+  CHECK(!try_catch.HasCaught());
+  CHECK(checker.DidCallFast());
+  CHECK_EQ(std::vector<uint16_t>({0xD83D, 0xDCA9, 'z'}), checker.chars_);
+  checker.Reset();
+
+  // One-byte strings, cons strings and non-strings take the slow path.
+  CompileRun("func('one byte')");
+  CHECK(checker.DidCallSlow());
+  CHECK(!checker.DidCallFast());
+  checker.Reset();
+
+  CompileRun(
+      "var prefix = '\\u{1F4A9}\\u{1F4A9}\\u{1F4A9}';"
+      "func(prefix + 'a long enough suffix')");
+  CHECK(checker.DidCallSlow());
+  CHECK(!checker.DidCallFast());
+  checker.Reset();
+
+  CompileRun("func(42)");
+  CHECK(checker.DidCallSlow());
+  CHECK(!checker.DidCallFast());
+#endif  // !defined(V8_LITE_MODE) &&
+        // !defined(V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS) &&
+        // defined(V8_ENABLE_TURBOFAN)
+}
+
 #if V8_ENABLE_WEBASSEMBLY
 TEST(FastApiCallsFromWasm) {
   if (i::v8_flags.jitless) return;
@@ -30025,6 +30433,152 @@ TEST(TriggerThreadSafeMetricsEvent) {
   CHECK_EQ(recorder->module_count_, 42);
 }
 
+namespace {
+
+class GCDetailsRecorder : public v8::metrics::Recorder {
+ public:
+  void AddThreadSafeEvent(
+      const v8::metrics::GarbageCollectionCycleDetails& event) override {
+    v8::base::MutexGuard guard(&mutex_);
+    if (event.is_young_generation) return;
+    last_full_cycle_ = event;
+    full_cycles_++;
+  }
+
+  size_t full_cycles() {
+    v8::base::MutexGuard guard(&mutex_);
+    return full_cycles_;
+  }
+
+  v8::metrics::GarbageCollectionCycleDetails last_full_cycle() {
+    v8::base::MutexGuard guard(&mutex_);
+    return last_full_cycle_;
+  }
+
+ private:
+  v8::base::Mutex mutex_;
+  size_t full_cycles_ = 0;
+  v8::metrics::GarbageCollectionCycleDetails last_full_cycle_;
+};
+
+}  // namespace
+
+TEST(GarbageCollectionCycleDetailsMetricsEvent) {
+  i::v8_flags.stress_concurrent_allocation = false;
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<GCDetailsRecorder> recorder =
+      std::make_shared<GCDetailsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  i::heap::InvokeAtomicMajorGC(CcTest::heap());
+  i::heap::InvokeAtomicMajorGC(CcTest::heap());
+
+  // The event is reported from a worker thread.
+  for (int i = 0; i < 1000 && recorder->full_cycles() < 2; i++) {
+    v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(10));
+  }
+  CHECK_EQ(2, recorder->full_cycles());
+
+  v8::metrics::GarbageCollectionCycleDetails event =
+      recorder->last_full_cycle();
+  CHECK_GE(event.pause_wall_clock_duration_in_us, 0);
+  CHECK_GE(event.time_to_safepoint_in_us, 0);
+  CHECK_GE(event.background_wall_clock_duration_in_us, 0);
+  CHECK_GE(event.concurrency_estimate, 1);
+  CHECK_GE(event.bytes_promoted, 0);
+  CHECK(!event.phases.empty());
+  bool has_mark_phase = false;
+  for (const auto& phase : event.phases) {
+    CHECK_NOT_NULL(phase.name);
+    CHECK_GE(phase.wall_clock_duration_in_us, 0);
+    if (strcmp(phase.name, "V8.GC_MC_MARK") == 0) has_mark_phase = true;
+  }
+  CHECK(has_mark_phase);
+  bool has_old_space = false;
+  for (const auto& space : event.spaces) {
+    CHECK_NOT_NULL(space.name);
+    CHECK_EQ(space.bytes_before - space.bytes_after, space.bytes_freed);
+    if (strcmp(space.name, "old_space") == 0) has_old_space = true;
+  }
+  CHECK(has_old_space);
+}
+
+namespace {
+
+class JitTransitionsRecorder : public v8::metrics::Recorder {
+ public:
+  void AddThreadSafeEvent(const v8::metrics::JitTransitions& event) override {
+    v8::base::MutexGuard guard(&mutex_);
+    for (const auto& deopt : event.deoptimizations) {
+      if (deopt.function_name == "deopt") deopts_ += deopt.count;
+    }
+    for (const auto& transition : event.megamorphic_transitions) {
+      if (transition.function_name == "mega") {
+        CHECK_GE(transition.feedback_slot, 0);
+        CHECK_NOT_NULL(transition.ic_kind);
+        megamorphic_transitions_ += transition.count;
+      }
+    }
+  }
+
+  uint64_t deopts() {
+    v8::base::MutexGuard guard(&mutex_);
+    return deopts_;
+  }
+
+  uint64_t megamorphic_transitions() {
+    v8::base::MutexGuard guard(&mutex_);
+    return megamorphic_transitions_;
+  }
+
+ private:
+  v8::base::Mutex mutex_;
+  uint64_t deopts_ = 0;
+  uint64_t megamorphic_transitions_ = 0;
+};
+
+}  // namespace
+
+TEST(JitTransitionsMetricsEvent) {
+  if (i::v8_flags.lite_mode) return;
+  i::v8_flags.allow_natives_syntax = true;
+  // Report every transition right away.
+  i::v8_flags.jit_transitions_report_interval = 0;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  std::shared_ptr<JitTransitionsRecorder> recorder =
+      std::make_shared<JitTransitionsRecorder>();
+  isolate->SetMetricsRecorder(recorder);
+
+  bool optimized =
+      CompileRun(
+          "function deopt(o) { return o.x; }"
+          "%PrepareFunctionForOptimization(deopt);"
+          "deopt({x: 1});"
+          "deopt({x: 1});"
+          "%OptimizeFunctionOnNextCall(deopt);"
+          "deopt({x: 1});"
+          "var optimized = %ActiveTierIsTurbofan(deopt) ||"
+          "                %ActiveTierIsMaglev(deopt);"
+          "deopt({y: 1, x: 2});"
+          "optimized;")
+          ->BooleanValue(isolate);
+  CompileRun(
+      "function mega(o) { return o.x; }"
+      "%EnsureFeedbackVectorForFunction(mega);"
+      "for (let i = 0; i < 10; i++) mega({['p' + i]: i, x: i});");
+
+  // Events are reported from a worker thread.
+  for (int i = 0; i < 1000 && (recorder->megamorphic_transitions() == 0 ||
+                               (optimized && recorder->deopts() == 0));
+       i++) {
+    v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(10));
+  }
+  CHECK_EQ(1, recorder->megamorphic_transitions());
+  if (optimized) CHECK_LE(1, recorder->deopts());
+}
+
 void SetupCodeLike(LocalContext* env, const char* name,
                    v8::Local<v8::FunctionTemplate> to_string,
                    bool is_code_like) {
@@ -29,6 +29,7 @@
 
 #include <limits>
 #include <memory>
+#include <unordered_set>
 
 #include "include/libplatform/v8-tracing.h"
 #include "include/v8-fast-api-calls.h"
@@ -3708,6 +3709,50 @@ TEST(SampleLimit) {
   CHECK_EQ(profile->GetSamplesCount(), 50);
 }
 
+// Tests that chunks taken from a running profile hand out every node and
+// sample once, and drop the samples from the profile.
+TEST(TakeProfileChunk) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  InstallCollectSampleFunction(env.local());
+  CompileRun("function start() { CallCollectSample(); }");
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(isolate);
+  const unsigned kMaxSamples = 10;
+  v8::CpuProfilingResult result = profiler->Start(
+      v8::CpuProfilingOptions(v8::kLeafNodeLineNumbers, kMaxSamples));
+  CHECK_EQ(v8::CpuProfilingStatus::kStarted, result.status);
+
+  // Taking chunks regularly allows collecting more samples than the limit.
+  std::unordered_set<unsigned> node_ids;
+  size_t taken_samples = 0;
+  v8::CpuProfileChunk chunk;
+  while (taken_samples < 3 * kMaxSamples) {
+    function->Call(env.local(), env->Global(), 0, nullptr).ToLocalChecked();
+    CHECK(profiler->TakeProfileChunk(result.id, &chunk));
+    for (const v8::CpuProfileNode* node : chunk.nodes) {
+      // Parents are handed out before their children.
+      if (node->GetParent()) {
+        CHECK(node_ids.contains(node->GetParent()->GetNodeId()));
+      }
+      CHECK(node_ids.insert(node->GetNodeId()).second);
+    }
+    CHECK_EQ(chunk.samples.size(), chunk.timestamps.size());
+    for (const v8::CpuProfileNode* sample : chunk.samples) {
+      CHECK(node_ids.contains(sample->GetNodeId()));
+    }
+    taken_samples += chunk.samples.size();
+  }
+
+  v8::CpuProfile* profile = profiler->Stop(result.id);
+  CHECK_GE(static_cast<int>(kMaxSamples), profile->GetSamplesCount());
+  CHECK(!profiler->TakeProfileChunk(result.id, &chunk));
+  profile->Delete();
+  profiler->Dispose();
+}
+
 // Tests that a CpuProfile instance subsamples from a stream of tick samples
 // appropriately.
 TEST(ProflilerSubsampling) {
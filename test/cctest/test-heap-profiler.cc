@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "include/v8-function.h"
@@ -1323,6 +1324,206 @@ TEST(HeapSnapshotJSONSerializationAborting) {
 
 namespace {
 
+struct BinarySnapshot {
+  struct Node {
+    int type;
+    uint64_t name;
+    uint64_t id;
+    uint64_t self_size;
+  };
+  struct Edge {
+    int type;
+    uint64_t name_or_index;
+    uint64_t from;
+    uint64_t to;
+  };
+
+  std::vector<std::string> strings;
+  std::vector<Node> nodes;
+  std::vector<Edge> edges;
+  size_t locations = 0;
+
+  const Node* FindNode(int type, const char* name) const {
+    for (const Node& node : nodes) {
+      if (node.type == type && strings[node.name] == name) return &node;
+    }
+    return nullptr;
+  }
+
+  const Edge* FindEdge(const Node* from, int type, const char* name) const {
+    const uint64_t from_index = static_cast<uint64_t>(from - nodes.data());
+    for (const Edge& edge : edges) {
+      if (edge.from == from_index && edge.type == type &&
+          strings[edge.name_or_index] == name) {
+        return &edge;
+      }
+    }
+    return nullptr;
+  }
+};
+
+// Parses and validates a snapshot in the v8::HeapSnapshot::kBinary format.
+BinarySnapshot ParseBinarySnapshot(v8::internal::TestJSONStream* stream) {
+  v8::base::ScopedVector<char> data(stream->size());
+  stream->WriteTo(data);
+  const uint8_t* pos = reinterpret_cast<const uint8_t*>(data.begin());
+  const uint8_t* end = pos + data.length();
+  auto read_varint = [&]() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos, end);
+      const uint8_t byte = *pos++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  };
+
+  CHECK_LE(4, end - pos);
+  CHECK_EQ(0, memcmp(pos, "V8HS", 4));
+  pos += 4;
+  CHECK_EQ(1u, read_varint());
+
+  BinarySnapshot snapshot;
+  while (true) {
+    CHECK_LT(pos, end);
+    const uint8_t tag = *pos++;
+    if (tag == 0) break;
+    switch (tag) {
+      case 1: {
+        const uint64_t length = read_varint();
+        CHECK_LE(length, static_cast<uint64_t>(end - pos));
+        snapshot.strings.emplace_back(reinterpret_cast<const char*>(pos),
+                                      length);
+        pos += length;
+        break;
+      }
+      case 2: {
+        BinarySnapshot::Edge edge;
+        edge.type = static_cast<int>(read_varint());
+        edge.name_or_index = read_varint();
+        edge.from = read_varint();
+        edge.to = read_varint();
+        // Edges must precede nodes.
+        CHECK(snapshot.nodes.empty());
+        if (edge.type != v8::HeapGraphEdge::kElement &&
+            edge.type != v8::HeapGraphEdge::kHidden) {
+          CHECK_LT(edge.name_or_index, snapshot.strings.size());
+        }
+        snapshot.edges.push_back(edge);
+        break;
+      }
+      case 3: {
+        BinarySnapshot::Node node;
+        node.type = static_cast<int>(read_varint());
+        node.name = read_varint();
+        node.id = read_varint();
+        node.self_size = read_varint();
+        read_varint();  // trace_node_id
+        read_varint();  // detachedness
+        CHECK_LT(node.name, snapshot.strings.size());
+        snapshot.nodes.push_back(node);
+        break;
+      }
+      case 4: {
+        CHECK_LT(read_varint(), snapshot.nodes.size());
+        read_varint();  // script_id
+        read_varint();  // line
+        read_varint();  // column
+        snapshot.locations++;
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+  CHECK_EQ(pos, end);
+  for (const BinarySnapshot::Edge& edge : snapshot.edges) {
+    CHECK_LT(edge.from, snapshot.nodes.size());
+    CHECK_LT(edge.to, snapshot.nodes.size());
+  }
+  return snapshot;
+}
+
+void CheckBinarySnapshotContainsAB(const BinarySnapshot& snapshot) {
+  const BinarySnapshot::Node* b =
+      snapshot.FindNode(v8::HeapGraphNode::kObject, "B");
+  CHECK_NOT_NULL(b);
+  const BinarySnapshot::Edge* x =
+      snapshot.FindEdge(b, v8::HeapGraphEdge::kProperty, "x");
+  CHECK_NOT_NULL(x);
+  const BinarySnapshot::Node& a = snapshot.nodes[x->to];
+  CHECK_EQ(v8::HeapGraphNode::kObject, a.type);
+  CHECK(snapshot.strings[a.name] == "A");
+  const BinarySnapshot::Edge* s =
+      snapshot.FindEdge(&a, v8::HeapGraphEdge::kProperty, "s");
+  CHECK_NOT_NULL(s);
+  CHECK_EQ(v8::HeapGraphNode::kString, snapshot.nodes[s->to].type);
+  CHECK(snapshot.strings[snapshot.nodes[s->to].name] == "binary snapshot");
+}
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "function B(x) { this.x = x; }\n"
+      "var a = new A('binary snapshot');\n"
+      "var b = new B(a);");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  v8::internal::TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, stream.eos_signaled());
+  BinarySnapshot parsed = ParseBinarySnapshot(&stream);
+
+  CHECK_EQ(static_cast<size_t>(snapshot->GetNodesCount()), parsed.nodes.size());
+  size_t edge_count = 0;
+  for (int i = 0; i < snapshot->GetNodesCount(); ++i) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    CHECK_EQ(node->GetId(), parsed.nodes[i].id);
+    edge_count += node->GetChildrenCount();
+  }
+  CHECK_EQ(edge_count, parsed.edges.size());
+  CheckBinarySnapshotContainsAB(parsed);
+}
+
+TEST(HeapSnapshotStreaming) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "function B(x) { this.x = x; }\n"
+      "var a = new A('binary snapshot');\n"
+      "var b = new B(a);");
+  const int snapshot_count = heap_profiler->GetSnapshotCount();
+
+  v8::internal::TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_EQ(1, stream.eos_signaled());
+  // Streamed snapshots are not retained.
+  CHECK_EQ(snapshot_count, heap_profiler->GetSnapshotCount());
+  BinarySnapshot parsed = ParseBinarySnapshot(&stream);
+  CHECK_EQ(v8::HeapGraphNode::kSynthetic, parsed.nodes[0].type);
+  CheckBinarySnapshotContainsAB(parsed);
+}
+
+TEST(HeapSnapshotStreamingAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  v8::internal::TestJSONStream stream(5);
+  CHECK(!heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
+namespace {
+
 class TestStatsStream : public v8::OutputStream {
  public:
   TestStatsStream()
@@ -4018,6 +4219,50 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerAllocationSiteAndSurvival) {
+  i::v8_flags.allow_natives_syntax = true;
+  CcTest::InitializeVM();
+  if (i::v8_flags.single_generation) return;
+
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(256);
+
+  CompileRun(
+      "%NeverOptimizeFunction(allocate);\n"
+      "var kept = [];\n"
+      "function allocate() {\n"
+      "  for (var i = 0; i < 1024; ++i) kept.push({a: i, b: i});\n"
+      "}\n"
+      "allocate();\n");
+  // A full GC promotes the surviving objects to the old generation.
+  i::heap::InvokeMajorGC(CcTest::heap());
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  const char* names[] = {"", "allocate"};
+  auto node = FindAllocationProfileNode(env->GetIsolate(), profile.get(),
+                                        v8::base::ArrayVector(names));
+  CHECK(node);
+
+  // The interpreted frame reports where it allocated.
+  bool found_old_sample = false;
+  for (auto& sample : profile->GetSamples()) {
+    if (sample.node_id != node->node_id) continue;
+    CHECK_NE(v8::AllocationProfile::kNoBytecodeOffset, sample.bytecode_offset);
+    found_old_sample |= sample.in_old_generation;
+  }
+  CHECK(found_old_sample);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
@@ -53,6 +53,8 @@
 #include "src/heap/safepoint.h"
 #include "src/heap/spaces.h"
 #include "src/numbers/hash-seed-inl.h"
+#include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
@@ -484,6 +486,28 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   shared_space_blob.Dispose();
   context_blob.Dispose();
 }
+
+UNINITIALIZED_TEST(SnapshotCompressionMultipleChunks) {
+  // Payloads spanning several chunks, including a partial last chunk.
+  for (uint32_t size : {i::SnapshotCompression::kChunkSize,
+                        3 * i::SnapshotCompression::kChunkSize + 17}) {
+    std::vector<uint8_t> payload(size);
+    for (uint32_t i = 0; i < size; ++i) {
+      payload[i] = static_cast<uint8_t>((i * 7919) >> 5);
+    }
+    base::Vector<const uint8_t> payload_vector(payload.data(), size);
+    SnapshotData original_snapshot_data(payload_vector);
+    SnapshotData compressed =
+        i::SnapshotCompression::Compress(&original_snapshot_data);
+    for (bool parallel : {false, true}) {
+      FlagScope<bool> parallel_decompression(
+          &i::v8_flags.parallel_snapshot_decompression, parallel);
+      SnapshotData decompressed =
+          i::SnapshotCompression::Decompress(compressed.RawData());
+      CHECK_EQ(payload_vector, decompressed.RawData());
+    }
+  }
+}
 #endif  // SNAPSHOT_COMPRESSION
 
 UNINITIALIZED_TEST(ContextSerializerContext) {
@@ -800,6 +824,71 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlob1) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(CustomSnapshotDataBlobColdFunctionsLast) {
+  DisableAlwaysOpt();
+  FlagScope<bool> serialize_cold_functions_last(
+      &v8_flags.serialize_cold_functions_last, true);
+  // f runs while the snapshot is created, g and h do not.
+  const char* source1 =
+      "function f() { return 1; }"
+      "function g() { return f() + 1; }"
+      "function h() { return (() => g() + 1)(); }"
+      "f();";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData data1 = CreateSnapshotDataBlob(source1);
+
+  v8::Isolate::CreateParams params1;
+  params1.snapshot_blob = &data1;
+  params1.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  v8::Isolate* isolate1 = TestSerializer::NewIsolate(params1);
+  {
+    v8::Isolate::Scope i_scope(isolate1);
+    v8::HandleScope h_scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope c_scope(context);
+    v8::Maybe<int32_t> result =
+        CompileRun("f() + g() + h()")->Int32Value(context);
+    CHECK_EQ(6, result.FromJust());
+  }
+  isolate1->Dispose();
+  delete[] data1.data;  // We can dispose of the snapshot blob now.
+  FreeCurrentEmbeddedBlob();
+}
+
+UNINITIALIZED_TEST(CustomSnapshotDataBlobContextSnapshotCache) {
+  DisableAlwaysOpt();
+  FlagScope<bool> cache_context_snapshots(&v8_flags.cache_context_snapshots,
+                                          true);
+  const char* source1 = "var x = 0; function f() { return ++x; }";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData data1 = CreateSnapshotDataBlob(source1);
+
+  v8::Isolate::CreateParams params1;
+  params1.snapshot_blob = &data1;
+  params1.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Every context created from the cached snapshot starts out fresh.
+  v8::Isolate* isolate1 = TestSerializer::NewIsolate(params1);
+  {
+    v8::Isolate::Scope i_scope(isolate1);
+    for (int i = 0; i < 3; ++i) {
+      v8::HandleScope h_scope(isolate1);
+      v8::Local<v8::Context> context = v8::Context::New(isolate1);
+      v8::Context::Scope c_scope(context);
+      CompileRun("f()");
+      v8::Maybe<int32_t> result =
+          CompileRun("f()")->Int32Value(isolate1->GetCurrentContext());
+      CHECK_EQ(2, result.FromJust());
+    }
+  }
+  isolate1->Dispose();
+  delete[] data1.data;  // We can dispose of the snapshot blob now.
+  FreeCurrentEmbeddedBlob();
+}
+
 static void UnreachableCallback(const FunctionCallbackInfo<Value>& info) {
   UNREACHABLE();
 }
@@ -1857,6 +1946,50 @@ void TestCodeSerializerOnePlusOneImpl(bool verify_builtins_count = true) {
 
 TEST(CodeSerializerOnePlusOne) { TestCodeSerializerOnePlusOneImpl(); }
 
+TEST(CodeSerializerTieringDecisions) {
+  v8_flags.code_cache_tiering_decisions = true;
+  v8_flags.profile_guided_optimization = true;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source = "1 + 1";
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+
+  ScriptDetails default_script_details;
+  ScriptCompiler::CompilationDetails compilation_details;
+  DirectHandle<SharedFunctionInfo> orig =
+      Compiler::GetSharedFunctionInfoForScript(
+          isolate, orig_source, default_script_details,
+          v8::ScriptCompiler::kNoCompileOptions,
+          ScriptCompiler::kNoCacheNoReason, NOT_NATIVES_CODE,
+          &compilation_details)
+          .ToHandleChecked();
+  orig->set_cached_tiering_decision(CachedTieringDecision::kEarlyTurbofan);
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateCodeCache(ToApiHandle<UnboundScript>(orig)));
+  AlignedCachedData cache(cached_data->data, cached_data->length);
+
+  DirectHandle<SharedFunctionInfo> copy;
+  {
+    DisallowCompilation no_compile_expected(isolate);
+    copy = CompileScript(isolate, copy_source, default_script_details, &cache,
+                         v8::ScriptCompiler::kConsumeCodeCache);
+  }
+  CHECK_NE(*orig, *copy);
+  CHECK_EQ(copy->cached_tiering_decision(),
+           CachedTieringDecision::kEarlyTurbofan);
+}
+
 // See bug v8:9122
 TEST(CodeSerializerOnePlusOneWithInterpretedFramesNativeStack) {
   v8_flags.interpreted_frames_native_stack = true;
@@ -2945,6 +3078,37 @@ v8::ScriptCompiler::CachedData* CompileRunAndProduceCache(
   return cache;
 }
 
+TEST(CodeSerializerReuseUnchangedCodeCache) {
+  FlagScope<bool> reuse_unchanged_code_cache(
+      &v8_flags.reuse_unchanged_code_cache, true);
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::ScriptCompiler::Source source(
+      v8_str("function f() { return 1; }; function g() { return 2; }; f()"));
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(
+          isolate, &source, v8::ScriptCompiler::kNoCompileOptions)
+          .ToLocalChecked();
+  script->BindToCurrentContext()->Run(env.local()).ToLocalChecked();
+
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+      v8::ScriptCompiler::CreateCodeCache(script));
+  std::unique_ptr<v8::ScriptCompiler::CachedData> unchanged(
+      v8::ScriptCompiler::CreateCodeCache(script));
+  CHECK_EQ(cache->length, unchanged->length);
+  CHECK_EQ(0, memcmp(cache->data, unchanged->data, cache->length));
+
+  // Compiling g changes the cache.
+  CompileRun("g()");
+  std::unique_ptr<v8::ScriptCompiler::CachedData> refreshed(
+      v8::ScriptCompiler::CreateCodeCache(script));
+  CHECK_LE(cache->length, refreshed->length);
+  CHECK(cache->length != refreshed->length ||
+        memcmp(cache->data, refreshed->data, cache->length) != 0);
+}
+
 TEST(CodeSerializerIsolates) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -2984,6 +3148,144 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+TEST(ProcessWideScriptCacheIsolates) {
+  v8_flags.process_wide_script_cache = true;
+  const char* js_source = "function f() { return 'abc'; }; f() + 'ghi'";
+  {
+    LocalContext env;
+    v8::HandleScope scope(CcTest::isolate());
+    CHECK(CompileRun(js_source)
+              ->Equals(env.local(), v8_str("abcghi"))
+              .FromJust());
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::Script> script;
+    {
+      // The script is deserialized from the cache of the first isolate.
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::Script::Compile(context, v8_str(js_source)).ToLocalChecked();
+    }
+    CHECK(script->Run(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcghi"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerCompileHints) {
+  v8_flags.code_cache_compile_hints = true;
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    // The lazy compilation of f is recorded in the cache.
+    std::vector<int> hints = script->BindToCurrentContext()
+                                 ->GetCompileHintsCollector()
+                                 ->GetCompileHints(isolate2);
+    CHECK_EQ(hints.size(), 1u);
+  }
+  isolate2->Dispose();
+}
+
+namespace {
+
+// Returns the AllocationSite of the only literal in the global function
+// {name}.
+Tagged<AllocationSite> LiteralAllocationSite(v8::Local<v8::Context> context,
+                                             const char* name) {
+  v8::Local<v8::Value> fun =
+      context->Global()->Get(context, v8_str(name)).ToLocalChecked();
+  auto js_function = Cast<JSFunction>(Utils::OpenDirectHandle(*fun));
+  Tagged<FeedbackVector> vector = js_function->feedback_vector();
+  for (int i = 0; i < vector->length(); i++) {
+    Tagged<HeapObject> object;
+    if (vector->Get(FeedbackSlot(i)).GetHeapObjectIfStrong(&object) &&
+        IsAllocationSite(object)) {
+      return Cast<AllocationSite>(object);
+    }
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+TEST(CodeSerializerPretenuringDecisions) {
+  v8_flags.code_cache_pretenuring_decisions = true;
+  v8_flags.lazy_feedback_allocation = false;
+  const char* js_source = "function f() { return [1, 2, 3]; }; f(); f();";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    // Stands in for the survival feedback of a long-running process.
+    LiteralAllocationSite(context, "f")
+        ->set_pretenure_decision(AllocationSite::kTenure);
+    cache = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    // The new allocation site starts out pretenured.
+    CHECK_EQ(AllocationSite::kTenure,
+             LiteralAllocationSite(context, "f")->pretenure_decision());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* js_source =
       "function f() {"
@@ -27,6 +27,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "src/api/api-inl.h"
@@ -34,6 +35,7 @@
 #include "src/numbers/conversions.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/collector.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -187,6 +189,37 @@ TEST(MemMove) {
   delete[] area2;
 }
 
+TEST(MemCopyNonTemporal) {
+  static const int kCopyAreaSize = 4096 + 128;
+  static const int kMaxOffset = 40;
+  const int kLengths[] = {0, 1, 255, 256, 257, 319, 320, 321, 1000, 4096};
+  std::vector<uint8_t> src(kCopyAreaSize);
+  std::vector<uint8_t> dst(kCopyAreaSize);
+  for (int i = 0; i < kCopyAreaSize; i++) src[i] = (i * 7) & 0xFF;
+
+  {
+    // Make all copies of at least 256 bytes take the non-temporal path.
+    FLAG_VALUE_SCOPE(non_temporal_memcopy_threshold, size_t{256});
+    init_memcopy_functions();
+    for (int src_offset = 0; src_offset <= kMaxOffset; src_offset++) {
+      for (int dst_offset = 0; dst_offset <= kMaxOffset; dst_offset++) {
+        for (int length : kLengths) {
+          std::fill(dst.begin(), dst.end(), 0xAB);
+          MemCopyNonTemporal(dst.data() + dst_offset, src.data() + src_offset,
+                             length);
+          for (int i = 0; i < kCopyAreaSize; i++) {
+            bool copied = i >= dst_offset && i < dst_offset + length;
+            uint8_t expected =
+                copied ? src[i - dst_offset + src_offset] : uint8_t{0xAB};
+            CHECK_EQ(expected, dst[i]);
+          }
+        }
+      }
+    }
+  }
+  init_memcopy_functions();
+}
+
 TEST(Collector) {
   Collector<int> collector(8);
   const int kLoops = 5;
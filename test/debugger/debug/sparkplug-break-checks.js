@@ -0,0 +1,60 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --sparkplug-break-checks --allow-natives-syntax
+// Flags: --no-always-sparkplug
+
+var Debug = debug.Debug;
+var break_count = 0;
+var clear_on_break = false;
+var exception = null;
+var bp;
+
+function listener(event, exec_state, event_data, data) {
+  if (event != Debug.DebugEvent.Break) return;
+  try {
+    assertTrue(exec_state.frame().sourceLineText().includes('Break'));
+    break_count++;
+    if (clear_on_break) Debug.clearBreakPoint(bp);
+  } catch (e) {
+    exception = e;
+    print(e);
+  }
+}
+
+function f(x) {
+  let y = x + 1;
+  return y * 2;  // Break
+}
+
+Debug.setListener(listener);
+
+// A function with a break point is compiled with break checks.
+bp = Debug.setBreakPoint(f, 2);
+%CompileBaseline(f);
+assertTrue(%ActiveTierIsSparkplug(f));
+assertEquals(4, f(1));
+assertEquals(1, break_count);
+
+// A conditional break point that doesn't hold only costs the check.
+Debug.clearBreakPoint(bp);
+bp = Debug.setBreakPoint(f, 2, 0, 'x == 5');
+%CompileBaseline(f);
+for (let i = 0; i < 10; i++) assertEquals((i + 1) * 2, f(i));
+assertEquals(2, break_count);
+
+// Clearing the last break point while paused at it discards the baseline code,
+// and the frame continues in the interpreter at the bytecode of the break.
+Debug.clearBreakPoint(bp);
+bp = Debug.setBreakPoint(f, 2);
+%CompileBaseline(f);
+assertTrue(%ActiveTierIsSparkplug(f));
+clear_on_break = true;
+assertEquals(8, f(3));
+assertEquals(3, break_count);
+assertEquals(10, f(4));
+assertEquals(3, break_count);
+
+Debug.setListener(null);
+assertNull(exception);
@@ -0,0 +1,49 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that takeHeapSnapshot can send the snapshot in the binary format.');
+
+contextGroup.addScript(`
+class BinarySnapshotMarker {}
+var marker = new BinarySnapshotMarker();
+//# sourceURL=test.js`);
+
+InspectorTest.runAsyncTestSuite([
+  async function testBinaryFormat() {
+    await Protocol.HeapProfiler.enable();
+    const chunks = [];
+    let jsonChunks = 0;
+    Protocol.HeapProfiler.onAddHeapSnapshotBinaryChunk(message => {
+      chunks.push(InspectorTest.decodeBase64(message.params.chunk));
+    });
+    Protocol.HeapProfiler.onAddHeapSnapshotChunk(() => ++jsonChunks);
+    await Protocol.HeapProfiler.takeHeapSnapshot({format: 'binary'});
+    let length = 0;
+    for (const chunk of chunks) length += chunk.length;
+    const bytes = new Uint8Array(length);
+    let offset = 0;
+    for (const chunk of chunks) {
+      bytes.set(chunk, offset);
+      offset += chunk.length;
+    }
+    let text = '';
+    for (const byte of bytes) text += String.fromCharCode(byte);
+    InspectorTest.log(`Magic: ${text.substring(0, 4)}`);
+    InspectorTest.log(`Version: ${bytes[4]}`);
+    InspectorTest.log(`Ends with end record: ${bytes[bytes.length - 1] === 0}`);
+    InspectorTest.log(
+        `Contains marker: ${text.includes('BinarySnapshotMarker')}`);
+    InspectorTest.log(`JSON chunks: ${jsonChunks}`);
+    await Protocol.HeapProfiler.disable();
+  },
+
+  async function testUnknownFormat() {
+    await Protocol.HeapProfiler.enable();
+    const {error} = await Protocol.HeapProfiler.takeHeapSnapshot(
+        {format: 'protobuf'});
+    InspectorTest.log(error.message);
+    await Protocol.HeapProfiler.disable();
+  }
+]);
@@ -0,0 +1,60 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString and friends cache ICU formatters for the most recently
+// used locales, and collators are cloned from a shared cache. Alternating
+// between locales and options must keep producing the uncached results.
+
+const locales = ['en', 'de', 'fr', 'ja', 'ar', 'hi', 'en', 'de'];
+const number = 1234567.891;
+const date = new Date(Date.UTC(2020, 5, 15, 12, 30));
+const strings = ['a10', 'A2', 'a2', 'b1', 'ä'];
+
+for (let round = 0; round < 3; ++round) {
+  for (const locale of locales) {
+    assertEquals(new Intl.NumberFormat(locale).format(number),
+                 number.toLocaleString(locale));
+    assertEquals(new Intl.DateTimeFormat(locale).format(date),
+                 date.toLocaleDateString(locale));
+    assertEquals(
+        new Intl.DateTimeFormat(locale, {
+          year: 'numeric', month: 'numeric', day: 'numeric',
+          hour: 'numeric', minute: 'numeric', second: 'numeric'
+        }).format(date),
+        date.toLocaleString(locale));
+    const collator = new Intl.Collator(locale);
+    for (const a of strings) {
+      for (const b of strings) {
+        assertEquals(collator.compare(a, b), a.localeCompare(b, locale));
+      }
+    }
+  }
+}
+
+// Options applied to one collator do not leak into others created for the
+// same locale.
+{
+  const numeric = new Intl.Collator('en', {numeric: true});
+  const upper = new Intl.Collator('en', {caseFirst: 'upper'});
+  const plain = new Intl.Collator('en');
+  assertEquals(['a2', 'a10'], ['a10', 'a2'].sort(numeric.compare));
+  assertEquals(['a10', 'a2'], ['a10', 'a2'].sort(plain.compare));
+  assertEquals(['A2', 'a2'], ['a2', 'A2'].sort(upper.compare));
+  assertEquals(['a2', 'A2'], ['a2', 'A2'].sort(plain.compare));
+  assertTrue(numeric.resolvedOptions().numeric);
+  assertFalse(plain.resolvedOptions().numeric);
+  assertEquals('upper', upper.resolvedOptions().caseFirst);
+  assertEquals('false', plain.resolvedOptions().caseFirst);
+  assertEquals('en', plain.resolvedOptions().locale);
+}
+
+// Collation extensions are part of the cache key.
+{
+  const phonebook = new Intl.Collator('de-u-co-phonebk');
+  const standard = new Intl.Collator('de');
+  assertEquals('phonebk', phonebook.resolvedOptions().collation);
+  assertEquals('default', standard.resolvedOptions().collation);
+  assertEquals(1, phonebook.compare('ä', 'ad'));
+  assertEquals(-1, standard.compare('ä', 'ad'));
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --harmony-temporal
+
+const kHour = 3600n * 1000000000n;
+
+function offset(id, iso) {
+  return new Temporal.TimeZone(id).getOffsetNanosecondsFor(
+      Temporal.Instant.from(iso));
+}
+
+function check() {
+  assertEquals(Number(-5n * kHour), offset("America/New_York",
+                                           "2021-01-01T00:00Z"));
+  assertEquals(Number(-4n * kHour), offset("America/New_York",
+                                           "2021-07-01T00:00Z"));
+  assertEquals(Number(1n * kHour),
+               offset("Europe/Berlin", "2021-01-01T00:00Z"));
+  assertEquals(Number(2n * kHour),
+               offset("Europe/Berlin", "2021-07-01T00:00Z"));
+  assertEquals(Number(9n * kHour), offset("Asia/Tokyo", "2021-07-01T00:00Z"));
+  assertEquals(Number(-5n * kHour), new Temporal.TimeZone("America/New_York")
+      .getOffsetNanosecondsFor(Temporal.Instant.fromEpochNanoseconds(-1n)));
+
+  const ny = new Temporal.TimeZone("America/New_York");
+  assertEquals("2021-03-14T07:00:00Z",
+      ny.getNextTransition(Temporal.Instant.from("2021-01-01T00:00Z"))
+          .toString());
+  assertEquals("2020-11-01T06:00:00Z",
+      ny.getPreviousTransition(Temporal.Instant.from("2021-01-01T00:00Z"))
+          .toString());
+  assertEquals("2020-11-01T06:00:00Z",
+      ny.getPreviousTransition(
+          Temporal.Instant.from("2020-11-01T06:00:00.000000001Z")).toString());
+  assertEquals("2020-03-08T07:00:00Z",
+      ny.getPreviousTransition(Temporal.Instant.from("2020-11-01T06:00Z"))
+          .toString());
+  assertEquals(2, ny.getPossibleInstantsFor(
+      Temporal.PlainDateTime.from("2020-11-01T01:30")).length);
+  assertEquals(0, ny.getPossibleInstantsFor(
+      Temporal.PlainDateTime.from("2021-03-14T02:30")).length);
+}
+
+check();
+
+// Use more time zones than are kept in the cache of the isolate and check
+// the results again afterwards.
+const kIds = [
+  "Africa/Cairo", "America/Chicago", "America/Sao_Paulo", "Asia/Kolkata",
+  "Asia/Shanghai", "Australia/Sydney", "Europe/London", "Europe/Moscow",
+  "Pacific/Auckland", "Pacific/Honolulu",
+];
+for (const id of kIds) {
+  const tz = new Temporal.TimeZone(id);
+  assertEquals(id, tz.id);
+  assertEquals("number", typeof tz.getOffsetNanosecondsFor(
+      Temporal.Instant.from("2021-01-01T00:00Z")));
+}
+check();
@@ -0,0 +1,33 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Many independent async functions awaiting in lockstep, so that the
+// microtask queue is filled with long runs of promise reaction jobs.
+
+new BenchmarkSuite('ReactionJobs', [1000], [
+  new Benchmark('ManyAwaits', false, false, 0, ManyAwaits, SetupReactionJobs),
+]);
+
+const kNumTasks = 100;
+const kNumAwaits = 10;
+let reactionJobsResult;
+
+async function ReactionJobsTask(value) {
+  for (let i = 0; i < kNumAwaits; ++i) {
+    value = await value + 1;
+  }
+  return value;
+}
+
+function SetupReactionJobs() {
+  reactionJobsResult = 0;
+  %PerformMicrotaskCheckpoint();
+}
+
+function ManyAwaits() {
+  for (let i = 0; i < kNumTasks; ++i) {
+    ReactionJobsTask(i).then(value => { reactionJobsResult += value; });
+  }
+  %PerformMicrotaskCheckpoint();
+}
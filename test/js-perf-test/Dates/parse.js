@@ -0,0 +1,25 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+const kDateCount = 100;
+const isoStrings = [];
+const utcStrings = [];
+const legacyStrings = [];
+for (let i = 0; i < kDateCount; i++) {
+  const d = new Date(1e12 + i * 86400123);
+  isoStrings.push(d.toISOString());
+  utcStrings.push(d.toUTCString());
+  legacyStrings.push(d.toString());
+}
+
+function ParseStrings(strings) {
+  let sum = 0;
+  for (let i = 0; i < strings.length; i++) {
+    sum += Date.parse(strings[i]);
+  }
+  return sum;
+}
+
+createSuite('parseISO', 1000, () => ParseStrings(isoStrings), ()=>{});
+createSuite('parseUTCString', 1000, () => ParseStrings(utcStrings), ()=>{});
+createSuite('parseLegacy', 1000, () => ParseStrings(legacyStrings), ()=>{});
@@ -10,6 +10,10 @@ new BenchmarkSuite('Var-Standard', [1000], [
   new Benchmark('Var-Standard', false, false, 0, VarLoop),
 ]);
 
+new BenchmarkSuite('Loop-Invariant', [1000], [
+  new Benchmark('Loop-Invariant', false, false, 0, LoopInvariant),
+]);
+
 var x = [-1, 1, 4];
 var y = [-11, -1, 1, 2, 3, 4, 5, 6, 20, 44, 87, 99, 100];
 
@@ -40,3 +44,17 @@ function VarLoop() {
   }
   return ret;
 }
+
+var values = new Float64Array(1000);
+for (var j = 0; j < values.length; j++) values[j] = j / 7;
+var params = {scale: 3, offset: 0.5};
+
+// The scale, the offset and their conversions do not change in the loop.
+function LoopInvariant() {
+  "use strict";
+  let sum = 0;
+  for (let i = 0; i < values.length; i++) {
+    sum += values[i] * Math.sqrt(params.scale) + params.offset * 2;
+  }
+  return sum;
+}
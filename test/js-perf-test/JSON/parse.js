@@ -0,0 +1,52 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("ParseLongStrings", [1000], [
+  new Benchmark("ParseLongStrings", false, true, iterations, Run,
+                LongStringsSetup)
+]);
+
+new BenchmarkSuite("ParseTwoByteStrings", [1000], [
+  new Benchmark("ParseTwoByteStrings", false, true, iterations, Run,
+                TwoByteStringsSetup)
+]);
+
+new BenchmarkSuite("ParseObjects", [1000], [
+  new Benchmark("ParseObjects", false, true, iterations, Run, ObjectsSetup)
+]);
+
+function LongStringsSetup() {
+  const text = "The quick brown fox jumps over the lazy dog. ".repeat(40);
+  json = JSON.stringify(new Array(50).fill(text));
+  %FlattenString(json);
+}
+
+function TwoByteStringsSetup() {
+  const text = "Der schnelle braune Fuchs — über den Hund. ".repeat(40);
+  json = JSON.stringify(new Array(50).fill(text));
+  %FlattenString(json);
+}
+
+function ObjectsSetup() {
+  const objects = [];
+  for (let i = 0; i < 500; i++) {
+    objects.push({
+      id: i,
+      name: "user" + i,
+      email: "user" + i + "@example.com",
+      description: "A somewhat longer description of user number " + i,
+      tags: ["alpha", "beta", "gamma"],
+      active: i % 2 == 0
+    });
+  }
+  json = JSON.stringify(objects);
+  %FlattenString(json);
+}
+
+function Run() {
+  if (json == undefined) {
+    throw new Error("No test data");
+  }
+  JSON.parse(json);
+}
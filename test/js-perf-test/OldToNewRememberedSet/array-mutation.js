@@ -0,0 +1,131 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// These benchmarks store freshly allocated objects into large arrays that
+// have been promoted to the old generation. Every store creates an old-to-new
+// reference and runs the generational write barrier, and every scavenge has
+// to process the recorded slots. Compare runs with and without
+// --card-table-old-to-new.
+
+new BenchmarkSuite('RandomWrites', [1000], [
+  new Benchmark('RandomWrites', false, false, 0, RandomWrites,
+                RandomWritesSetup, RandomWritesTearDown)
+]);
+
+new BenchmarkSuite('SequentialWrites', [1000], [
+  new Benchmark('SequentialWrites', false, false, 0, SequentialWrites,
+                SequentialWritesSetup, SequentialWritesTearDown)
+]);
+
+new BenchmarkSuite('LRUCache', [1000], [
+  new Benchmark('LRUCache', false, false, 0, LRUCache, LRUCacheSetup,
+                LRUCacheTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+const kArrayLength = 1 << 20;
+const kWritesPerRun = 1 << 16;
+
+function NewOldArray(length) {
+  const array = new Array(length).fill(0);
+  // Make sure the array and its backing store are old.
+  gc();
+  gc();
+  return array;
+}
+
+// A cheap deterministic pseudo-random number generator.
+let seed;
+function NextRandom() {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed;
+}
+
+let random_array;
+
+function RandomWritesSetup() {
+  seed = 42;
+  random_array = NewOldArray(kArrayLength);
+}
+
+function RandomWrites() {
+  for (let i = 0; i < kWritesPerRun; ++i) {
+    random_array[NextRandom() % kArrayLength] = {value: i};
+  }
+}
+
+function RandomWritesTearDown() {
+  random_array = undefined;
+}
+
+let sequential_array;
+let sequential_index;
+
+function SequentialWritesSetup() {
+  sequential_array = NewOldArray(kArrayLength);
+  sequential_index = 0;
+}
+
+function SequentialWrites() {
+  for (let i = 0; i < kWritesPerRun; ++i) {
+    sequential_array[sequential_index] = {value: i};
+    sequential_index = (sequential_index + 1) % kArrayLength;
+  }
+}
+
+function SequentialWritesTearDown() {
+  sequential_array = undefined;
+}
+
+// A least-recently-used cache implemented on top of large arrays: a hash
+// index from keys to slots, and the slots themselves which are recycled in
+// least-recently-used order.
+const kCacheSize = 1 << 18;
+
+class LRU {
+  constructor() {
+    this.keys = NewOldArray(kCacheSize);
+    this.values = NewOldArray(kCacheSize);
+    this.index = new Map();
+    this.next = 0;
+  }
+
+  get(key) {
+    const slot = this.index.get(key);
+    if (slot === undefined) return undefined;
+    return this.values[slot];
+  }
+
+  set(key, value) {
+    let slot = this.index.get(key);
+    if (slot === undefined) {
+      slot = this.next;
+      this.next = (this.next + 1) % kCacheSize;
+      const evicted = this.keys[slot];
+      if (evicted !== 0) this.index.delete(evicted);
+      this.keys[slot] = key;
+      this.index.set(key, slot);
+    }
+    this.values[slot] = value;
+  }
+}
+
+let cache;
+
+function LRUCacheSetup() {
+  seed = 42;
+  cache = new LRU();
+}
+
+function LRUCache() {
+  for (let i = 0; i < kWritesPerRun; ++i) {
+    const key = 'k' + (NextRandom() % (2 * kCacheSize));
+    if (cache.get(key) === undefined) cache.set(key, {key: key, value: i});
+  }
+}
+
+function LRUCacheTearDown() {
+  cache = undefined;
+}
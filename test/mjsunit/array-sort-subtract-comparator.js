@@ -0,0 +1,72 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Comparators that only subtract their arguments are evaluated inline for
+// Numbers. Results must be the same as calling them.
+
+function ascending(a, b) { return a - b; }
+const descending = (a, b) => b - a;
+function wrapped(a, b) { return ascending(a, b); }
+
+function check(array, comparefn) {
+  const expected = array.slice().sort(wrapped);
+  if (comparefn === descending) expected.reverse();
+  const sorted = array.toSorted(comparefn);
+  assertEquals(expected.length, sorted.length);
+  for (let i = 0; i < expected.length; ++i) {
+    assertSame(expected[i], sorted[i]);
+  }
+  assertEquals(sorted, array.sort(comparefn));
+}
+
+const smis = [];
+const doubles = [];
+for (let i = 0; i < 200; ++i) {
+  smis.push((i * 7919) % 200 - 100);
+  doubles.push(((i * 104729) % 200) / 7 - 10);
+}
+check(smis.slice(), ascending);
+check(smis.slice(), descending);
+check(doubles.slice(), ascending);
+check(doubles.slice(), descending);
+
+// Stability is preserved for equal keys and for NaN results.
+{
+  const a = [3, 1, -0, 2, 0, Infinity, Infinity, 1, -Infinity];
+  const sorted = a.slice().sort(ascending);
+  assertEquals([-Infinity, -0, 0, 1, 1, 2, 3, Infinity, Infinity], sorted);
+  assertSame(-0, sorted[1]);
+  assertSame(0, sorted[2]);
+}
+
+// Non-Number elements still go through the comparator, including valueOf.
+{
+  let calls = 0;
+  const boxed = (v) => ({ valueOf() { ++calls; return v; } });
+  const a = [5, boxed(3), 1, boxed(4), 2];
+  a.sort(ascending);
+  assertEquals([1, 2, 3, 4, 5], a.map(Number));
+  assertTrue(calls > 0);
+
+  const strings = ['10', '9', 8, '7'];
+  strings.sort(ascending);
+  assertEquals(['7', 8, '9', '10'], strings);
+}
+
+// Other comparators are unaffected.
+{
+  const a = [1, 2, 3, 4, 5];
+  a.sort((a, b) => b % 2 - a % 2 || a - b);
+  assertEquals([1, 3, 5, 2, 4], a);
+  let calls = 0;
+  a.sort((x, y) => { ++calls; return x - y; });
+  assertEquals([1, 2, 3, 4, 5], a);
+  assertTrue(calls > 0);
+}
+
+// The default comparator still compares Smis and Strings lexicographically.
+{
+  assertEquals([1, 10, 2, 'a', 'b'], [2, 'b', 10, 'a', 1].sort());
+  assertEquals([-1, -10, 0.5, 100], [100, 0.5, -10, -1].sort());
+}
@@ -0,0 +1,39 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-always-turbofan --maglev
+// Flags: --no-stress-flush-code --no-turbofan
+// Files: test/mjsunit/code-coverage-utils.js
+
+// Maglev code increments block counters without leaving Maglev code.
+
+(async function () {
+
+  if (isNeverOptimizeLiteMode()) {
+    print("Warning: skipping test that requires optimization in Lite mode.");
+    testRunner.quit(0);
+  }
+
+  %DebugToggleBlockCoverage(true);
+
+  await TestCoverage(
+    "Maglev-optimized function",
+    `
+function f(x) {                           // 0000
+  if (x) { nop(); } else { nop(); }       // 0050
+}                                         // 0100
+%PrepareFunctionForOptimization(f);       // 0150
+f(true); f(true);                         // 0200
+%OptimizeMaglevOnNextCall(f);             // 0250
+f(true); f(false); f(false);              // 0300
+    `,
+    [ {"start":0,"end":349,"count":1},
+      {"start":0,"end":101,"count":5},
+      {"start":59,"end":69,"count":3},
+      {"start":69,"end":85,"count":2} ]
+  );
+
+  %DebugToggleBlockCoverage(false);
+
+})();
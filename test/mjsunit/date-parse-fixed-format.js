@@ -0,0 +1,76 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings in the exact layout of toISOString and toUTCString are parsed
+// without the tokenizer. Check them, and near misses that still have to go
+// through the general parser, against equivalent values.
+
+// ISO 8601.
+assertEquals(Date.UTC(2020, 0, 2), Date.parse('2020-01-02'));
+assertEquals(Date.UTC(2020, 0, 2, 3, 4, 5, 678),
+             Date.parse('2020-01-02T03:04:05.678Z'));
+assertEquals(Date.UTC(2020, 0, 2, 3, 4), Date.parse('2020-01-02T03:04Z'));
+assertEquals(Date.UTC(2020, 0, 2, 3, 4, 5), Date.parse('2020-01-02T03:04:05Z'));
+assertEquals(Date.UTC(2020, 0, 1, 21, 34, 5, 678),
+             Date.parse('2020-01-02T03:04:05.678+05:30'));
+assertEquals(Date.UTC(2020, 0, 2, 4, 4), Date.parse('2020-01-02T03:04-01:00'));
+assertEquals(new Date(2020, 0, 2, 3, 4, 5).getTime(),
+             Date.parse('2020-01-02T03:04:05'));
+assertEquals(new Date(2020, 0, 2, 3, 4, 5, 678).getTime(),
+             Date.parse('2020-01-02T03:04:05.678'));
+assertEquals(new Date(Date.UTC(2000, 0, 1)).setUTCFullYear(0),
+             Date.parse('0000-01-01'));
+assertEquals(Date.UTC(2020, 1, 31), Date.parse('2020-02-31'));
+
+for (let i = -1000; i < 1000; ++i) {
+  const d = new Date(1e12 + i * 86400123);
+  assertEquals(d.getTime(), Date.parse(d.toISOString()));
+}
+
+// Near misses.
+assertEquals(Date.UTC(2020, 0, 3), Date.parse('2020-01-02T24:00Z'));
+assertEquals(Date.UTC(2020, 0, 2, 3, 4), Date.parse('2020-01-02t03:04z'));
+assertEquals(Date.UTC(2020, 0, 2, 3, 4, 5, 600),
+             Date.parse('2020-01-02T03:04:05.6Z'));
+assertEquals(Date.UTC(2020, 0, 2, 2, 4), Date.parse('2020-01-02T03:04+0100'));
+assertEquals(Date.UTC(2020, 0, 2, 3, 4), Date.parse('+002020-01-02T03:04Z'));
+assertEquals(NaN, Date.parse('2020-13-02'));
+assertEquals(NaN, Date.parse('2020-01-32'));
+assertEquals(NaN, Date.parse('2020-01-02T25:00Z'));
+assertEquals(NaN, Date.parse('2020-01-02T03:60Z'));
+assertEquals(NaN, Date.parse('2020-01-02T03:04+24:00'));
+assertEquals(NaN, Date.parse('2020-01-02T03:04:05.678Zx'));
+
+// RFC 2822.
+assertEquals(Date.UTC(1994, 10, 15, 8, 12, 31),
+             Date.parse('Tue, 15 Nov 1994 08:12:31 GMT'));
+assertEquals(Date.UTC(1994, 10, 15, 8, 12, 31),
+             Date.parse('15 Nov 1994 08:12:31 UTC'));
+assertEquals(Date.UTC(1994, 10, 15, 8, 12), Date.parse('15 Nov 1994 08:12 UT'));
+assertEquals(Date.UTC(1994, 10, 15, 2, 42, 31),
+             Date.parse('Tue, 15 Nov 1994 08:12:31 +0530'));
+assertEquals(Date.UTC(1994, 10, 15, 9, 12, 31),
+             Date.parse('Tue, 15 Nov 1994 08:12:31 -0100'));
+assertEquals(new Date(1994, 10, 1).getTime(), Date.parse('1 Nov 1994'));
+assertEquals(new Date(1994, 10, 1, 8, 12).getTime(),
+             Date.parse('Tue, 1 Nov 1994 08:12'));
+assertEquals(Date.UTC(100, 0, 1), Date.parse('Fri, 01 Jan 0100 00:00:00 GMT'));
+
+for (let i = -1000; i < 1000; ++i) {
+  const d = new Date(1e12 + i * 86400000 + i * 1000);
+  assertEquals(d.getTime(), Date.parse(d.toUTCString()));
+}
+
+// Near misses.
+assertEquals(Date.UTC(1950, 0, 1), Date.parse('Sun, 01 Jan 0050 00:00:00 GMT'));
+assertEquals(Date.UTC(1994, 10, 15, 8, 12, 31),
+             Date.parse('tue, 15 nov 1994 08:12:31 gmt'));
+assertEquals(Date.UTC(1994, 10, 15, 8, 12, 31),
+             Date.parse('Xyz, 15 Nov 1994 08:12:31 GMT'));
+assertEquals(Date.UTC(1994, 10, 16), Date.parse('15 Nov 1994 24:00 GMT'));
+assertEquals(Date.UTC(1994, 10, 15, 8, 12, 31, 500),
+             Date.parse('15 Nov 1994 08:12:31.5 GMT'));
+assertEquals(Date.UTC(1994, 10, 15), Date.parse('15 Nov 1994 GMT'));
+assertEquals(NaN, Date.parse('15 Xyz 1994'));
+assertEquals(NaN, Date.parse('15 Nov 1994 08:12:31 GMT xyz'));
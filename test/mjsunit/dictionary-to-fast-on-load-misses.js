@@ -0,0 +1,60 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-lazy-feedback-allocation
+// Flags: --dictionary-load-misses-before-fast-mode=4
+
+// Dictionary-mode objects that keep missing in load ICs while their keys
+// stay the same are migrated back to fast properties.
+
+function makeSlow() {
+  const o = {a: 1, b: 2, c: 3, d: 4};
+  delete o.b;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+// Every function has its own load IC, so each of them misses once.
+const readers = [];
+for (let i = 0; i < 6; ++i) {
+  readers.push(new Function('o', 'return o.a + o.c;'));
+}
+
+{
+  const config = makeSlow();
+  for (let i = 0; i < 6; ++i) {
+    assertEquals(4, readers[i](config));
+  }
+  assertTrue(%HasFastProperties(config));
+  assertEquals(1, config.a);
+  assertEquals(undefined, config.b);
+  assertEquals(3, config.c);
+  assertEquals(4, config.d);
+  assertEquals(['a', 'c', 'd'], Object.keys(config));
+}
+
+// Adding or deleting keys between misses restarts the count.
+{
+  const growing = makeSlow();
+  for (let i = 0; i < 6; ++i) {
+    assertEquals(4, readers[i](growing));
+    if (i % 2 == 0) {
+      growing['x' + i] = i;
+    } else {
+      delete growing['x' + (i - 1)];
+    }
+  }
+  assertFalse(%HasFastProperties(growing));
+  assertEquals(['a', 'c', 'd'], Object.keys(growing));
+}
+
+// Objects with too many properties stay in dictionary mode.
+{
+  const big = makeSlow();
+  for (let i = 0; i < 200; ++i) big['p' + i] = i;
+  for (let i = 0; i < 6; ++i) {
+    assertEquals(4, readers[i](big));
+  }
+  assertFalse(%HasFastProperties(big));
+}
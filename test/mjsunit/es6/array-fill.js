@@ -125,3 +125,35 @@ function TestFillFrozenObject() {
   assertThrows(() => Array.prototype.fill.call(object), TypeError);
 }
 TestFillFrozenObject();
+
+function TestFillRestoresPackedElements() {
+  let smis = new Array(5);
+  assertTrue(%HasHoleyElements(smis));
+  smis.fill(1);
+  assertTrue(%HasFastPackedElements(smis));
+  assertTrue(%HasSmiElements(smis));
+
+  let doubles = [1.5, , 3.5];
+  doubles.fill(2.5);
+  assertTrue(%HasFastPackedElements(doubles));
+  assertTrue(%HasDoubleElements(doubles));
+
+  let objects = [{}, , {}];
+  objects.fill();
+  assertTrue(%HasFastPackedElements(objects));
+  assertArrayEquals([undefined, undefined, undefined], objects);
+
+  // Partial fills keep the holes.
+  let partial = [1, , 3, , 5];
+  partial.fill(0, 1);
+  assertTrue(%HasHoleyElements(partial));
+  partial = [1, , 3, , 5];
+  partial.fill(0, 0, 4);
+  assertTrue(%HasHoleyElements(partial));
+
+  // The array can become holey again.
+  smis[10] = 1;
+  assertTrue(%HasHoleyElements(smis));
+  assertArrayEquals([1, 1, 1, 1, 1, , , , , , 1], smis);
+}
+TestFillRestoresPackedElements();
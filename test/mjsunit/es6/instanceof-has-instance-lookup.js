@@ -0,0 +1,87 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// instanceof skips the @@hasInstance lookup if no object on the prototype
+// chain of the constructor up to Function.prototype has the property. Make
+// sure that own and inherited @@hasInstance properties are still found.
+
+function test(object, constructor) {
+  return object instanceof constructor;
+}
+%PrepareFunctionForOptimization(test);
+
+class A {}
+class B extends A {}
+function F() {}
+const a = new A();
+const b = new B();
+const f = new F();
+
+function check() {
+  assertTrue(test(a, A));
+  assertTrue(test(b, A));
+  assertTrue(test(b, B));
+  assertFalse(test(a, B));
+  assertTrue(test(f, F));
+  assertFalse(test(f, A));
+  assertTrue(test(F, Function));
+  assertFalse(test(1, A));
+  assertFalse(test({}, F));
+}
+check();
+
+// Own @@hasInstance on a function.
+const always = {[Symbol.hasInstance]() { return true; }};
+function G() {}
+Object.defineProperty(G, Symbol.hasInstance, {value: () => true});
+assertTrue(test({}, G));
+
+// @@hasInstance inherited from a base class.
+class C { static [Symbol.hasInstance](x) { return x === 42; } }
+class D extends C {}
+assertTrue(test(42, C));
+assertTrue(test(42, D));
+assertFalse(test(new D(), D));
+
+// @@hasInstance added to the prototype of a function later on.
+function H() {}
+assertFalse(test({}, H));
+Object.setPrototypeOf(H, always);
+assertTrue(test({}, H));
+
+// Constructors with dictionary properties.
+function I() {}
+for (let i = 0; i < 100; i++) I['p' + i] = i;
+delete I.p0;
+assertTrue(test(new I(), I));
+I[Symbol.hasInstance] = () => false;
+assertFalse(test(new I(), I));
+
+// Proxies on the prototype chain of the constructor.
+function J() {}
+Object.setPrototypeOf(J, new Proxy(Function.prototype, {
+  get(target, key, receiver) {
+    if (key === Symbol.hasInstance) return () => true;
+    return Reflect.get(target, key, receiver);
+  }
+}));
+assertTrue(test({}, J));
+
+// Non-callable objects inheriting from Function.prototype.
+const K = Object.create(Function.prototype);
+assertFalse(test({}, K));
+
+// Constructors from another realm.
+const other = Realm.create();
+const L = Realm.eval(other, 'function L() {}; L');
+assertTrue(test(Realm.eval(other, 'new L()'), L));
+assertFalse(test({}, L));
+
+check();
+%OptimizeFunctionOnNextCall(test);
+check();
+assertTrue(test({}, G));
+assertTrue(test(42, D));
@@ -0,0 +1,77 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lookups of string keys compare hashes before characters. Keys that are
+// equal but represented differently (internalized, cons, sliced, freshly
+// built) must still be found.
+
+const kCount = 2000;
+
+function key(i) {
+  return 'key' + String(i).padStart(6, '0');
+}
+
+function cons(i) {
+  const s = key(i);
+  return s.substring(0, 4) + s.substring(4);
+}
+
+function sliced(i) {
+  return ('________________________' + key(i)).substring(24);
+}
+
+const map = new Map();
+const set = new Set();
+for (let i = 0; i < kCount; ++i) {
+  map.set(key(i), i);
+  set.add(cons(i));
+}
+assertEquals(kCount, map.size);
+assertEquals(kCount, set.size);
+
+for (let i = 0; i < kCount; ++i) {
+  assertEquals(i, map.get(key(i)));
+  assertEquals(i, map.get(cons(i)));
+  assertEquals(i, map.get(sliced(i)));
+  assertTrue(set.has(key(i)));
+  assertTrue(set.has(sliced(i)));
+}
+
+// Same length, not present.
+for (let i = kCount; i < 2 * kCount; ++i) {
+  assertFalse(map.has(key(i)));
+  assertFalse(set.has(cons(i)));
+  assertEquals(undefined, map.get(sliced(i)));
+}
+
+// Overwriting with a differently represented equal key keeps one entry.
+for (let i = 0; i < kCount; i += 7) {
+  map.set(sliced(i), -i);
+  set.add(key(i));
+}
+assertEquals(kCount, map.size);
+assertEquals(kCount, set.size);
+for (let i = 0; i < kCount; i += 7) {
+  assertEquals(-i, map.get(key(i)));
+}
+
+// Deleting with an equal key.
+for (let i = 0; i < kCount; i += 2) {
+  assertTrue(map.delete(cons(i)));
+  assertTrue(set.delete(sliced(i)));
+}
+assertEquals(kCount / 2, map.size);
+assertEquals(kCount / 2, set.size);
+for (let i = 0; i < kCount; ++i) {
+  assertEquals(i % 2 == 1, map.has(key(i)));
+  assertEquals(i % 2 == 1, set.has(key(i)));
+}
+
+// Index-like strings hash differently from other strings.
+const indices = new Map();
+for (let i = 0; i < 100; ++i) indices.set(String(i), i);
+for (let i = 0; i < 100; ++i) {
+  assertEquals(i, indices.get('' + i));
+  assertFalse(indices.has(i));
+}
@@ -84,3 +84,63 @@ d8.file.execute('test/mjsunit/test-async.js');
         assert.unexpectedRejection());
   });
 })();
+
+// Native promises share the element closures, and the reactions carry the
+// index of the element. Mix them with settled promises, non-promise values
+// and thenables, which still get their own closures.
+(function() {
+  let resolveLate;
+  const late = new Promise(resolve => resolveLate = resolve);
+  const thenable = {then(resolve) { resolve('thenable'); }};
+  const values = [late, Promise.resolve(1), 2, thenable, Promise.resolve(3)];
+  testAsync(assert => {
+    assert.plan(1);
+    Promise.all(values).then(
+        v => assert.equals(['late', 1, 2, 'thenable', 3], v),
+        assert.unexpectedRejection());
+    resolveLate('late');
+  });
+})();
+
+(function() {
+  let rejectLate;
+  const late = new Promise((_, reject) => rejectLate = reject);
+  testAsync(assert => {
+    assert.plan(1);
+    Promise.all([Promise.resolve(1), late, new Promise(() => {})]).then(
+        () => assert.unreachable(), e => assert.equals('late', e));
+    rejectLate('late');
+  });
+})();
+
+(function() {
+  let resolveLate;
+  const late = new Promise(resolve => resolveLate = resolve);
+  const rejected = Promise.reject(1);
+  testAsync(assert => {
+    assert.plan(1);
+    Promise.allSettled([rejected, late, Promise.resolve(2), 3]).then(
+        v => assert.equals([
+          {status: 'rejected', reason: 1},
+          {status: 'fulfilled', value: 'late'},
+          {status: 'fulfilled', value: 2},
+          {status: 'fulfilled', value: 3},
+        ], v),
+        assert.unexpectedRejection());
+    resolveLate('late');
+  });
+})();
+
+(function() {
+  const promises = [];
+  const expected = [];
+  for (let i = 0; i < 10000; i++) {
+    promises.push(i % 2 ? Promise.resolve(i) : new Promise(r => r(i)));
+    expected.push(i);
+  }
+  testAsync(assert => {
+    assert.plan(1);
+    Promise.all(promises).then(
+        v => assert.equals(expected, v), assert.unexpectedRejection());
+  });
+})();
@@ -0,0 +1,98 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Arrays of at least 1024 elements are sorted with a radix sort when no
+// comparator is given. Compare against the generic comparator-based sort.
+
+const kLength = 5000;
+
+let seed = 17;
+function random() {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+function compare(x, y) {
+  if (x < y) return -1;
+  if (x > y) return 1;
+  if (x === 0 && y === 0) {
+    return Object.is(x, -0) ? (Object.is(y, -0) ? 0 : -1)
+                            : (Object.is(y, -0) ? 1 : 0);
+  }
+  if (Number.isNaN(x)) return Number.isNaN(y) ? 0 : 1;
+  if (Number.isNaN(y)) return -1;
+  return 0;
+}
+
+function assertSortedLike(expected, actual) {
+  assertEquals(expected.length, actual.length);
+  for (let i = 0; i < expected.length; ++i) {
+    assertSame(expected[i], actual[i]);
+  }
+}
+
+function fill(array, value) {
+  for (let i = 0; i < array.length; ++i) array[i] = value(i);
+  return array;
+}
+
+const kIntegerConstructors = [
+  Uint8Array, Int8Array, Uint16Array, Int16Array, Uint32Array, Int32Array,
+  Uint8ClampedArray
+];
+
+for (const constructor of kIntegerConstructors) {
+  const a = fill(new constructor(kLength),
+                 () => Math.floor((random() - 0.5) * 2 ** 33));
+  const expected = a.slice().sort(compare);
+  assertSortedLike(expected, a.toSorted());
+  assertSortedLike(expected, a.sort());
+}
+
+for (const constructor of [Float32Array, Float64Array]) {
+  const special = [NaN, -0, +0, -Infinity, Infinity, -1e-40, 1e-40];
+  const a = fill(new constructor(kLength), (i) => {
+    if (i % 10 === 0) return special[i % special.length];
+    return (random() - 0.5) * 1e6;
+  });
+  const expected = a.slice().sort(compare);
+  assertSortedLike(expected, a.toSorted());
+  assertSortedLike(expected, a.sort());
+  assertSame(-Infinity, a[0]);
+  assertTrue(Number.isNaN(a[kLength - 1]));
+
+  // Negative NaN bit patterns sort last as well.
+  const b = fill(new constructor(kLength), (i) => kLength - i);
+  const bytes = new Uint8Array(b.buffer);
+  bytes.fill(0xff, 0, constructor.BYTES_PER_ELEMENT);
+  b.sort();
+  assertSame(1, b[0]);
+  assertTrue(Number.isNaN(b[kLength - 1]));
+}
+
+for (const constructor of [BigInt64Array, BigUint64Array]) {
+  const a = fill(new constructor(kLength), () => BigInt.asIntN(
+      64, BigInt(Math.floor(random() * 2 ** 32)) << 31n));
+  const expected = a.slice().sort((x, y) => (x < y ? -1 : x > y ? 1 : 0));
+  assertSortedLike(expected, a.sort());
+}
+
+// Arrays backed by a SharedArrayBuffer are sorted through a copy.
+{
+  const a = new Int32Array(new SharedArrayBuffer(4 * kLength));
+  fill(a, (i) => (i * 7919) % kLength - kLength / 2);
+  a.sort();
+  for (let i = 0; i < kLength; ++i) assertEquals(i - kLength / 2, a[i]);
+}
+
+// Non-zero byte offset into the buffer.
+{
+  const buffer = new ArrayBuffer(8 * (kLength + 1));
+  const a = new Float64Array(buffer, 8, kLength);
+  fill(a, (i) => kLength - i);
+  new Float64Array(buffer, 0, 1)[0] = 12345;
+  a.sort();
+  for (let i = 0; i < kLength; ++i) assertEquals(i + 1, a[i]);
+  assertEquals(12345, new Float64Array(buffer, 0, 1)[0]);
+}
@@ -0,0 +1,50 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --parallel-ephemeron-index
+// Flags: --ephemeron-fixpoint-iterations=0
+
+const kChainLength = 1000;
+
+// A chain of ephemerons where each value holds the key of the next ephemeron.
+// The entries are added in reverse order so that visiting the table once
+// discovers only a single key.
+(function TestChainInSingleWeakMap() {
+  const map = new WeakMap();
+  let keys = [];
+  for (let i = 0; i < kChainLength; ++i) keys.push({});
+  for (let i = kChainLength - 1; i > 0; --i) {
+    map.set(keys[i - 1], {index: i, next: keys[i]});
+  }
+  const head = keys[0];
+  keys = null;
+  gc();
+  let key = head;
+  for (let i = 1; i < kChainLength; ++i) {
+    const value = map.get(key);
+    assertEquals(i, value.index);
+    key = value.next;
+  }
+})();
+
+// A chain of ephemerons where each value holds the next WeakMap, which in
+// turn is only discovered while processing ephemerons.
+(function TestChainAcrossWeakMaps() {
+  const key = {};
+  let map = new WeakMap();
+  const head = map;
+  for (let i = 1; i < kChainLength; ++i) {
+    const next = new WeakMap();
+    map.set(key, {index: i, next});
+    map = next;
+  }
+  map = null;
+  gc();
+  map = head;
+  for (let i = 1; i < kChainLength; ++i) {
+    const value = map.get(key);
+    assertEquals(i, value.index);
+    map = value.next;
+  }
+})();
@@ -0,0 +1,52 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Waiters on different locations are kept in different wait lists. Notifying
+// one location must only wake the waiters on that location.
+
+(function test() {
+  const N = 256;
+  const sab = new SharedArrayBuffer(N * 4);
+  const i32a = new Int32Array(sab);
+  let log = [];
+
+  for (let i = 0; i < N; ++i) {
+    for (let j = 0; j < 2; ++j) {
+      const result = Atomics.waitAsync(i32a, i, 0);
+      assertEquals(true, result.async);
+      result.value.then(
+        (value) => { assertEquals("ok", value); log.push(i); },
+        () => { assertUnreachable(); });
+    }
+  }
+  for (let i = 0; i < N; ++i) {
+    assertEquals(2, %AtomicsNumWaitersForTesting(i32a, i));
+  }
+
+  // Wake up the waiters on every other location.
+  for (let i = 0; i < N; i += 2) {
+    assertEquals(2, Atomics.notify(i32a, i));
+  }
+  for (let i = 0; i < N; ++i) {
+    const woken = i % 2 == 0;
+    assertEquals(woken ? 0 : 2, %AtomicsNumWaitersForTesting(i32a, i));
+    assertEquals(woken ? 2 : 0,
+                 %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a, i));
+  }
+
+  function continuation() {
+    assertEquals(N, log.length);
+    for (let i = 0; i < N; ++i) {
+      assertEquals(0, log[i] % 2);
+    }
+    for (let i = 1; i < N; i += 2) {
+      assertEquals(2, Atomics.notify(i32a, i));
+      assertEquals(0, %AtomicsNumWaitersForTesting(i32a, i));
+    }
+  }
+
+  setTimeout(continuation, 0);
+})();
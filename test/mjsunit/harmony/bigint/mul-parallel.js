@@ -0,0 +1,51 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-bigint-operations
+
+// Very large multiplications may be split across worker threads. Check the
+// results via algebraic identities, which mostly use smaller operands.
+
+function fastAssertEquals(expected, actual) {
+  if (expected === actual) return;
+  throw new MjsUnitAssertionError(
+      'Failure:\nexpected:\n0x' +
+      expected.toString(16).substring(0, 1000) +
+      '...n\nfound:\n0x' +
+      actual.toString(16).substring(0, 1000) + '...n');
+}
+
+function make(hexDigits, seed) {
+  let s = '0x';
+  for (let i = 0; i < hexDigits; ++i) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    s += (seed >> 16 & 15).toString(16);
+  }
+  return BigInt(s);
+}
+
+// FFT: both operands long.
+{
+  const a = make(150000, 1);
+  const b = make(140000, 2);
+  const shift = 300000n;
+  const mask = (1n << shift) - 1n;
+  const aHi = a >> shift;
+  const aLo = a & mask;
+  fastAssertEquals((aHi * b << shift) + aLo * b, a * b);
+  fastAssertEquals(a * a - b * b, (a + b) * (a - b));
+  fastAssertEquals(a, a * b / b);
+  fastAssertEquals(0n, a * b % b);
+}
+
+// Toom-Cook: one long and one medium-sized operand.
+{
+  const a = make(200000, 3);
+  const b = make(5000, 4);
+  const shift = 400000n;
+  const aHi = a >> shift;
+  const aLo = a & ((1n << shift) - 1n);
+  fastAssertEquals((aHi * b << shift) + aLo * b, a * b);
+  fastAssertEquals(-(a * b), a * -b);
+}
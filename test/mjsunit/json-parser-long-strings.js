@@ -0,0 +1,24 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Terminators and escapes at every position of the SIMD blocks that the JSON
+// string scanner skips.
+for (const filler of ['a', 'é', '€']) {
+  for (let length = 0; length < 40; length++) {
+    const prefix = filler.repeat(length);
+    assertEquals(prefix, JSON.parse('"' + prefix + '"'));
+    assertEquals(prefix + '\n' + prefix,
+                 JSON.parse('"' + prefix + '\\n' + prefix + '"'));
+    assertEquals([prefix, prefix],
+                 JSON.parse(JSON.stringify([prefix, prefix])));
+    assertThrows(() => JSON.parse('"' + prefix + '\u0001"'), SyntaxError);
+    assertThrows(() => JSON.parse('"' + prefix), SyntaxError);
+  }
+}
+
+// Two-byte sources with only one-byte characters in strings produce one-byte
+// strings, and non-Latin-1 characters after a long prefix are kept.
+const long = 'x'.repeat(100);
+assertEquals(long + '€', JSON.parse('"' + long + '€"'));
+assertEquals({'€': long}, JSON.parse('{"€": "' + long + '"}'));
@@ -0,0 +1,94 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Dictionary-mode objects keep the enumeration order of their properties,
+// also when resuming after nested objects and encoding changes.
+(function TestDictionaryObjects() {
+  const obj = {a: 1, b: 'x', c: {d: [1, 2]}, e: 'f€', g: null};
+  delete obj.b;
+  obj.h = {i: true};
+  obj.b = 2.5;
+  assertFalse(%HasFastProperties(obj));
+  assertEquals(
+      '{"a":1,"c":{"d":[1,2]},"e":"f€","g":null,"h":{"i":true},"b":2.5}',
+      JSON.stringify(obj));
+  assertEquals(JSON.stringify([obj, obj]),
+               '[' + JSON.stringify(obj) + ',' + JSON.stringify(obj) + ']');
+
+  Object.defineProperty(obj, 'hidden', {value: 1, enumerable: false});
+  obj[Symbol('s')] = 1;
+  obj.u = undefined;
+  assertEquals(
+      '{"a":1,"c":{"d":[1,2]},"e":"f€","g":null,"h":{"i":true},"b":2.5}',
+      JSON.stringify(obj));
+
+  Object.defineProperty(obj, 'getter', {get() { return 42; },
+                                        enumerable: true});
+  assertTrue(JSON.stringify(obj).endsWith(',"getter":42}'));
+
+  obj.toJSON = () => 'json';
+  assertEquals('"json"', JSON.stringify(obj));
+
+  const empty = {a: 1};
+  delete empty.a;
+  assertEquals('{}', JSON.stringify(empty));
+})();
+
+// Typed arrays are serialized with their indices as keys.
+(function TestTypedArrays() {
+  assertEquals('{"0":-1,"1":255}', JSON.stringify(new Int16Array([-1, 255])));
+  assertEquals('{"0":4294967295}', JSON.stringify(new Uint32Array([-1])));
+  assertEquals('{"0":0.5,"1":null,"2":0}',
+               JSON.stringify(new Float64Array([0.5, NaN, -0])));
+  assertEquals('{"0":0.10000000149011612}',
+               JSON.stringify(new Float32Array([0.1])));
+  assertEquals('{"a":{"0":1,"1":2},"b":{}}',
+               JSON.stringify({a: new Uint8Array([1, 2]), b: new Int8Array()}));
+
+  const large = new Uint8Array(10000).fill(7);
+  const expected = {};
+  for (let i = 0; i < large.length; i++) expected[i] = 7;
+  assertEquals(JSON.stringify(expected), JSON.stringify(large));
+
+  const with_property = new Int32Array([1]);
+  with_property.x = 'y';
+  assertEquals('{"0":1,"x":"y"}', JSON.stringify(with_property));
+
+  const buffer = new ArrayBuffer(8);
+  const detached = new Uint8Array(buffer);
+  %ArrayBufferDetach(buffer);
+  assertEquals('{}', JSON.stringify(detached));
+
+  assertThrows(() => JSON.stringify(new BigInt64Array(1)), TypeError);
+
+  Uint8Array.prototype.toJSON = function() { return 'u8'; };
+  assertEquals('["u8"]', JSON.stringify([new Uint8Array(3)]));
+  delete Uint8Array.prototype.toJSON;
+})();
+
+// Integral doubles are serialized like Smis.
+(function TestDoubleArrays() {
+  assertEquals('[1.5,2,-3,0,1e+21,4294967296]',
+               JSON.stringify([1.5, 2, -3, -0, 1e21, 2 ** 32]));
+})();
+
+// Packed double arrays are converted in batches, which must agree with
+// Number.prototype.toString for every element.
+(function TestDoubleArrayBatches() {
+  const values = [0.1, -0.000001, 1e-7, 123456789012345680000, 5e-324,
+                  1.7976931348623157e308, -2147483648, 2147483648, NaN,
+                  -Infinity, -0, 1 / 3];
+  const doubles = [];
+  for (let i = 0; i < 100; i++) {
+    const value = values[i % values.length];
+    doubles.push(i % 2 ? value * 1.5 : value);
+  }
+  assertTrue(%HasDoubleElements(doubles));
+  const expected =
+      '[' + doubles.map(x => isFinite(x) ? String(x) : 'null').join(',') + ']';
+  assertEquals(expected, JSON.stringify(doubles));
+  assertEquals(expected, JSON.stringify(doubles.slice()));
+})();
@@ -0,0 +1,63 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Megamorphic keyed loads from objects with many own properties cache field
+// handlers by (map, name). Values must stay correct when fields change,
+// objects change shape, or properties become accessors.
+
+const kProperties = 40;
+const kShapes = 12;
+
+function makeObject(shape) {
+  const o = {};
+  for (let i = 0; i < kProperties; ++i) {
+    o['p' + ((i + shape) % kProperties)] = shape * 1000 + i;
+  }
+  return o;
+}
+
+const objects = [];
+for (let shape = 0; shape < kShapes; ++shape) objects.push(makeObject(shape));
+
+const keys = [];
+for (let i = 0; i < kProperties; ++i) keys.push('p' + i);
+
+function get(o, key) { return o[key]; }
+
+function expected(shape, key) {
+  const i = (Number(key.substring(1)) - shape + kProperties) % kProperties;
+  return shape * 1000 + i;
+}
+
+for (let round = 0; round < 3; ++round) {
+  for (let shape = 0; shape < kShapes; ++shape) {
+    for (const key of keys) {
+      assertEquals(expected(shape, key), get(objects[shape], key));
+    }
+  }
+}
+
+// Field stores are visible through cached handlers.
+objects[3].p7 = 'seven';
+objects[3].p8 = 1.5;
+assertEquals('seven', get(objects[3], 'p7'));
+assertEquals(1.5, get(objects[3], 'p8'));
+
+// Missing properties go to the prototype chain.
+Object.prototype.missing = 'proto';
+assertEquals('proto', get(objects[0], 'missing'));
+delete Object.prototype.missing;
+assertEquals(undefined, get(objects[0], 'missing'));
+
+// Accessors and dictionary-mode objects.
+Object.defineProperty(objects[5], 'p2', { get() { return 'getter'; } });
+assertEquals('getter', get(objects[5], 'p2'));
+delete objects[6].p0;
+assertEquals(undefined, get(objects[6], 'p0'));
+assertEquals(expected(6, 'p1'), get(objects[6], 'p1'));
+
+// Objects sharing a map with a changed one are unaffected.
+const twin = makeObject(3);
+assertEquals(expected(3, 'p7'), get(twin, 'p7'));
+assertEquals('seven', get(objects[3], 'p7'));
@@ -573,3 +573,62 @@ assertEquals(optimize(top, []), 42);
   %PrepareFunctionForOptimization(foo);
   assertEquals(optimize(top, []), 44);
 })();
+
+// Spread of a rest parameter.
+(function() {
+  function bar(x, y) { return y; }
+  function foo(...args) {
+    return bar(...args);
+  }
+  assertEquals(optimize(foo, [1, 2, 3]), 2);
+})();
+
+// Spread of a rest parameter after formal parameters.
+(function() {
+  function bar(x, y) { return y; }
+  function foo(a, ...args) {
+    return bar(...args);
+  }
+  assertEquals(optimize(foo, [1, 2, 3]), 3);
+})();
+
+// Spread of a rest parameter after other arguments.
+(function() {
+  function bar(x, y, z) { return x + y + z; }
+  function foo(a, ...args) {
+    return bar(a, 10, ...args);
+  }
+  assertEquals(optimize(foo, [1, 2, 3]), 13);
+})();
+
+// Spread of a rest parameter as a method call.
+(function() {
+  const obj = {
+    bar(x, y) { return this === obj ? y : -1; }
+  };
+  function foo(...args) {
+    return obj.bar(...args);
+  }
+  assertEquals(optimize(foo, [1, 2, 3]), 2);
+})();
+
+// Spread of a rest parameter with update before call.
+(function() {
+  function bar(x, y) { return y; }
+  function foo(...args) {
+    args[1] = 42;
+    return bar(...args);
+  }
+  assertEquals(optimize(foo, [1, 2, 3]), 42);
+})();
+
+// Spread of a rest parameter with a modified array iterator.
+(function() {
+  function bar(x, y) { return y; }
+  function foo(...args) {
+    return bar(...args);
+  }
+  assertEquals(optimize(foo, [1, 2, 3]), 2);
+  Array.prototype[Symbol.iterator] = function*() { yield 5; yield 6; };
+  assertEquals(foo(1, 2, 3), 6);
+})();
@@ -0,0 +1,97 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+function every(a) { return a.every(v => v < 10); }
+function some(a) { return a.some(v => v > 2); }
+function find(a) { return a.find(v => v > 1); }
+function findIndex(a) { return a.findIndex(v => v > 1); }
+function reduce(a) { return a.reduce((acc, v) => acc + v, 0); }
+function reduceNoInitial(a) { return a.reduce((acc, v) => acc + v); }
+
+function test(f, cases) {
+  %PrepareFunctionForOptimization(f);
+  for (let [input, expected] of cases) assertEquals(expected, f(input));
+  %OptimizeMaglevOnNextCall(f);
+  for (let [input, expected] of cases) assertEquals(expected, f(input));
+}
+
+test(every, [[[1, 2, 3], true], [[1, 20, 3], false], [[], true]]);
+test(some, [[[1, 2, 3], true], [[1, 2], false], [[], false]]);
+test(find, [[[1, 2, 3], 2], [[0, 1], undefined]]);
+test(findIndex, [[[1, 2, 3], 1], [[0, 1], -1]]);
+test(reduce, [[[1, 2, 3], 6], [[], 0]]);
+test(reduceNoInitial, [[[1, 2, 3], 6], [[4], 4]]);
+
+// Doubles.
+test(every, [[[1.5, 2.5], true], [[1.5, 20.5], false]]);
+test(find, [[[0.5, 1.5, 2.5], 1.5], [[0.5], undefined]]);
+test(reduce, [[[0.5, 1.5], 2]]);
+
+// Holes are skipped by every, some and reduce, but visited as undefined by find
+// and findIndex.
+(function() {
+  function countEvery(a) {
+    let count = 0;
+    a.every(v => { count++; return true; });
+    return count;
+  }
+  function findHole(a) { return a.findIndex(v => v === undefined); }
+  test(countEvery, [[[1, , 3], 2], [[1.5, , 3.5], 2]]);
+  test(findHole, [[[1, , 3], 1], [[1.5, , 3.5], 1], [[1, 2], -1]]);
+})();
+
+// reduce of an empty array without an initial value throws after a deopt.
+(function() {
+  %PrepareFunctionForOptimization(reduceNoInitial);
+  assertEquals(3, reduceNoInitial([1, 2]));
+  %OptimizeMaglevOnNextCall(reduceNoInitial);
+  assertEquals(3, reduceNoInitial([1, 2]));
+  assertThrows(() => reduceNoInitial([]), TypeError);
+})();
+
+// Lazy deopt in the callback resumes the builtin's loop after the call.
+(function() {
+  let deopt = false;
+  function check(v) {
+    if (deopt && v == 2) %DeoptimizeFunction(someDeopt);
+    return v > 2;
+  }
+  function someDeopt(a) { return a.some(check); }
+  function findDeopt(a) {
+    return a.find(v => {
+      if (deopt && v == 2) %DeoptimizeFunction(findDeopt);
+      return v > 1;
+    });
+  }
+  function reduceDeopt(a) {
+    return a.reduce((acc, v) => {
+      if (deopt && v == 2) %DeoptimizeFunction(reduceDeopt);
+      return acc + v;
+    }, 10);
+  }
+  for (let [f, expected] of
+       [[someDeopt, true], [findDeopt, 2], [reduceDeopt, 16]]) {
+    deopt = false;
+    %PrepareFunctionForOptimization(f);
+    assertEquals(expected, f([1, 2, 3]));
+    %OptimizeMaglevOnNextCall(f);
+    assertEquals(expected, f([1, 2, 3]));
+    deopt = true;
+    assertEquals(expected, f([1, 2, 3]));
+  }
+})();
+
+// The callback shrinking the array eagerly deopts at the end of the iteration.
+(function() {
+  function everyShrink(a) {
+    return a.every(v => { if (v == 1) a.length = 2; return v !== undefined; });
+  }
+  %PrepareFunctionForOptimization(everyShrink);
+  assertTrue(everyShrink([0, 2, 3]));
+  %OptimizeMaglevOnNextCall(everyShrink);
+  assertTrue(everyShrink([0, 2, 3]));
+  assertTrue(everyShrink([0, 1, 2, 3]));
+})();
@@ -80,3 +80,44 @@ function foo() {
 assertEquals(foo(), 14.2);
 %OptimizeMaglevOnNextCall(foo);
 assertEquals(foo(), 14.2);
+
+// Values live across a non-call throwing node (the hole check on `z`) are only
+// spilled for the throw if the catch block can reach one of their uses.
+function foo_tdz_catch_returns(a, b, check) {
+  let sum = a + b;
+  let prod = a * b;
+  try {
+    if (check) z;
+  } catch {
+    return -1;
+  }
+  return sum + prod;
+  let z = 0;
+}
+%PrepareFunctionForOptimization(foo_tdz_catch_returns);
+assertEquals(foo_tdz_catch_returns(2, 3, false), 11);
+assertEquals(foo_tdz_catch_returns(2, 3, true), -1);
+%OptimizeMaglevOnNextCall(foo_tdz_catch_returns);
+assertEquals(foo_tdz_catch_returns(2, 3, false), 11);
+assertEquals(foo_tdz_catch_returns(2, 3, true), -1);
+
+function foo_tdz_in_loop(n, throw_at) {
+  let total = 0;
+  for (let i = 0; i < n; i++) {
+    const k = i * 2;
+    try {
+      if (i == throw_at) z;
+      total += k;
+    } catch (e) {
+      total += 100 + k;
+    }
+  }
+  return total;
+  let z = 0;
+}
+%PrepareFunctionForOptimization(foo_tdz_in_loop);
+assertEquals(foo_tdz_in_loop(4, 2), 112);
+assertEquals(foo_tdz_in_loop(4, -1), 12);
+%OptimizeMaglevOnNextCall(foo_tdz_in_loop);
+assertEquals(foo_tdz_in_loop(4, 2), 112);
+assertEquals(foo_tdz_in_loop(4, -1), 12);
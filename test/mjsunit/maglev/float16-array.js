@@ -0,0 +1,42 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+// Flags: --js-float16array
+
+function load(a, i) { return a[i]; }
+function store(a, i, v) { a[i] = v; }
+
+function roundTrip(v) {
+  const a = new Float16Array(1);
+  store(a, 0, v);
+  return load(a, 0);
+}
+
+const cases = [
+  [0, 0], [-0, -0], [1, 1], [-2.5, -2.5], [65504, 65504],
+  // Rounds to nearest, ties to even.
+  [1.0009765625, 1.0009765625], [1.00048828125, 1], [1.00146484375, 1.001953125],
+  // Overflow and the smallest subnormal.
+  [65520, Infinity], [-1e10, -Infinity], [5.960464477539063e-8,
+  5.960464477539063e-8], [2.9e-8, 0],
+  [Infinity, Infinity], [NaN, NaN],
+];
+
+%PrepareFunctionForOptimization(load);
+%PrepareFunctionForOptimization(store);
+for (let [input, expected] of cases) assertEquals(expected, roundTrip(input));
+%OptimizeMaglevOnNextCall(load);
+%OptimizeMaglevOnNextCall(store);
+for (let [input, expected] of cases) assertEquals(expected, roundTrip(input));
+
+// Values that aren't numbers go through ToNumber.
+assertEquals(3, roundTrip("3"));
+assertEquals(NaN, roundTrip(undefined));
+
+// Out-of-bounds accesses.
+const a = new Float16Array(2);
+assertEquals(undefined, load(a, 2));
+store(a, 2, 1);
+assertEquals(undefined, a[2]);
@@ -0,0 +1,32 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-licm --no-maglev-loop-peeling
+
+function sum(x, n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    // The Smi check of {x} is loop invariant, even though the loop writes to
+    // a property.
+    result += x;
+    sum.last = i;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(6, sum(2, 3));
+assertEquals(6, sum(2, 3));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(6, sum(2, 3));
+assertEquals(0, sum(2, 0));
+assertTrue(isMaglevved(sum));
+
+// The hoisted check fails even if the loop isn't entered. Afterwards, the
+// function is not optimized in the same way again.
+assertEquals(0, sum({}, 0));
+assertEquals(0.5, sum(0.5, 1));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(0, sum({}, 0));
+assertEquals(1, sum(0.5, 2));
@@ -0,0 +1,26 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-osr --no-stress-opt
+// Flags: --no-baseline-batch-compilation --use-osr --no-turbofan
+// Flags: --concurrent-osr --concurrent-recompilation --efficiency-mode
+// Flags: --efficiency-mode-for-tiering-heuristics
+// Flags: --concurrent-maglev-osr-in-efficiency-mode
+
+let keep_going = 10000000;  // A counter to avoid test hangs on failure.
+
+function f() {
+  let reached_maglev = false;
+  while (!reached_maglev && --keep_going) {
+    // This loop should trigger a concurrent OSR compilation, whose code is
+    // entered from a later iteration.
+    reached_maglev = (%GetOptimizationStatus(f) &
+                      V8OptimizationStatus.kTopmostFrameIsMaglev) !== 0;
+  }
+}
+
+if (%IsMaglevEnabled()) {
+  f();
+  assertTrue(keep_going > 0);
+}
@@ -0,0 +1,110 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+// Flags: --maglev-function-context-specialization
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  f(...args);
+  %OptimizeMaglevOnNextCall(f);
+}
+
+// Proxies with feedback call the proxy builtins directly.
+(function() {
+  const log = [];
+  const handler = {
+    get(target, key, receiver) {
+      log.push('get ' + key);
+      return target[key];
+    },
+    set(target, key, value) {
+      log.push('set ' + key);
+      target[key] = value;
+      return true;
+    },
+  };
+  function load(p) { return p.x; }
+  function store(p, v) { p.x = v; }
+  const p = new Proxy({x: 1}, handler);
+  optimize(load, p);
+  optimize(store, p, 1);
+  log.length = 0;
+  assertEquals(1, load(p));
+  store(p, 2);
+  assertEquals(2, load(p));
+  assertEquals(['get x', 'set x', 'get x'], log);
+  assertEquals(3, load(new Proxy({x: 3}, {})));
+
+  const {proxy, revoke} = Proxy.revocable({x: 4}, handler);
+  assertEquals(4, load(proxy));
+  revoke();
+  assertThrows(() => load(proxy), TypeError);
+  assertThrows(() => store(proxy, 5), TypeError);
+})();
+
+// Strict mode stores throw if the set trap returns false.
+(function() {
+  const p = new Proxy({}, {set() { return false; }});
+  function sloppy(p) { p.x = 1; }
+  function strict(p) { 'use strict'; p.x = 1; }
+  optimize(sloppy, p);
+  sloppy(p);
+  %PrepareFunctionForOptimization(strict);
+  assertThrows(() => strict(p), TypeError);
+  %OptimizeMaglevOnNextCall(strict);
+  assertThrows(() => strict(p), TypeError);
+})();
+
+// The get trap of a constant proxy is called directly.
+(function() {
+  const handler = {
+    get(target, key, receiver) { return key + target[key]; }
+  };
+  function make() {
+    const proxy = new Proxy({x: 1}, handler);
+    return () => proxy.x;
+  }
+  const load = make();
+  optimize(load);
+  assertEquals('x1', load());
+
+  // Changing the trap invalidates the code.
+  handler.get = function(target, key) { return 42; };
+  assertEquals(42, load());
+})();
+
+(function() {
+  class Handler {
+    get(target, key, receiver) { return target[key] * 2; }
+  }
+  const target = {x: 1};
+  function make() {
+    const proxy = new Proxy(target, new Handler());
+    return () => proxy.x;
+  }
+  const load = make();
+  optimize(load);
+  assertEquals(2, load());
+  target.x = 5;
+  assertEquals(10, load());
+  // Defining a non-configurable property on the target requires the trap
+  // result to be checked again.
+  Object.defineProperty(target, 'x', {value: 7, configurable: false});
+  assertThrows(() => load(), TypeError);
+})();
+
+(function() {
+  const {proxy, revoke} = Proxy.revocable({x: 1}, {get() { return 2; }});
+  function make() {
+    const p = proxy;
+    return () => p.x;
+  }
+  const load = make();
+  optimize(load);
+  assertEquals(2, load());
+  revoke();
+  assertThrows(() => load(), TypeError);
+})();
@@ -0,0 +1,50 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --grow-stub-cache --trace-megamorphic-ic-sites=3
+
+// Megamorphic sites with more (map, name) pairs than fit into the stub cache
+// make it grow on the next full GC. Lookups must keep finding the right
+// handlers before and after.
+
+const kShapes = 3000;
+const kNames = ['a', 'b', 'c', 'd', 'e', 'f'];
+
+const objects = [];
+for (let i = 0; i < kShapes; ++i) {
+  const o = {};
+  o['p' + i] = i;
+  for (const name of kNames) o[name] = name + i;
+  objects.push(o);
+}
+
+function load(o, name) {
+  return o[name];
+}
+
+function store(o, value) {
+  o.a = value;
+}
+
+function check() {
+  for (let i = 0; i < kShapes; ++i) {
+    for (const name of kNames) {
+      assertEquals(name + i, load(objects[i], name));
+    }
+    assertEquals(i, objects[i]['p' + i]);
+  }
+}
+
+for (let round = 0; round < 4; ++round) {
+  check();
+  gc();
+}
+
+for (let i = 0; i < kShapes; ++i) store(objects[i], -i);
+gc();
+for (let i = 0; i < kShapes; ++i) {
+  assertEquals(-i, load(objects[i], 'a'));
+  store(objects[i], 'a' + i);
+}
+check();
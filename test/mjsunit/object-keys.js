@@ -115,3 +115,39 @@
       ],
       log);
 })();
+
+// Ensure that the cached keys of dictionary-mode objects are copied and kept
+// up to date when keys are added, removed or change their enumerability.
+(function() {
+  const a = Object.create(null);
+  a.x = 1;
+  a.y = 2;
+  delete a.x;
+  a.x = 3;
+  assertFalse(%HasFastProperties(a));
+  let k = Object.keys(a);
+  %HeapObjectVerify(k);
+  assertEquals(['y', 'x'], k);
+  k[0] = 'z';
+  assertEquals(['y', 'x'], Object.keys(a));
+
+  a.z = 4;
+  assertEquals(['y', 'x', 'z'], Object.keys(a));
+  delete a.y;
+  assertEquals(['x', 'z'], Object.keys(a));
+  Object.defineProperty(a, 'x', {enumerable: false});
+  assertEquals(['z'], Object.keys(a));
+  Object.defineProperty(a, 'x', {enumerable: true});
+  assertEquals(['x', 'z'], Object.keys(a));
+  a.x = 5;
+  assertEquals(['x', 'z'], Object.keys(a));
+
+  let for_in = [];
+  for (let key in a) for_in.push(key);
+  assertEquals(['x', 'z'], for_in);
+  a[Symbol()] = 6;
+  a.w = 7;
+  for_in = [];
+  for (let key in a) for_in.push(key);
+  assertEquals(['x', 'z', 'w'], for_in);
+})();
@@ -0,0 +1,54 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Repeated prototype changes skip subtrees that are still invalid. ICs that
+// revalidated a chain in between must still see the next change.
+
+class A {}
+class B extends A {}
+class C extends B {}
+class D extends A {}
+
+function getX(o) { return o.x; }
+function getY(o) { return o.y; }
+function keys(o) {
+  const result = [];
+  for (const k in o) result.push(k);
+  return result;
+}
+
+const c = new C();
+const d = new D();
+
+// Startup-style patching without any loads in between.
+for (let i = 0; i < 50; ++i) A.prototype['m' + i] = i;
+assertEquals(49, c.m49);
+
+for (let round = 0; round < 5; ++round) {
+  A.prototype.x = round;
+  assertEquals(round, getX(c));
+  assertEquals(round, getX(d));
+  // Shadow on an intermediate prototype after the IC went valid again.
+  B.prototype.x = 'b' + round;
+  assertEquals('b' + round, getX(c));
+  assertEquals(round, getX(d));
+  delete B.prototype.x;
+  assertEquals(round, getX(c));
+  // Several invalidations in a row, then one more after a load.
+  A.prototype.y = 1;
+  A.prototype.z = 2;
+  delete A.prototype.y;
+  assertEquals(undefined, getY(c));
+  A.prototype.y = round;
+  assertEquals(round, getY(c));
+  assertEquals(round, getY(d));
+}
+
+// for-in caches the keys of the prototype chain.
+const before = keys(c);
+C.prototype.extra = 1;
+assertEquals(before.concat('extra').sort(), keys(c).sort());
+delete C.prototype.extra;
+A.prototype.extra2 = 1;
+assertEquals(before.concat('extra2').sort(), keys(c).sort());
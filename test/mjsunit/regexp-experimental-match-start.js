@@ -0,0 +1,54 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+
+// Unanchored regexps whose first character is restricted skip input that
+// can't start a match. Check that matches right after skipped runs, at the
+// end of the input and overlapping partial matches are still found.
+
+function Test(regexp, subject, expectedResult) {
+  assertEquals(%RegexpTypeTag(regexp), 'EXPERIMENTAL');
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+}
+
+const padding = 'x'.repeat(200);
+
+// A single possible first character.
+Test(/abc/, padding + 'abc', ['abc']);
+Test(/abc/, padding + 'ab', null);
+Test(/abc/, padding + 'aabc' + padding, ['abc']);
+Test(/abc/, 'ab' + padding + 'abc', ['abc']);
+Test(/a/, padding + 'a', ['a']);
+Test(/a/, padding, null);
+
+// Several possible first characters, including quantifiers and captures.
+Test(/[0-9]+/, padding + '1234' + padding, ['1234']);
+Test(/(?:foo|bar)baz/, padding + 'foobarbaz', ['barbaz']);
+Test(/(a|b)*c/, padding + 'ababc', ['ababc', 'b']);
+Test(/a*b/, padding + 'aaab', ['aaab']);
+Test(/a{2,3}/, padding + 'a' + padding + 'aaaa', ['aaa']);
+
+// Assertions before the first character.
+Test(/\bword/, padding + ' word', ['word']);
+Test(/\bword/, padding + 'word', null);
+
+// Two-byte subjects and patterns.
+Test(/쁰d/, padding + '쁰쁰d', ['쁰d']);
+Test(/[α-ω]+/, padding + 'ሴαβγ', ['αβγ']);
+Test(/a/, 'ሴ' + padding + 'a', ['a']);
+
+// Patterns that match the empty string can start anywhere.
+Test(/a*/, padding + 'aaa', ['']);
+Test(/(?:)/, padding, ['']);
+
+// Global matching resumes skipping after each match.
+const subject = padding + 'ab' + padding + 'ab' + 'ab';
+assertEquals(['ab', 'ab', 'ab'], subject.match(/ab/g));
+assertEquals(4, subject.split(/ab/).length);
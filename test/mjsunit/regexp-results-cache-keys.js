@@ -0,0 +1,41 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The results caches for split and global regexp matching are keyed on both
+// the subject and the pattern. Alternate patterns on the same subject and
+// check that each lookup gets its own result.
+
+// Only internalized subjects are cached; property keys are internalized.
+function Internalize(s) {
+  return Object.keys({[s]: 0})[0];
+}
+
+const subject = Internalize('a,b;c,d;e'.repeat(600));
+const commas = subject.split(',');
+const semicolons = subject.split(';');
+for (let i = 0; i < 4; i++) {
+  assertEquals(commas, subject.split(','));
+  assertEquals(semicolons, subject.split(';'));
+}
+
+// Returned arrays are copies of the cached ones.
+const first = subject.split(',');
+first[0] = 'mutated';
+assertEquals('a', subject.split(',')[0]);
+
+const letters = /[a-e]/g;
+const punctuation = /[,;]/g;
+const letterMatches = subject.match(letters);
+const punctuationMatches = subject.match(punctuation);
+assertEquals(3000, letterMatches.length);
+assertEquals(2400, punctuationMatches.length);
+for (let i = 0; i < 4; i++) {
+  assertEquals(letterMatches, subject.match(letters));
+  assertEquals(punctuationMatches, subject.match(punctuation));
+}
+
+// Results longer than the cache bound are still correct.
+const long = Internalize('x,'.repeat(0x5000));
+assertEquals(0x5001, long.split(',').length);
+assertEquals(0x5001, long.split(',').length);
@@ -0,0 +1,37 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-regexp-tier-up
+
+// Patterns whose Boyer-Moore lookahead narrows down to a single character
+// skip ahead by scanning for that character, a vector at a time when
+// supported. Check matches at every alignment relative to the vector width,
+// in both subject encodings, and near the end of the subject.
+
+function Test(re, prefix, needle, suffix) {
+  for (let i = 0; i < 40; i++) {
+    const subject = prefix.repeat(i) + needle + suffix;
+    const m = re.exec(subject);
+    assertNotNull(m, `${re} on length ${subject.length}`);
+    assertEquals(prefix.length * i, m.index);
+    assertEquals(needle, m[0]);
+    assertNull(re.exec(prefix.repeat(i) + suffix));
+  }
+}
+
+// One-byte subjects.
+Test(/a/, 'x', 'a', '');
+Test(/xyz\]/, 'y', 'xyz]', 'y');
+Test(/\[ERROR\]/, '[INFO] ', '[ERROR]', ' done');
+Test(/abcd(?:e|f)/, 'b', 'abcdf', 'bbb');
+
+// Two-byte subjects, including characters that collide with the needle
+// modulo the Boyer-Moore table size.
+Test(/a/, 'š', 'a', '');
+Test(/\[ERROR\]/, ' á', '[ERROR]', '一');
+Test(/一b/, '亀', '一b', '亀');
+Test(/q一/, 'xǱ', 'q一', '');
+
+// Case-insensitive patterns narrow down to more than one character.
+Test(/needle/i, 'hay', 'NeEdLe', 'hay');
@@ -0,0 +1,37 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large patterns stay in the interpreter for more executions before tiering
+// up, since their native compilation is expensive.
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1
+// Flags: --allow-natives-syntax --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+const kLatin1 = true;
+
+function HasOnlyBytecode(re) {
+  return %RegexpHasBytecode(re, kLatin1) && !%RegexpHasNativeCode(re, kLatin1);
+}
+
+// A small pattern tiers up after a single tick.
+let small = /^\/users\/(\d+)$/;
+assertTrue(small.test('/users/1'));
+assertTrue(HasOnlyBytecode(small));
+assertTrue(small.test('/users/2'));
+assertFalse(%RegexpHasBytecode(small, kLatin1));
+
+// A generated routing table with a few hundred alternatives.
+const routes = [];
+for (let i = 0; i < 500; i++) routes.push(`\\/api\\/v${i}\\/item_${i}`);
+let large = new RegExp(`^(?:${routes.join('|')})$`);
+
+assertTrue(large.test('/api/v499/item_499'));
+assertTrue(HasOnlyBytecode(large));
+assertFalse(large.test('/api/v7/item_8'));
+assertTrue(HasOnlyBytecode(large));
+
+// The delay is bounded, so hot large patterns still tier up.
+for (let i = 0; i < 20; i++) assertTrue(large.test(`/api/v${i}/item_${i}`));
+assertFalse(%RegexpHasBytecode(large, kLatin1));
+assertTrue(%RegexpHasNativeCode(large, kLatin1));
@@ -0,0 +1,37 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --harmony-struct --allow-natives-syntax
+// Flags: --value-serializer-shared-string-min-length=1024
+
+// Long strings in messages are shared with the receiving isolate instead of
+// being copied. Short strings are still copied.
+
+if (this.Worker) {
+
+(function TestLongStringsAreShared() {
+  function workerCode() {
+    onmessage = function({data}) {
+      postMessage({
+        long_is_shared: %IsSharedString(data.long),
+        long_length: data.long.length,
+        nested_is_shared: %IsSharedString(data.nested[0]),
+        short: data.short,
+      });
+    };
+  }
+
+  let worker = new Worker(workerCode, {type: 'function'});
+  let long = 'config'.repeat(1000);
+  let short = 'x'.repeat(10) + Math.random();
+  worker.postMessage({long, nested: [long + '!'], short});
+  let reply = worker.getMessage();
+  assertTrue(reply.long_is_shared);
+  assertEquals(long.length, reply.long_length);
+  assertTrue(reply.nested_is_shared);
+  assertEquals(short, reply.short);
+  worker.terminate();
+})();
+
+}
@@ -83,3 +83,33 @@ for (var i = 1; i <= 128; i <<= 1); {
     }
   }
 }
+
+// Latin-1 and two-byte ASCII strings long enough to be converted in vector
+// blocks, with the interesting characters at every position of a block.
+(function TestLongLatin1AndTwoByteAscii() {
+  var latin1 = '';
+  for (var c = 0; c < 0x100; c++) latin1 += String.fromCharCode(c);
+  for (var i = 0; i < 40; i++) {
+    var str = 'a'.repeat(i) + latin1 + 'Z'.repeat(i);
+    var expectedLower = '';
+    var expectedUpper = '';
+    for (var j = 0; j < str.length; j++) {
+      expectedLower += str[j].toLowerCase();
+      expectedUpper += str[j].toUpperCase();
+    }
+    assertEquals(expectedLower, str.toLowerCase());
+    assertEquals(expectedUpper, str.toUpperCase());
+    // The same ASCII characters in a two-byte string.
+    var ascii = str.substring(0, i) + latin1.substring(0, 0x80) +
+        str.substring(str.length - i);
+    var twoByte = ('\u1234' + ascii).substring(1);
+    assertEquals(ascii.toLowerCase(), twoByte.toLowerCase());
+    assertEquals(ascii.toUpperCase(), twoByte.toUpperCase());
+  }
+  // Characters whose upper case is not a single Latin-1 character, after a
+  // block that does not need them.
+  var prefix = '\xe0'.repeat(17);
+  assertEquals('\xc0'.repeat(17) + 'SS', (prefix + '\xdf').toUpperCase());
+  assertEquals('\xc0'.repeat(17) + '\u039c', (prefix + '\xb5').toUpperCase());
+  assertEquals('\xc0'.repeat(17) + '\u0178', (prefix + '\xff').toUpperCase());
+})();
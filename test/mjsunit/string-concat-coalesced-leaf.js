@@ -0,0 +1,60 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax
+
+// Appending short strings to a cons string merges them into its last leaf.
+// Check that the content survives for one-byte, two-byte and mixed pieces.
+
+function build(pieces) {
+  let s = "";
+  for (let i = 0; i < pieces.length; i++) {
+    s += pieces[i];
+  }
+  return s;
+}
+
+function check(pieces) {
+  const result = build(pieces);
+  assertEquals(pieces.join(""), result);
+  for (let i = 0, pos = 0; i < pieces.length; i++) {
+    assertEquals(pieces[i], result.substring(pos, pos + pieces[i].length));
+    pos += pieces[i].length;
+  }
+}
+
+const one_byte = [];
+const two_byte = [];
+const mixed = [];
+for (let i = 0; i < 500; i++) {
+  const len = 1 + (i % 15);
+  one_byte.push("abcdefghijklmnopq".substring(0, len));
+  two_byte.push("αβγδεζηθικλμνξοπ".substring(0, len));
+  mixed.push(i % 7 == 3 ? "☃" : String.fromCharCode(65 + i % 26));
+}
+
+check(one_byte);
+check(two_byte);
+check(mixed);
+
+// A long right-hand side is never merged into the leaf.
+check(["a".repeat(20), "b".repeat(20), "c", "d".repeat(64), "e"]);
+
+// The left-hand side stays intact when a later append coalesces its leaf.
+{
+  const base = %ConstructConsString("0123456789abcdef", "xy");
+  const a = base + "A";
+  const b = base + "B";
+  assertEquals("0123456789abcdefxy", base);
+  assertEquals("0123456789abcdefxyA", a);
+  assertEquals("0123456789abcdefxyB", b);
+}
+
+%PrepareFunctionForOptimization(build);
+check(one_byte);
+check(mixed);
+%OptimizeFunctionOnNextCall(build);
+check(one_byte);
+check(two_byte);
+check(mixed);
@@ -0,0 +1,72 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function naiveIndexOf(subject, pattern, start) {
+  outer: for (let i = start; i <= subject.length - pattern.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[i + j] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+// Deterministic pseudo-random strings over a small alphabet, so that the
+// first and last character filter sees many false candidates.
+let seed = 42;
+function random(n) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed % n;
+}
+function randomString(alphabet, length) {
+  let result = '';
+  for (let i = 0; i < length; i++) result += alphabet[random(alphabet.length)];
+  return result;
+}
+
+(function TestRandomPatterns() {
+  for (const alphabet of ['ab', 'abc', 'a€', 'x€y']) {
+    for (let i = 0; i < 300; i++) {
+      const subject = randomString(alphabet, random(200));
+      const pattern = randomString(alphabet, 2 + random(40));
+      const start = random(subject.length + 1);
+      assertEquals(naiveIndexOf(subject, pattern, start),
+                   subject.indexOf(pattern, start));
+    }
+  }
+})();
+
+// Repetitive subjects make the filter bail out to the Two-Way search, both for
+// periodic and for non-periodic patterns.
+(function TestTwoWayFallback() {
+  const patterns = ['a'.repeat(20) + 'b', 'ab' + 'a'.repeat(20),
+                    'a'.repeat(10) + 'b' + 'a'.repeat(10), 'a'.repeat(30),
+                    'a'.repeat(10) + 'b', 'ab', 'aba'];
+  for (const end of ['', 'ba', '€ba', 'b€']) {
+    const subject = 'a'.repeat(5000) + end;
+    for (const pattern of patterns) {
+      for (const start of [0, 17, 4990]) {
+        assertEquals(naiveIndexOf(subject, pattern, start),
+                     subject.indexOf(pattern, start));
+      }
+    }
+  }
+  assertEquals(4990, ('a'.repeat(5000) + 'ba').indexOf('a'.repeat(10) + 'b'));
+  const periodic = 'abaabaab'.repeat(1000);
+  assertEquals(naiveIndexOf(periodic, 'abaabaabaabb', 0),
+               periodic.indexOf('abaabaabaabb'));
+  assertEquals(8000, (periodic + 'abaabaabaabb').indexOf('abaabaabaabb'));
+})();
+
+// split and replaceAll use the same searches.
+(function TestSplitAndReplaceAll() {
+  const subject = ('x'.repeat(40) + 'ab').repeat(50);
+  assertEquals(51, subject.split('xab').length);
+  assertEquals(('x'.repeat(39) + '-').repeat(50),
+               subject.replaceAll('xab', '-'));
+  const two_byte = ('€'.repeat(40) + 'ab').repeat(50);
+  assertEquals(51, two_byte.split('€ab').length);
+  assertEquals(('€'.repeat(39) + '-').repeat(50),
+               two_byte.replaceAll('€ab', '-'));
+})();
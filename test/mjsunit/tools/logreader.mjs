@@ -0,0 +1,31 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import { LogReader } from "../../../tools/logreader.mjs";
+
+(function testAbsoluteFrames() {
+  const reader = new LogReader();
+  assertEquals(
+      [0x1000, 0x2000, 0x3000],
+      reader.processStack(0x1000, 0, ['0x2000', '0x3000']));
+})();
+
+// Frames logged with --prof-compact-ticks are offsets from the previous frame.
+(function testFrameOffsets() {
+  const reader = new LogReader();
+  assertEquals(
+      [0x1000, 0x1010, 0xff0, 0xff0],
+      reader.processStack(0x1000, 0, ['+0x10', '-0x20', '+0x0']));
+  assertEquals(
+      [0x1000, 0x2000, 0x1000, 0x1f00],
+      reader.processStack(0x1000, 0x2000, ['+0x0', '+0xf00']));
+})();
+
+(function testFrameOffsetsBigInt() {
+  const useBigIntAddresses = true;
+  const reader = new LogReader(false, false, useBigIntAddresses);
+  assertEquals(
+      [0x7fff00001000n, 0x7fff00001010n, 0x7ffeffffffffn],
+      reader.processStack(0x7fff00001000n, 0n, ['+0x10', '-0x1011']));
+})();
@@ -0,0 +1,42 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --max-property-transitions-per-map=3
+
+// Objects that get their properties in many different orders stop adding
+// transitions once a map has enough of them and share normalized maps.
+// Property order and values are preserved.
+
+function Point() {}
+
+const kNames = ['a', 'b', 'c', 'd', 'e'];
+
+function build(order) {
+  const o = new Point();
+  for (const name of order) o[name] = name.charCodeAt(0);
+  return o;
+}
+
+function rotate(k) {
+  return kNames.slice(k).concat(kNames.slice(0, k));
+}
+
+// The first three first-property choices still get fast maps.
+const fast = [build(rotate(0)), build(rotate(1)), build(rotate(2))];
+for (const o of fast) assertTrue(%HasFastProperties(o));
+assertTrue(%HaveSameMap(fast[0], build(rotate(0))));
+
+// Further orders go to dictionary mode and share a map.
+const slow = [build(rotate(3)), build(rotate(4))];
+for (const o of slow) assertFalse(%HasFastProperties(o));
+assertTrue(%HaveSameMap(slow[0], slow[1]));
+
+for (let k = 0; k < kNames.length; ++k) {
+  const o = k < 3 ? fast[k] : slow[k - 3];
+  assertEquals(rotate(k), Object.keys(o));
+  for (const name of kNames) assertEquals(name.charCodeAt(0), o[name]);
+}
+
+// Existing transitions keep being used.
+assertTrue(%HasFastProperties(build(rotate(1))));
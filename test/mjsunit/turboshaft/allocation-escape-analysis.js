@@ -0,0 +1,42 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --allow-natives-syntax
+// Flags: --turboshaft-allocation-escape-analysis
+
+function makePoint(x, y) {
+  return {x, y};
+}
+
+function length(x, y, deopt) {
+  const p = makePoint(x, y);
+  if (deopt) {
+    // The point has to be materialized when deoptimizing here.
+    %DeoptimizeNow();
+    return p.x + p.y;
+  }
+  return p.x * p.x + p.y * p.y;
+}
+
+%PrepareFunctionForOptimization(length);
+assertEquals(25, length(3, 4, false));
+assertEquals(25, length(3, 4, false));
+%OptimizeFunctionOnNextCall(length);
+assertEquals(25, length(3, 4, false));
+assertEquals(7, length(3, 4, true));
+
+function sum(n) {
+  const acc = {value: 0};
+  for (let i = 0; i < n; i++) {
+    acc.value += i;
+  }
+  return acc.value;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(45, sum(10));
+assertEquals(45, sum(10));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(45, sum(10));
+assertEquals(0, sum(0));
@@ -0,0 +1,43 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --allow-natives-syntax
+// Flags: --turboshaft-bounds-check-elimination
+
+function sum(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    s += a[i];
+  }
+  return s;
+}
+
+function sumUpTo(a, n) {
+  let s = 0;
+  // `i < n` doesn't imply that `i < a.length`.
+  for (let i = 0; i < n; i++) {
+    s += a[i];
+  }
+  return s;
+}
+
+const u8 = new Uint8Array([1, 2, 3, 4, 5]);
+const array = [1, 2, 3, 4, 5];
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(15, sum(u8));
+assertEquals(15, sum(u8));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(15, sum(u8));
+assertEquals(0, sum(new Uint8Array(0)));
+
+%PrepareFunctionForOptimization(sumUpTo);
+assertEquals(15, sumUpTo(array, 5));
+assertEquals(15, sumUpTo(array, 5));
+%OptimizeFunctionOnNextCall(sumUpTo);
+assertEquals(15, sumUpTo(array, 5));
+assertOptimized(sumUpTo);
+// Reading out of bounds has to deoptimize.
+assertEquals(NaN, sumUpTo(array, 6));
+assertUnoptimized(sumUpTo);
@@ -0,0 +1,77 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --allow-natives-syntax
+// Flags: --turboshaft-typed-array-vectorization
+
+function add(a, b, c) {
+  for (let i = 0; i < c.length; i++) {
+    c[i] = a[i] + b[i];
+  }
+}
+
+function test(Type, length) {
+  const a = new Type(length);
+  const b = new Type(length);
+  for (let i = 0; i < length; i++) {
+    a[i] = i * 3 + 0.25;
+    b[i] = 100 - i;
+  }
+  const expected = new Type(length);
+  for (let i = 0; i < length; i++) expected[i] = a[i] + b[i];
+  const c = new Type(length);
+  add(a, b, c);
+  assertEquals(expected, c);
+}
+
+%PrepareFunctionForOptimization(add);
+test(Float32Array, 7);
+test(Float32Array, 7);
+%OptimizeFunctionOnNextCall(add);
+// The lengths aren't multiples of the number of lanes.
+test(Float32Array, 7);
+test(Float32Array, 35);
+test(Float32Array, 0);
+
+function addInt(a, b, c) {
+  for (let i = 0; i < c.length; i++) {
+    c[i] = (a[i] + b[i]) ^ 0x55;
+  }
+}
+
+for (const Type of [Int32Array, Uint8Array, Int16Array]) {
+  const length = 45;
+  const a = new Type(length);
+  const b = new Type(length);
+  for (let i = 0; i < length; i++) {
+    a[i] = i * 7;
+    b[i] = 300 - i;
+  }
+  const expected = new Type(length);
+  for (let i = 0; i < length; i++) expected[i] = (a[i] + b[i]) ^ 0x55;
+  const c = new Type(length);
+  const f = new Function('return ' + addInt.toString())();
+  %PrepareFunctionForOptimization(f);
+  f(a, b, new Type(length));
+  %OptimizeFunctionOnNextCall(f);
+  f(a, b, c);
+  assertEquals(expected, c);
+}
+
+// Overlapping views have to run element by element.
+(function testOverlap() {
+  function shift(a, b) {
+    for (let i = 0; i < b.length; i++) {
+      b[i] = a[i] + 1;
+    }
+  }
+  const buffer = new ArrayBuffer(4 * 40);
+  const a = new Int32Array(buffer, 0, 36);
+  const b = new Int32Array(buffer, 4, 36);
+  %PrepareFunctionForOptimization(shift);
+  shift(new Int32Array(36), new Int32Array(36));
+  %OptimizeFunctionOnNextCall(shift);
+  shift(a, b);
+  for (let i = 0; i < 36; i++) assertEquals(i + 1, b[i]);
+})();
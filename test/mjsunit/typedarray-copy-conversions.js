@@ -0,0 +1,49 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+const kCtors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array,
+];
+if (typeof Float16Array !== 'undefined') kCtors.push(Float16Array);
+
+function expected(ctor, values) {
+  const result = new ctor(values.length);
+  for (let i = 0; i < values.length; i++) result[i] = values[i];
+  return Array.from(result);
+}
+
+const kSmis = [0, 1, -1, 127, 128, 255, 256, -129, 32767, -32769, 1 << 30];
+const kDoubles = [0.5, 1.5, 2.5, -0.5, 254.5, 255.5, -1e10, 1e10, 2 ** 32 + 3,
+                  NaN, Infinity, -Infinity, -0, 3.4e38, 1e-50];
+const kHoleySmis = [1, , 3, , -5];
+const kHoleyDoubles = [1.5, , 3.5, , -5.5];
+
+for (const ctor of kCtors) {
+  for (const values of [kSmis, kDoubles, kHoleySmis, kHoleyDoubles]) {
+    const want = expected(ctor, values);
+    // Construction from a JSArray.
+    assertEquals(want, Array.from(new ctor(values)));
+
+    // TypedArray.prototype.set from a JSArray, with an offset and into a
+    // shared buffer.
+    const target = new ctor(values.length + 2);
+    target.set(values, 2);
+    assertEquals([0, 0, ...want], Array.from(target));
+    const shared = new ctor(
+        new SharedArrayBuffer(ctor.BYTES_PER_ELEMENT * values.length));
+    shared.set(values);
+    assertEquals(want, Array.from(shared));
+
+    // Copies between typed arrays of all kinds.
+    for (const source_ctor of kCtors) {
+      const source = new source_ctor(values);
+      const want_from_source = expected(ctor, Array.from(source));
+      assertEquals(want_from_source, Array.from(new ctor(source)));
+      const dest = new ctor(values.length);
+      dest.set(source);
+      assertEquals(want_from_source, Array.from(dest));
+    }
+  }
+}
@@ -0,0 +1,114 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// indexOf, lastIndexOf and includes on TypedArrays and lastIndexOf on
+// JSArrays use vectorized searches for long enough ranges. Check every match
+// position against a plain loop.
+
+const kLength = 300;
+
+const typedArrayConstructors = [
+  Uint8Array, Int8Array, Uint16Array, Int16Array, Uint32Array, Int32Array,
+  Uint8ClampedArray, Float32Array, Float64Array, BigInt64Array,
+  BigUint64Array
+];
+
+function naiveIndexOf(array, value, from) {
+  for (let i = from; i < array.length; ++i) {
+    if (array[i] === value) return i;
+  }
+  return -1;
+}
+
+function naiveLastIndexOf(array, value, from) {
+  for (let i = from; i >= 0; --i) {
+    if (array[i] === value) return i;
+  }
+  return -1;
+}
+
+for (const constructor of typedArrayConstructors) {
+  const isBigInt = constructor.name.startsWith('Big');
+  const convert = isBigInt ? BigInt : Number;
+  const fill = convert(-7);
+  const needle = convert(42);
+  // Sub-arrays starting at odd offsets exercise the unaligned prologues.
+  for (const offset of [0, 1]) {
+    const buffer = new ArrayBuffer(
+        (kLength + offset) * constructor.BYTES_PER_ELEMENT);
+    const array = new constructor(buffer,
+                                  offset * constructor.BYTES_PER_ELEMENT);
+    array.fill(fill);
+    assertEquals(-1, array.indexOf(needle));
+    assertEquals(-1, array.lastIndexOf(needle));
+    assertFalse(array.includes(needle));
+    for (const position of [0, 1, 15, 16, 17, 100, kLength - 2, kLength - 1]) {
+      array[position] = needle;
+      for (const from of [0, position, position + 1, kLength - 1]) {
+        assertEquals(naiveIndexOf(array, needle, from),
+                     array.indexOf(needle, from));
+        assertEquals(naiveLastIndexOf(array, needle, from),
+                     array.lastIndexOf(needle, from));
+        assertEquals(naiveIndexOf(array, needle, from) != -1,
+                     array.includes(needle, from));
+      }
+      array[position] = fill;
+    }
+  }
+}
+
+// Floating point elements compare by value: -0 matches +0, NaN matches
+// nothing (except for includes).
+for (const constructor of [Float32Array, Float64Array]) {
+  const array = new constructor(kLength).fill(1.5);
+  array[200] = -0;
+  array[250] = NaN;
+  assertEquals(200, array.indexOf(0));
+  assertEquals(200, array.lastIndexOf(0));
+  assertEquals(200, array.indexOf(-0));
+  assertTrue(array.includes(0));
+  assertEquals(-1, array.indexOf(NaN));
+  assertEquals(-1, array.lastIndexOf(NaN));
+  assertTrue(array.includes(NaN));
+  assertEquals(1, array.indexOf(1.5, 1));
+  assertEquals(kLength - 1, array.lastIndexOf(1.5));
+}
+
+// Values that do not fit the element type are never found.
+{
+  const array = new Uint8Array(kLength);
+  assertEquals(-1, array.indexOf(256));
+  assertEquals(-1, array.lastIndexOf(-1));
+  assertFalse(array.includes(0.5));
+  const int16 = new Int16Array(kLength).fill(-1);
+  assertEquals(-1, int16.indexOf(0xffff));
+  assertEquals(kLength - 1, int16.lastIndexOf(-1));
+}
+
+// Array.prototype.lastIndexOf on Smi and object arrays.
+{
+  const smis = [];
+  for (let i = 0; i < kLength; ++i) smis.push(i % 50);
+  assertEquals(kLength - 50 + 7, smis.lastIndexOf(7));
+  assertEquals(207, smis.lastIndexOf(7, 249));
+  assertEquals(-1, smis.lastIndexOf(50));
+  assertEquals(7, smis.lastIndexOf(7, 56));
+
+  const o = {};
+  const objects = [];
+  for (let i = 0; i < kLength; ++i) objects.push({});
+  objects[123] = o;
+  objects[10] = o;
+  assertEquals(123, objects.lastIndexOf(o));
+  assertEquals(10, objects.lastIndexOf(o, 122));
+  assertEquals(-1, objects.lastIndexOf({}));
+  objects[150] = undefined;
+  assertEquals(150, objects.lastIndexOf(undefined));
+
+  // Numbers and strings still compare by value.
+  const mixed = [];
+  for (let i = 0; i < kLength; ++i) mixed.push(i % 2 ? 'x' + i : i + 0.5);
+  assertEquals(kLength - 1, mixed.lastIndexOf('x' + (kLength - 1)));
+  assertEquals(100, mixed.lastIndexOf(100.5));
+}
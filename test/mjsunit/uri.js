@@ -98,3 +98,26 @@ test("ab\u1234<\u0123");
   assertEquals('abc', encodeURI('abc'));
   assertEquals('abc', decodeURI('abc'));
 })();
+
+(function TestLongOneByteStrings() {
+  // Long enough to be encoded in vector blocks, with characters that need
+  // escaping at every position of a block.
+  var chars = '';
+  for (var c = 0; c < 0x100; c++) chars += String.fromCharCode(c);
+  for (var i = 0; i < 40; i++) {
+    var str = 'a'.repeat(i) + chars + 'Z'.repeat(i);
+    var expectedComponent = '';
+    var expectedURI = '';
+    for (var j = 0; j < str.length; j++) {
+      expectedComponent += encodeURIComponent(str[j]);
+      expectedURI += encodeURI(str[j]);
+    }
+    assertEquals(expectedComponent, encodeURIComponent(str));
+    assertEquals(expectedURI, encodeURI(str));
+    assertEquals(str, decodeURIComponent(encodeURIComponent(str)));
+  }
+  var unescaped = 'abcdefghijklmnopqrstuvwxyz0123456789';
+  assertEquals(unescaped, encodeURIComponent(unescaped));
+  assertEquals(unescaped, decodeURIComponent(unescaped));
+  assertEquals('\xe9'.repeat(20), decodeURI('\xe9'.repeat(20)));
+})();
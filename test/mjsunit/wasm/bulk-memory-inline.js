@@ -0,0 +1,88 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff --no-wasm-lazy-compilation
+
+// memory.copy and memory.fill with small constant sizes are inlined by the
+// optimizing compiler. Check every inlined size for correctness, overlap and
+// out-of-bounds behavior.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kSizes = [0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 33, 48, 63, 64, 65];
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, 1);
+builder.exportMemoryAs('memory');
+for (const size of kSizes) {
+  builder.addFunction('copy' + size, kSig_v_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      ...wasmI32Const(size),
+      kNumericPrefix, kExprMemoryCopy, 0, 0,
+    ]).exportFunc();
+  builder.addFunction('fill' + size, kSig_v_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      ...wasmI32Const(size),
+      kNumericPrefix, kExprMemoryFill, 0,
+    ]).exportFunc();
+}
+const instance = builder.instantiate();
+const memory = new Uint8Array(instance.exports.memory.buffer);
+
+function reset() {
+  for (let i = 0; i < 1024; ++i) memory[i] = i & 0xff;
+  memory.fill(0, memory.length - 1024);
+}
+
+function expectedCopy(dst, src, size) {
+  const expected = new Uint8Array(1024);
+  for (let i = 0; i < 1024; ++i) expected[i] = i & 0xff;
+  expected.copyWithin(dst, src, src + size);
+  return expected;
+}
+
+for (const size of kSizes) {
+  const copy = instance.exports['copy' + size];
+  const fill = instance.exports['fill' + size];
+
+  // Disjoint and overlapping in both directions.
+  for (const [dst, src] of [[512, 0], [10, 13], [13, 10], [100, 100]]) {
+    reset();
+    copy(dst, src);
+    assertEquals(expectedCopy(dst, src, size), memory.slice(0, 1024));
+  }
+
+  reset();
+  fill(200, 0x1a7);  // Only the low byte is stored.
+  for (let i = 0; i < 1024; ++i) {
+    const inside = i >= 200 && i < 200 + size;
+    assertEquals(inside ? 0xa7 : i & 0xff, memory[i]);
+  }
+
+  // Ranges ending exactly at the end of memory are in bounds.
+  reset();
+  fill(memory.length - size, 0x55);
+  for (let i = memory.length - size; i < memory.length; ++i) {
+    assertEquals(0x55, memory[i]);
+  }
+  copy(0, memory.length - size);
+  copy(memory.length - size, 0);
+
+  // Out-of-bounds ranges trap without writing anything.
+  reset();
+  assertTraps(kTrapMemOutOfBounds, () => fill(memory.length - size + 1, 1));
+  assertTraps(kTrapMemOutOfBounds,
+              () => copy(memory.length - size + 1, 0));
+  assertTraps(kTrapMemOutOfBounds,
+              () => copy(0, memory.length - size + 1));
+  assertTraps(kTrapMemOutOfBounds, () => fill(-1, 1));
+  for (let i = 0; i < 1024; ++i) assertEquals(i & 0xff, memory[i]);
+  for (let i = memory.length - 1024; i < memory.length; ++i) {
+    assertEquals(0, memory[i]);
+  }
+}
@@ -0,0 +1,51 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-inlining-call-indirect --liftoff
+// Flags: --wasm-inlining-max-size=0 --no-jit-fuzzing
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// A monomorphic call_indirect whose target is not inlined is called directly
+// behind a target check; other targets still get the full signature check.
+(function TestSpeculativeTargetWithSubtypedSignature() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const super_sig = builder.addType(kSig_i_ii, kNoSuperType, false);
+  const sub_sig = builder.addType(kSig_i_ii, super_sig);
+  const other_sig = builder.addType(kSig_i_i);
+
+  const add = builder.addFunction('add', sub_sig)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add]);
+  const mul = builder.addFunction('mul', super_sig)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Mul]);
+  const neg = builder.addFunction('neg', other_sig)
+      .addBody([kExprI32Const, 0, kExprLocalGet, 0, kExprI32Sub]);
+
+  const table = builder.addTable(kWasmFuncRef, 3);
+  builder.addActiveElementSegment(table.index, wasmI32Const(0), [
+    [kExprRefFunc, add.index],
+    [kExprRefFunc, mul.index],
+    [kExprRefFunc, neg.index],
+  ], kWasmFuncRef);
+
+  builder.addFunction('main', makeSig([kWasmI32, kWasmI32, kWasmI32],
+                                      [kWasmI32]))
+      .addBody([
+        kExprLocalGet, 0,
+        kExprLocalGet, 1,
+        kExprLocalGet, 2,
+        kExprCallIndirect, super_sig, table.index,
+      ])
+      .exportFunc();
+
+  const wasm = builder.instantiate().exports;
+  assertEquals(42, wasm.main(12, 30, 0));
+  %WasmTierUpFunction(wasm.main);
+  assertEquals(42, wasm.main(12, 30, 0));
+  assertEquals(360, wasm.main(12, 30, 1));
+  assertTraps(kTrapFuncSigMismatch, () => wasm.main(12, 30, 2));
+  assertTraps(kTrapTableOutOfBounds, () => wasm.main(12, 30, 3));
+  assertEquals(42, wasm.main(12, 30, 0));
+})();
@@ -0,0 +1,36 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --wasm-lazy-compile-callees
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testCallees() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const imp = builder.addImport('m', 'imp', kSig_i_i);
+  const inc = builder.addFunction('inc', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add]);
+  const dbl = builder.addFunction('double', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 0, kExprI32Add]);
+  const tail = builder.addFunction('tail', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprReturnCall, inc.index]);
+  builder.addFunction('main', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprCallFunction, imp,
+        kExprCallFunction, inc.index,
+        kExprCallFunction, dbl.index,
+        kExprCallFunction, inc.index,
+        kExprCallFunction, tail.index,
+      ])
+      .exportFunc();
+  builder.addFunction('double_again', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, dbl.index])
+      .exportFunc();
+  const instance = builder.instantiate({m: {imp: x => x - 1}});
+  // ((3 - 1 + 1) * 2 + 1) + 1
+  assertEquals(8, instance.exports.main(3));
+  assertEquals(8, instance.exports.main(3));
+  assertEquals(10, instance.exports.double_again(5));
+})();
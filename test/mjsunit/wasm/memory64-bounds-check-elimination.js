@@ -0,0 +1,67 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff --no-wasm-lazy-compilation
+
+// Bounds checks on memory64 are skipped or left to the trap handler when the
+// index is known to be small. Accesses must still trap exactly when they are
+// out of bounds.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addMemory64(1, 1);
+builder.exportMemoryAs('memory');
+
+// Index zero-extended from 32 bits.
+builder.addFunction('load_u32', kSig_i_i)
+  .addBody([
+    kExprLocalGet, 0,
+    kExprI64UConvertI32,
+    kExprI32LoadMem, 0, 0,
+  ]).exportFunc();
+// Index masked to 8 bits: always in bounds.
+builder.addFunction('load_masked', makeSig([kWasmI64], [kWasmI32]))
+  .addBody([
+    kExprLocalGet, 0,
+    ...wasmI64Const(0xff),
+    kExprI64And,
+    kExprI32LoadMem, 0, 0,
+  ]).exportFunc();
+// Index shifted right: at most 0xffff.
+builder.addFunction('load_shifted', makeSig([kWasmI64], [kWasmI32]))
+  .addBody([
+    kExprLocalGet, 0,
+    ...wasmI64Const(48),
+    kExprI64ShrU,
+    kExprI32LoadMem, 0, 0,
+  ]).exportFunc();
+// Unknown index.
+builder.addFunction('load_i64', makeSig([kWasmI64], [kWasmI32]))
+  .addBody([
+    kExprLocalGet, 0,
+    kExprI32LoadMem, 0, 0,
+  ]).exportFunc();
+
+const instance = builder.instantiate();
+const exports = instance.exports;
+const view = new DataView(exports.memory.buffer);
+view.setInt32(0xff, 0x12345678, true);
+view.setInt32(kPageSize - 4, -7, true);
+
+assertEquals(0x12345678, exports.load_u32(0xff));
+assertEquals(-7, exports.load_u32(kPageSize - 4));
+assertTraps(kTrapMemOutOfBounds, () => exports.load_u32(kPageSize - 3));
+assertTraps(kTrapMemOutOfBounds, () => exports.load_u32(-1));
+
+assertEquals(0x12345678, exports.load_masked(0xffn));
+assertEquals(0x12345678, exports.load_masked(-1n));
+assertEquals(0x12345678, exports.load_masked(0x1234500ffn));
+
+assertEquals(-7, exports.load_shifted(BigInt(kPageSize - 4) << 48n));
+assertTraps(kTrapMemOutOfBounds, () => exports.load_shifted(-1n));
+
+assertEquals(-7, exports.load_i64(BigInt(kPageSize - 4)));
+assertTraps(kTrapMemOutOfBounds, () => exports.load_i64(1n << 40n));
+assertTraps(kTrapMemOutOfBounds, () => exports.load_i64(-1n));
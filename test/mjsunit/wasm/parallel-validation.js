@@ -0,0 +1,42 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-wasm-lazy-validation
+
+// Function bodies of big modules are validated in parallel, largest first.
+// The reported error must still be the one of the first invalid function.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kNumFunctions = 200;
+
+function buildModule(invalid_functions) {
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < kNumFunctions; ++i) {
+    // Later functions are bigger, so they are validated first.
+    const body = [];
+    for (let j = 0; j < 10 * i; ++j) {
+      body.push(kExprLocalGet, 0, kExprDrop);
+    }
+    if (invalid_functions.includes(i)) {
+      body.push(kExprI64Const, 0);  // Wrong return type.
+    } else {
+      body.push(kExprLocalGet, 0);
+    }
+    builder.addFunction('f' + i, kSig_i_i).addBody(body);
+  }
+  return builder.toBuffer();
+}
+
+assertTrue(WebAssembly.validate(buildModule([])));
+new WebAssembly.Module(buildModule([]));
+
+for (const invalid of [[0], [7, 190], [150, 3], [199], [42, 43, 44]]) {
+  const bytes = buildModule(invalid);
+  assertFalse(WebAssembly.validate(bytes));
+  const first = Math.min(...invalid);
+  assertThrows(
+      () => new WebAssembly.Module(bytes), WebAssembly.CompileError,
+      new RegExp(`Compiling function #${first}:"f${first}" failed`));
+}
@@ -0,0 +1,95 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-liftoff --no-wasm-lazy-compilation
+
+// Loads of constant-index elements of fresh arrays are forwarded from the
+// stores that initialized them, which lets the allocation be removed when
+// nothing else uses the array.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function ArrayNewFixedGetConstantIndex() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const array = builder.addArray(kWasmI32, true);
+  builder.addFunction("sum", kSig_i_ii)
+    .addLocals(wasmRefType(array), 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      ...wasmI32Const(7),
+      kGCPrefix, kExprArrayNewFixed, array, 3,
+      kExprLocalSet, 2,
+      kExprLocalGet, 2, ...wasmI32Const(0), kGCPrefix, kExprArrayGet, array,
+      kExprLocalGet, 2, ...wasmI32Const(1), kGCPrefix, kExprArrayGet, array,
+      kExprI32Add,
+      kExprLocalGet, 2, ...wasmI32Const(2), kGCPrefix, kExprArrayGet, array,
+      kExprI32Add,
+    ]).exportFunc();
+  const instance = builder.instantiate();
+  const sum = instance.exports.sum;
+  assertEquals(10, sum(1, 2));
+  %WasmTierUpFunction(sum);
+  assertEquals(10, sum(1, 2));
+  assertEquals(7, sum(-3, 3));
+})();
+
+(function ArraySetOverwritesElement() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const array = builder.addArray(kWasmI32, true);
+  builder.addFunction("get", kSig_i_iii)
+    .addLocals(wasmRefType(array), 1)
+    .addBody([
+      ...wasmI32Const(10),
+      ...wasmI32Const(20),
+      kGCPrefix, kExprArrayNewFixed, array, 2,
+      kExprLocalSet, 3,
+      // Constant index.
+      kExprLocalGet, 3, ...wasmI32Const(0), kExprLocalGet, 0,
+      kGCPrefix, kExprArraySet, array,
+      // Dynamic index: invalidates every element.
+      kExprLocalGet, 3, kExprLocalGet, 1, kExprLocalGet, 2,
+      kGCPrefix, kExprArraySet, array,
+      kExprLocalGet, 3, ...wasmI32Const(0), kGCPrefix, kExprArrayGet, array,
+      kExprLocalGet, 3, ...wasmI32Const(1), kGCPrefix, kExprArrayGet, array,
+      kExprI32Sub,
+    ]).exportFunc();
+  const instance = builder.instantiate();
+  const get = instance.exports.get;
+  for (let run = 0; run < 2; ++run) {
+    assertEquals(5 - 20, get(5, 1, 0));
+    assertEquals(5 - 30, get(5, 1, 30));
+    assertEquals(30 - 20, get(5, 0, 30));
+    assertTraps(kTrapArrayOutOfBounds, () => get(5, 2, 30));
+    %WasmTierUpFunction(get);
+  }
+})();
+
+(function EscapingArrayIsReloaded() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const array = builder.addArray(kWasmI32, true);
+  const clobber = builder.addFunction("clobber",
+      makeSig([wasmRefType(array)], []))
+    .addBody([
+      kExprLocalGet, 0, ...wasmI32Const(0), ...wasmI32Const(42),
+      kGCPrefix, kExprArraySet, array,
+    ]);
+  builder.addFunction("get", kSig_i_i)
+    .addLocals(wasmRefType(array), 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprArrayNewFixed, array, 1,
+      kExprLocalTee, 1,
+      kExprCallFunction, clobber.index,
+      kExprLocalGet, 1, ...wasmI32Const(0), kGCPrefix, kExprArrayGet, array,
+    ]).exportFunc();
+  const instance = builder.instantiate();
+  const get = instance.exports.get;
+  assertEquals(42, get(1));
+  %WasmTierUpFunction(get);
+  assertEquals(42, get(1));
+})();
@@ -0,0 +1,89 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The interpreter fuses i32.eqz followed by br_if into a single instruction.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function BrIfEqzFromSlot() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Counts how often the loop body runs until the parameter reaches zero.
+  builder.addFunction("count", kSig_i_i)
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 0,
+          kExprI32Eqz,
+          kExprBrIf, 1,
+          kExprLocalGet, 0,
+          ...wasmI32Const(1),
+          kExprI32Sub,
+          kExprLocalSet, 0,
+          kExprLocalGet, 1,
+          ...wasmI32Const(1),
+          kExprI32Add,
+          kExprLocalSet, 1,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd,
+      kExprLocalGet, 1,
+    ]).exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(0, instance.exports.count(0));
+  assertEquals(1, instance.exports.count(1));
+  assertEquals(100, instance.exports.count(100));
+})();
+
+(function BrIfEqzFromRegister() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Same as above, but the condition is the result of the previous
+  // instruction instead of a local.
+  builder.addFunction("count", kSig_i_i)
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1,
+          ...wasmI32Const(1),
+          kExprI32Add,
+          kExprLocalSet, 1,
+          kExprLocalGet, 0,
+          ...wasmI32Const(1),
+          kExprI32Sub,
+          kExprLocalTee, 0,
+          kExprI32Eqz,
+          kExprBrIf, 1,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd,
+      kExprLocalGet, 1,
+    ]).exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(1, instance.exports.count(1));
+  assertEquals(7, instance.exports.count(7));
+})();
+
+(function BrIfEqzWithResult() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Branches to a block with a result are not fused, but must still work.
+  builder.addFunction("select", kSig_i_ii)
+    .addBody([
+      kExprBlock, kWasmI32,
+        ...wasmI32Const(11),
+        kExprLocalGet, 0,
+        kExprI32Eqz,
+        kExprBrIf, 0,
+        kExprDrop,
+        kExprLocalGet, 1,
+      kExprEnd,
+    ]).exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(11, instance.exports.select(0, 22));
+  assertEquals(22, instance.exports.select(1, 22));
+  assertEquals(22, instance.exports.select(-1, 22));
+})();
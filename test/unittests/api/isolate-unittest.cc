@@ -8,6 +8,7 @@
 #include "include/v8-platform.h"
 #include "include/v8-template.h"
 #include "src/base/platform/semaphore.h"
+#include "src/heap/heap.h"
 #include "src/init/v8.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -68,6 +69,46 @@ TEST_F(IsolateTest, MemoryPressureNotificationBackground) {
   v8::platform::PumpMessageLoop(internal::V8::GetCurrentPlatform(), isolate());
 }
 
+// Check that resetting an isolate drops the objects and pending microtasks of
+// the previous workload, and that the isolate remains usable.
+TEST_F(IsolateTest, ResetForReuse) {
+  auto Run = [&](Local<Context> context, const char* script) {
+    Context::Scope scope(context);
+    Local<String> source =
+        String::NewFromUtf8(isolate(), script).ToLocalChecked();
+    return Script::Compile(context, source)
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+  };
+
+  isolate()->SetMicrotasksPolicy(MicrotasksPolicy::kExplicit);
+  Global<Object> weak_global;
+  {
+    HandleScope scope(isolate());
+    Local<Context> context = Context::New(isolate());
+    Run(context, "var big = new Array(10000).fill({});");
+    Run(context, "Promise.resolve().then(() => big);");
+    weak_global.Reset(isolate(), context->Global());
+    weak_global.SetWeak();
+  }
+
+  {
+    // The GC must not find the context through stale stack slots.
+    internal::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        reinterpret_cast<internal::Isolate*>(isolate())->heap());
+    isolate()->ResetForReuse();
+  }
+  EXPECT_TRUE(weak_global.IsEmpty());
+
+  {
+    HandleScope scope(isolate());
+    Local<Context> context = Context::New(isolate());
+    EXPECT_EQ(3, Run(context, "1 + 2")->Int32Value(context).FromJust());
+  }
+  isolate()->SetMicrotasksPolicy(MicrotasksPolicy::kAuto);
+}
+
 using IncumbentContextTest = TestWithIsolate;
 
 // Check that Isolate::GetIncumbentContext() returns the correct one in basic
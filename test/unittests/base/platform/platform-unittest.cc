@@ -76,6 +76,28 @@ TEST(OS, RemapPages) {
   }
 }
 
+TEST(OS, AdviseHugePages) {
+  if constexpr (OS::IsHugePageAdviceSupported()) {
+    const size_t size = 2 * OS::kHugePageSize;
+    void* memory = OS::Allocate(nullptr, size, OS::kHugePageSize,
+                                OS::MemoryPermission::kReadWrite);
+    ASSERT_TRUE(memory);
+
+    // The advice is only rejected by kernels without transparent huge page
+    // support.
+    FILE* thp = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+    const bool advised = OS::AdviseHugePages(memory, size);
+    if (thp) {
+      EXPECT_TRUE(advised);
+      fclose(thp);
+    }
+    memset(memory, 0xab, size);
+    EXPECT_EQ(0xab, static_cast<uint8_t*>(memory)[size - 1]);
+
+    OS::Free(memory, size);
+  }
+}
+
 #ifdef V8_TARGET_OS_LINUX
 TEST(OS, ParseProcMaps) {
   // Truncated
@@ -0,0 +1,114 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/schubfach-dtoa.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/base/numbers/bignum-dtoa.h"
+#include "src/base/numbers/double.h"
+#include "src/base/utils/random-number-generator.h"
+#include "test/unittests/gay-shortest.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+
+using SchubfachDtoaTest = ::testing::Test;
+
+namespace base {
+namespace test_schubfach_dtoa {
+
+static const int kBufferSize = 100;
+
+TEST_F(SchubfachDtoaTest, SchubfachDtoaVariousDoubles) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  double min_double = 5e-324;
+  SchubfachDtoa(min_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5", buffer.begin()));
+  CHECK_EQ(-323, point);
+
+  double max_double = 1.7976931348623157e308;
+  SchubfachDtoa(max_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("17976931348623157", buffer.begin()));
+  CHECK_EQ(309, point);
+
+  SchubfachDtoa(4294967272.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4294967272", buffer.begin()));
+  CHECK_EQ(10, point);
+
+  SchubfachDtoa(1000.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(4, point);
+
+  SchubfachDtoa(4.1855804968213567e298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4185580496821357", buffer.begin()));
+  CHECK_EQ(299, point);
+
+  SchubfachDtoa(5.5626846462680035e-309, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5562684646268003", buffer.begin()));
+  CHECK_EQ(-308, point);
+
+  // Powers of two, whose lower boundary is closer than the upper one.
+  SchubfachDtoa(9007199254740992.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("9007199254740992", buffer.begin()));
+  CHECK_EQ(16, point);
+
+  SchubfachDtoa(2.2250738585072014e-308, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("22250738585072014", buffer.begin()));
+  CHECK_EQ(-307, point);
+}
+
+TEST_F(SchubfachDtoaTest, SchubfachDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    double v = current_test.v;
+    SchubfachDtoa(v, buffer, &length, &point);
+    CHECK_GE(kSchubfachDtoaMaximalLength, length);
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+}
+
+// Compares against BignumDtoa for random bit patterns, which cover denormals
+// and the whole exponent range.
+TEST_F(SchubfachDtoaTest, SchubfachDtoaMatchesBignumDtoa) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  char expected_container[kBufferSize];
+  Vector<char> expected(expected_container, kBufferSize);
+  int length;
+  int point;
+  int expected_length;
+  int expected_point;
+
+  RandomNumberGenerator rng(42);
+  for (int i = 0; i < 100000; ++i) {
+    uint64_t bits;
+    rng.NextBytes(&bits, sizeof(bits));
+    double v = Double(bits & ~Double::kSignMask).value();
+    if (Double(v).IsSpecial() || v == 0) continue;
+    SchubfachDtoa(v, buffer, &length, &point);
+    BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, expected, &expected_length,
+               &expected_point);
+    expected[expected_length] = '\0';
+    CHECK_EQ(expected_point, point);
+    CHECK_EQ(0, strcmp(expected.begin(), buffer.begin()));
+  }
+}
+
+}  // namespace test_schubfach_dtoa
+}  // namespace base
+}  // namespace v8
@@ -12,6 +12,12 @@ TEST(SysInfoTest, NumberOfProcessors) {
   EXPECT_LT(0, SysInfo::NumberOfProcessors());
 }
 
+TEST(SysInfoTest, NumberOfAvailableProcessors) {
+  EXPECT_LT(0, SysInfo::NumberOfAvailableProcessors());
+  EXPECT_GE(SysInfo::NumberOfProcessors(),
+            SysInfo::NumberOfAvailableProcessors());
+}
+
 TEST(SysInfoTest, AmountOfPhysicalMemory) {
   EXPECT_LT(0, SysInfo::AmountOfPhysicalMemory());
 }
@@ -21,5 +27,20 @@ TEST(SysInfoTest, AmountOfVirtualMemory) {
   EXPECT_LE(0, SysInfo::AmountOfVirtualMemory());
 }
 
+TEST(SysInfoTest, NumaTopology) {
+  const int nodes = SysInfo::NumberOfNumaNodes();
+  EXPECT_LT(0, nodes);
+  EXPECT_GT(nodes, SysInfo::CurrentNumaNode());
+}
+
+TEST(SysInfoTest, NumaNodesOfPages) {
+  static int resident = 1;
+  const void* pages[] = {&resident};
+  int nodes[] = {-2};
+  if (!SysInfo::NumaNodesOfPages(1, pages, nodes)) return;
+  EXPECT_LE(-1, nodes[0]);
+  EXPECT_GT(SysInfo::NumberOfNumaNodes(), nodes[0]);
+}
+
 }  // namespace base
 }  // namespace v8
@@ -100,5 +100,79 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.FinishTearDown();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, PrioritizedQueue) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  auto new_job = [&]() -> std::unique_ptr<TurbofanCompilationJob> {
+    return std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  };
+  std::unique_ptr<TurbofanCompilationJob> jobs[] = {new_job(), new_job(),
+                                                    new_job(), new_job()};
+  TurbofanCompilationJob* cold = jobs[0].get();
+  TurbofanCompilationJob* hot = jobs[1].get();
+  TurbofanCompilationJob* warm = jobs[2].get();
+  TurbofanCompilationJob* hottest = jobs[3].get();
+
+  OptimizingCompileDispatcherQueue queue(3);
+  ASSERT_TRUE(queue.Enqueue(jobs[0], 1));
+  ASSERT_TRUE(queue.Enqueue(jobs[1], 3));
+  ASSERT_TRUE(queue.Enqueue(jobs[2], 2));
+  ASSERT_FALSE(queue.IsAvailable(1));
+  ASSERT_TRUE(queue.IsAvailable(4));
+
+  // Colder jobs don't replace queued jobs.
+  std::unique_ptr<TurbofanCompilationJob> dropped;
+  ASSERT_FALSE(queue.Enqueue(jobs[3], 0, &dropped));
+  ASSERT_EQ(dropped, nullptr);
+  // Hotter jobs replace the coldest queued job.
+  ASSERT_TRUE(queue.Enqueue(jobs[3], 4, &dropped));
+  ASSERT_EQ(dropped.get(), cold);
+  ASSERT_EQ(queue.Length(), 3);
+
+  OptimizingCompileTaskState task_state{nullptr};
+  std::unique_ptr<TurbofanCompilationJob> dequeued;
+  for (TurbofanCompilationJob* expected : {hottest, hot, warm}) {
+    dequeued.reset(queue.Dequeue(task_state));
+    ASSERT_EQ(dequeued.get(), expected);
+    task_state.isolate = nullptr;
+  }
+  ASSERT_EQ(queue.Dequeue(task_state), nullptr);
+}
+
+TEST_F(OptimizingCompileDispatcherTest, PrioritizedQueueDoesNotStarve) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  OptimizingCompileDispatcherQueue queue(2);
+  std::unique_ptr<TurbofanCompilationJob> cold_job =
+      std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  TurbofanCompilationJob* cold = cold_job.get();
+  ASSERT_TRUE(queue.Enqueue(cold_job, 0));
+
+  OptimizingCompileTaskState task_state{nullptr};
+  std::unique_ptr<TurbofanCompilationJob> dequeued;
+  for (int i = 0; i <= OptimizingCompileDispatcherQueue::kMaxDeferrals; ++i) {
+    std::unique_ptr<TurbofanCompilationJob> hot_job =
+        std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+    TurbofanCompilationJob* hot = hot_job.get();
+    ASSERT_TRUE(queue.Enqueue(hot_job, 1));
+    dequeued.reset(queue.Dequeue(task_state));
+    task_state.isolate = nullptr;
+    if (i < OptimizingCompileDispatcherQueue::kMaxDeferrals) {
+      ASSERT_EQ(dequeued.get(), hot);
+    } else {
+      // The cold job was deferred too often and goes first.
+      ASSERT_EQ(dequeued.get(), cold);
+    }
+  }
+  queue.Flush(i_isolate());
+  ASSERT_EQ(queue.Length(), 0);
+}
+
 }  // namespace internal
 }  // namespace v8
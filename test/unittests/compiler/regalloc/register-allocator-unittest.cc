@@ -4,6 +4,7 @@
 
 #include "src/codegen/assembler-inl.h"
 #include "src/compiler/pipeline.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/backend/instruction-sequence-unittest.h"
 
 namespace v8 {
@@ -445,6 +446,56 @@ TEST_F(RegisterAllocatorTest, NestedDiamondPhiMerge) {
   Allocate();
 }
 
+TEST_F(RegisterAllocatorTest, NestedDiamondPhiMergeNotControlFlowAware) {
+  FlagScope<int> limit(&v8_flags.turbo_control_flow_aware_allocation_limit, 1);
+
+  // Outer diamond.
+  StartBlock();
+  auto live = Define(Reg());
+  EndBlock(Branch(Imm(), 1, 5));
+
+  // Diamond 1
+  StartBlock();
+  EndBlock(Branch(Imm(), 1, 2));
+
+  StartBlock();
+  auto ll = Define(Reg());
+  EndBlock(Jump(2));
+
+  StartBlock();
+  auto lr = Define(Reg());
+  EndBlock();
+
+  StartBlock();
+  auto l_phi = Phi(ll, lr);
+  EndBlock(Jump(5));
+
+  // Diamond 2
+  StartBlock();
+  EndBlock(Branch(Imm(), 1, 2));
+
+  StartBlock();
+  auto rl = Define(Reg());
+  EndBlock(Jump(2));
+
+  StartBlock();
+  auto rr = Define(Reg());
+  EndBlock();
+
+  StartBlock();
+  auto r_phi = Phi(rl, rr);
+  EndBlock();
+
+  // Outer diamond merge.
+  StartBlock();
+  auto phi = Phi(l_phi, r_phi);
+  EmitI(Reg(live), Reg(phi));
+  Return(Reg(phi));
+  EndBlock();
+
+  Allocate();
+}
+
 TEST_F(RegisterAllocatorTest, NestedDiamondPhiMergeDifferent) {
   // Outer diamond.
   StartBlock();
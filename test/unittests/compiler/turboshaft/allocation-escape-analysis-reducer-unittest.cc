@@ -0,0 +1,167 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/allocation-escape-analysis-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class AllocationEscapeAnalysisReducerTest : public ReducerTest {};
+
+constexpr int kFieldCount = 3;
+
+// Allocates an object with fields {map, value, Smi(42)}.
+V<HeapObject> AllocateObject(TestInstance& Asm, V<Object> value) {
+  Uninitialized<HeapObject> object = __ template Allocate<HeapObject>(
+      __ IntPtrConstant(kFieldCount * kTaggedSize), AllocationType::kYoung);
+  __ Initialize(object, __ HeapConstant(Asm.factory().fixed_array_map()),
+                MemoryRepresentation::TaggedPointer(),
+                WriteBarrierKind::kNoWriteBarrier, 0);
+  __ Initialize(object, value, MemoryRepresentation::AnyTagged(),
+                WriteBarrierKind::kNoWriteBarrier, kTaggedSize);
+  __ Initialize(object, __ SmiConstant(Smi::FromInt(42)),
+                MemoryRepresentation::TaggedSigned(),
+                WriteBarrierKind::kNoWriteBarrier, 2 * kTaggedSize);
+  return __ FinishInitialization(std::move(object));
+}
+
+V<Object> LoadField(TestInstance& Asm, V<HeapObject> object, int field) {
+  return V<Object>::Cast(__ Load(object, {}, LoadOp::Kind::TaggedBase(),
+                                 MemoryRepresentation::AnyTagged(),
+                                 RegisterRepresentation::Tagged(),
+                                 field * kTaggedSize));
+}
+
+void StoreField(TestInstance& Asm, V<HeapObject> object, int field,
+                V<Object> value) {
+  __ Store(object, value, StoreOp::Kind::TaggedBase(),
+           MemoryRepresentation::AnyTagged(),
+           WriteBarrierKind::kFullWriteBarrier, field * kTaggedSize);
+}
+
+// Builds a FrameState with {object} as its only local.
+V<FrameState> BuildFrameStateWithObject(TestInstance& Asm,
+                                        V<HeapObject> object) {
+  FrameStateData::Builder builder;
+  // Closure
+  builder.AddInput(MachineType::AnyTagged(), __ SmiConstant(Smi::FromInt(0)));
+  // Receiver
+  builder.AddInput(MachineType::AnyTagged(), __ SmiConstant(Smi::FromInt(0)));
+  builder.AddInput(MachineType::AnyTagged(), object);
+
+  FrameStateFunctionInfo* function_info =
+      Asm.zone()->template New<FrameStateFunctionInfo>(
+          FrameStateType::kUnoptimizedFunction, 1, 0, 1,
+          Handle<SharedFunctionInfo>{}, Handle<BytecodeArray>{});
+  const FrameStateInfo* frame_state_info =
+      Asm.zone()->template New<FrameStateInfo>(
+          BytecodeOffset(0), OutputFrameStateCombine::Ignore(), function_info);
+
+  return __ FrameState(
+      builder.Inputs(), builder.inlined(),
+      builder.AllocateFrameStateData(*frame_state_info, Asm.zone()));
+}
+
+TEST_F(AllocationEscapeAnalysisReducerTest, ReplaceFieldsOfAllocation) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    V<HeapObject> object = AllocateObject(Asm, Asm.GetParameter(0));
+    Asm.Capture(LoadField(Asm, object, 1), "load");
+    StoreField(Asm, object, 1, Asm.GetParameter(1));
+    __ Return(LoadField(Asm, object, 1));
+  });
+
+  test.Run<AllocationEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kStore), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kLoad), 0u);
+  ASSERT_TRUE(test.GetCapture("load").IsEmpty());
+}
+
+TEST_F(AllocationEscapeAnalysisReducerTest, MergeFieldsWithPhis) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    V<HeapObject> object = AllocateObject(Asm, Asm.GetParameter(0));
+    IF (__ TaggedEqual(Asm.GetParameter(0), Asm.GetParameter(1))) {
+      StoreField(Asm, object, 1, Asm.GetParameter(1));
+    }
+    // Field 2 is the same on both sides and doesn't need a phi.
+    __ Return(__ TaggedEqual(LoadField(Asm, object, 1),
+                             LoadField(Asm, object, 2)));
+  });
+
+  test.Run<AllocationEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kLoad), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kPhi), 1u);
+}
+
+TEST_F(AllocationEscapeAnalysisReducerTest, DematerializeInFrameState) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    V<HeapObject> object = AllocateObject(Asm, Asm.GetParameter(0));
+    V<FrameState> frame_state = BuildFrameStateWithObject(Asm, object);
+    Asm.Capture(frame_state, "frame_state");
+    __ DeoptimizeIf(__ TaggedEqual(Asm.GetParameter(0), Asm.GetParameter(1)),
+                    frame_state, DeoptimizeReason::kUnknown, FeedbackSource());
+    __ Return(LoadField(Asm, object, 2));
+  });
+
+  test.Run<AllocationEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 0u);
+  const FrameStateOp* frame_state =
+      test.GetCapturedAs<FrameStateOp>("frame_state");
+  ASSERT_NE(frame_state, nullptr);
+  auto it = frame_state->data->iterator(frame_state->state_values());
+  MachineType type;
+  OpIndex input;
+  it.ConsumeInput(&type, &input);
+  it.ConsumeInput(&type, &input);
+  ASSERT_EQ(it.current_instr(), FrameStateData::Instr::kDematerializedObject);
+  uint32_t id;
+  uint32_t field_count;
+  it.ConsumeDematerializedObject(&id, &field_count);
+  ASSERT_EQ(field_count, static_cast<uint32_t>(kFieldCount));
+}
+
+TEST_F(AllocationEscapeAnalysisReducerTest, KeepEscapingAllocations) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    V<HeapObject> escaping = AllocateObject(Asm, Asm.GetParameter(0));
+    V<HeapObject> stored = AllocateObject(Asm, Asm.GetParameter(0));
+    // {stored} would need to be dematerialized as a field of {escaping}.
+    StoreField(Asm, escaping, 1, stored);
+    __ Return(escaping);
+  });
+
+  test.Run<AllocationEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 2u);
+}
+
+TEST_F(AllocationEscapeAnalysisReducerTest, KeepPartiallyInitializedObjects) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    Uninitialized<HeapObject> uninitialized = __ template Allocate<HeapObject>(
+        __ IntPtrConstant(kFieldCount * kTaggedSize), AllocationType::kYoung);
+    __ Initialize(uninitialized,
+                  __ HeapConstant(Asm.factory().fixed_array_map()),
+                  MemoryRepresentation::TaggedPointer(),
+                  WriteBarrierKind::kNoWriteBarrier, 0);
+    V<HeapObject> object = __ FinishInitialization(std::move(uninitialized));
+    __ Return(LoadField(Asm, object, 1));
+  });
+
+  test.Run<AllocationEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 1u);
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
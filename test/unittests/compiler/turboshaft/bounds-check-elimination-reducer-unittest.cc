@@ -0,0 +1,127 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/bounds-check-elimination-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class BoundsCheckEliminationReducerTest : public ReducerTest {};
+
+V<Word32> LoadLength(TestInstance& Asm, int offset) {
+  return V<Word32>::Cast(__ Load(Asm.GetParameter(0), {},
+                                 LoadOp::Kind::TaggedBase(),
+                                 MemoryRepresentation::Int32(),
+                                 RegisterRepresentation::Word32(), offset));
+}
+
+void CheckBounds(TestInstance& Asm, V<Word32> index, V<Word32> length,
+                 const std::string& key) {
+  V<FrameState> frame_state = V<FrameState>::Cast(Asm.BuildFrameState());
+  __ DeoptimizeIfNot(__ Uint32LessThan(index, length), frame_state,
+                     DeoptimizeReason::kOutOfBounds, FeedbackSource());
+  Asm.Capture(__ output_graph().LastOperation(), key);
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, RemoveRedundantChecks) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    V<Word32> index = LoadLength(Asm, 0);
+    V<Word32> length = LoadLength(Asm, 4);
+    V<Word32> other_length = LoadLength(Asm, 8);
+    CheckBounds(Asm, index, length, "first_check");
+    CheckBounds(Asm, index, length, "redundant_check");
+    CheckBounds(Asm, index, other_length, "other_length_check");
+
+    IF (__ Uint32LessThan(index, other_length)) {
+      // Implied by `other_length_check`.
+      CheckBounds(Asm, index, other_length, "check_in_branch");
+    }
+    __ Return(index);
+  });
+
+  test.Run<BoundsCheckEliminationReducer>();
+
+  ASSERT_FALSE(test.GetCapture("first_check").IsEmpty());
+  ASSERT_TRUE(test.GetCapture("redundant_check").IsEmpty());
+  ASSERT_FALSE(test.GetCapture("other_length_check").IsEmpty());
+  ASSERT_TRUE(test.GetCapture("check_in_branch").IsEmpty());
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, RemoveCheckImpliedByBranch) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    V<Word32> index = LoadLength(Asm, 0);
+    V<Word32> length = LoadLength(Asm, 4);
+    IF (__ Uint32LessThan(index, length)) {
+      CheckBounds(Asm, index, length, "implied_check");
+    } ELSE {
+      CheckBounds(Asm, index, length, "failing_check");
+    }
+    IF (__ Int32LessThan(index, length)) {
+      // {index} could be negative.
+      CheckBounds(Asm, index, length, "signed_check");
+    }
+    __ Return(index);
+  });
+
+  test.Run<BoundsCheckEliminationReducer>();
+
+  ASSERT_TRUE(test.GetCapture("implied_check").IsEmpty());
+  ASSERT_FALSE(test.GetCapture("failing_check").IsEmpty());
+  ASSERT_FALSE(test.GetCapture("signed_check").IsEmpty());
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, RemoveCheckImpliedByLoopCondition) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    V<Word32> length = LoadLength(Asm, 0);
+    LoopLabel<Word32> loop(&Asm);
+    Label<Word32> done(&Asm);
+    GOTO(loop, 0);
+
+    BIND_LOOP(loop, i) {
+      GOTO_IF_NOT(__ Int32LessThan(i, length), done, i);
+      CheckBounds(Asm, i, length, "check_in_loop");
+      GOTO(loop, __ Word32Add(i, 1));
+    }
+
+    BIND(done, result);
+    __ Return(result);
+  });
+
+  test.Run<BoundsCheckEliminationReducer>();
+
+  ASSERT_TRUE(test.GetCapture("check_in_loop").IsEmpty());
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, KeepCheckOfPossiblyNegativeIndex) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    V<Word32> length = LoadLength(Asm, 0);
+    LoopLabel<Word32> loop(&Asm);
+    Label<Word32> done(&Asm);
+    GOTO(loop, 0);
+
+    BIND_LOOP(loop, i) {
+      GOTO_IF_NOT(__ Int32LessThan(i, length), done, i);
+      CheckBounds(Asm, i, length, "check_in_loop");
+      // {i} becomes negative on the 2nd iteration.
+      GOTO(loop, __ Word32Sub(i, 1));
+    }
+
+    BIND(done, result);
+    __ Return(result);
+  });
+
+  test.Run<BoundsCheckEliminationReducer>();
+
+  ASSERT_FALSE(test.GetCapture("check_in_loop").IsEmpty());
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,99 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/check-hoisting-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class CheckHoistingReducerTest : public ReducerTest {};
+
+V<Word32> LoadWord32(TestInstance& Asm, int offset) {
+  return V<Word32>::Cast(__ Load(Asm.GetParameter(0), {},
+                                 LoadOp::Kind::TaggedBase(),
+                                 MemoryRepresentation::Int32(),
+                                 RegisterRepresentation::Word32(), offset));
+}
+
+void CheckField(TestInstance& Asm, V<FrameState> frame_state) {
+  __ DeoptimizeIfNot(__ Word32Equal(LoadWord32(Asm, 8), 42), frame_state,
+                     DeoptimizeReason::kWrongMap, FeedbackSource());
+}
+
+// Builds a diamond on `param0[0] < 0`, calling {if_true} and {if_false} in
+// its successors, after a first check whose frame state can be reused.
+template <typename T, typename F>
+void BuildDiamond(TestInstance& Asm, const T& if_true, const F& if_false) {
+  V<FrameState> frame_state = V<FrameState>::Cast(Asm.BuildFrameState());
+  __ DeoptimizeIf(__ Word32Equal(LoadWord32(Asm, 0), 0), frame_state,
+                  DeoptimizeReason::kDivisionByZero, FeedbackSource());
+  Label<Word32> done(&Asm);
+  IF (__ Int32LessThan(LoadWord32(Asm, 0), 0)) {
+    if_true(frame_state);
+    GOTO(done, 1);
+  } ELSE {
+    if_false(frame_state);
+    GOTO(done, 2);
+  }
+  BIND(done, result);
+  __ Return(result);
+}
+
+TEST_F(CheckHoistingReducerTest, HoistChecksOfBothSuccessors) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    BuildDiamond(
+        Asm, [&](V<FrameState> frame_state) { CheckField(Asm, frame_state); },
+        [&](V<FrameState> frame_state) { CheckField(Asm, frame_state); });
+  });
+
+  test.Run<CheckHoistingReducer>();
+
+  // The first check, and the hoisted one.
+  ASSERT_EQ(test.CountOp(Opcode::kDeoptimizeIf), 2u);
+}
+
+TEST_F(CheckHoistingReducerTest, NoHoistingOfDifferentChecks) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    BuildDiamond(
+        Asm, [&](V<FrameState> frame_state) { CheckField(Asm, frame_state); },
+        [&](V<FrameState> frame_state) {
+          __ DeoptimizeIfNot(__ Word32Equal(LoadWord32(Asm, 8), 43),
+                             frame_state, DeoptimizeReason::kWrongMap,
+                             FeedbackSource());
+        });
+  });
+
+  test.Run<CheckHoistingReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kDeoptimizeIf), 3u);
+}
+
+TEST_F(CheckHoistingReducerTest, NoHoistingOfChecksAfterStores) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    BuildDiamond(
+        Asm,
+        [&](V<FrameState> frame_state) {
+          // The load of the check could read the stored value.
+          __ Store(Asm.GetParameter(0), __ Word32Constant(42),
+                   StoreOp::Kind::TaggedBase(), MemoryRepresentation::Int32(),
+                   WriteBarrierKind::kNoWriteBarrier, 8);
+          CheckField(Asm, frame_state);
+        },
+        [&](V<FrameState> frame_state) { CheckField(Asm, frame_state); });
+  });
+
+  test.Run<CheckHoistingReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kDeoptimizeIf), 3u);
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
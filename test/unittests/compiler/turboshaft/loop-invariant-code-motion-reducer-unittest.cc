@@ -0,0 +1,158 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-invariant-code-motion-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class LoopInvariantCodeMotionReducerTest : public ReducerTest {};
+
+// Returns whether all operations generated for the captured operation `key`
+// come before the (single) loop of the graph.
+bool IsBeforeLoop(TestInstance& test, const std::string& key) {
+  const Graph& graph = test.graph();
+  const Block* header = nullptr;
+  for (const Block& block : graph.blocks()) {
+    if (block.IsLoop()) {
+      header = &block;
+      break;
+    }
+  }
+  DCHECK_NOT_NULL(header);
+  const auto& captured = test.GetCapture(key);
+  DCHECK(!captured.IsEmpty());
+  for (OpIndex index : captured.generated_output) {
+    if (graph.BlockIndexOf(index).id() >= header->index().id()) return false;
+  }
+  return true;
+}
+
+V<Word32> LoadWord32(TestInstance& Asm, int offset) {
+  return V<Word32>::Cast(__ Load(Asm.GetParameter(0), {},
+                                 LoadOp::Kind::TaggedBase(),
+                                 MemoryRepresentation::Int32(),
+                                 RegisterRepresentation::Word32(), offset));
+}
+
+TEST_F(LoopInvariantCodeMotionReducerTest, HoistPureOperations) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    V<Word32> x = LoadWord32(Asm, 0);
+    LoopLabel<Word32> loop(&Asm);
+    Label<Word32> done(&Asm);
+    GOTO(loop, 0);
+
+    BIND_LOOP(loop, i) {
+      V<Word32> in_header = Asm.Capture(__ Word32Mul(x, 3), "in_header");
+      GOTO_IF(__ Int32LessThan(in_header, i), done, i);
+
+      V<Word32> in_body = Asm.Capture(__ Word32BitwiseXor(x, 5), "in_body");
+      V<Word32> division =
+          Asm.Capture(__ Int32Div(x, in_body), "division_in_body");
+      V<Word32> variant =
+          Asm.Capture(__ Word32Add(i, __ Word32Add(in_body, division)),
+                      "variant");
+      GOTO(loop, variant);
+    }
+
+    BIND(done, result);
+    __ Return(result);
+  });
+
+  test.Run<LoopInvariantCodeMotionReducer>();
+
+  ASSERT_TRUE(IsBeforeLoop(test, "in_header"));
+  ASSERT_TRUE(IsBeforeLoop(test, "in_body"));
+  // Divisions might depend on a check excluding zero and are thus not
+  // hoisted out of the loop body.
+  ASSERT_FALSE(IsBeforeLoop(test, "division_in_body"));
+  ASSERT_FALSE(IsBeforeLoop(test, "variant"));
+}
+
+TEST_F(LoopInvariantCodeMotionReducerTest, HoistChecksFromLoopHeader) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    V<Word32> x = LoadWord32(Asm, 0);
+    LoopLabel<Word32> loop(&Asm);
+    Label<Word32> done(&Asm);
+    GOTO(loop, 0);
+
+    BIND_LOOP(loop, i) {
+      // The frame state refers to the loop phi, which is replaced by its
+      // value on loop entry when hoisting the check.
+      V<FrameState> frame_state =
+          V<FrameState>::Cast(Asm.BuildFrameState(base::VectorOf({i})));
+      __ DeoptimizeIf(__ Word32Equal(x, 0), frame_state,
+                      DeoptimizeReason::kDivisionByZero, FeedbackSource());
+      Asm.Capture(__ output_graph().LastOperation(), "invariant_check");
+      // The division depends on the check, which is hoisted as well.
+      V<Word32> division =
+          Asm.Capture(__ Int32Div(100, x), "division_in_header");
+      __ DeoptimizeIf(__ Word32Equal(i, 10), frame_state,
+                      DeoptimizeReason::kOverflow, FeedbackSource());
+      Asm.Capture(__ output_graph().LastOperation(), "variant_check");
+      // Can't be hoisted over the variant check.
+      V<Word32> other_division =
+          Asm.Capture(__ Int32Div(200, x), "division_after_check");
+      GOTO_IF(__ Int32LessThan(__ Word32Add(division, other_division), i),
+              done, i);
+      GOTO(loop, __ Word32Add(i, 1));
+    }
+
+    BIND(done, result);
+    __ Return(result);
+  });
+
+  test.Run<LoopInvariantCodeMotionReducer>();
+
+  ASSERT_TRUE(IsBeforeLoop(test, "invariant_check"));
+  ASSERT_TRUE(IsBeforeLoop(test, "division_in_header"));
+  ASSERT_FALSE(IsBeforeLoop(test, "variant_check"));
+  ASSERT_FALSE(IsBeforeLoop(test, "division_after_check"));
+
+  // The hoisted check uses a frame state with the initial value of the loop
+  // phi.
+  const DeoptimizeIfOp* check =
+      test.GetCapturedAs<DeoptimizeIfOp>("invariant_check");
+  ASSERT_NE(check, nullptr);
+  const FrameStateOp& frame_state =
+      test.graph().Get(check->frame_state()).Cast<FrameStateOp>();
+  const ConstantOp* local =
+      test.graph().Get(frame_state.state_value(1)).TryCast<ConstantOp>();
+  ASSERT_NE(local, nullptr);
+  ASSERT_EQ(local->word32(), 0u);
+}
+
+TEST_F(LoopInvariantCodeMotionReducerTest, NoHoistingOfLoadsAcrossStores) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    LoopLabel<Word32> loop(&Asm);
+    Label<Word32> done(&Asm);
+    GOTO(loop, 0);
+
+    BIND_LOOP(loop, i) {
+      V<Word32> load = Asm.Capture(LoadWord32(Asm, 0), "load");
+      GOTO_IF(__ Int32LessThan(load, i), done, i);
+      __ Store(Asm.GetParameter(0), i, StoreOp::Kind::TaggedBase(),
+               MemoryRepresentation::Int32(),
+               WriteBarrierKind::kNoWriteBarrier, 0);
+      GOTO(loop, __ Word32Add(i, 1));
+    }
+
+    BIND(done, result);
+    __ Return(result);
+  });
+
+  test.Run<LoopInvariantCodeMotionReducer>();
+
+  ASSERT_FALSE(IsBeforeLoop(test, "load"));
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
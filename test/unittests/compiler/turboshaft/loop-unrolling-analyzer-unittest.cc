@@ -4,6 +4,7 @@
 
 #include "src/compiler/turboshaft/assembler.h"
 #include "src/compiler/turboshaft/loop-unrolling-reducer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/turboshaft/reducer-test.h"
 
 namespace v8::internal::compiler::turboshaft {
@@ -379,6 +380,54 @@ INSTANTIATE_TEST_SUITE_P(LoopUnrollingAnalyzerTest,
                          LoopUnrollingAnalyzerLargeLoopTest,
                          ::testing::ValuesIn(kLargeBoundedLoops));
 
+static const BoundedLoop kTripCountUnrolledLoops[] = {
+    {0, Cmp::kInt32LessThan, 3, Binop::kWord32Add, 1, 3,
+     "for (int32_t i = 0; i < 3; i += 1)", 3},
+    {0, Cmp::kInt32LessThan, 6, Binop::kWord32Add, 1, 6,
+     "for (int32_t i = 0; i < 6; i += 1)", 3},
+    {0, Cmp::kInt32LessThan, 7, Binop::kWord32Add, 1, 7,
+     "for (int32_t i = 0; i < 7; i += 1)", 4},
+    {0, Cmp::kInt32LessThan, 4500, Binop::kWord32Add, 1, 4500,
+     "for (int32_t i = 0; i < 4500; i += 1)", 4},
+};
+
+using LoopUnrollingAnalyzerTripCountTest =
+    LoopUnrollingAnalyzerTestWithParam<BoundedLoop>;
+
+// Checking that the partial unroll count is fitted to the trip count of loops
+// whose number of iterations is known.
+TEST_P(LoopUnrollingAnalyzerTripCountTest, TripCountUnrollCount) {
+  FlagScope<bool> trip_count_aware_unrolling(
+      &v8_flags.turboshaft_trip_count_aware_unrolling, true);
+  BoundedLoop params = GetParam();
+  auto test = CreateFromGraph(1, [&params](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    OpIndex cond = Asm.GetParameter(0);
+
+    ScopedVar<Word32, AssemblerT> index(&Asm, params.init);
+
+    WHILE(EmitCmp(Asm, params.cmp, index, params.max)) {
+      __ JSLoopStackCheck(__ NoContextConstant(), Asm.BuildFrameState());
+
+      // Advance the {index}.
+      index = EmitBinop(Asm, params.binop, index, params.increment);
+    }
+
+    __ Return(index);
+  });
+
+  LoopUnrollingAnalyzer analyzer(test.zone(), &test.graph(), false);
+
+  const Block& loop = GetFirstLoop(test.graph());
+  ASSERT_TRUE(analyzer.ShouldPartiallyUnrollLoop(&loop));
+  EXPECT_EQ(params.expected_unroll_count,
+            analyzer.GetPartialUnrollCount(&loop));
+}
+
+INSTANTIATE_TEST_SUITE_P(LoopUnrollingAnalyzerTest,
+                         LoopUnrollingAnalyzerTripCountTest,
+                         ::testing::ValuesIn(kTripCountUnrolledLoops));
+
 using LoopUnrollingAnalyzerOverflowTest =
     LoopUnrollingAnalyzerTestWithParam<BoundedLoop>;
 
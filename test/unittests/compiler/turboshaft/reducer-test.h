@@ -108,18 +108,21 @@ class TestInstance {
     DCHECK_LT(index, parameters_.size());
     return parameters_[index];
   }
-  OpIndex BuildFrameState() {
+  OpIndex BuildFrameState(base::Vector<const V<Word32>> locals = {}) {
     FrameStateData::Builder builder;
     // Closure
     builder.AddInput(MachineType::AnyTagged(),
                      Asm().SmiConstant(Smi::FromInt(0)));
-    // TODO(nicohartmann@): Parameters, Context, Locals, Accumulator if
-    // necessary.
+    for (V<Word32> local : locals) {
+      builder.AddInput(MachineType::Int32(), local);
+    }
+    // TODO(nicohartmann@): Parameters, Context, Accumulator if necessary.
 
     FrameStateFunctionInfo* function_info =
         zone_->template New<FrameStateFunctionInfo>(
-            FrameStateType::kUnoptimizedFunction, 0, 0, 0,
-            Handle<SharedFunctionInfo>{}, Handle<BytecodeArray>{});
+            FrameStateType::kUnoptimizedFunction, 0, 0,
+            static_cast<int>(locals.size()), Handle<SharedFunctionInfo>{},
+            Handle<BytecodeArray>{});
     const FrameStateInfo* frame_state_info =
         zone_->template New<FrameStateInfo>(BytecodeOffset(0),
                                             OutputFrameStateCombine::Ignore(),
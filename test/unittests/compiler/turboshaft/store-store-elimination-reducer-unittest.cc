@@ -53,6 +53,76 @@ TEST_F(StoreStoreEliminationReducerTest, MergeObjectInitialzationStore) {
 #endif  // V8_COMPRESS_POINTERS
 }
 
+TEST_F(StoreStoreEliminationReducerTest,
+       ForwardOverwritingStoreToInitializingStore) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    OpIndex param0 = Asm.GetParameter(0);
+    OpIndex param1 = Asm.GetParameter(1);
+
+    OpIndex undefined = __ HeapConstant(Asm.factory().undefined_value());
+    __ Store(param0, undefined, StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 12, true);
+    Asm.Capture(__ output_graph().LastOperation(), "initializing_store");
+
+    // The allocation makes the initializing store gc-observable.
+    Uninitialized<HeapObject> uninitialized =
+        __ template Allocate<HeapObject>(__ IntPtrConstant(16),
+                                         AllocationType::kYoung);
+    V<HeapObject> object = __ FinishInitialization(std::move(uninitialized));
+
+    __ Store(param0, param1, StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kFullWriteBarrier, 12);
+    Asm.Capture(__ output_graph().LastOperation(), "overwriting_store");
+
+    __ Return(object);
+  });
+
+  test.Run<StoreStoreEliminationReducer>();
+
+  const auto& initializing_store = test.GetCapture("initializing_store");
+  const StoreOp* store = initializing_store.GetFirst<StoreOp>();
+  ASSERT_NE(store, nullptr);
+  ASSERT_EQ(store->offset, 12);
+  ASSERT_TRUE(store->maybe_initializing_or_transitioning);
+  ASSERT_EQ(store->write_barrier, WriteBarrierKind::kFullWriteBarrier);
+  ASSERT_TRUE(test.graph().Get(store->value()).Is<ParameterOp>());
+
+  ASSERT_TRUE(test.GetCapture("overwriting_store").IsEmpty());
+}
+
+TEST_F(StoreStoreEliminationReducerTest, DontForwardStoreAcrossLoad) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    OpIndex param0 = Asm.GetParameter(0);
+    OpIndex param1 = Asm.GetParameter(1);
+
+    OpIndex undefined = __ HeapConstant(Asm.factory().undefined_value());
+    __ Store(param0, undefined, StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 12, true);
+    Asm.Capture(__ output_graph().LastOperation(), "initializing_store");
+
+    OpIndex load = __ Load(param0, LoadOp::Kind::TaggedBase(),
+                           MemoryRepresentation::AnyTagged(), 12);
+
+    __ Store(param0, param1, StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kFullWriteBarrier, 12);
+    Asm.Capture(__ output_graph().LastOperation(), "overwriting_store");
+
+    __ Return(load);
+  });
+
+  test.Run<StoreStoreEliminationReducer>();
+
+  const StoreOp* store =
+      test.GetCapture("initializing_store").GetFirst<StoreOp>();
+  ASSERT_NE(store, nullptr);
+  ASSERT_TRUE(test.graph().Get(store->value()).Is<ConstantOp>());
+  ASSERT_FALSE(test.GetCapture("overwriting_store").IsEmpty());
+}
+
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
 
 }  // namespace v8::internal::compiler::turboshaft
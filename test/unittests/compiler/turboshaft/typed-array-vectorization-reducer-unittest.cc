@@ -0,0 +1,140 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/typed-array-vectorization-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// Typed array indices are only vectorized when they are extended to 64 bits.
+#if V8_TARGET_ARCH_64_BIT
+
+class TypedArrayVectorizationReducerTest : public ReducerTest {};
+
+OpIndex LoadElement(TestInstance& Asm, int array, V<Word32> i,
+                    ExternalArrayType type) {
+  return __ LoadTypedElement(Asm.GetParameter(array), Asm.GetParameter(array),
+                             __ IntPtrConstant(0), __ ChangeInt32ToIntPtr(i),
+                             type);
+}
+
+void StoreElement(TestInstance& Asm, int array, V<Word32> i, OpIndex value,
+                  ExternalArrayType type) {
+  __ StoreTypedElement(Asm.GetParameter(array), Asm.GetParameter(array),
+                       __ IntPtrConstant(0), __ ChangeInt32ToIntPtr(i), value,
+                       type);
+}
+
+// Builds `for (let i = 0; i < n; i++) { body(i) }`.
+template <typename F>
+void BuildLoop(TestInstance& Asm, const F& body) {
+  V<Word32> n = V<Word32>::Cast(__ Load(
+      Asm.GetParameter(0), {}, LoadOp::Kind::TaggedBase(),
+      MemoryRepresentation::Int32(), RegisterRepresentation::Word32(), 0));
+  LoopLabel<Word32> loop(&Asm);
+  Label<Word32> done(&Asm);
+  GOTO(loop, 0);
+
+  BIND_LOOP(loop, i) {
+    GOTO_IF_NOT(__ Int32LessThan(i, n), done, i);
+    body(i);
+    GOTO(loop, __ Word32Add(i, 1));
+  }
+
+  BIND(done, result);
+  __ Return(result);
+}
+
+TEST_F(TypedArrayVectorizationReducerTest, VectorizeInt32Loop) {
+  auto test = CreateFromGraph(3, [](auto& Asm) {
+    BuildLoop(Asm, [&](V<Word32> i) {
+      V<Word32> a = LoadElement(Asm, 0, i, kExternalInt32Array);
+      V<Word32> b = LoadElement(Asm, 1, i, kExternalInt32Array);
+      StoreElement(Asm, 2, i, __ Word32BitwiseXor(__ Word32Add(a, b), 0xff),
+                   kExternalInt32Array);
+    });
+  });
+
+  test.Run<TypedArrayVectorizationReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kSimd128Binop), 2u);
+  ASSERT_EQ(test.CountOp(Opcode::kSimd128Splat), 1u);
+  // The scalar loop is kept for the remaining iterations.
+  ASSERT_EQ(test.CountOp(Opcode::kStoreTypedElement), 1u);
+}
+
+TEST_F(TypedArrayVectorizationReducerTest, VectorizeFloat32Loop) {
+  auto test = CreateFromGraph(3, [](auto& Asm) {
+    BuildLoop(Asm, [&](V<Word32> i) {
+      V<Float64> a = __ ChangeFloat32ToFloat64(
+          LoadElement(Asm, 0, i, kExternalFloat32Array));
+      V<Float64> b = __ ChangeFloat32ToFloat64(
+          LoadElement(Asm, 1, i, kExternalFloat32Array));
+      StoreElement(Asm, 2, i,
+                   __ TruncateFloat64ToFloat32(__ Float64Mul(a, b)),
+                   kExternalFloat32Array);
+    });
+  });
+
+  test.Run<TypedArrayVectorizationReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kSimd128Binop), 1u);
+}
+
+TEST_F(TypedArrayVectorizationReducerTest, NoVectorizationOfFloat64Chains) {
+  auto test = CreateFromGraph(3, [](auto& Asm) {
+    BuildLoop(Asm, [&](V<Word32> i) {
+      V<Float64> a = __ ChangeFloat32ToFloat64(
+          LoadElement(Asm, 0, i, kExternalFloat32Array));
+      V<Float64> b = __ ChangeFloat32ToFloat64(
+          LoadElement(Asm, 1, i, kExternalFloat32Array));
+      // `a + b` isn't rounded to float32 before the multiplication.
+      StoreElement(Asm, 2, i,
+                   __ TruncateFloat64ToFloat32(
+                       __ Float64Mul(__ Float64Add(a, b), b)),
+                   kExternalFloat32Array);
+    });
+  });
+
+  test.Run<TypedArrayVectorizationReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kSimd128Binop), 0u);
+}
+
+TEST_F(TypedArrayVectorizationReducerTest, NoVectorizationOfReductions) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    V<Word32> n = V<Word32>::Cast(__ Load(
+        Asm.GetParameter(0), {}, LoadOp::Kind::TaggedBase(),
+        MemoryRepresentation::Int32(), RegisterRepresentation::Word32(), 0));
+    LoopLabel<Word32, Word32> loop(&Asm);
+    Label<Word32> done(&Asm);
+    GOTO(loop, 0, 0);
+
+    BIND_LOOP(loop, i, sum) {
+      GOTO_IF_NOT(__ Int32LessThan(i, n), done, sum);
+      V<Word32> a = LoadElement(Asm, 0, i, kExternalInt32Array);
+      GOTO(loop, __ Word32Add(i, 1), __ Word32Add(sum, a));
+    }
+
+    BIND(done, result);
+    __ Return(result);
+  });
+
+  test.Run<TypedArrayVectorizationReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kSimd128Binop), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kLoad), 1u);
+}
+
+#endif  // V8_TARGET_ARCH_64_BIT
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
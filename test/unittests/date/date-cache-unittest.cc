@@ -103,6 +103,46 @@ TEST(DateCache, AdoptDefaultMixed) {
   t4.Join();
 }
 
+TEST(DateCache, TransitionTable) {
+  static const char* kTimeZones[] = {
+      "America/New_York", "Europe/London",  "Europe/Moscow",
+      "Africa/Cairo",     "Asia/Kolkata",   "Australia/Lord_Howe",
+      "Pacific/Apia",     "America/Santiago"};
+  static const int64_t kStep = 3 * DateCache::kMsPerDay + 3599999;
+  std::unique_ptr<icu::TimeZone> saved(icu::TimeZone::createDefault());
+  for (const char* name : kTimeZones) {
+    icu::TimeZone::adoptDefault(
+        icu::TimeZone::createTimeZone(icu::UnicodeString(name, -1, US_INV)));
+    DateCache date_cache;
+    // Covers the table's range (1900..2100) and some time around it. Each
+    // offset change is hit within one step, and checked at both ends.
+    int64_t previous = -2300000000000;
+    int previous_offset = date_cache.GetLocalOffsetFromOS(previous, true);
+    for (int64_t time = previous + kStep; time < 4200000000000;
+         time += kStep) {
+      int offset = date_cache.GetLocalOffsetFromOS(time, true);
+      CHECK_EQ(offset, date_cache.LocalOffsetInMs(time, true));
+      if (offset != previous_offset) {
+        int64_t low = previous;
+        int64_t high = time;
+        while (high - low > 1) {
+          int64_t middle = low + (high - low) / 2;
+          if (date_cache.GetLocalOffsetFromOS(middle, true) == offset) {
+            high = middle;
+          } else {
+            low = middle;
+          }
+        }
+        CHECK_EQ(previous_offset, date_cache.LocalOffsetInMs(low, true));
+        CHECK_EQ(offset, date_cache.LocalOffsetInMs(high, true));
+      }
+      previous = time;
+      previous_offset = offset;
+    }
+  }
+  icu::TimeZone::adoptDefault(saved.release());
+}
+
 }  // namespace internal
 }  // namespace v8
 
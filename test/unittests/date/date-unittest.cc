@@ -47,6 +47,13 @@ class DateCacheMock : public DateCache {
     return local_offset_ + GetDaylightSavingsOffsetFromOS(time_ms / 1000);
   }
 
+  // Exercises the segment cache rather than the transition table.
+  bool GetLocalOffsetTransitionsFromOS(
+      int64_t start_ms, int64_t end_ms,
+      std::vector<OffsetTransition>* transitions) override {
+    return false;
+  }
+
  private:
   Rule* FindRuleFor(int year, int month, int day, int time_in_day_sec) {
     Rule* result = nullptr;
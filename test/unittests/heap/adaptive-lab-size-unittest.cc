@@ -0,0 +1,86 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/adaptive-lab-size.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+
+constexpr base::TimeDelta kQuickRefill = base::TimeDelta::FromMicroseconds(100);
+constexpr base::TimeDelta kIdleRefill = base::TimeDelta::FromMilliseconds(200);
+
+}  // namespace
+
+TEST(AdaptiveLabSizeTest, StartsAtMinSize) {
+  AdaptiveLabSize lab_size;
+  EXPECT_EQ(AdaptiveLabSize::kMinSize, lab_size.size());
+  // The first refill has nothing to compare against.
+  lab_size.NotifyRefill(base::TimeTicks::Now());
+  EXPECT_EQ(AdaptiveLabSize::kMinSize, lab_size.size());
+}
+
+TEST(AdaptiveLabSizeTest, GrowsOnQuickRefillsUpToMaxSize) {
+  AdaptiveLabSize lab_size;
+  base::TimeTicks now = base::TimeTicks::Now();
+  lab_size.NotifyRefill(now);
+  now += kQuickRefill;
+  lab_size.NotifyRefill(now);
+  EXPECT_EQ(2 * AdaptiveLabSize::kMinSize, lab_size.size());
+  for (int i = 0; i < 10; ++i) {
+    now += kQuickRefill;
+    lab_size.NotifyRefill(now);
+  }
+  EXPECT_EQ(AdaptiveLabSize::kMaxSize, lab_size.size());
+}
+
+TEST(AdaptiveLabSizeTest, KeepsSizeOnModerateRefills) {
+  AdaptiveLabSize lab_size;
+  base::TimeTicks now = base::TimeTicks::Now();
+  lab_size.NotifyRefill(now);
+  now += kQuickRefill;
+  lab_size.NotifyRefill(now);
+  const size_t size = lab_size.size();
+  now += base::TimeDelta::FromMilliseconds(10);
+  lab_size.NotifyRefill(now);
+  EXPECT_EQ(size, lab_size.size());
+}
+
+TEST(AdaptiveLabSizeTest, ShrinksWhenIdle) {
+  AdaptiveLabSize lab_size;
+  base::TimeTicks now = base::TimeTicks::Now();
+  lab_size.NotifyRefill(now);
+  for (int i = 0; i < 10; ++i) {
+    now += kQuickRefill;
+    lab_size.NotifyRefill(now);
+  }
+  ASSERT_EQ(AdaptiveLabSize::kMaxSize, lab_size.size());
+  now += kIdleRefill;
+  lab_size.NotifyRefill(now);
+  EXPECT_EQ(AdaptiveLabSize::kMaxSize / 2, lab_size.size());
+  for (int i = 0; i < 10; ++i) {
+    now += kIdleRefill;
+    lab_size.NotifyRefill(now);
+  }
+  EXPECT_EQ(AdaptiveLabSize::kMinSize, lab_size.size());
+}
+
+TEST(AdaptiveLabSizeTest, ShrinksWhenFragmented) {
+  AdaptiveLabSize lab_size;
+  base::TimeTicks now = base::TimeTicks::Now();
+  lab_size.NotifyRefill(now);
+  for (int i = 0; i < 10; ++i) {
+    now += kQuickRefill;
+    lab_size.NotifyRefill(now);
+  }
+  ASSERT_EQ(AdaptiveLabSize::kMaxSize, lab_size.size());
+  lab_size.NotifyFragmented();
+  EXPECT_EQ(AdaptiveLabSize::kMaxSize / 2, lab_size.size());
+  for (int i = 0; i < 10; ++i) lab_size.NotifyFragmented();
+  EXPECT_EQ(AdaptiveLabSize::kMinSize, lab_size.size());
+}
+
+}  // namespace v8::internal
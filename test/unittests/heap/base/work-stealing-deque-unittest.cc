@@ -0,0 +1,144 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/base/work-stealing-deque.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "src/base/platform/platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace heap {
+namespace base {
+
+namespace {
+constexpr size_t kCapacity = 64;
+using TestDeque = WorkStealingDeque<uintptr_t, kCapacity>;
+}  // namespace
+
+TEST(WorkStealingDequeTest, EmptyOnCreation) {
+  TestDeque deque;
+  EXPECT_TRUE(deque.IsEmpty());
+  EXPECT_EQ(0u, deque.Size());
+  uintptr_t entry;
+  EXPECT_FALSE(deque.Pop(&entry));
+  EXPECT_FALSE(deque.Steal(&entry));
+}
+
+TEST(WorkStealingDequeTest, PopIsLifo) {
+  TestDeque deque;
+  EXPECT_TRUE(deque.Push(1));
+  EXPECT_TRUE(deque.Push(2));
+  EXPECT_EQ(2u, deque.Size());
+  uintptr_t entry;
+  EXPECT_TRUE(deque.Pop(&entry));
+  EXPECT_EQ(2u, entry);
+  EXPECT_TRUE(deque.Pop(&entry));
+  EXPECT_EQ(1u, entry);
+  EXPECT_TRUE(deque.IsEmpty());
+}
+
+TEST(WorkStealingDequeTest, StealIsFifo) {
+  TestDeque deque;
+  EXPECT_TRUE(deque.Push(1));
+  EXPECT_TRUE(deque.Push(2));
+  uintptr_t entry;
+  EXPECT_TRUE(deque.Steal(&entry));
+  EXPECT_EQ(1u, entry);
+  EXPECT_TRUE(deque.Pop(&entry));
+  EXPECT_EQ(2u, entry);
+  EXPECT_FALSE(deque.Steal(&entry));
+}
+
+TEST(WorkStealingDequeTest, PushFailsWhenFull) {
+  TestDeque deque;
+  for (uintptr_t i = 0; i < kCapacity; ++i) {
+    EXPECT_TRUE(deque.Push(i));
+  }
+  EXPECT_FALSE(deque.Push(kCapacity));
+  uintptr_t entry;
+  EXPECT_TRUE(deque.Steal(&entry));
+  EXPECT_EQ(0u, entry);
+  EXPECT_TRUE(deque.Push(kCapacity));
+  EXPECT_EQ(kCapacity, deque.Size());
+}
+
+TEST(WorkStealingDequeTest, WrapAround) {
+  TestDeque deque;
+  uintptr_t entry;
+  for (uintptr_t i = 0; i < 10 * kCapacity; ++i) {
+    EXPECT_TRUE(deque.Push(i));
+    EXPECT_TRUE(deque.Push(i + 1));
+    EXPECT_TRUE(deque.Steal(&entry));
+    EXPECT_EQ(i, entry);
+    EXPECT_TRUE(deque.Pop(&entry));
+    EXPECT_EQ(i + 1, entry);
+  }
+  EXPECT_TRUE(deque.IsEmpty());
+}
+
+namespace {
+
+class StealingThread final : public v8::base::Thread {
+ public:
+  StealingThread(TestDeque* deque, std::atomic<bool>* done)
+      : v8::base::Thread(Options("StealingThread")),
+        deque_(deque),
+        done_(done) {}
+
+  void Run() override {
+    uintptr_t entry;
+    while (!done_->load(std::memory_order_acquire) || !deque_->IsEmpty()) {
+      if (deque_->Steal(&entry)) stolen_.push_back(entry);
+    }
+  }
+
+  const std::vector<uintptr_t>& stolen() const { return stolen_; }
+
+ private:
+  TestDeque* deque_;
+  std::atomic<bool>* done_;
+  std::vector<uintptr_t> stolen_;
+};
+
+}  // namespace
+
+TEST(WorkStealingDequeTest, ConcurrentStealingSeesEachEntryOnce) {
+  static constexpr uintptr_t kEntries = 100000;
+  static constexpr size_t kThieves = 4;
+  TestDeque deque;
+  std::atomic<bool> done{false};
+  std::vector<std::unique_ptr<StealingThread>> thieves;
+  for (size_t i = 0; i < kThieves; ++i) {
+    thieves.push_back(std::make_unique<StealingThread>(&deque, &done));
+    CHECK(thieves.back()->Start());
+  }
+  std::vector<uintptr_t> popped;
+  uintptr_t entry;
+  for (uintptr_t i = 0; i < kEntries;) {
+    if (deque.Push(i)) {
+      ++i;
+      continue;
+    }
+    if (deque.Pop(&entry)) popped.push_back(entry);
+  }
+  while (deque.Pop(&entry)) popped.push_back(entry);
+  done.store(true, std::memory_order_release);
+  for (auto& thief : thieves) thief->Join();
+
+  std::vector<uint8_t> seen(kEntries, 0);
+  for (uintptr_t value : popped) seen[value]++;
+  for (auto& thief : thieves) {
+    for (uintptr_t value : thief->stolen()) seen[value]++;
+  }
+  for (uintptr_t i = 0; i < kEntries; ++i) {
+    EXPECT_EQ(1, seen[i]) << "entry " << i;
+  }
+}
+
+}  // namespace base
+}  // namespace heap
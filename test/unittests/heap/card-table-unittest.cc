@@ -0,0 +1,86 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/card-table.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+
+constexpr size_t kChunkSize = 256 * 1024;
+
+class CardTableTest : public ::testing::Test {
+ public:
+  CardTableTest() : card_table_(CardTable::Allocate(kChunkSize)) {}
+  ~CardTableTest() override { CardTable::Delete(card_table_); }
+
+  CardTable* card_table() { return card_table_; }
+
+ private:
+  CardTable* card_table_;
+};
+
+}  // namespace
+
+TEST_F(CardTableTest, CleanOnAllocation) {
+  EXPECT_EQ(kChunkSize / CardTable::kCardSize, card_table()->num_cards());
+  size_t calls = 0;
+  EXPECT_EQ(0u, card_table()->Iterate([&calls](size_t, size_t) {
+    ++calls;
+    return KEEP_SLOT;
+  }));
+  EXPECT_EQ(0u, calls);
+}
+
+TEST_F(CardTableTest, CardsForSizeRoundsUp) {
+  EXPECT_EQ(1u, CardTable::CardsForSize(1));
+  EXPECT_EQ(1u, CardTable::CardsForSize(CardTable::kCardSize));
+  EXPECT_EQ(2u, CardTable::CardsForSize(CardTable::kCardSize + 1));
+}
+
+TEST_F(CardTableTest, MarkCoversWholeCard) {
+  const size_t offset = 3 * CardTable::kCardSize + 8;
+  card_table()->Mark(offset);
+  EXPECT_TRUE(card_table()->IsMarked(3 * CardTable::kCardSize));
+  EXPECT_TRUE(card_table()->IsMarked(4 * CardTable::kCardSize - 1));
+  EXPECT_FALSE(card_table()->IsMarked(2 * CardTable::kCardSize));
+  EXPECT_FALSE(card_table()->IsMarked(4 * CardTable::kCardSize));
+}
+
+TEST_F(CardTableTest, IterateVisitsDirtyCardsInOrder) {
+  card_table()->Mark(7 * CardTable::kCardSize);
+  card_table()->Mark(1 * CardTable::kCardSize + 16);
+  card_table()->Mark(1 * CardTable::kCardSize + 32);
+  card_table()->Mark(kChunkSize - 8);
+  std::vector<std::pair<size_t, size_t>> cards;
+  EXPECT_EQ(3u, card_table()->Iterate([&cards](size_t start, size_t end) {
+    cards.emplace_back(start, end);
+    return KEEP_SLOT;
+  }));
+  ASSERT_EQ(3u, cards.size());
+  EXPECT_EQ(1 * CardTable::kCardSize, cards[0].first);
+  EXPECT_EQ(2 * CardTable::kCardSize, cards[0].second);
+  EXPECT_EQ(7 * CardTable::kCardSize, cards[1].first);
+  EXPECT_EQ(kChunkSize - CardTable::kCardSize, cards[2].first);
+  EXPECT_EQ(kChunkSize, cards[2].second);
+}
+
+TEST_F(CardTableTest, IterateCleansRemovedCards) {
+  card_table()->Mark(0);
+  card_table()->Mark(CardTable::kCardSize);
+  EXPECT_EQ(1u, card_table()->Iterate([](size_t start, size_t) {
+    return start == 0 ? KEEP_SLOT : REMOVE_SLOT;
+  }));
+  EXPECT_TRUE(card_table()->IsMarked(0));
+  EXPECT_FALSE(card_table()->IsMarked(CardTable::kCardSize));
+  EXPECT_EQ(0u, card_table()->Iterate(
+                    [](size_t, size_t) { return REMOVE_SLOT; }));
+  EXPECT_FALSE(card_table()->IsMarked(0));
+}
+
+}  // namespace v8::internal
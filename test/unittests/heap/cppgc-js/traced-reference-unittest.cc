@@ -6,6 +6,7 @@
 #include "include/v8-traced-handle.h"
 #include "src/api/api-inl.h"
 #include "src/handles/global-handles.h"
+#include "src/handles/traced-handles.h"
 #include "src/heap/cppgc/visitor.h"
 #include "src/heap/marking-state-inl.h"
 #include "test/unittests/heap/heap-utils.h"
@@ -62,6 +63,36 @@ TEST_F(TracedReferenceTest, Reset) {
   }
 }
 
+TEST_F(TracedReferenceTest, ResetBatch) {
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  {
+    v8::HandleScope handles(v8_isolate());
+    constexpr size_t kCount = 100;
+    v8::Local<v8::Object> locals[kCount];
+    for (size_t i = 0; i < kCount; ++i) {
+      // Leave every tenth value empty.
+      if (i % 10 == 0) continue;
+      locals[i] = v8::Object::New(v8_isolate());
+    }
+    TracedHandles* traced_handles = i_isolate()->traced_handles();
+    const size_t used_nodes_before = traced_handles->used_node_count();
+    v8::TracedReference<v8::Object> refs[kCount];
+    v8::TracedReference<v8::Object>::ResetBatch(v8_isolate(), refs, locals,
+                                                kCount);
+    EXPECT_EQ(used_nodes_before + 90, traced_handles->used_node_count());
+    for (size_t i = 0; i < kCount; ++i) {
+      EXPECT_EQ(locals[i].IsEmpty(), refs[i].IsEmpty());
+      if (!locals[i].IsEmpty()) EXPECT_EQ(refs[i], locals[i]);
+    }
+    v8::TracedReference<v8::Object>::ResetBatch(refs, kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+      EXPECT_TRUE(refs[i].IsEmpty());
+    }
+    EXPECT_EQ(used_nodes_before, traced_handles->used_node_count());
+  }
+}
+
 TEST_F(TracedReferenceTest, Copy) {
   v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
   v8::Context::Scope context_scope(context);
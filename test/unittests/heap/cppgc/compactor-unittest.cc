@@ -6,6 +6,7 @@
 
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/custom-space.h"
+#include "include/cppgc/member.h"
 #include "include/cppgc/persistent.h"
 #include "src/heap/cppgc/garbage-collector.h"
 #include "src/heap/cppgc/heap-object-header.h"
@@ -63,15 +64,37 @@ struct CompactableHolder
   CompactableGCed* objects[kNumObjects]{};
 };
 
+struct Node : public GarbageCollected<Node> {
+ public:
+  explicit Node(size_t id) : id(id) {}
+  void Trace(Visitor* visitor) const { visitor->Trace(next); }
+  Member<Node> next;
+  size_t id;
+};
+
+// Large enough to not share a space with `Node`.
+struct NodeHolder : public GarbageCollected<NodeHolder> {
+ public:
+  void Trace(Visitor* visitor) const { visitor->Trace(head); }
+  Member<Node> head;
+  char padding[256];
+};
+
 class CompactorTest : public testing::TestWithPlatform {
  public:
-  CompactorTest() {
+  CompactorTest() : CompactorTest(false) {}
+
+ protected:
+  explicit CompactorTest(bool compact_default_spaces) {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.compact_default_spaces = compact_default_spaces;
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
+ public:
+
   void StartCompaction() {
     compactor().EnableForNextGCForTesting();
     compactor().InitializeIfShouldCompact(GCConfig::MarkingType::kIncremental,
@@ -110,6 +133,46 @@ class CompactorTest : public testing::TestWithPlatform {
   std::unique_ptr<cppgc::Heap> heap_;
 };
 
+class DefaultSpaceCompactorTest : public CompactorTest {
+ public:
+  DefaultSpaceCompactorTest() : CompactorTest(true) {}
+
+  // Allocates `kNumPages` pages of nodes and links every `kLiveNodeStride`-th
+  // node into the list at `holder->head`.
+  static constexpr size_t kNumPages = 4;
+  static constexpr size_t kLiveNodeStride = 8;
+  static constexpr size_t kNodesPerPage =
+      kPageSize / (sizeof(Node) + sizeof(HeapObjectHeader));
+
+  void AllocateSparseList(NodeHolder* holder) {
+    Node* tail = nullptr;
+    for (size_t i = 0; i < kNumPages * kNodesPerPage; ++i) {
+      Node* node = MakeGarbageCollected<Node>(GetAllocationHandle(), i);
+      if (i % kLiveNodeStride) continue;
+      if (tail) {
+        tail->next = node;
+      } else {
+        holder->head = node;
+      }
+      tail = node;
+    }
+  }
+
+  static void VerifySparseList(const NodeHolder* holder) {
+    size_t expected_id = 0;
+    for (const Node* node = holder->head; node; node = node->next) {
+      EXPECT_EQ(expected_id, node->id);
+      expected_id += kLiveNodeStride;
+    }
+    EXPECT_EQ(RoundUp<kLiveNodeStride>(kNumPages * kNodesPerPage),
+              expected_id);
+  }
+
+  static size_t NumberOfPagesInSpaceOf(const void* object) {
+    return BasePage::FromPayload(object)->space().size();
+  }
+};
+
 }  // namespace
 
 }  // namespace internal
@@ -253,5 +316,38 @@ TEST_F(CompactorTest, OnStackSlotShouldBeFiltered) {
   EndGC();
 }
 
+TEST_F(CompactorTest, DefaultSpacesAreNotCompactedByDefault) {
+  Node* node = MakeGarbageCollected<Node>(GetAllocationHandle(), 0);
+  EXPECT_FALSE(BasePage::FromPayload(node)->space().is_compactable());
+}
+
+TEST_F(DefaultSpaceCompactorTest, MembersAreUpdated) {
+  Persistent<NodeHolder> holder =
+      MakeGarbageCollected<NodeHolder>(GetAllocationHandle());
+  AllocateSparseList(holder.Get());
+  const Node* head = holder->head;
+  const size_t pages_before = NumberOfPagesInSpaceOf(head);
+  EXPECT_LE(kNumPages, pages_before);
+  StartGC();
+  EndGC();
+  VerifySparseList(holder.Get());
+  EXPECT_GT(pages_before, NumberOfPagesInSpaceOf(holder->head.Get()));
+}
+
+TEST_F(DefaultSpaceCompactorTest, ObjectsReferencedFromPersistentsAreNotMoved) {
+  Persistent<NodeHolder> holder =
+      MakeGarbageCollected<NodeHolder>(GetAllocationHandle());
+  AllocateSparseList(holder.Get());
+  Node* pinned = holder->head;
+  for (size_t i = 0; i < kNodesPerPage * 2; i += kLiveNodeStride) {
+    pinned = pinned->next;
+  }
+  Persistent<Node> persistent(pinned);
+  StartGC();
+  EndGC();
+  VerifySparseList(holder.Get());
+  EXPECT_EQ(pinned, persistent.Get());
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "include/cppgc/allocation.h"
+#include "include/cppgc/macros.h"
 #include "include/cppgc/platform.h"
 #include "include/v8-platform.h"
 #include "src/heap/cppgc/globals.h"
@@ -62,11 +63,34 @@ class NonFinalizable : public GarbageCollected<NonFinalizable<Size>> {
 using NormalNonFinalizable = NonFinalizable<32>;
 using LargeNonFinalizable = NonFinalizable<kLargeObjectSizeThreshold * 2>;
 
+size_t g_thread_safe_destructor_callcount;
+
+template <size_t Size>
+class ThreadSafeFinalizable
+    : public GarbageCollected<ThreadSafeFinalizable<Size>> {
+  CPPGC_THREAD_SAFE_FINALIZER();
+
+ public:
+  ~ThreadSafeFinalizable() { ++g_thread_safe_destructor_callcount; }
+
+  void Trace(cppgc::Visitor*) const {}
+
+ private:
+  char array_[Size];
+};
+
+using NormalThreadSafeFinalizable = ThreadSafeFinalizable<32>;
+using LargeThreadSafeFinalizable =
+    ThreadSafeFinalizable<kLargeObjectSizeThreshold * 2>;
+
 }  // namespace
 
 class ConcurrentSweeperTest : public testing::TestWithHeap {
  public:
-  ConcurrentSweeperTest() { g_destructor_callcount = 0; }
+  ConcurrentSweeperTest() {
+    g_destructor_callcount = 0;
+    g_thread_safe_destructor_callcount = 0;
+  }
 
   void StartSweeping() {
     Heap* heap = Heap::From(GetHeap());
@@ -298,6 +322,57 @@ TEST_F(ConcurrentSweeperTest, DeferredFinalizationOfLargePage) {
   EXPECT_FALSE(PageInBackend(page));
 }
 
+TEST_F(ConcurrentSweeperTest, ConcurrentFinalizationOfNormalPage) {
+  static constexpr size_t kNumberOfObjects = 10;
+  // Thread-safe finalizers are invoked by the concurrent sweeper.
+  using GCedType = NormalThreadSafeFinalizable;
+
+  std::vector<void*> objects;
+  BaseSpace* space = nullptr;
+  for (size_t i = 0; i < kNumberOfObjects; ++i) {
+    auto* object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+    objects.push_back(object);
+    if (!space) space = &BasePage::FromPayload(object)->space();
+  }
+
+  StartSweeping();
+
+  // Wait for concurrent sweeping to finish.
+  WaitForConcurrentSweeping();
+
+  // Check that finalizers have been executed and free list entries created
+  // without involving the main thread.
+  EXPECT_EQ(kNumberOfObjects, g_thread_safe_destructor_callcount);
+  CheckFreeListEntries(objects);
+
+  FinishSweeping();
+
+  EXPECT_TRUE(FreeListContains(*space, objects));
+  EXPECT_EQ(kNumberOfObjects, g_thread_safe_destructor_callcount);
+}
+
+TEST_F(ConcurrentSweeperTest, ConcurrentFinalizationOfLargePage) {
+  using GCedType = LargeThreadSafeFinalizable;
+
+  auto* object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+  auto* page = BasePage::FromPayload(object);
+
+  StartSweeping();
+
+  // Wait for concurrent sweeping to finish.
+  WaitForConcurrentSweeping();
+
+  // Check that the destructor was executed but the page is still only
+  // destroyed on the main thread.
+  EXPECT_EQ(1u, g_thread_safe_destructor_callcount);
+  EXPECT_TRUE(PageInBackend(page));
+
+  FinishSweeping();
+
+  EXPECT_EQ(1u, g_thread_safe_destructor_callcount);
+  EXPECT_FALSE(PageInBackend(page));
+}
+
 TEST_F(ConcurrentSweeperTest, DestroyLargePageOnMainThread) {
   // This test fails with TSAN when large pages are destroyed concurrently
   // without proper support by the backend.
@@ -4,6 +4,8 @@
 
 #include "src/heap/cppgc/heap-statistics-collector.h"
 
+#include <numeric>
+
 #include "include/cppgc/heap-statistics.h"
 #include "include/cppgc/persistent.h"
 #include "src/base/logging.h"
@@ -222,5 +224,32 @@ TEST_F(HeapStatisticsCollectorTest,
   EXPECT_TRUE(found_page);
 }
 
+TEST_F(HeapStatisticsCollectorTest, FragmentedSizeOnNormalPage) {
+  Persistent<GCed<1>> holder =
+      MakeGarbageCollected<GCed<1>>(GetHeap()->GetAllocationHandle());
+  internal::Heap::From(GetHeap())->CollectGarbage(
+      {CollectionType::kMajor, Heap::StackState::kNoHeapPointers,
+       cppgc::Heap::MarkingType::kAtomic, cppgc::Heap::SweepingType::kAtomic,
+       GCConfig::FreeMemoryHandling::kDoNotDiscard});
+  HeapStatistics detailed_stats = Heap::From(GetHeap())->CollectStatistics(
+      HeapStatistics::DetailLevel::kDetailed);
+  bool found_page = false;
+  for (const auto& space_stats : detailed_stats.space_stats) {
+    EXPECT_FALSE(space_stats.is_compactable);
+    if (space_stats.committed_size_bytes == 0) {
+      EXPECT_EQ(0u, space_stats.fragmented_size_bytes);
+      continue;
+    }
+    // Without discarding, all free memory on the page is fragmented.
+    const std::vector<size_t>& free_size =
+        space_stats.free_list_stats.free_size;
+    EXPECT_EQ(std::accumulate(free_size.begin(), free_size.end(), size_t{0}),
+              space_stats.fragmented_size_bytes);
+    EXPECT_LT(0u, space_stats.fragmented_size_bytes);
+    found_page = true;
+  }
+  EXPECT_TRUE(found_page);
+}
+
 }  // namespace internal
 }  // namespace cppgc
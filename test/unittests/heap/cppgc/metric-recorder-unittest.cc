@@ -278,6 +278,28 @@ TEST_F(MetricRecorderTest, CycleEndHistogramReportsCorrectValues) {
             kEfficiencyComparisonTolerance);
 }
 
+TEST_F(MetricRecorderTest, PrefinalizerDurationReportedOnGcEnd) {
+  StartGC();
+  EndGC(0);
+  EXPECT_EQ(0,
+            MetricRecorderImpl::GCCycle_event
+                .main_thread_atomic_prefinalizer_duration_us);
+  StartGC();
+  {
+    StatsCollector::EnabledScope scope(
+        Heap::From(GetHeap())->stats_collector(),
+        StatsCollector::kSweepInvokePreFinalizers);
+    scope.DecreaseStartTimeForTesting(
+        v8::base::TimeDelta::FromMilliseconds(10));
+  }
+  EndGC(0);
+  static constexpr int64_t kDurationComparisonTolerance = 5000;
+  EXPECT_LT(std::abs(MetricRecorderImpl::GCCycle_event
+                         .main_thread_atomic_prefinalizer_duration_us -
+                     10000),
+            kDurationComparisonTolerance);
+}
+
 TEST_F(MetricRecorderTest, ObjectSizeMetricsNoAllocations) {
   // Populate previous event.
   StartGC();
@@ -554,6 +554,37 @@ TEST_F(GlobalHandlesTest, SecondPassPhantomCallbacks) {
   CHECK(fp.flag);
 }
 
+namespace {
+
+void ThreadSafeFirstPassCallback(
+    const v8::WeakCallbackInfo<FlagAndHandles>& data) {
+  data.GetParameter()->handle.Reset();
+  data.SetThreadSafeSecondPassCallback(SecondPassCallback);
+}
+
+}  // namespace
+
+TEST_F(GlobalHandlesTest, ThreadSafeSecondPassPhantomCallbacks) {
+  v8::Isolate* isolate = v8_isolate();
+  ManualGCScope manual_gc_scope(i_isolate());
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      i_isolate()->heap());
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  FlagAndHandles fp;
+  ConstructJSApiObject(isolate, context, &fp);
+  fp.flag = false;
+  fp.handle.SetWeak(&fp, ThreadSafeFirstPassCallback,
+                    v8::WeakCallbackType::kParameter);
+  // A non-forced GC hands thread-safe second pass callbacks to worker
+  // threads.
+  i_isolate()->heap()->CollectAllGarbage(GCFlag::kNoFlags,
+                                         GarbageCollectionReason::kTesting);
+  i_isolate()->global_handles()->WaitForThreadSafeSecondPassCallbacks();
+  CHECK(fp.flag);
+}
+
 TEST_F(GlobalHandlesTest, MoveStrongGlobal) {
   v8::Isolate* isolate = v8_isolate();
   v8::HandleScope scope(isolate);
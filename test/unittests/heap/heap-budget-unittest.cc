@@ -0,0 +1,79 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap-budget.h"
+
+#include "src/common/globals.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr size_t kMinHeadroom = 2 * MB;
+
+// Keys only need to be distinct.
+const void* const kFirst = reinterpret_cast<const void*>(8);
+const void* const kSecond = reinterpret_cast<const void*>(16);
+
+}  // namespace
+
+TEST(HeapBudgetTest, RegisterAndUnregister) {
+  HeapBudgetImpl budget(100 * MB);
+  EXPECT_EQ(0u, budget.NumberOfIsolates());
+  budget.Register(kFirst);
+  budget.Register(kSecond);
+  EXPECT_EQ(2u, budget.NumberOfIsolates());
+  budget.UpdateAndComputeHeadroom(kFirst, 10 * MB, 10 * MB, kMinHeadroom);
+  EXPECT_EQ(20 * MB, budget.AllocatedBytes());
+  budget.Unregister(kFirst);
+  budget.Unregister(kSecond);
+  EXPECT_EQ(0u, budget.NumberOfIsolates());
+  EXPECT_EQ(0u, budget.AllocatedBytes());
+}
+
+TEST(HeapBudgetTest, DesiredHeadroomIsGrantedWhenItFits) {
+  HeapBudgetImpl budget(100 * MB);
+  budget.Register(kFirst);
+  budget.Register(kSecond);
+  EXPECT_EQ(20 * MB, budget.UpdateAndComputeHeadroom(kFirst, 20 * MB, 20 * MB,
+                                                     kMinHeadroom));
+  EXPECT_EQ(30 * MB, budget.UpdateAndComputeHeadroom(kSecond, 10 * MB, 30 * MB,
+                                                     kMinHeadroom));
+  EXPECT_EQ(80 * MB, budget.AllocatedBytes());
+  budget.Unregister(kFirst);
+  budget.Unregister(kSecond);
+}
+
+TEST(HeapBudgetTest, HeadroomIsSplitProportionallyWhenOverCommitted) {
+  HeapBudgetImpl budget(100 * MB);
+  budget.Register(kFirst);
+  budget.Register(kSecond);
+  // 40MB live in total, 60MB left to share. Desired headroom is 60MB and
+  // 120MB, i.e., a 1:2 split.
+  budget.UpdateAndComputeHeadroom(kFirst, 20 * MB, 60 * MB, kMinHeadroom);
+  EXPECT_EQ(40 * MB, budget.UpdateAndComputeHeadroom(kSecond, 20 * MB,
+                                                     120 * MB, kMinHeadroom));
+  EXPECT_EQ(20 * MB, budget.UpdateAndComputeHeadroom(kFirst, 20 * MB, 60 * MB,
+                                                     kMinHeadroom));
+  EXPECT_EQ(100 * MB, budget.AllocatedBytes());
+  budget.Unregister(kFirst);
+  budget.Unregister(kSecond);
+}
+
+TEST(HeapBudgetTest, MinimumHeadroomWhenExhausted) {
+  HeapBudgetImpl budget(10 * MB);
+  budget.Register(kFirst);
+  EXPECT_EQ(kMinHeadroom, budget.UpdateAndComputeHeadroom(
+                              kFirst, 20 * MB, 10 * MB, kMinHeadroom));
+  budget.SetTotalBytes(40 * MB);
+  EXPECT_EQ(40 * MB, budget.TotalBytes());
+  EXPECT_EQ(10 * MB, budget.UpdateAndComputeHeadroom(kFirst, 20 * MB, 10 * MB,
+                                                     kMinHeadroom));
+  budget.Unregister(kFirst);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -28,6 +28,7 @@
 #include "src/heap/trusted-range.h"
 #include "src/objects/fixed-array.h"
 #include "src/objects/free-space-inl.h"
+#include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/sandbox/external-pointer-table.h"
 #include "test/unittests/heap/heap-utils.h"
@@ -488,6 +489,52 @@ TEST_F(HeapTest, RememberedSet_InsertOnPromotingObjectToOld) {
   }
 }
 
+TEST_F(HeapTest, RememberedSet_CardTableForLargeFixedArray) {
+  if (v8_flags.single_generation || v8_flags.minor_ms) return;
+  v8_flags.card_table_old_to_new = true;
+  ManualGCScope manual_gc_scope(isolate());
+  Factory* factory = isolate()->factory();
+  Heap* heap = isolate()->heap();
+  HandleScope handle_scope(isolate());
+
+  const int kLength = kMaxRegularHeapObjectSize / kTaggedSize + 1;
+  const int kIndex = kLength - 1;
+  DirectHandle<FixedArray> arr =
+      factory->NewFixedArray(kLength, AllocationType::kOld);
+  CHECK(heap->lo_space()->Contains(*arr));
+  MutablePageMetadata* page = MutablePageMetadata::FromHeapObject(*arr);
+  CHECK_NULL(page->card_table());
+
+  // Storing a young object marks the card of the slot instead of inserting the
+  // slot into the slot set.
+  {
+    HandleScope scope_inner(isolate());
+    DirectHandle<Object> number = factory->NewHeapNumber(42);
+    arr->set(kIndex, *number);
+  }
+  CardTable* card_table = page->card_table();
+  ASSERT_NE(nullptr, card_table);
+  const size_t offset =
+      page->Offset(arr->RawFieldOfElementAt(kIndex).address());
+  CHECK(card_table->IsMarked(offset));
+  CHECK_EQ(0, GetRememberedSetSize<OLD_TO_NEW>(*arr));
+
+  // The scavenger finds the young object through the card. The card stays
+  // dirty as long as the object is young.
+  {
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+    InvokeMinorGC();
+  }
+  CHECK_EQ(42, Cast<HeapNumber>(arr->get(kIndex))->value());
+  CHECK_EQ(HeapLayout::InYoungGeneration(arr->get(kIndex)),
+           card_table->IsMarked(offset));
+
+  // Full GCs empty the young generation and release the card table.
+  InvokeMajorGC();
+  CHECK_EQ(42, Cast<HeapNumber>(arr->get(kIndex))->value());
+  CHECK_NULL(page->card_table());
+}
+
 TEST_F(HeapTest, Regress978156) {
   if (!v8_flags.incremental_marking) return;
   if (v8_flags.single_generation) return;
@@ -567,6 +614,46 @@ TEST_F(HeapTest, SemiSpaceNewSpaceGrowsDuringFullGCIncrementalMarking) {
             heap->tracer()->CurrentEpoch(GCTracer::Scope::ScopeId::SCAVENGER));
 }
 
+TEST_F(HeapTest, IdleNotificationFinishesIncrementalMarkingAndSweeping) {
+  if (!v8_flags.incremental_marking) return;
+  ManualGCScope manual_gc_scope(isolate());
+  Heap* heap = isolate()->heap();
+
+  const auto gc_count = heap->gc_count();
+  heap->StartIncrementalMarking(GCFlag::kNoFlags,
+                                GarbageCollectionReason::kTesting);
+  CHECK(heap->incremental_marking()->IsMajorMarking());
+
+  static constexpr double kIdleTimeInSeconds = 10;
+  static constexpr int kMaxIdleNotifications = 100;
+  bool done = false;
+  for (int i = 0; i < kMaxIdleNotifications && !done; ++i) {
+    done = v8_isolate()->IdleNotificationDeadline(
+        heap->MonotonicallyIncreasingTimeInMs() / 1000 + kIdleTimeInSeconds);
+  }
+  EXPECT_TRUE(done);
+  EXPECT_LT(gc_count, heap->gc_count());
+  EXPECT_FALSE(heap->incremental_marking()->IsMajorMarking());
+  EXPECT_FALSE(heap->major_sweeping_in_progress());
+}
+
+TEST_F(HeapTest, IdleNotificationWithoutIdleTimeDoesNotFinalizeMarking) {
+  if (!v8_flags.incremental_marking) return;
+  ManualGCScope manual_gc_scope(isolate());
+  Heap* heap = isolate()->heap();
+
+  const auto gc_count = heap->gc_count();
+  heap->StartIncrementalMarking(GCFlag::kNoFlags,
+                                GarbageCollectionReason::kTesting);
+  CHECK(heap->incremental_marking()->IsMajorMarking());
+
+  // A deadline in the past leaves no room for any work.
+  EXPECT_FALSE(v8_isolate()->IdleNotificationDeadline(
+      heap->MonotonicallyIncreasingTimeInMs() / 1000 - 1));
+  EXPECT_EQ(gc_count, heap->gc_count());
+  EXPECT_TRUE(heap->incremental_marking()->IsMajorMarking());
+}
+
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
 namespace {
 struct RandomGCIntervalTestSetter {
@@ -18,10 +18,17 @@ template <typename TMixin>
 class WithInnerPointerResolutionMixin : public TMixin {
  public:
   Address ResolveInnerPointer(Address maybe_inner_ptr) {
+    ConservativeStackVisitor visitor(this->isolate(), nullptr);
+    return ResolveInnerPointer(&visitor, maybe_inner_ptr);
+  }
+
+  // Resolves the inner pointer with a visitor that may already have recorded
+  // object starts while resolving other pointers.
+  Address ResolveInnerPointer(ConservativeStackVisitor* visitor,
+                              Address maybe_inner_ptr) {
     // This can only resolve inner pointers in the regular cage.
     PtrComprCageBase cage_base{this->isolate()};
-    return ConservativeStackVisitor(this->isolate(), nullptr)
-        .FindBasePtr(maybe_inner_ptr, cage_base);
+    return visitor->FindBasePtr(maybe_inner_ptr, cage_base);
   }
 };
 
@@ -233,10 +240,13 @@ class InnerPointerResolutionTest
   }
 
   // This must be called with a created object and an offset inside it.
-  void RunTestInside(const ObjectRequest& object, int offset) {
+  void RunTestInside(const ObjectRequest& object, int offset,
+                     ConservativeStackVisitor* visitor = nullptr) {
     DCHECK_LE(0, offset);
     DCHECK_GT(object.size, offset);
-    Address base_ptr = ResolveInnerPointer(object.address + offset);
+    Address base_ptr =
+        visitor ? ResolveInnerPointer(visitor, object.address + offset)
+                : ResolveInnerPointer(object.address + offset);
     bool should_return_null =
         !IsPageAlive(object.page_id) || object.type == ObjectRequest::FREE;
     if (should_return_null)
@@ -266,6 +276,16 @@ class InnerPointerResolutionTest
     RunTestOutside(kNullAddress);
     RunTestOutside(static_cast<Address>(42));
     RunTestOutside(static_cast<Address>(kZapValue));
+
+    // Resolve the same pointers with a single visitor, in reverse order, so
+    // that object starts recorded earlier are used for lower addresses.
+    ConservativeStackVisitor visitor(isolate(), nullptr);
+    for (auto it = objects_.rbegin(); it != objects_.rend(); ++it) {
+      RunTestInside(*it, it->size - 1, &visitor);
+      RunTestInside(*it, it->size / 2, &visitor);
+      RunTestInside(*it, 1, &visitor);
+      RunTestInside(*it, 0, &visitor);
+    }
   }
 
  private:
@@ -389,6 +389,39 @@ TEST_F(PoolTest, UnmapOnTeardown) {
   tracking_page_allocator()->CheckIsFree(chunk_address, page_size);
 #endif  // V8_COMPRESS_POINTERS
 }
+
+TEST_F(PoolTest, DiscardOnMemoryReduction) {
+  v8_flags.discard_pooled_pages = true;
+  PageMetadata* page =
+      allocator()->AllocatePage(MemoryAllocator::AllocationMode::kRegular,
+                                static_cast<PagedSpace*>(heap()->old_space()),
+                                Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  Address chunk_address = page->ChunkAddress();
+  const size_t commit_page_size = tracking_page_allocator()->CommitPageSize();
+  Address discarded_start = RoundUp(page->area_start(), commit_page_size);
+  size_t discarded_size = chunk_address + page->size() - discarded_start;
+
+  allocator()->Free(MemoryAllocator::FreeMode::kPool, page);
+  EXPECT_EQ(1u, pool()->NumberOfCommittedChunks());
+
+  // Memory-reducing GCs keep the page mapped but discard its contents.
+  pool()->ReduceMemory();
+  EXPECT_EQ(0u, pool()->NumberOfCommittedChunks());
+  EXPECT_EQ(1u, pool()->NumberOfDiscardedChunks());
+  tracking_page_allocator()->CheckPagePermissions(
+      discarded_start, discarded_size, PageAllocator::kReadWrite, false);
+
+  // The discarded page is reused for the next pooled allocation.
+  page = allocator()->AllocatePage(
+      MemoryAllocator::AllocationMode::kUsePool,
+      static_cast<PagedSpace*>(heap()->old_space()),
+      Executability::NOT_EXECUTABLE);
+  EXPECT_EQ(chunk_address, page->ChunkAddress());
+  EXPECT_EQ(0u, pool()->NumberOfDiscardedChunks());
+
+  allocator()->Free(MemoryAllocator::FreeMode::kImmediately, page);
+}
 #endif  // !V8_OS_FUCHSIA && !V8_ENABLE_SANDBOX
 
 }  // namespace internal
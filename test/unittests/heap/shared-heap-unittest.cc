@@ -6,6 +6,7 @@
 
 #include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap.h"
 #include "src/heap/parked-scope-inl.h"
 #include "src/objects/bytecode-array.h"
@@ -97,6 +98,27 @@ TEST_F(SharedHeapTest, ConcurrentAllocationInSharedOldSpace) {
       });
 }
 
+TEST_F(SharedHeapTest, AdaptiveSharedLabSizeOnClient) {
+  v8_flags.adaptive_shared_lab_size = true;
+  i_isolate()->main_thread_local_isolate()->ExecuteMainThreadWhileParked([]() {
+    SetupClientIsolateAndRunCallback(
+        [](v8::Isolate* client_isolate, Isolate* i_client_isolate) {
+          HandleScope scope(i_client_isolate);
+          GCTracer* tracer = i_client_isolate->heap()->tracer();
+          const size_t refills_before = tracer->shared_lab_refills();
+
+          for (int i = 0; i < kDefaultNumIterations; i++) {
+            i_client_isolate->factory()->NewFixedArray(
+                10, AllocationType::kSharedOld);
+          }
+
+          // Refills are attributed to the client that allocated.
+          EXPECT_LT(refills_before, tracer->shared_lab_refills());
+          EXPECT_LE(tracer->shared_lab_refills(), tracer->shared_lab_bytes());
+        });
+  });
+}
+
 namespace {
 class SharedTrustedSpaceAllocationThread final : public ParkingThread {
  public:
@@ -320,6 +320,22 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef TEST_BYTECODE
 }
 
+TEST(Bytecodes, IsConditionalJumpLookahead) {
+#define TEST_BYTECODE(Name, ...)                                              \
+  if (Bytecodes::IsConditionalJumpLookahead(Bytecode::k##Name,                \
+                                            OperandScale::kSingle)) {         \
+    /* The inlined jumps require a boolean in the accumulator. */             \
+    EXPECT_TRUE(Bytecodes::WritesAccumulator(Bytecode::k##Name));             \
+    EXPECT_FALSE(                                                             \
+        Bytecodes::IsStarLookahead(Bytecode::k##Name, OperandScale::kSingle)); \
+  }                                                                           \
+  EXPECT_FALSE(Bytecodes::IsConditionalJumpLookahead(Bytecode::k##Name,       \
+                                                     OperandScale::kDouble));
+
+  BYTECODE_LIST(TEST_BYTECODE, TEST_BYTECODE)
+#undef TEST_BYTECODE
+}
+
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
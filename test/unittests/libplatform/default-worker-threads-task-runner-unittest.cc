@@ -114,6 +114,86 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrderMultipleWorkers) {
   ASSERT_EQ(1, std::count(order.begin(), order.end(), 5));
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, IdleWorkerStealsTasks) {
+  DefaultWorkerThreadsTaskRunner runner(2, RealTime);
+
+  base::Semaphore blocked_started(0);
+  base::Semaphore unblock(0);
+  base::Semaphore done(0);
+  constexpr int kNumTasks = 10;
+  std::atomic_int count{0};
+
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    blocked_started.Signal();
+    unblock.Wait();
+  }));
+  blocked_started.Wait();
+
+  // Half of these tasks are queued for the blocked worker. The other worker
+  // has to steal them.
+  for (int i = 0; i < kNumTasks; ++i) {
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      if (++count == kNumTasks) done.Signal();
+    }));
+  }
+  done.Wait();
+  ASSERT_EQ(kNumTasks, count);
+
+  unblock.Signal();
+  runner.Terminate();
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskFromMultipleThreads) {
+  DefaultWorkerThreadsTaskRunner runner(4, RealTime);
+
+  constexpr int kNumPosters = 4;
+  constexpr int kTasksPerPoster = 1000;
+  std::vector<std::atomic_int> runs(kNumPosters * kTasksPerPoster);
+  std::atomic_int count{0};
+  base::Semaphore done(0);
+
+  class PosterThread final : public base::Thread {
+   public:
+    PosterThread(DefaultWorkerThreadsTaskRunner* runner, int first_task,
+                 std::vector<std::atomic_int>* runs, std::atomic_int* count,
+                 base::Semaphore* done)
+        : Thread(Options("PosterThread")),
+          runner_(runner),
+          first_task_(first_task),
+          runs_(runs),
+          count_(count),
+          done_(done) {}
+
+    void Run() override {
+      for (int i = first_task_; i < first_task_ + kTasksPerPoster; ++i) {
+        runner_->PostTask(std::make_unique<TestTask>([this, i] {
+          (*runs_)[i]++;
+          if (++*count_ == kNumPosters * kTasksPerPoster) done_->Signal();
+        }));
+      }
+    }
+
+   private:
+    DefaultWorkerThreadsTaskRunner* runner_;
+    int first_task_;
+    std::vector<std::atomic_int>* runs_;
+    std::atomic_int* count_;
+    base::Semaphore* done_;
+  };
+
+  std::vector<std::unique_ptr<PosterThread>> posters;
+  for (int i = 0; i < kNumPosters; ++i) {
+    posters.push_back(std::make_unique<PosterThread>(
+        &runner, i * kTasksPerPoster, &runs, &count, &done));
+    CHECK(posters.back()->Start());
+  }
+  for (auto& poster : posters) poster->Join();
+  done.Wait();
+
+  runner.Terminate();
+  for (const std::atomic_int& run : runs) ASSERT_EQ(1, run);
+}
+
 class FakeClock {
  public:
   static double time() { return time_.load(); }
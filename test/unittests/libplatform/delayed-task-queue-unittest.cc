@@ -0,0 +1,70 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/delayed-task-queue.h"
+
+#include "include/v8-platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+double fake_time = 0.0;
+double FakeTime() { return fake_time; }
+
+class EmptyTask : public Task {
+ public:
+  void Run() override {}
+};
+
+}  // namespace
+
+TEST(DelayedTaskQueueTest, AppendDelayedReportsEarliestDeadline) {
+  fake_time = 0.0;
+  DelayedTaskQueue queue(FakeTime);
+  EXPECT_TRUE(queue.AppendDelayed(std::make_unique<EmptyTask>(), 10));
+  EXPECT_FALSE(queue.AppendDelayed(std::make_unique<EmptyTask>(), 20));
+  EXPECT_FALSE(queue.AppendDelayed(std::make_unique<EmptyTask>(), 10));
+  EXPECT_TRUE(queue.AppendDelayed(std::make_unique<EmptyTask>(), 5));
+  queue.Terminate();
+}
+
+TEST(DelayedTaskQueueTest, WaitIncludesSlack) {
+  fake_time = 0.0;
+  DelayedTaskQueue queue(FakeTime);
+  queue.AppendDelayed(std::make_unique<EmptyTask>(), 1.0);
+
+  DelayedTaskQueue::MaybeNextTask next = queue.TryGetNext();
+  EXPECT_EQ(DelayedTaskQueue::MaybeNextTask::kWaitDelayed, next.state);
+  EXPECT_EQ(base::TimeDelta::FromSeconds(1), next.wait_time);
+
+  queue.set_slack(0.5);
+  next = queue.TryGetNext();
+  EXPECT_EQ(DelayedTaskQueue::MaybeNextTask::kWaitDelayed, next.state);
+  EXPECT_EQ(base::TimeDelta::FromMilliseconds(1500), next.wait_time);
+  queue.Terminate();
+}
+
+TEST(DelayedTaskQueueTest, TasksWithinSlackShareWakeUp) {
+  fake_time = 0.0;
+  DelayedTaskQueue queue(FakeTime);
+  queue.set_slack(0.5);
+  queue.AppendDelayed(std::make_unique<EmptyTask>(), 1.0);
+  queue.AppendDelayed(std::make_unique<EmptyTask>(), 1.25);
+  queue.AppendDelayed(std::make_unique<EmptyTask>(), 2.0);
+
+  // Wake up at the end of the slack window of the first task.
+  fake_time = 1.5;
+  EXPECT_EQ(DelayedTaskQueue::MaybeNextTask::kTask, queue.TryGetNext().state);
+  EXPECT_EQ(DelayedTaskQueue::MaybeNextTask::kTask, queue.TryGetNext().state);
+  DelayedTaskQueue::MaybeNextTask next = queue.TryGetNext();
+  EXPECT_EQ(DelayedTaskQueue::MaybeNextTask::kWaitDelayed, next.state);
+  EXPECT_EQ(base::TimeDelta::FromSeconds(1), next.wait_time);
+  queue.Terminate();
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -1,6 +1,7 @@
 // Copyright 2016 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <algorithm>
 #include <limits>
 
 #include "include/libplatform/v8-tracing.h"
@@ -45,6 +46,32 @@ TEST_F(PlatformTracingTest, TestTraceConfig) {
   delete trace_config;
 }
 
+TEST_F(PlatformTracingTest, TestTraceConfigSampling) {
+  TraceConfig* trace_config = new TraceConfig();
+  trace_config->AddIncludedCategory("v8");
+  trace_config->AddIncludedCategory("v8.execute");
+  trace_config->AddIncludedCategory(
+      TRACE_DISABLED_BY_DEFAULT("v8.runtime_stats"));
+  trace_config->SetCategorySamplingInterval("v8.execute", 10);
+  trace_config->SetCategorySamplingInterval(
+      TRACE_DISABLED_BY_DEFAULT("v8.runtime_stats"), 100);
+
+  CHECK_EQ(1u, trace_config->GetCategoryGroupSamplingInterval("v8"));
+  CHECK_EQ(10u, trace_config->GetCategoryGroupSamplingInterval("v8.execute"));
+  CHECK_EQ(100u, trace_config->GetCategoryGroupSamplingInterval(
+                     TRACE_DISABLED_BY_DEFAULT("v8.runtime_stats")));
+  CHECK_EQ(10u, trace_config->GetCategoryGroupSamplingInterval(
+                    "v8.execute,disabled-by-default-v8.runtime_stats"));
+  // Events of the category group are recorded for the unsampled category.
+  CHECK_EQ(1u, trace_config->GetCategoryGroupSamplingInterval("v8,v8.execute"));
+  // Categories that are not enabled don't matter.
+  CHECK_EQ(10u, trace_config->GetCategoryGroupSamplingInterval(
+                    "v8.execute,v8.cpu_profile"));
+  CHECK_EQ(1u, trace_config->GetCategoryGroupSamplingInterval("v8_execute"));
+
+  delete trace_config;
+}
+
 // Perfetto doesn't use TraceObject.
 #if !defined(V8_USE_PERFETTO)
 TEST_F(PlatformTracingTest, TestTraceObject) {
@@ -143,6 +170,60 @@ TEST_F(PlatformTracingTest, TestTraceBufferRingBuffer) {
   }
   delete ring_buffer;
 }
+
+class RingBufferWritingThread : public base::Thread {
+ public:
+  static constexpr int kEventCount = 100;
+
+  RingBufferWritingThread(TraceBuffer* ring_buffer, const char* name)
+      : base::Thread(base::Thread::Options("RingBufferWritingThread")),
+        ring_buffer_(ring_buffer),
+        name_(name) {}
+
+  void Run() override {
+    uint8_t category_enabled_flag = 41;
+    for (int i = 0; i < kEventCount; ++i) {
+      uint64_t handle;
+      TraceObject* trace_object = ring_buffer_->AddTraceEvent(&handle);
+      CHECK_NOT_NULL(trace_object);
+      trace_object->Initialize('X', &category_enabled_flag, name_, "Test.Scope",
+                               42, 123, 0, nullptr, nullptr, nullptr, nullptr,
+                               0, 1729, 4104);
+      ring_buffer_->CommitTraceEvent(handle);
+      CHECK_EQ(trace_object, ring_buffer_->GetEventByHandle(handle));
+    }
+  }
+
+ private:
+  TraceBuffer* ring_buffer_;
+  const char* name_;
+};
+
+TEST_F(PlatformTracingTest, TestTraceBufferRingBufferMultiThreaded) {
+  // Each thread fills chunks of its own, which all fit into the buffer.
+  const char* kNames[] = {"Test.Thread0", "Test.Thread1", "Test.Thread2",
+                          "Test.Thread3"};
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer =
+      TraceBuffer::CreateTraceBufferRingBuffer(16, writer);
+  std::vector<std::unique_ptr<RingBufferWritingThread>> threads;
+  for (const char* name : kNames) {
+    threads.push_back(
+        std::make_unique<RingBufferWritingThread>(ring_buffer, name));
+    CHECK(threads.back()->Start());
+  }
+  for (auto& thread : threads) thread->Join();
+
+  ring_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(arraysize(kNames) * RingBufferWritingThread::kEventCount,
+           events.size());
+  for (const char* name : kNames) {
+    CHECK_EQ(RingBufferWritingThread::kEventCount,
+             std::count(events.begin(), events.end(), std::string(name)));
+  }
+  delete ring_buffer;
+}
 #endif  // !defined(V8_USE_PERFETTO)
 
 // Perfetto has an internal JSON exporter.
@@ -261,6 +342,41 @@ TEST_F(PlatformTracingTest, TestTracingController) {
   i::V8::SetPlatformForTesting(old_platform);
 }
 
+TEST_F(PlatformTracingTest, TestTracingControllerSampling) {
+  v8::Platform* old_platform = i::V8::GetCurrentPlatform();
+  std::unique_ptr<v8::Platform> default_platform(
+      v8::platform::NewDefaultPlatform());
+  i::V8::SetPlatformForTesting(default_platform.get());
+
+  auto tracing = std::make_unique<v8::platform::tracing::TracingController>();
+  v8::platform::tracing::TracingController* tracing_controller = tracing.get();
+  static_cast<v8::platform::DefaultPlatform*>(default_platform.get())
+      ->SetTracingController(std::move(tracing));
+
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer =
+      TraceBuffer::CreateTraceBufferRingBuffer(1, writer);
+  tracing_controller->Initialize(ring_buffer);
+  TraceConfig* trace_config = new TraceConfig();
+  trace_config->AddIncludedCategory("v8");
+  trace_config->AddIncludedCategory("v8.execute");
+  trace_config->SetCategorySamplingInterval("v8.execute", 10);
+  tracing_controller->StartTracing(trace_config);
+
+  // Only one in ten events of the sampled category is recorded.
+  for (int i = 0; i < 20; ++i) {
+    TRACE_EVENT0("v8.execute", "v8.Sampled");
+    TRACE_EVENT0("v8", "v8.Test");
+  }
+  tracing_controller->StopTracing();
+
+  auto events = writer->events();
+  CHECK_EQ(22u, events.size());
+  CHECK_EQ(2, std::count(events.begin(), events.end(), "v8.Sampled"));
+
+  i::V8::SetPlatformForTesting(old_platform);
+}
+
 TEST_F(PlatformTracingTest, TestTracingControllerMultipleArgsAndCopy) {
   std::ostringstream stream, perfetto_stream;
   uint64_t aa = 11;
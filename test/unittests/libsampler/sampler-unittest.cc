@@ -171,6 +171,47 @@ TEST_F(SamplerTest, SamplerManager_AddRemoveSampler) {
   CHECK_EQ(1, sampler1.sample_count());
 }
 
+TEST_F(SamplerTest, SamplerManager_TimerSampler) {
+  // A signal raised by the CPU time timer of a sampler samples it without the
+  // pending sample bit, but does not sample other samplers on the thread.
+  SamplerManager* manager = SamplerManager::instance();
+  CountingSampler sampler1(isolate());
+  CountingSampler sampler2(isolate());
+  sampler1.set_active(true);
+  sampler2.set_active(true);
+  manager->AddSampler(&sampler1);
+  manager->AddSampler(&sampler2);
+
+  RegisterState state;
+  manager->DoSample(state, &sampler1);
+  CHECK_EQ(1, sampler1.sample_count());
+  CHECK_EQ(0, sampler2.sample_count());
+
+  manager->RemoveSampler(&sampler1);
+  manager->RemoveSampler(&sampler2);
+  sampler1.set_active(false);
+  sampler2.set_active(false);
+}
+
+#if V8_OS_LINUX
+TEST_F(SamplerTest, CpuTimeSampling) {
+  CountingSampler sampler(isolate());
+  sampler.Start();
+  CHECK(sampler.StartCpuTimeSampling(base::TimeDelta::FromMilliseconds(1)));
+  CHECK(sampler.IsCpuTimeSampling());
+
+  // Burn CPU time on this thread until the timer has sampled it.
+  base::TimeTicks deadline =
+      base::TimeTicks::Now() + base::TimeDelta::FromSeconds(60);
+  while (sampler.sample_count() < 5 && base::TimeTicks::Now() < deadline) {
+  }
+  CHECK_LE(5, sampler.sample_count());
+
+  sampler.Stop();
+  CHECK(!sampler.IsCpuTimeSampling());
+}
+#endif  // V8_OS_LINUX
+
 TEST_F(SamplerTest, SamplerManager_DoesNotReAdd) {
   // Add the same sampler twice, but check we only get one sample for it.
   SamplerManager* manager = SamplerManager::instance();
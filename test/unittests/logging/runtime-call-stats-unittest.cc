@@ -6,6 +6,7 @@
 
 #include <atomic>
 
+#include "include/v8-profiler.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
@@ -251,6 +252,45 @@ TEST_F(RuntimeCallStatsTest, RuntimeCallTimerScope) {
   EXPECT_EQ(100, counter()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, SampledRuntimeCallTimerScope) {
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING,
+      std::memory_order_relaxed);
+  EXPECT_TRUE(RuntimeCallStats::IsSamplingEnabled());
+  {
+    RCS_SCOPE(stats(), counter_id());
+    stats()->RecordSample();
+    {
+      RCS_SCOPE(stats(), counter_id2());
+      Sleep(50);
+      stats()->RecordSample();
+      stats()->RecordSample();
+    }
+    stats()->RecordSample();
+  }
+  // Samples outside of any scope are not attributed.
+  stats()->RecordSample();
+
+  // Sampled scopes are neither counted nor timed.
+  EXPECT_EQ(0, counter()->count());
+  EXPECT_EQ(0, counter2()->time().InMicroseconds());
+  EXPECT_EQ(2, counter()->sample_count());
+  EXPECT_EQ(2, counter2()->sample_count());
+  EXPECT_EQ(0, counter3()->sample_count());
+
+  std::vector<v8::RuntimeCallCounterSamples> samples =
+      v8::CpuProfiler::TakeRuntimeCallStatsSamples(
+          reinterpret_cast<v8::Isolate*>(isolate()));
+  EXPECT_EQ(2u, samples.size());
+  for (const v8::RuntimeCallCounterSamples& entry : samples) {
+    EXPECT_EQ(2u, entry.samples);
+  }
+  EXPECT_EQ(0, counter()->sample_count());
+  EXPECT_TRUE(v8::CpuProfiler::TakeRuntimeCallStatsSamples(
+                  reinterpret_cast<v8::Isolate*>(isolate()))
+                  .empty());
+}
+
 TEST_F(RuntimeCallStatsTest, RuntimeCallTimerScopeRecursive) {
   {
     RCS_SCOPE(stats(), counter_id());
@@ -473,5 +473,47 @@ TEST_F(StrtodTest, RandomStrtod) {
   }
 }
 
+TEST_F(StrtodTest, EiselLemireStrtod) {
+  double result;
+  CHECK(EiselLemireStrtod(0, 0, &result));
+  CHECK_EQ(0.0, result);
+  CHECK(EiselLemireStrtod(0, 1000, &result));
+  CHECK_EQ(0.0, result);
+  CHECK(EiselLemireStrtod(1, 22, &result));
+  CHECK_EQ(1e22, result);
+  CHECK(EiselLemireStrtod(17976931348623157, 292, &result));
+  CHECK_EQ(1.7976931348623157e308, result);
+  CHECK(EiselLemireStrtod(22250738585072014, -324, &result));
+  CHECK_EQ(2.2250738585072014e-308, result);
+  CHECK(EiselLemireStrtod(9999999999999999999u, -19, &result));
+  CHECK_EQ(1.0, result);
+
+  // Infinity and denormals are left to Strtod.
+  CHECK(!EiselLemireStrtod(1, 309, &result));
+  CHECK(!EiselLemireStrtod(5, -324, &result));
+  CHECK(!EiselLemireStrtod(1, 400, &result));
+  // 2^53 + 1 and 10^23 = 5^23 * 2^23 are exactly halfway between two doubles.
+  CHECK(!EiselLemireStrtod(9007199254740993, 0, &result));
+  CHECK(!EiselLemireStrtod(1, 23, &result));
+
+  base::RandomNumberGenerator rng;
+  char buffer[kBufferSize];
+  for (int length = 1; length <= 19; length++) {
+    for (int i = 0; i < 100; ++i) {
+      int pos = 0;
+      uint64_t significand = 0;
+      for (int j = 0; j < length; ++j) {
+        int digit = j == 0 ? rng.NextInt(9) + 1 : rng.NextInt(10);
+        buffer[pos++] = digit + '0';
+        significand = significand * 10 + digit;
+      }
+      int exponent = DeterministicRandom() % (308 * 2 + 1) - 308 - length;
+      buffer[pos] = '\0';
+      if (!EiselLemireStrtod(significand, exponent, &result)) continue;
+      CHECK_EQ(Strtod(Vector<const char>(buffer, pos), exponent), result);
+    }
+  }
+}
+
 }  // namespace base
 }  // namespace v8
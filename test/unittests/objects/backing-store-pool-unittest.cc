@@ -0,0 +1,84 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap-inl.h"
+#include "src/objects/backing-store.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using BackingStorePoolTest = TestWithIsolate;
+
+TEST_F(BackingStorePoolTest, SizeClasses) {
+  EXPECT_FALSE(BackingStorePool::IsPoolable(0));
+  EXPECT_TRUE(BackingStorePool::IsPoolable(1));
+  EXPECT_TRUE(BackingStorePool::IsPoolable(64 * KB));
+  EXPECT_FALSE(BackingStorePool::IsPoolable(64 * KB + 1));
+  EXPECT_EQ(4 * KB, BackingStorePool::SizeClassCapacity(1));
+  EXPECT_EQ(4 * KB, BackingStorePool::SizeClassCapacity(4 * KB));
+  EXPECT_EQ(8 * KB, BackingStorePool::SizeClassCapacity(4 * KB + 1));
+  EXPECT_EQ(64 * KB, BackingStorePool::SizeClassCapacity(64 * KB));
+}
+
+TEST_F(BackingStorePoolTest, ReleasedMemoryIsReusedZeroed) {
+  BackingStorePool pool(i_isolate()->heap(),
+                        i_isolate()->array_buffer_allocator());
+  const uint64_t external_before = i_isolate()->heap()->external_memory();
+  EXPECT_EQ(nullptr, pool.TryAllocate(5 * KB));
+
+  void* buffer =
+      i_isolate()->array_buffer_allocator()->AllocateUninitialized(8 * KB);
+  memset(buffer, 0xab, 8 * KB);
+  pool.Release(buffer, 8 * KB);
+  EXPECT_EQ(8 * KB, pool.CachedBytesForTesting());
+  EXPECT_EQ(external_before + 8 * KB, i_isolate()->heap()->external_memory());
+
+  // A different size class doesn't hit the cached buffer.
+  EXPECT_EQ(nullptr, pool.TryAllocate(2 * KB));
+  uint8_t* reused = static_cast<uint8_t*>(pool.TryAllocate(7 * KB));
+  EXPECT_EQ(buffer, reused);
+  for (size_t i = 0; i < 8 * KB; ++i) {
+    ASSERT_EQ(0, reused[i]);
+  }
+  EXPECT_EQ(0u, pool.CachedBytesForTesting());
+  EXPECT_EQ(external_before, i_isolate()->heap()->external_memory());
+
+  pool.Release(reused, 8 * KB);
+  pool.Detach();
+  EXPECT_EQ(0u, pool.CachedBytesForTesting());
+  EXPECT_EQ(external_before, i_isolate()->heap()->external_memory());
+}
+
+TEST_F(BackingStorePoolTest, TrimKeepsRecentDemand) {
+  BackingStorePool pool(i_isolate()->heap(),
+                        i_isolate()->array_buffer_allocator());
+  auto* allocator = i_isolate()->array_buffer_allocator();
+  for (int i = 0; i < 4; ++i) {
+    pool.Release(allocator->Allocate(4 * KB), 4 * KB);
+  }
+  EXPECT_EQ(16 * KB, pool.CachedBytesForTesting());
+  // One request since the last trim keeps one buffer after the request.
+  void* buffer = pool.TryAllocate(4 * KB);
+  EXPECT_NE(nullptr, buffer);
+  pool.Trim();
+  EXPECT_EQ(4 * KB, pool.CachedBytesForTesting());
+  // No demand at all releases everything.
+  pool.Trim();
+  EXPECT_EQ(0u, pool.CachedBytesForTesting());
+  pool.Release(buffer, 4 * KB);
+  pool.Detach();
+}
+
+TEST_F(BackingStorePoolTest, DetachedPoolDoesNotCache) {
+  BackingStorePool pool(i_isolate()->heap(),
+                        i_isolate()->array_buffer_allocator());
+  pool.Detach();
+  pool.Release(i_isolate()->array_buffer_allocator()->Allocate(4 * KB), 4 * KB);
+  EXPECT_EQ(0u, pool.CachedBytesForTesting());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -1383,6 +1383,52 @@ TEST_F(ValueSerializerTest, DecodeDenseArrayContainingUndefined) {
       [this](Local<Value> value) { ExpectScriptTrue("!(0 in result)"); });
 }
 
+TEST_F(ValueSerializerTest, RoundTripDenseDoubleArray) {
+  Local<Value> value = RoundTripTest("[1.5, -0, NaN, 2, 1e300, -Infinity]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(6u, Array::Cast(*value)->Length());
+  ExpectScriptTrue("result[0] === 1.5");
+  ExpectScriptTrue("Object.is(result[1], -0)");
+  ExpectScriptTrue("Number.isNaN(result[2])");
+  ExpectScriptTrue("result[3] === 2");
+  ExpectScriptTrue("result[4] === 1e300");
+  ExpectScriptTrue("result[5] === -Infinity");
+
+  // Extra properties follow the elements.
+  value = RoundTripTest("(() => { var x = [0.5, 1.5]; x.foo = 0.25; "
+                        "return x; })()");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 2");
+  ExpectScriptTrue("result[1] === 1.5");
+  ExpectScriptTrue("result.foo === 0.25");
+
+  // Numbers mixed with other values.
+  value = RoundTripTest("[0.5, 1, 'a', 2.5]");
+  ExpectScriptTrue("result.length === 4");
+  ExpectScriptTrue("result[1] === 1");
+  ExpectScriptTrue("result[2] === 'a'");
+  ExpectScriptTrue("result[3] === 2.5");
+}
+
+TEST_F(ValueSerializerTest, DecodeDenseDoubleArray) {
+#if defined(V8_TARGET_LITTLE_ENDIAN)
+  // [0.5, 1] with extra padding between the elements.
+  DecodeTestFutureVersions(
+      {0xFF, 0x0B, 0x41, 0x02, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+       0xE0, 0x3F, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+       0x24, 0x00, 0x02},
+      [this](Local<Value> value) {
+        ASSERT_TRUE(value->IsArray());
+        ExpectScriptTrue("result.length === 2");
+        ExpectScriptTrue("result[0] === 0.5");
+        ExpectScriptTrue("result[1] === 1");
+      });
+  // Truncated data is rejected.
+  InvalidDecodeTest({0xFF, 0x0B, 0x41, 0x02, 0x4E, 0x00, 0x00, 0x00, 0x00,
+                     0x00, 0x00, 0xE0, 0x3F, 0x4E, 0x00, 0x00});
+#endif
+}
+
 TEST_F(ValueSerializerTest, RoundTripDate) {
   Local<Value> value = RoundTripTest("new Date(1e6)");
   ASSERT_TRUE(value->IsDate());
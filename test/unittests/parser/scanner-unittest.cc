@@ -155,5 +155,33 @@ TEST_F(ScannerTest, PeekAheadAheadAwaitExpression) {
   CHECK_TOK(tokens[3], scanner->PeekAheadAhead());
 }
 
+TEST_F(ScannerTest, LongComments) {
+  // The comments are long enough to be skipped in several blocks, with
+  // terminators at various offsets within the blocks.
+  const struct {
+    const char* src;
+    bool line_terminator;
+  } test_cases[] = {
+      {"a // 0123456789abcdef0123\nb", true},
+      {"a // 0123456789abcdef01234\rb", true},
+      {"a /* 0123456789abcdef0123 */ b", false},
+      {"a /* 0123456789 * / ** abcdef0123 **/ b", false},
+      {"a /* 0123456789abcdef0\n1234 * 56789abcdef */ b", true},
+      {"a /* 0123456789\nabcdef0123456789abcdef0123 */ b", true},
+  };
+
+  for (const auto& test_case : test_cases) {
+    auto scanner = make_scanner(test_case.src);
+    CHECK_TOK(Token::kIdentifier, scanner->Next());
+    CHECK_EQ(test_case.line_terminator, scanner->HasLineTerminatorBeforeNext());
+    CHECK_TOK(Token::kIdentifier, scanner->Next());
+    CHECK_TOK(Token::kEos, scanner->Next());
+  }
+
+  auto scanner = make_scanner("a /* 0123456789abcdef0123456789");
+  CHECK_TOK(Token::kIdentifier, scanner->Next());
+  CHECK_TOK(Token::kIllegal, scanner->Next());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -14,7 +14,7 @@ using CircularQueueTest = ::testing::Test;
 TEST_F(CircularQueueTest, SamplingCircularQueue) {
   using Record = v8::base::AtomicWord;
   const int kMaxRecordsInQueue = 4;
-  SamplingCircularQueue<Record, kMaxRecordsInQueue> scq;
+  SamplingCircularQueue<Record> scq(kMaxRecordsInQueue);
 
   // Check that we are using non-reserved values.
   // Fill up the first chunk.
@@ -72,10 +72,46 @@ TEST_F(CircularQueueTest, SamplingCircularQueue) {
   CHECK(!scq.Peek());
 }
 
+TEST_F(CircularQueueTest, SamplingCircularQueueResize) {
+  using Record = v8::base::AtomicWord;
+  SamplingCircularQueue<Record> scq(2);
+  CHECK_EQ(2u, scq.length());
+
+  // Wrap around once so that the positions are not at the start.
+  for (Record i = 0; i < 3; ++i) {
+    Record* rec = scq.StartEnqueue();
+    CHECK(rec);
+    *rec = i;
+    scq.FinishEnqueue();
+    CHECK_EQ(i, *scq.Peek());
+    scq.Remove();
+  }
+  CHECK(!scq.Peek());
+
+  scq.Resize(5);
+  CHECK_EQ(5u, scq.length());
+  CHECK(!scq.Peek());
+  for (Record i = 0; i < 5; ++i) {
+    Record* rec = scq.StartEnqueue();
+    CHECK(rec);
+    *rec = i;
+    scq.FinishEnqueue();
+  }
+  // The queue is full.
+  CHECK(!scq.StartEnqueue());
+  for (Record i = 0; i < 5; ++i) {
+    Record* rec = scq.Peek();
+    CHECK(rec);
+    CHECK_EQ(i, *rec);
+    scq.Remove();
+  }
+  CHECK(!scq.Peek());
+}
+
 namespace {
 
 using Record = v8::base::AtomicWord;
-using TestSampleQueue = SamplingCircularQueue<Record, 12>;
+using TestSampleQueue = SamplingCircularQueue<Record>;
 
 class ProducerThread : public v8::base::Thread {
  public:
@@ -114,7 +150,7 @@ TEST_F(CircularQueueTest, SamplingCircularQueueMultithreading) {
   // does sampling is called in the context of different VM threads.
 
   const int kRecordsPerChunk = 4;
-  TestSampleQueue scq;
+  TestSampleQueue scq(12);
   v8::base::Semaphore semaphore(0);
 
   ProducerThread producer1(&scq, kRecordsPerChunk, 1, &semaphore);
@@ -2134,6 +2134,196 @@ TEST_F(RegExpTest, PeepholeSkipUntilGtOrNotBitInTable) {
                           BC_SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE)));
 }
 
+void CreatePeepholeSkipUntilMaskedCharBytecode(RegExpMacroAssembler* m) {
+  Label start;
+  m->Bind(&start);
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckCharacterAfterAnd('x', 0x7f, nullptr);
+  m->AdvanceCurrentPosition(2);
+  m->GoTo(&start);
+}
+
+TEST_F(RegExpTest, PeepholeSkipUntilMaskedChar) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeSkipUntilMaskedCharBytecode(&orig);
+  CreatePeepholeSkipUntilMaskedCharBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  v8_flags.regexp_peephole_optimization = false;
+  DirectHandle<TrustedByteArray> array =
+      Cast<TrustedByteArray>(orig.GetCode(source, {}));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  DirectHandle<TrustedByteArray> array_optimized =
+      Cast<TrustedByteArray>(opt.GetCode(source, {}));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_AND_CHECK_CHAR) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  const int optimized_bc_length =
+      RegExpBytecodeLength(BC_SKIP_UNTIL_MASKED_CHAR);
+  int length_optimized_expected =
+      optimized_bc_length + RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_SKIP_UNTIL_MASKED_CHAR, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(optimized_bc_length));
+}
+
+void CreatePeepholeSkipUntilCharInRangeBytecode(RegExpMacroAssembler* m) {
+  Label start;
+  m->Bind(&start);
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckCharacterInRange('0', '9', nullptr);
+  m->AdvanceCurrentPosition(1);
+  m->GoTo(&start);
+}
+
+TEST_F(RegExpTest, PeepholeSkipUntilCharInRange) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeSkipUntilCharInRangeBytecode(&orig);
+  CreatePeepholeSkipUntilCharInRangeBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  v8_flags.regexp_peephole_optimization = false;
+  DirectHandle<TrustedByteArray> array =
+      Cast<TrustedByteArray>(orig.GetCode(source, {}));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  DirectHandle<TrustedByteArray> array_optimized =
+      Cast<TrustedByteArray>(opt.GetCode(source, {}));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_CHAR_IN_RANGE) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  const int optimized_bc_length =
+      RegExpBytecodeLength(BC_SKIP_UNTIL_CHAR_IN_RANGE);
+  int length_optimized_expected =
+      optimized_bc_length + RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_SKIP_UNTIL_CHAR_IN_RANGE, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(optimized_bc_length));
+}
+
+void CreatePeepholeSkipUntilCharNotInRangeBytecode(RegExpMacroAssembler* m) {
+  Label start;
+  m->Bind(&start);
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckCharacterNotInRange('a', 'z', nullptr);
+  m->AdvanceCurrentPosition(1);
+  m->GoTo(&start);
+}
+
+TEST_F(RegExpTest, PeepholeSkipUntilCharNotInRange) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeSkipUntilCharNotInRangeBytecode(&orig);
+  CreatePeepholeSkipUntilCharNotInRangeBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  v8_flags.regexp_peephole_optimization = false;
+  DirectHandle<TrustedByteArray> array =
+      Cast<TrustedByteArray>(orig.GetCode(source, {}));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  DirectHandle<TrustedByteArray> array_optimized =
+      Cast<TrustedByteArray>(opt.GetCode(source, {}));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_CHAR_NOT_IN_RANGE) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  const int optimized_bc_length =
+      RegExpBytecodeLength(BC_SKIP_UNTIL_CHAR_NOT_IN_RANGE);
+  int length_optimized_expected =
+      optimized_bc_length + RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_SKIP_UNTIL_CHAR_NOT_IN_RANGE, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(optimized_bc_length));
+}
+
+void CreatePeepholeCheckGreedyOrAdvanceBytecode(RegExpMacroAssembler* m) {
+  Label second_choice;
+  m->Bind(&second_choice);
+  m->CheckGreedyLoop(nullptr);
+  m->AdvanceCurrentPosition(-1);
+  m->GoTo(&second_choice);
+}
+
+TEST_F(RegExpTest, PeepholeCheckGreedyOrAdvance) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeCheckGreedyOrAdvanceBytecode(&orig);
+  CreatePeepholeCheckGreedyOrAdvanceBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  v8_flags.regexp_peephole_optimization = false;
+  DirectHandle<TrustedByteArray> array =
+      Cast<TrustedByteArray>(orig.GetCode(source, {}));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  DirectHandle<TrustedByteArray> array_optimized =
+      Cast<TrustedByteArray>(opt.GetCode(source, {}));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_CHECK_GREEDY) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  const int optimized_bc_length =
+      RegExpBytecodeLength(BC_CHECK_GREEDY_OR_ADVANCE_CP_AND_GOTO);
+  int length_optimized_expected =
+      optimized_bc_length + RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_CHECK_GREEDY_OR_ADVANCE_CP_AND_GOTO, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(optimized_bc_length));
+}
+
 void CreatePeepholeLabelFixupsInsideBytecode(RegExpMacroAssembler* m,
                                              Label* dummy_before,
                                              Label* dummy_after,
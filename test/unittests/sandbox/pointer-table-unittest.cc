@@ -2,10 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <set>
+#include <vector>
+
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/js-objects.h"
+#include "src/sandbox/code-pointer-table-inl.h"
 #include "src/sandbox/external-pointer-table.h"
 #include "test/unittests/heap/heap-utils.h"  // For ManualGCScope
 #include "test/unittests/test-utils.h"
@@ -15,7 +20,7 @@
 namespace v8 {
 namespace internal {
 
-using PointerTableTest = TestWithContext;
+using PointerTableTest = TestWithHeapInternalsAndContext;
 
 TEST_F(PointerTableTest, ExternalPointerTableCompaction) {
   // This tests ensures that pointer table compaction works as expected and
@@ -93,6 +98,124 @@ TEST_F(PointerTableTest, ExternalPointerTableCompaction) {
   delete external_2;
 }
 
+TEST_F(PointerTableTest, ExternalPointerTableCompactionWithMutatorWrite) {
+  // This test ensures that a write to an entry that has already been copied
+  // out of the evacuation area during marking is not lost when the handle is
+  // updated to point to the copy.
+  if (!v8_flags.incremental_marking) return;
+
+  auto* iso = i_isolate();
+  auto* heap = iso->heap();
+  auto* space = heap->old_external_pointer_space();
+
+  ManualGCScope manual_gc_scope(iso);
+
+  v8_flags.stress_compaction = true;
+
+  int* external_1 = new int;
+  int* external_2 = new int;
+  int* external_3 = new int;
+
+  {
+    v8::HandleScope scope(reinterpret_cast<v8::Isolate*>(iso));
+
+    // Fill one segment, then allocate one more entry on a second segment, as
+    // in the test above.
+    uint32_t num_entries = space->freelist_length();
+    DirectHandle<FixedArray> array = iso->factory()->NewFixedArray(num_entries);
+    {
+      v8::HandleScope inner_scope(reinterpret_cast<v8::Isolate*>(iso));
+      for (uint32_t i = 0; i < num_entries; i++) {
+        DirectHandle<JSObject> obj =
+            iso->factory()->NewExternal(external_1, AllocationType::kOld);
+        array->set(i, *obj);
+      }
+      CHECK_EQ(0, space->freelist_length());
+    }
+
+    {
+      v8::HandleScope inner_scope(reinterpret_cast<v8::Isolate*>(iso));
+
+      DirectHandle<JSExternalObject> obj = Cast<JSExternalObject>(
+          iso->factory()->NewExternal(external_2, AllocationType::kOld));
+      CHECK_EQ(2, space->NumSegmentsForTesting());
+      ExternalPointerHandle original_handle =
+          obj->ReadField<ExternalPointerHandle>(JSExternalObject::kValueOffset);
+
+      // Free one entry in the first segment and reclaim it.
+      array->set(0, *iso->factory()->undefined_value());
+      InvokeMajorGC();
+      CHECK_EQ(2, space->NumSegmentsForTesting());
+
+      // Mark incrementally. This copies the entry of `obj` out of the
+      // evacuation area. Then write to the old entry before the GC finishes.
+      SimulateIncrementalMarking(true);
+      obj->set_value(iso, external_3);
+      InvokeMajorGC();
+
+      CHECK_EQ(1, space->NumSegmentsForTesting());
+      ExternalPointerHandle current_handle =
+          obj->ReadField<ExternalPointerHandle>(JSExternalObject::kValueOffset);
+      CHECK_NE(original_handle, current_handle);
+      CHECK_EQ(obj->value(), external_3);
+    }
+  }
+
+  delete external_1;
+  delete external_2;
+  delete external_3;
+}
+
+TEST_F(PointerTableTest, SweepReusesEntriesOfDenseSegmentsFirst) {
+  // Sweeping never moves entries, but it hands out the free entries of well
+  // populated segments before those of sparsely populated ones, so that the
+  // latter can drain and be released.
+  CodePointerTable table;
+  table.Initialize();
+  CodePointerTable::Space space;
+  table.InitializeSpace(&space);
+
+  auto allocate = [&]() {
+    return table.AllocateAndInitializeEntry(&space, kNullAddress, kNullAddress,
+                                            kDefaultCodeEntrypointTag);
+  };
+
+  // Fill two segments.
+  std::vector<CodePointerHandle> first_segment = {allocate()};
+  CHECK_EQ(1, space.NumSegmentsForTesting());
+  uint32_t entries_per_segment = space.freelist_length() + 1;
+  while (space.freelist_length() > 0) first_segment.push_back(allocate());
+  std::vector<CodePointerHandle> second_segment;
+  for (uint32_t i = 0; i < entries_per_segment; i++) {
+    second_segment.push_back(allocate());
+  }
+  CHECK_EQ(2, space.NumSegmentsForTesting());
+
+  // Keep a single entry alive in the first segment and all but a few in the
+  // second one.
+  constexpr uint32_t kFreedInSecondSegment = 8;
+  table.Mark(&space, first_segment[entries_per_segment / 2]);
+  for (uint32_t i = kFreedInSecondSegment; i < entries_per_segment; i++) {
+    table.Mark(&space, second_segment[i]);
+  }
+  table.Sweep(&space, i_isolate()->counters());
+  CHECK_EQ(2, space.NumSegmentsForTesting());
+  CHECK_EQ(entries_per_segment - 1 + kFreedInSecondSegment,
+           space.freelist_length());
+
+  std::set<CodePointerHandle> freed_in_second_segment(
+      second_segment.begin(), second_segment.begin() + kFreedInSecondSegment);
+  for (uint32_t i = 0; i < kFreedInSecondSegment; i++) {
+    CHECK_EQ(1, freed_in_second_segment.erase(allocate()));
+  }
+  CodePointerHandle handle = allocate();
+  CHECK_NE(first_segment.end(),
+           std::find(first_segment.begin(), first_segment.end(), handle));
+
+  table.TearDownSpace(&space);
+  table.TearDown();
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -0,0 +1,107 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/hex-encoding.h"
+
+#include <string>
+#include <vector>
+
+#include "src/base/strings.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Long enough to cover several vector iterations and a scalar tail.
+std::vector<uint8_t> AllBytes() {
+  std::vector<uint8_t> bytes(256 + 7);
+  for (size_t i = 0; i < bytes.size(); i++) {
+    bytes[i] = static_cast<uint8_t>(i * 7);
+  }
+  return bytes;
+}
+
+std::string Encode(const std::vector<uint8_t>& bytes) {
+  std::string hex(2 * bytes.size(), '\0');
+  HexEncode(bytes.data(), bytes.size(), reinterpret_cast<uint8_t*>(hex.data()));
+  return hex;
+}
+
+std::string EncodeScalar(const std::vector<uint8_t>& bytes) {
+  static constexpr char kDigits[] = "0123456789abcdef";
+  std::string hex;
+  for (uint8_t byte : bytes) {
+    hex += kDigits[byte >> 4];
+    hex += kDigits[byte & 0x0F];
+  }
+  return hex;
+}
+
+bool Decode(const std::string& hex, std::vector<uint8_t>* bytes) {
+  bytes->resize(hex.size() / 2);
+  return HexDecode(reinterpret_cast<const uint8_t*>(hex.data()), hex.size(),
+                   bytes->data());
+}
+
+}  // namespace
+
+TEST(HexEncodingTest, Encode) {
+  std::vector<uint8_t> bytes = AllBytes();
+  for (size_t length = 0; length <= bytes.size(); length++) {
+    std::vector<uint8_t> prefix(bytes.begin(), bytes.begin() + length);
+    EXPECT_EQ(EncodeScalar(prefix), Encode(prefix));
+  }
+}
+
+TEST(HexEncodingTest, RoundTrip) {
+  std::vector<uint8_t> bytes = AllBytes();
+  std::vector<uint8_t> decoded;
+  for (size_t length = 0; length <= bytes.size(); length++) {
+    std::vector<uint8_t> prefix(bytes.begin(), bytes.begin() + length);
+    ASSERT_TRUE(Decode(Encode(prefix), &decoded));
+    EXPECT_EQ(prefix, decoded);
+  }
+}
+
+TEST(HexEncodingTest, DecodeUpperCase) {
+  std::vector<uint8_t> decoded;
+  ASSERT_TRUE(Decode("0123456789ABCDEFabcdef0123456789AbCdEf", &decoded));
+  EXPECT_EQ((std::vector<uint8_t>{0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD,
+                                  0xEF, 0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45,
+                                  0x67, 0x89, 0xAB, 0xCD, 0xEF}),
+            decoded);
+}
+
+TEST(HexEncodingTest, DecodeInvalid) {
+  std::vector<uint8_t> bytes = AllBytes();
+  const std::string valid = Encode(bytes);
+  std::vector<uint8_t> decoded;
+  // Characters just outside each of the digit ranges, plus ones that only
+  // become digits if case folding is done carelessly.
+  for (char c : {'/', ':', '@', 'G', '`', 'g', ' ', 'x', '\x80', '\xC1'}) {
+    // Both in the vector loop and in the scalar tail, in either nibble.
+    for (size_t index : {size_t{0}, size_t{1}, size_t{33}, valid.size() - 2,
+                         valid.size() - 1}) {
+      std::string hex = valid;
+      hex[index] = c;
+      EXPECT_FALSE(Decode(hex, &decoded)) << "'" << c << "' at " << index;
+    }
+  }
+}
+
+TEST(HexEncodingTest, DecodeTwoByte) {
+  std::vector<base::uc16> hex = {'0', 'f', 'A', '9'};
+  uint8_t decoded[2];
+  ASSERT_TRUE(HexDecode(hex.data(), hex.size(), decoded));
+  EXPECT_EQ(0x0F, decoded[0]);
+  EXPECT_EQ(0xA9, decoded[1]);
+  // A character whose low byte is a hex digit.
+  hex[1] = 0x0100 | 'f';
+  EXPECT_FALSE(HexDecode(hex.data(), hex.size(), decoded));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,59 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-hasher.h"
+
+#include <vector>
+
+#include "src/strings/string-hasher-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+constexpr uint64_t kTestSeed = 0x1234567890abcdef;
+}  // namespace
+
+// A two-byte string whose characters all fit in one byte must hash like the
+// equivalent one-byte string, whichever vector or tail path sees the chars.
+TEST(StringHasherTest, TwoByteLatin1MatchesOneByte) {
+  for (uint32_t length = 0; length < 80; length++) {
+    std::vector<uint8_t> one_byte(length);
+    std::vector<uint16_t> two_byte(length);
+    for (uint32_t i = 0; i < length; i++) {
+      uint8_t c = static_cast<uint8_t>('a' + (i * 7 + 3) % 26);
+      if (i % 5 == 4) c = static_cast<uint8_t>(0xa0 + i % 0x60);
+      one_byte[i] = c;
+      two_byte[i] = c;
+    }
+    EXPECT_EQ(StringHasher::HashSequentialString(one_byte.data(), length,
+                                                 kTestSeed),
+              StringHasher::HashSequentialString(two_byte.data(), length,
+                                                 kTestSeed));
+  }
+}
+
+// A single character outside latin-1 at any position makes the string hash
+// as raw two-byte data.
+TEST(StringHasherTest, TwoByteNonLatin1AnyPosition) {
+  constexpr uint32_t kLength = 37;
+  std::vector<uint8_t> one_byte(kLength, 'x');
+  std::vector<uint16_t> two_byte(kLength, 'x');
+  uint32_t one_byte_hash =
+      StringHasher::HashSequentialString(one_byte.data(), kLength, kTestSeed);
+  for (uint32_t pos = 0; pos < kLength; pos++) {
+    two_byte[pos] = 0x100 + 'x';
+    uint32_t two_byte_hash = StringHasher::HashSequentialString(
+        two_byte.data(), kLength, kTestSeed);
+    EXPECT_NE(one_byte_hash, two_byte_hash) << "pos " << pos;
+    // Hashing is deterministic for a given seed.
+    EXPECT_EQ(two_byte_hash, StringHasher::HashSequentialString(
+                                 two_byte.data(), kLength, kTestSeed));
+    two_byte[pos] = 'x';
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
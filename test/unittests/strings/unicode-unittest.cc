@@ -495,6 +495,45 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, Utf8DecoderEncodings) {
+  const struct {
+    std::vector<uint8_t> bytes;
+    bool is_one_byte;
+    std::vector<uint16_t> utf16_expected;
+  } tests[] = {
+      // Latin-1.
+      {{0x63, 0x61, 0x66, 0xC3, 0xA9, 0xC2, 0xA0},
+       true,
+       {0x63, 0x61, 0x66, 0xE9, 0xA0}},
+      // Two-byte, with a surrogate pair.
+      {{0x61, 0xC4, 0x80, 0xF0, 0x9F, 0x98, 0x8D, 0x62},
+       false,
+       {0x61, 0x100, 0xD83D, 0xDE0D, 0x62}},
+      // Ill-formed.
+      {{0x61, 0xC3, 0x62}, false, {0x61, 0xFFFD, 0x62}},
+  };
+
+  for (auto& test : tests) {
+    auto utf8_data = base::VectorOf(test.bytes);
+    Utf8Decoder decoder(utf8_data);
+    CHECK_EQ(decoder.is_one_byte(), test.is_one_byte);
+    CHECK_EQ(static_cast<size_t>(decoder.utf16_length()),
+             test.utf16_expected.size());
+
+    std::vector<uint16_t> utf16(decoder.utf16_length());
+    decoder.Decode(utf16.data(), utf8_data);
+    CHECK(utf16 == test.utf16_expected);
+
+    if (test.is_one_byte) {
+      std::vector<uint8_t> one_byte(decoder.utf16_length());
+      decoder.Decode(one_byte.data(), utf8_data);
+      for (size_t i = 0; i < one_byte.size(); ++i) {
+        CHECK_EQ(one_byte[i], test.utf16_expected[i]);
+      }
+    }
+  }
+}
+
 class UnicodeWithGCTest : public TestWithHeapInternals {};
 
 #define GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING(NAME, STRING)               \
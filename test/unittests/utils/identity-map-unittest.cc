@@ -611,6 +611,40 @@ TEST_F(IdentityMapTest, Delete_smi_resizes) {
   CHECK_EQ(t.map.capacity(), initial_capacity);
 }
 
+TEST_F(IdentityMapTest, Delete_smi_reuses_slots) {
+  const int kKeyCount = 256;
+  const int kRounds = 64;
+  IdentityMapTester t(isolate()->heap(), zone());
+
+  for (int i = 0; i < kKeyCount; i++) {
+    t.map.Insert(smi(i), reinterpret_cast<void*>(i + 1));
+  }
+  int capacity = t.map.capacity();
+
+  // Replace a quarter of the keys in every round. Deleted slots must be
+  // reused or reclaimed, so the capacity stays the same.
+  for (int round = 0; round < kRounds; round++) {
+    int first_old = round * kKeyCount / 4;
+    int first_new = first_old + kKeyCount;
+    for (int i = 0; i < kKeyCount / 4; i++) {
+      t.CheckDelete(smi(first_old + i),
+                    reinterpret_cast<void*>(first_old + i + 1));
+      t.map.Insert(smi(first_new + i),
+                   reinterpret_cast<void*>(first_new + i + 1));
+    }
+    CHECK_EQ(kKeyCount, t.map.size());
+    CHECK_EQ(capacity, t.map.capacity());
+  }
+
+  int first_live = kRounds * kKeyCount / 4;
+  for (int i = 0; i < first_live; i++) {
+    CHECK_NULL(t.map.Find(smi(i)));
+  }
+  for (int i = first_live; i < first_live + kKeyCount; i++) {
+    t.CheckFind(smi(i), reinterpret_cast<void*>(i + 1));
+  }
+}
+
 TEST_F(IdentityMapTest, Iterator_smi_num) {
   IdentityMapTester t(isolate()->heap(), zone());
   int smi_keys[] = {1, 2, 7, 15, 23};
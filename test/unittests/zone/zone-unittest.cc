@@ -25,5 +25,37 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentsAreReused) {
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+  }
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  const size_t pool_size = allocator.GetCurrentPoolSize();
+  EXPECT_LT(0u, pool_size);
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+    EXPECT_EQ(pool_size, allocator.GetCurrentMemoryUsage());
+    EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  }
+  EXPECT_EQ(pool_size, allocator.GetCurrentPoolSize());
+}
+
+TEST_F(ZoneTest, TrimSegmentPool) {
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    for (int i = 0; i < 16; ++i) zone.Allocate<ZoneTestTag>(16 * KB);
+  }
+  const size_t pool_size = allocator.GetCurrentPoolSize();
+  EXPECT_LT(0u, pool_size);
+  allocator.TrimSegmentPool(pool_size / 2);
+  EXPECT_GE(pool_size / 2, allocator.GetCurrentPoolSize());
+  allocator.TrimSegmentPool(0);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,38 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/wasm-api-tests/wasm-api-test.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+// Embedders call small exported functions from native code in tight loops.
+// Check that many calls with all numeric parameter types stay correct.
+TEST_F(WasmCapiTest, RepeatedNumericCalls) {
+  ValueType reps[] = {kWasmF64, kWasmI32, kWasmI64, kWasmF32, kWasmF64};
+  FunctionSig sig(1, 4, reps);
+  uint8_t code[] = {WASM_F64_ADD(
+      WASM_F64_ADD(WASM_F64_SCONVERT_I32(WASM_LOCAL_GET(0)),
+                   WASM_F64_SCONVERT_I64(WASM_LOCAL_GET(1))),
+      WASM_F64_ADD(WASM_F64_CONVERT_F32(WASM_LOCAL_GET(2)),
+                   WASM_LOCAL_GET(3)))};
+  AddExportedFunction(base::CStrVector("sum"), code, sizeof(code), &sig);
+  vec<Extern*> imports = vec<Extern*>::make();
+  Instantiate(imports);
+
+  Func* sum = GetExportedFunction(0);
+  vec<Val> results = vec<Val>::make_uninitialized(1);
+  for (int i = 0; i < 100000; ++i) {
+    vec<Val> args = vec<Val>::make(Val::i32(i), Val::i64(int64_t{1} << 40),
+                                   Val::f32(0.5f), Val::f64(-1.0 * i));
+    own<Trap> trap = sum->call(args, results);
+    ASSERT_EQ(nullptr, trap);
+    ASSERT_EQ(static_cast<double>(int64_t{1} << 40) + 0.5, results[0].f64());
+  }
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -195,8 +195,10 @@ export class LogReader {
       const frame = stack[i];
       const firstChar = frame[0];
       if (firstChar === '+' || firstChar === '-') {
-        // An offset from the previous frame.
-        prevFrame += this.parseFrame(frame);
+        // An offset from the previous frame. Parse it without its sign, since
+        // BigInt does not accept signed hexadecimal strings.
+        const offset = this.parseFrame(frame.substring(1));
+        prevFrame = firstChar === '+' ? prevFrame + offset : prevFrame - offset;
         fullStack.push(prevFrame);
       // Filter out possible 'overflow' string.
       } else if (firstChar !== 'o') {